@@ -0,0 +1,633 @@
+// Block cache.
+//
+// The block cache sits between the filesystems and the raw block drivers.
+// Each partition's raw driver is wrapped by bcache_attach(), which hands
+// back a block_driver whose bread/bwrite are served from an LRU list of
+// in-memory block copies.
+//
+// Writes are write-back: bwrite only updates the cached copy and marks it
+// dirty. Dirty blocks reach the disk when they are recycled, or when
+// bcache_flush() is called.
+//
+// A buffer is B_BUSY while some process is copying to/from it or while
+// it is being read from or written to the disk. The cache lock is never
+// held across driver I/O.
+//
+// Read-ahead claims buffers for blocks that are not cached yet and starts
+// an asynchronous read into them; the driver's completion callback marks
+// them valid and releases them, so readers that get there first simply
+// wait for the data like for any other busy buffer. It never takes the last
+// BCACHE_RESERVE clean, unused buffers, so that synchronous reads still
+// find one to recycle while read-ahead is in flight.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "spinlock.h"
+#include "vfs.h"
+#include "bcache.h"
+
+#define B_BUSY  0x1  // buffer is locked by some process
+#define B_VALID 0x2  // buffer has been read from disk
+#define B_DIRTY 0x4  // buffer needs to be written to disk
+
+#define BCACHE_NHASH 64
+#define BCACHE_NDRV  8
+#define BCACHE_MAXRUN 32 // most buffers held by one breadv
+#define BCACHE_RESERVE BCACHE_MAXRUN // clean buffers read-ahead leaves alone
+
+struct cbuf {
+    int flags;
+
+    // cache key
+    int device, part, b_num;
+
+    // driver used for misses and write-backs
+    struct block_driver* raw;
+
+    struct cbuf* prev; // LRU cache list
+    struct cbuf* next;
+    struct cbuf* hnext; // hash chain
+
+    uchar data[VFS_BLOCK_SIZE];
+};
+
+struct cached_driver {
+    struct block_driver drv; // must be first -- handed out to the VFS
+    struct block_driver* raw;
+};
+
+static struct {
+    struct spinlock lock;
+    struct cbuf buf[NBUF];
+
+    // Linked list of all buffers, through prev/next.
+    // head.next is most recently used.
+    struct cbuf head;
+    struct cbuf* hash[BCACHE_NHASH];
+
+    struct cached_driver drv[BCACHE_NDRV];
+    int n_drv;
+
+    struct bcache_stats stats;
+} bcache;
+
+static int bcache_bread(struct block_driver* self, void* buffer, int b_num);
+static int bcache_bwrite(struct block_driver* self, void* buffer, int b_num);
+static int bcache_breadv(struct block_driver* self, void** buffers, int b_num, int count);
+static int bcache_bwritev(struct block_driver* self, void** buffers, int b_num, int count);
+static void bcache_breadahead(struct block_driver* self, int b_num, int count);
+
+// A read-ahead in flight: the buffers it holds, in block order
+struct rahead {
+    struct cbuf* run[BCACHE_MAXRUN];
+    void* data[BCACHE_MAXRUN];
+    int n;
+};
+
+static inline int bhash(int device, int part, int b_num)
+{
+    return (uint)(device * 31 + part * 7 + b_num) % BCACHE_NHASH;
+}
+
+static void unhash(struct cbuf* b)
+{
+    struct cbuf** pp = &bcache.hash[bhash(b->device, b->part, b->b_num)];
+
+    while(*pp != 0) {
+        if(*pp == b) {
+            *pp = b->hnext;
+            break;
+        }
+
+        pp = &(*pp)->hnext;
+    }
+
+    b->hnext = 0;
+}
+
+void bcache_init()
+{
+    struct cbuf* b;
+
+    initlock(&bcache.lock, "bcache");
+
+    // Create linked list of buffers
+    bcache.head.prev = &bcache.head;
+    bcache.head.next = &bcache.head;
+
+    for(b = bcache.buf; b < bcache.buf + NBUF; b++) {
+        b->next = bcache.head.next;
+        b->prev = &bcache.head;
+        b->raw = 0;
+        b->device = -1;
+
+        bcache.head.next->prev = b;
+        bcache.head.next = b;
+    }
+}
+
+struct block_driver* bcache_attach(struct block_driver* raw)
+{
+    acquire(&bcache.lock);
+
+    if(bcache.n_drv >= BCACHE_NDRV) {
+        panic("bcache_attach: too many drivers");
+    }
+
+    struct cached_driver* cd = &bcache.drv[bcache.n_drv];
+    bcache.n_drv++;
+
+    release(&bcache.lock);
+
+    cd->raw = raw;
+    cd->drv.info = raw->info;
+    cd->drv.device = raw->device;
+
+    cd->drv.bread = bcache_bread;
+    cd->drv.bwrite = bcache_bwrite;
+    cd->drv.breadv = bcache_breadv;
+    cd->drv.bwritev = bcache_bwritev;
+    cd->drv.breadv_async = 0;
+    cd->drv.breadahead = bcache_breadahead;
+
+    return &cd->drv;
+}
+
+// Write a dirty buffer back to its driver.
+// Caller must hold the buffer (B_BUSY), but not bcache.lock.
+static int bwriteback(struct cbuf* b)
+{
+    if(b->raw->bwrite(b->raw, b->data, b->b_num) < 0) {
+        return -1;
+    }
+
+    acquire(&bcache.lock);
+    b->flags &= ~B_DIRTY;
+    bcache.stats.writebacks++;
+    release(&bcache.lock);
+
+    return 0;
+}
+
+// Move a buffer to the head of the LRU list, and wake up anyone waiting
+// for it. Caller must hold bcache.lock.
+static void brelse_locked(struct cbuf* b)
+{
+    b->flags &= ~B_BUSY;
+
+    b->next->prev = b->prev;
+    b->prev->next = b->next;
+    b->next = bcache.head.next;
+    b->prev = &bcache.head;
+    bcache.head.next->prev = b;
+    bcache.head.next = b;
+
+    wakeup(b);
+}
+
+// Release a buffer, moving it to the head of the LRU list.
+static void brelse(struct cbuf* b)
+{
+    acquire(&bcache.lock);
+    brelse_locked(b);
+    release(&bcache.lock);
+}
+
+// Find the cached buffer of block b_num of cd, if any.
+// Caller must hold bcache.lock.
+static struct cbuf* blookup(struct cached_driver* cd, int b_num)
+{
+    struct cbuf* b;
+
+    int device = cd->drv.device;
+    int part = cd->drv.info.b_start;
+
+    for(b = bcache.hash[bhash(device, part, b_num)]; b != 0; b = b->hnext) {
+        if(b->device == device && b->part == part && b->b_num == b_num) {
+            return b;
+        }
+    }
+
+    return 0;
+}
+
+// Give the unused, clean buffer b to block b_num of cd and mark it B_BUSY.
+// Caller must hold bcache.lock.
+static void bassign(struct cbuf* b, struct cached_driver* cd, int b_num)
+{
+    unhash(b);
+
+    b->device = cd->drv.device;
+    b->part = cd->drv.info.b_start;
+    b->b_num = b_num;
+    b->raw = cd->raw;
+    b->flags = B_BUSY;
+
+    int h = bhash(b->device, b->part, b_num);
+
+    b->hnext = bcache.hash[h];
+    bcache.hash[h] = b;
+}
+
+// Look through the cache for the block of the given driver.
+// If not found, recycle the least recently used clean buffer,
+// writing back dirty ones that are in the way.
+// In either case, return a B_BUSY buffer.
+//
+// A dirty buffer whose write-back fails stays dirty, and brelse() moves it
+// to the front of the list, so the next scan tries the next victim. Returns
+// 0 if no buffer can be recycled: all are busy, or the write-backs keep
+// failing.
+static struct cbuf* bget(struct cached_driver* cd, int b_num)
+{
+    struct cbuf* b;
+    int failed = 0;
+
+    acquire(&bcache.lock);
+
+loop:
+    // Is the block already cached?
+    if((b = blookup(cd, b_num)) != 0) {
+        if(b->flags & B_BUSY) {
+            // nothing holds a buffer across a sleep before the first
+            // process exists, so this only happens once we can sleep
+            sleep(b, &bcache.lock);
+            goto loop;
+        }
+
+        b->flags |= B_BUSY;
+        release(&bcache.lock);
+
+        return b;
+    }
+
+    // Not cached; recycle the least recently used unused buffer.
+    for(b = bcache.head.prev; b != &bcache.head && failed < NBUF; b = b->prev) {
+        if(b->flags & B_BUSY) {
+            continue;
+        }
+
+        // the old contents have to reach the disk first -- the lock has
+        // to be dropped for the I/O, so rescan afterwards
+        if(b->flags & B_DIRTY) {
+            b->flags |= B_BUSY;
+            release(&bcache.lock);
+
+            if(bwriteback(b) < 0) {
+                cprintf("bget: write-back of block %d failed\n", b->b_num);
+                failed++;
+            }
+
+            brelse(b);
+            acquire(&bcache.lock);
+
+            goto loop;
+        }
+
+        bassign(b, cd, b_num);
+
+        release(&bcache.lock);
+        return b;
+    }
+
+    release(&bcache.lock);
+    return 0;
+}
+
+static int bcache_bread(struct block_driver* self, void* buffer, int b_num)
+{
+    struct cached_driver* cd = (struct cached_driver*)self;
+    struct cbuf* b = bget(cd, b_num);
+
+    if(b == 0) {
+        return -1;
+    }
+
+    if(b->flags & B_VALID) {
+        acquire(&bcache.lock);
+        bcache.stats.hits++;
+        release(&bcache.lock);
+    }
+    else {
+        if(cd->raw->bread(cd->raw, b->data, b_num) < 0) {
+            brelse(b);
+            return -1;
+        }
+
+        acquire(&bcache.lock);
+        b->flags |= B_VALID;
+        bcache.stats.misses++;
+        release(&bcache.lock);
+    }
+
+    memmove(buffer, b->data, VFS_BLOCK_SIZE);
+    brelse(b);
+
+    return VFS_BLOCK_SIZE;
+}
+
+static int bcache_bwrite(struct block_driver* self, void* buffer, int b_num)
+{
+    struct cached_driver* cd = (struct cached_driver*)self;
+    struct cbuf* b = bget(cd, b_num);
+
+    if(b == 0) {
+        return -1;
+    }
+
+    // whole block is overwritten -- no need to read it in first
+    memmove(b->data, buffer, VFS_BLOCK_SIZE);
+
+    acquire(&bcache.lock);
+    b->flags |= B_VALID | B_DIRTY;
+    release(&bcache.lock);
+
+    brelse(b);
+    return VFS_BLOCK_SIZE;
+}
+
+// Read a run of blocks. Cached blocks are copied out directly; each run of
+// consecutive misses is read with a single breadv on the raw driver.
+//
+// The buffers of a run are held (B_BUSY) together. They are always taken in
+// ascending block order, and everyone else only ever holds one buffer, so
+// this cannot deadlock.
+static int bcache_breadv(struct block_driver* self, void** buffers, int b_num, int count)
+{
+    struct cached_driver* cd = (struct cached_driver*)self;
+    struct cbuf* run[BCACHE_MAXRUN];
+    void* data[BCACHE_MAXRUN];
+    int i = 0;
+
+    while(i < count) {
+        struct cbuf* b = bget(cd, b_num + i);
+
+        if(b == 0) {
+            return -1;
+        }
+
+        if(b->flags & B_VALID) {
+            memmove(buffers[i], b->data, VFS_BLOCK_SIZE);
+            brelse(b);
+
+            acquire(&bcache.lock);
+            bcache.stats.hits++;
+            release(&bcache.lock);
+
+            i++;
+            continue;
+        }
+
+        // collect the run of misses starting here
+        int n = 0;
+        run[n] = b;
+        data[n++] = b->data;
+
+        while(i + n < count && n < BCACHE_MAXRUN) {
+            b = bget(cd, b_num + i + n);
+
+            // out of buffers -- read what we have, the next bget fails
+            if(b == 0) {
+                break;
+            }
+
+            if(b->flags & B_VALID) {
+                brelse(b);
+                break;
+            }
+
+            run[n] = b;
+            data[n++] = b->data;
+        }
+
+        int ok = cd->raw->breadv(cd->raw, data, b_num + i, n) >= 0;
+
+        acquire(&bcache.lock);
+
+        for(int k = 0; k < n && ok; k++) {
+            run[k]->flags |= B_VALID;
+        }
+
+        if(ok) {
+            bcache.stats.misses += n;
+        }
+
+        release(&bcache.lock);
+
+        for(int k = 0; k < n; k++) {
+            if(ok) {
+                memmove(buffers[i + k], run[k]->data, VFS_BLOCK_SIZE);
+            }
+
+            brelse(run[k]);
+        }
+
+        if(!ok) {
+            return -1;
+        }
+
+        i += n;
+    }
+
+    return count * VFS_BLOCK_SIZE;
+}
+
+// Writes only touch the cache, so there is nothing to batch here;
+// runs of dirty blocks reach the disk when they are written back.
+static int bcache_bwritev(struct block_driver* self, void** buffers, int b_num, int count)
+{
+    for(int i = 0; i < count; i++) {
+        if(bcache_bwrite(self, buffers[i], b_num + i) < 0) {
+            return -1;
+        }
+    }
+
+    return count * VFS_BLOCK_SIZE;
+}
+
+// Completion of a read-ahead (usually called from the driver's interrupt
+// handler): the data is in, so release the buffers to their readers.
+static void bcache_readahead_done(void* arg, int error)
+{
+    struct rahead* ra = arg;
+
+    acquire(&bcache.lock);
+
+    for(int i = 0; i < ra->n; i++) {
+        struct cbuf* b = ra->run[i];
+
+        // on failure, the buffer stays invalid and the next reader retries
+        if(!error) {
+            b->flags |= B_VALID;
+        }
+
+        brelse_locked(b);
+    }
+
+    if(!error) {
+        bcache.stats.readaheads += ra->n;
+    }
+
+    release(&bcache.lock);
+    kfree_small(ra);
+}
+
+// Number of buffers that are neither busy nor dirty.
+// Caller must hold bcache.lock.
+static int nclean(void)
+{
+    struct cbuf* b;
+    int n = 0;
+
+    for(b = bcache.buf; b < bcache.buf + NBUF; b++) {
+        if((b->flags & (B_BUSY | B_DIRTY)) == 0) {
+            n++;
+        }
+    }
+
+    return n;
+}
+
+// Start reading the blocks of [b_num, b_num + count) that are not cached yet,
+// one asynchronous request per run of them. Never waits: only clean, unused
+// buffers are recycled, and read-ahead stops once only BCACHE_RESERVE of
+// them are left.
+static void bcache_breadahead(struct block_driver* self, int b_num, int count)
+{
+    struct cached_driver* cd = (struct cached_driver*)self;
+    int end = b_num + count;
+
+    if(cd->raw->breadv_async == 0) {
+        return;
+    }
+
+    if(end > self->info.b_end - self->info.b_start) {
+        end = self->info.b_end - self->info.b_start;
+    }
+
+    while(b_num < end) {
+        struct rahead* ra = kmalloc(sizeof(*ra));
+        int first = b_num;
+        int full = 0;
+
+        if(ra == 0) {
+            return;
+        }
+
+        ra->n = 0;
+        acquire(&bcache.lock);
+
+        int spare = nclean() - BCACHE_RESERVE;
+
+        // collect the next run of blocks that are not cached
+        for(; b_num < end && ra->n < BCACHE_MAXRUN; b_num++) {
+            if(blookup(cd, b_num) != 0) {
+                if(ra->n > 0) {
+                    break;
+                }
+
+                continue;
+            }
+
+            struct cbuf* b;
+
+            // keep the reserve for synchronous readers
+            if(spare <= 0) {
+                full = 1;
+                break;
+            }
+
+            for(b = bcache.head.prev; b != &bcache.head; b = b->prev) {
+                if((b->flags & (B_BUSY | B_DIRTY)) == 0) {
+                    break;
+                }
+            }
+
+            if(b == &bcache.head) {
+                full = 1;
+                break;
+            }
+
+            spare--;
+
+            if(ra->n == 0) {
+                first = b_num;
+            }
+
+            bassign(b, cd, b_num);
+
+            ra->run[ra->n] = b;
+            ra->data[ra->n] = b->data;
+            ra->n++;
+        }
+
+        release(&bcache.lock);
+
+        if(ra->n == 0) {
+            kfree_small(ra);
+            return;
+        }
+
+        if(cd->raw->breadv_async(cd->raw, ra->data, first, ra->n, bcache_readahead_done, ra) < 0) {
+            bcache_readahead_done(ra, 1);
+            return;
+        }
+
+        if(full) {
+            return;
+        }
+    }
+}
+
+void bcache_flush(struct block_driver* drv)
+{
+    struct cbuf* b;
+
+    acquire(&bcache.lock);
+
+    for(b = bcache.buf; b < bcache.buf + NBUF; b++) {
+again:
+        if(drv != 0 && (b->device != drv->device || b->part != drv->info.b_start)) {
+            continue;
+        }
+
+        if((b->flags & B_DIRTY) == 0) {
+            continue;
+        }
+
+        // the holder may be writing it back already -- wait and recheck
+        if(b->flags & B_BUSY) {
+            sleep(b, &bcache.lock);
+            goto again;
+        }
+
+        b->flags |= B_BUSY;
+        release(&bcache.lock);
+
+        if(bwriteback(b) < 0) {
+            cprintf("bcache_flush: write-back of block %d failed\n", b->b_num);
+        }
+
+        brelse(b);
+        acquire(&bcache.lock);
+    }
+
+    release(&bcache.lock);
+}
+
+void bcache_stat(struct bcache_stats* st)
+{
+    acquire(&bcache.lock);
+    *st = bcache.stats;
+    release(&bcache.lock);
+}
+
+void bcachedump()
+{
+    struct bcache_stats st;
+    bcache_stat(&st);
+
+    cprintf("bcache: %d hits, %d misses, %d writebacks, %d read ahead\n",
+            st.hits, st.misses, st.writebacks, st.readaheads);
+}
@@ -0,0 +1,59 @@
+#pragma once
+#include "types.h"
+#include "vfs.h"
+
+/**
+ * Block cache statistics
+ *
+ * Running counters maintained by the block cache since boot:
+ *   + hits: block reads that were served from memory
+ *   + misses: block reads that had to go to the underlying driver
+ *   + writebacks: dirty blocks that were written out to the underlying driver
+ *   + readaheads: blocks that were read in ahead of time (see breadahead)
+ */
+struct bcache_stats {
+    uint hits, misses, writebacks, readaheads;
+};
+
+/**
+ * Initialise the block cache
+ *
+ * Must be called before any block driver is wrapped with bcache_attach()
+ */
+void bcache_init();
+
+/**
+ * Wrap a block driver with the block cache
+ *
+ * Returns a new block_driver ``instance'' which has the same partition and device
+ * information as the raw driver, but whose bread and bwrite operations are served
+ * from an LRU write-back cache. Only cache misses and write-backs of dirty blocks
+ * reach the raw driver. If the raw driver supports breadv_async, the caching driver
+ * also implements breadahead.
+ *
+ * Blocks are cached per (device, partition, block number), so every partition should
+ * be wrapped separately.
+ *
+ * @param raw - the driver that performs the actual I/O
+ * @return the caching driver, which should be registered with the VFS instead of raw
+ */
+struct block_driver* bcache_attach(struct block_driver* raw);
+
+/**
+ * Write all dirty blocks back to their underlying drivers
+ *
+ * @param drv - only flush blocks belonging to this (cached) driver, or 0 for all blocks
+ */
+void bcache_flush(struct block_driver* drv);
+
+/**
+ * Retrieve the block cache statistics
+ *
+ * @param st - where to place the counters (out variable)
+ */
+void bcache_stat(struct bcache_stats* st);
+
+/**
+ * Print the block cache statistics to the console (for debugging)
+ */
+void bcachedump();
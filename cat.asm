@@ -0,0 +1,1343 @@
+
+_cat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <cat>:
+
+char buf[512];
+
+void
+cat(int fd)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 18             	sub    $0x18,%esp
+  int n;
+
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+   6:	eb 31                	jmp    39 <cat+0x39>
+    //printf(2, "called\n");
+    if (write(1, buf, n) != n) {
+   8:	83 ec 04             	sub    $0x4,%esp
+   b:	ff 75 f4             	push   -0xc(%ebp)
+   e:	68 20 20 00 00       	push   $0x2020
+  13:	6a 01                	push   $0x1
+  15:	e8 65 04 00 00       	call   47f <write>
+  1a:	83 c4 10             	add    $0x10,%esp
+  1d:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+  20:	74 17                	je     39 <cat+0x39>
+      printf(2, "cat: write error\n");
+  22:	83 ec 08             	sub    $0x8,%esp
+  25:	68 00 10 00 00       	push   $0x1000
+  2a:	6a 02                	push   $0x2
+  2c:	e8 d2 05 00 00       	call   603 <printf>
+  31:	83 c4 10             	add    $0x10,%esp
+      exit();
+  34:	e8 26 04 00 00       	call   45f <exit>
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+  39:	83 ec 04             	sub    $0x4,%esp
+  3c:	68 00 02 00 00       	push   $0x200
+  41:	68 20 20 00 00       	push   $0x2020
+  46:	ff 75 08             	push   0x8(%ebp)
+  49:	e8 29 04 00 00       	call   477 <read>
+  4e:	83 c4 10             	add    $0x10,%esp
+  51:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  54:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  58:	7f ae                	jg     8 <cat+0x8>
+    }
+    //sleep(1);
+  }
+  if(n < 0){
+  5a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  5e:	79 17                	jns    77 <cat+0x77>
+    printf(2, "cat: read error\n");
+  60:	83 ec 08             	sub    $0x8,%esp
+  63:	68 12 10 00 00       	push   $0x1012
+  68:	6a 02                	push   $0x2
+  6a:	e8 94 05 00 00       	call   603 <printf>
+  6f:	83 c4 10             	add    $0x10,%esp
+    exit();
+  72:	e8 e8 03 00 00       	call   45f <exit>
+  }
+}
+  77:	90                   	nop
+  78:	c9                   	leave
+  79:	c3                   	ret
+
+0000007a <main>:
+
+int
+main(int argc, char *argv[])
+{
+  7a:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  7e:	83 e4 f0             	and    $0xfffffff0,%esp
+  81:	ff 71 fc             	push   -0x4(%ecx)
+  84:	55                   	push   %ebp
+  85:	89 e5                	mov    %esp,%ebp
+  87:	53                   	push   %ebx
+  88:	51                   	push   %ecx
+  89:	83 ec 10             	sub    $0x10,%esp
+  8c:	89 cb                	mov    %ecx,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+  8e:	83 3b 01             	cmpl   $0x1,(%ebx)
+  91:	7f 12                	jg     a5 <main+0x2b>
+    cat(0);
+  93:	83 ec 0c             	sub    $0xc,%esp
+  96:	6a 00                	push   $0x0
+  98:	e8 63 ff ff ff       	call   0 <cat>
+  9d:	83 c4 10             	add    $0x10,%esp
+    exit();
+  a0:	e8 ba 03 00 00       	call   45f <exit>
+  }
+
+  for(i = 1; i < argc; i++){
+  a5:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  ac:	eb 71                	jmp    11f <main+0xa5>
+    if((fd = open(argv[i], 0)) < 0){
+  ae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  b1:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  b8:	8b 43 04             	mov    0x4(%ebx),%eax
+  bb:	01 d0                	add    %edx,%eax
+  bd:	8b 00                	mov    (%eax),%eax
+  bf:	83 ec 08             	sub    $0x8,%esp
+  c2:	6a 00                	push   $0x0
+  c4:	50                   	push   %eax
+  c5:	e8 d5 03 00 00       	call   49f <open>
+  ca:	83 c4 10             	add    $0x10,%esp
+  cd:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  d0:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  d4:	79 29                	jns    ff <main+0x85>
+      printf(2, "cat: cannot open %s\n", argv[i]);
+  d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  d9:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  e0:	8b 43 04             	mov    0x4(%ebx),%eax
+  e3:	01 d0                	add    %edx,%eax
+  e5:	8b 00                	mov    (%eax),%eax
+  e7:	83 ec 04             	sub    $0x4,%esp
+  ea:	50                   	push   %eax
+  eb:	68 23 10 00 00       	push   $0x1023
+  f0:	6a 02                	push   $0x2
+  f2:	e8 0c 05 00 00       	call   603 <printf>
+  f7:	83 c4 10             	add    $0x10,%esp
+      exit();
+  fa:	e8 60 03 00 00       	call   45f <exit>
+    }
+    cat(fd);
+  ff:	83 ec 0c             	sub    $0xc,%esp
+ 102:	ff 75 f0             	push   -0x10(%ebp)
+ 105:	e8 f6 fe ff ff       	call   0 <cat>
+ 10a:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+ 10d:	83 ec 0c             	sub    $0xc,%esp
+ 110:	ff 75 f0             	push   -0x10(%ebp)
+ 113:	e8 6f 03 00 00       	call   487 <close>
+ 118:	83 c4 10             	add    $0x10,%esp
+  for(i = 1; i < argc; i++){
+ 11b:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 11f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 122:	3b 03                	cmp    (%ebx),%eax
+ 124:	7c 88                	jl     ae <main+0x34>
+  }
+  //printf(2, "exiting\n");
+  exit();
+ 126:	e8 34 03 00 00       	call   45f <exit>
+
+0000012b <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 12b:	55                   	push   %ebp
+ 12c:	89 e5                	mov    %esp,%ebp
+ 12e:	57                   	push   %edi
+ 12f:	53                   	push   %ebx
+    if(cc < 1)
+ 130:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 133:	8b 55 10             	mov    0x10(%ebp),%edx
+ 136:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 139:	89 cb                	mov    %ecx,%ebx
+ 13b:	89 df                	mov    %ebx,%edi
+ 13d:	89 d1                	mov    %edx,%ecx
+ 13f:	fc                   	cld
+ 140:	f3 aa                	rep stos %al,%es:(%edi)
+ 142:	89 ca                	mov    %ecx,%edx
+ 144:	89 fb                	mov    %edi,%ebx
+ 146:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 149:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+ 14c:	90                   	nop
+ 14d:	5b                   	pop    %ebx
+ 14e:	5f                   	pop    %edi
+ 14f:	5d                   	pop    %ebp
+ 150:	c3                   	ret
+
+00000151 <strcpy>:
+{
+ 151:	55                   	push   %ebp
+ 152:	89 e5                	mov    %esp,%ebp
+ 154:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 157:	8b 45 08             	mov    0x8(%ebp),%eax
+ 15a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 15d:	90                   	nop
+ 15e:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 161:	8d 42 01             	lea    0x1(%edx),%eax
+ 164:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 167:	8b 45 08             	mov    0x8(%ebp),%eax
+ 16a:	8d 48 01             	lea    0x1(%eax),%ecx
+ 16d:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 170:	0f b6 12             	movzbl (%edx),%edx
+ 173:	88 10                	mov    %dl,(%eax)
+ 175:	0f b6 00             	movzbl (%eax),%eax
+ 178:	84 c0                	test   %al,%al
+ 17a:	75 e2                	jne    15e <strcpy+0xd>
+  return os;
+ 17c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 17f:	c9                   	leave
+ 180:	c3                   	ret
+
+00000181 <strcmp>:
+{
+ 181:	55                   	push   %ebp
+ 182:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 184:	eb 08                	jmp    18e <strcmp+0xd>
+    p++, q++;
+ 186:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 18a:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 18e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 191:	0f b6 00             	movzbl (%eax),%eax
+ 194:	84 c0                	test   %al,%al
+ 196:	74 10                	je     1a8 <strcmp+0x27>
+ 198:	8b 45 08             	mov    0x8(%ebp),%eax
+ 19b:	0f b6 10             	movzbl (%eax),%edx
+ 19e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1a1:	0f b6 00             	movzbl (%eax),%eax
+ 1a4:	38 c2                	cmp    %al,%dl
+ 1a6:	74 de                	je     186 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 1a8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1ab:	0f b6 00             	movzbl (%eax),%eax
+ 1ae:	0f b6 d0             	movzbl %al,%edx
+ 1b1:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1b4:	0f b6 00             	movzbl (%eax),%eax
+ 1b7:	0f b6 c0             	movzbl %al,%eax
+ 1ba:	29 c2                	sub    %eax,%edx
+ 1bc:	89 d0                	mov    %edx,%eax
+}
+ 1be:	5d                   	pop    %ebp
+ 1bf:	c3                   	ret
+
+000001c0 <strlen>:
+{
+ 1c0:	55                   	push   %ebp
+ 1c1:	89 e5                	mov    %esp,%ebp
+ 1c3:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 1c6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 1cd:	eb 04                	jmp    1d3 <strlen+0x13>
+ 1cf:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 1d3:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 1d6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d9:	01 d0                	add    %edx,%eax
+ 1db:	0f b6 00             	movzbl (%eax),%eax
+ 1de:	84 c0                	test   %al,%al
+ 1e0:	75 ed                	jne    1cf <strlen+0xf>
+  return n;
+ 1e2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1e5:	c9                   	leave
+ 1e6:	c3                   	ret
+
+000001e7 <memset>:
+{
+ 1e7:	55                   	push   %ebp
+ 1e8:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 1ea:	8b 45 10             	mov    0x10(%ebp),%eax
+ 1ed:	50                   	push   %eax
+ 1ee:	ff 75 0c             	push   0xc(%ebp)
+ 1f1:	ff 75 08             	push   0x8(%ebp)
+ 1f4:	e8 32 ff ff ff       	call   12b <stosb>
+ 1f9:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 1fc:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1ff:	c9                   	leave
+ 200:	c3                   	ret
+
+00000201 <strchr>:
+{
+ 201:	55                   	push   %ebp
+ 202:	89 e5                	mov    %esp,%ebp
+ 204:	83 ec 04             	sub    $0x4,%esp
+ 207:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 20a:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 20d:	eb 14                	jmp    223 <strchr+0x22>
+    if(*s == c)
+ 20f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 212:	0f b6 00             	movzbl (%eax),%eax
+ 215:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 218:	75 05                	jne    21f <strchr+0x1e>
+      return (char*)s;
+ 21a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 21d:	eb 13                	jmp    232 <strchr+0x31>
+  for(; *s; s++)
+ 21f:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 223:	8b 45 08             	mov    0x8(%ebp),%eax
+ 226:	0f b6 00             	movzbl (%eax),%eax
+ 229:	84 c0                	test   %al,%al
+ 22b:	75 e2                	jne    20f <strchr+0xe>
+  return 0;
+ 22d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 232:	c9                   	leave
+ 233:	c3                   	ret
+
+00000234 <gets>:
+{
+ 234:	55                   	push   %ebp
+ 235:	89 e5                	mov    %esp,%ebp
+ 237:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 23a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 241:	eb 42                	jmp    285 <gets+0x51>
+    cc = read(0, &c, 1);
+ 243:	83 ec 04             	sub    $0x4,%esp
+ 246:	6a 01                	push   $0x1
+ 248:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 24b:	50                   	push   %eax
+ 24c:	6a 00                	push   $0x0
+ 24e:	e8 24 02 00 00       	call   477 <read>
+ 253:	83 c4 10             	add    $0x10,%esp
+ 256:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 259:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 25d:	7e 33                	jle    292 <gets+0x5e>
+    buf[i++] = c;
+ 25f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 262:	8d 50 01             	lea    0x1(%eax),%edx
+ 265:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 268:	89 c2                	mov    %eax,%edx
+ 26a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 26d:	01 c2                	add    %eax,%edx
+ 26f:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 273:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 275:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 279:	3c 0a                	cmp    $0xa,%al
+ 27b:	74 16                	je     293 <gets+0x5f>
+ 27d:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 281:	3c 0d                	cmp    $0xd,%al
+ 283:	74 0e                	je     293 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 285:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 288:	83 c0 01             	add    $0x1,%eax
+ 28b:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 28e:	7f b3                	jg     243 <gets+0xf>
+ 290:	eb 01                	jmp    293 <gets+0x5f>
+      break;
+ 292:	90                   	nop
+  }
+  buf[i] = '\0';
+ 293:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 296:	8b 45 08             	mov    0x8(%ebp),%eax
+ 299:	01 d0                	add    %edx,%eax
+ 29b:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 29e:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2a1:	c9                   	leave
+ 2a2:	c3                   	ret
+
+000002a3 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 2a3:	55                   	push   %ebp
+ 2a4:	89 e5                	mov    %esp,%ebp
+ 2a6:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2a9:	83 ec 08             	sub    $0x8,%esp
+ 2ac:	6a 00                	push   $0x0
+ 2ae:	ff 75 08             	push   0x8(%ebp)
+ 2b1:	e8 e9 01 00 00       	call   49f <open>
+ 2b6:	83 c4 10             	add    $0x10,%esp
+ 2b9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 2bc:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 2c0:	79 07                	jns    2c9 <stat+0x26>
+    return -1;
+ 2c2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 2c7:	eb 25                	jmp    2ee <stat+0x4b>
+  r = fstat(fd, st);
+ 2c9:	83 ec 08             	sub    $0x8,%esp
+ 2cc:	ff 75 0c             	push   0xc(%ebp)
+ 2cf:	ff 75 f4             	push   -0xc(%ebp)
+ 2d2:	e8 e0 01 00 00       	call   4b7 <fstat>
+ 2d7:	83 c4 10             	add    $0x10,%esp
+ 2da:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 2dd:	83 ec 0c             	sub    $0xc,%esp
+ 2e0:	ff 75 f4             	push   -0xc(%ebp)
+ 2e3:	e8 9f 01 00 00       	call   487 <close>
+ 2e8:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 2eb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 2ee:	c9                   	leave
+ 2ef:	c3                   	ret
+
+000002f0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 2f6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 2fd:	eb 25                	jmp    324 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 2ff:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 302:	89 d0                	mov    %edx,%eax
+ 304:	c1 e0 02             	shl    $0x2,%eax
+ 307:	01 d0                	add    %edx,%eax
+ 309:	01 c0                	add    %eax,%eax
+ 30b:	89 c1                	mov    %eax,%ecx
+ 30d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 310:	8d 50 01             	lea    0x1(%eax),%edx
+ 313:	89 55 08             	mov    %edx,0x8(%ebp)
+ 316:	0f b6 00             	movzbl (%eax),%eax
+ 319:	0f be c0             	movsbl %al,%eax
+ 31c:	01 c8                	add    %ecx,%eax
+ 31e:	83 e8 30             	sub    $0x30,%eax
+ 321:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 324:	8b 45 08             	mov    0x8(%ebp),%eax
+ 327:	0f b6 00             	movzbl (%eax),%eax
+ 32a:	3c 2f                	cmp    $0x2f,%al
+ 32c:	7e 0a                	jle    338 <atoi+0x48>
+ 32e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 331:	0f b6 00             	movzbl (%eax),%eax
+ 334:	3c 39                	cmp    $0x39,%al
+ 336:	7e c7                	jle    2ff <atoi+0xf>
+  return n;
+ 338:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 33b:	c9                   	leave
+ 33c:	c3                   	ret
+
+0000033d <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 33d:	55                   	push   %ebp
+ 33e:	89 e5                	mov    %esp,%ebp
+ 340:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+
+  dst = vdst;
+ 343:	8b 45 08             	mov    0x8(%ebp),%eax
+ 346:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 349:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 34c:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 34f:	eb 17                	jmp    368 <memmove+0x2b>
+    *dst++ = *src++;
+ 351:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 354:	8d 42 01             	lea    0x1(%edx),%eax
+ 357:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 35a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 35d:	8d 48 01             	lea    0x1(%eax),%ecx
+ 360:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 363:	0f b6 12             	movzbl (%edx),%edx
+ 366:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 368:	8b 45 10             	mov    0x10(%ebp),%eax
+ 36b:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 36e:	89 55 10             	mov    %edx,0x10(%ebp)
+ 371:	85 c0                	test   %eax,%eax
+ 373:	7f dc                	jg     351 <memmove+0x14>
+  return vdst;
+ 375:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 378:	c9                   	leave
+ 379:	c3                   	ret
+
+0000037a <opendir>:
+    int fd;
+    int child;
+} DIR;
+
+DIR* opendir(const char* name)
+{
+ 37a:	55                   	push   %ebp
+ 37b:	89 e5                	mov    %esp,%ebp
+ 37d:	83 ec 18             	sub    $0x18,%esp
+    DIR* dp = malloc(sizeof(*dp));
+ 380:	83 ec 0c             	sub    $0xc,%esp
+ 383:	6a 08                	push   $0x8
+ 385:	e8 4d 05 00 00       	call   8d7 <malloc>
+ 38a:	83 c4 10             	add    $0x10,%esp
+ 38d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+    dp->fd = open((char*)name, 0);
+ 390:	83 ec 08             	sub    $0x8,%esp
+ 393:	6a 00                	push   $0x0
+ 395:	ff 75 08             	push   0x8(%ebp)
+ 398:	e8 02 01 00 00       	call   49f <open>
+ 39d:	83 c4 10             	add    $0x10,%esp
+ 3a0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 3a3:	89 02                	mov    %eax,(%edx)
+    dp->child = 0;
+ 3a5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 3a8:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+
+    return dp;
+ 3af:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 3b2:	c9                   	leave
+ 3b3:	c3                   	ret
+
+000003b4 <closedir>:
+
+void closedir(DIR* dp)
+{
+ 3b4:	55                   	push   %ebp
+ 3b5:	89 e5                	mov    %esp,%ebp
+ 3b7:	83 ec 08             	sub    $0x8,%esp
+    if(dp == 0) {
+ 3ba:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 3be:	74 21                	je     3e1 <closedir+0x2d>
+        return;
+    }
+
+    close(dp->fd);
+ 3c0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c3:	8b 00                	mov    (%eax),%eax
+ 3c5:	83 ec 0c             	sub    $0xc,%esp
+ 3c8:	50                   	push   %eax
+ 3c9:	e8 b9 00 00 00       	call   487 <close>
+ 3ce:	83 c4 10             	add    $0x10,%esp
+    free(dp);
+ 3d1:	83 ec 0c             	sub    $0xc,%esp
+ 3d4:	ff 75 08             	push   0x8(%ebp)
+ 3d7:	e8 b9 03 00 00       	call   795 <free>
+ 3dc:	83 c4 10             	add    $0x10,%esp
+ 3df:	eb 01                	jmp    3e2 <closedir+0x2e>
+        return;
+ 3e1:	90                   	nop
+}
+ 3e2:	c9                   	leave
+ 3e3:	c3                   	ret
+
+000003e4 <readdir>:
+
+struct dirent* readdir(DIR* dp)
+{
+ 3e4:	55                   	push   %ebp
+ 3e5:	89 e5                	mov    %esp,%ebp
+ 3e7:	83 ec 18             	sub    $0x18,%esp
+    if(dp == 0) {
+ 3ea:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 3ee:	75 07                	jne    3f7 <readdir+0x13>
+      return 0;
+ 3f0:	b8 00 00 00 00       	mov    $0x0,%eax
+ 3f5:	eb 5e                	jmp    455 <readdir+0x71>
+    }
+
+    struct dirent* de = malloc(sizeof(*de));
+ 3f7:	83 ec 0c             	sub    $0xc,%esp
+ 3fa:	68 0c 01 00 00       	push   $0x10c
+ 3ff:	e8 d3 04 00 00       	call   8d7 <malloc>
+ 404:	83 c4 10             	add    $0x10,%esp
+ 407:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    int res = direntry(dp->fd, dp->child, de);
+ 40a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 40d:	8b 50 04             	mov    0x4(%eax),%edx
+ 410:	8b 45 08             	mov    0x8(%ebp),%eax
+ 413:	8b 00                	mov    (%eax),%eax
+ 415:	83 ec 04             	sub    $0x4,%esp
+ 418:	ff 75 f4             	push   -0xc(%ebp)
+ 41b:	52                   	push   %edx
+ 41c:	50                   	push   %eax
+ 41d:	e8 e5 00 00 00       	call   507 <direntry>
+ 422:	83 c4 10             	add    $0x10,%esp
+ 425:	89 45 f0             	mov    %eax,-0x10(%ebp)
+
+    // out of children or other error
+    if(res == -1) {
+ 428:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+ 42c:	75 15                	jne    443 <readdir+0x5f>
+        free(de);
+ 42e:	83 ec 0c             	sub    $0xc,%esp
+ 431:	ff 75 f4             	push   -0xc(%ebp)
+ 434:	e8 5c 03 00 00       	call   795 <free>
+ 439:	83 c4 10             	add    $0x10,%esp
+        return 0;
+ 43c:	b8 00 00 00 00       	mov    $0x0,%eax
+ 441:	eb 12                	jmp    455 <readdir+0x71>
+    }
+
+    dp->child++;
+ 443:	8b 45 08             	mov    0x8(%ebp),%eax
+ 446:	8b 40 04             	mov    0x4(%eax),%eax
+ 449:	8d 50 01             	lea    0x1(%eax),%edx
+ 44c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 44f:	89 50 04             	mov    %edx,0x4(%eax)
+    return de;
+ 452:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 455:	c9                   	leave
+ 456:	c3                   	ret
+
+00000457 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 457:	b8 01 00 00 00       	mov    $0x1,%eax
+ 45c:	cd 40                	int    $0x40
+ 45e:	c3                   	ret
+
+0000045f <exit>:
+SYSCALL(exit)
+ 45f:	b8 02 00 00 00       	mov    $0x2,%eax
+ 464:	cd 40                	int    $0x40
+ 466:	c3                   	ret
+
+00000467 <wait>:
+SYSCALL(wait)
+ 467:	b8 03 00 00 00       	mov    $0x3,%eax
+ 46c:	cd 40                	int    $0x40
+ 46e:	c3                   	ret
+
+0000046f <pipe>:
+SYSCALL(pipe)
+ 46f:	b8 04 00 00 00       	mov    $0x4,%eax
+ 474:	cd 40                	int    $0x40
+ 476:	c3                   	ret
+
+00000477 <read>:
+SYSCALL(read)
+ 477:	b8 05 00 00 00       	mov    $0x5,%eax
+ 47c:	cd 40                	int    $0x40
+ 47e:	c3                   	ret
+
+0000047f <write>:
+SYSCALL(write)
+ 47f:	b8 10 00 00 00       	mov    $0x10,%eax
+ 484:	cd 40                	int    $0x40
+ 486:	c3                   	ret
+
+00000487 <close>:
+SYSCALL(close)
+ 487:	b8 15 00 00 00       	mov    $0x15,%eax
+ 48c:	cd 40                	int    $0x40
+ 48e:	c3                   	ret
+
+0000048f <kill>:
+SYSCALL(kill)
+ 48f:	b8 06 00 00 00       	mov    $0x6,%eax
+ 494:	cd 40                	int    $0x40
+ 496:	c3                   	ret
+
+00000497 <exec>:
+SYSCALL(exec)
+ 497:	b8 07 00 00 00       	mov    $0x7,%eax
+ 49c:	cd 40                	int    $0x40
+ 49e:	c3                   	ret
+
+0000049f <open>:
+SYSCALL(open)
+ 49f:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4a4:	cd 40                	int    $0x40
+ 4a6:	c3                   	ret
+
+000004a7 <mknod>:
+SYSCALL(mknod)
+ 4a7:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4ac:	cd 40                	int    $0x40
+ 4ae:	c3                   	ret
+
+000004af <unlink>:
+SYSCALL(unlink)
+ 4af:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4b4:	cd 40                	int    $0x40
+ 4b6:	c3                   	ret
+
+000004b7 <fstat>:
+SYSCALL(fstat)
+ 4b7:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4bc:	cd 40                	int    $0x40
+ 4be:	c3                   	ret
+
+000004bf <link>:
+SYSCALL(link)
+ 4bf:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4c4:	cd 40                	int    $0x40
+ 4c6:	c3                   	ret
+
+000004c7 <mkdir>:
+SYSCALL(mkdir)
+ 4c7:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4cc:	cd 40                	int    $0x40
+ 4ce:	c3                   	ret
+
+000004cf <chdir>:
+SYSCALL(chdir)
+ 4cf:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4d4:	cd 40                	int    $0x40
+ 4d6:	c3                   	ret
+
+000004d7 <dup>:
+SYSCALL(dup)
+ 4d7:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4dc:	cd 40                	int    $0x40
+ 4de:	c3                   	ret
+
+000004df <getpid>:
+SYSCALL(getpid)
+ 4df:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4e4:	cd 40                	int    $0x40
+ 4e6:	c3                   	ret
+
+000004e7 <sbrk>:
+SYSCALL(sbrk)
+ 4e7:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4ec:	cd 40                	int    $0x40
+ 4ee:	c3                   	ret
+
+000004ef <sleep>:
+SYSCALL(sleep)
+ 4ef:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4f4:	cd 40                	int    $0x40
+ 4f6:	c3                   	ret
+
+000004f7 <uptime>:
+SYSCALL(uptime)
+ 4f7:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4fc:	cd 40                	int    $0x40
+ 4fe:	c3                   	ret
+
+000004ff <mount>:
+SYSCALL(mount)
+ 4ff:	b8 16 00 00 00       	mov    $0x16,%eax
+ 504:	cd 40                	int    $0x40
+ 506:	c3                   	ret
+
+00000507 <direntry>:
+SYSCALL(direntry)
+ 507:	b8 17 00 00 00       	mov    $0x17,%eax
+ 50c:	cd 40                	int    $0x40
+ 50e:	c3                   	ret
+
+0000050f <sync>:
+SYSCALL(sync)
+ 50f:	b8 18 00 00 00       	mov    $0x18,%eax
+ 514:	cd 40                	int    $0x40
+ 516:	c3                   	ret
+
+00000517 <fsync>:
+SYSCALL(fsync)
+ 517:	b8 19 00 00 00       	mov    $0x19,%eax
+ 51c:	cd 40                	int    $0x40
+ 51e:	c3                   	ret
+
+0000051f <mmap>:
+SYSCALL(mmap)
+ 51f:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 524:	cd 40                	int    $0x40
+ 526:	c3                   	ret
+
+00000527 <munmap>:
+SYSCALL(munmap)
+ 527:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 52c:	cd 40                	int    $0x40
+ 52e:	c3                   	ret
+
+0000052f <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 52f:	55                   	push   %ebp
+ 530:	89 e5                	mov    %esp,%ebp
+ 532:	83 ec 18             	sub    $0x18,%esp
+ 535:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 538:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 53b:	83 ec 04             	sub    $0x4,%esp
+ 53e:	6a 01                	push   $0x1
+ 540:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 543:	50                   	push   %eax
+ 544:	ff 75 08             	push   0x8(%ebp)
+ 547:	e8 33 ff ff ff       	call   47f <write>
+ 54c:	83 c4 10             	add    $0x10,%esp
+}
+ 54f:	90                   	nop
+ 550:	c9                   	leave
+ 551:	c3                   	ret
+
+00000552 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 552:	55                   	push   %ebp
+ 553:	89 e5                	mov    %esp,%ebp
+ 555:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 558:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 55f:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 563:	74 17                	je     57c <printint+0x2a>
+ 565:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 569:	79 11                	jns    57c <printint+0x2a>
+    neg = 1;
+ 56b:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 572:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 575:	f7 d8                	neg    %eax
+ 577:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 57a:	eb 06                	jmp    582 <printint+0x30>
+  } else {
+    x = xx;
+ 57c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 57f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 582:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 589:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 58c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 58f:	ba 00 00 00 00       	mov    $0x0,%edx
+ 594:	f7 f1                	div    %ecx
+ 596:	89 d1                	mov    %edx,%ecx
+ 598:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 59b:	8d 50 01             	lea    0x1(%eax),%edx
+ 59e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 5a1:	0f b6 91 00 20 00 00 	movzbl 0x2000(%ecx),%edx
+ 5a8:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 5ac:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 5af:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 5b2:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5b7:	f7 f1                	div    %ecx
+ 5b9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 5bc:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 5c0:	75 c7                	jne    589 <printint+0x37>
+  if(neg)
+ 5c2:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 5c6:	74 2d                	je     5f5 <printint+0xa3>
+    buf[i++] = '-';
+ 5c8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5cb:	8d 50 01             	lea    0x1(%eax),%edx
+ 5ce:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 5d1:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 5d6:	eb 1d                	jmp    5f5 <printint+0xa3>
+    putc(fd, buf[i]);
+ 5d8:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 5db:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5de:	01 d0                	add    %edx,%eax
+ 5e0:	0f b6 00             	movzbl (%eax),%eax
+ 5e3:	0f be c0             	movsbl %al,%eax
+ 5e6:	83 ec 08             	sub    $0x8,%esp
+ 5e9:	50                   	push   %eax
+ 5ea:	ff 75 08             	push   0x8(%ebp)
+ 5ed:	e8 3d ff ff ff       	call   52f <putc>
+ 5f2:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 5f5:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 5f9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 5fd:	79 d9                	jns    5d8 <printint+0x86>
+}
+ 5ff:	90                   	nop
+ 600:	90                   	nop
+ 601:	c9                   	leave
+ 602:	c3                   	ret
+
+00000603 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 603:	55                   	push   %ebp
+ 604:	89 e5                	mov    %esp,%ebp
+ 606:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 609:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 610:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 613:	83 c0 04             	add    $0x4,%eax
+ 616:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 619:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 620:	e9 59 01 00 00       	jmp    77e <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 625:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 628:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 62b:	01 d0                	add    %edx,%eax
+ 62d:	0f b6 00             	movzbl (%eax),%eax
+ 630:	0f be c0             	movsbl %al,%eax
+ 633:	25 ff 00 00 00       	and    $0xff,%eax
+ 638:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 63b:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 63f:	75 2c                	jne    66d <printf+0x6a>
+      if(c == '%'){
+ 641:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 645:	75 0c                	jne    653 <printf+0x50>
+        state = '%';
+ 647:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 64e:	e9 27 01 00 00       	jmp    77a <printf+0x177>
+      } else {
+        putc(fd, c);
+ 653:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 656:	0f be c0             	movsbl %al,%eax
+ 659:	83 ec 08             	sub    $0x8,%esp
+ 65c:	50                   	push   %eax
+ 65d:	ff 75 08             	push   0x8(%ebp)
+ 660:	e8 ca fe ff ff       	call   52f <putc>
+ 665:	83 c4 10             	add    $0x10,%esp
+ 668:	e9 0d 01 00 00       	jmp    77a <printf+0x177>
+      }
+    } else if(state == '%'){
+ 66d:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 671:	0f 85 03 01 00 00    	jne    77a <printf+0x177>
+      if(c == 'd'){
+ 677:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 67b:	75 1e                	jne    69b <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 67d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 680:	8b 00                	mov    (%eax),%eax
+ 682:	6a 01                	push   $0x1
+ 684:	6a 0a                	push   $0xa
+ 686:	50                   	push   %eax
+ 687:	ff 75 08             	push   0x8(%ebp)
+ 68a:	e8 c3 fe ff ff       	call   552 <printint>
+ 68f:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 692:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 696:	e9 d8 00 00 00       	jmp    773 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 69b:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 69f:	74 06                	je     6a7 <printf+0xa4>
+ 6a1:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 6a5:	75 1e                	jne    6c5 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 6a7:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6aa:	8b 00                	mov    (%eax),%eax
+ 6ac:	6a 00                	push   $0x0
+ 6ae:	6a 10                	push   $0x10
+ 6b0:	50                   	push   %eax
+ 6b1:	ff 75 08             	push   0x8(%ebp)
+ 6b4:	e8 99 fe ff ff       	call   552 <printint>
+ 6b9:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 6bc:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 6c0:	e9 ae 00 00 00       	jmp    773 <printf+0x170>
+      } else if(c == 's'){
+ 6c5:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 6c9:	75 43                	jne    70e <printf+0x10b>
+        s = (char*)*ap;
+ 6cb:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6ce:	8b 00                	mov    (%eax),%eax
+ 6d0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 6d3:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 6d7:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 6db:	75 25                	jne    702 <printf+0xff>
+          s = "(null)";
+ 6dd:	c7 45 f4 38 10 00 00 	movl   $0x1038,-0xc(%ebp)
+        while(*s != 0){
+ 6e4:	eb 1c                	jmp    702 <printf+0xff>
+          putc(fd, *s);
+ 6e6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6e9:	0f b6 00             	movzbl (%eax),%eax
+ 6ec:	0f be c0             	movsbl %al,%eax
+ 6ef:	83 ec 08             	sub    $0x8,%esp
+ 6f2:	50                   	push   %eax
+ 6f3:	ff 75 08             	push   0x8(%ebp)
+ 6f6:	e8 34 fe ff ff       	call   52f <putc>
+ 6fb:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 6fe:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 702:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 705:	0f b6 00             	movzbl (%eax),%eax
+ 708:	84 c0                	test   %al,%al
+ 70a:	75 da                	jne    6e6 <printf+0xe3>
+ 70c:	eb 65                	jmp    773 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 70e:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 712:	75 1d                	jne    731 <printf+0x12e>
+        putc(fd, *ap);
+ 714:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 717:	8b 00                	mov    (%eax),%eax
+ 719:	0f be c0             	movsbl %al,%eax
+ 71c:	83 ec 08             	sub    $0x8,%esp
+ 71f:	50                   	push   %eax
+ 720:	ff 75 08             	push   0x8(%ebp)
+ 723:	e8 07 fe ff ff       	call   52f <putc>
+ 728:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 72b:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 72f:	eb 42                	jmp    773 <printf+0x170>
+      } else if(c == '%'){
+ 731:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 735:	75 17                	jne    74e <printf+0x14b>
+        putc(fd, c);
+ 737:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 73a:	0f be c0             	movsbl %al,%eax
+ 73d:	83 ec 08             	sub    $0x8,%esp
+ 740:	50                   	push   %eax
+ 741:	ff 75 08             	push   0x8(%ebp)
+ 744:	e8 e6 fd ff ff       	call   52f <putc>
+ 749:	83 c4 10             	add    $0x10,%esp
+ 74c:	eb 25                	jmp    773 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 74e:	83 ec 08             	sub    $0x8,%esp
+ 751:	6a 25                	push   $0x25
+ 753:	ff 75 08             	push   0x8(%ebp)
+ 756:	e8 d4 fd ff ff       	call   52f <putc>
+ 75b:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 75e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 761:	0f be c0             	movsbl %al,%eax
+ 764:	83 ec 08             	sub    $0x8,%esp
+ 767:	50                   	push   %eax
+ 768:	ff 75 08             	push   0x8(%ebp)
+ 76b:	e8 bf fd ff ff       	call   52f <putc>
+ 770:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 773:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 77a:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 77e:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 781:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 784:	01 d0                	add    %edx,%eax
+ 786:	0f b6 00             	movzbl (%eax),%eax
+ 789:	84 c0                	test   %al,%al
+ 78b:	0f 85 94 fe ff ff    	jne    625 <printf+0x22>
+    }
+  }
+}
+ 791:	90                   	nop
+ 792:	90                   	nop
+ 793:	c9                   	leave
+ 794:	c3                   	ret
+
+00000795 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 795:	55                   	push   %ebp
+ 796:	89 e5                	mov    %esp,%ebp
+ 798:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 79b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 79e:	83 e8 08             	sub    $0x8,%eax
+ 7a1:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7a4:	a1 28 22 00 00       	mov    0x2228,%eax
+ 7a9:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 7ac:	eb 24                	jmp    7d2 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7ae:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7b1:	8b 00                	mov    (%eax),%eax
+ 7b3:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 7b6:	72 12                	jb     7ca <free+0x35>
+ 7b8:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7bb:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 7be:	72 24                	jb     7e4 <free+0x4f>
+ 7c0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7c3:	8b 00                	mov    (%eax),%eax
+ 7c5:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 7c8:	72 1a                	jb     7e4 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7ca:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7cd:	8b 00                	mov    (%eax),%eax
+ 7cf:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 7d2:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7d5:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 7d8:	73 d4                	jae    7ae <free+0x19>
+ 7da:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7dd:	8b 00                	mov    (%eax),%eax
+ 7df:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 7e2:	73 ca                	jae    7ae <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 7e4:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7e7:	8b 40 04             	mov    0x4(%eax),%eax
+ 7ea:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 7f1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7f4:	01 c2                	add    %eax,%edx
+ 7f6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7f9:	8b 00                	mov    (%eax),%eax
+ 7fb:	39 c2                	cmp    %eax,%edx
+ 7fd:	75 24                	jne    823 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 7ff:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 802:	8b 50 04             	mov    0x4(%eax),%edx
+ 805:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 808:	8b 00                	mov    (%eax),%eax
+ 80a:	8b 40 04             	mov    0x4(%eax),%eax
+ 80d:	01 c2                	add    %eax,%edx
+ 80f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 812:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 815:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 818:	8b 00                	mov    (%eax),%eax
+ 81a:	8b 10                	mov    (%eax),%edx
+ 81c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 81f:	89 10                	mov    %edx,(%eax)
+ 821:	eb 0a                	jmp    82d <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 823:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 826:	8b 10                	mov    (%eax),%edx
+ 828:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 82b:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 82d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 830:	8b 40 04             	mov    0x4(%eax),%eax
+ 833:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 83a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 83d:	01 d0                	add    %edx,%eax
+ 83f:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 842:	75 20                	jne    864 <free+0xcf>
+    p->s.size += bp->s.size;
+ 844:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 847:	8b 50 04             	mov    0x4(%eax),%edx
+ 84a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 84d:	8b 40 04             	mov    0x4(%eax),%eax
+ 850:	01 c2                	add    %eax,%edx
+ 852:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 855:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 858:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 85b:	8b 10                	mov    (%eax),%edx
+ 85d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 860:	89 10                	mov    %edx,(%eax)
+ 862:	eb 08                	jmp    86c <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 864:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 867:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 86a:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 86c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 86f:	a3 28 22 00 00       	mov    %eax,0x2228
+}
+ 874:	90                   	nop
+ 875:	c9                   	leave
+ 876:	c3                   	ret
+
+00000877 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 877:	55                   	push   %ebp
+ 878:	89 e5                	mov    %esp,%ebp
+ 87a:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 87d:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 884:	77 07                	ja     88d <morecore+0x16>
+    nu = 4096;
+ 886:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 88d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 890:	c1 e0 03             	shl    $0x3,%eax
+ 893:	83 ec 0c             	sub    $0xc,%esp
+ 896:	50                   	push   %eax
+ 897:	e8 4b fc ff ff       	call   4e7 <sbrk>
+ 89c:	83 c4 10             	add    $0x10,%esp
+ 89f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 8a2:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 8a6:	75 07                	jne    8af <morecore+0x38>
+    return 0;
+ 8a8:	b8 00 00 00 00       	mov    $0x0,%eax
+ 8ad:	eb 26                	jmp    8d5 <morecore+0x5e>
+  hp = (Header*)p;
+ 8af:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8b2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 8b5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 8bb:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 8be:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8c1:	83 c0 08             	add    $0x8,%eax
+ 8c4:	83 ec 0c             	sub    $0xc,%esp
+ 8c7:	50                   	push   %eax
+ 8c8:	e8 c8 fe ff ff       	call   795 <free>
+ 8cd:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 8d0:	a1 28 22 00 00       	mov    0x2228,%eax
+}
+ 8d5:	c9                   	leave
+ 8d6:	c3                   	ret
+
+000008d7 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 8d7:	55                   	push   %ebp
+ 8d8:	89 e5                	mov    %esp,%ebp
+ 8da:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8dd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8e0:	83 c0 07             	add    $0x7,%eax
+ 8e3:	c1 e8 03             	shr    $0x3,%eax
+ 8e6:	83 c0 01             	add    $0x1,%eax
+ 8e9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 8ec:	a1 28 22 00 00       	mov    0x2228,%eax
+ 8f1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 8f4:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 8f8:	75 23                	jne    91d <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 8fa:	c7 45 f0 20 22 00 00 	movl   $0x2220,-0x10(%ebp)
+ 901:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 904:	a3 28 22 00 00       	mov    %eax,0x2228
+ 909:	a1 28 22 00 00       	mov    0x2228,%eax
+ 90e:	a3 20 22 00 00       	mov    %eax,0x2220
+    base.s.size = 0;
+ 913:	c7 05 24 22 00 00 00 	movl   $0x0,0x2224
+ 91a:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 91d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 920:	8b 00                	mov    (%eax),%eax
+ 922:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 925:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 928:	8b 40 04             	mov    0x4(%eax),%eax
+ 92b:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 92e:	72 4d                	jb     97d <malloc+0xa6>
+      if(p->s.size == nunits)
+ 930:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 933:	8b 40 04             	mov    0x4(%eax),%eax
+ 936:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 939:	75 0c                	jne    947 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 93b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 93e:	8b 10                	mov    (%eax),%edx
+ 940:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 943:	89 10                	mov    %edx,(%eax)
+ 945:	eb 26                	jmp    96d <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 947:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 94a:	8b 40 04             	mov    0x4(%eax),%eax
+ 94d:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 950:	89 c2                	mov    %eax,%edx
+ 952:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 955:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 958:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 95b:	8b 40 04             	mov    0x4(%eax),%eax
+ 95e:	c1 e0 03             	shl    $0x3,%eax
+ 961:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 964:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 967:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 96a:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 96d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 970:	a3 28 22 00 00       	mov    %eax,0x2228
+      return (void*)(p + 1);
+ 975:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 978:	83 c0 08             	add    $0x8,%eax
+ 97b:	eb 3b                	jmp    9b8 <malloc+0xe1>
+    }
+    if(p == freep)
+ 97d:	a1 28 22 00 00       	mov    0x2228,%eax
+ 982:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 985:	75 1e                	jne    9a5 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 987:	83 ec 0c             	sub    $0xc,%esp
+ 98a:	ff 75 ec             	push   -0x14(%ebp)
+ 98d:	e8 e5 fe ff ff       	call   877 <morecore>
+ 992:	83 c4 10             	add    $0x10,%esp
+ 995:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 998:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 99c:	75 07                	jne    9a5 <malloc+0xce>
+        return 0;
+ 99e:	b8 00 00 00 00       	mov    $0x0,%eax
+ 9a3:	eb 13                	jmp    9b8 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9a5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9a8:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 9ab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9ae:	8b 00                	mov    (%eax),%eax
+ 9b0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 9b3:	e9 6d ff ff ff       	jmp    925 <malloc+0x4e>
+  }
+}
+ 9b8:	c9                   	leave
+ 9b9:	c3                   	ret
@@ -14,6 +14,7 @@
 #include "proc.h"
 #include "x86.h"
 #include "vfs.h"
+#include "bcache.h"
 
 static void consputc(int);
 
@@ -191,7 +192,7 @@ struct {
 void
 consoleintr(int (*getc)(void))
 {
-  int c, doprocdump = 0;
+  int c, doprocdump = 0, dobcachedump = 0, dokallocdump = 0;
 
   acquire(&cons.lock);
   while((c = getc()) >= 0){
@@ -200,6 +201,12 @@ consoleintr(int (*getc)(void))
       // procdump() locks cons.lock indirectly; invoke later
       doprocdump = 1;
       break;
+    case C('B'):  // Block cache statistics.
+      dobcachedump = 1;
+      break;
+    case C('K'):  // Page allocator statistics.
+      dokallocdump = 1;
+      break;
     case C('U'):  // Kill line.
       while(input.e != input.w &&
             input.buf[(input.e-1) % INPUT_BUF] != '\n'){
@@ -230,6 +237,12 @@ consoleintr(int (*getc)(void))
   if(doprocdump) {
     procdump();  // now call procdump() wo. cons.lock held
   }
+  if(dobcachedump) {
+    bcachedump();
+  }
+  if(dokallocdump) {
+    kallocdump();
+  }
 }
 
 int
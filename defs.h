@@ -13,12 +13,7 @@ struct spinlock;
 struct sleeplock;
 struct stat;
 struct superblock;
-
-// bio.c
-void            binit(void);
-struct buf*     bread(uint, uint);
-void            brelse(struct buf*);
-void            bwrite(struct buf*);
+struct vma;
 
 // console.c
 void            consoleinit(void);
@@ -75,6 +70,11 @@ char*           kalloc(void);
 void            kfree(char*);
 void            kinit1(void*, void*);
 void            kinit2(void*, void*);
+void            kallocdump(void);
+void            kdup(char*);
+int             krefs(char*);
+int             kreserve(int);
+void            kunreserve(int);
 
 // kbd.c
 void            kbdintr(void);
@@ -122,6 +122,7 @@ void            procdump(void);
 void            scheduler(void) __attribute__((noreturn));
 void            sched(void);
 void            setproc(struct proc*);
+void            setrunnable(struct proc*);
 void            sleep(void*, struct spinlock*);
 void            userinit(void);
 int             wait(void);
@@ -140,6 +141,11 @@ void            release(struct spinlock*);
 void            pushcli(void);
 void            popcli(void);
 
+// slab.c
+void            slabinit(void);
+void*           kmalloc(uint);
+void            kfree_small(void*);
+
 // sleeplock.c
 void            acquiresleep(struct sleeplock*);
 void            releasesleep(struct sleeplock*);
@@ -158,6 +164,7 @@ char*           strncpy(char*, const char*, int);
 // syscall.c
 int             argint(int, int*);
 int             argptr(int, char**, int);
+int             argwptr(int, char**, int);
 int             argstr(int, char**);
 int             fetchint(uint, int*);
 int             fetchstr(uint, char**);
@@ -186,12 +193,20 @@ int             allocuvm(pde_t*, uint, uint);
 int             deallocuvm(pde_t*, uint, uint);
 void            freevm(pde_t*);
 void            inituvm(pde_t*, char*, uint);
-int             loaduvm(pde_t*, char*, struct vfs_inode*, uint, uint);
 pde_t*          copyuvm(pde_t*, uint);
 void            switchuvm(struct proc*);
 void            switchkvm(void);
 int             copyout(pde_t*, uint, void*, uint);
 void            clearpteu(pde_t *pgdir, char *uva);
+struct vma*     vmalookup(struct proc*, uint);
+int             vmamap(struct proc*, struct vfs_inode*, uint, uint, int, int);
+int             vmaunmap(struct proc*, uint, uint);
+int             vmafault(struct proc*, uint, int);
+int             vmacopy(struct proc*, struct proc*);
+void            vmafree(struct proc*);
+int             uvmfault(struct proc*, uint, int);
+int             uvmabsent(pde_t*, uint, uint);
+int             uvmcheck(struct proc*, uint, uint, int);
 
 // number of elements in fixed-size array
 #define NELEM(x) (sizeof(x)/sizeof((x)[0]))
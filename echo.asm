@@ -0,0 +1,1249 @@
+
+_echo:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	83 ec 10             	sub    $0x10,%esp
+  12:	89 cb                	mov    %ecx,%ebx
+  int i;
+
+  for(i = 1; i < argc; i++)
+  14:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  1b:	eb 3c                	jmp    59 <main+0x59>
+    printf(1, "%s%s", argv[i], i+1 < argc ? " " : "\n");
+  1d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  20:	83 c0 01             	add    $0x1,%eax
+  23:	39 03                	cmp    %eax,(%ebx)
+  25:	7e 07                	jle    2e <main+0x2e>
+  27:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  2c:	eb 05                	jmp    33 <main+0x33>
+  2e:	b9 02 10 00 00       	mov    $0x1002,%ecx
+  33:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  36:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  3d:	8b 43 04             	mov    0x4(%ebx),%eax
+  40:	01 d0                	add    %edx,%eax
+  42:	8b 00                	mov    (%eax),%eax
+  44:	51                   	push   %ecx
+  45:	50                   	push   %eax
+  46:	68 04 10 00 00       	push   $0x1004
+  4b:	6a 01                	push   $0x1
+  4d:	e8 eb 04 00 00       	call   53d <printf>
+  52:	83 c4 10             	add    $0x10,%esp
+  for(i = 1; i < argc; i++)
+  55:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  59:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  5c:	3b 03                	cmp    (%ebx),%eax
+  5e:	7c bd                	jl     1d <main+0x1d>
+  exit();
+  60:	e8 34 03 00 00       	call   399 <exit>
+
+00000065 <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+  65:	55                   	push   %ebp
+  66:	89 e5                	mov    %esp,%ebp
+  68:	57                   	push   %edi
+  69:	53                   	push   %ebx
+    if(cc < 1)
+  6a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  6d:	8b 55 10             	mov    0x10(%ebp),%edx
+  70:	8b 45 0c             	mov    0xc(%ebp),%eax
+  73:	89 cb                	mov    %ecx,%ebx
+  75:	89 df                	mov    %ebx,%edi
+  77:	89 d1                	mov    %edx,%ecx
+  79:	fc                   	cld
+  7a:	f3 aa                	rep stos %al,%es:(%edi)
+  7c:	89 ca                	mov    %ecx,%edx
+  7e:	89 fb                	mov    %edi,%ebx
+  80:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  83:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+  86:	90                   	nop
+  87:	5b                   	pop    %ebx
+  88:	5f                   	pop    %edi
+  89:	5d                   	pop    %ebp
+  8a:	c3                   	ret
+
+0000008b <strcpy>:
+{
+  8b:	55                   	push   %ebp
+  8c:	89 e5                	mov    %esp,%ebp
+  8e:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+  91:	8b 45 08             	mov    0x8(%ebp),%eax
+  94:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+  97:	90                   	nop
+  98:	8b 55 0c             	mov    0xc(%ebp),%edx
+  9b:	8d 42 01             	lea    0x1(%edx),%eax
+  9e:	89 45 0c             	mov    %eax,0xc(%ebp)
+  a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  a4:	8d 48 01             	lea    0x1(%eax),%ecx
+  a7:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  aa:	0f b6 12             	movzbl (%edx),%edx
+  ad:	88 10                	mov    %dl,(%eax)
+  af:	0f b6 00             	movzbl (%eax),%eax
+  b2:	84 c0                	test   %al,%al
+  b4:	75 e2                	jne    98 <strcpy+0xd>
+  return os;
+  b6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  b9:	c9                   	leave
+  ba:	c3                   	ret
+
+000000bb <strcmp>:
+{
+  bb:	55                   	push   %ebp
+  bc:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+  be:	eb 08                	jmp    c8 <strcmp+0xd>
+    p++, q++;
+  c0:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  c4:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+  c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  cb:	0f b6 00             	movzbl (%eax),%eax
+  ce:	84 c0                	test   %al,%al
+  d0:	74 10                	je     e2 <strcmp+0x27>
+  d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  d5:	0f b6 10             	movzbl (%eax),%edx
+  d8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  db:	0f b6 00             	movzbl (%eax),%eax
+  de:	38 c2                	cmp    %al,%dl
+  e0:	74 de                	je     c0 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+  e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  e5:	0f b6 00             	movzbl (%eax),%eax
+  e8:	0f b6 d0             	movzbl %al,%edx
+  eb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  ee:	0f b6 00             	movzbl (%eax),%eax
+  f1:	0f b6 c0             	movzbl %al,%eax
+  f4:	29 c2                	sub    %eax,%edx
+  f6:	89 d0                	mov    %edx,%eax
+}
+  f8:	5d                   	pop    %ebp
+  f9:	c3                   	ret
+
+000000fa <strlen>:
+{
+  fa:	55                   	push   %ebp
+  fb:	89 e5                	mov    %esp,%ebp
+  fd:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 100:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 107:	eb 04                	jmp    10d <strlen+0x13>
+ 109:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 10d:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 110:	8b 45 08             	mov    0x8(%ebp),%eax
+ 113:	01 d0                	add    %edx,%eax
+ 115:	0f b6 00             	movzbl (%eax),%eax
+ 118:	84 c0                	test   %al,%al
+ 11a:	75 ed                	jne    109 <strlen+0xf>
+  return n;
+ 11c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 11f:	c9                   	leave
+ 120:	c3                   	ret
+
+00000121 <memset>:
+{
+ 121:	55                   	push   %ebp
+ 122:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 124:	8b 45 10             	mov    0x10(%ebp),%eax
+ 127:	50                   	push   %eax
+ 128:	ff 75 0c             	push   0xc(%ebp)
+ 12b:	ff 75 08             	push   0x8(%ebp)
+ 12e:	e8 32 ff ff ff       	call   65 <stosb>
+ 133:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 136:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 139:	c9                   	leave
+ 13a:	c3                   	ret
+
+0000013b <strchr>:
+{
+ 13b:	55                   	push   %ebp
+ 13c:	89 e5                	mov    %esp,%ebp
+ 13e:	83 ec 04             	sub    $0x4,%esp
+ 141:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 144:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 147:	eb 14                	jmp    15d <strchr+0x22>
+    if(*s == c)
+ 149:	8b 45 08             	mov    0x8(%ebp),%eax
+ 14c:	0f b6 00             	movzbl (%eax),%eax
+ 14f:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 152:	75 05                	jne    159 <strchr+0x1e>
+      return (char*)s;
+ 154:	8b 45 08             	mov    0x8(%ebp),%eax
+ 157:	eb 13                	jmp    16c <strchr+0x31>
+  for(; *s; s++)
+ 159:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 15d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 160:	0f b6 00             	movzbl (%eax),%eax
+ 163:	84 c0                	test   %al,%al
+ 165:	75 e2                	jne    149 <strchr+0xe>
+  return 0;
+ 167:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 16c:	c9                   	leave
+ 16d:	c3                   	ret
+
+0000016e <gets>:
+{
+ 16e:	55                   	push   %ebp
+ 16f:	89 e5                	mov    %esp,%ebp
+ 171:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 174:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 17b:	eb 42                	jmp    1bf <gets+0x51>
+    cc = read(0, &c, 1);
+ 17d:	83 ec 04             	sub    $0x4,%esp
+ 180:	6a 01                	push   $0x1
+ 182:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 185:	50                   	push   %eax
+ 186:	6a 00                	push   $0x0
+ 188:	e8 24 02 00 00       	call   3b1 <read>
+ 18d:	83 c4 10             	add    $0x10,%esp
+ 190:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 193:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 197:	7e 33                	jle    1cc <gets+0x5e>
+    buf[i++] = c;
+ 199:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 19c:	8d 50 01             	lea    0x1(%eax),%edx
+ 19f:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 1a2:	89 c2                	mov    %eax,%edx
+ 1a4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1a7:	01 c2                	add    %eax,%edx
+ 1a9:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1ad:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 1af:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1b3:	3c 0a                	cmp    $0xa,%al
+ 1b5:	74 16                	je     1cd <gets+0x5f>
+ 1b7:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1bb:	3c 0d                	cmp    $0xd,%al
+ 1bd:	74 0e                	je     1cd <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 1bf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1c2:	83 c0 01             	add    $0x1,%eax
+ 1c5:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 1c8:	7f b3                	jg     17d <gets+0xf>
+ 1ca:	eb 01                	jmp    1cd <gets+0x5f>
+      break;
+ 1cc:	90                   	nop
+  }
+  buf[i] = '\0';
+ 1cd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 1d0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d3:	01 d0                	add    %edx,%eax
+ 1d5:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 1d8:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1db:	c9                   	leave
+ 1dc:	c3                   	ret
+
+000001dd <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 1dd:	55                   	push   %ebp
+ 1de:	89 e5                	mov    %esp,%ebp
+ 1e0:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1e3:	83 ec 08             	sub    $0x8,%esp
+ 1e6:	6a 00                	push   $0x0
+ 1e8:	ff 75 08             	push   0x8(%ebp)
+ 1eb:	e8 e9 01 00 00       	call   3d9 <open>
+ 1f0:	83 c4 10             	add    $0x10,%esp
+ 1f3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 1f6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 1fa:	79 07                	jns    203 <stat+0x26>
+    return -1;
+ 1fc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 201:	eb 25                	jmp    228 <stat+0x4b>
+  r = fstat(fd, st);
+ 203:	83 ec 08             	sub    $0x8,%esp
+ 206:	ff 75 0c             	push   0xc(%ebp)
+ 209:	ff 75 f4             	push   -0xc(%ebp)
+ 20c:	e8 e0 01 00 00       	call   3f1 <fstat>
+ 211:	83 c4 10             	add    $0x10,%esp
+ 214:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 217:	83 ec 0c             	sub    $0xc,%esp
+ 21a:	ff 75 f4             	push   -0xc(%ebp)
+ 21d:	e8 9f 01 00 00       	call   3c1 <close>
+ 222:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 225:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 228:	c9                   	leave
+ 229:	c3                   	ret
+
+0000022a <atoi>:
+
+int
+atoi(const char *s)
+{
+ 22a:	55                   	push   %ebp
+ 22b:	89 e5                	mov    %esp,%ebp
+ 22d:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 230:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 237:	eb 25                	jmp    25e <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 239:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 23c:	89 d0                	mov    %edx,%eax
+ 23e:	c1 e0 02             	shl    $0x2,%eax
+ 241:	01 d0                	add    %edx,%eax
+ 243:	01 c0                	add    %eax,%eax
+ 245:	89 c1                	mov    %eax,%ecx
+ 247:	8b 45 08             	mov    0x8(%ebp),%eax
+ 24a:	8d 50 01             	lea    0x1(%eax),%edx
+ 24d:	89 55 08             	mov    %edx,0x8(%ebp)
+ 250:	0f b6 00             	movzbl (%eax),%eax
+ 253:	0f be c0             	movsbl %al,%eax
+ 256:	01 c8                	add    %ecx,%eax
+ 258:	83 e8 30             	sub    $0x30,%eax
+ 25b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 25e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 261:	0f b6 00             	movzbl (%eax),%eax
+ 264:	3c 2f                	cmp    $0x2f,%al
+ 266:	7e 0a                	jle    272 <atoi+0x48>
+ 268:	8b 45 08             	mov    0x8(%ebp),%eax
+ 26b:	0f b6 00             	movzbl (%eax),%eax
+ 26e:	3c 39                	cmp    $0x39,%al
+ 270:	7e c7                	jle    239 <atoi+0xf>
+  return n;
+ 272:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 275:	c9                   	leave
+ 276:	c3                   	ret
+
+00000277 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 277:	55                   	push   %ebp
+ 278:	89 e5                	mov    %esp,%ebp
+ 27a:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+
+  dst = vdst;
+ 27d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 280:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 283:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 286:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 289:	eb 17                	jmp    2a2 <memmove+0x2b>
+    *dst++ = *src++;
+ 28b:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 28e:	8d 42 01             	lea    0x1(%edx),%eax
+ 291:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 294:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 297:	8d 48 01             	lea    0x1(%eax),%ecx
+ 29a:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 29d:	0f b6 12             	movzbl (%edx),%edx
+ 2a0:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 2a2:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2a5:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 2a8:	89 55 10             	mov    %edx,0x10(%ebp)
+ 2ab:	85 c0                	test   %eax,%eax
+ 2ad:	7f dc                	jg     28b <memmove+0x14>
+  return vdst;
+ 2af:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2b2:	c9                   	leave
+ 2b3:	c3                   	ret
+
+000002b4 <opendir>:
+    int fd;
+    int child;
+} DIR;
+
+DIR* opendir(const char* name)
+{
+ 2b4:	55                   	push   %ebp
+ 2b5:	89 e5                	mov    %esp,%ebp
+ 2b7:	83 ec 18             	sub    $0x18,%esp
+    DIR* dp = malloc(sizeof(*dp));
+ 2ba:	83 ec 0c             	sub    $0xc,%esp
+ 2bd:	6a 08                	push   $0x8
+ 2bf:	e8 4d 05 00 00       	call   811 <malloc>
+ 2c4:	83 c4 10             	add    $0x10,%esp
+ 2c7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+    dp->fd = open((char*)name, 0);
+ 2ca:	83 ec 08             	sub    $0x8,%esp
+ 2cd:	6a 00                	push   $0x0
+ 2cf:	ff 75 08             	push   0x8(%ebp)
+ 2d2:	e8 02 01 00 00       	call   3d9 <open>
+ 2d7:	83 c4 10             	add    $0x10,%esp
+ 2da:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 2dd:	89 02                	mov    %eax,(%edx)
+    dp->child = 0;
+ 2df:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2e2:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+
+    return dp;
+ 2e9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 2ec:	c9                   	leave
+ 2ed:	c3                   	ret
+
+000002ee <closedir>:
+
+void closedir(DIR* dp)
+{
+ 2ee:	55                   	push   %ebp
+ 2ef:	89 e5                	mov    %esp,%ebp
+ 2f1:	83 ec 08             	sub    $0x8,%esp
+    if(dp == 0) {
+ 2f4:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 2f8:	74 21                	je     31b <closedir+0x2d>
+        return;
+    }
+
+    close(dp->fd);
+ 2fa:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2fd:	8b 00                	mov    (%eax),%eax
+ 2ff:	83 ec 0c             	sub    $0xc,%esp
+ 302:	50                   	push   %eax
+ 303:	e8 b9 00 00 00       	call   3c1 <close>
+ 308:	83 c4 10             	add    $0x10,%esp
+    free(dp);
+ 30b:	83 ec 0c             	sub    $0xc,%esp
+ 30e:	ff 75 08             	push   0x8(%ebp)
+ 311:	e8 b9 03 00 00       	call   6cf <free>
+ 316:	83 c4 10             	add    $0x10,%esp
+ 319:	eb 01                	jmp    31c <closedir+0x2e>
+        return;
+ 31b:	90                   	nop
+}
+ 31c:	c9                   	leave
+ 31d:	c3                   	ret
+
+0000031e <readdir>:
+
+struct dirent* readdir(DIR* dp)
+{
+ 31e:	55                   	push   %ebp
+ 31f:	89 e5                	mov    %esp,%ebp
+ 321:	83 ec 18             	sub    $0x18,%esp
+    if(dp == 0) {
+ 324:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 328:	75 07                	jne    331 <readdir+0x13>
+      return 0;
+ 32a:	b8 00 00 00 00       	mov    $0x0,%eax
+ 32f:	eb 5e                	jmp    38f <readdir+0x71>
+    }
+
+    struct dirent* de = malloc(sizeof(*de));
+ 331:	83 ec 0c             	sub    $0xc,%esp
+ 334:	68 0c 01 00 00       	push   $0x10c
+ 339:	e8 d3 04 00 00       	call   811 <malloc>
+ 33e:	83 c4 10             	add    $0x10,%esp
+ 341:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    int res = direntry(dp->fd, dp->child, de);
+ 344:	8b 45 08             	mov    0x8(%ebp),%eax
+ 347:	8b 50 04             	mov    0x4(%eax),%edx
+ 34a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 34d:	8b 00                	mov    (%eax),%eax
+ 34f:	83 ec 04             	sub    $0x4,%esp
+ 352:	ff 75 f4             	push   -0xc(%ebp)
+ 355:	52                   	push   %edx
+ 356:	50                   	push   %eax
+ 357:	e8 e5 00 00 00       	call   441 <direntry>
+ 35c:	83 c4 10             	add    $0x10,%esp
+ 35f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+
+    // out of children or other error
+    if(res == -1) {
+ 362:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+ 366:	75 15                	jne    37d <readdir+0x5f>
+        free(de);
+ 368:	83 ec 0c             	sub    $0xc,%esp
+ 36b:	ff 75 f4             	push   -0xc(%ebp)
+ 36e:	e8 5c 03 00 00       	call   6cf <free>
+ 373:	83 c4 10             	add    $0x10,%esp
+        return 0;
+ 376:	b8 00 00 00 00       	mov    $0x0,%eax
+ 37b:	eb 12                	jmp    38f <readdir+0x71>
+    }
+
+    dp->child++;
+ 37d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 380:	8b 40 04             	mov    0x4(%eax),%eax
+ 383:	8d 50 01             	lea    0x1(%eax),%edx
+ 386:	8b 45 08             	mov    0x8(%ebp),%eax
+ 389:	89 50 04             	mov    %edx,0x4(%eax)
+    return de;
+ 38c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 38f:	c9                   	leave
+ 390:	c3                   	ret
+
+00000391 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 391:	b8 01 00 00 00       	mov    $0x1,%eax
+ 396:	cd 40                	int    $0x40
+ 398:	c3                   	ret
+
+00000399 <exit>:
+SYSCALL(exit)
+ 399:	b8 02 00 00 00       	mov    $0x2,%eax
+ 39e:	cd 40                	int    $0x40
+ 3a0:	c3                   	ret
+
+000003a1 <wait>:
+SYSCALL(wait)
+ 3a1:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3a6:	cd 40                	int    $0x40
+ 3a8:	c3                   	ret
+
+000003a9 <pipe>:
+SYSCALL(pipe)
+ 3a9:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3ae:	cd 40                	int    $0x40
+ 3b0:	c3                   	ret
+
+000003b1 <read>:
+SYSCALL(read)
+ 3b1:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3b6:	cd 40                	int    $0x40
+ 3b8:	c3                   	ret
+
+000003b9 <write>:
+SYSCALL(write)
+ 3b9:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3be:	cd 40                	int    $0x40
+ 3c0:	c3                   	ret
+
+000003c1 <close>:
+SYSCALL(close)
+ 3c1:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3c6:	cd 40                	int    $0x40
+ 3c8:	c3                   	ret
+
+000003c9 <kill>:
+SYSCALL(kill)
+ 3c9:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3ce:	cd 40                	int    $0x40
+ 3d0:	c3                   	ret
+
+000003d1 <exec>:
+SYSCALL(exec)
+ 3d1:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3d6:	cd 40                	int    $0x40
+ 3d8:	c3                   	ret
+
+000003d9 <open>:
+SYSCALL(open)
+ 3d9:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3de:	cd 40                	int    $0x40
+ 3e0:	c3                   	ret
+
+000003e1 <mknod>:
+SYSCALL(mknod)
+ 3e1:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3e6:	cd 40                	int    $0x40
+ 3e8:	c3                   	ret
+
+000003e9 <unlink>:
+SYSCALL(unlink)
+ 3e9:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3ee:	cd 40                	int    $0x40
+ 3f0:	c3                   	ret
+
+000003f1 <fstat>:
+SYSCALL(fstat)
+ 3f1:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3f6:	cd 40                	int    $0x40
+ 3f8:	c3                   	ret
+
+000003f9 <link>:
+SYSCALL(link)
+ 3f9:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3fe:	cd 40                	int    $0x40
+ 400:	c3                   	ret
+
+00000401 <mkdir>:
+SYSCALL(mkdir)
+ 401:	b8 14 00 00 00       	mov    $0x14,%eax
+ 406:	cd 40                	int    $0x40
+ 408:	c3                   	ret
+
+00000409 <chdir>:
+SYSCALL(chdir)
+ 409:	b8 09 00 00 00       	mov    $0x9,%eax
+ 40e:	cd 40                	int    $0x40
+ 410:	c3                   	ret
+
+00000411 <dup>:
+SYSCALL(dup)
+ 411:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 416:	cd 40                	int    $0x40
+ 418:	c3                   	ret
+
+00000419 <getpid>:
+SYSCALL(getpid)
+ 419:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 41e:	cd 40                	int    $0x40
+ 420:	c3                   	ret
+
+00000421 <sbrk>:
+SYSCALL(sbrk)
+ 421:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 426:	cd 40                	int    $0x40
+ 428:	c3                   	ret
+
+00000429 <sleep>:
+SYSCALL(sleep)
+ 429:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 42e:	cd 40                	int    $0x40
+ 430:	c3                   	ret
+
+00000431 <uptime>:
+SYSCALL(uptime)
+ 431:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 436:	cd 40                	int    $0x40
+ 438:	c3                   	ret
+
+00000439 <mount>:
+SYSCALL(mount)
+ 439:	b8 16 00 00 00       	mov    $0x16,%eax
+ 43e:	cd 40                	int    $0x40
+ 440:	c3                   	ret
+
+00000441 <direntry>:
+SYSCALL(direntry)
+ 441:	b8 17 00 00 00       	mov    $0x17,%eax
+ 446:	cd 40                	int    $0x40
+ 448:	c3                   	ret
+
+00000449 <sync>:
+SYSCALL(sync)
+ 449:	b8 18 00 00 00       	mov    $0x18,%eax
+ 44e:	cd 40                	int    $0x40
+ 450:	c3                   	ret
+
+00000451 <fsync>:
+SYSCALL(fsync)
+ 451:	b8 19 00 00 00       	mov    $0x19,%eax
+ 456:	cd 40                	int    $0x40
+ 458:	c3                   	ret
+
+00000459 <mmap>:
+SYSCALL(mmap)
+ 459:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 45e:	cd 40                	int    $0x40
+ 460:	c3                   	ret
+
+00000461 <munmap>:
+SYSCALL(munmap)
+ 461:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 466:	cd 40                	int    $0x40
+ 468:	c3                   	ret
+
+00000469 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 469:	55                   	push   %ebp
+ 46a:	89 e5                	mov    %esp,%ebp
+ 46c:	83 ec 18             	sub    $0x18,%esp
+ 46f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 472:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 475:	83 ec 04             	sub    $0x4,%esp
+ 478:	6a 01                	push   $0x1
+ 47a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 47d:	50                   	push   %eax
+ 47e:	ff 75 08             	push   0x8(%ebp)
+ 481:	e8 33 ff ff ff       	call   3b9 <write>
+ 486:	83 c4 10             	add    $0x10,%esp
+}
+ 489:	90                   	nop
+ 48a:	c9                   	leave
+ 48b:	c3                   	ret
+
+0000048c <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 48c:	55                   	push   %ebp
+ 48d:	89 e5                	mov    %esp,%ebp
+ 48f:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 492:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 499:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 49d:	74 17                	je     4b6 <printint+0x2a>
+ 49f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 4a3:	79 11                	jns    4b6 <printint+0x2a>
+    neg = 1;
+ 4a5:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 4ac:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4af:	f7 d8                	neg    %eax
+ 4b1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 4b4:	eb 06                	jmp    4bc <printint+0x30>
+  } else {
+    x = xx;
+ 4b6:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4b9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 4bc:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 4c3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 4c6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 4c9:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4ce:	f7 f1                	div    %ecx
+ 4d0:	89 d1                	mov    %edx,%ecx
+ 4d2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4d5:	8d 50 01             	lea    0x1(%eax),%edx
+ 4d8:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 4db:	0f b6 91 00 20 00 00 	movzbl 0x2000(%ecx),%edx
+ 4e2:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 4e6:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 4e9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 4ec:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4f1:	f7 f1                	div    %ecx
+ 4f3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 4f6:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 4fa:	75 c7                	jne    4c3 <printint+0x37>
+  if(neg)
+ 4fc:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 500:	74 2d                	je     52f <printint+0xa3>
+    buf[i++] = '-';
+ 502:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 505:	8d 50 01             	lea    0x1(%eax),%edx
+ 508:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 50b:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 510:	eb 1d                	jmp    52f <printint+0xa3>
+    putc(fd, buf[i]);
+ 512:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 515:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 518:	01 d0                	add    %edx,%eax
+ 51a:	0f b6 00             	movzbl (%eax),%eax
+ 51d:	0f be c0             	movsbl %al,%eax
+ 520:	83 ec 08             	sub    $0x8,%esp
+ 523:	50                   	push   %eax
+ 524:	ff 75 08             	push   0x8(%ebp)
+ 527:	e8 3d ff ff ff       	call   469 <putc>
+ 52c:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 52f:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 533:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 537:	79 d9                	jns    512 <printint+0x86>
+}
+ 539:	90                   	nop
+ 53a:	90                   	nop
+ 53b:	c9                   	leave
+ 53c:	c3                   	ret
+
+0000053d <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 53d:	55                   	push   %ebp
+ 53e:	89 e5                	mov    %esp,%ebp
+ 540:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 543:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 54a:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 54d:	83 c0 04             	add    $0x4,%eax
+ 550:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 553:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 55a:	e9 59 01 00 00       	jmp    6b8 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 55f:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 562:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 565:	01 d0                	add    %edx,%eax
+ 567:	0f b6 00             	movzbl (%eax),%eax
+ 56a:	0f be c0             	movsbl %al,%eax
+ 56d:	25 ff 00 00 00       	and    $0xff,%eax
+ 572:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 575:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 579:	75 2c                	jne    5a7 <printf+0x6a>
+      if(c == '%'){
+ 57b:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 57f:	75 0c                	jne    58d <printf+0x50>
+        state = '%';
+ 581:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 588:	e9 27 01 00 00       	jmp    6b4 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 58d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 590:	0f be c0             	movsbl %al,%eax
+ 593:	83 ec 08             	sub    $0x8,%esp
+ 596:	50                   	push   %eax
+ 597:	ff 75 08             	push   0x8(%ebp)
+ 59a:	e8 ca fe ff ff       	call   469 <putc>
+ 59f:	83 c4 10             	add    $0x10,%esp
+ 5a2:	e9 0d 01 00 00       	jmp    6b4 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 5a7:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 5ab:	0f 85 03 01 00 00    	jne    6b4 <printf+0x177>
+      if(c == 'd'){
+ 5b1:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 5b5:	75 1e                	jne    5d5 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 5b7:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5ba:	8b 00                	mov    (%eax),%eax
+ 5bc:	6a 01                	push   $0x1
+ 5be:	6a 0a                	push   $0xa
+ 5c0:	50                   	push   %eax
+ 5c1:	ff 75 08             	push   0x8(%ebp)
+ 5c4:	e8 c3 fe ff ff       	call   48c <printint>
+ 5c9:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 5cc:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 5d0:	e9 d8 00 00 00       	jmp    6ad <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 5d5:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 5d9:	74 06                	je     5e1 <printf+0xa4>
+ 5db:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 5df:	75 1e                	jne    5ff <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 5e1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5e4:	8b 00                	mov    (%eax),%eax
+ 5e6:	6a 00                	push   $0x0
+ 5e8:	6a 10                	push   $0x10
+ 5ea:	50                   	push   %eax
+ 5eb:	ff 75 08             	push   0x8(%ebp)
+ 5ee:	e8 99 fe ff ff       	call   48c <printint>
+ 5f3:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 5f6:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 5fa:	e9 ae 00 00 00       	jmp    6ad <printf+0x170>
+      } else if(c == 's'){
+ 5ff:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 603:	75 43                	jne    648 <printf+0x10b>
+        s = (char*)*ap;
+ 605:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 608:	8b 00                	mov    (%eax),%eax
+ 60a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 60d:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 611:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 615:	75 25                	jne    63c <printf+0xff>
+          s = "(null)";
+ 617:	c7 45 f4 09 10 00 00 	movl   $0x1009,-0xc(%ebp)
+        while(*s != 0){
+ 61e:	eb 1c                	jmp    63c <printf+0xff>
+          putc(fd, *s);
+ 620:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 623:	0f b6 00             	movzbl (%eax),%eax
+ 626:	0f be c0             	movsbl %al,%eax
+ 629:	83 ec 08             	sub    $0x8,%esp
+ 62c:	50                   	push   %eax
+ 62d:	ff 75 08             	push   0x8(%ebp)
+ 630:	e8 34 fe ff ff       	call   469 <putc>
+ 635:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 638:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 63c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 63f:	0f b6 00             	movzbl (%eax),%eax
+ 642:	84 c0                	test   %al,%al
+ 644:	75 da                	jne    620 <printf+0xe3>
+ 646:	eb 65                	jmp    6ad <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 648:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 64c:	75 1d                	jne    66b <printf+0x12e>
+        putc(fd, *ap);
+ 64e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 651:	8b 00                	mov    (%eax),%eax
+ 653:	0f be c0             	movsbl %al,%eax
+ 656:	83 ec 08             	sub    $0x8,%esp
+ 659:	50                   	push   %eax
+ 65a:	ff 75 08             	push   0x8(%ebp)
+ 65d:	e8 07 fe ff ff       	call   469 <putc>
+ 662:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 665:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 669:	eb 42                	jmp    6ad <printf+0x170>
+      } else if(c == '%'){
+ 66b:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 66f:	75 17                	jne    688 <printf+0x14b>
+        putc(fd, c);
+ 671:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 674:	0f be c0             	movsbl %al,%eax
+ 677:	83 ec 08             	sub    $0x8,%esp
+ 67a:	50                   	push   %eax
+ 67b:	ff 75 08             	push   0x8(%ebp)
+ 67e:	e8 e6 fd ff ff       	call   469 <putc>
+ 683:	83 c4 10             	add    $0x10,%esp
+ 686:	eb 25                	jmp    6ad <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 688:	83 ec 08             	sub    $0x8,%esp
+ 68b:	6a 25                	push   $0x25
+ 68d:	ff 75 08             	push   0x8(%ebp)
+ 690:	e8 d4 fd ff ff       	call   469 <putc>
+ 695:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 698:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 69b:	0f be c0             	movsbl %al,%eax
+ 69e:	83 ec 08             	sub    $0x8,%esp
+ 6a1:	50                   	push   %eax
+ 6a2:	ff 75 08             	push   0x8(%ebp)
+ 6a5:	e8 bf fd ff ff       	call   469 <putc>
+ 6aa:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 6ad:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 6b4:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 6b8:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 6bb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 6be:	01 d0                	add    %edx,%eax
+ 6c0:	0f b6 00             	movzbl (%eax),%eax
+ 6c3:	84 c0                	test   %al,%al
+ 6c5:	0f 85 94 fe ff ff    	jne    55f <printf+0x22>
+    }
+  }
+}
+ 6cb:	90                   	nop
+ 6cc:	90                   	nop
+ 6cd:	c9                   	leave
+ 6ce:	c3                   	ret
+
+000006cf <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 6cf:	55                   	push   %ebp
+ 6d0:	89 e5                	mov    %esp,%ebp
+ 6d2:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 6d5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6d8:	83 e8 08             	sub    $0x8,%eax
+ 6db:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6de:	a1 1c 20 00 00       	mov    0x201c,%eax
+ 6e3:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 6e6:	eb 24                	jmp    70c <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6e8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6eb:	8b 00                	mov    (%eax),%eax
+ 6ed:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 6f0:	72 12                	jb     704 <free+0x35>
+ 6f2:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6f5:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 6f8:	72 24                	jb     71e <free+0x4f>
+ 6fa:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6fd:	8b 00                	mov    (%eax),%eax
+ 6ff:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 702:	72 1a                	jb     71e <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 704:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 707:	8b 00                	mov    (%eax),%eax
+ 709:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 70c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 70f:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 712:	73 d4                	jae    6e8 <free+0x19>
+ 714:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 717:	8b 00                	mov    (%eax),%eax
+ 719:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 71c:	73 ca                	jae    6e8 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 71e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 721:	8b 40 04             	mov    0x4(%eax),%eax
+ 724:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 72b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 72e:	01 c2                	add    %eax,%edx
+ 730:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 733:	8b 00                	mov    (%eax),%eax
+ 735:	39 c2                	cmp    %eax,%edx
+ 737:	75 24                	jne    75d <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 739:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 73c:	8b 50 04             	mov    0x4(%eax),%edx
+ 73f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 742:	8b 00                	mov    (%eax),%eax
+ 744:	8b 40 04             	mov    0x4(%eax),%eax
+ 747:	01 c2                	add    %eax,%edx
+ 749:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 74c:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 74f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 752:	8b 00                	mov    (%eax),%eax
+ 754:	8b 10                	mov    (%eax),%edx
+ 756:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 759:	89 10                	mov    %edx,(%eax)
+ 75b:	eb 0a                	jmp    767 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 75d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 760:	8b 10                	mov    (%eax),%edx
+ 762:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 765:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 767:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 76a:	8b 40 04             	mov    0x4(%eax),%eax
+ 76d:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 774:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 777:	01 d0                	add    %edx,%eax
+ 779:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 77c:	75 20                	jne    79e <free+0xcf>
+    p->s.size += bp->s.size;
+ 77e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 781:	8b 50 04             	mov    0x4(%eax),%edx
+ 784:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 787:	8b 40 04             	mov    0x4(%eax),%eax
+ 78a:	01 c2                	add    %eax,%edx
+ 78c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 78f:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 792:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 795:	8b 10                	mov    (%eax),%edx
+ 797:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 79a:	89 10                	mov    %edx,(%eax)
+ 79c:	eb 08                	jmp    7a6 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 79e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7a1:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 7a4:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 7a6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7a9:	a3 1c 20 00 00       	mov    %eax,0x201c
+}
+ 7ae:	90                   	nop
+ 7af:	c9                   	leave
+ 7b0:	c3                   	ret
+
+000007b1 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 7b1:	55                   	push   %ebp
+ 7b2:	89 e5                	mov    %esp,%ebp
+ 7b4:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 7b7:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 7be:	77 07                	ja     7c7 <morecore+0x16>
+    nu = 4096;
+ 7c0:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 7c7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7ca:	c1 e0 03             	shl    $0x3,%eax
+ 7cd:	83 ec 0c             	sub    $0xc,%esp
+ 7d0:	50                   	push   %eax
+ 7d1:	e8 4b fc ff ff       	call   421 <sbrk>
+ 7d6:	83 c4 10             	add    $0x10,%esp
+ 7d9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 7dc:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 7e0:	75 07                	jne    7e9 <morecore+0x38>
+    return 0;
+ 7e2:	b8 00 00 00 00       	mov    $0x0,%eax
+ 7e7:	eb 26                	jmp    80f <morecore+0x5e>
+  hp = (Header*)p;
+ 7e9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7ec:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 7ef:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7f2:	8b 55 08             	mov    0x8(%ebp),%edx
+ 7f5:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 7f8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7fb:	83 c0 08             	add    $0x8,%eax
+ 7fe:	83 ec 0c             	sub    $0xc,%esp
+ 801:	50                   	push   %eax
+ 802:	e8 c8 fe ff ff       	call   6cf <free>
+ 807:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 80a:	a1 1c 20 00 00       	mov    0x201c,%eax
+}
+ 80f:	c9                   	leave
+ 810:	c3                   	ret
+
+00000811 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 811:	55                   	push   %ebp
+ 812:	89 e5                	mov    %esp,%ebp
+ 814:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 817:	8b 45 08             	mov    0x8(%ebp),%eax
+ 81a:	83 c0 07             	add    $0x7,%eax
+ 81d:	c1 e8 03             	shr    $0x3,%eax
+ 820:	83 c0 01             	add    $0x1,%eax
+ 823:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 826:	a1 1c 20 00 00       	mov    0x201c,%eax
+ 82b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 82e:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 832:	75 23                	jne    857 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 834:	c7 45 f0 14 20 00 00 	movl   $0x2014,-0x10(%ebp)
+ 83b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 83e:	a3 1c 20 00 00       	mov    %eax,0x201c
+ 843:	a1 1c 20 00 00       	mov    0x201c,%eax
+ 848:	a3 14 20 00 00       	mov    %eax,0x2014
+    base.s.size = 0;
+ 84d:	c7 05 18 20 00 00 00 	movl   $0x0,0x2018
+ 854:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 857:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 85a:	8b 00                	mov    (%eax),%eax
+ 85c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 85f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 862:	8b 40 04             	mov    0x4(%eax),%eax
+ 865:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 868:	72 4d                	jb     8b7 <malloc+0xa6>
+      if(p->s.size == nunits)
+ 86a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 86d:	8b 40 04             	mov    0x4(%eax),%eax
+ 870:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 873:	75 0c                	jne    881 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 875:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 878:	8b 10                	mov    (%eax),%edx
+ 87a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 87d:	89 10                	mov    %edx,(%eax)
+ 87f:	eb 26                	jmp    8a7 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 881:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 884:	8b 40 04             	mov    0x4(%eax),%eax
+ 887:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 88a:	89 c2                	mov    %eax,%edx
+ 88c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 88f:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 892:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 895:	8b 40 04             	mov    0x4(%eax),%eax
+ 898:	c1 e0 03             	shl    $0x3,%eax
+ 89b:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 89e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8a1:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 8a4:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 8a7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8aa:	a3 1c 20 00 00       	mov    %eax,0x201c
+      return (void*)(p + 1);
+ 8af:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8b2:	83 c0 08             	add    $0x8,%eax
+ 8b5:	eb 3b                	jmp    8f2 <malloc+0xe1>
+    }
+    if(p == freep)
+ 8b7:	a1 1c 20 00 00       	mov    0x201c,%eax
+ 8bc:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 8bf:	75 1e                	jne    8df <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 8c1:	83 ec 0c             	sub    $0xc,%esp
+ 8c4:	ff 75 ec             	push   -0x14(%ebp)
+ 8c7:	e8 e5 fe ff ff       	call   7b1 <morecore>
+ 8cc:	83 c4 10             	add    $0x10,%esp
+ 8cf:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 8d2:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 8d6:	75 07                	jne    8df <malloc+0xce>
+        return 0;
+ 8d8:	b8 00 00 00 00       	mov    $0x0,%eax
+ 8dd:	eb 13                	jmp    8f2 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8df:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8e2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 8e5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8e8:	8b 00                	mov    (%eax),%eax
+ 8ea:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 8ed:	e9 6d ff ff ff       	jmp    85f <malloc+0x4e>
+  }
+}
+ 8f2:	c9                   	leave
+ 8f3:	c3                   	ret
@@ -7,6 +7,7 @@
 #include "x86.h"
 #include "elf.h"
 #include "vfs.h"
+#include "mman.h"
 
 int
 exec(char *path, char **argv)
@@ -14,6 +15,7 @@ exec(char *path, char **argv)
   char *s, *last;
   int i, off;
   uint argc, sz, sp, ustack[3+MAXARG+1];
+  struct vma seg[NVMA], *v;
   struct elfhdr elf;
   struct vfs_inode *ip;
   struct proghdr ph;
@@ -30,6 +32,7 @@ exec(char *path, char **argv)
 
   //ilock(ip);
   pgdir = 0;
+  memset(seg, 0, sizeof(seg));
 
   // Check ELF header
   if(vfs_readi(ip, (char*)&elf, 0, sizeof(elf)) != sizeof(elf))
@@ -40,8 +43,9 @@ exec(char *path, char **argv)
   if((pgdir = setupkvm()) == 0)
     goto bad;
 
-  // Load program into memory.
+  // Map the program; its pages are read in when first touched.
   sz = 0;
+  v = seg;
   for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
     if(vfs_readi(ip, (char*)&ph, off, sizeof(ph)) != sizeof(ph))
       goto bad;
@@ -49,17 +53,28 @@ exec(char *path, char **argv)
       continue;
     if(ph.memsz < ph.filesz)
       goto bad;
-    if(ph.vaddr + ph.memsz < ph.vaddr)
+    if(ph.vaddr + ph.memsz < ph.vaddr || ph.vaddr + ph.memsz >= KERNBASE)
       goto bad;
-    if((sz = allocuvm(pgdir, sz, ph.vaddr + ph.memsz)) == 0)
+    if(ph.vaddr % PGSIZE != 0 || ph.vaddr < sz)
       goto bad;
-    if(ph.vaddr % PGSIZE != 0)
-      goto bad;
-    if(loaduvm(pgdir, (char*)ph.vaddr, ip, ph.off, ph.filesz) < 0)
+    if(ph.memsz == 0)
+      continue;
+    if(v == seg + NVMA)
       goto bad;
+    v->start = ph.vaddr;
+    v->end = PGROUNDUP(ph.vaddr + ph.memsz);
+    v->off = ph.off;
+    v->filesz = ph.filesz;
+    // read-only segments (text) are mapped straight from the page
+    // cache, so every process running the program shares them
+    v->prot = PROT_READ;
+    if(ph.flags & ELF_PROG_FLAG_WRITE)
+      v->prot |= PROT_WRITE;
+    v->flags = MAP_PRIVATE;
+    v->ip = vfs_idup(ip);
+    sz = v++->end;
   }
-  //iunlockput(ip);
-  //end_op();
+  vfs_iput(ip);
   ip = 0;
 
   // Allocate two pages at the next page boundary.
@@ -69,6 +84,8 @@ exec(char *path, char **argv)
     goto bad;
   clearpteu(pgdir, (char*)(sz - 2*PGSIZE));
   sp = sz;
+  if(sz > MMAPBASE)
+    goto bad;
 
   // Push argument strings, prepare rest of stack in ustack.
   for(argc = 0; argv[argc]; argc++) {
@@ -96,6 +113,10 @@ exec(char *path, char **argv)
   safestrcpy(curproc->name, last, sizeof(curproc->name));
 
   // Commit to the user image.
+  vmafree(curproc);
+  memmove(curproc->vma, seg, sizeof(seg));
+  kunreserve(curproc->nlazy);
+  curproc->nlazy = 0;
   oldpgdir = curproc->pgdir;
   curproc->pgdir = pgdir;
   curproc->sz = sz;
@@ -106,11 +127,12 @@ exec(char *path, char **argv)
   return 0;
 
  bad:
+  for(v = seg; v < seg + NVMA; v++)
+    if(v->ip)
+      vfs_iput(v->ip);
   if(pgdir)
     freevm(pgdir);
-  /*if(ip){
-    iunlockput(ip);
-    end_op();
-  }*/
+  if(ip)
+    vfs_iput(ip);
   return -1;
 }
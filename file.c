@@ -71,9 +71,7 @@ fileclose(struct file *f)
   if(ff.type == FD_PIPE)
     pipeclose(ff.pipe, ff.writable);
   else if(ff.type == FD_INODE){
-    /*begin_op();
-    iput(ff.ip);
-    end_op();*/
+    vfs_iput(ff.ip);
   }
 }
 
@@ -88,6 +86,39 @@ filestat(struct file *f, struct stat *st)
   return -1;
 }
 
+// Read-ahead window limits, in bytes
+#define RA_MIN (4 * VFS_BLOCK_SIZE)
+#define RA_MAX (64 * VFS_BLOCK_SIZE)
+
+// Called after a read of n bytes at off. A read that continues where the
+// last one stopped doubles the window (up to RA_MAX), any other read
+// closes it. Once less than half a window is left in flight ahead of the
+// reader, the next stretch is read ahead in the background.
+static void
+readahead(struct file *f, uint off, int n)
+{
+  if(off == f->ra_next){
+    f->ra_win = f->ra_win == 0 ? RA_MIN : f->ra_win * 2;
+    if(f->ra_win > RA_MAX)
+      f->ra_win = RA_MAX;
+  } else {
+    f->ra_win = 0;
+    f->ra_end = 0;
+  }
+
+  f->ra_next = off + n;
+  if(f->ra_win == 0)
+    return;
+
+  if(f->ra_end < f->ra_next)
+    f->ra_end = f->ra_next;
+
+  if(f->ra_end - f->ra_next < f->ra_win / 2){
+    vfs_readahead(f->ip, f->ra_end, f->ra_next + f->ra_win - f->ra_end);
+    f->ra_end = f->ra_next + f->ra_win;
+  }
+}
+
 // Read from file f.
 int
 fileread(struct file *f, char *addr, int n)
@@ -99,8 +130,10 @@ fileread(struct file *f, char *addr, int n)
   if(f->type == FD_PIPE)
     return piperead(f->pipe, addr, n);
   if(f->type == FD_INODE) {
-    if((r = vfs_readi(f->ip, addr, f->off, n)) > 0)
+    if((r = vfs_readi(f->ip, addr, f->off, n)) > 0){
+      readahead(f, f->off, r);
       f->off += r;
+    }
 
     return r;
   }
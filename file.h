@@ -9,6 +9,11 @@ struct file {
   struct pipe *pipe;
   struct vfs_inode *ip;
   uint off;
+
+  // read-ahead state (see fileread)
+  uint ra_next;  // offset a sequential read would continue at
+  uint ra_end;   // end of what has been read ahead
+  uint ra_win;   // read-ahead window in bytes, 0 if the reads look random
 };
 
 #define CONSOLE 1
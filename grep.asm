@@ -0,0 +1,1582 @@
+
+_grep:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <grep>:
+char buf[1024];
+int match(char*, char*);
+
+void
+grep(char *pattern, int fd)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 18             	sub    $0x18,%esp
+  int n, m;
+  char *p, *q;
+
+  m = 0;
+   6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+   d:	e9 ae 00 00 00       	jmp    c0 <grep+0xc0>
+    m += n;
+  12:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  15:	01 45 f4             	add    %eax,-0xc(%ebp)
+    buf[m] = '\0';
+  18:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  1b:	05 20 20 00 00       	add    $0x2020,%eax
+  20:	c6 00 00             	movb   $0x0,(%eax)
+    p = buf;
+  23:	c7 45 f0 20 20 00 00 	movl   $0x2020,-0x10(%ebp)
+    while((q = strchr(p, '\n')) != 0){
+  2a:	eb 44                	jmp    70 <grep+0x70>
+      *q = 0;
+  2c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  2f:	c6 00 00             	movb   $0x0,(%eax)
+      if(match(pattern, p)){
+  32:	83 ec 08             	sub    $0x8,%esp
+  35:	ff 75 f0             	push   -0x10(%ebp)
+  38:	ff 75 08             	push   0x8(%ebp)
+  3b:	e8 8f 01 00 00       	call   1cf <match>
+  40:	83 c4 10             	add    $0x10,%esp
+  43:	85 c0                	test   %eax,%eax
+  45:	74 20                	je     67 <grep+0x67>
+        *q = '\n';
+  47:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  4a:	c6 00 0a             	movb   $0xa,(%eax)
+        write(1, p, q+1 - p);
+  4d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  50:	83 c0 01             	add    $0x1,%eax
+  53:	2b 45 f0             	sub    -0x10(%ebp),%eax
+  56:	83 ec 04             	sub    $0x4,%esp
+  59:	50                   	push   %eax
+  5a:	ff 75 f0             	push   -0x10(%ebp)
+  5d:	6a 01                	push   $0x1
+  5f:	e8 1b 06 00 00       	call   67f <write>
+  64:	83 c4 10             	add    $0x10,%esp
+      }
+      p = q+1;
+  67:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  6a:	83 c0 01             	add    $0x1,%eax
+  6d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    while((q = strchr(p, '\n')) != 0){
+  70:	83 ec 08             	sub    $0x8,%esp
+  73:	6a 0a                	push   $0xa
+  75:	ff 75 f0             	push   -0x10(%ebp)
+  78:	e8 84 03 00 00       	call   401 <strchr>
+  7d:	83 c4 10             	add    $0x10,%esp
+  80:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  83:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+  87:	75 a3                	jne    2c <grep+0x2c>
+    }
+    if(p == buf)
+  89:	81 7d f0 20 20 00 00 	cmpl   $0x2020,-0x10(%ebp)
+  90:	75 07                	jne    99 <grep+0x99>
+      m = 0;
+  92:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    if(m > 0){
+  99:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  9d:	7e 21                	jle    c0 <grep+0xc0>
+      m -= p - buf;
+  9f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  a2:	2d 20 20 00 00       	sub    $0x2020,%eax
+  a7:	29 45 f4             	sub    %eax,-0xc(%ebp)
+      memmove(buf, p, m);
+  aa:	83 ec 04             	sub    $0x4,%esp
+  ad:	ff 75 f4             	push   -0xc(%ebp)
+  b0:	ff 75 f0             	push   -0x10(%ebp)
+  b3:	68 20 20 00 00       	push   $0x2020
+  b8:	e8 80 04 00 00       	call   53d <memmove>
+  bd:	83 c4 10             	add    $0x10,%esp
+  while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+  c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  c3:	ba ff 03 00 00       	mov    $0x3ff,%edx
+  c8:	29 c2                	sub    %eax,%edx
+  ca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  cd:	05 20 20 00 00       	add    $0x2020,%eax
+  d2:	83 ec 04             	sub    $0x4,%esp
+  d5:	52                   	push   %edx
+  d6:	50                   	push   %eax
+  d7:	ff 75 0c             	push   0xc(%ebp)
+  da:	e8 98 05 00 00       	call   677 <read>
+  df:	83 c4 10             	add    $0x10,%esp
+  e2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  e5:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+  e9:	0f 8f 23 ff ff ff    	jg     12 <grep+0x12>
+    }
+  }
+}
+  ef:	90                   	nop
+  f0:	90                   	nop
+  f1:	c9                   	leave
+  f2:	c3                   	ret
+
+000000f3 <main>:
+
+int
+main(int argc, char *argv[])
+{
+  f3:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  f7:	83 e4 f0             	and    $0xfffffff0,%esp
+  fa:	ff 71 fc             	push   -0x4(%ecx)
+  fd:	55                   	push   %ebp
+  fe:	89 e5                	mov    %esp,%ebp
+ 100:	53                   	push   %ebx
+ 101:	51                   	push   %ecx
+ 102:	83 ec 10             	sub    $0x10,%esp
+ 105:	89 cb                	mov    %ecx,%ebx
+  int fd, i;
+  char *pattern;
+
+  if(argc <= 1){
+ 107:	83 3b 01             	cmpl   $0x1,(%ebx)
+ 10a:	7f 17                	jg     123 <main+0x30>
+    printf(2, "usage: grep pattern [file ...]\n");
+ 10c:	83 ec 08             	sub    $0x8,%esp
+ 10f:	68 00 10 00 00       	push   $0x1000
+ 114:	6a 02                	push   $0x2
+ 116:	e8 e8 06 00 00       	call   803 <printf>
+ 11b:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 11e:	e8 3c 05 00 00       	call   65f <exit>
+  }
+  pattern = argv[1];
+ 123:	8b 43 04             	mov    0x4(%ebx),%eax
+ 126:	8b 40 04             	mov    0x4(%eax),%eax
+ 129:	89 45 f0             	mov    %eax,-0x10(%ebp)
+
+  if(argc <= 2){
+ 12c:	83 3b 02             	cmpl   $0x2,(%ebx)
+ 12f:	7f 15                	jg     146 <main+0x53>
+    grep(pattern, 0);
+ 131:	83 ec 08             	sub    $0x8,%esp
+ 134:	6a 00                	push   $0x0
+ 136:	ff 75 f0             	push   -0x10(%ebp)
+ 139:	e8 c2 fe ff ff       	call   0 <grep>
+ 13e:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 141:	e8 19 05 00 00       	call   65f <exit>
+  }
+
+  for(i = 2; i < argc; i++){
+ 146:	c7 45 f4 02 00 00 00 	movl   $0x2,-0xc(%ebp)
+ 14d:	eb 74                	jmp    1c3 <main+0xd0>
+    if((fd = open(argv[i], 0)) < 0){
+ 14f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 152:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 159:	8b 43 04             	mov    0x4(%ebx),%eax
+ 15c:	01 d0                	add    %edx,%eax
+ 15e:	8b 00                	mov    (%eax),%eax
+ 160:	83 ec 08             	sub    $0x8,%esp
+ 163:	6a 00                	push   $0x0
+ 165:	50                   	push   %eax
+ 166:	e8 34 05 00 00       	call   69f <open>
+ 16b:	83 c4 10             	add    $0x10,%esp
+ 16e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 171:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 175:	79 29                	jns    1a0 <main+0xad>
+      printf(1, "grep: cannot open %s\n", argv[i]);
+ 177:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 17a:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 181:	8b 43 04             	mov    0x4(%ebx),%eax
+ 184:	01 d0                	add    %edx,%eax
+ 186:	8b 00                	mov    (%eax),%eax
+ 188:	83 ec 04             	sub    $0x4,%esp
+ 18b:	50                   	push   %eax
+ 18c:	68 20 10 00 00       	push   $0x1020
+ 191:	6a 01                	push   $0x1
+ 193:	e8 6b 06 00 00       	call   803 <printf>
+ 198:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 19b:	e8 bf 04 00 00       	call   65f <exit>
+    }
+    grep(pattern, fd);
+ 1a0:	83 ec 08             	sub    $0x8,%esp
+ 1a3:	ff 75 ec             	push   -0x14(%ebp)
+ 1a6:	ff 75 f0             	push   -0x10(%ebp)
+ 1a9:	e8 52 fe ff ff       	call   0 <grep>
+ 1ae:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+ 1b1:	83 ec 0c             	sub    $0xc,%esp
+ 1b4:	ff 75 ec             	push   -0x14(%ebp)
+ 1b7:	e8 cb 04 00 00       	call   687 <close>
+ 1bc:	83 c4 10             	add    $0x10,%esp
+  for(i = 2; i < argc; i++){
+ 1bf:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 1c3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1c6:	3b 03                	cmp    (%ebx),%eax
+ 1c8:	7c 85                	jl     14f <main+0x5c>
+  }
+  exit();
+ 1ca:	e8 90 04 00 00       	call   65f <exit>
+
+000001cf <match>:
+int matchhere(char*, char*);
+int matchstar(int, char*, char*);
+
+int
+match(char *re, char *text)
+{
+ 1cf:	55                   	push   %ebp
+ 1d0:	89 e5                	mov    %esp,%ebp
+ 1d2:	83 ec 08             	sub    $0x8,%esp
+  if(re[0] == '^')
+ 1d5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d8:	0f b6 00             	movzbl (%eax),%eax
+ 1db:	3c 5e                	cmp    $0x5e,%al
+ 1dd:	75 17                	jne    1f6 <match+0x27>
+    return matchhere(re+1, text);
+ 1df:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e2:	83 c0 01             	add    $0x1,%eax
+ 1e5:	83 ec 08             	sub    $0x8,%esp
+ 1e8:	ff 75 0c             	push   0xc(%ebp)
+ 1eb:	50                   	push   %eax
+ 1ec:	e8 38 00 00 00       	call   229 <matchhere>
+ 1f1:	83 c4 10             	add    $0x10,%esp
+ 1f4:	eb 31                	jmp    227 <match+0x58>
+  do{  // must look at empty string
+    if(matchhere(re, text))
+ 1f6:	83 ec 08             	sub    $0x8,%esp
+ 1f9:	ff 75 0c             	push   0xc(%ebp)
+ 1fc:	ff 75 08             	push   0x8(%ebp)
+ 1ff:	e8 25 00 00 00       	call   229 <matchhere>
+ 204:	83 c4 10             	add    $0x10,%esp
+ 207:	85 c0                	test   %eax,%eax
+ 209:	74 07                	je     212 <match+0x43>
+      return 1;
+ 20b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 210:	eb 15                	jmp    227 <match+0x58>
+  }while(*text++ != '\0');
+ 212:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 215:	8d 50 01             	lea    0x1(%eax),%edx
+ 218:	89 55 0c             	mov    %edx,0xc(%ebp)
+ 21b:	0f b6 00             	movzbl (%eax),%eax
+ 21e:	84 c0                	test   %al,%al
+ 220:	75 d4                	jne    1f6 <match+0x27>
+  return 0;
+ 222:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 227:	c9                   	leave
+ 228:	c3                   	ret
+
+00000229 <matchhere>:
+
+// matchhere: search for re at beginning of text
+int matchhere(char *re, char *text)
+{
+ 229:	55                   	push   %ebp
+ 22a:	89 e5                	mov    %esp,%ebp
+ 22c:	83 ec 08             	sub    $0x8,%esp
+  if(re[0] == '\0')
+ 22f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 232:	0f b6 00             	movzbl (%eax),%eax
+ 235:	84 c0                	test   %al,%al
+ 237:	75 0a                	jne    243 <matchhere+0x1a>
+    return 1;
+ 239:	b8 01 00 00 00       	mov    $0x1,%eax
+ 23e:	e9 99 00 00 00       	jmp    2dc <matchhere+0xb3>
+  if(re[1] == '*')
+ 243:	8b 45 08             	mov    0x8(%ebp),%eax
+ 246:	83 c0 01             	add    $0x1,%eax
+ 249:	0f b6 00             	movzbl (%eax),%eax
+ 24c:	3c 2a                	cmp    $0x2a,%al
+ 24e:	75 21                	jne    271 <matchhere+0x48>
+    return matchstar(re[0], re+2, text);
+ 250:	8b 45 08             	mov    0x8(%ebp),%eax
+ 253:	8d 50 02             	lea    0x2(%eax),%edx
+ 256:	8b 45 08             	mov    0x8(%ebp),%eax
+ 259:	0f b6 00             	movzbl (%eax),%eax
+ 25c:	0f be c0             	movsbl %al,%eax
+ 25f:	83 ec 04             	sub    $0x4,%esp
+ 262:	ff 75 0c             	push   0xc(%ebp)
+ 265:	52                   	push   %edx
+ 266:	50                   	push   %eax
+ 267:	e8 72 00 00 00       	call   2de <matchstar>
+ 26c:	83 c4 10             	add    $0x10,%esp
+ 26f:	eb 6b                	jmp    2dc <matchhere+0xb3>
+  if(re[0] == '$' && re[1] == '\0')
+ 271:	8b 45 08             	mov    0x8(%ebp),%eax
+ 274:	0f b6 00             	movzbl (%eax),%eax
+ 277:	3c 24                	cmp    $0x24,%al
+ 279:	75 1d                	jne    298 <matchhere+0x6f>
+ 27b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 27e:	83 c0 01             	add    $0x1,%eax
+ 281:	0f b6 00             	movzbl (%eax),%eax
+ 284:	84 c0                	test   %al,%al
+ 286:	75 10                	jne    298 <matchhere+0x6f>
+    return *text == '\0';
+ 288:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 28b:	0f b6 00             	movzbl (%eax),%eax
+ 28e:	84 c0                	test   %al,%al
+ 290:	0f 94 c0             	sete   %al
+ 293:	0f b6 c0             	movzbl %al,%eax
+ 296:	eb 44                	jmp    2dc <matchhere+0xb3>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+ 298:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 29b:	0f b6 00             	movzbl (%eax),%eax
+ 29e:	84 c0                	test   %al,%al
+ 2a0:	74 35                	je     2d7 <matchhere+0xae>
+ 2a2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2a5:	0f b6 00             	movzbl (%eax),%eax
+ 2a8:	3c 2e                	cmp    $0x2e,%al
+ 2aa:	74 10                	je     2bc <matchhere+0x93>
+ 2ac:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2af:	0f b6 10             	movzbl (%eax),%edx
+ 2b2:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2b5:	0f b6 00             	movzbl (%eax),%eax
+ 2b8:	38 c2                	cmp    %al,%dl
+ 2ba:	75 1b                	jne    2d7 <matchhere+0xae>
+    return matchhere(re+1, text+1);
+ 2bc:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2bf:	8d 50 01             	lea    0x1(%eax),%edx
+ 2c2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c5:	83 c0 01             	add    $0x1,%eax
+ 2c8:	83 ec 08             	sub    $0x8,%esp
+ 2cb:	52                   	push   %edx
+ 2cc:	50                   	push   %eax
+ 2cd:	e8 57 ff ff ff       	call   229 <matchhere>
+ 2d2:	83 c4 10             	add    $0x10,%esp
+ 2d5:	eb 05                	jmp    2dc <matchhere+0xb3>
+  return 0;
+ 2d7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 2dc:	c9                   	leave
+ 2dd:	c3                   	ret
+
+000002de <matchstar>:
+
+// matchstar: search for c*re at beginning of text
+int matchstar(int c, char *re, char *text)
+{
+ 2de:	55                   	push   %ebp
+ 2df:	89 e5                	mov    %esp,%ebp
+ 2e1:	83 ec 08             	sub    $0x8,%esp
+  do{  // a * matches zero or more instances
+    if(matchhere(re, text))
+ 2e4:	83 ec 08             	sub    $0x8,%esp
+ 2e7:	ff 75 10             	push   0x10(%ebp)
+ 2ea:	ff 75 0c             	push   0xc(%ebp)
+ 2ed:	e8 37 ff ff ff       	call   229 <matchhere>
+ 2f2:	83 c4 10             	add    $0x10,%esp
+ 2f5:	85 c0                	test   %eax,%eax
+ 2f7:	74 07                	je     300 <matchstar+0x22>
+      return 1;
+ 2f9:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2fe:	eb 29                	jmp    329 <matchstar+0x4b>
+  }while(*text!='\0' && (*text++==c || c=='.'));
+ 300:	8b 45 10             	mov    0x10(%ebp),%eax
+ 303:	0f b6 00             	movzbl (%eax),%eax
+ 306:	84 c0                	test   %al,%al
+ 308:	74 1a                	je     324 <matchstar+0x46>
+ 30a:	8b 45 10             	mov    0x10(%ebp),%eax
+ 30d:	8d 50 01             	lea    0x1(%eax),%edx
+ 310:	89 55 10             	mov    %edx,0x10(%ebp)
+ 313:	0f b6 00             	movzbl (%eax),%eax
+ 316:	0f be c0             	movsbl %al,%eax
+ 319:	39 45 08             	cmp    %eax,0x8(%ebp)
+ 31c:	74 c6                	je     2e4 <matchstar+0x6>
+ 31e:	83 7d 08 2e          	cmpl   $0x2e,0x8(%ebp)
+ 322:	74 c0                	je     2e4 <matchstar+0x6>
+  return 0;
+ 324:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 329:	c9                   	leave
+ 32a:	c3                   	ret
+
+0000032b <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 32b:	55                   	push   %ebp
+ 32c:	89 e5                	mov    %esp,%ebp
+ 32e:	57                   	push   %edi
+ 32f:	53                   	push   %ebx
+    if(cc < 1)
+ 330:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 333:	8b 55 10             	mov    0x10(%ebp),%edx
+ 336:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 339:	89 cb                	mov    %ecx,%ebx
+ 33b:	89 df                	mov    %ebx,%edi
+ 33d:	89 d1                	mov    %edx,%ecx
+ 33f:	fc                   	cld
+ 340:	f3 aa                	rep stos %al,%es:(%edi)
+ 342:	89 ca                	mov    %ecx,%edx
+ 344:	89 fb                	mov    %edi,%ebx
+ 346:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 349:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+ 34c:	90                   	nop
+ 34d:	5b                   	pop    %ebx
+ 34e:	5f                   	pop    %edi
+ 34f:	5d                   	pop    %ebp
+ 350:	c3                   	ret
+
+00000351 <strcpy>:
+{
+ 351:	55                   	push   %ebp
+ 352:	89 e5                	mov    %esp,%ebp
+ 354:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 357:	8b 45 08             	mov    0x8(%ebp),%eax
+ 35a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 35d:	90                   	nop
+ 35e:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 361:	8d 42 01             	lea    0x1(%edx),%eax
+ 364:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 367:	8b 45 08             	mov    0x8(%ebp),%eax
+ 36a:	8d 48 01             	lea    0x1(%eax),%ecx
+ 36d:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 370:	0f b6 12             	movzbl (%edx),%edx
+ 373:	88 10                	mov    %dl,(%eax)
+ 375:	0f b6 00             	movzbl (%eax),%eax
+ 378:	84 c0                	test   %al,%al
+ 37a:	75 e2                	jne    35e <strcpy+0xd>
+  return os;
+ 37c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 37f:	c9                   	leave
+ 380:	c3                   	ret
+
+00000381 <strcmp>:
+{
+ 381:	55                   	push   %ebp
+ 382:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 384:	eb 08                	jmp    38e <strcmp+0xd>
+    p++, q++;
+ 386:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 38a:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 38e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 391:	0f b6 00             	movzbl (%eax),%eax
+ 394:	84 c0                	test   %al,%al
+ 396:	74 10                	je     3a8 <strcmp+0x27>
+ 398:	8b 45 08             	mov    0x8(%ebp),%eax
+ 39b:	0f b6 10             	movzbl (%eax),%edx
+ 39e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3a1:	0f b6 00             	movzbl (%eax),%eax
+ 3a4:	38 c2                	cmp    %al,%dl
+ 3a6:	74 de                	je     386 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 3a8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3ab:	0f b6 00             	movzbl (%eax),%eax
+ 3ae:	0f b6 d0             	movzbl %al,%edx
+ 3b1:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3b4:	0f b6 00             	movzbl (%eax),%eax
+ 3b7:	0f b6 c0             	movzbl %al,%eax
+ 3ba:	29 c2                	sub    %eax,%edx
+ 3bc:	89 d0                	mov    %edx,%eax
+}
+ 3be:	5d                   	pop    %ebp
+ 3bf:	c3                   	ret
+
+000003c0 <strlen>:
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 3c6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 3cd:	eb 04                	jmp    3d3 <strlen+0x13>
+ 3cf:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 3d3:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 3d6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3d9:	01 d0                	add    %edx,%eax
+ 3db:	0f b6 00             	movzbl (%eax),%eax
+ 3de:	84 c0                	test   %al,%al
+ 3e0:	75 ed                	jne    3cf <strlen+0xf>
+  return n;
+ 3e2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 3e5:	c9                   	leave
+ 3e6:	c3                   	ret
+
+000003e7 <memset>:
+{
+ 3e7:	55                   	push   %ebp
+ 3e8:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 3ea:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3ed:	50                   	push   %eax
+ 3ee:	ff 75 0c             	push   0xc(%ebp)
+ 3f1:	ff 75 08             	push   0x8(%ebp)
+ 3f4:	e8 32 ff ff ff       	call   32b <stosb>
+ 3f9:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 3fc:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 3ff:	c9                   	leave
+ 400:	c3                   	ret
+
+00000401 <strchr>:
+{
+ 401:	55                   	push   %ebp
+ 402:	89 e5                	mov    %esp,%ebp
+ 404:	83 ec 04             	sub    $0x4,%esp
+ 407:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 40a:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 40d:	eb 14                	jmp    423 <strchr+0x22>
+    if(*s == c)
+ 40f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 412:	0f b6 00             	movzbl (%eax),%eax
+ 415:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 418:	75 05                	jne    41f <strchr+0x1e>
+      return (char*)s;
+ 41a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 41d:	eb 13                	jmp    432 <strchr+0x31>
+  for(; *s; s++)
+ 41f:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 423:	8b 45 08             	mov    0x8(%ebp),%eax
+ 426:	0f b6 00             	movzbl (%eax),%eax
+ 429:	84 c0                	test   %al,%al
+ 42b:	75 e2                	jne    40f <strchr+0xe>
+  return 0;
+ 42d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 432:	c9                   	leave
+ 433:	c3                   	ret
+
+00000434 <gets>:
+{
+ 434:	55                   	push   %ebp
+ 435:	89 e5                	mov    %esp,%ebp
+ 437:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 43a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 441:	eb 42                	jmp    485 <gets+0x51>
+    cc = read(0, &c, 1);
+ 443:	83 ec 04             	sub    $0x4,%esp
+ 446:	6a 01                	push   $0x1
+ 448:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 44b:	50                   	push   %eax
+ 44c:	6a 00                	push   $0x0
+ 44e:	e8 24 02 00 00       	call   677 <read>
+ 453:	83 c4 10             	add    $0x10,%esp
+ 456:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 459:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 45d:	7e 33                	jle    492 <gets+0x5e>
+    buf[i++] = c;
+ 45f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 462:	8d 50 01             	lea    0x1(%eax),%edx
+ 465:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 468:	89 c2                	mov    %eax,%edx
+ 46a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 46d:	01 c2                	add    %eax,%edx
+ 46f:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 473:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 475:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 479:	3c 0a                	cmp    $0xa,%al
+ 47b:	74 16                	je     493 <gets+0x5f>
+ 47d:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 481:	3c 0d                	cmp    $0xd,%al
+ 483:	74 0e                	je     493 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 485:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 488:	83 c0 01             	add    $0x1,%eax
+ 48b:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 48e:	7f b3                	jg     443 <gets+0xf>
+ 490:	eb 01                	jmp    493 <gets+0x5f>
+      break;
+ 492:	90                   	nop
+  }
+  buf[i] = '\0';
+ 493:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 496:	8b 45 08             	mov    0x8(%ebp),%eax
+ 499:	01 d0                	add    %edx,%eax
+ 49b:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 49e:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 4a1:	c9                   	leave
+ 4a2:	c3                   	ret
+
+000004a3 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 4a3:	55                   	push   %ebp
+ 4a4:	89 e5                	mov    %esp,%ebp
+ 4a6:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 4a9:	83 ec 08             	sub    $0x8,%esp
+ 4ac:	6a 00                	push   $0x0
+ 4ae:	ff 75 08             	push   0x8(%ebp)
+ 4b1:	e8 e9 01 00 00       	call   69f <open>
+ 4b6:	83 c4 10             	add    $0x10,%esp
+ 4b9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 4bc:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 4c0:	79 07                	jns    4c9 <stat+0x26>
+    return -1;
+ 4c2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 4c7:	eb 25                	jmp    4ee <stat+0x4b>
+  r = fstat(fd, st);
+ 4c9:	83 ec 08             	sub    $0x8,%esp
+ 4cc:	ff 75 0c             	push   0xc(%ebp)
+ 4cf:	ff 75 f4             	push   -0xc(%ebp)
+ 4d2:	e8 e0 01 00 00       	call   6b7 <fstat>
+ 4d7:	83 c4 10             	add    $0x10,%esp
+ 4da:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 4dd:	83 ec 0c             	sub    $0xc,%esp
+ 4e0:	ff 75 f4             	push   -0xc(%ebp)
+ 4e3:	e8 9f 01 00 00       	call   687 <close>
+ 4e8:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 4eb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 4ee:	c9                   	leave
+ 4ef:	c3                   	ret
+
+000004f0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 4f0:	55                   	push   %ebp
+ 4f1:	89 e5                	mov    %esp,%ebp
+ 4f3:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 4f6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 4fd:	eb 25                	jmp    524 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 4ff:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 502:	89 d0                	mov    %edx,%eax
+ 504:	c1 e0 02             	shl    $0x2,%eax
+ 507:	01 d0                	add    %edx,%eax
+ 509:	01 c0                	add    %eax,%eax
+ 50b:	89 c1                	mov    %eax,%ecx
+ 50d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 510:	8d 50 01             	lea    0x1(%eax),%edx
+ 513:	89 55 08             	mov    %edx,0x8(%ebp)
+ 516:	0f b6 00             	movzbl (%eax),%eax
+ 519:	0f be c0             	movsbl %al,%eax
+ 51c:	01 c8                	add    %ecx,%eax
+ 51e:	83 e8 30             	sub    $0x30,%eax
+ 521:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 524:	8b 45 08             	mov    0x8(%ebp),%eax
+ 527:	0f b6 00             	movzbl (%eax),%eax
+ 52a:	3c 2f                	cmp    $0x2f,%al
+ 52c:	7e 0a                	jle    538 <atoi+0x48>
+ 52e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 531:	0f b6 00             	movzbl (%eax),%eax
+ 534:	3c 39                	cmp    $0x39,%al
+ 536:	7e c7                	jle    4ff <atoi+0xf>
+  return n;
+ 538:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 53b:	c9                   	leave
+ 53c:	c3                   	ret
+
+0000053d <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 53d:	55                   	push   %ebp
+ 53e:	89 e5                	mov    %esp,%ebp
+ 540:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+
+  dst = vdst;
+ 543:	8b 45 08             	mov    0x8(%ebp),%eax
+ 546:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 549:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 54c:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 54f:	eb 17                	jmp    568 <memmove+0x2b>
+    *dst++ = *src++;
+ 551:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 554:	8d 42 01             	lea    0x1(%edx),%eax
+ 557:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 55a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 55d:	8d 48 01             	lea    0x1(%eax),%ecx
+ 560:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 563:	0f b6 12             	movzbl (%edx),%edx
+ 566:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 568:	8b 45 10             	mov    0x10(%ebp),%eax
+ 56b:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 56e:	89 55 10             	mov    %edx,0x10(%ebp)
+ 571:	85 c0                	test   %eax,%eax
+ 573:	7f dc                	jg     551 <memmove+0x14>
+  return vdst;
+ 575:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 578:	c9                   	leave
+ 579:	c3                   	ret
+
+0000057a <opendir>:
+    int fd;
+    int child;
+} DIR;
+
+DIR* opendir(const char* name)
+{
+ 57a:	55                   	push   %ebp
+ 57b:	89 e5                	mov    %esp,%ebp
+ 57d:	83 ec 18             	sub    $0x18,%esp
+    DIR* dp = malloc(sizeof(*dp));
+ 580:	83 ec 0c             	sub    $0xc,%esp
+ 583:	6a 08                	push   $0x8
+ 585:	e8 4d 05 00 00       	call   ad7 <malloc>
+ 58a:	83 c4 10             	add    $0x10,%esp
+ 58d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+    dp->fd = open((char*)name, 0);
+ 590:	83 ec 08             	sub    $0x8,%esp
+ 593:	6a 00                	push   $0x0
+ 595:	ff 75 08             	push   0x8(%ebp)
+ 598:	e8 02 01 00 00       	call   69f <open>
+ 59d:	83 c4 10             	add    $0x10,%esp
+ 5a0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 5a3:	89 02                	mov    %eax,(%edx)
+    dp->child = 0;
+ 5a5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5a8:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+
+    return dp;
+ 5af:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 5b2:	c9                   	leave
+ 5b3:	c3                   	ret
+
+000005b4 <closedir>:
+
+void closedir(DIR* dp)
+{
+ 5b4:	55                   	push   %ebp
+ 5b5:	89 e5                	mov    %esp,%ebp
+ 5b7:	83 ec 08             	sub    $0x8,%esp
+    if(dp == 0) {
+ 5ba:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 5be:	74 21                	je     5e1 <closedir+0x2d>
+        return;
+    }
+
+    close(dp->fd);
+ 5c0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5c3:	8b 00                	mov    (%eax),%eax
+ 5c5:	83 ec 0c             	sub    $0xc,%esp
+ 5c8:	50                   	push   %eax
+ 5c9:	e8 b9 00 00 00       	call   687 <close>
+ 5ce:	83 c4 10             	add    $0x10,%esp
+    free(dp);
+ 5d1:	83 ec 0c             	sub    $0xc,%esp
+ 5d4:	ff 75 08             	push   0x8(%ebp)
+ 5d7:	e8 b9 03 00 00       	call   995 <free>
+ 5dc:	83 c4 10             	add    $0x10,%esp
+ 5df:	eb 01                	jmp    5e2 <closedir+0x2e>
+        return;
+ 5e1:	90                   	nop
+}
+ 5e2:	c9                   	leave
+ 5e3:	c3                   	ret
+
+000005e4 <readdir>:
+
+struct dirent* readdir(DIR* dp)
+{
+ 5e4:	55                   	push   %ebp
+ 5e5:	89 e5                	mov    %esp,%ebp
+ 5e7:	83 ec 18             	sub    $0x18,%esp
+    if(dp == 0) {
+ 5ea:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 5ee:	75 07                	jne    5f7 <readdir+0x13>
+      return 0;
+ 5f0:	b8 00 00 00 00       	mov    $0x0,%eax
+ 5f5:	eb 5e                	jmp    655 <readdir+0x71>
+    }
+
+    struct dirent* de = malloc(sizeof(*de));
+ 5f7:	83 ec 0c             	sub    $0xc,%esp
+ 5fa:	68 0c 01 00 00       	push   $0x10c
+ 5ff:	e8 d3 04 00 00       	call   ad7 <malloc>
+ 604:	83 c4 10             	add    $0x10,%esp
+ 607:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    int res = direntry(dp->fd, dp->child, de);
+ 60a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 60d:	8b 50 04             	mov    0x4(%eax),%edx
+ 610:	8b 45 08             	mov    0x8(%ebp),%eax
+ 613:	8b 00                	mov    (%eax),%eax
+ 615:	83 ec 04             	sub    $0x4,%esp
+ 618:	ff 75 f4             	push   -0xc(%ebp)
+ 61b:	52                   	push   %edx
+ 61c:	50                   	push   %eax
+ 61d:	e8 e5 00 00 00       	call   707 <direntry>
+ 622:	83 c4 10             	add    $0x10,%esp
+ 625:	89 45 f0             	mov    %eax,-0x10(%ebp)
+
+    // out of children or other error
+    if(res == -1) {
+ 628:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+ 62c:	75 15                	jne    643 <readdir+0x5f>
+        free(de);
+ 62e:	83 ec 0c             	sub    $0xc,%esp
+ 631:	ff 75 f4             	push   -0xc(%ebp)
+ 634:	e8 5c 03 00 00       	call   995 <free>
+ 639:	83 c4 10             	add    $0x10,%esp
+        return 0;
+ 63c:	b8 00 00 00 00       	mov    $0x0,%eax
+ 641:	eb 12                	jmp    655 <readdir+0x71>
+    }
+
+    dp->child++;
+ 643:	8b 45 08             	mov    0x8(%ebp),%eax
+ 646:	8b 40 04             	mov    0x4(%eax),%eax
+ 649:	8d 50 01             	lea    0x1(%eax),%edx
+ 64c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 64f:	89 50 04             	mov    %edx,0x4(%eax)
+    return de;
+ 652:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 655:	c9                   	leave
+ 656:	c3                   	ret
+
+00000657 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 657:	b8 01 00 00 00       	mov    $0x1,%eax
+ 65c:	cd 40                	int    $0x40
+ 65e:	c3                   	ret
+
+0000065f <exit>:
+SYSCALL(exit)
+ 65f:	b8 02 00 00 00       	mov    $0x2,%eax
+ 664:	cd 40                	int    $0x40
+ 666:	c3                   	ret
+
+00000667 <wait>:
+SYSCALL(wait)
+ 667:	b8 03 00 00 00       	mov    $0x3,%eax
+ 66c:	cd 40                	int    $0x40
+ 66e:	c3                   	ret
+
+0000066f <pipe>:
+SYSCALL(pipe)
+ 66f:	b8 04 00 00 00       	mov    $0x4,%eax
+ 674:	cd 40                	int    $0x40
+ 676:	c3                   	ret
+
+00000677 <read>:
+SYSCALL(read)
+ 677:	b8 05 00 00 00       	mov    $0x5,%eax
+ 67c:	cd 40                	int    $0x40
+ 67e:	c3                   	ret
+
+0000067f <write>:
+SYSCALL(write)
+ 67f:	b8 10 00 00 00       	mov    $0x10,%eax
+ 684:	cd 40                	int    $0x40
+ 686:	c3                   	ret
+
+00000687 <close>:
+SYSCALL(close)
+ 687:	b8 15 00 00 00       	mov    $0x15,%eax
+ 68c:	cd 40                	int    $0x40
+ 68e:	c3                   	ret
+
+0000068f <kill>:
+SYSCALL(kill)
+ 68f:	b8 06 00 00 00       	mov    $0x6,%eax
+ 694:	cd 40                	int    $0x40
+ 696:	c3                   	ret
+
+00000697 <exec>:
+SYSCALL(exec)
+ 697:	b8 07 00 00 00       	mov    $0x7,%eax
+ 69c:	cd 40                	int    $0x40
+ 69e:	c3                   	ret
+
+0000069f <open>:
+SYSCALL(open)
+ 69f:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 6a4:	cd 40                	int    $0x40
+ 6a6:	c3                   	ret
+
+000006a7 <mknod>:
+SYSCALL(mknod)
+ 6a7:	b8 11 00 00 00       	mov    $0x11,%eax
+ 6ac:	cd 40                	int    $0x40
+ 6ae:	c3                   	ret
+
+000006af <unlink>:
+SYSCALL(unlink)
+ 6af:	b8 12 00 00 00       	mov    $0x12,%eax
+ 6b4:	cd 40                	int    $0x40
+ 6b6:	c3                   	ret
+
+000006b7 <fstat>:
+SYSCALL(fstat)
+ 6b7:	b8 08 00 00 00       	mov    $0x8,%eax
+ 6bc:	cd 40                	int    $0x40
+ 6be:	c3                   	ret
+
+000006bf <link>:
+SYSCALL(link)
+ 6bf:	b8 13 00 00 00       	mov    $0x13,%eax
+ 6c4:	cd 40                	int    $0x40
+ 6c6:	c3                   	ret
+
+000006c7 <mkdir>:
+SYSCALL(mkdir)
+ 6c7:	b8 14 00 00 00       	mov    $0x14,%eax
+ 6cc:	cd 40                	int    $0x40
+ 6ce:	c3                   	ret
+
+000006cf <chdir>:
+SYSCALL(chdir)
+ 6cf:	b8 09 00 00 00       	mov    $0x9,%eax
+ 6d4:	cd 40                	int    $0x40
+ 6d6:	c3                   	ret
+
+000006d7 <dup>:
+SYSCALL(dup)
+ 6d7:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 6dc:	cd 40                	int    $0x40
+ 6de:	c3                   	ret
+
+000006df <getpid>:
+SYSCALL(getpid)
+ 6df:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 6e4:	cd 40                	int    $0x40
+ 6e6:	c3                   	ret
+
+000006e7 <sbrk>:
+SYSCALL(sbrk)
+ 6e7:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 6ec:	cd 40                	int    $0x40
+ 6ee:	c3                   	ret
+
+000006ef <sleep>:
+SYSCALL(sleep)
+ 6ef:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 6f4:	cd 40                	int    $0x40
+ 6f6:	c3                   	ret
+
+000006f7 <uptime>:
+SYSCALL(uptime)
+ 6f7:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 6fc:	cd 40                	int    $0x40
+ 6fe:	c3                   	ret
+
+000006ff <mount>:
+SYSCALL(mount)
+ 6ff:	b8 16 00 00 00       	mov    $0x16,%eax
+ 704:	cd 40                	int    $0x40
+ 706:	c3                   	ret
+
+00000707 <direntry>:
+SYSCALL(direntry)
+ 707:	b8 17 00 00 00       	mov    $0x17,%eax
+ 70c:	cd 40                	int    $0x40
+ 70e:	c3                   	ret
+
+0000070f <sync>:
+SYSCALL(sync)
+ 70f:	b8 18 00 00 00       	mov    $0x18,%eax
+ 714:	cd 40                	int    $0x40
+ 716:	c3                   	ret
+
+00000717 <fsync>:
+SYSCALL(fsync)
+ 717:	b8 19 00 00 00       	mov    $0x19,%eax
+ 71c:	cd 40                	int    $0x40
+ 71e:	c3                   	ret
+
+0000071f <mmap>:
+SYSCALL(mmap)
+ 71f:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 724:	cd 40                	int    $0x40
+ 726:	c3                   	ret
+
+00000727 <munmap>:
+SYSCALL(munmap)
+ 727:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 72c:	cd 40                	int    $0x40
+ 72e:	c3                   	ret
+
+0000072f <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 72f:	55                   	push   %ebp
+ 730:	89 e5                	mov    %esp,%ebp
+ 732:	83 ec 18             	sub    $0x18,%esp
+ 735:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 738:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 73b:	83 ec 04             	sub    $0x4,%esp
+ 73e:	6a 01                	push   $0x1
+ 740:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 743:	50                   	push   %eax
+ 744:	ff 75 08             	push   0x8(%ebp)
+ 747:	e8 33 ff ff ff       	call   67f <write>
+ 74c:	83 c4 10             	add    $0x10,%esp
+}
+ 74f:	90                   	nop
+ 750:	c9                   	leave
+ 751:	c3                   	ret
+
+00000752 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 752:	55                   	push   %ebp
+ 753:	89 e5                	mov    %esp,%ebp
+ 755:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 758:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 75f:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 763:	74 17                	je     77c <printint+0x2a>
+ 765:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 769:	79 11                	jns    77c <printint+0x2a>
+    neg = 1;
+ 76b:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 772:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 775:	f7 d8                	neg    %eax
+ 777:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 77a:	eb 06                	jmp    782 <printint+0x30>
+  } else {
+    x = xx;
+ 77c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 77f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 782:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 789:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 78c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 78f:	ba 00 00 00 00       	mov    $0x0,%edx
+ 794:	f7 f1                	div    %ecx
+ 796:	89 d1                	mov    %edx,%ecx
+ 798:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 79b:	8d 50 01             	lea    0x1(%eax),%edx
+ 79e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 7a1:	0f b6 91 00 20 00 00 	movzbl 0x2000(%ecx),%edx
+ 7a8:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 7ac:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 7af:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 7b2:	ba 00 00 00 00       	mov    $0x0,%edx
+ 7b7:	f7 f1                	div    %ecx
+ 7b9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 7bc:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 7c0:	75 c7                	jne    789 <printint+0x37>
+  if(neg)
+ 7c2:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 7c6:	74 2d                	je     7f5 <printint+0xa3>
+    buf[i++] = '-';
+ 7c8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7cb:	8d 50 01             	lea    0x1(%eax),%edx
+ 7ce:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 7d1:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 7d6:	eb 1d                	jmp    7f5 <printint+0xa3>
+    putc(fd, buf[i]);
+ 7d8:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 7db:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7de:	01 d0                	add    %edx,%eax
+ 7e0:	0f b6 00             	movzbl (%eax),%eax
+ 7e3:	0f be c0             	movsbl %al,%eax
+ 7e6:	83 ec 08             	sub    $0x8,%esp
+ 7e9:	50                   	push   %eax
+ 7ea:	ff 75 08             	push   0x8(%ebp)
+ 7ed:	e8 3d ff ff ff       	call   72f <putc>
+ 7f2:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 7f5:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 7f9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 7fd:	79 d9                	jns    7d8 <printint+0x86>
+}
+ 7ff:	90                   	nop
+ 800:	90                   	nop
+ 801:	c9                   	leave
+ 802:	c3                   	ret
+
+00000803 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 803:	55                   	push   %ebp
+ 804:	89 e5                	mov    %esp,%ebp
+ 806:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 809:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 810:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 813:	83 c0 04             	add    $0x4,%eax
+ 816:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 819:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 820:	e9 59 01 00 00       	jmp    97e <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 825:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 828:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 82b:	01 d0                	add    %edx,%eax
+ 82d:	0f b6 00             	movzbl (%eax),%eax
+ 830:	0f be c0             	movsbl %al,%eax
+ 833:	25 ff 00 00 00       	and    $0xff,%eax
+ 838:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 83b:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 83f:	75 2c                	jne    86d <printf+0x6a>
+      if(c == '%'){
+ 841:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 845:	75 0c                	jne    853 <printf+0x50>
+        state = '%';
+ 847:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 84e:	e9 27 01 00 00       	jmp    97a <printf+0x177>
+      } else {
+        putc(fd, c);
+ 853:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 856:	0f be c0             	movsbl %al,%eax
+ 859:	83 ec 08             	sub    $0x8,%esp
+ 85c:	50                   	push   %eax
+ 85d:	ff 75 08             	push   0x8(%ebp)
+ 860:	e8 ca fe ff ff       	call   72f <putc>
+ 865:	83 c4 10             	add    $0x10,%esp
+ 868:	e9 0d 01 00 00       	jmp    97a <printf+0x177>
+      }
+    } else if(state == '%'){
+ 86d:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 871:	0f 85 03 01 00 00    	jne    97a <printf+0x177>
+      if(c == 'd'){
+ 877:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 87b:	75 1e                	jne    89b <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 87d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 880:	8b 00                	mov    (%eax),%eax
+ 882:	6a 01                	push   $0x1
+ 884:	6a 0a                	push   $0xa
+ 886:	50                   	push   %eax
+ 887:	ff 75 08             	push   0x8(%ebp)
+ 88a:	e8 c3 fe ff ff       	call   752 <printint>
+ 88f:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 892:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 896:	e9 d8 00 00 00       	jmp    973 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 89b:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 89f:	74 06                	je     8a7 <printf+0xa4>
+ 8a1:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 8a5:	75 1e                	jne    8c5 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 8a7:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8aa:	8b 00                	mov    (%eax),%eax
+ 8ac:	6a 00                	push   $0x0
+ 8ae:	6a 10                	push   $0x10
+ 8b0:	50                   	push   %eax
+ 8b1:	ff 75 08             	push   0x8(%ebp)
+ 8b4:	e8 99 fe ff ff       	call   752 <printint>
+ 8b9:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 8bc:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 8c0:	e9 ae 00 00 00       	jmp    973 <printf+0x170>
+      } else if(c == 's'){
+ 8c5:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 8c9:	75 43                	jne    90e <printf+0x10b>
+        s = (char*)*ap;
+ 8cb:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8ce:	8b 00                	mov    (%eax),%eax
+ 8d0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 8d3:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 8d7:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 8db:	75 25                	jne    902 <printf+0xff>
+          s = "(null)";
+ 8dd:	c7 45 f4 36 10 00 00 	movl   $0x1036,-0xc(%ebp)
+        while(*s != 0){
+ 8e4:	eb 1c                	jmp    902 <printf+0xff>
+          putc(fd, *s);
+ 8e6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8e9:	0f b6 00             	movzbl (%eax),%eax
+ 8ec:	0f be c0             	movsbl %al,%eax
+ 8ef:	83 ec 08             	sub    $0x8,%esp
+ 8f2:	50                   	push   %eax
+ 8f3:	ff 75 08             	push   0x8(%ebp)
+ 8f6:	e8 34 fe ff ff       	call   72f <putc>
+ 8fb:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 8fe:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 902:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 905:	0f b6 00             	movzbl (%eax),%eax
+ 908:	84 c0                	test   %al,%al
+ 90a:	75 da                	jne    8e6 <printf+0xe3>
+ 90c:	eb 65                	jmp    973 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 90e:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 912:	75 1d                	jne    931 <printf+0x12e>
+        putc(fd, *ap);
+ 914:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 917:	8b 00                	mov    (%eax),%eax
+ 919:	0f be c0             	movsbl %al,%eax
+ 91c:	83 ec 08             	sub    $0x8,%esp
+ 91f:	50                   	push   %eax
+ 920:	ff 75 08             	push   0x8(%ebp)
+ 923:	e8 07 fe ff ff       	call   72f <putc>
+ 928:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 92b:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 92f:	eb 42                	jmp    973 <printf+0x170>
+      } else if(c == '%'){
+ 931:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 935:	75 17                	jne    94e <printf+0x14b>
+        putc(fd, c);
+ 937:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 93a:	0f be c0             	movsbl %al,%eax
+ 93d:	83 ec 08             	sub    $0x8,%esp
+ 940:	50                   	push   %eax
+ 941:	ff 75 08             	push   0x8(%ebp)
+ 944:	e8 e6 fd ff ff       	call   72f <putc>
+ 949:	83 c4 10             	add    $0x10,%esp
+ 94c:	eb 25                	jmp    973 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 94e:	83 ec 08             	sub    $0x8,%esp
+ 951:	6a 25                	push   $0x25
+ 953:	ff 75 08             	push   0x8(%ebp)
+ 956:	e8 d4 fd ff ff       	call   72f <putc>
+ 95b:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 95e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 961:	0f be c0             	movsbl %al,%eax
+ 964:	83 ec 08             	sub    $0x8,%esp
+ 967:	50                   	push   %eax
+ 968:	ff 75 08             	push   0x8(%ebp)
+ 96b:	e8 bf fd ff ff       	call   72f <putc>
+ 970:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 973:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 97a:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 97e:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 981:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 984:	01 d0                	add    %edx,%eax
+ 986:	0f b6 00             	movzbl (%eax),%eax
+ 989:	84 c0                	test   %al,%al
+ 98b:	0f 85 94 fe ff ff    	jne    825 <printf+0x22>
+    }
+  }
+}
+ 991:	90                   	nop
+ 992:	90                   	nop
+ 993:	c9                   	leave
+ 994:	c3                   	ret
+
+00000995 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 995:	55                   	push   %ebp
+ 996:	89 e5                	mov    %esp,%ebp
+ 998:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 99b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 99e:	83 e8 08             	sub    $0x8,%eax
+ 9a1:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9a4:	a1 28 24 00 00       	mov    0x2428,%eax
+ 9a9:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 9ac:	eb 24                	jmp    9d2 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9ae:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9b1:	8b 00                	mov    (%eax),%eax
+ 9b3:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 9b6:	72 12                	jb     9ca <free+0x35>
+ 9b8:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9bb:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 9be:	72 24                	jb     9e4 <free+0x4f>
+ 9c0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9c3:	8b 00                	mov    (%eax),%eax
+ 9c5:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 9c8:	72 1a                	jb     9e4 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9ca:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9cd:	8b 00                	mov    (%eax),%eax
+ 9cf:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 9d2:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9d5:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 9d8:	73 d4                	jae    9ae <free+0x19>
+ 9da:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9dd:	8b 00                	mov    (%eax),%eax
+ 9df:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 9e2:	73 ca                	jae    9ae <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 9e4:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9e7:	8b 40 04             	mov    0x4(%eax),%eax
+ 9ea:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 9f1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9f4:	01 c2                	add    %eax,%edx
+ 9f6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9f9:	8b 00                	mov    (%eax),%eax
+ 9fb:	39 c2                	cmp    %eax,%edx
+ 9fd:	75 24                	jne    a23 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 9ff:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a02:	8b 50 04             	mov    0x4(%eax),%edx
+ a05:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a08:	8b 00                	mov    (%eax),%eax
+ a0a:	8b 40 04             	mov    0x4(%eax),%eax
+ a0d:	01 c2                	add    %eax,%edx
+ a0f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a12:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a15:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a18:	8b 00                	mov    (%eax),%eax
+ a1a:	8b 10                	mov    (%eax),%edx
+ a1c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a1f:	89 10                	mov    %edx,(%eax)
+ a21:	eb 0a                	jmp    a2d <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ a23:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a26:	8b 10                	mov    (%eax),%edx
+ a28:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a2b:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ a2d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a30:	8b 40 04             	mov    0x4(%eax),%eax
+ a33:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ a3a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a3d:	01 d0                	add    %edx,%eax
+ a3f:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ a42:	75 20                	jne    a64 <free+0xcf>
+    p->s.size += bp->s.size;
+ a44:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a47:	8b 50 04             	mov    0x4(%eax),%edx
+ a4a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a4d:	8b 40 04             	mov    0x4(%eax),%eax
+ a50:	01 c2                	add    %eax,%edx
+ a52:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a55:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ a58:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a5b:	8b 10                	mov    (%eax),%edx
+ a5d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a60:	89 10                	mov    %edx,(%eax)
+ a62:	eb 08                	jmp    a6c <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ a64:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a67:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ a6a:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ a6c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a6f:	a3 28 24 00 00       	mov    %eax,0x2428
+}
+ a74:	90                   	nop
+ a75:	c9                   	leave
+ a76:	c3                   	ret
+
+00000a77 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ a77:	55                   	push   %ebp
+ a78:	89 e5                	mov    %esp,%ebp
+ a7a:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ a7d:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ a84:	77 07                	ja     a8d <morecore+0x16>
+    nu = 4096;
+ a86:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ a8d:	8b 45 08             	mov    0x8(%ebp),%eax
+ a90:	c1 e0 03             	shl    $0x3,%eax
+ a93:	83 ec 0c             	sub    $0xc,%esp
+ a96:	50                   	push   %eax
+ a97:	e8 4b fc ff ff       	call   6e7 <sbrk>
+ a9c:	83 c4 10             	add    $0x10,%esp
+ a9f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ aa2:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ aa6:	75 07                	jne    aaf <morecore+0x38>
+    return 0;
+ aa8:	b8 00 00 00 00       	mov    $0x0,%eax
+ aad:	eb 26                	jmp    ad5 <morecore+0x5e>
+  hp = (Header*)p;
+ aaf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ab2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ ab5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ab8:	8b 55 08             	mov    0x8(%ebp),%edx
+ abb:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ abe:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ac1:	83 c0 08             	add    $0x8,%eax
+ ac4:	83 ec 0c             	sub    $0xc,%esp
+ ac7:	50                   	push   %eax
+ ac8:	e8 c8 fe ff ff       	call   995 <free>
+ acd:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ ad0:	a1 28 24 00 00       	mov    0x2428,%eax
+}
+ ad5:	c9                   	leave
+ ad6:	c3                   	ret
+
+00000ad7 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ ad7:	55                   	push   %ebp
+ ad8:	89 e5                	mov    %esp,%ebp
+ ada:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ add:	8b 45 08             	mov    0x8(%ebp),%eax
+ ae0:	83 c0 07             	add    $0x7,%eax
+ ae3:	c1 e8 03             	shr    $0x3,%eax
+ ae6:	83 c0 01             	add    $0x1,%eax
+ ae9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ aec:	a1 28 24 00 00       	mov    0x2428,%eax
+ af1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ af4:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ af8:	75 23                	jne    b1d <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ afa:	c7 45 f0 20 24 00 00 	movl   $0x2420,-0x10(%ebp)
+ b01:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b04:	a3 28 24 00 00       	mov    %eax,0x2428
+ b09:	a1 28 24 00 00       	mov    0x2428,%eax
+ b0e:	a3 20 24 00 00       	mov    %eax,0x2420
+    base.s.size = 0;
+ b13:	c7 05 24 24 00 00 00 	movl   $0x0,0x2424
+ b1a:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b1d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b20:	8b 00                	mov    (%eax),%eax
+ b22:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ b25:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b28:	8b 40 04             	mov    0x4(%eax),%eax
+ b2b:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ b2e:	72 4d                	jb     b7d <malloc+0xa6>
+      if(p->s.size == nunits)
+ b30:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b33:	8b 40 04             	mov    0x4(%eax),%eax
+ b36:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ b39:	75 0c                	jne    b47 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ b3b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b3e:	8b 10                	mov    (%eax),%edx
+ b40:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b43:	89 10                	mov    %edx,(%eax)
+ b45:	eb 26                	jmp    b6d <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ b47:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b4a:	8b 40 04             	mov    0x4(%eax),%eax
+ b4d:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ b50:	89 c2                	mov    %eax,%edx
+ b52:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b55:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ b58:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b5b:	8b 40 04             	mov    0x4(%eax),%eax
+ b5e:	c1 e0 03             	shl    $0x3,%eax
+ b61:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ b64:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b67:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ b6a:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ b6d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b70:	a3 28 24 00 00       	mov    %eax,0x2428
+      return (void*)(p + 1);
+ b75:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b78:	83 c0 08             	add    $0x8,%eax
+ b7b:	eb 3b                	jmp    bb8 <malloc+0xe1>
+    }
+    if(p == freep)
+ b7d:	a1 28 24 00 00       	mov    0x2428,%eax
+ b82:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ b85:	75 1e                	jne    ba5 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ b87:	83 ec 0c             	sub    $0xc,%esp
+ b8a:	ff 75 ec             	push   -0x14(%ebp)
+ b8d:	e8 e5 fe ff ff       	call   a77 <morecore>
+ b92:	83 c4 10             	add    $0x10,%esp
+ b95:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ b98:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b9c:	75 07                	jne    ba5 <malloc+0xce>
+        return 0;
+ b9e:	b8 00 00 00 00       	mov    $0x0,%eax
+ ba3:	eb 13                	jmp    bb8 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ba5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ba8:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ bab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bae:	8b 00                	mov    (%eax),%eax
+ bb0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ bb3:	e9 6d ff ff ff       	jmp    b25 <malloc+0x4e>
+  }
+}
+ bb8:	c9                   	leave
+ bb9:	c3                   	ret
@@ -1,4 +1,17 @@
-// Simple PIO-based (non-DMA) IDE driver code.
+// IDE driver code.
+//
+// Requests are kept sorted by sector and served in C-LOOK order (one
+// sweep upwards, then back to the lowest sector), unless a request has
+// waited past its deadline. Requests that are adjacent on disk and go
+// in the same direction are merged into a single multi-sector command.
+// The issuing process sleeps on its request until ideintr() completes
+// the command and starts the next one; asynchronous reads (read-ahead)
+// get a completion callback instead.
+//
+// If the controller is a PCI bus-master IDE controller (like QEMU's
+// PIIX), requests are transferred with DMA, described by a PRD table.
+// Otherwise -- or if DMA ever fails -- the data goes through the data
+// port (PIO).
 
 #include "types.h"
 #include "defs.h"
@@ -13,8 +26,9 @@
 //#include "fs.h"
 //#include "buf.h"
 #include "vfs.h"
-#include "queue.h"
 #include "mbr.h"
+#include "bcache.h"
+#include "pci.h"
 
 #define SECTOR_SIZE   512
 #define IDE_BSY       0x80
@@ -26,27 +40,98 @@
 #define IDE_CMD_WRITE 0x30
 #define IDE_CMD_RDMUL 0xc4
 #define IDE_CMD_WRMUL 0xc5
+#define IDE_CMD_SETMUL 0xc6
+#define IDE_CMD_RDDMA 0xc8
+#define IDE_CMD_WRDMA 0xca
 
+// Bus master registers, relative to BAR4
+#define BM_CMD        0
+#define BM_STATUS     2
+#define BM_PRDT       4
+
+#define BM_CMD_START  0x01
+#define BM_CMD_READ   0x08  // device to memory
+#define BM_ST_ERR     0x02
+#define BM_ST_IRQ     0x04
+
+#define PRD_EOT       0x8000
+
+#define IDE_MULTIPLE  16   // sectors per interrupt for READ/WRITE MULTIPLE
+#define IDE_MAXSECT   128  // sectors per command
+
+// Ticks a request may wait before it is served ahead of the elevator
+#define IDE_READ_EXPIRE  50
+#define IDE_WRITE_EXPIRE 500
+
+#define IDE_NPRD      (2 * IDE_MAXSECT)  // a sector may straddle a 64K boundary
+
+#if VFS_BLOCK_SIZE != SECTOR_SIZE
+#error "ide.c assumes one sector per VFS block"
+#endif
+
+// Physical region descriptor
+struct prd {
+  uint addr;
+  ushort count;
+  ushort flags;
+};
+
+// A request from ide_rw() or ide_breadv_async(). buffers[i] holds
+// sector start + i. Pending requests are kept sorted by start sector.
 struct block {
-  void* buffer;
-  int device, start;
-  int op, done;
+  void** buffers;
+  int device, start, count;
+  int op, done, error;
+  uint deadline;       // ticks by which it should have been started
+  struct block* next;
+
+  // asynchronous requests: nobody waits, ideintr() calls back instead
+  void (*callback)(void* arg, int error);
+  void* arg;
+};
+
+// The command the disk is working on: one or more adjacent requests
+// merged together. xfer counts the sectors moved so far.
+struct ide_cmd {
+  void* buffers[IDE_MAXSECT];
+  int device, start, count;
+  int op, error;
+  int xfer, dma;
+  struct block* reqs;  // merged requests, in sector order
 };
 
-// idequeue points to the buf now being read/written to the disk.
-// idequeue->qnext points to the next buf to be processed.
-// You must hold idelock while manipulating queue.
+// You must hold idelock while manipulating the queue or the command.
 
 static struct spinlock idelock;
-//static struct buf *idequeue;
-static queue_t q;
+static struct block* pending;  // sorted by start sector
+static struct ide_cmd cmd;
+static int busy;               // cmd is in flight
+static int headpos;            // sector after the last command (C-LOOK)
 
 static int havedisk1;
+static int multiple = 1;  // sectors per DRQ block, once SET MULTIPLE worked
+static int bmbase;        // bus master I/O base, 0 if not using DMA
+static struct prd* prdt;
 //static void idestart(struct buf*);
 
 // Hooks for VFS
 static int ide_bread(struct block_driver* self, void* buffer, int b_num);
 static int ide_bwrite(struct block_driver* self, void* buffer, int b_num);
+static int ide_breadv(struct block_driver* self, void** buffers, int b_num, int count);
+static int ide_bwritev(struct block_driver* self, void** buffers, int b_num, int count);
+static int ide_breadv_async(struct block_driver* self, void** buffers, int b_num, int count,
+                            void (*done)(void* arg, int error), void* arg);
+
+static void
+ide_hooks(struct block_driver* drv)
+{
+  drv->bread = ide_bread;
+  drv->bwrite = ide_bwrite;
+  drv->breadv = ide_breadv;
+  drv->bwritev = ide_bwritev;
+  drv->breadv_async = ide_breadv_async;
+  drv->breadahead = 0;
+}
 
 // Wait for IDE disk to become ready.
 static int
@@ -61,6 +146,28 @@ idewait(int checkerr)
   return 0;
 }
 
+// Look for a bus-master IDE controller on the PCI bus
+static void
+ide_dmainit(void)
+{
+  struct pci_dev pd;
+  uint bar;
+
+  if(pci_find(PCI_CLASS_STORAGE, PCI_SUBCLASS_IDE, &pd) < 0)
+    return;
+
+  // the bus master registers have to be in I/O space
+  bar = pci_read(&pd, PCI_BAR4);
+  if((bar & 1) == 0 || (bar & ~3) == 0)
+    return;
+
+  if((prdt = (struct prd*)kalloc()) == 0)
+    return;
+
+  pci_write(&pd, PCI_COMMAND, pci_read(&pd, PCI_COMMAND) | PCI_COMMAND_IO | PCI_COMMAND_MASTER);
+  bmbase = bar & 0xfffc;
+}
+
 void
 ideinit(void)
 {
@@ -70,10 +177,16 @@ ideinit(void)
   ioapicenable(IRQ_IDE, ncpu - 1);
   idewait(0);
 
-  // initialise the queue
-  q = queue_create();
+  static const char* names[] = {
+    "sda0",
+    "sda1",
+    "sda2",
+    "sda3"
+  };
 
-  struct block_driver* drv = (void*)kalloc();
+  // one driver per partition -- the first one doubles as the whole disk
+  // until the MBR has been read
+  struct block_driver* drv = kmalloc(NELEM(names) * sizeof(struct block_driver));
 
   // FIXME: actually find out big the disk is!!
   //   TODO: look into how to get the number of sectors (in LBA) that the disk
@@ -83,23 +196,27 @@ ideinit(void)
   drv->device = 1;
 
   // Add function hooks
-  drv->bread = ide_bread;
-  drv->bwrite = ide_bwrite;
+  ide_hooks(drv);
+
+  // Move up to IDE_MULTIPLE sectors per interrupt with READ/WRITE
+  // MULTIPLE; if the drive refuses, fall back to one sector at a time.
+  // (no interrupt for this one; ide_commit() turns them back on)
+  outb(0x3f6, 2);
+  outb(0x1f6, 0xe0 | ((drv->device&1)<<4));
+  outb(0x1f2, IDE_MULTIPLE);
+  outb(0x1f7, IDE_CMD_SETMUL);
+  if(idewait(1) >= 0)
+    multiple = IDE_MULTIPLE;
+
+  ide_dmainit();
 
   // Read MBR from disk
-  char* mbr = kalloc();
+  char* mbr = kmalloc(VFS_BLOCK_SIZE);
   ide_bread(drv, mbr, 0);
 
   // Parse MBR partition information
   int count = mbr_count(mbr);
 
-  static const char* names[] = {
-    "sda0",
-    "sda1",
-    "sda2",
-    "sda3"
-  };
-
   cprintf("%d\n", count);
 
   for(int i = 0; i < count; i++) {
@@ -107,19 +224,20 @@ ideinit(void)
     mbr_get(mbr, i, &curr);
 
     // Add function hooks
-    drv->bread = ide_bread;
-    drv->bwrite = ide_bwrite;
+    ide_hooks(drv);
 
     // Partition information
     drv->info.b_start = curr.start;
     drv->info.b_end = curr.end;
     drv->device = 1;
 
-    // Register with VFS
-    vfs_register_block(names[i], drv);
+    // Register with VFS -- behind the block cache
+    vfs_register_block(names[i], bcache_attach(drv));
     drv++;
   }
 
+  kfree_small(mbr);
+
   // Check if disk 1 is present
   outb(0x1f6, 0xe0 | (1<<4));
   for(i=0; i<1000; i++){
@@ -163,73 +281,274 @@ idestart(struct buf *b)
   }
 }*/
 
+// Send the next chunk of a write command to the disk.
 static void
-ide_commit(struct block* b)
+ide_push(struct ide_cmd* b)
 {
-  if(b == 0) {
+  int n = b->count - b->xfer;
+
+  if(n > multiple)
+    n = multiple;
+
+  for(int i = 0; i < n; i++)
+    outsl(0x1f0, b->buffers[b->xfer + i], SECTOR_SIZE / sizeof(long));
+
+  b->xfer += n;
+}
+
+// Fill the PRD table for command b. Returns -1 if a buffer can't be
+// handed to the controller (not in the kernel's direct map).
+static int
+ide_prd(struct ide_cmd* b)
+{
+  int n = 0;
+
+  for(int i = 0; i < b->count; i++) {
+    uint va = (uint)b->buffers[i];
+
+    if(va < KERNBASE || va >= KERNBASE + PHYSTOP || (va & 1))
+      return -1;
+
+    uint pa = V2P(va);
+    int len = SECTOR_SIZE;
+
+    // a region must not cross a 64K boundary
+    while(len > 0) {
+      int chunk = 0x10000 - (pa & 0xffff);
+
+      if(chunk > len)
+        chunk = len;
+
+      prdt[n].addr = pa;
+      prdt[n].count = chunk;
+      prdt[n].flags = 0;
+
+      n++;
+      pa += chunk;
+      len -= chunk;
+    }
+  }
+
+  prdt[n - 1].flags = PRD_EOT;
+  return 0;
+}
+
+// Start command b.  Caller must hold idelock.
+static void
+ide_commit(struct ide_cmd* b)
+{
+  if(b == 0 || b->count < 1 || b->count > IDE_MAXSECT) {
     panic("ide_commit");
   }
 
-  int s_bcount = VFS_BLOCK_SIZE / SECTOR_SIZE;
-  int sector = b->start * s_bcount;
+  int sector = b->start;
+  int mul = multiple > 1 && b->count > 1;
+
+  int read_cmd = mul ? IDE_CMD_RDMUL : IDE_CMD_READ;
+  int write_cmd = mul ? IDE_CMD_WRMUL : IDE_CMD_WRITE;
+
+  b->xfer = 0;
+  b->dma = bmbase != 0 && ide_prd(b) == 0;
+
+  if(b->dma) {
+    read_cmd = IDE_CMD_RDDMA;
+    write_cmd = IDE_CMD_WRDMA;
 
-  int read_cmd = (s_bcount == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
-  int write_cmd = (s_bcount == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
+    int dir = b->op == IDE_CMD_READ ? BM_CMD_READ : 0;
 
-  if (s_bcount > 7) {
-      panic("ide_commit: too many sectors per block");
+    outb(bmbase + BM_CMD, dir);
+    outl(bmbase + BM_PRDT, V2P(prdt));
+    outb(bmbase + BM_STATUS, inb(bmbase + BM_STATUS) | BM_ST_ERR | BM_ST_IRQ);
   }
 
   idewait(0);
   outb(0x3f6, 0);  // generate interrupt
-  outb(0x1f2, s_bcount);  // number of sectors
+  outb(0x1f2, b->count);  // number of sectors
   outb(0x1f3, sector & 0xff);
   outb(0x1f4, (sector >> 8) & 0xff);
   outb(0x1f5, (sector >> 16) & 0xff);
   outb(0x1f6, 0xe0 | ((b->device&1)<<4) | ((sector>>24)&0x0f));
 
-  if(b->op == IDE_CMD_WRITE) {
+  if(b->dma) {
+    outb(0x1f7, b->op == IDE_CMD_WRITE ? write_cmd : read_cmd);
+    outb(bmbase + BM_CMD, inb(bmbase + BM_CMD) | BM_CMD_START);
+  }
+  else if(b->op == IDE_CMD_WRITE) {
     outb(0x1f7, write_cmd);
-    outsl(0x1f0, b->buffer, VFS_BLOCK_SIZE / sizeof(long));
+    ide_push(b);
   }
   else {
     outb(0x1f7, read_cmd);
   }
 }
 
-static void busywait(struct spinlock* lk, int* cond)
+// Queue a request in sector order.  Caller must hold idelock.
+static void
+ide_insert(struct block* b)
 {
-    while(*cond != 1) {
-        release(lk);
-        for(int i = 0; i < 1000; i++);
-        acquire(lk);
-    }
+  struct block** pp;
+
+  for(pp = &pending; *pp != 0 && (*pp)->start <= b->start; pp = &(*pp)->next)
+    ;
+
+  b->next = *pp;
+  *pp = b;
+}
+
+// Pick the next request: the one that has waited the longest if it
+// is past its deadline, otherwise the next one in C-LOOK order (the
+// first at or after the head, wrapping around to the lowest sector).
+// Caller must hold idelock.
+static struct block*
+ide_pick(void)
+{
+  struct block *b, *oldest = 0, *up = 0;
+
+  for(b = pending; b != 0; b = b->next) {
+    if(oldest == 0 || (int)(b->deadline - oldest->deadline) < 0)
+      oldest = b;
+    if(up == 0 && b->start >= headpos)
+      up = b;
+  }
+
+  if(oldest != 0 && (int)(ticks - oldest->deadline) >= 0)
+    return oldest;
+
+  return up != 0 ? up : pending;
+}
+
+// Build the next command out of the pending requests and start it:
+// the picked request, plus the requests right behind it on disk with
+// the same direction, as long as they fit into one command.
+// Caller must hold idelock.
+static void
+ide_start(void)
+{
+  struct block *b, **pp, **tail;
+
+  busy = 0;
+
+  if((b = ide_pick()) == 0)
+    return;
+
+  cmd.device = b->device;
+  cmd.start = b->start;
+  cmd.count = 0;
+  cmd.op = b->op;
+  cmd.error = 0;
+  cmd.reqs = 0;
+  tail = &cmd.reqs;
+
+  // The list is sorted, so the candidates follow b.
+  for(pp = &pending; *pp != b; pp = &(*pp)->next)
+    ;
+
+  while((b = *pp) != 0) {
+    if(b->device != cmd.device || b->op != cmd.op)
+      break;
+    if(b->start != cmd.start + cmd.count || cmd.count + b->count > IDE_MAXSECT)
+      break;
+
+    *pp = b->next;
+
+    for(int i = 0; i < b->count; i++)
+      cmd.buffers[cmd.count + i] = b->buffers[i];
+
+    cmd.count += b->count;
+
+    b->next = 0;
+    *tail = b;
+    tail = &b->next;
+  }
+
+  busy = 1;
+  ide_commit(&cmd);
 }
 
 // Interrupt handler.
 void
 ideintr(void)
 {
-  struct block* b;
+  struct ide_cmd* b = &cmd;
+  struct block* r;
 
   acquire(&idelock);
 
-  if((b = queue_deq(q)) == 0){
+  if(!busy){
     release(&idelock);
     return;
   }
 
-  if(b->op == IDE_CMD_READ) {
-    insl(0x1f0, b->buffer, VFS_BLOCK_SIZE / 4);
+  if(b->dma) {
+    int st = inb(bmbase + BM_STATUS);
+
+    // not from the controller (still transferring)
+    if((st & BM_ST_IRQ) == 0) {
+      release(&idelock);
+      return;
+    }
+
+    outb(bmbase + BM_CMD, 0);
+    outb(bmbase + BM_STATUS, st | BM_ST_ERR | BM_ST_IRQ);
+
+    if((st & BM_ST_ERR) || idewait(1) < 0) {
+      // redo the command, and any after it, with PIO
+      cprintf("ide: DMA failed, falling back to PIO\n");
+      bmbase = 0;
+      ide_commit(b);
+
+      release(&idelock);
+      return;
+    }
+
+    b->xfer = b->count;
+  }
+  // One interrupt per DRQ block (up to `multiple' sectors): move the
+  // data, and only complete the command once all sectors are through.
+  else if(idewait(1) < 0) {
+    b->error = 1;
   }
+  else if(b->op == IDE_CMD_READ) {
+    int n = b->count - b->xfer;
 
-  b->done = 1;
-  wakeup(b);
+    if(n > multiple)
+      n = multiple;
 
-  if((b = queue_deq(q)) != 0) {
-    ide_commit(b);
-    busywait(&idelock, &(b->done));
+    for(int i = 0; i < n; i++)
+      insl(0x1f0, b->buffers[b->xfer + i], SECTOR_SIZE / 4);
+
+    b->xfer += n;
   }
+  else if(b->xfer < b->count) {
+    ide_push(b);
+    release(&idelock);
+    return;
+  }
+
+  if(!b->error && b->xfer < b->count) {
+    release(&idelock);
+    return;
+  }
+
+  headpos = b->start + b->count;
+
+  // Wake the processes waiting for the merged requests.
+  while((r = b->reqs) != 0) {
+    b->reqs = r->next;
+    r->error = b->error;
+
+    if(r->callback) {
+      r->callback(r->arg, r->error);
+      kfree_small(r);
+      continue;
+    }
+
+    r->done = 1;
+    wakeup(r);
+  }
+
+  // Start disk on the next command -- its issuers are already waiting.
+  ide_start();
 
   release(&idelock);
 
@@ -297,62 +616,118 @@ iderw(struct buf *b)
   release(&idelock);
 }*/
 
-static int ide_bread(struct block_driver* self, void* buffer, int b_num)
+// Queue a request and wait for ideintr() to complete it.
+static int ide_rw(struct block_driver* self, void** buffers, int b_num, int count, int op)
 {
-  struct block* b = (void*)kalloc();
-
-  b->buffer = buffer;
-  b->device = self->device;
-  b->start = self->info.b_start + b_num;
-  b->op = IDE_CMD_READ;
-  b->done = 0;
+  struct block b;  // lives until ideintr() is done with it
+
+  b.buffers = buffers;
+  b.device = self->device;
+  b.start = self->info.b_start + b_num;
+  b.count = count;
+  b.op = op;
+  b.done = 0;
+  b.error = 0;
+  b.deadline = ticks + (op == IDE_CMD_READ ? IDE_READ_EXPIRE : IDE_WRITE_EXPIRE);
+  b.callback = 0;
+  b.arg = 0;
 
   acquire(&idelock);
-  queue_enq(q, b);
+  ide_insert(&b);
 
-  // process now, if its the only item in the queue
-  if(queue_peek(q) == b) {
-    ide_commit(b);
+  // process now, if the disk is idle
+  if(!busy) {
+    ide_start();
   }
 
-  busywait(&idelock, &(b->done));
-  /*if(myproc() == 0) {
-    busywait(&idelock, &(b->done));
+  if(myproc() == 0) {
+    // Nothing to sleep on yet (e.g. reading the MBR at boot).
+    // Let the interrupt in and check again.
+    while(!b.done) {
+      release(&idelock);
+      acquire(&idelock);
+    }
   }
-  else
-  {
-    while(!b->done) {
-      sleep(b, &idelock);
+  else {
+    while(!b.done) {
+      sleep(&b, &idelock);
     }
-  }*/
+  }
 
-  kfree((void*)b);
   release(&idelock);
 
-  return 0;
+  return b.error ? -1 : count * VFS_BLOCK_SIZE;
 }
 
-static int ide_bwrite(struct block_driver* self, void* buffer, int b_num)
+// Split a run of blocks into commands of at most IDE_MAXSECT sectors
+static int ide_rwv(struct block_driver* self, void** buffers, int b_num, int count, int op)
+{
+  int done = 0;
+
+  while(done < count) {
+    int n = count - done;
+
+    if(n > IDE_MAXSECT) {
+      n = IDE_MAXSECT;
+    }
+
+    if(ide_rw(self, buffers + done, b_num + done, n, op) < 0) {
+      return -1;
+    }
+
+    done += n;
+  }
+
+  return count * VFS_BLOCK_SIZE;
+}
+
+// Queue a read and return right away; ideintr() calls done once the data
+// is in the buffers.
+static int ide_breadv_async(struct block_driver* self, void** buffers, int b_num, int count,
+                            void (*done)(void* arg, int error), void* arg)
 {
-  struct block* b = (void*)kalloc();
+  struct block* b;
+
+  if(count <= 0 || count > IDE_MAXSECT || (b = kmalloc(sizeof(*b))) == 0)
+    return -1;
 
-  b->buffer = buffer;
+  b->buffers = buffers;
   b->device = self->device;
   b->start = self->info.b_start + b_num;
-  b->op = IDE_CMD_WRITE;
+  b->count = count;
+  b->op = IDE_CMD_READ;
   b->done = 0;
+  b->error = 0;
+  b->deadline = ticks + IDE_READ_EXPIRE;
+  b->callback = done;
+  b->arg = arg;
 
   acquire(&idelock);
-  queue_enq(q, b);
+  ide_insert(b);
 
-  // process now, if its the only item in the queue
-  if(queue_peek(q) == b) {
-    ide_commit(b);
-    busywait(&idelock, &(b->done));
-  }
+  if(!busy)
+    ide_start();
 
-  kfree((void*)b);
   release(&idelock);
-
   return 0;
 }
+
+static int ide_bread(struct block_driver* self, void* buffer, int b_num)
+{
+  return ide_rw(self, &buffer, b_num, 1, IDE_CMD_READ);
+}
+
+static int ide_bwrite(struct block_driver* self, void* buffer, int b_num)
+{
+  return ide_rw(self, &buffer, b_num, 1, IDE_CMD_WRITE);
+}
+
+static int ide_breadv(struct block_driver* self, void** buffers, int b_num, int count)
+{
+  return ide_rwv(self, buffers, b_num, count, IDE_CMD_READ);
+}
+
+static int ide_bwritev(struct block_driver* self, void** buffers, int b_num, int count)
+{
+  return ide_rwv(self, buffers, b_num, count, IDE_CMD_WRITE);
+}
@@ -0,0 +1,1348 @@
+
+_init:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <update>:
+
+// Write back dirty filesystem state every SYNC_INTERVAL ticks, so that
+// writes reach the disk even if nobody calls sync.
+void
+update(void)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 08             	sub    $0x8,%esp
+  for(;;){
+    sleep(SYNC_INTERVAL);
+   6:	83 ec 0c             	sub    $0xc,%esp
+   9:	68 f4 01 00 00       	push   $0x1f4
+   e:	e8 fb 04 00 00       	call   50e <sleep>
+  13:	83 c4 10             	add    $0x10,%esp
+    sync();
+  16:	e8 13 05 00 00       	call   52e <sync>
+    sleep(SYNC_INTERVAL);
+  1b:	90                   	nop
+  1c:	eb e8                	jmp    6 <update+0x6>
+
+0000001e <main>:
+  }
+}
+
+int
+main(void)
+{
+  1e:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  22:	83 e4 f0             	and    $0xfffffff0,%esp
+  25:	ff 71 fc             	push   -0x4(%ecx)
+  28:	55                   	push   %ebp
+  29:	89 e5                	mov    %esp,%ebp
+  2b:	51                   	push   %ecx
+  2c:	83 ec 14             	sub    $0x14,%esp
+  int pid, wpid;
+
+  if(open("/dev/console", O_RDWR) < 0){
+  2f:	83 ec 08             	sub    $0x8,%esp
+  32:	6a 02                	push   $0x2
+  34:	68 03 10 00 00       	push   $0x1003
+  39:	e8 80 04 00 00       	call   4be <open>
+  3e:	83 c4 10             	add    $0x10,%esp
+  41:	85 c0                	test   %eax,%eax
+  43:	79 26                	jns    6b <main+0x4d>
+    mknod("console", 1, 1);
+  45:	83 ec 04             	sub    $0x4,%esp
+  48:	6a 01                	push   $0x1
+  4a:	6a 01                	push   $0x1
+  4c:	68 10 10 00 00       	push   $0x1010
+  51:	e8 70 04 00 00       	call   4c6 <mknod>
+  56:	83 c4 10             	add    $0x10,%esp
+    open("/dev/console", O_RDWR);
+  59:	83 ec 08             	sub    $0x8,%esp
+  5c:	6a 02                	push   $0x2
+  5e:	68 03 10 00 00       	push   $0x1003
+  63:	e8 56 04 00 00       	call   4be <open>
+  68:	83 c4 10             	add    $0x10,%esp
+  }
+  dup(0);  // stdout
+  6b:	83 ec 0c             	sub    $0xc,%esp
+  6e:	6a 00                	push   $0x0
+  70:	e8 81 04 00 00       	call   4f6 <dup>
+  75:	83 c4 10             	add    $0x10,%esp
+  dup(0);  // stderr
+  78:	83 ec 0c             	sub    $0xc,%esp
+  7b:	6a 00                	push   $0x0
+  7d:	e8 74 04 00 00       	call   4f6 <dup>
+  82:	83 c4 10             	add    $0x10,%esp
+
+  pid = fork();
+  85:	e8 ec 03 00 00       	call   476 <fork>
+  8a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(pid < 0)
+  8d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  91:	79 12                	jns    a5 <main+0x87>
+    printf(1, "init: fork update failed\n");
+  93:	83 ec 08             	sub    $0x8,%esp
+  96:	68 18 10 00 00       	push   $0x1018
+  9b:	6a 01                	push   $0x1
+  9d:	e8 80 05 00 00       	call   622 <printf>
+  a2:	83 c4 10             	add    $0x10,%esp
+  if(pid == 0)
+  a5:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  a9:	75 05                	jne    b0 <main+0x92>
+    update();
+  ab:	e8 50 ff ff ff       	call   0 <update>
+
+  for(;;){
+    printf(1, "init: starting sh\n");
+  b0:	83 ec 08             	sub    $0x8,%esp
+  b3:	68 32 10 00 00       	push   $0x1032
+  b8:	6a 01                	push   $0x1
+  ba:	e8 63 05 00 00       	call   622 <printf>
+  bf:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+  c2:	e8 af 03 00 00       	call   476 <fork>
+  c7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(pid < 0){
+  ca:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  ce:	79 17                	jns    e7 <main+0xc9>
+      printf(1, "init: fork failed\n");
+  d0:	83 ec 08             	sub    $0x8,%esp
+  d3:	68 45 10 00 00       	push   $0x1045
+  d8:	6a 01                	push   $0x1
+  da:	e8 43 05 00 00       	call   622 <printf>
+  df:	83 c4 10             	add    $0x10,%esp
+      exit();
+  e2:	e8 97 03 00 00       	call   47e <exit>
+    }
+    if(pid == 0){
+  e7:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  eb:	75 3e                	jne    12b <main+0x10d>
+      exec("sh", argv);
+  ed:	83 ec 08             	sub    $0x8,%esp
+  f0:	68 00 20 00 00       	push   $0x2000
+  f5:	68 00 10 00 00       	push   $0x1000
+  fa:	e8 b7 03 00 00       	call   4b6 <exec>
+  ff:	83 c4 10             	add    $0x10,%esp
+      printf(1, "init: exec sh failed\n");
+ 102:	83 ec 08             	sub    $0x8,%esp
+ 105:	68 58 10 00 00       	push   $0x1058
+ 10a:	6a 01                	push   $0x1
+ 10c:	e8 11 05 00 00       	call   622 <printf>
+ 111:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 114:	e8 65 03 00 00       	call   47e <exit>
+    }
+    while((wpid=wait()) >= 0 && wpid != pid)
+      printf(1, "zombie!\n");
+ 119:	83 ec 08             	sub    $0x8,%esp
+ 11c:	68 6e 10 00 00       	push   $0x106e
+ 121:	6a 01                	push   $0x1
+ 123:	e8 fa 04 00 00       	call   622 <printf>
+ 128:	83 c4 10             	add    $0x10,%esp
+    while((wpid=wait()) >= 0 && wpid != pid)
+ 12b:	e8 56 03 00 00       	call   486 <wait>
+ 130:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 133:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 137:	0f 88 73 ff ff ff    	js     b0 <main+0x92>
+ 13d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 140:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+ 143:	75 d4                	jne    119 <main+0xfb>
+    printf(1, "init: starting sh\n");
+ 145:	e9 66 ff ff ff       	jmp    b0 <main+0x92>
+
+0000014a <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 14a:	55                   	push   %ebp
+ 14b:	89 e5                	mov    %esp,%ebp
+ 14d:	57                   	push   %edi
+ 14e:	53                   	push   %ebx
+    if(cc < 1)
+ 14f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 152:	8b 55 10             	mov    0x10(%ebp),%edx
+ 155:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 158:	89 cb                	mov    %ecx,%ebx
+ 15a:	89 df                	mov    %ebx,%edi
+ 15c:	89 d1                	mov    %edx,%ecx
+ 15e:	fc                   	cld
+ 15f:	f3 aa                	rep stos %al,%es:(%edi)
+ 161:	89 ca                	mov    %ecx,%edx
+ 163:	89 fb                	mov    %edi,%ebx
+ 165:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 168:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+ 16b:	90                   	nop
+ 16c:	5b                   	pop    %ebx
+ 16d:	5f                   	pop    %edi
+ 16e:	5d                   	pop    %ebp
+ 16f:	c3                   	ret
+
+00000170 <strcpy>:
+{
+ 170:	55                   	push   %ebp
+ 171:	89 e5                	mov    %esp,%ebp
+ 173:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 176:	8b 45 08             	mov    0x8(%ebp),%eax
+ 179:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 17c:	90                   	nop
+ 17d:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 180:	8d 42 01             	lea    0x1(%edx),%eax
+ 183:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 186:	8b 45 08             	mov    0x8(%ebp),%eax
+ 189:	8d 48 01             	lea    0x1(%eax),%ecx
+ 18c:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 18f:	0f b6 12             	movzbl (%edx),%edx
+ 192:	88 10                	mov    %dl,(%eax)
+ 194:	0f b6 00             	movzbl (%eax),%eax
+ 197:	84 c0                	test   %al,%al
+ 199:	75 e2                	jne    17d <strcpy+0xd>
+  return os;
+ 19b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 19e:	c9                   	leave
+ 19f:	c3                   	ret
+
+000001a0 <strcmp>:
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 1a3:	eb 08                	jmp    1ad <strcmp+0xd>
+    p++, q++;
+ 1a5:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 1a9:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 1ad:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b0:	0f b6 00             	movzbl (%eax),%eax
+ 1b3:	84 c0                	test   %al,%al
+ 1b5:	74 10                	je     1c7 <strcmp+0x27>
+ 1b7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1ba:	0f b6 10             	movzbl (%eax),%edx
+ 1bd:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1c0:	0f b6 00             	movzbl (%eax),%eax
+ 1c3:	38 c2                	cmp    %al,%dl
+ 1c5:	74 de                	je     1a5 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 1c7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1ca:	0f b6 00             	movzbl (%eax),%eax
+ 1cd:	0f b6 d0             	movzbl %al,%edx
+ 1d0:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1d3:	0f b6 00             	movzbl (%eax),%eax
+ 1d6:	0f b6 c0             	movzbl %al,%eax
+ 1d9:	29 c2                	sub    %eax,%edx
+ 1db:	89 d0                	mov    %edx,%eax
+}
+ 1dd:	5d                   	pop    %ebp
+ 1de:	c3                   	ret
+
+000001df <strlen>:
+{
+ 1df:	55                   	push   %ebp
+ 1e0:	89 e5                	mov    %esp,%ebp
+ 1e2:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 1e5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 1ec:	eb 04                	jmp    1f2 <strlen+0x13>
+ 1ee:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 1f2:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 1f5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1f8:	01 d0                	add    %edx,%eax
+ 1fa:	0f b6 00             	movzbl (%eax),%eax
+ 1fd:	84 c0                	test   %al,%al
+ 1ff:	75 ed                	jne    1ee <strlen+0xf>
+  return n;
+ 201:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 204:	c9                   	leave
+ 205:	c3                   	ret
+
+00000206 <memset>:
+{
+ 206:	55                   	push   %ebp
+ 207:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 209:	8b 45 10             	mov    0x10(%ebp),%eax
+ 20c:	50                   	push   %eax
+ 20d:	ff 75 0c             	push   0xc(%ebp)
+ 210:	ff 75 08             	push   0x8(%ebp)
+ 213:	e8 32 ff ff ff       	call   14a <stosb>
+ 218:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 21b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 21e:	c9                   	leave
+ 21f:	c3                   	ret
+
+00000220 <strchr>:
+{
+ 220:	55                   	push   %ebp
+ 221:	89 e5                	mov    %esp,%ebp
+ 223:	83 ec 04             	sub    $0x4,%esp
+ 226:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 229:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 22c:	eb 14                	jmp    242 <strchr+0x22>
+    if(*s == c)
+ 22e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 231:	0f b6 00             	movzbl (%eax),%eax
+ 234:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 237:	75 05                	jne    23e <strchr+0x1e>
+      return (char*)s;
+ 239:	8b 45 08             	mov    0x8(%ebp),%eax
+ 23c:	eb 13                	jmp    251 <strchr+0x31>
+  for(; *s; s++)
+ 23e:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 242:	8b 45 08             	mov    0x8(%ebp),%eax
+ 245:	0f b6 00             	movzbl (%eax),%eax
+ 248:	84 c0                	test   %al,%al
+ 24a:	75 e2                	jne    22e <strchr+0xe>
+  return 0;
+ 24c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 251:	c9                   	leave
+ 252:	c3                   	ret
+
+00000253 <gets>:
+{
+ 253:	55                   	push   %ebp
+ 254:	89 e5                	mov    %esp,%ebp
+ 256:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 259:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 260:	eb 42                	jmp    2a4 <gets+0x51>
+    cc = read(0, &c, 1);
+ 262:	83 ec 04             	sub    $0x4,%esp
+ 265:	6a 01                	push   $0x1
+ 267:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 26a:	50                   	push   %eax
+ 26b:	6a 00                	push   $0x0
+ 26d:	e8 24 02 00 00       	call   496 <read>
+ 272:	83 c4 10             	add    $0x10,%esp
+ 275:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 278:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 27c:	7e 33                	jle    2b1 <gets+0x5e>
+    buf[i++] = c;
+ 27e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 281:	8d 50 01             	lea    0x1(%eax),%edx
+ 284:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 287:	89 c2                	mov    %eax,%edx
+ 289:	8b 45 08             	mov    0x8(%ebp),%eax
+ 28c:	01 c2                	add    %eax,%edx
+ 28e:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 292:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 294:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 298:	3c 0a                	cmp    $0xa,%al
+ 29a:	74 16                	je     2b2 <gets+0x5f>
+ 29c:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2a0:	3c 0d                	cmp    $0xd,%al
+ 2a2:	74 0e                	je     2b2 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 2a4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2a7:	83 c0 01             	add    $0x1,%eax
+ 2aa:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 2ad:	7f b3                	jg     262 <gets+0xf>
+ 2af:	eb 01                	jmp    2b2 <gets+0x5f>
+      break;
+ 2b1:	90                   	nop
+  }
+  buf[i] = '\0';
+ 2b2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 2b5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2b8:	01 d0                	add    %edx,%eax
+ 2ba:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 2bd:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2c0:	c9                   	leave
+ 2c1:	c3                   	ret
+
+000002c2 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 2c2:	55                   	push   %ebp
+ 2c3:	89 e5                	mov    %esp,%ebp
+ 2c5:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2c8:	83 ec 08             	sub    $0x8,%esp
+ 2cb:	6a 00                	push   $0x0
+ 2cd:	ff 75 08             	push   0x8(%ebp)
+ 2d0:	e8 e9 01 00 00       	call   4be <open>
+ 2d5:	83 c4 10             	add    $0x10,%esp
+ 2d8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 2db:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 2df:	79 07                	jns    2e8 <stat+0x26>
+    return -1;
+ 2e1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 2e6:	eb 25                	jmp    30d <stat+0x4b>
+  r = fstat(fd, st);
+ 2e8:	83 ec 08             	sub    $0x8,%esp
+ 2eb:	ff 75 0c             	push   0xc(%ebp)
+ 2ee:	ff 75 f4             	push   -0xc(%ebp)
+ 2f1:	e8 e0 01 00 00       	call   4d6 <fstat>
+ 2f6:	83 c4 10             	add    $0x10,%esp
+ 2f9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 2fc:	83 ec 0c             	sub    $0xc,%esp
+ 2ff:	ff 75 f4             	push   -0xc(%ebp)
+ 302:	e8 9f 01 00 00       	call   4a6 <close>
+ 307:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 30a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 30d:	c9                   	leave
+ 30e:	c3                   	ret
+
+0000030f <atoi>:
+
+int
+atoi(const char *s)
+{
+ 30f:	55                   	push   %ebp
+ 310:	89 e5                	mov    %esp,%ebp
+ 312:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 315:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 31c:	eb 25                	jmp    343 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 31e:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 321:	89 d0                	mov    %edx,%eax
+ 323:	c1 e0 02             	shl    $0x2,%eax
+ 326:	01 d0                	add    %edx,%eax
+ 328:	01 c0                	add    %eax,%eax
+ 32a:	89 c1                	mov    %eax,%ecx
+ 32c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 32f:	8d 50 01             	lea    0x1(%eax),%edx
+ 332:	89 55 08             	mov    %edx,0x8(%ebp)
+ 335:	0f b6 00             	movzbl (%eax),%eax
+ 338:	0f be c0             	movsbl %al,%eax
+ 33b:	01 c8                	add    %ecx,%eax
+ 33d:	83 e8 30             	sub    $0x30,%eax
+ 340:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 343:	8b 45 08             	mov    0x8(%ebp),%eax
+ 346:	0f b6 00             	movzbl (%eax),%eax
+ 349:	3c 2f                	cmp    $0x2f,%al
+ 34b:	7e 0a                	jle    357 <atoi+0x48>
+ 34d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 350:	0f b6 00             	movzbl (%eax),%eax
+ 353:	3c 39                	cmp    $0x39,%al
+ 355:	7e c7                	jle    31e <atoi+0xf>
+  return n;
+ 357:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 35a:	c9                   	leave
+ 35b:	c3                   	ret
+
+0000035c <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 35c:	55                   	push   %ebp
+ 35d:	89 e5                	mov    %esp,%ebp
+ 35f:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+
+  dst = vdst;
+ 362:	8b 45 08             	mov    0x8(%ebp),%eax
+ 365:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 368:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 36b:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 36e:	eb 17                	jmp    387 <memmove+0x2b>
+    *dst++ = *src++;
+ 370:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 373:	8d 42 01             	lea    0x1(%edx),%eax
+ 376:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 379:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 37c:	8d 48 01             	lea    0x1(%eax),%ecx
+ 37f:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 382:	0f b6 12             	movzbl (%edx),%edx
+ 385:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 387:	8b 45 10             	mov    0x10(%ebp),%eax
+ 38a:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 38d:	89 55 10             	mov    %edx,0x10(%ebp)
+ 390:	85 c0                	test   %eax,%eax
+ 392:	7f dc                	jg     370 <memmove+0x14>
+  return vdst;
+ 394:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 397:	c9                   	leave
+ 398:	c3                   	ret
+
+00000399 <opendir>:
+    int fd;
+    int child;
+} DIR;
+
+DIR* opendir(const char* name)
+{
+ 399:	55                   	push   %ebp
+ 39a:	89 e5                	mov    %esp,%ebp
+ 39c:	83 ec 18             	sub    $0x18,%esp
+    DIR* dp = malloc(sizeof(*dp));
+ 39f:	83 ec 0c             	sub    $0xc,%esp
+ 3a2:	6a 08                	push   $0x8
+ 3a4:	e8 4d 05 00 00       	call   8f6 <malloc>
+ 3a9:	83 c4 10             	add    $0x10,%esp
+ 3ac:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+    dp->fd = open((char*)name, 0);
+ 3af:	83 ec 08             	sub    $0x8,%esp
+ 3b2:	6a 00                	push   $0x0
+ 3b4:	ff 75 08             	push   0x8(%ebp)
+ 3b7:	e8 02 01 00 00       	call   4be <open>
+ 3bc:	83 c4 10             	add    $0x10,%esp
+ 3bf:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 3c2:	89 02                	mov    %eax,(%edx)
+    dp->child = 0;
+ 3c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 3c7:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+
+    return dp;
+ 3ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 3d1:	c9                   	leave
+ 3d2:	c3                   	ret
+
+000003d3 <closedir>:
+
+void closedir(DIR* dp)
+{
+ 3d3:	55                   	push   %ebp
+ 3d4:	89 e5                	mov    %esp,%ebp
+ 3d6:	83 ec 08             	sub    $0x8,%esp
+    if(dp == 0) {
+ 3d9:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 3dd:	74 21                	je     400 <closedir+0x2d>
+        return;
+    }
+
+    close(dp->fd);
+ 3df:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3e2:	8b 00                	mov    (%eax),%eax
+ 3e4:	83 ec 0c             	sub    $0xc,%esp
+ 3e7:	50                   	push   %eax
+ 3e8:	e8 b9 00 00 00       	call   4a6 <close>
+ 3ed:	83 c4 10             	add    $0x10,%esp
+    free(dp);
+ 3f0:	83 ec 0c             	sub    $0xc,%esp
+ 3f3:	ff 75 08             	push   0x8(%ebp)
+ 3f6:	e8 b9 03 00 00       	call   7b4 <free>
+ 3fb:	83 c4 10             	add    $0x10,%esp
+ 3fe:	eb 01                	jmp    401 <closedir+0x2e>
+        return;
+ 400:	90                   	nop
+}
+ 401:	c9                   	leave
+ 402:	c3                   	ret
+
+00000403 <readdir>:
+
+struct dirent* readdir(DIR* dp)
+{
+ 403:	55                   	push   %ebp
+ 404:	89 e5                	mov    %esp,%ebp
+ 406:	83 ec 18             	sub    $0x18,%esp
+    if(dp == 0) {
+ 409:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 40d:	75 07                	jne    416 <readdir+0x13>
+      return 0;
+ 40f:	b8 00 00 00 00       	mov    $0x0,%eax
+ 414:	eb 5e                	jmp    474 <readdir+0x71>
+    }
+
+    struct dirent* de = malloc(sizeof(*de));
+ 416:	83 ec 0c             	sub    $0xc,%esp
+ 419:	68 0c 01 00 00       	push   $0x10c
+ 41e:	e8 d3 04 00 00       	call   8f6 <malloc>
+ 423:	83 c4 10             	add    $0x10,%esp
+ 426:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    int res = direntry(dp->fd, dp->child, de);
+ 429:	8b 45 08             	mov    0x8(%ebp),%eax
+ 42c:	8b 50 04             	mov    0x4(%eax),%edx
+ 42f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 432:	8b 00                	mov    (%eax),%eax
+ 434:	83 ec 04             	sub    $0x4,%esp
+ 437:	ff 75 f4             	push   -0xc(%ebp)
+ 43a:	52                   	push   %edx
+ 43b:	50                   	push   %eax
+ 43c:	e8 e5 00 00 00       	call   526 <direntry>
+ 441:	83 c4 10             	add    $0x10,%esp
+ 444:	89 45 f0             	mov    %eax,-0x10(%ebp)
+
+    // out of children or other error
+    if(res == -1) {
+ 447:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+ 44b:	75 15                	jne    462 <readdir+0x5f>
+        free(de);
+ 44d:	83 ec 0c             	sub    $0xc,%esp
+ 450:	ff 75 f4             	push   -0xc(%ebp)
+ 453:	e8 5c 03 00 00       	call   7b4 <free>
+ 458:	83 c4 10             	add    $0x10,%esp
+        return 0;
+ 45b:	b8 00 00 00 00       	mov    $0x0,%eax
+ 460:	eb 12                	jmp    474 <readdir+0x71>
+    }
+
+    dp->child++;
+ 462:	8b 45 08             	mov    0x8(%ebp),%eax
+ 465:	8b 40 04             	mov    0x4(%eax),%eax
+ 468:	8d 50 01             	lea    0x1(%eax),%edx
+ 46b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 46e:	89 50 04             	mov    %edx,0x4(%eax)
+    return de;
+ 471:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 474:	c9                   	leave
+ 475:	c3                   	ret
+
+00000476 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 476:	b8 01 00 00 00       	mov    $0x1,%eax
+ 47b:	cd 40                	int    $0x40
+ 47d:	c3                   	ret
+
+0000047e <exit>:
+SYSCALL(exit)
+ 47e:	b8 02 00 00 00       	mov    $0x2,%eax
+ 483:	cd 40                	int    $0x40
+ 485:	c3                   	ret
+
+00000486 <wait>:
+SYSCALL(wait)
+ 486:	b8 03 00 00 00       	mov    $0x3,%eax
+ 48b:	cd 40                	int    $0x40
+ 48d:	c3                   	ret
+
+0000048e <pipe>:
+SYSCALL(pipe)
+ 48e:	b8 04 00 00 00       	mov    $0x4,%eax
+ 493:	cd 40                	int    $0x40
+ 495:	c3                   	ret
+
+00000496 <read>:
+SYSCALL(read)
+ 496:	b8 05 00 00 00       	mov    $0x5,%eax
+ 49b:	cd 40                	int    $0x40
+ 49d:	c3                   	ret
+
+0000049e <write>:
+SYSCALL(write)
+ 49e:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4a3:	cd 40                	int    $0x40
+ 4a5:	c3                   	ret
+
+000004a6 <close>:
+SYSCALL(close)
+ 4a6:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4ab:	cd 40                	int    $0x40
+ 4ad:	c3                   	ret
+
+000004ae <kill>:
+SYSCALL(kill)
+ 4ae:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4b3:	cd 40                	int    $0x40
+ 4b5:	c3                   	ret
+
+000004b6 <exec>:
+SYSCALL(exec)
+ 4b6:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4bb:	cd 40                	int    $0x40
+ 4bd:	c3                   	ret
+
+000004be <open>:
+SYSCALL(open)
+ 4be:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4c3:	cd 40                	int    $0x40
+ 4c5:	c3                   	ret
+
+000004c6 <mknod>:
+SYSCALL(mknod)
+ 4c6:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4cb:	cd 40                	int    $0x40
+ 4cd:	c3                   	ret
+
+000004ce <unlink>:
+SYSCALL(unlink)
+ 4ce:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4d3:	cd 40                	int    $0x40
+ 4d5:	c3                   	ret
+
+000004d6 <fstat>:
+SYSCALL(fstat)
+ 4d6:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4db:	cd 40                	int    $0x40
+ 4dd:	c3                   	ret
+
+000004de <link>:
+SYSCALL(link)
+ 4de:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4e3:	cd 40                	int    $0x40
+ 4e5:	c3                   	ret
+
+000004e6 <mkdir>:
+SYSCALL(mkdir)
+ 4e6:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4eb:	cd 40                	int    $0x40
+ 4ed:	c3                   	ret
+
+000004ee <chdir>:
+SYSCALL(chdir)
+ 4ee:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4f3:	cd 40                	int    $0x40
+ 4f5:	c3                   	ret
+
+000004f6 <dup>:
+SYSCALL(dup)
+ 4f6:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4fb:	cd 40                	int    $0x40
+ 4fd:	c3                   	ret
+
+000004fe <getpid>:
+SYSCALL(getpid)
+ 4fe:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 503:	cd 40                	int    $0x40
+ 505:	c3                   	ret
+
+00000506 <sbrk>:
+SYSCALL(sbrk)
+ 506:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 50b:	cd 40                	int    $0x40
+ 50d:	c3                   	ret
+
+0000050e <sleep>:
+SYSCALL(sleep)
+ 50e:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 513:	cd 40                	int    $0x40
+ 515:	c3                   	ret
+
+00000516 <uptime>:
+SYSCALL(uptime)
+ 516:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 51b:	cd 40                	int    $0x40
+ 51d:	c3                   	ret
+
+0000051e <mount>:
+SYSCALL(mount)
+ 51e:	b8 16 00 00 00       	mov    $0x16,%eax
+ 523:	cd 40                	int    $0x40
+ 525:	c3                   	ret
+
+00000526 <direntry>:
+SYSCALL(direntry)
+ 526:	b8 17 00 00 00       	mov    $0x17,%eax
+ 52b:	cd 40                	int    $0x40
+ 52d:	c3                   	ret
+
+0000052e <sync>:
+SYSCALL(sync)
+ 52e:	b8 18 00 00 00       	mov    $0x18,%eax
+ 533:	cd 40                	int    $0x40
+ 535:	c3                   	ret
+
+00000536 <fsync>:
+SYSCALL(fsync)
+ 536:	b8 19 00 00 00       	mov    $0x19,%eax
+ 53b:	cd 40                	int    $0x40
+ 53d:	c3                   	ret
+
+0000053e <mmap>:
+SYSCALL(mmap)
+ 53e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 543:	cd 40                	int    $0x40
+ 545:	c3                   	ret
+
+00000546 <munmap>:
+SYSCALL(munmap)
+ 546:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 54b:	cd 40                	int    $0x40
+ 54d:	c3                   	ret
+
+0000054e <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 54e:	55                   	push   %ebp
+ 54f:	89 e5                	mov    %esp,%ebp
+ 551:	83 ec 18             	sub    $0x18,%esp
+ 554:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 557:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 55a:	83 ec 04             	sub    $0x4,%esp
+ 55d:	6a 01                	push   $0x1
+ 55f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 562:	50                   	push   %eax
+ 563:	ff 75 08             	push   0x8(%ebp)
+ 566:	e8 33 ff ff ff       	call   49e <write>
+ 56b:	83 c4 10             	add    $0x10,%esp
+}
+ 56e:	90                   	nop
+ 56f:	c9                   	leave
+ 570:	c3                   	ret
+
+00000571 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 571:	55                   	push   %ebp
+ 572:	89 e5                	mov    %esp,%ebp
+ 574:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 577:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 57e:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 582:	74 17                	je     59b <printint+0x2a>
+ 584:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 588:	79 11                	jns    59b <printint+0x2a>
+    neg = 1;
+ 58a:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 591:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 594:	f7 d8                	neg    %eax
+ 596:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 599:	eb 06                	jmp    5a1 <printint+0x30>
+  } else {
+    x = xx;
+ 59b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 59e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 5a1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 5a8:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 5ab:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 5ae:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5b3:	f7 f1                	div    %ecx
+ 5b5:	89 d1                	mov    %edx,%ecx
+ 5b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5ba:	8d 50 01             	lea    0x1(%eax),%edx
+ 5bd:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 5c0:	0f b6 91 08 20 00 00 	movzbl 0x2008(%ecx),%edx
+ 5c7:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 5cb:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 5ce:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 5d1:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5d6:	f7 f1                	div    %ecx
+ 5d8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 5db:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 5df:	75 c7                	jne    5a8 <printint+0x37>
+  if(neg)
+ 5e1:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 5e5:	74 2d                	je     614 <printint+0xa3>
+    buf[i++] = '-';
+ 5e7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5ea:	8d 50 01             	lea    0x1(%eax),%edx
+ 5ed:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 5f0:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 5f5:	eb 1d                	jmp    614 <printint+0xa3>
+    putc(fd, buf[i]);
+ 5f7:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 5fa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5fd:	01 d0                	add    %edx,%eax
+ 5ff:	0f b6 00             	movzbl (%eax),%eax
+ 602:	0f be c0             	movsbl %al,%eax
+ 605:	83 ec 08             	sub    $0x8,%esp
+ 608:	50                   	push   %eax
+ 609:	ff 75 08             	push   0x8(%ebp)
+ 60c:	e8 3d ff ff ff       	call   54e <putc>
+ 611:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 614:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 618:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 61c:	79 d9                	jns    5f7 <printint+0x86>
+}
+ 61e:	90                   	nop
+ 61f:	90                   	nop
+ 620:	c9                   	leave
+ 621:	c3                   	ret
+
+00000622 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 622:	55                   	push   %ebp
+ 623:	89 e5                	mov    %esp,%ebp
+ 625:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 628:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 62f:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 632:	83 c0 04             	add    $0x4,%eax
+ 635:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 638:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 63f:	e9 59 01 00 00       	jmp    79d <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 644:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 647:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 64a:	01 d0                	add    %edx,%eax
+ 64c:	0f b6 00             	movzbl (%eax),%eax
+ 64f:	0f be c0             	movsbl %al,%eax
+ 652:	25 ff 00 00 00       	and    $0xff,%eax
+ 657:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 65a:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 65e:	75 2c                	jne    68c <printf+0x6a>
+      if(c == '%'){
+ 660:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 664:	75 0c                	jne    672 <printf+0x50>
+        state = '%';
+ 666:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 66d:	e9 27 01 00 00       	jmp    799 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 672:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 675:	0f be c0             	movsbl %al,%eax
+ 678:	83 ec 08             	sub    $0x8,%esp
+ 67b:	50                   	push   %eax
+ 67c:	ff 75 08             	push   0x8(%ebp)
+ 67f:	e8 ca fe ff ff       	call   54e <putc>
+ 684:	83 c4 10             	add    $0x10,%esp
+ 687:	e9 0d 01 00 00       	jmp    799 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 68c:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 690:	0f 85 03 01 00 00    	jne    799 <printf+0x177>
+      if(c == 'd'){
+ 696:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 69a:	75 1e                	jne    6ba <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 69c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 69f:	8b 00                	mov    (%eax),%eax
+ 6a1:	6a 01                	push   $0x1
+ 6a3:	6a 0a                	push   $0xa
+ 6a5:	50                   	push   %eax
+ 6a6:	ff 75 08             	push   0x8(%ebp)
+ 6a9:	e8 c3 fe ff ff       	call   571 <printint>
+ 6ae:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 6b1:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 6b5:	e9 d8 00 00 00       	jmp    792 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 6ba:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 6be:	74 06                	je     6c6 <printf+0xa4>
+ 6c0:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 6c4:	75 1e                	jne    6e4 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 6c6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6c9:	8b 00                	mov    (%eax),%eax
+ 6cb:	6a 00                	push   $0x0
+ 6cd:	6a 10                	push   $0x10
+ 6cf:	50                   	push   %eax
+ 6d0:	ff 75 08             	push   0x8(%ebp)
+ 6d3:	e8 99 fe ff ff       	call   571 <printint>
+ 6d8:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 6db:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 6df:	e9 ae 00 00 00       	jmp    792 <printf+0x170>
+      } else if(c == 's'){
+ 6e4:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 6e8:	75 43                	jne    72d <printf+0x10b>
+        s = (char*)*ap;
+ 6ea:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6ed:	8b 00                	mov    (%eax),%eax
+ 6ef:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 6f2:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 6f6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 6fa:	75 25                	jne    721 <printf+0xff>
+          s = "(null)";
+ 6fc:	c7 45 f4 77 10 00 00 	movl   $0x1077,-0xc(%ebp)
+        while(*s != 0){
+ 703:	eb 1c                	jmp    721 <printf+0xff>
+          putc(fd, *s);
+ 705:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 708:	0f b6 00             	movzbl (%eax),%eax
+ 70b:	0f be c0             	movsbl %al,%eax
+ 70e:	83 ec 08             	sub    $0x8,%esp
+ 711:	50                   	push   %eax
+ 712:	ff 75 08             	push   0x8(%ebp)
+ 715:	e8 34 fe ff ff       	call   54e <putc>
+ 71a:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 71d:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 721:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 724:	0f b6 00             	movzbl (%eax),%eax
+ 727:	84 c0                	test   %al,%al
+ 729:	75 da                	jne    705 <printf+0xe3>
+ 72b:	eb 65                	jmp    792 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 72d:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 731:	75 1d                	jne    750 <printf+0x12e>
+        putc(fd, *ap);
+ 733:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 736:	8b 00                	mov    (%eax),%eax
+ 738:	0f be c0             	movsbl %al,%eax
+ 73b:	83 ec 08             	sub    $0x8,%esp
+ 73e:	50                   	push   %eax
+ 73f:	ff 75 08             	push   0x8(%ebp)
+ 742:	e8 07 fe ff ff       	call   54e <putc>
+ 747:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 74a:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 74e:	eb 42                	jmp    792 <printf+0x170>
+      } else if(c == '%'){
+ 750:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 754:	75 17                	jne    76d <printf+0x14b>
+        putc(fd, c);
+ 756:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 759:	0f be c0             	movsbl %al,%eax
+ 75c:	83 ec 08             	sub    $0x8,%esp
+ 75f:	50                   	push   %eax
+ 760:	ff 75 08             	push   0x8(%ebp)
+ 763:	e8 e6 fd ff ff       	call   54e <putc>
+ 768:	83 c4 10             	add    $0x10,%esp
+ 76b:	eb 25                	jmp    792 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 76d:	83 ec 08             	sub    $0x8,%esp
+ 770:	6a 25                	push   $0x25
+ 772:	ff 75 08             	push   0x8(%ebp)
+ 775:	e8 d4 fd ff ff       	call   54e <putc>
+ 77a:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 77d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 780:	0f be c0             	movsbl %al,%eax
+ 783:	83 ec 08             	sub    $0x8,%esp
+ 786:	50                   	push   %eax
+ 787:	ff 75 08             	push   0x8(%ebp)
+ 78a:	e8 bf fd ff ff       	call   54e <putc>
+ 78f:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 792:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 799:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 79d:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 7a0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7a3:	01 d0                	add    %edx,%eax
+ 7a5:	0f b6 00             	movzbl (%eax),%eax
+ 7a8:	84 c0                	test   %al,%al
+ 7aa:	0f 85 94 fe ff ff    	jne    644 <printf+0x22>
+    }
+  }
+}
+ 7b0:	90                   	nop
+ 7b1:	90                   	nop
+ 7b2:	c9                   	leave
+ 7b3:	c3                   	ret
+
+000007b4 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 7b4:	55                   	push   %ebp
+ 7b5:	89 e5                	mov    %esp,%ebp
+ 7b7:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 7ba:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7bd:	83 e8 08             	sub    $0x8,%eax
+ 7c0:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7c3:	a1 24 20 00 00       	mov    0x2024,%eax
+ 7c8:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 7cb:	eb 24                	jmp    7f1 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7cd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7d0:	8b 00                	mov    (%eax),%eax
+ 7d2:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 7d5:	72 12                	jb     7e9 <free+0x35>
+ 7d7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7da:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 7dd:	72 24                	jb     803 <free+0x4f>
+ 7df:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7e2:	8b 00                	mov    (%eax),%eax
+ 7e4:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 7e7:	72 1a                	jb     803 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7e9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7ec:	8b 00                	mov    (%eax),%eax
+ 7ee:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 7f1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7f4:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 7f7:	73 d4                	jae    7cd <free+0x19>
+ 7f9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7fc:	8b 00                	mov    (%eax),%eax
+ 7fe:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 801:	73 ca                	jae    7cd <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 803:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 806:	8b 40 04             	mov    0x4(%eax),%eax
+ 809:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 810:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 813:	01 c2                	add    %eax,%edx
+ 815:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 818:	8b 00                	mov    (%eax),%eax
+ 81a:	39 c2                	cmp    %eax,%edx
+ 81c:	75 24                	jne    842 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 81e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 821:	8b 50 04             	mov    0x4(%eax),%edx
+ 824:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 827:	8b 00                	mov    (%eax),%eax
+ 829:	8b 40 04             	mov    0x4(%eax),%eax
+ 82c:	01 c2                	add    %eax,%edx
+ 82e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 831:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 834:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 837:	8b 00                	mov    (%eax),%eax
+ 839:	8b 10                	mov    (%eax),%edx
+ 83b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 83e:	89 10                	mov    %edx,(%eax)
+ 840:	eb 0a                	jmp    84c <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 842:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 845:	8b 10                	mov    (%eax),%edx
+ 847:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 84a:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 84c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 84f:	8b 40 04             	mov    0x4(%eax),%eax
+ 852:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 859:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 85c:	01 d0                	add    %edx,%eax
+ 85e:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 861:	75 20                	jne    883 <free+0xcf>
+    p->s.size += bp->s.size;
+ 863:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 866:	8b 50 04             	mov    0x4(%eax),%edx
+ 869:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 86c:	8b 40 04             	mov    0x4(%eax),%eax
+ 86f:	01 c2                	add    %eax,%edx
+ 871:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 874:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 877:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 87a:	8b 10                	mov    (%eax),%edx
+ 87c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 87f:	89 10                	mov    %edx,(%eax)
+ 881:	eb 08                	jmp    88b <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 883:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 886:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 889:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 88b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 88e:	a3 24 20 00 00       	mov    %eax,0x2024
+}
+ 893:	90                   	nop
+ 894:	c9                   	leave
+ 895:	c3                   	ret
+
+00000896 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 896:	55                   	push   %ebp
+ 897:	89 e5                	mov    %esp,%ebp
+ 899:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 89c:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 8a3:	77 07                	ja     8ac <morecore+0x16>
+    nu = 4096;
+ 8a5:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 8ac:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8af:	c1 e0 03             	shl    $0x3,%eax
+ 8b2:	83 ec 0c             	sub    $0xc,%esp
+ 8b5:	50                   	push   %eax
+ 8b6:	e8 4b fc ff ff       	call   506 <sbrk>
+ 8bb:	83 c4 10             	add    $0x10,%esp
+ 8be:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 8c1:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 8c5:	75 07                	jne    8ce <morecore+0x38>
+    return 0;
+ 8c7:	b8 00 00 00 00       	mov    $0x0,%eax
+ 8cc:	eb 26                	jmp    8f4 <morecore+0x5e>
+  hp = (Header*)p;
+ 8ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8d1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 8d4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8d7:	8b 55 08             	mov    0x8(%ebp),%edx
+ 8da:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 8dd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8e0:	83 c0 08             	add    $0x8,%eax
+ 8e3:	83 ec 0c             	sub    $0xc,%esp
+ 8e6:	50                   	push   %eax
+ 8e7:	e8 c8 fe ff ff       	call   7b4 <free>
+ 8ec:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 8ef:	a1 24 20 00 00       	mov    0x2024,%eax
+}
+ 8f4:	c9                   	leave
+ 8f5:	c3                   	ret
+
+000008f6 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 8f6:	55                   	push   %ebp
+ 8f7:	89 e5                	mov    %esp,%ebp
+ 8f9:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8fc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8ff:	83 c0 07             	add    $0x7,%eax
+ 902:	c1 e8 03             	shr    $0x3,%eax
+ 905:	83 c0 01             	add    $0x1,%eax
+ 908:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 90b:	a1 24 20 00 00       	mov    0x2024,%eax
+ 910:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 913:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 917:	75 23                	jne    93c <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 919:	c7 45 f0 1c 20 00 00 	movl   $0x201c,-0x10(%ebp)
+ 920:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 923:	a3 24 20 00 00       	mov    %eax,0x2024
+ 928:	a1 24 20 00 00       	mov    0x2024,%eax
+ 92d:	a3 1c 20 00 00       	mov    %eax,0x201c
+    base.s.size = 0;
+ 932:	c7 05 20 20 00 00 00 	movl   $0x0,0x2020
+ 939:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 93c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 93f:	8b 00                	mov    (%eax),%eax
+ 941:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 944:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 947:	8b 40 04             	mov    0x4(%eax),%eax
+ 94a:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 94d:	72 4d                	jb     99c <malloc+0xa6>
+      if(p->s.size == nunits)
+ 94f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 952:	8b 40 04             	mov    0x4(%eax),%eax
+ 955:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 958:	75 0c                	jne    966 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 95a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 95d:	8b 10                	mov    (%eax),%edx
+ 95f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 962:	89 10                	mov    %edx,(%eax)
+ 964:	eb 26                	jmp    98c <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 966:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 969:	8b 40 04             	mov    0x4(%eax),%eax
+ 96c:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 96f:	89 c2                	mov    %eax,%edx
+ 971:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 974:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 977:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 97a:	8b 40 04             	mov    0x4(%eax),%eax
+ 97d:	c1 e0 03             	shl    $0x3,%eax
+ 980:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 983:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 986:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 989:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 98c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 98f:	a3 24 20 00 00       	mov    %eax,0x2024
+      return (void*)(p + 1);
+ 994:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 997:	83 c0 08             	add    $0x8,%eax
+ 99a:	eb 3b                	jmp    9d7 <malloc+0xe1>
+    }
+    if(p == freep)
+ 99c:	a1 24 20 00 00       	mov    0x2024,%eax
+ 9a1:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 9a4:	75 1e                	jne    9c4 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 9a6:	83 ec 0c             	sub    $0xc,%esp
+ 9a9:	ff 75 ec             	push   -0x14(%ebp)
+ 9ac:	e8 e5 fe ff ff       	call   896 <morecore>
+ 9b1:	83 c4 10             	add    $0x10,%esp
+ 9b4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 9b7:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 9bb:	75 07                	jne    9c4 <malloc+0xce>
+        return 0;
+ 9bd:	b8 00 00 00 00       	mov    $0x0,%eax
+ 9c2:	eb 13                	jmp    9d7 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9c7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 9ca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9cd:	8b 00                	mov    (%eax),%eax
+ 9cf:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 9d2:	e9 6d ff ff ff       	jmp    944 <malloc+0x4e>
+  }
+}
+ 9d7:	c9                   	leave
+ 9d8:	c3                   	ret
@@ -7,6 +7,20 @@
 
 char *argv[] = { "sh", 0 };
 
+// ticks between two flushes of the filesystem caches
+#define SYNC_INTERVAL 500
+
+// Write back dirty filesystem state every SYNC_INTERVAL ticks, so that
+// writes reach the disk even if nobody calls sync.
+void
+update(void)
+{
+  for(;;){
+    sleep(SYNC_INTERVAL);
+    sync();
+  }
+}
+
 int
 main(void)
 {
@@ -19,6 +33,12 @@ main(void)
   dup(0);  // stdout
   dup(0);  // stderr
 
+  pid = fork();
+  if(pid < 0)
+    printf(1, "init: fork update failed\n");
+  if(pid == 0)
+    update();
+
   for(;;){
     printf(1, "init: starting sh\n");
     pid = fork();
@@ -1,6 +1,21 @@
 // Physical memory allocator, intended to allocate
 // memory for user processes, kernel stacks, page table pages,
 // and pipe buffers. Allocates 4096-byte pages.
+//
+// Once kinit2() has run, each CPU keeps a small cache of free
+// pages of its own. kalloc() and kfree() only take kmem.lock to
+// move KBATCH pages between a CPU's cache and the global list.
+// When both are empty, kalloc() takes back the pages cached by
+// the other CPUs before giving up.
+//
+// Pages can be shared by several page tables (copy-on-write fork),
+// so each page has a reference count. kalloc() returns a page with
+// one reference, kdup() adds one, and kfree() drops one and only
+// frees the page when none are left.
+//
+// sbrk() only reserves memory; the pages are allocated when first
+// touched. kreserve() keeps count of the pages promised that way,
+// so that sbrk() fails up front once they would exceed free memory.
 
 #include "types.h"
 #include "defs.h"
@@ -8,6 +23,7 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "spinlock.h"
+#include "proc.h"
 
 void freerange(void *vstart, void *vend);
 extern char end[]; // first address after kernel loaded from ELF file
@@ -17,12 +33,36 @@ struct run {
   struct run *next;
 };
 
+#define KBATCH   16          // pages moved per refill/drain
+#define KCACHEMAX (2*KBATCH) // most free pages a CPU may keep
+#define KSLACK   64          // free pages never promised by kreserve()
+
+// Per-CPU cache of free pages. Normally only its own CPU
+// uses it, so the lock is uncontended; it is there for
+// reclaim(). Lock order: kcpu lock, then kmem.lock.
+struct kcpu {
+  struct spinlock lock;
+  struct run *freelist;
+  int nfree;
+  uint nalloc;    // statistics
+  uint nkfree;
+  uint nrefill;
+  uint ndrain;
+};
+
 struct {
   struct spinlock lock;
   int use_lock;
   struct run *freelist;
+  int nfree;                  // pages on freelist
+  int nreserved;              // pages promised by kreserve()
+  struct kcpu cpu[NCPU];
+  struct spinlock reflock;
+  uchar ref[PHYSTOP/PGSIZE];  // at most one per process
 } kmem;
 
+#define KREF(v) kmem.ref[V2P(v)/PGSIZE]
+
 // Initialization happens in two phases.
 // 1. main() calls kinit1() while still using entrypgdir to place just
 // the pages mapped by entrypgdir on free list.
@@ -31,7 +71,12 @@ struct {
 void
 kinit1(void *vstart, void *vend)
 {
+  int i;
+
   initlock(&kmem.lock, "kmem");
+  for(i = 0; i < NCPU; i++)
+    initlock(&kmem.cpu[i].lock, "kcpu");
+  initlock(&kmem.reflock, "kref");
   kmem.use_lock = 0;
   freerange(vstart, vend);
 }
@@ -52,6 +97,57 @@ freerange(void *vstart, void *vend)
     kfree(p);
 }
 //PAGEBREAK: 21
+// Move up to n pages from the global free list to c.
+static void
+refill(struct kcpu *c, int n)
+{
+  struct run *r;
+
+  acquire(&kmem.lock);
+  while(n-- > 0 && (r = kmem.freelist) != 0){
+    kmem.freelist = r->next;
+    kmem.nfree--;
+    r->next = c->freelist;
+    c->freelist = r;
+    c->nfree++;
+  }
+  release(&kmem.lock);
+  c->nrefill++;
+}
+
+// Move n pages from c back to the global free list.
+static void
+drain(struct kcpu *c, int n)
+{
+  struct run *r;
+
+  acquire(&kmem.lock);
+  while(n-- > 0 && (r = c->freelist) != 0){
+    c->freelist = r->next;
+    c->nfree--;
+    r->next = kmem.freelist;
+    kmem.freelist = r;
+    kmem.nfree++;
+  }
+  release(&kmem.lock);
+  c->ndrain++;
+}
+
+// Move all pages cached by every CPU to the global free list.
+// Called with no kcpu lock held.
+static void
+reclaim(void)
+{
+  struct kcpu *c;
+
+  for(c = kmem.cpu; c < kmem.cpu + ncpu; c++){
+    acquire(&c->lock);
+    if(c->nfree > 0)
+      drain(c, c->nfree);
+    release(&c->lock);
+  }
+}
+
 // Free the page of physical memory pointed at by v,
 // which normally should have been returned by a
 // call to kalloc().  (The exception is when
@@ -60,20 +156,49 @@ void
 kfree(char *v)
 {
   struct run *r;
+  struct kcpu *c;
 
   if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
     panic("kfree");
 
+  // A count of one can't change under us: only holders of a
+  // reference take another one.
+  if(KREF(v) > 1){
+    acquire(&kmem.reflock);
+    if(--KREF(v) > 0){
+      release(&kmem.reflock);
+      return;
+    }
+    release(&kmem.reflock);
+  }
+  KREF(v) = 0;
+
+#ifdef KALLOC_JUNK
   // Fill with junk to catch dangling refs.
   memset(v, 1, PGSIZE);
+#endif
 
-  if(kmem.use_lock)
-    acquire(&kmem.lock);
   r = (struct run*)v;
-  r->next = kmem.freelist;
-  kmem.freelist = r;
-  if(kmem.use_lock)
-    release(&kmem.lock);
+
+  // Before kinit2() there is only one CPU and no lock.
+  if(!kmem.use_lock){
+    r->next = kmem.freelist;
+    kmem.freelist = r;
+    kmem.nfree++;
+    return;
+  }
+
+  pushcli();
+  c = &kmem.cpu[cpuid()];
+  acquire(&c->lock);
+  r->next = c->freelist;
+  c->freelist = r;
+  c->nfree++;
+  c->nkfree++;
+  if(c->nfree > KCACHEMAX)
+    drain(c, KBATCH);
+  release(&c->lock);
+  popcli();
 }
 
 // Allocate one 4096-byte page of physical memory.
@@ -83,14 +208,109 @@ char*
 kalloc(void)
 {
   struct run *r;
+  struct kcpu *c;
+  int tries;
+
+  if(!kmem.use_lock){
+    r = kmem.freelist;
+    if(r){
+      kmem.freelist = r->next;
+      kmem.nfree--;
+      KREF(r) = 1;
+    }
+    return (char*)r;
+  }
 
-  if(kmem.use_lock)
-    acquire(&kmem.lock);
-  r = kmem.freelist;
+  pushcli();
+  c = &kmem.cpu[cpuid()];
+  for(tries = 0; ; tries++){
+    acquire(&c->lock);
+    if(c->freelist == 0)
+      refill(c, KBATCH);
+    r = c->freelist;
+    if(r){
+      c->freelist = r->next;
+      c->nfree--;
+      c->nalloc++;
+    }
+    release(&c->lock);
+    if(r || tries == 1)
+      break;
+    // out of pages here -- other CPUs may still cache some
+    reclaim();
+  }
+  popcli();
   if(r)
-    kmem.freelist = r->next;
-  if(kmem.use_lock)
-    release(&kmem.lock);
+    KREF(r) = 1;
   return (char*)r;
 }
 
+// Take another reference to the page at v, which the caller
+// already holds a reference to.
+void
+kdup(char *v)
+{
+  if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP || KREF(v) == 0)
+    panic("kdup");
+
+  acquire(&kmem.reflock);
+  KREF(v)++;
+  release(&kmem.reflock);
+}
+
+// Return the number of references to the page at v.
+int
+krefs(char *v)
+{
+  return KREF(v);
+}
+
+// Promise n pages to a lazily grown heap. Returns 0, or -1
+// if that would leave fewer than KSLACK free pages unpromised.
+// The per-CPU counts are read without their locks; they are
+// only an estimate anyway.
+int
+kreserve(int n)
+{
+  int i, nfree;
+
+  acquire(&kmem.lock);
+  nfree = kmem.nfree;
+  for(i = 0; i < ncpu; i++)
+    nfree += kmem.cpu[i].nfree;
+  if(nfree - kmem.nreserved - n < KSLACK){
+    release(&kmem.lock);
+    return -1;
+  }
+  kmem.nreserved += n;
+  release(&kmem.lock);
+  return 0;
+}
+
+// Take back n pages promised by kreserve(), because they
+// have been allocated or are no longer needed.
+void
+kunreserve(int n)
+{
+  acquire(&kmem.lock);
+  kmem.nreserved -= n;
+  if(kmem.nreserved < 0)
+    panic("kunreserve");
+  release(&kmem.lock);
+}
+
+// Print per-CPU allocator statistics to the console.
+// Runs when user types ^K on console.
+// No lock: the numbers are only a snapshot.
+void
+kallocdump(void)
+{
+  struct kcpu *c;
+  int i;
+
+  for(i = 0; i < ncpu; i++){
+    c = &kmem.cpu[i];
+    cprintf("cpu%d: %d alloc, %d free, %d cached, %d refill, %d drain\n",
+            i, c->nalloc, c->nkfree, c->nfree, c->nrefill, c->ndrain);
+  }
+}
@@ -0,0 +1,1256 @@
+
+_kill:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char **argv)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	83 ec 10             	sub    $0x10,%esp
+  12:	89 cb                	mov    %ecx,%ebx
+  int i;
+
+  if(argc < 2){
+  14:	83 3b 01             	cmpl   $0x1,(%ebx)
+  17:	7f 17                	jg     30 <main+0x30>
+    printf(2, "usage: kill pid...\n");
+  19:	83 ec 08             	sub    $0x8,%esp
+  1c:	68 00 10 00 00       	push   $0x1000
+  21:	6a 02                	push   $0x2
+  23:	e8 22 05 00 00       	call   54a <printf>
+  28:	83 c4 10             	add    $0x10,%esp
+    exit();
+  2b:	e8 76 03 00 00       	call   3a6 <exit>
+  }
+  for(i=1; i<argc; i++)
+  30:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  37:	eb 2d                	jmp    66 <main+0x66>
+    kill(atoi(argv[i]));
+  39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  3c:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  43:	8b 43 04             	mov    0x4(%ebx),%eax
+  46:	01 d0                	add    %edx,%eax
+  48:	8b 00                	mov    (%eax),%eax
+  4a:	83 ec 0c             	sub    $0xc,%esp
+  4d:	50                   	push   %eax
+  4e:	e8 e4 01 00 00       	call   237 <atoi>
+  53:	83 c4 10             	add    $0x10,%esp
+  56:	83 ec 0c             	sub    $0xc,%esp
+  59:	50                   	push   %eax
+  5a:	e8 77 03 00 00       	call   3d6 <kill>
+  5f:	83 c4 10             	add    $0x10,%esp
+  for(i=1; i<argc; i++)
+  62:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  66:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  69:	3b 03                	cmp    (%ebx),%eax
+  6b:	7c cc                	jl     39 <main+0x39>
+  exit();
+  6d:	e8 34 03 00 00       	call   3a6 <exit>
+
+00000072 <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+  72:	55                   	push   %ebp
+  73:	89 e5                	mov    %esp,%ebp
+  75:	57                   	push   %edi
+  76:	53                   	push   %ebx
+    if(cc < 1)
+  77:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  7a:	8b 55 10             	mov    0x10(%ebp),%edx
+  7d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80:	89 cb                	mov    %ecx,%ebx
+  82:	89 df                	mov    %ebx,%edi
+  84:	89 d1                	mov    %edx,%ecx
+  86:	fc                   	cld
+  87:	f3 aa                	rep stos %al,%es:(%edi)
+  89:	89 ca                	mov    %ecx,%edx
+  8b:	89 fb                	mov    %edi,%ebx
+  8d:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  90:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+  93:	90                   	nop
+  94:	5b                   	pop    %ebx
+  95:	5f                   	pop    %edi
+  96:	5d                   	pop    %ebp
+  97:	c3                   	ret
+
+00000098 <strcpy>:
+{
+  98:	55                   	push   %ebp
+  99:	89 e5                	mov    %esp,%ebp
+  9b:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+  9e:	8b 45 08             	mov    0x8(%ebp),%eax
+  a1:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+  a4:	90                   	nop
+  a5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  a8:	8d 42 01             	lea    0x1(%edx),%eax
+  ab:	89 45 0c             	mov    %eax,0xc(%ebp)
+  ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  b1:	8d 48 01             	lea    0x1(%eax),%ecx
+  b4:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  b7:	0f b6 12             	movzbl (%edx),%edx
+  ba:	88 10                	mov    %dl,(%eax)
+  bc:	0f b6 00             	movzbl (%eax),%eax
+  bf:	84 c0                	test   %al,%al
+  c1:	75 e2                	jne    a5 <strcpy+0xd>
+  return os;
+  c3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  c6:	c9                   	leave
+  c7:	c3                   	ret
+
+000000c8 <strcmp>:
+{
+  c8:	55                   	push   %ebp
+  c9:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+  cb:	eb 08                	jmp    d5 <strcmp+0xd>
+    p++, q++;
+  cd:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  d1:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+  d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  d8:	0f b6 00             	movzbl (%eax),%eax
+  db:	84 c0                	test   %al,%al
+  dd:	74 10                	je     ef <strcmp+0x27>
+  df:	8b 45 08             	mov    0x8(%ebp),%eax
+  e2:	0f b6 10             	movzbl (%eax),%edx
+  e5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  e8:	0f b6 00             	movzbl (%eax),%eax
+  eb:	38 c2                	cmp    %al,%dl
+  ed:	74 de                	je     cd <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+  ef:	8b 45 08             	mov    0x8(%ebp),%eax
+  f2:	0f b6 00             	movzbl (%eax),%eax
+  f5:	0f b6 d0             	movzbl %al,%edx
+  f8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  fb:	0f b6 00             	movzbl (%eax),%eax
+  fe:	0f b6 c0             	movzbl %al,%eax
+ 101:	29 c2                	sub    %eax,%edx
+ 103:	89 d0                	mov    %edx,%eax
+}
+ 105:	5d                   	pop    %ebp
+ 106:	c3                   	ret
+
+00000107 <strlen>:
+{
+ 107:	55                   	push   %ebp
+ 108:	89 e5                	mov    %esp,%ebp
+ 10a:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 10d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 114:	eb 04                	jmp    11a <strlen+0x13>
+ 116:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 11a:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 11d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 120:	01 d0                	add    %edx,%eax
+ 122:	0f b6 00             	movzbl (%eax),%eax
+ 125:	84 c0                	test   %al,%al
+ 127:	75 ed                	jne    116 <strlen+0xf>
+  return n;
+ 129:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 12c:	c9                   	leave
+ 12d:	c3                   	ret
+
+0000012e <memset>:
+{
+ 12e:	55                   	push   %ebp
+ 12f:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 131:	8b 45 10             	mov    0x10(%ebp),%eax
+ 134:	50                   	push   %eax
+ 135:	ff 75 0c             	push   0xc(%ebp)
+ 138:	ff 75 08             	push   0x8(%ebp)
+ 13b:	e8 32 ff ff ff       	call   72 <stosb>
+ 140:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 143:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 146:	c9                   	leave
+ 147:	c3                   	ret
+
+00000148 <strchr>:
+{
+ 148:	55                   	push   %ebp
+ 149:	89 e5                	mov    %esp,%ebp
+ 14b:	83 ec 04             	sub    $0x4,%esp
+ 14e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 151:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 154:	eb 14                	jmp    16a <strchr+0x22>
+    if(*s == c)
+ 156:	8b 45 08             	mov    0x8(%ebp),%eax
+ 159:	0f b6 00             	movzbl (%eax),%eax
+ 15c:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 15f:	75 05                	jne    166 <strchr+0x1e>
+      return (char*)s;
+ 161:	8b 45 08             	mov    0x8(%ebp),%eax
+ 164:	eb 13                	jmp    179 <strchr+0x31>
+  for(; *s; s++)
+ 166:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 16a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 16d:	0f b6 00             	movzbl (%eax),%eax
+ 170:	84 c0                	test   %al,%al
+ 172:	75 e2                	jne    156 <strchr+0xe>
+  return 0;
+ 174:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 179:	c9                   	leave
+ 17a:	c3                   	ret
+
+0000017b <gets>:
+{
+ 17b:	55                   	push   %ebp
+ 17c:	89 e5                	mov    %esp,%ebp
+ 17e:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 181:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 188:	eb 42                	jmp    1cc <gets+0x51>
+    cc = read(0, &c, 1);
+ 18a:	83 ec 04             	sub    $0x4,%esp
+ 18d:	6a 01                	push   $0x1
+ 18f:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 192:	50                   	push   %eax
+ 193:	6a 00                	push   $0x0
+ 195:	e8 24 02 00 00       	call   3be <read>
+ 19a:	83 c4 10             	add    $0x10,%esp
+ 19d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 1a0:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 1a4:	7e 33                	jle    1d9 <gets+0x5e>
+    buf[i++] = c;
+ 1a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1a9:	8d 50 01             	lea    0x1(%eax),%edx
+ 1ac:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 1af:	89 c2                	mov    %eax,%edx
+ 1b1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b4:	01 c2                	add    %eax,%edx
+ 1b6:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1ba:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 1bc:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1c0:	3c 0a                	cmp    $0xa,%al
+ 1c2:	74 16                	je     1da <gets+0x5f>
+ 1c4:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1c8:	3c 0d                	cmp    $0xd,%al
+ 1ca:	74 0e                	je     1da <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 1cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1cf:	83 c0 01             	add    $0x1,%eax
+ 1d2:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 1d5:	7f b3                	jg     18a <gets+0xf>
+ 1d7:	eb 01                	jmp    1da <gets+0x5f>
+      break;
+ 1d9:	90                   	nop
+  }
+  buf[i] = '\0';
+ 1da:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 1dd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e0:	01 d0                	add    %edx,%eax
+ 1e2:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 1e5:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1e8:	c9                   	leave
+ 1e9:	c3                   	ret
+
+000001ea <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 1ea:	55                   	push   %ebp
+ 1eb:	89 e5                	mov    %esp,%ebp
+ 1ed:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1f0:	83 ec 08             	sub    $0x8,%esp
+ 1f3:	6a 00                	push   $0x0
+ 1f5:	ff 75 08             	push   0x8(%ebp)
+ 1f8:	e8 e9 01 00 00       	call   3e6 <open>
+ 1fd:	83 c4 10             	add    $0x10,%esp
+ 200:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 203:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 207:	79 07                	jns    210 <stat+0x26>
+    return -1;
+ 209:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 20e:	eb 25                	jmp    235 <stat+0x4b>
+  r = fstat(fd, st);
+ 210:	83 ec 08             	sub    $0x8,%esp
+ 213:	ff 75 0c             	push   0xc(%ebp)
+ 216:	ff 75 f4             	push   -0xc(%ebp)
+ 219:	e8 e0 01 00 00       	call   3fe <fstat>
+ 21e:	83 c4 10             	add    $0x10,%esp
+ 221:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 224:	83 ec 0c             	sub    $0xc,%esp
+ 227:	ff 75 f4             	push   -0xc(%ebp)
+ 22a:	e8 9f 01 00 00       	call   3ce <close>
+ 22f:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 232:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 235:	c9                   	leave
+ 236:	c3                   	ret
+
+00000237 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 237:	55                   	push   %ebp
+ 238:	89 e5                	mov    %esp,%ebp
+ 23a:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 23d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 244:	eb 25                	jmp    26b <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 246:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 249:	89 d0                	mov    %edx,%eax
+ 24b:	c1 e0 02             	shl    $0x2,%eax
+ 24e:	01 d0                	add    %edx,%eax
+ 250:	01 c0                	add    %eax,%eax
+ 252:	89 c1                	mov    %eax,%ecx
+ 254:	8b 45 08             	mov    0x8(%ebp),%eax
+ 257:	8d 50 01             	lea    0x1(%eax),%edx
+ 25a:	89 55 08             	mov    %edx,0x8(%ebp)
+ 25d:	0f b6 00             	movzbl (%eax),%eax
+ 260:	0f be c0             	movsbl %al,%eax
+ 263:	01 c8                	add    %ecx,%eax
+ 265:	83 e8 30             	sub    $0x30,%eax
+ 268:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 26b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 26e:	0f b6 00             	movzbl (%eax),%eax
+ 271:	3c 2f                	cmp    $0x2f,%al
+ 273:	7e 0a                	jle    27f <atoi+0x48>
+ 275:	8b 45 08             	mov    0x8(%ebp),%eax
+ 278:	0f b6 00             	movzbl (%eax),%eax
+ 27b:	3c 39                	cmp    $0x39,%al
+ 27d:	7e c7                	jle    246 <atoi+0xf>
+  return n;
+ 27f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 282:	c9                   	leave
+ 283:	c3                   	ret
+
+00000284 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 284:	55                   	push   %ebp
+ 285:	89 e5                	mov    %esp,%ebp
+ 287:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+
+  dst = vdst;
+ 28a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 28d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 290:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 293:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 296:	eb 17                	jmp    2af <memmove+0x2b>
+    *dst++ = *src++;
+ 298:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 29b:	8d 42 01             	lea    0x1(%edx),%eax
+ 29e:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 2a1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 2a4:	8d 48 01             	lea    0x1(%eax),%ecx
+ 2a7:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 2aa:	0f b6 12             	movzbl (%edx),%edx
+ 2ad:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 2af:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2b2:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 2b5:	89 55 10             	mov    %edx,0x10(%ebp)
+ 2b8:	85 c0                	test   %eax,%eax
+ 2ba:	7f dc                	jg     298 <memmove+0x14>
+  return vdst;
+ 2bc:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2bf:	c9                   	leave
+ 2c0:	c3                   	ret
+
+000002c1 <opendir>:
+    int fd;
+    int child;
+} DIR;
+
+DIR* opendir(const char* name)
+{
+ 2c1:	55                   	push   %ebp
+ 2c2:	89 e5                	mov    %esp,%ebp
+ 2c4:	83 ec 18             	sub    $0x18,%esp
+    DIR* dp = malloc(sizeof(*dp));
+ 2c7:	83 ec 0c             	sub    $0xc,%esp
+ 2ca:	6a 08                	push   $0x8
+ 2cc:	e8 4d 05 00 00       	call   81e <malloc>
+ 2d1:	83 c4 10             	add    $0x10,%esp
+ 2d4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+    dp->fd = open((char*)name, 0);
+ 2d7:	83 ec 08             	sub    $0x8,%esp
+ 2da:	6a 00                	push   $0x0
+ 2dc:	ff 75 08             	push   0x8(%ebp)
+ 2df:	e8 02 01 00 00       	call   3e6 <open>
+ 2e4:	83 c4 10             	add    $0x10,%esp
+ 2e7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 2ea:	89 02                	mov    %eax,(%edx)
+    dp->child = 0;
+ 2ec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2ef:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+
+    return dp;
+ 2f6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 2f9:	c9                   	leave
+ 2fa:	c3                   	ret
+
+000002fb <closedir>:
+
+void closedir(DIR* dp)
+{
+ 2fb:	55                   	push   %ebp
+ 2fc:	89 e5                	mov    %esp,%ebp
+ 2fe:	83 ec 08             	sub    $0x8,%esp
+    if(dp == 0) {
+ 301:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 305:	74 21                	je     328 <closedir+0x2d>
+        return;
+    }
+
+    close(dp->fd);
+ 307:	8b 45 08             	mov    0x8(%ebp),%eax
+ 30a:	8b 00                	mov    (%eax),%eax
+ 30c:	83 ec 0c             	sub    $0xc,%esp
+ 30f:	50                   	push   %eax
+ 310:	e8 b9 00 00 00       	call   3ce <close>
+ 315:	83 c4 10             	add    $0x10,%esp
+    free(dp);
+ 318:	83 ec 0c             	sub    $0xc,%esp
+ 31b:	ff 75 08             	push   0x8(%ebp)
+ 31e:	e8 b9 03 00 00       	call   6dc <free>
+ 323:	83 c4 10             	add    $0x10,%esp
+ 326:	eb 01                	jmp    329 <closedir+0x2e>
+        return;
+ 328:	90                   	nop
+}
+ 329:	c9                   	leave
+ 32a:	c3                   	ret
+
+0000032b <readdir>:
+
+struct dirent* readdir(DIR* dp)
+{
+ 32b:	55                   	push   %ebp
+ 32c:	89 e5                	mov    %esp,%ebp
+ 32e:	83 ec 18             	sub    $0x18,%esp
+    if(dp == 0) {
+ 331:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 335:	75 07                	jne    33e <readdir+0x13>
+      return 0;
+ 337:	b8 00 00 00 00       	mov    $0x0,%eax
+ 33c:	eb 5e                	jmp    39c <readdir+0x71>
+    }
+
+    struct dirent* de = malloc(sizeof(*de));
+ 33e:	83 ec 0c             	sub    $0xc,%esp
+ 341:	68 0c 01 00 00       	push   $0x10c
+ 346:	e8 d3 04 00 00       	call   81e <malloc>
+ 34b:	83 c4 10             	add    $0x10,%esp
+ 34e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    int res = direntry(dp->fd, dp->child, de);
+ 351:	8b 45 08             	mov    0x8(%ebp),%eax
+ 354:	8b 50 04             	mov    0x4(%eax),%edx
+ 357:	8b 45 08             	mov    0x8(%ebp),%eax
+ 35a:	8b 00                	mov    (%eax),%eax
+ 35c:	83 ec 04             	sub    $0x4,%esp
+ 35f:	ff 75 f4             	push   -0xc(%ebp)
+ 362:	52                   	push   %edx
+ 363:	50                   	push   %eax
+ 364:	e8 e5 00 00 00       	call   44e <direntry>
+ 369:	83 c4 10             	add    $0x10,%esp
+ 36c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+
+    // out of children or other error
+    if(res == -1) {
+ 36f:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+ 373:	75 15                	jne    38a <readdir+0x5f>
+        free(de);
+ 375:	83 ec 0c             	sub    $0xc,%esp
+ 378:	ff 75 f4             	push   -0xc(%ebp)
+ 37b:	e8 5c 03 00 00       	call   6dc <free>
+ 380:	83 c4 10             	add    $0x10,%esp
+        return 0;
+ 383:	b8 00 00 00 00       	mov    $0x0,%eax
+ 388:	eb 12                	jmp    39c <readdir+0x71>
+    }
+
+    dp->child++;
+ 38a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 38d:	8b 40 04             	mov    0x4(%eax),%eax
+ 390:	8d 50 01             	lea    0x1(%eax),%edx
+ 393:	8b 45 08             	mov    0x8(%ebp),%eax
+ 396:	89 50 04             	mov    %edx,0x4(%eax)
+    return de;
+ 399:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 39c:	c9                   	leave
+ 39d:	c3                   	ret
+
+0000039e <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 39e:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3a3:	cd 40                	int    $0x40
+ 3a5:	c3                   	ret
+
+000003a6 <exit>:
+SYSCALL(exit)
+ 3a6:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3ab:	cd 40                	int    $0x40
+ 3ad:	c3                   	ret
+
+000003ae <wait>:
+SYSCALL(wait)
+ 3ae:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3b3:	cd 40                	int    $0x40
+ 3b5:	c3                   	ret
+
+000003b6 <pipe>:
+SYSCALL(pipe)
+ 3b6:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3bb:	cd 40                	int    $0x40
+ 3bd:	c3                   	ret
+
+000003be <read>:
+SYSCALL(read)
+ 3be:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3c3:	cd 40                	int    $0x40
+ 3c5:	c3                   	ret
+
+000003c6 <write>:
+SYSCALL(write)
+ 3c6:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3cb:	cd 40                	int    $0x40
+ 3cd:	c3                   	ret
+
+000003ce <close>:
+SYSCALL(close)
+ 3ce:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3d3:	cd 40                	int    $0x40
+ 3d5:	c3                   	ret
+
+000003d6 <kill>:
+SYSCALL(kill)
+ 3d6:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3db:	cd 40                	int    $0x40
+ 3dd:	c3                   	ret
+
+000003de <exec>:
+SYSCALL(exec)
+ 3de:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3e3:	cd 40                	int    $0x40
+ 3e5:	c3                   	ret
+
+000003e6 <open>:
+SYSCALL(open)
+ 3e6:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3eb:	cd 40                	int    $0x40
+ 3ed:	c3                   	ret
+
+000003ee <mknod>:
+SYSCALL(mknod)
+ 3ee:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3f3:	cd 40                	int    $0x40
+ 3f5:	c3                   	ret
+
+000003f6 <unlink>:
+SYSCALL(unlink)
+ 3f6:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3fb:	cd 40                	int    $0x40
+ 3fd:	c3                   	ret
+
+000003fe <fstat>:
+SYSCALL(fstat)
+ 3fe:	b8 08 00 00 00       	mov    $0x8,%eax
+ 403:	cd 40                	int    $0x40
+ 405:	c3                   	ret
+
+00000406 <link>:
+SYSCALL(link)
+ 406:	b8 13 00 00 00       	mov    $0x13,%eax
+ 40b:	cd 40                	int    $0x40
+ 40d:	c3                   	ret
+
+0000040e <mkdir>:
+SYSCALL(mkdir)
+ 40e:	b8 14 00 00 00       	mov    $0x14,%eax
+ 413:	cd 40                	int    $0x40
+ 415:	c3                   	ret
+
+00000416 <chdir>:
+SYSCALL(chdir)
+ 416:	b8 09 00 00 00       	mov    $0x9,%eax
+ 41b:	cd 40                	int    $0x40
+ 41d:	c3                   	ret
+
+0000041e <dup>:
+SYSCALL(dup)
+ 41e:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 423:	cd 40                	int    $0x40
+ 425:	c3                   	ret
+
+00000426 <getpid>:
+SYSCALL(getpid)
+ 426:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 42b:	cd 40                	int    $0x40
+ 42d:	c3                   	ret
+
+0000042e <sbrk>:
+SYSCALL(sbrk)
+ 42e:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 433:	cd 40                	int    $0x40
+ 435:	c3                   	ret
+
+00000436 <sleep>:
+SYSCALL(sleep)
+ 436:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 43b:	cd 40                	int    $0x40
+ 43d:	c3                   	ret
+
+0000043e <uptime>:
+SYSCALL(uptime)
+ 43e:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 443:	cd 40                	int    $0x40
+ 445:	c3                   	ret
+
+00000446 <mount>:
+SYSCALL(mount)
+ 446:	b8 16 00 00 00       	mov    $0x16,%eax
+ 44b:	cd 40                	int    $0x40
+ 44d:	c3                   	ret
+
+0000044e <direntry>:
+SYSCALL(direntry)
+ 44e:	b8 17 00 00 00       	mov    $0x17,%eax
+ 453:	cd 40                	int    $0x40
+ 455:	c3                   	ret
+
+00000456 <sync>:
+SYSCALL(sync)
+ 456:	b8 18 00 00 00       	mov    $0x18,%eax
+ 45b:	cd 40                	int    $0x40
+ 45d:	c3                   	ret
+
+0000045e <fsync>:
+SYSCALL(fsync)
+ 45e:	b8 19 00 00 00       	mov    $0x19,%eax
+ 463:	cd 40                	int    $0x40
+ 465:	c3                   	ret
+
+00000466 <mmap>:
+SYSCALL(mmap)
+ 466:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 46b:	cd 40                	int    $0x40
+ 46d:	c3                   	ret
+
+0000046e <munmap>:
+SYSCALL(munmap)
+ 46e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 473:	cd 40                	int    $0x40
+ 475:	c3                   	ret
+
+00000476 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 476:	55                   	push   %ebp
+ 477:	89 e5                	mov    %esp,%ebp
+ 479:	83 ec 18             	sub    $0x18,%esp
+ 47c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 47f:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 482:	83 ec 04             	sub    $0x4,%esp
+ 485:	6a 01                	push   $0x1
+ 487:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 48a:	50                   	push   %eax
+ 48b:	ff 75 08             	push   0x8(%ebp)
+ 48e:	e8 33 ff ff ff       	call   3c6 <write>
+ 493:	83 c4 10             	add    $0x10,%esp
+}
+ 496:	90                   	nop
+ 497:	c9                   	leave
+ 498:	c3                   	ret
+
+00000499 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 499:	55                   	push   %ebp
+ 49a:	89 e5                	mov    %esp,%ebp
+ 49c:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 49f:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 4a6:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 4aa:	74 17                	je     4c3 <printint+0x2a>
+ 4ac:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 4b0:	79 11                	jns    4c3 <printint+0x2a>
+    neg = 1;
+ 4b2:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 4b9:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4bc:	f7 d8                	neg    %eax
+ 4be:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 4c1:	eb 06                	jmp    4c9 <printint+0x30>
+  } else {
+    x = xx;
+ 4c3:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4c6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 4c9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 4d0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 4d3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 4d6:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4db:	f7 f1                	div    %ecx
+ 4dd:	89 d1                	mov    %edx,%ecx
+ 4df:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4e2:	8d 50 01             	lea    0x1(%eax),%edx
+ 4e5:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 4e8:	0f b6 91 00 20 00 00 	movzbl 0x2000(%ecx),%edx
+ 4ef:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 4f3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 4f6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 4f9:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4fe:	f7 f1                	div    %ecx
+ 500:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 503:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 507:	75 c7                	jne    4d0 <printint+0x37>
+  if(neg)
+ 509:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 50d:	74 2d                	je     53c <printint+0xa3>
+    buf[i++] = '-';
+ 50f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 512:	8d 50 01             	lea    0x1(%eax),%edx
+ 515:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 518:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 51d:	eb 1d                	jmp    53c <printint+0xa3>
+    putc(fd, buf[i]);
+ 51f:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 522:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 525:	01 d0                	add    %edx,%eax
+ 527:	0f b6 00             	movzbl (%eax),%eax
+ 52a:	0f be c0             	movsbl %al,%eax
+ 52d:	83 ec 08             	sub    $0x8,%esp
+ 530:	50                   	push   %eax
+ 531:	ff 75 08             	push   0x8(%ebp)
+ 534:	e8 3d ff ff ff       	call   476 <putc>
+ 539:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 53c:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 540:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 544:	79 d9                	jns    51f <printint+0x86>
+}
+ 546:	90                   	nop
+ 547:	90                   	nop
+ 548:	c9                   	leave
+ 549:	c3                   	ret
+
+0000054a <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 54a:	55                   	push   %ebp
+ 54b:	89 e5                	mov    %esp,%ebp
+ 54d:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 550:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 557:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 55a:	83 c0 04             	add    $0x4,%eax
+ 55d:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 560:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 567:	e9 59 01 00 00       	jmp    6c5 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 56c:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 56f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 572:	01 d0                	add    %edx,%eax
+ 574:	0f b6 00             	movzbl (%eax),%eax
+ 577:	0f be c0             	movsbl %al,%eax
+ 57a:	25 ff 00 00 00       	and    $0xff,%eax
+ 57f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 582:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 586:	75 2c                	jne    5b4 <printf+0x6a>
+      if(c == '%'){
+ 588:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 58c:	75 0c                	jne    59a <printf+0x50>
+        state = '%';
+ 58e:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 595:	e9 27 01 00 00       	jmp    6c1 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 59a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 59d:	0f be c0             	movsbl %al,%eax
+ 5a0:	83 ec 08             	sub    $0x8,%esp
+ 5a3:	50                   	push   %eax
+ 5a4:	ff 75 08             	push   0x8(%ebp)
+ 5a7:	e8 ca fe ff ff       	call   476 <putc>
+ 5ac:	83 c4 10             	add    $0x10,%esp
+ 5af:	e9 0d 01 00 00       	jmp    6c1 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 5b4:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 5b8:	0f 85 03 01 00 00    	jne    6c1 <printf+0x177>
+      if(c == 'd'){
+ 5be:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 5c2:	75 1e                	jne    5e2 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 5c4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5c7:	8b 00                	mov    (%eax),%eax
+ 5c9:	6a 01                	push   $0x1
+ 5cb:	6a 0a                	push   $0xa
+ 5cd:	50                   	push   %eax
+ 5ce:	ff 75 08             	push   0x8(%ebp)
+ 5d1:	e8 c3 fe ff ff       	call   499 <printint>
+ 5d6:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 5d9:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 5dd:	e9 d8 00 00 00       	jmp    6ba <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 5e2:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 5e6:	74 06                	je     5ee <printf+0xa4>
+ 5e8:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 5ec:	75 1e                	jne    60c <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 5ee:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5f1:	8b 00                	mov    (%eax),%eax
+ 5f3:	6a 00                	push   $0x0
+ 5f5:	6a 10                	push   $0x10
+ 5f7:	50                   	push   %eax
+ 5f8:	ff 75 08             	push   0x8(%ebp)
+ 5fb:	e8 99 fe ff ff       	call   499 <printint>
+ 600:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 603:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 607:	e9 ae 00 00 00       	jmp    6ba <printf+0x170>
+      } else if(c == 's'){
+ 60c:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 610:	75 43                	jne    655 <printf+0x10b>
+        s = (char*)*ap;
+ 612:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 615:	8b 00                	mov    (%eax),%eax
+ 617:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 61a:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 61e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 622:	75 25                	jne    649 <printf+0xff>
+          s = "(null)";
+ 624:	c7 45 f4 14 10 00 00 	movl   $0x1014,-0xc(%ebp)
+        while(*s != 0){
+ 62b:	eb 1c                	jmp    649 <printf+0xff>
+          putc(fd, *s);
+ 62d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 630:	0f b6 00             	movzbl (%eax),%eax
+ 633:	0f be c0             	movsbl %al,%eax
+ 636:	83 ec 08             	sub    $0x8,%esp
+ 639:	50                   	push   %eax
+ 63a:	ff 75 08             	push   0x8(%ebp)
+ 63d:	e8 34 fe ff ff       	call   476 <putc>
+ 642:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 645:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 649:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 64c:	0f b6 00             	movzbl (%eax),%eax
+ 64f:	84 c0                	test   %al,%al
+ 651:	75 da                	jne    62d <printf+0xe3>
+ 653:	eb 65                	jmp    6ba <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 655:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 659:	75 1d                	jne    678 <printf+0x12e>
+        putc(fd, *ap);
+ 65b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 65e:	8b 00                	mov    (%eax),%eax
+ 660:	0f be c0             	movsbl %al,%eax
+ 663:	83 ec 08             	sub    $0x8,%esp
+ 666:	50                   	push   %eax
+ 667:	ff 75 08             	push   0x8(%ebp)
+ 66a:	e8 07 fe ff ff       	call   476 <putc>
+ 66f:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 672:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 676:	eb 42                	jmp    6ba <printf+0x170>
+      } else if(c == '%'){
+ 678:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 67c:	75 17                	jne    695 <printf+0x14b>
+        putc(fd, c);
+ 67e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 681:	0f be c0             	movsbl %al,%eax
+ 684:	83 ec 08             	sub    $0x8,%esp
+ 687:	50                   	push   %eax
+ 688:	ff 75 08             	push   0x8(%ebp)
+ 68b:	e8 e6 fd ff ff       	call   476 <putc>
+ 690:	83 c4 10             	add    $0x10,%esp
+ 693:	eb 25                	jmp    6ba <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 695:	83 ec 08             	sub    $0x8,%esp
+ 698:	6a 25                	push   $0x25
+ 69a:	ff 75 08             	push   0x8(%ebp)
+ 69d:	e8 d4 fd ff ff       	call   476 <putc>
+ 6a2:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 6a5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 6a8:	0f be c0             	movsbl %al,%eax
+ 6ab:	83 ec 08             	sub    $0x8,%esp
+ 6ae:	50                   	push   %eax
+ 6af:	ff 75 08             	push   0x8(%ebp)
+ 6b2:	e8 bf fd ff ff       	call   476 <putc>
+ 6b7:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 6ba:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 6c1:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 6c5:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 6c8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 6cb:	01 d0                	add    %edx,%eax
+ 6cd:	0f b6 00             	movzbl (%eax),%eax
+ 6d0:	84 c0                	test   %al,%al
+ 6d2:	0f 85 94 fe ff ff    	jne    56c <printf+0x22>
+    }
+  }
+}
+ 6d8:	90                   	nop
+ 6d9:	90                   	nop
+ 6da:	c9                   	leave
+ 6db:	c3                   	ret
+
+000006dc <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 6dc:	55                   	push   %ebp
+ 6dd:	89 e5                	mov    %esp,%ebp
+ 6df:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 6e2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6e5:	83 e8 08             	sub    $0x8,%eax
+ 6e8:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6eb:	a1 1c 20 00 00       	mov    0x201c,%eax
+ 6f0:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 6f3:	eb 24                	jmp    719 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6f5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6f8:	8b 00                	mov    (%eax),%eax
+ 6fa:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 6fd:	72 12                	jb     711 <free+0x35>
+ 6ff:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 702:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 705:	72 24                	jb     72b <free+0x4f>
+ 707:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 70a:	8b 00                	mov    (%eax),%eax
+ 70c:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 70f:	72 1a                	jb     72b <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 711:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 714:	8b 00                	mov    (%eax),%eax
+ 716:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 719:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 71c:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 71f:	73 d4                	jae    6f5 <free+0x19>
+ 721:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 724:	8b 00                	mov    (%eax),%eax
+ 726:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 729:	73 ca                	jae    6f5 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 72b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 72e:	8b 40 04             	mov    0x4(%eax),%eax
+ 731:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 738:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 73b:	01 c2                	add    %eax,%edx
+ 73d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 740:	8b 00                	mov    (%eax),%eax
+ 742:	39 c2                	cmp    %eax,%edx
+ 744:	75 24                	jne    76a <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 746:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 749:	8b 50 04             	mov    0x4(%eax),%edx
+ 74c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 74f:	8b 00                	mov    (%eax),%eax
+ 751:	8b 40 04             	mov    0x4(%eax),%eax
+ 754:	01 c2                	add    %eax,%edx
+ 756:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 759:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 75c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 75f:	8b 00                	mov    (%eax),%eax
+ 761:	8b 10                	mov    (%eax),%edx
+ 763:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 766:	89 10                	mov    %edx,(%eax)
+ 768:	eb 0a                	jmp    774 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 76a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 76d:	8b 10                	mov    (%eax),%edx
+ 76f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 772:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 774:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 777:	8b 40 04             	mov    0x4(%eax),%eax
+ 77a:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 781:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 784:	01 d0                	add    %edx,%eax
+ 786:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 789:	75 20                	jne    7ab <free+0xcf>
+    p->s.size += bp->s.size;
+ 78b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 78e:	8b 50 04             	mov    0x4(%eax),%edx
+ 791:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 794:	8b 40 04             	mov    0x4(%eax),%eax
+ 797:	01 c2                	add    %eax,%edx
+ 799:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 79c:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 79f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7a2:	8b 10                	mov    (%eax),%edx
+ 7a4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7a7:	89 10                	mov    %edx,(%eax)
+ 7a9:	eb 08                	jmp    7b3 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 7ab:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7ae:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 7b1:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 7b3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7b6:	a3 1c 20 00 00       	mov    %eax,0x201c
+}
+ 7bb:	90                   	nop
+ 7bc:	c9                   	leave
+ 7bd:	c3                   	ret
+
+000007be <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 7be:	55                   	push   %ebp
+ 7bf:	89 e5                	mov    %esp,%ebp
+ 7c1:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 7c4:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 7cb:	77 07                	ja     7d4 <morecore+0x16>
+    nu = 4096;
+ 7cd:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 7d4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7d7:	c1 e0 03             	shl    $0x3,%eax
+ 7da:	83 ec 0c             	sub    $0xc,%esp
+ 7dd:	50                   	push   %eax
+ 7de:	e8 4b fc ff ff       	call   42e <sbrk>
+ 7e3:	83 c4 10             	add    $0x10,%esp
+ 7e6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 7e9:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 7ed:	75 07                	jne    7f6 <morecore+0x38>
+    return 0;
+ 7ef:	b8 00 00 00 00       	mov    $0x0,%eax
+ 7f4:	eb 26                	jmp    81c <morecore+0x5e>
+  hp = (Header*)p;
+ 7f6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7f9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 7fc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7ff:	8b 55 08             	mov    0x8(%ebp),%edx
+ 802:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 805:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 808:	83 c0 08             	add    $0x8,%eax
+ 80b:	83 ec 0c             	sub    $0xc,%esp
+ 80e:	50                   	push   %eax
+ 80f:	e8 c8 fe ff ff       	call   6dc <free>
+ 814:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 817:	a1 1c 20 00 00       	mov    0x201c,%eax
+}
+ 81c:	c9                   	leave
+ 81d:	c3                   	ret
+
+0000081e <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 81e:	55                   	push   %ebp
+ 81f:	89 e5                	mov    %esp,%ebp
+ 821:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 824:	8b 45 08             	mov    0x8(%ebp),%eax
+ 827:	83 c0 07             	add    $0x7,%eax
+ 82a:	c1 e8 03             	shr    $0x3,%eax
+ 82d:	83 c0 01             	add    $0x1,%eax
+ 830:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 833:	a1 1c 20 00 00       	mov    0x201c,%eax
+ 838:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 83b:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 83f:	75 23                	jne    864 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 841:	c7 45 f0 14 20 00 00 	movl   $0x2014,-0x10(%ebp)
+ 848:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 84b:	a3 1c 20 00 00       	mov    %eax,0x201c
+ 850:	a1 1c 20 00 00       	mov    0x201c,%eax
+ 855:	a3 14 20 00 00       	mov    %eax,0x2014
+    base.s.size = 0;
+ 85a:	c7 05 18 20 00 00 00 	movl   $0x0,0x2018
+ 861:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 864:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 867:	8b 00                	mov    (%eax),%eax
+ 869:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 86c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 86f:	8b 40 04             	mov    0x4(%eax),%eax
+ 872:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 875:	72 4d                	jb     8c4 <malloc+0xa6>
+      if(p->s.size == nunits)
+ 877:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 87a:	8b 40 04             	mov    0x4(%eax),%eax
+ 87d:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 880:	75 0c                	jne    88e <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 882:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 885:	8b 10                	mov    (%eax),%edx
+ 887:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 88a:	89 10                	mov    %edx,(%eax)
+ 88c:	eb 26                	jmp    8b4 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 88e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 891:	8b 40 04             	mov    0x4(%eax),%eax
+ 894:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 897:	89 c2                	mov    %eax,%edx
+ 899:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 89c:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 89f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8a2:	8b 40 04             	mov    0x4(%eax),%eax
+ 8a5:	c1 e0 03             	shl    $0x3,%eax
+ 8a8:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 8ab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8ae:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 8b1:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 8b4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8b7:	a3 1c 20 00 00       	mov    %eax,0x201c
+      return (void*)(p + 1);
+ 8bc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8bf:	83 c0 08             	add    $0x8,%eax
+ 8c2:	eb 3b                	jmp    8ff <malloc+0xe1>
+    }
+    if(p == freep)
+ 8c4:	a1 1c 20 00 00       	mov    0x201c,%eax
+ 8c9:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 8cc:	75 1e                	jne    8ec <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 8ce:	83 ec 0c             	sub    $0xc,%esp
+ 8d1:	ff 75 ec             	push   -0x14(%ebp)
+ 8d4:	e8 e5 fe ff ff       	call   7be <morecore>
+ 8d9:	83 c4 10             	add    $0x10,%esp
+ 8dc:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 8df:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 8e3:	75 07                	jne    8ec <malloc+0xce>
+        return 0;
+ 8e5:	b8 00 00 00 00       	mov    $0x0,%eax
+ 8ea:	eb 13                	jmp    8ff <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8ec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8ef:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 8f2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8f5:	8b 00                	mov    (%eax),%eax
+ 8f7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 8fa:	e9 6d ff ff ff       	jmp    86c <malloc+0x4e>
+  }
+}
+ 8ff:	c9                   	leave
+ 900:	c3                   	ret
@@ -0,0 +1,1258 @@
+
+_ln:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	89 cb                	mov    %ecx,%ebx
+  if(argc != 3){
+  11:	83 3b 03             	cmpl   $0x3,(%ebx)
+  14:	74 17                	je     2d <main+0x2d>
+    printf(2, "Usage: ln old new\n");
+  16:	83 ec 08             	sub    $0x8,%esp
+  19:	68 00 10 00 00       	push   $0x1000
+  1e:	6a 02                	push   $0x2
+  20:	e8 27 05 00 00       	call   54c <printf>
+  25:	83 c4 10             	add    $0x10,%esp
+    exit();
+  28:	e8 7b 03 00 00       	call   3a8 <exit>
+  }
+  if(link(argv[1], argv[2]) < 0)
+  2d:	8b 43 04             	mov    0x4(%ebx),%eax
+  30:	83 c0 08             	add    $0x8,%eax
+  33:	8b 10                	mov    (%eax),%edx
+  35:	8b 43 04             	mov    0x4(%ebx),%eax
+  38:	83 c0 04             	add    $0x4,%eax
+  3b:	8b 00                	mov    (%eax),%eax
+  3d:	83 ec 08             	sub    $0x8,%esp
+  40:	52                   	push   %edx
+  41:	50                   	push   %eax
+  42:	e8 c1 03 00 00       	call   408 <link>
+  47:	83 c4 10             	add    $0x10,%esp
+  4a:	85 c0                	test   %eax,%eax
+  4c:	79 21                	jns    6f <main+0x6f>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  4e:	8b 43 04             	mov    0x4(%ebx),%eax
+  51:	83 c0 08             	add    $0x8,%eax
+  54:	8b 10                	mov    (%eax),%edx
+  56:	8b 43 04             	mov    0x4(%ebx),%eax
+  59:	83 c0 04             	add    $0x4,%eax
+  5c:	8b 00                	mov    (%eax),%eax
+  5e:	52                   	push   %edx
+  5f:	50                   	push   %eax
+  60:	68 13 10 00 00       	push   $0x1013
+  65:	6a 02                	push   $0x2
+  67:	e8 e0 04 00 00       	call   54c <printf>
+  6c:	83 c4 10             	add    $0x10,%esp
+  exit();
+  6f:	e8 34 03 00 00       	call   3a8 <exit>
+
+00000074 <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+  74:	55                   	push   %ebp
+  75:	89 e5                	mov    %esp,%ebp
+  77:	57                   	push   %edi
+  78:	53                   	push   %ebx
+    if(cc < 1)
+  79:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  7c:	8b 55 10             	mov    0x10(%ebp),%edx
+  7f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  82:	89 cb                	mov    %ecx,%ebx
+  84:	89 df                	mov    %ebx,%edi
+  86:	89 d1                	mov    %edx,%ecx
+  88:	fc                   	cld
+  89:	f3 aa                	rep stos %al,%es:(%edi)
+  8b:	89 ca                	mov    %ecx,%edx
+  8d:	89 fb                	mov    %edi,%ebx
+  8f:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  92:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+  95:	90                   	nop
+  96:	5b                   	pop    %ebx
+  97:	5f                   	pop    %edi
+  98:	5d                   	pop    %ebp
+  99:	c3                   	ret
+
+0000009a <strcpy>:
+{
+  9a:	55                   	push   %ebp
+  9b:	89 e5                	mov    %esp,%ebp
+  9d:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+  a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  a3:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+  a6:	90                   	nop
+  a7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  aa:	8d 42 01             	lea    0x1(%edx),%eax
+  ad:	89 45 0c             	mov    %eax,0xc(%ebp)
+  b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  b3:	8d 48 01             	lea    0x1(%eax),%ecx
+  b6:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  b9:	0f b6 12             	movzbl (%edx),%edx
+  bc:	88 10                	mov    %dl,(%eax)
+  be:	0f b6 00             	movzbl (%eax),%eax
+  c1:	84 c0                	test   %al,%al
+  c3:	75 e2                	jne    a7 <strcpy+0xd>
+  return os;
+  c5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  c8:	c9                   	leave
+  c9:	c3                   	ret
+
+000000ca <strcmp>:
+{
+  ca:	55                   	push   %ebp
+  cb:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+  cd:	eb 08                	jmp    d7 <strcmp+0xd>
+    p++, q++;
+  cf:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  d3:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+  d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  da:	0f b6 00             	movzbl (%eax),%eax
+  dd:	84 c0                	test   %al,%al
+  df:	74 10                	je     f1 <strcmp+0x27>
+  e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  e4:	0f b6 10             	movzbl (%eax),%edx
+  e7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  ea:	0f b6 00             	movzbl (%eax),%eax
+  ed:	38 c2                	cmp    %al,%dl
+  ef:	74 de                	je     cf <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+  f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  f4:	0f b6 00             	movzbl (%eax),%eax
+  f7:	0f b6 d0             	movzbl %al,%edx
+  fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  fd:	0f b6 00             	movzbl (%eax),%eax
+ 100:	0f b6 c0             	movzbl %al,%eax
+ 103:	29 c2                	sub    %eax,%edx
+ 105:	89 d0                	mov    %edx,%eax
+}
+ 107:	5d                   	pop    %ebp
+ 108:	c3                   	ret
+
+00000109 <strlen>:
+{
+ 109:	55                   	push   %ebp
+ 10a:	89 e5                	mov    %esp,%ebp
+ 10c:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 10f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 116:	eb 04                	jmp    11c <strlen+0x13>
+ 118:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 11c:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 11f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 122:	01 d0                	add    %edx,%eax
+ 124:	0f b6 00             	movzbl (%eax),%eax
+ 127:	84 c0                	test   %al,%al
+ 129:	75 ed                	jne    118 <strlen+0xf>
+  return n;
+ 12b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 12e:	c9                   	leave
+ 12f:	c3                   	ret
+
+00000130 <memset>:
+{
+ 130:	55                   	push   %ebp
+ 131:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 133:	8b 45 10             	mov    0x10(%ebp),%eax
+ 136:	50                   	push   %eax
+ 137:	ff 75 0c             	push   0xc(%ebp)
+ 13a:	ff 75 08             	push   0x8(%ebp)
+ 13d:	e8 32 ff ff ff       	call   74 <stosb>
+ 142:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 145:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 148:	c9                   	leave
+ 149:	c3                   	ret
+
+0000014a <strchr>:
+{
+ 14a:	55                   	push   %ebp
+ 14b:	89 e5                	mov    %esp,%ebp
+ 14d:	83 ec 04             	sub    $0x4,%esp
+ 150:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 153:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 156:	eb 14                	jmp    16c <strchr+0x22>
+    if(*s == c)
+ 158:	8b 45 08             	mov    0x8(%ebp),%eax
+ 15b:	0f b6 00             	movzbl (%eax),%eax
+ 15e:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 161:	75 05                	jne    168 <strchr+0x1e>
+      return (char*)s;
+ 163:	8b 45 08             	mov    0x8(%ebp),%eax
+ 166:	eb 13                	jmp    17b <strchr+0x31>
+  for(; *s; s++)
+ 168:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 16c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 16f:	0f b6 00             	movzbl (%eax),%eax
+ 172:	84 c0                	test   %al,%al
+ 174:	75 e2                	jne    158 <strchr+0xe>
+  return 0;
+ 176:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 17b:	c9                   	leave
+ 17c:	c3                   	ret
+
+0000017d <gets>:
+{
+ 17d:	55                   	push   %ebp
+ 17e:	89 e5                	mov    %esp,%ebp
+ 180:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 183:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 18a:	eb 42                	jmp    1ce <gets+0x51>
+    cc = read(0, &c, 1);
+ 18c:	83 ec 04             	sub    $0x4,%esp
+ 18f:	6a 01                	push   $0x1
+ 191:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 194:	50                   	push   %eax
+ 195:	6a 00                	push   $0x0
+ 197:	e8 24 02 00 00       	call   3c0 <read>
+ 19c:	83 c4 10             	add    $0x10,%esp
+ 19f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 1a2:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 1a6:	7e 33                	jle    1db <gets+0x5e>
+    buf[i++] = c;
+ 1a8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1ab:	8d 50 01             	lea    0x1(%eax),%edx
+ 1ae:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 1b1:	89 c2                	mov    %eax,%edx
+ 1b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b6:	01 c2                	add    %eax,%edx
+ 1b8:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1bc:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 1be:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1c2:	3c 0a                	cmp    $0xa,%al
+ 1c4:	74 16                	je     1dc <gets+0x5f>
+ 1c6:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1ca:	3c 0d                	cmp    $0xd,%al
+ 1cc:	74 0e                	je     1dc <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 1ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1d1:	83 c0 01             	add    $0x1,%eax
+ 1d4:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 1d7:	7f b3                	jg     18c <gets+0xf>
+ 1d9:	eb 01                	jmp    1dc <gets+0x5f>
+      break;
+ 1db:	90                   	nop
+  }
+  buf[i] = '\0';
+ 1dc:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 1df:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e2:	01 d0                	add    %edx,%eax
+ 1e4:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 1e7:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1ea:	c9                   	leave
+ 1eb:	c3                   	ret
+
+000001ec <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 1ec:	55                   	push   %ebp
+ 1ed:	89 e5                	mov    %esp,%ebp
+ 1ef:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1f2:	83 ec 08             	sub    $0x8,%esp
+ 1f5:	6a 00                	push   $0x0
+ 1f7:	ff 75 08             	push   0x8(%ebp)
+ 1fa:	e8 e9 01 00 00       	call   3e8 <open>
+ 1ff:	83 c4 10             	add    $0x10,%esp
+ 202:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 205:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 209:	79 07                	jns    212 <stat+0x26>
+    return -1;
+ 20b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 210:	eb 25                	jmp    237 <stat+0x4b>
+  r = fstat(fd, st);
+ 212:	83 ec 08             	sub    $0x8,%esp
+ 215:	ff 75 0c             	push   0xc(%ebp)
+ 218:	ff 75 f4             	push   -0xc(%ebp)
+ 21b:	e8 e0 01 00 00       	call   400 <fstat>
+ 220:	83 c4 10             	add    $0x10,%esp
+ 223:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 226:	83 ec 0c             	sub    $0xc,%esp
+ 229:	ff 75 f4             	push   -0xc(%ebp)
+ 22c:	e8 9f 01 00 00       	call   3d0 <close>
+ 231:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 234:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 237:	c9                   	leave
+ 238:	c3                   	ret
+
+00000239 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 239:	55                   	push   %ebp
+ 23a:	89 e5                	mov    %esp,%ebp
+ 23c:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 23f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 246:	eb 25                	jmp    26d <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 248:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 24b:	89 d0                	mov    %edx,%eax
+ 24d:	c1 e0 02             	shl    $0x2,%eax
+ 250:	01 d0                	add    %edx,%eax
+ 252:	01 c0                	add    %eax,%eax
+ 254:	89 c1                	mov    %eax,%ecx
+ 256:	8b 45 08             	mov    0x8(%ebp),%eax
+ 259:	8d 50 01             	lea    0x1(%eax),%edx
+ 25c:	89 55 08             	mov    %edx,0x8(%ebp)
+ 25f:	0f b6 00             	movzbl (%eax),%eax
+ 262:	0f be c0             	movsbl %al,%eax
+ 265:	01 c8                	add    %ecx,%eax
+ 267:	83 e8 30             	sub    $0x30,%eax
+ 26a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 26d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 270:	0f b6 00             	movzbl (%eax),%eax
+ 273:	3c 2f                	cmp    $0x2f,%al
+ 275:	7e 0a                	jle    281 <atoi+0x48>
+ 277:	8b 45 08             	mov    0x8(%ebp),%eax
+ 27a:	0f b6 00             	movzbl (%eax),%eax
+ 27d:	3c 39                	cmp    $0x39,%al
+ 27f:	7e c7                	jle    248 <atoi+0xf>
+  return n;
+ 281:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 284:	c9                   	leave
+ 285:	c3                   	ret
+
+00000286 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 286:	55                   	push   %ebp
+ 287:	89 e5                	mov    %esp,%ebp
+ 289:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+
+  dst = vdst;
+ 28c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 28f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 292:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 295:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 298:	eb 17                	jmp    2b1 <memmove+0x2b>
+    *dst++ = *src++;
+ 29a:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 29d:	8d 42 01             	lea    0x1(%edx),%eax
+ 2a0:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 2a3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 2a6:	8d 48 01             	lea    0x1(%eax),%ecx
+ 2a9:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 2ac:	0f b6 12             	movzbl (%edx),%edx
+ 2af:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 2b1:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2b4:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 2b7:	89 55 10             	mov    %edx,0x10(%ebp)
+ 2ba:	85 c0                	test   %eax,%eax
+ 2bc:	7f dc                	jg     29a <memmove+0x14>
+  return vdst;
+ 2be:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2c1:	c9                   	leave
+ 2c2:	c3                   	ret
+
+000002c3 <opendir>:
+    int fd;
+    int child;
+} DIR;
+
+DIR* opendir(const char* name)
+{
+ 2c3:	55                   	push   %ebp
+ 2c4:	89 e5                	mov    %esp,%ebp
+ 2c6:	83 ec 18             	sub    $0x18,%esp
+    DIR* dp = malloc(sizeof(*dp));
+ 2c9:	83 ec 0c             	sub    $0xc,%esp
+ 2cc:	6a 08                	push   $0x8
+ 2ce:	e8 4d 05 00 00       	call   820 <malloc>
+ 2d3:	83 c4 10             	add    $0x10,%esp
+ 2d6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+    dp->fd = open((char*)name, 0);
+ 2d9:	83 ec 08             	sub    $0x8,%esp
+ 2dc:	6a 00                	push   $0x0
+ 2de:	ff 75 08             	push   0x8(%ebp)
+ 2e1:	e8 02 01 00 00       	call   3e8 <open>
+ 2e6:	83 c4 10             	add    $0x10,%esp
+ 2e9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 2ec:	89 02                	mov    %eax,(%edx)
+    dp->child = 0;
+ 2ee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2f1:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+
+    return dp;
+ 2f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 2fb:	c9                   	leave
+ 2fc:	c3                   	ret
+
+000002fd <closedir>:
+
+void closedir(DIR* dp)
+{
+ 2fd:	55                   	push   %ebp
+ 2fe:	89 e5                	mov    %esp,%ebp
+ 300:	83 ec 08             	sub    $0x8,%esp
+    if(dp == 0) {
+ 303:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 307:	74 21                	je     32a <closedir+0x2d>
+        return;
+    }
+
+    close(dp->fd);
+ 309:	8b 45 08             	mov    0x8(%ebp),%eax
+ 30c:	8b 00                	mov    (%eax),%eax
+ 30e:	83 ec 0c             	sub    $0xc,%esp
+ 311:	50                   	push   %eax
+ 312:	e8 b9 00 00 00       	call   3d0 <close>
+ 317:	83 c4 10             	add    $0x10,%esp
+    free(dp);
+ 31a:	83 ec 0c             	sub    $0xc,%esp
+ 31d:	ff 75 08             	push   0x8(%ebp)
+ 320:	e8 b9 03 00 00       	call   6de <free>
+ 325:	83 c4 10             	add    $0x10,%esp
+ 328:	eb 01                	jmp    32b <closedir+0x2e>
+        return;
+ 32a:	90                   	nop
+}
+ 32b:	c9                   	leave
+ 32c:	c3                   	ret
+
+0000032d <readdir>:
+
+struct dirent* readdir(DIR* dp)
+{
+ 32d:	55                   	push   %ebp
+ 32e:	89 e5                	mov    %esp,%ebp
+ 330:	83 ec 18             	sub    $0x18,%esp
+    if(dp == 0) {
+ 333:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 337:	75 07                	jne    340 <readdir+0x13>
+      return 0;
+ 339:	b8 00 00 00 00       	mov    $0x0,%eax
+ 33e:	eb 5e                	jmp    39e <readdir+0x71>
+    }
+
+    struct dirent* de = malloc(sizeof(*de));
+ 340:	83 ec 0c             	sub    $0xc,%esp
+ 343:	68 0c 01 00 00       	push   $0x10c
+ 348:	e8 d3 04 00 00       	call   820 <malloc>
+ 34d:	83 c4 10             	add    $0x10,%esp
+ 350:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    int res = direntry(dp->fd, dp->child, de);
+ 353:	8b 45 08             	mov    0x8(%ebp),%eax
+ 356:	8b 50 04             	mov    0x4(%eax),%edx
+ 359:	8b 45 08             	mov    0x8(%ebp),%eax
+ 35c:	8b 00                	mov    (%eax),%eax
+ 35e:	83 ec 04             	sub    $0x4,%esp
+ 361:	ff 75 f4             	push   -0xc(%ebp)
+ 364:	52                   	push   %edx
+ 365:	50                   	push   %eax
+ 366:	e8 e5 00 00 00       	call   450 <direntry>
+ 36b:	83 c4 10             	add    $0x10,%esp
+ 36e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+
+    // out of children or other error
+    if(res == -1) {
+ 371:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+ 375:	75 15                	jne    38c <readdir+0x5f>
+        free(de);
+ 377:	83 ec 0c             	sub    $0xc,%esp
+ 37a:	ff 75 f4             	push   -0xc(%ebp)
+ 37d:	e8 5c 03 00 00       	call   6de <free>
+ 382:	83 c4 10             	add    $0x10,%esp
+        return 0;
+ 385:	b8 00 00 00 00       	mov    $0x0,%eax
+ 38a:	eb 12                	jmp    39e <readdir+0x71>
+    }
+
+    dp->child++;
+ 38c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 38f:	8b 40 04             	mov    0x4(%eax),%eax
+ 392:	8d 50 01             	lea    0x1(%eax),%edx
+ 395:	8b 45 08             	mov    0x8(%ebp),%eax
+ 398:	89 50 04             	mov    %edx,0x4(%eax)
+    return de;
+ 39b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 39e:	c9                   	leave
+ 39f:	c3                   	ret
+
+000003a0 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 3a0:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3a5:	cd 40                	int    $0x40
+ 3a7:	c3                   	ret
+
+000003a8 <exit>:
+SYSCALL(exit)
+ 3a8:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3ad:	cd 40                	int    $0x40
+ 3af:	c3                   	ret
+
+000003b0 <wait>:
+SYSCALL(wait)
+ 3b0:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3b5:	cd 40                	int    $0x40
+ 3b7:	c3                   	ret
+
+000003b8 <pipe>:
+SYSCALL(pipe)
+ 3b8:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3bd:	cd 40                	int    $0x40
+ 3bf:	c3                   	ret
+
+000003c0 <read>:
+SYSCALL(read)
+ 3c0:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3c5:	cd 40                	int    $0x40
+ 3c7:	c3                   	ret
+
+000003c8 <write>:
+SYSCALL(write)
+ 3c8:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3cd:	cd 40                	int    $0x40
+ 3cf:	c3                   	ret
+
+000003d0 <close>:
+SYSCALL(close)
+ 3d0:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3d5:	cd 40                	int    $0x40
+ 3d7:	c3                   	ret
+
+000003d8 <kill>:
+SYSCALL(kill)
+ 3d8:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3dd:	cd 40                	int    $0x40
+ 3df:	c3                   	ret
+
+000003e0 <exec>:
+SYSCALL(exec)
+ 3e0:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3e5:	cd 40                	int    $0x40
+ 3e7:	c3                   	ret
+
+000003e8 <open>:
+SYSCALL(open)
+ 3e8:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3ed:	cd 40                	int    $0x40
+ 3ef:	c3                   	ret
+
+000003f0 <mknod>:
+SYSCALL(mknod)
+ 3f0:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3f5:	cd 40                	int    $0x40
+ 3f7:	c3                   	ret
+
+000003f8 <unlink>:
+SYSCALL(unlink)
+ 3f8:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3fd:	cd 40                	int    $0x40
+ 3ff:	c3                   	ret
+
+00000400 <fstat>:
+SYSCALL(fstat)
+ 400:	b8 08 00 00 00       	mov    $0x8,%eax
+ 405:	cd 40                	int    $0x40
+ 407:	c3                   	ret
+
+00000408 <link>:
+SYSCALL(link)
+ 408:	b8 13 00 00 00       	mov    $0x13,%eax
+ 40d:	cd 40                	int    $0x40
+ 40f:	c3                   	ret
+
+00000410 <mkdir>:
+SYSCALL(mkdir)
+ 410:	b8 14 00 00 00       	mov    $0x14,%eax
+ 415:	cd 40                	int    $0x40
+ 417:	c3                   	ret
+
+00000418 <chdir>:
+SYSCALL(chdir)
+ 418:	b8 09 00 00 00       	mov    $0x9,%eax
+ 41d:	cd 40                	int    $0x40
+ 41f:	c3                   	ret
+
+00000420 <dup>:
+SYSCALL(dup)
+ 420:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 425:	cd 40                	int    $0x40
+ 427:	c3                   	ret
+
+00000428 <getpid>:
+SYSCALL(getpid)
+ 428:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 42d:	cd 40                	int    $0x40
+ 42f:	c3                   	ret
+
+00000430 <sbrk>:
+SYSCALL(sbrk)
+ 430:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 435:	cd 40                	int    $0x40
+ 437:	c3                   	ret
+
+00000438 <sleep>:
+SYSCALL(sleep)
+ 438:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 43d:	cd 40                	int    $0x40
+ 43f:	c3                   	ret
+
+00000440 <uptime>:
+SYSCALL(uptime)
+ 440:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 445:	cd 40                	int    $0x40
+ 447:	c3                   	ret
+
+00000448 <mount>:
+SYSCALL(mount)
+ 448:	b8 16 00 00 00       	mov    $0x16,%eax
+ 44d:	cd 40                	int    $0x40
+ 44f:	c3                   	ret
+
+00000450 <direntry>:
+SYSCALL(direntry)
+ 450:	b8 17 00 00 00       	mov    $0x17,%eax
+ 455:	cd 40                	int    $0x40
+ 457:	c3                   	ret
+
+00000458 <sync>:
+SYSCALL(sync)
+ 458:	b8 18 00 00 00       	mov    $0x18,%eax
+ 45d:	cd 40                	int    $0x40
+ 45f:	c3                   	ret
+
+00000460 <fsync>:
+SYSCALL(fsync)
+ 460:	b8 19 00 00 00       	mov    $0x19,%eax
+ 465:	cd 40                	int    $0x40
+ 467:	c3                   	ret
+
+00000468 <mmap>:
+SYSCALL(mmap)
+ 468:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 46d:	cd 40                	int    $0x40
+ 46f:	c3                   	ret
+
+00000470 <munmap>:
+SYSCALL(munmap)
+ 470:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 475:	cd 40                	int    $0x40
+ 477:	c3                   	ret
+
+00000478 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 478:	55                   	push   %ebp
+ 479:	89 e5                	mov    %esp,%ebp
+ 47b:	83 ec 18             	sub    $0x18,%esp
+ 47e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 481:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 484:	83 ec 04             	sub    $0x4,%esp
+ 487:	6a 01                	push   $0x1
+ 489:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 48c:	50                   	push   %eax
+ 48d:	ff 75 08             	push   0x8(%ebp)
+ 490:	e8 33 ff ff ff       	call   3c8 <write>
+ 495:	83 c4 10             	add    $0x10,%esp
+}
+ 498:	90                   	nop
+ 499:	c9                   	leave
+ 49a:	c3                   	ret
+
+0000049b <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 49b:	55                   	push   %ebp
+ 49c:	89 e5                	mov    %esp,%ebp
+ 49e:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 4a1:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 4a8:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 4ac:	74 17                	je     4c5 <printint+0x2a>
+ 4ae:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 4b2:	79 11                	jns    4c5 <printint+0x2a>
+    neg = 1;
+ 4b4:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 4bb:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4be:	f7 d8                	neg    %eax
+ 4c0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 4c3:	eb 06                	jmp    4cb <printint+0x30>
+  } else {
+    x = xx;
+ 4c5:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4c8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 4cb:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 4d2:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 4d5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 4d8:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4dd:	f7 f1                	div    %ecx
+ 4df:	89 d1                	mov    %edx,%ecx
+ 4e1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4e4:	8d 50 01             	lea    0x1(%eax),%edx
+ 4e7:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 4ea:	0f b6 91 00 20 00 00 	movzbl 0x2000(%ecx),%edx
+ 4f1:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 4f5:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 4f8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 4fb:	ba 00 00 00 00       	mov    $0x0,%edx
+ 500:	f7 f1                	div    %ecx
+ 502:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 505:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 509:	75 c7                	jne    4d2 <printint+0x37>
+  if(neg)
+ 50b:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 50f:	74 2d                	je     53e <printint+0xa3>
+    buf[i++] = '-';
+ 511:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 514:	8d 50 01             	lea    0x1(%eax),%edx
+ 517:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 51a:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 51f:	eb 1d                	jmp    53e <printint+0xa3>
+    putc(fd, buf[i]);
+ 521:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 524:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 527:	01 d0                	add    %edx,%eax
+ 529:	0f b6 00             	movzbl (%eax),%eax
+ 52c:	0f be c0             	movsbl %al,%eax
+ 52f:	83 ec 08             	sub    $0x8,%esp
+ 532:	50                   	push   %eax
+ 533:	ff 75 08             	push   0x8(%ebp)
+ 536:	e8 3d ff ff ff       	call   478 <putc>
+ 53b:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 53e:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 542:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 546:	79 d9                	jns    521 <printint+0x86>
+}
+ 548:	90                   	nop
+ 549:	90                   	nop
+ 54a:	c9                   	leave
+ 54b:	c3                   	ret
+
+0000054c <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 54c:	55                   	push   %ebp
+ 54d:	89 e5                	mov    %esp,%ebp
+ 54f:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 552:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 559:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 55c:	83 c0 04             	add    $0x4,%eax
+ 55f:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 562:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 569:	e9 59 01 00 00       	jmp    6c7 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 56e:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 571:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 574:	01 d0                	add    %edx,%eax
+ 576:	0f b6 00             	movzbl (%eax),%eax
+ 579:	0f be c0             	movsbl %al,%eax
+ 57c:	25 ff 00 00 00       	and    $0xff,%eax
+ 581:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 584:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 588:	75 2c                	jne    5b6 <printf+0x6a>
+      if(c == '%'){
+ 58a:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 58e:	75 0c                	jne    59c <printf+0x50>
+        state = '%';
+ 590:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 597:	e9 27 01 00 00       	jmp    6c3 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 59c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 59f:	0f be c0             	movsbl %al,%eax
+ 5a2:	83 ec 08             	sub    $0x8,%esp
+ 5a5:	50                   	push   %eax
+ 5a6:	ff 75 08             	push   0x8(%ebp)
+ 5a9:	e8 ca fe ff ff       	call   478 <putc>
+ 5ae:	83 c4 10             	add    $0x10,%esp
+ 5b1:	e9 0d 01 00 00       	jmp    6c3 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 5b6:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 5ba:	0f 85 03 01 00 00    	jne    6c3 <printf+0x177>
+      if(c == 'd'){
+ 5c0:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 5c4:	75 1e                	jne    5e4 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 5c6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5c9:	8b 00                	mov    (%eax),%eax
+ 5cb:	6a 01                	push   $0x1
+ 5cd:	6a 0a                	push   $0xa
+ 5cf:	50                   	push   %eax
+ 5d0:	ff 75 08             	push   0x8(%ebp)
+ 5d3:	e8 c3 fe ff ff       	call   49b <printint>
+ 5d8:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 5db:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 5df:	e9 d8 00 00 00       	jmp    6bc <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 5e4:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 5e8:	74 06                	je     5f0 <printf+0xa4>
+ 5ea:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 5ee:	75 1e                	jne    60e <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 5f0:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5f3:	8b 00                	mov    (%eax),%eax
+ 5f5:	6a 00                	push   $0x0
+ 5f7:	6a 10                	push   $0x10
+ 5f9:	50                   	push   %eax
+ 5fa:	ff 75 08             	push   0x8(%ebp)
+ 5fd:	e8 99 fe ff ff       	call   49b <printint>
+ 602:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 605:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 609:	e9 ae 00 00 00       	jmp    6bc <printf+0x170>
+      } else if(c == 's'){
+ 60e:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 612:	75 43                	jne    657 <printf+0x10b>
+        s = (char*)*ap;
+ 614:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 617:	8b 00                	mov    (%eax),%eax
+ 619:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 61c:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 620:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 624:	75 25                	jne    64b <printf+0xff>
+          s = "(null)";
+ 626:	c7 45 f4 27 10 00 00 	movl   $0x1027,-0xc(%ebp)
+        while(*s != 0){
+ 62d:	eb 1c                	jmp    64b <printf+0xff>
+          putc(fd, *s);
+ 62f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 632:	0f b6 00             	movzbl (%eax),%eax
+ 635:	0f be c0             	movsbl %al,%eax
+ 638:	83 ec 08             	sub    $0x8,%esp
+ 63b:	50                   	push   %eax
+ 63c:	ff 75 08             	push   0x8(%ebp)
+ 63f:	e8 34 fe ff ff       	call   478 <putc>
+ 644:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 647:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 64b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 64e:	0f b6 00             	movzbl (%eax),%eax
+ 651:	84 c0                	test   %al,%al
+ 653:	75 da                	jne    62f <printf+0xe3>
+ 655:	eb 65                	jmp    6bc <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 657:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 65b:	75 1d                	jne    67a <printf+0x12e>
+        putc(fd, *ap);
+ 65d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 660:	8b 00                	mov    (%eax),%eax
+ 662:	0f be c0             	movsbl %al,%eax
+ 665:	83 ec 08             	sub    $0x8,%esp
+ 668:	50                   	push   %eax
+ 669:	ff 75 08             	push   0x8(%ebp)
+ 66c:	e8 07 fe ff ff       	call   478 <putc>
+ 671:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 674:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 678:	eb 42                	jmp    6bc <printf+0x170>
+      } else if(c == '%'){
+ 67a:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 67e:	75 17                	jne    697 <printf+0x14b>
+        putc(fd, c);
+ 680:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 683:	0f be c0             	movsbl %al,%eax
+ 686:	83 ec 08             	sub    $0x8,%esp
+ 689:	50                   	push   %eax
+ 68a:	ff 75 08             	push   0x8(%ebp)
+ 68d:	e8 e6 fd ff ff       	call   478 <putc>
+ 692:	83 c4 10             	add    $0x10,%esp
+ 695:	eb 25                	jmp    6bc <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 697:	83 ec 08             	sub    $0x8,%esp
+ 69a:	6a 25                	push   $0x25
+ 69c:	ff 75 08             	push   0x8(%ebp)
+ 69f:	e8 d4 fd ff ff       	call   478 <putc>
+ 6a4:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 6a7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 6aa:	0f be c0             	movsbl %al,%eax
+ 6ad:	83 ec 08             	sub    $0x8,%esp
+ 6b0:	50                   	push   %eax
+ 6b1:	ff 75 08             	push   0x8(%ebp)
+ 6b4:	e8 bf fd ff ff       	call   478 <putc>
+ 6b9:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 6bc:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 6c3:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 6c7:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 6ca:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 6cd:	01 d0                	add    %edx,%eax
+ 6cf:	0f b6 00             	movzbl (%eax),%eax
+ 6d2:	84 c0                	test   %al,%al
+ 6d4:	0f 85 94 fe ff ff    	jne    56e <printf+0x22>
+    }
+  }
+}
+ 6da:	90                   	nop
+ 6db:	90                   	nop
+ 6dc:	c9                   	leave
+ 6dd:	c3                   	ret
+
+000006de <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 6de:	55                   	push   %ebp
+ 6df:	89 e5                	mov    %esp,%ebp
+ 6e1:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 6e4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6e7:	83 e8 08             	sub    $0x8,%eax
+ 6ea:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6ed:	a1 1c 20 00 00       	mov    0x201c,%eax
+ 6f2:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 6f5:	eb 24                	jmp    71b <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6f7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6fa:	8b 00                	mov    (%eax),%eax
+ 6fc:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 6ff:	72 12                	jb     713 <free+0x35>
+ 701:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 704:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 707:	72 24                	jb     72d <free+0x4f>
+ 709:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 70c:	8b 00                	mov    (%eax),%eax
+ 70e:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 711:	72 1a                	jb     72d <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 713:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 716:	8b 00                	mov    (%eax),%eax
+ 718:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 71b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 71e:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 721:	73 d4                	jae    6f7 <free+0x19>
+ 723:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 726:	8b 00                	mov    (%eax),%eax
+ 728:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 72b:	73 ca                	jae    6f7 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 72d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 730:	8b 40 04             	mov    0x4(%eax),%eax
+ 733:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 73a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 73d:	01 c2                	add    %eax,%edx
+ 73f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 742:	8b 00                	mov    (%eax),%eax
+ 744:	39 c2                	cmp    %eax,%edx
+ 746:	75 24                	jne    76c <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 748:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 74b:	8b 50 04             	mov    0x4(%eax),%edx
+ 74e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 751:	8b 00                	mov    (%eax),%eax
+ 753:	8b 40 04             	mov    0x4(%eax),%eax
+ 756:	01 c2                	add    %eax,%edx
+ 758:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 75b:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 75e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 761:	8b 00                	mov    (%eax),%eax
+ 763:	8b 10                	mov    (%eax),%edx
+ 765:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 768:	89 10                	mov    %edx,(%eax)
+ 76a:	eb 0a                	jmp    776 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 76c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 76f:	8b 10                	mov    (%eax),%edx
+ 771:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 774:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 776:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 779:	8b 40 04             	mov    0x4(%eax),%eax
+ 77c:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 783:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 786:	01 d0                	add    %edx,%eax
+ 788:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 78b:	75 20                	jne    7ad <free+0xcf>
+    p->s.size += bp->s.size;
+ 78d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 790:	8b 50 04             	mov    0x4(%eax),%edx
+ 793:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 796:	8b 40 04             	mov    0x4(%eax),%eax
+ 799:	01 c2                	add    %eax,%edx
+ 79b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 79e:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 7a1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7a4:	8b 10                	mov    (%eax),%edx
+ 7a6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7a9:	89 10                	mov    %edx,(%eax)
+ 7ab:	eb 08                	jmp    7b5 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 7ad:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7b0:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 7b3:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 7b5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7b8:	a3 1c 20 00 00       	mov    %eax,0x201c
+}
+ 7bd:	90                   	nop
+ 7be:	c9                   	leave
+ 7bf:	c3                   	ret
+
+000007c0 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 7c0:	55                   	push   %ebp
+ 7c1:	89 e5                	mov    %esp,%ebp
+ 7c3:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 7c6:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 7cd:	77 07                	ja     7d6 <morecore+0x16>
+    nu = 4096;
+ 7cf:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 7d6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7d9:	c1 e0 03             	shl    $0x3,%eax
+ 7dc:	83 ec 0c             	sub    $0xc,%esp
+ 7df:	50                   	push   %eax
+ 7e0:	e8 4b fc ff ff       	call   430 <sbrk>
+ 7e5:	83 c4 10             	add    $0x10,%esp
+ 7e8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 7eb:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 7ef:	75 07                	jne    7f8 <morecore+0x38>
+    return 0;
+ 7f1:	b8 00 00 00 00       	mov    $0x0,%eax
+ 7f6:	eb 26                	jmp    81e <morecore+0x5e>
+  hp = (Header*)p;
+ 7f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7fb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 7fe:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 801:	8b 55 08             	mov    0x8(%ebp),%edx
+ 804:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 807:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 80a:	83 c0 08             	add    $0x8,%eax
+ 80d:	83 ec 0c             	sub    $0xc,%esp
+ 810:	50                   	push   %eax
+ 811:	e8 c8 fe ff ff       	call   6de <free>
+ 816:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 819:	a1 1c 20 00 00       	mov    0x201c,%eax
+}
+ 81e:	c9                   	leave
+ 81f:	c3                   	ret
+
+00000820 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 820:	55                   	push   %ebp
+ 821:	89 e5                	mov    %esp,%ebp
+ 823:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 826:	8b 45 08             	mov    0x8(%ebp),%eax
+ 829:	83 c0 07             	add    $0x7,%eax
+ 82c:	c1 e8 03             	shr    $0x3,%eax
+ 82f:	83 c0 01             	add    $0x1,%eax
+ 832:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 835:	a1 1c 20 00 00       	mov    0x201c,%eax
+ 83a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 83d:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 841:	75 23                	jne    866 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 843:	c7 45 f0 14 20 00 00 	movl   $0x2014,-0x10(%ebp)
+ 84a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 84d:	a3 1c 20 00 00       	mov    %eax,0x201c
+ 852:	a1 1c 20 00 00       	mov    0x201c,%eax
+ 857:	a3 14 20 00 00       	mov    %eax,0x2014
+    base.s.size = 0;
+ 85c:	c7 05 18 20 00 00 00 	movl   $0x0,0x2018
+ 863:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 866:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 869:	8b 00                	mov    (%eax),%eax
+ 86b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 86e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 871:	8b 40 04             	mov    0x4(%eax),%eax
+ 874:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 877:	72 4d                	jb     8c6 <malloc+0xa6>
+      if(p->s.size == nunits)
+ 879:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 87c:	8b 40 04             	mov    0x4(%eax),%eax
+ 87f:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 882:	75 0c                	jne    890 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 884:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 887:	8b 10                	mov    (%eax),%edx
+ 889:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 88c:	89 10                	mov    %edx,(%eax)
+ 88e:	eb 26                	jmp    8b6 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 890:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 893:	8b 40 04             	mov    0x4(%eax),%eax
+ 896:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 899:	89 c2                	mov    %eax,%edx
+ 89b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 89e:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 8a1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8a4:	8b 40 04             	mov    0x4(%eax),%eax
+ 8a7:	c1 e0 03             	shl    $0x3,%eax
+ 8aa:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 8ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8b0:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 8b3:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 8b6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8b9:	a3 1c 20 00 00       	mov    %eax,0x201c
+      return (void*)(p + 1);
+ 8be:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8c1:	83 c0 08             	add    $0x8,%eax
+ 8c4:	eb 3b                	jmp    901 <malloc+0xe1>
+    }
+    if(p == freep)
+ 8c6:	a1 1c 20 00 00       	mov    0x201c,%eax
+ 8cb:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 8ce:	75 1e                	jne    8ee <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 8d0:	83 ec 0c             	sub    $0xc,%esp
+ 8d3:	ff 75 ec             	push   -0x14(%ebp)
+ 8d6:	e8 e5 fe ff ff       	call   7c0 <morecore>
+ 8db:	83 c4 10             	add    $0x10,%esp
+ 8de:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 8e1:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 8e5:	75 07                	jne    8ee <malloc+0xce>
+        return 0;
+ 8e7:	b8 00 00 00 00       	mov    $0x0,%eax
+ 8ec:	eb 13                	jmp    901 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8ee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8f1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 8f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8f7:	8b 00                	mov    (%eax),%eax
+ 8f9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 8fc:	e9 6d ff ff ff       	jmp    86e <malloc+0x4e>
+  }
+}
+ 901:	c9                   	leave
+ 902:	c3                   	ret
@@ -0,0 +1,1511 @@
+
+_ls:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <fmtname>:
+
+#define DIRSIZ 14
+
+char*
+fmtname(char *path)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	53                   	push   %ebx
+   4:	83 ec 14             	sub    $0x14,%esp
+  static char buf[DIRSIZ+1];
+  char *p;
+
+  // Find first character after last slash.
+  for(p=path+strlen(path); p >= path && *p != '/'; p--)
+   7:	83 ec 0c             	sub    $0xc,%esp
+   a:	ff 75 08             	push   0x8(%ebp)
+   d:	e8 3e 03 00 00       	call   350 <strlen>
+  12:	83 c4 10             	add    $0x10,%esp
+  15:	8b 55 08             	mov    0x8(%ebp),%edx
+  18:	01 d0                	add    %edx,%eax
+  1a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  1d:	eb 04                	jmp    23 <fmtname+0x23>
+  1f:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+  23:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  26:	3b 45 08             	cmp    0x8(%ebp),%eax
+  29:	72 0a                	jb     35 <fmtname+0x35>
+  2b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  2e:	0f b6 00             	movzbl (%eax),%eax
+  31:	3c 2f                	cmp    $0x2f,%al
+  33:	75 ea                	jne    1f <fmtname+0x1f>
+    ;
+  p++;
+  35:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+
+  // Return blank-padded name.
+  if(strlen(p) >= DIRSIZ)
+  39:	83 ec 0c             	sub    $0xc,%esp
+  3c:	ff 75 f4             	push   -0xc(%ebp)
+  3f:	e8 0c 03 00 00       	call   350 <strlen>
+  44:	83 c4 10             	add    $0x10,%esp
+  47:	83 f8 0d             	cmp    $0xd,%eax
+  4a:	76 05                	jbe    51 <fmtname+0x51>
+    return p;
+  4c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  4f:	eb 60                	jmp    b1 <fmtname+0xb1>
+  memmove(buf, p, strlen(p));
+  51:	83 ec 0c             	sub    $0xc,%esp
+  54:	ff 75 f4             	push   -0xc(%ebp)
+  57:	e8 f4 02 00 00       	call   350 <strlen>
+  5c:	83 c4 10             	add    $0x10,%esp
+  5f:	83 ec 04             	sub    $0x4,%esp
+  62:	50                   	push   %eax
+  63:	ff 75 f4             	push   -0xc(%ebp)
+  66:	68 14 20 00 00       	push   $0x2014
+  6b:	e8 5d 04 00 00       	call   4cd <memmove>
+  70:	83 c4 10             	add    $0x10,%esp
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+  73:	83 ec 0c             	sub    $0xc,%esp
+  76:	ff 75 f4             	push   -0xc(%ebp)
+  79:	e8 d2 02 00 00       	call   350 <strlen>
+  7e:	83 c4 10             	add    $0x10,%esp
+  81:	ba 0e 00 00 00       	mov    $0xe,%edx
+  86:	89 d3                	mov    %edx,%ebx
+  88:	29 c3                	sub    %eax,%ebx
+  8a:	83 ec 0c             	sub    $0xc,%esp
+  8d:	ff 75 f4             	push   -0xc(%ebp)
+  90:	e8 bb 02 00 00       	call   350 <strlen>
+  95:	83 c4 10             	add    $0x10,%esp
+  98:	05 14 20 00 00       	add    $0x2014,%eax
+  9d:	83 ec 04             	sub    $0x4,%esp
+  a0:	53                   	push   %ebx
+  a1:	6a 20                	push   $0x20
+  a3:	50                   	push   %eax
+  a4:	e8 ce 02 00 00       	call   377 <memset>
+  a9:	83 c4 10             	add    $0x10,%esp
+  return buf;
+  ac:	b8 14 20 00 00       	mov    $0x2014,%eax
+}
+  b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  b4:	c9                   	leave
+  b5:	c3                   	ret
+
+000000b6 <ls>:
+
+void
+ls(char *path)
+{
+  b6:	55                   	push   %ebp
+  b7:	89 e5                	mov    %esp,%ebp
+  b9:	57                   	push   %edi
+  ba:	56                   	push   %esi
+  bb:	53                   	push   %ebx
+  bc:	81 ec 2c 02 00 00    	sub    $0x22c,%esp
+  char buf[512];//, *p;
+  int fd;
+  struct stat st;
+
+  if((fd = open(path, 0)) < 0){
+  c2:	83 ec 08             	sub    $0x8,%esp
+  c5:	6a 00                	push   $0x0
+  c7:	ff 75 08             	push   0x8(%ebp)
+  ca:	e8 60 05 00 00       	call   62f <open>
+  cf:	83 c4 10             	add    $0x10,%esp
+  d2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  d5:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  d9:	79 1a                	jns    f5 <ls+0x3f>
+    printf(2, "ls: cannot open %s\n", path);
+  db:	83 ec 04             	sub    $0x4,%esp
+  de:	ff 75 08             	push   0x8(%ebp)
+  e1:	68 00 10 00 00       	push   $0x1000
+  e6:	6a 02                	push   $0x2
+  e8:	e8 a6 06 00 00       	call   793 <printf>
+  ed:	83 c4 10             	add    $0x10,%esp
+    return;
+  f0:	e9 5a 01 00 00       	jmp    24f <ls+0x199>
+  }
+
+  if(fstat(fd, &st) < 0){
+  f5:	83 ec 08             	sub    $0x8,%esp
+  f8:	8d 85 c8 fd ff ff    	lea    -0x238(%ebp),%eax
+  fe:	50                   	push   %eax
+  ff:	ff 75 e4             	push   -0x1c(%ebp)
+ 102:	e8 40 05 00 00       	call   647 <fstat>
+ 107:	83 c4 10             	add    $0x10,%esp
+ 10a:	85 c0                	test   %eax,%eax
+ 10c:	79 28                	jns    136 <ls+0x80>
+    printf(2, "ls: cannot stat %s\n", path);
+ 10e:	83 ec 04             	sub    $0x4,%esp
+ 111:	ff 75 08             	push   0x8(%ebp)
+ 114:	68 14 10 00 00       	push   $0x1014
+ 119:	6a 02                	push   $0x2
+ 11b:	e8 73 06 00 00       	call   793 <printf>
+ 120:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+ 123:	83 ec 0c             	sub    $0xc,%esp
+ 126:	ff 75 e4             	push   -0x1c(%ebp)
+ 129:	e8 e9 04 00 00       	call   617 <close>
+ 12e:	83 c4 10             	add    $0x10,%esp
+    return;
+ 131:	e9 19 01 00 00       	jmp    24f <ls+0x199>
+  }
+
+  switch(st.type){
+ 136:	0f b7 85 c8 fd ff ff 	movzwl -0x238(%ebp),%eax
+ 13d:	98                   	cwtl
+ 13e:	83 f8 01             	cmp    $0x1,%eax
+ 141:	74 48                	je     18b <ls+0xd5>
+ 143:	83 f8 02             	cmp    $0x2,%eax
+ 146:	0f 85 f5 00 00 00    	jne    241 <ls+0x18b>
+  case T_FILE:
+    printf(1, "%s %d %d %d\n", fmtname(path), st.type, st.ino, st.size);
+ 14c:	8b bd d8 fd ff ff    	mov    -0x228(%ebp),%edi
+ 152:	8b b5 d0 fd ff ff    	mov    -0x230(%ebp),%esi
+ 158:	0f b7 85 c8 fd ff ff 	movzwl -0x238(%ebp),%eax
+ 15f:	0f bf d8             	movswl %ax,%ebx
+ 162:	83 ec 0c             	sub    $0xc,%esp
+ 165:	ff 75 08             	push   0x8(%ebp)
+ 168:	e8 93 fe ff ff       	call   0 <fmtname>
+ 16d:	83 c4 10             	add    $0x10,%esp
+ 170:	83 ec 08             	sub    $0x8,%esp
+ 173:	57                   	push   %edi
+ 174:	56                   	push   %esi
+ 175:	53                   	push   %ebx
+ 176:	50                   	push   %eax
+ 177:	68 28 10 00 00       	push   $0x1028
+ 17c:	6a 01                	push   $0x1
+ 17e:	e8 10 06 00 00       	call   793 <printf>
+ 183:	83 c4 20             	add    $0x20,%esp
+    break;
+ 186:	e9 b6 00 00 00       	jmp    241 <ls+0x18b>
+
+  case T_DIR:
+    if(strlen(path) + 1 + DIRSIZ + 1 > sizeof buf){
+ 18b:	83 ec 0c             	sub    $0xc,%esp
+ 18e:	ff 75 08             	push   0x8(%ebp)
+ 191:	e8 ba 01 00 00       	call   350 <strlen>
+ 196:	83 c4 10             	add    $0x10,%esp
+ 199:	83 c0 10             	add    $0x10,%eax
+ 19c:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 1a1:	76 17                	jbe    1ba <ls+0x104>
+      printf(1, "ls: path too long\n");
+ 1a3:	83 ec 08             	sub    $0x8,%esp
+ 1a6:	68 35 10 00 00       	push   $0x1035
+ 1ab:	6a 01                	push   $0x1
+ 1ad:	e8 e1 05 00 00       	call   793 <printf>
+ 1b2:	83 c4 10             	add    $0x10,%esp
+      break;
+ 1b5:	e9 87 00 00 00       	jmp    241 <ls+0x18b>
+    }
+
+    DIR* dp = opendir(path);
+ 1ba:	83 ec 0c             	sub    $0xc,%esp
+ 1bd:	ff 75 08             	push   0x8(%ebp)
+ 1c0:	e8 45 03 00 00       	call   50a <opendir>
+ 1c5:	83 c4 10             	add    $0x10,%esp
+ 1c8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    struct dirent* de = 0;
+ 1cb:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+
+    while((de = readdir(dp))) {
+ 1d2:	eb 47                	jmp    21b <ls+0x165>
+      printf(1, "%s %d %d %d\n", fmtname(de->name), de->type, de->ino, de->size);
+ 1d4:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ 1d7:	8b 78 04             	mov    0x4(%eax),%edi
+ 1da:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ 1dd:	8b 30                	mov    (%eax),%esi
+ 1df:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ 1e2:	8b 58 08             	mov    0x8(%eax),%ebx
+ 1e5:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ 1e8:	83 c0 0c             	add    $0xc,%eax
+ 1eb:	83 ec 0c             	sub    $0xc,%esp
+ 1ee:	50                   	push   %eax
+ 1ef:	e8 0c fe ff ff       	call   0 <fmtname>
+ 1f4:	83 c4 10             	add    $0x10,%esp
+ 1f7:	83 ec 08             	sub    $0x8,%esp
+ 1fa:	57                   	push   %edi
+ 1fb:	56                   	push   %esi
+ 1fc:	53                   	push   %ebx
+ 1fd:	50                   	push   %eax
+ 1fe:	68 28 10 00 00       	push   $0x1028
+ 203:	6a 01                	push   $0x1
+ 205:	e8 89 05 00 00       	call   793 <printf>
+ 20a:	83 c4 20             	add    $0x20,%esp
+      free(de);
+ 20d:	83 ec 0c             	sub    $0xc,%esp
+ 210:	ff 75 dc             	push   -0x24(%ebp)
+ 213:	e8 0d 07 00 00       	call   925 <free>
+ 218:	83 c4 10             	add    $0x10,%esp
+    while((de = readdir(dp))) {
+ 21b:	83 ec 0c             	sub    $0xc,%esp
+ 21e:	ff 75 e0             	push   -0x20(%ebp)
+ 221:	e8 4e 03 00 00       	call   574 <readdir>
+ 226:	83 c4 10             	add    $0x10,%esp
+ 229:	89 45 dc             	mov    %eax,-0x24(%ebp)
+ 22c:	83 7d dc 00          	cmpl   $0x0,-0x24(%ebp)
+ 230:	75 a2                	jne    1d4 <ls+0x11e>
+    }
+
+    closedir(dp);
+ 232:	83 ec 0c             	sub    $0xc,%esp
+ 235:	ff 75 e0             	push   -0x20(%ebp)
+ 238:	e8 07 03 00 00       	call   544 <closedir>
+ 23d:	83 c4 10             	add    $0x10,%esp
+    break;
+ 240:	90                   	nop
+  }
+  
+  close(fd);
+ 241:	83 ec 0c             	sub    $0xc,%esp
+ 244:	ff 75 e4             	push   -0x1c(%ebp)
+ 247:	e8 cb 03 00 00       	call   617 <close>
+ 24c:	83 c4 10             	add    $0x10,%esp
+}
+ 24f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 252:	5b                   	pop    %ebx
+ 253:	5e                   	pop    %esi
+ 254:	5f                   	pop    %edi
+ 255:	5d                   	pop    %ebp
+ 256:	c3                   	ret
+
+00000257 <main>:
+
+int
+main(int argc, char *argv[])
+{
+ 257:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+ 25b:	83 e4 f0             	and    $0xfffffff0,%esp
+ 25e:	ff 71 fc             	push   -0x4(%ecx)
+ 261:	55                   	push   %ebp
+ 262:	89 e5                	mov    %esp,%ebp
+ 264:	53                   	push   %ebx
+ 265:	51                   	push   %ecx
+ 266:	83 ec 10             	sub    $0x10,%esp
+ 269:	89 cb                	mov    %ecx,%ebx
+  int i;
+
+  if(argc < 2){
+ 26b:	83 3b 01             	cmpl   $0x1,(%ebx)
+ 26e:	7f 15                	jg     285 <main+0x2e>
+    ls(".");
+ 270:	83 ec 0c             	sub    $0xc,%esp
+ 273:	68 48 10 00 00       	push   $0x1048
+ 278:	e8 39 fe ff ff       	call   b6 <ls>
+ 27d:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 280:	e8 6a 03 00 00       	call   5ef <exit>
+  }
+  for(i=1; i<argc; i++)
+ 285:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+ 28c:	eb 21                	jmp    2af <main+0x58>
+    ls(argv[i]);
+ 28e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 291:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 298:	8b 43 04             	mov    0x4(%ebx),%eax
+ 29b:	01 d0                	add    %edx,%eax
+ 29d:	8b 00                	mov    (%eax),%eax
+ 29f:	83 ec 0c             	sub    $0xc,%esp
+ 2a2:	50                   	push   %eax
+ 2a3:	e8 0e fe ff ff       	call   b6 <ls>
+ 2a8:	83 c4 10             	add    $0x10,%esp
+  for(i=1; i<argc; i++)
+ 2ab:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 2af:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2b2:	3b 03                	cmp    (%ebx),%eax
+ 2b4:	7c d8                	jl     28e <main+0x37>
+  exit();
+ 2b6:	e8 34 03 00 00       	call   5ef <exit>
+
+000002bb <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 2bb:	55                   	push   %ebp
+ 2bc:	89 e5                	mov    %esp,%ebp
+ 2be:	57                   	push   %edi
+ 2bf:	53                   	push   %ebx
+    if(cc < 1)
+ 2c0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 2c3:	8b 55 10             	mov    0x10(%ebp),%edx
+ 2c6:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2c9:	89 cb                	mov    %ecx,%ebx
+ 2cb:	89 df                	mov    %ebx,%edi
+ 2cd:	89 d1                	mov    %edx,%ecx
+ 2cf:	fc                   	cld
+ 2d0:	f3 aa                	rep stos %al,%es:(%edi)
+ 2d2:	89 ca                	mov    %ecx,%edx
+ 2d4:	89 fb                	mov    %edi,%ebx
+ 2d6:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 2d9:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+ 2dc:	90                   	nop
+ 2dd:	5b                   	pop    %ebx
+ 2de:	5f                   	pop    %edi
+ 2df:	5d                   	pop    %ebp
+ 2e0:	c3                   	ret
+
+000002e1 <strcpy>:
+{
+ 2e1:	55                   	push   %ebp
+ 2e2:	89 e5                	mov    %esp,%ebp
+ 2e4:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 2e7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2ea:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 2ed:	90                   	nop
+ 2ee:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 2f1:	8d 42 01             	lea    0x1(%edx),%eax
+ 2f4:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 2f7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2fa:	8d 48 01             	lea    0x1(%eax),%ecx
+ 2fd:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 300:	0f b6 12             	movzbl (%edx),%edx
+ 303:	88 10                	mov    %dl,(%eax)
+ 305:	0f b6 00             	movzbl (%eax),%eax
+ 308:	84 c0                	test   %al,%al
+ 30a:	75 e2                	jne    2ee <strcpy+0xd>
+  return os;
+ 30c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 30f:	c9                   	leave
+ 310:	c3                   	ret
+
+00000311 <strcmp>:
+{
+ 311:	55                   	push   %ebp
+ 312:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 314:	eb 08                	jmp    31e <strcmp+0xd>
+    p++, q++;
+ 316:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 31a:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 31e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 321:	0f b6 00             	movzbl (%eax),%eax
+ 324:	84 c0                	test   %al,%al
+ 326:	74 10                	je     338 <strcmp+0x27>
+ 328:	8b 45 08             	mov    0x8(%ebp),%eax
+ 32b:	0f b6 10             	movzbl (%eax),%edx
+ 32e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 331:	0f b6 00             	movzbl (%eax),%eax
+ 334:	38 c2                	cmp    %al,%dl
+ 336:	74 de                	je     316 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 338:	8b 45 08             	mov    0x8(%ebp),%eax
+ 33b:	0f b6 00             	movzbl (%eax),%eax
+ 33e:	0f b6 d0             	movzbl %al,%edx
+ 341:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 344:	0f b6 00             	movzbl (%eax),%eax
+ 347:	0f b6 c0             	movzbl %al,%eax
+ 34a:	29 c2                	sub    %eax,%edx
+ 34c:	89 d0                	mov    %edx,%eax
+}
+ 34e:	5d                   	pop    %ebp
+ 34f:	c3                   	ret
+
+00000350 <strlen>:
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 356:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 35d:	eb 04                	jmp    363 <strlen+0x13>
+ 35f:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 363:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 366:	8b 45 08             	mov    0x8(%ebp),%eax
+ 369:	01 d0                	add    %edx,%eax
+ 36b:	0f b6 00             	movzbl (%eax),%eax
+ 36e:	84 c0                	test   %al,%al
+ 370:	75 ed                	jne    35f <strlen+0xf>
+  return n;
+ 372:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 375:	c9                   	leave
+ 376:	c3                   	ret
+
+00000377 <memset>:
+{
+ 377:	55                   	push   %ebp
+ 378:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 37a:	8b 45 10             	mov    0x10(%ebp),%eax
+ 37d:	50                   	push   %eax
+ 37e:	ff 75 0c             	push   0xc(%ebp)
+ 381:	ff 75 08             	push   0x8(%ebp)
+ 384:	e8 32 ff ff ff       	call   2bb <stosb>
+ 389:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 38c:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 38f:	c9                   	leave
+ 390:	c3                   	ret
+
+00000391 <strchr>:
+{
+ 391:	55                   	push   %ebp
+ 392:	89 e5                	mov    %esp,%ebp
+ 394:	83 ec 04             	sub    $0x4,%esp
+ 397:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 39a:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 39d:	eb 14                	jmp    3b3 <strchr+0x22>
+    if(*s == c)
+ 39f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3a2:	0f b6 00             	movzbl (%eax),%eax
+ 3a5:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 3a8:	75 05                	jne    3af <strchr+0x1e>
+      return (char*)s;
+ 3aa:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3ad:	eb 13                	jmp    3c2 <strchr+0x31>
+  for(; *s; s++)
+ 3af:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 3b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3b6:	0f b6 00             	movzbl (%eax),%eax
+ 3b9:	84 c0                	test   %al,%al
+ 3bb:	75 e2                	jne    39f <strchr+0xe>
+  return 0;
+ 3bd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 3c2:	c9                   	leave
+ 3c3:	c3                   	ret
+
+000003c4 <gets>:
+{
+ 3c4:	55                   	push   %ebp
+ 3c5:	89 e5                	mov    %esp,%ebp
+ 3c7:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 3ca:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 3d1:	eb 42                	jmp    415 <gets+0x51>
+    cc = read(0, &c, 1);
+ 3d3:	83 ec 04             	sub    $0x4,%esp
+ 3d6:	6a 01                	push   $0x1
+ 3d8:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 3db:	50                   	push   %eax
+ 3dc:	6a 00                	push   $0x0
+ 3de:	e8 24 02 00 00       	call   607 <read>
+ 3e3:	83 c4 10             	add    $0x10,%esp
+ 3e6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 3e9:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 3ed:	7e 33                	jle    422 <gets+0x5e>
+    buf[i++] = c;
+ 3ef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 3f2:	8d 50 01             	lea    0x1(%eax),%edx
+ 3f5:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 3f8:	89 c2                	mov    %eax,%edx
+ 3fa:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3fd:	01 c2                	add    %eax,%edx
+ 3ff:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 403:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 405:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 409:	3c 0a                	cmp    $0xa,%al
+ 40b:	74 16                	je     423 <gets+0x5f>
+ 40d:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 411:	3c 0d                	cmp    $0xd,%al
+ 413:	74 0e                	je     423 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 415:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 418:	83 c0 01             	add    $0x1,%eax
+ 41b:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 41e:	7f b3                	jg     3d3 <gets+0xf>
+ 420:	eb 01                	jmp    423 <gets+0x5f>
+      break;
+ 422:	90                   	nop
+  }
+  buf[i] = '\0';
+ 423:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 426:	8b 45 08             	mov    0x8(%ebp),%eax
+ 429:	01 d0                	add    %edx,%eax
+ 42b:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 42e:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 431:	c9                   	leave
+ 432:	c3                   	ret
+
+00000433 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 433:	55                   	push   %ebp
+ 434:	89 e5                	mov    %esp,%ebp
+ 436:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 439:	83 ec 08             	sub    $0x8,%esp
+ 43c:	6a 00                	push   $0x0
+ 43e:	ff 75 08             	push   0x8(%ebp)
+ 441:	e8 e9 01 00 00       	call   62f <open>
+ 446:	83 c4 10             	add    $0x10,%esp
+ 449:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 44c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 450:	79 07                	jns    459 <stat+0x26>
+    return -1;
+ 452:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 457:	eb 25                	jmp    47e <stat+0x4b>
+  r = fstat(fd, st);
+ 459:	83 ec 08             	sub    $0x8,%esp
+ 45c:	ff 75 0c             	push   0xc(%ebp)
+ 45f:	ff 75 f4             	push   -0xc(%ebp)
+ 462:	e8 e0 01 00 00       	call   647 <fstat>
+ 467:	83 c4 10             	add    $0x10,%esp
+ 46a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 46d:	83 ec 0c             	sub    $0xc,%esp
+ 470:	ff 75 f4             	push   -0xc(%ebp)
+ 473:	e8 9f 01 00 00       	call   617 <close>
+ 478:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 47b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 47e:	c9                   	leave
+ 47f:	c3                   	ret
+
+00000480 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 486:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 48d:	eb 25                	jmp    4b4 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 48f:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 492:	89 d0                	mov    %edx,%eax
+ 494:	c1 e0 02             	shl    $0x2,%eax
+ 497:	01 d0                	add    %edx,%eax
+ 499:	01 c0                	add    %eax,%eax
+ 49b:	89 c1                	mov    %eax,%ecx
+ 49d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4a0:	8d 50 01             	lea    0x1(%eax),%edx
+ 4a3:	89 55 08             	mov    %edx,0x8(%ebp)
+ 4a6:	0f b6 00             	movzbl (%eax),%eax
+ 4a9:	0f be c0             	movsbl %al,%eax
+ 4ac:	01 c8                	add    %ecx,%eax
+ 4ae:	83 e8 30             	sub    $0x30,%eax
+ 4b1:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 4b4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4b7:	0f b6 00             	movzbl (%eax),%eax
+ 4ba:	3c 2f                	cmp    $0x2f,%al
+ 4bc:	7e 0a                	jle    4c8 <atoi+0x48>
+ 4be:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4c1:	0f b6 00             	movzbl (%eax),%eax
+ 4c4:	3c 39                	cmp    $0x39,%al
+ 4c6:	7e c7                	jle    48f <atoi+0xf>
+  return n;
+ 4c8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 4cb:	c9                   	leave
+ 4cc:	c3                   	ret
+
+000004cd <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 4cd:	55                   	push   %ebp
+ 4ce:	89 e5                	mov    %esp,%ebp
+ 4d0:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+
+  dst = vdst;
+ 4d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4d6:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 4d9:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4dc:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 4df:	eb 17                	jmp    4f8 <memmove+0x2b>
+    *dst++ = *src++;
+ 4e1:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 4e4:	8d 42 01             	lea    0x1(%edx),%eax
+ 4e7:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 4ea:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 4ed:	8d 48 01             	lea    0x1(%eax),%ecx
+ 4f0:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 4f3:	0f b6 12             	movzbl (%edx),%edx
+ 4f6:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 4f8:	8b 45 10             	mov    0x10(%ebp),%eax
+ 4fb:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 4fe:	89 55 10             	mov    %edx,0x10(%ebp)
+ 501:	85 c0                	test   %eax,%eax
+ 503:	7f dc                	jg     4e1 <memmove+0x14>
+  return vdst;
+ 505:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 508:	c9                   	leave
+ 509:	c3                   	ret
+
+0000050a <opendir>:
+    int fd;
+    int child;
+} DIR;
+
+DIR* opendir(const char* name)
+{
+ 50a:	55                   	push   %ebp
+ 50b:	89 e5                	mov    %esp,%ebp
+ 50d:	83 ec 18             	sub    $0x18,%esp
+    DIR* dp = malloc(sizeof(*dp));
+ 510:	83 ec 0c             	sub    $0xc,%esp
+ 513:	6a 08                	push   $0x8
+ 515:	e8 4d 05 00 00       	call   a67 <malloc>
+ 51a:	83 c4 10             	add    $0x10,%esp
+ 51d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+    dp->fd = open((char*)name, 0);
+ 520:	83 ec 08             	sub    $0x8,%esp
+ 523:	6a 00                	push   $0x0
+ 525:	ff 75 08             	push   0x8(%ebp)
+ 528:	e8 02 01 00 00       	call   62f <open>
+ 52d:	83 c4 10             	add    $0x10,%esp
+ 530:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 533:	89 02                	mov    %eax,(%edx)
+    dp->child = 0;
+ 535:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 538:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+
+    return dp;
+ 53f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 542:	c9                   	leave
+ 543:	c3                   	ret
+
+00000544 <closedir>:
+
+void closedir(DIR* dp)
+{
+ 544:	55                   	push   %ebp
+ 545:	89 e5                	mov    %esp,%ebp
+ 547:	83 ec 08             	sub    $0x8,%esp
+    if(dp == 0) {
+ 54a:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 54e:	74 21                	je     571 <closedir+0x2d>
+        return;
+    }
+
+    close(dp->fd);
+ 550:	8b 45 08             	mov    0x8(%ebp),%eax
+ 553:	8b 00                	mov    (%eax),%eax
+ 555:	83 ec 0c             	sub    $0xc,%esp
+ 558:	50                   	push   %eax
+ 559:	e8 b9 00 00 00       	call   617 <close>
+ 55e:	83 c4 10             	add    $0x10,%esp
+    free(dp);
+ 561:	83 ec 0c             	sub    $0xc,%esp
+ 564:	ff 75 08             	push   0x8(%ebp)
+ 567:	e8 b9 03 00 00       	call   925 <free>
+ 56c:	83 c4 10             	add    $0x10,%esp
+ 56f:	eb 01                	jmp    572 <closedir+0x2e>
+        return;
+ 571:	90                   	nop
+}
+ 572:	c9                   	leave
+ 573:	c3                   	ret
+
+00000574 <readdir>:
+
+struct dirent* readdir(DIR* dp)
+{
+ 574:	55                   	push   %ebp
+ 575:	89 e5                	mov    %esp,%ebp
+ 577:	83 ec 18             	sub    $0x18,%esp
+    if(dp == 0) {
+ 57a:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 57e:	75 07                	jne    587 <readdir+0x13>
+      return 0;
+ 580:	b8 00 00 00 00       	mov    $0x0,%eax
+ 585:	eb 5e                	jmp    5e5 <readdir+0x71>
+    }
+
+    struct dirent* de = malloc(sizeof(*de));
+ 587:	83 ec 0c             	sub    $0xc,%esp
+ 58a:	68 0c 01 00 00       	push   $0x10c
+ 58f:	e8 d3 04 00 00       	call   a67 <malloc>
+ 594:	83 c4 10             	add    $0x10,%esp
+ 597:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    int res = direntry(dp->fd, dp->child, de);
+ 59a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 59d:	8b 50 04             	mov    0x4(%eax),%edx
+ 5a0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5a3:	8b 00                	mov    (%eax),%eax
+ 5a5:	83 ec 04             	sub    $0x4,%esp
+ 5a8:	ff 75 f4             	push   -0xc(%ebp)
+ 5ab:	52                   	push   %edx
+ 5ac:	50                   	push   %eax
+ 5ad:	e8 e5 00 00 00       	call   697 <direntry>
+ 5b2:	83 c4 10             	add    $0x10,%esp
+ 5b5:	89 45 f0             	mov    %eax,-0x10(%ebp)
+
+    // out of children or other error
+    if(res == -1) {
+ 5b8:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+ 5bc:	75 15                	jne    5d3 <readdir+0x5f>
+        free(de);
+ 5be:	83 ec 0c             	sub    $0xc,%esp
+ 5c1:	ff 75 f4             	push   -0xc(%ebp)
+ 5c4:	e8 5c 03 00 00       	call   925 <free>
+ 5c9:	83 c4 10             	add    $0x10,%esp
+        return 0;
+ 5cc:	b8 00 00 00 00       	mov    $0x0,%eax
+ 5d1:	eb 12                	jmp    5e5 <readdir+0x71>
+    }
+
+    dp->child++;
+ 5d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5d6:	8b 40 04             	mov    0x4(%eax),%eax
+ 5d9:	8d 50 01             	lea    0x1(%eax),%edx
+ 5dc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5df:	89 50 04             	mov    %edx,0x4(%eax)
+    return de;
+ 5e2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 5e5:	c9                   	leave
+ 5e6:	c3                   	ret
+
+000005e7 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 5e7:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5ec:	cd 40                	int    $0x40
+ 5ee:	c3                   	ret
+
+000005ef <exit>:
+SYSCALL(exit)
+ 5ef:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5f4:	cd 40                	int    $0x40
+ 5f6:	c3                   	ret
+
+000005f7 <wait>:
+SYSCALL(wait)
+ 5f7:	b8 03 00 00 00       	mov    $0x3,%eax
+ 5fc:	cd 40                	int    $0x40
+ 5fe:	c3                   	ret
+
+000005ff <pipe>:
+SYSCALL(pipe)
+ 5ff:	b8 04 00 00 00       	mov    $0x4,%eax
+ 604:	cd 40                	int    $0x40
+ 606:	c3                   	ret
+
+00000607 <read>:
+SYSCALL(read)
+ 607:	b8 05 00 00 00       	mov    $0x5,%eax
+ 60c:	cd 40                	int    $0x40
+ 60e:	c3                   	ret
+
+0000060f <write>:
+SYSCALL(write)
+ 60f:	b8 10 00 00 00       	mov    $0x10,%eax
+ 614:	cd 40                	int    $0x40
+ 616:	c3                   	ret
+
+00000617 <close>:
+SYSCALL(close)
+ 617:	b8 15 00 00 00       	mov    $0x15,%eax
+ 61c:	cd 40                	int    $0x40
+ 61e:	c3                   	ret
+
+0000061f <kill>:
+SYSCALL(kill)
+ 61f:	b8 06 00 00 00       	mov    $0x6,%eax
+ 624:	cd 40                	int    $0x40
+ 626:	c3                   	ret
+
+00000627 <exec>:
+SYSCALL(exec)
+ 627:	b8 07 00 00 00       	mov    $0x7,%eax
+ 62c:	cd 40                	int    $0x40
+ 62e:	c3                   	ret
+
+0000062f <open>:
+SYSCALL(open)
+ 62f:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 634:	cd 40                	int    $0x40
+ 636:	c3                   	ret
+
+00000637 <mknod>:
+SYSCALL(mknod)
+ 637:	b8 11 00 00 00       	mov    $0x11,%eax
+ 63c:	cd 40                	int    $0x40
+ 63e:	c3                   	ret
+
+0000063f <unlink>:
+SYSCALL(unlink)
+ 63f:	b8 12 00 00 00       	mov    $0x12,%eax
+ 644:	cd 40                	int    $0x40
+ 646:	c3                   	ret
+
+00000647 <fstat>:
+SYSCALL(fstat)
+ 647:	b8 08 00 00 00       	mov    $0x8,%eax
+ 64c:	cd 40                	int    $0x40
+ 64e:	c3                   	ret
+
+0000064f <link>:
+SYSCALL(link)
+ 64f:	b8 13 00 00 00       	mov    $0x13,%eax
+ 654:	cd 40                	int    $0x40
+ 656:	c3                   	ret
+
+00000657 <mkdir>:
+SYSCALL(mkdir)
+ 657:	b8 14 00 00 00       	mov    $0x14,%eax
+ 65c:	cd 40                	int    $0x40
+ 65e:	c3                   	ret
+
+0000065f <chdir>:
+SYSCALL(chdir)
+ 65f:	b8 09 00 00 00       	mov    $0x9,%eax
+ 664:	cd 40                	int    $0x40
+ 666:	c3                   	ret
+
+00000667 <dup>:
+SYSCALL(dup)
+ 667:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 66c:	cd 40                	int    $0x40
+ 66e:	c3                   	ret
+
+0000066f <getpid>:
+SYSCALL(getpid)
+ 66f:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 674:	cd 40                	int    $0x40
+ 676:	c3                   	ret
+
+00000677 <sbrk>:
+SYSCALL(sbrk)
+ 677:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 67c:	cd 40                	int    $0x40
+ 67e:	c3                   	ret
+
+0000067f <sleep>:
+SYSCALL(sleep)
+ 67f:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 684:	cd 40                	int    $0x40
+ 686:	c3                   	ret
+
+00000687 <uptime>:
+SYSCALL(uptime)
+ 687:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 68c:	cd 40                	int    $0x40
+ 68e:	c3                   	ret
+
+0000068f <mount>:
+SYSCALL(mount)
+ 68f:	b8 16 00 00 00       	mov    $0x16,%eax
+ 694:	cd 40                	int    $0x40
+ 696:	c3                   	ret
+
+00000697 <direntry>:
+SYSCALL(direntry)
+ 697:	b8 17 00 00 00       	mov    $0x17,%eax
+ 69c:	cd 40                	int    $0x40
+ 69e:	c3                   	ret
+
+0000069f <sync>:
+SYSCALL(sync)
+ 69f:	b8 18 00 00 00       	mov    $0x18,%eax
+ 6a4:	cd 40                	int    $0x40
+ 6a6:	c3                   	ret
+
+000006a7 <fsync>:
+SYSCALL(fsync)
+ 6a7:	b8 19 00 00 00       	mov    $0x19,%eax
+ 6ac:	cd 40                	int    $0x40
+ 6ae:	c3                   	ret
+
+000006af <mmap>:
+SYSCALL(mmap)
+ 6af:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 6b4:	cd 40                	int    $0x40
+ 6b6:	c3                   	ret
+
+000006b7 <munmap>:
+SYSCALL(munmap)
+ 6b7:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 6bc:	cd 40                	int    $0x40
+ 6be:	c3                   	ret
+
+000006bf <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 6bf:	55                   	push   %ebp
+ 6c0:	89 e5                	mov    %esp,%ebp
+ 6c2:	83 ec 18             	sub    $0x18,%esp
+ 6c5:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6c8:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 6cb:	83 ec 04             	sub    $0x4,%esp
+ 6ce:	6a 01                	push   $0x1
+ 6d0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 6d3:	50                   	push   %eax
+ 6d4:	ff 75 08             	push   0x8(%ebp)
+ 6d7:	e8 33 ff ff ff       	call   60f <write>
+ 6dc:	83 c4 10             	add    $0x10,%esp
+}
+ 6df:	90                   	nop
+ 6e0:	c9                   	leave
+ 6e1:	c3                   	ret
+
+000006e2 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 6e2:	55                   	push   %ebp
+ 6e3:	89 e5                	mov    %esp,%ebp
+ 6e5:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 6e8:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 6ef:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 6f3:	74 17                	je     70c <printint+0x2a>
+ 6f5:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 6f9:	79 11                	jns    70c <printint+0x2a>
+    neg = 1;
+ 6fb:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 702:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 705:	f7 d8                	neg    %eax
+ 707:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 70a:	eb 06                	jmp    712 <printint+0x30>
+  } else {
+    x = xx;
+ 70c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 70f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 712:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 719:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 71c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 71f:	ba 00 00 00 00       	mov    $0x0,%edx
+ 724:	f7 f1                	div    %ecx
+ 726:	89 d1                	mov    %edx,%ecx
+ 728:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 72b:	8d 50 01             	lea    0x1(%eax),%edx
+ 72e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 731:	0f b6 91 00 20 00 00 	movzbl 0x2000(%ecx),%edx
+ 738:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 73c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 73f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 742:	ba 00 00 00 00       	mov    $0x0,%edx
+ 747:	f7 f1                	div    %ecx
+ 749:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 74c:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 750:	75 c7                	jne    719 <printint+0x37>
+  if(neg)
+ 752:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 756:	74 2d                	je     785 <printint+0xa3>
+    buf[i++] = '-';
+ 758:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 75b:	8d 50 01             	lea    0x1(%eax),%edx
+ 75e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 761:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 766:	eb 1d                	jmp    785 <printint+0xa3>
+    putc(fd, buf[i]);
+ 768:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 76b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 76e:	01 d0                	add    %edx,%eax
+ 770:	0f b6 00             	movzbl (%eax),%eax
+ 773:	0f be c0             	movsbl %al,%eax
+ 776:	83 ec 08             	sub    $0x8,%esp
+ 779:	50                   	push   %eax
+ 77a:	ff 75 08             	push   0x8(%ebp)
+ 77d:	e8 3d ff ff ff       	call   6bf <putc>
+ 782:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 785:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 789:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 78d:	79 d9                	jns    768 <printint+0x86>
+}
+ 78f:	90                   	nop
+ 790:	90                   	nop
+ 791:	c9                   	leave
+ 792:	c3                   	ret
+
+00000793 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 793:	55                   	push   %ebp
+ 794:	89 e5                	mov    %esp,%ebp
+ 796:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 799:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 7a0:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 7a3:	83 c0 04             	add    $0x4,%eax
+ 7a6:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 7a9:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 7b0:	e9 59 01 00 00       	jmp    90e <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 7b5:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 7b8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7bb:	01 d0                	add    %edx,%eax
+ 7bd:	0f b6 00             	movzbl (%eax),%eax
+ 7c0:	0f be c0             	movsbl %al,%eax
+ 7c3:	25 ff 00 00 00       	and    $0xff,%eax
+ 7c8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 7cb:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 7cf:	75 2c                	jne    7fd <printf+0x6a>
+      if(c == '%'){
+ 7d1:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 7d5:	75 0c                	jne    7e3 <printf+0x50>
+        state = '%';
+ 7d7:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 7de:	e9 27 01 00 00       	jmp    90a <printf+0x177>
+      } else {
+        putc(fd, c);
+ 7e3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 7e6:	0f be c0             	movsbl %al,%eax
+ 7e9:	83 ec 08             	sub    $0x8,%esp
+ 7ec:	50                   	push   %eax
+ 7ed:	ff 75 08             	push   0x8(%ebp)
+ 7f0:	e8 ca fe ff ff       	call   6bf <putc>
+ 7f5:	83 c4 10             	add    $0x10,%esp
+ 7f8:	e9 0d 01 00 00       	jmp    90a <printf+0x177>
+      }
+    } else if(state == '%'){
+ 7fd:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 801:	0f 85 03 01 00 00    	jne    90a <printf+0x177>
+      if(c == 'd'){
+ 807:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 80b:	75 1e                	jne    82b <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 80d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 810:	8b 00                	mov    (%eax),%eax
+ 812:	6a 01                	push   $0x1
+ 814:	6a 0a                	push   $0xa
+ 816:	50                   	push   %eax
+ 817:	ff 75 08             	push   0x8(%ebp)
+ 81a:	e8 c3 fe ff ff       	call   6e2 <printint>
+ 81f:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 822:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 826:	e9 d8 00 00 00       	jmp    903 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 82b:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 82f:	74 06                	je     837 <printf+0xa4>
+ 831:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 835:	75 1e                	jne    855 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 837:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 83a:	8b 00                	mov    (%eax),%eax
+ 83c:	6a 00                	push   $0x0
+ 83e:	6a 10                	push   $0x10
+ 840:	50                   	push   %eax
+ 841:	ff 75 08             	push   0x8(%ebp)
+ 844:	e8 99 fe ff ff       	call   6e2 <printint>
+ 849:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 84c:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 850:	e9 ae 00 00 00       	jmp    903 <printf+0x170>
+      } else if(c == 's'){
+ 855:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 859:	75 43                	jne    89e <printf+0x10b>
+        s = (char*)*ap;
+ 85b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 85e:	8b 00                	mov    (%eax),%eax
+ 860:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 863:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 867:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 86b:	75 25                	jne    892 <printf+0xff>
+          s = "(null)";
+ 86d:	c7 45 f4 4a 10 00 00 	movl   $0x104a,-0xc(%ebp)
+        while(*s != 0){
+ 874:	eb 1c                	jmp    892 <printf+0xff>
+          putc(fd, *s);
+ 876:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 879:	0f b6 00             	movzbl (%eax),%eax
+ 87c:	0f be c0             	movsbl %al,%eax
+ 87f:	83 ec 08             	sub    $0x8,%esp
+ 882:	50                   	push   %eax
+ 883:	ff 75 08             	push   0x8(%ebp)
+ 886:	e8 34 fe ff ff       	call   6bf <putc>
+ 88b:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 88e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 892:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 895:	0f b6 00             	movzbl (%eax),%eax
+ 898:	84 c0                	test   %al,%al
+ 89a:	75 da                	jne    876 <printf+0xe3>
+ 89c:	eb 65                	jmp    903 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 89e:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 8a2:	75 1d                	jne    8c1 <printf+0x12e>
+        putc(fd, *ap);
+ 8a4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8a7:	8b 00                	mov    (%eax),%eax
+ 8a9:	0f be c0             	movsbl %al,%eax
+ 8ac:	83 ec 08             	sub    $0x8,%esp
+ 8af:	50                   	push   %eax
+ 8b0:	ff 75 08             	push   0x8(%ebp)
+ 8b3:	e8 07 fe ff ff       	call   6bf <putc>
+ 8b8:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 8bb:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 8bf:	eb 42                	jmp    903 <printf+0x170>
+      } else if(c == '%'){
+ 8c1:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 8c5:	75 17                	jne    8de <printf+0x14b>
+        putc(fd, c);
+ 8c7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8ca:	0f be c0             	movsbl %al,%eax
+ 8cd:	83 ec 08             	sub    $0x8,%esp
+ 8d0:	50                   	push   %eax
+ 8d1:	ff 75 08             	push   0x8(%ebp)
+ 8d4:	e8 e6 fd ff ff       	call   6bf <putc>
+ 8d9:	83 c4 10             	add    $0x10,%esp
+ 8dc:	eb 25                	jmp    903 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 8de:	83 ec 08             	sub    $0x8,%esp
+ 8e1:	6a 25                	push   $0x25
+ 8e3:	ff 75 08             	push   0x8(%ebp)
+ 8e6:	e8 d4 fd ff ff       	call   6bf <putc>
+ 8eb:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 8ee:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8f1:	0f be c0             	movsbl %al,%eax
+ 8f4:	83 ec 08             	sub    $0x8,%esp
+ 8f7:	50                   	push   %eax
+ 8f8:	ff 75 08             	push   0x8(%ebp)
+ 8fb:	e8 bf fd ff ff       	call   6bf <putc>
+ 900:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 903:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 90a:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 90e:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 911:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 914:	01 d0                	add    %edx,%eax
+ 916:	0f b6 00             	movzbl (%eax),%eax
+ 919:	84 c0                	test   %al,%al
+ 91b:	0f 85 94 fe ff ff    	jne    7b5 <printf+0x22>
+    }
+  }
+}
+ 921:	90                   	nop
+ 922:	90                   	nop
+ 923:	c9                   	leave
+ 924:	c3                   	ret
+
+00000925 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 925:	55                   	push   %ebp
+ 926:	89 e5                	mov    %esp,%ebp
+ 928:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 92b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 92e:	83 e8 08             	sub    $0x8,%eax
+ 931:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 934:	a1 2c 20 00 00       	mov    0x202c,%eax
+ 939:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 93c:	eb 24                	jmp    962 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 93e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 941:	8b 00                	mov    (%eax),%eax
+ 943:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 946:	72 12                	jb     95a <free+0x35>
+ 948:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 94b:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 94e:	72 24                	jb     974 <free+0x4f>
+ 950:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 953:	8b 00                	mov    (%eax),%eax
+ 955:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 958:	72 1a                	jb     974 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 95a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 95d:	8b 00                	mov    (%eax),%eax
+ 95f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 962:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 965:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 968:	73 d4                	jae    93e <free+0x19>
+ 96a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 96d:	8b 00                	mov    (%eax),%eax
+ 96f:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 972:	73 ca                	jae    93e <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 974:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 977:	8b 40 04             	mov    0x4(%eax),%eax
+ 97a:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 981:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 984:	01 c2                	add    %eax,%edx
+ 986:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 989:	8b 00                	mov    (%eax),%eax
+ 98b:	39 c2                	cmp    %eax,%edx
+ 98d:	75 24                	jne    9b3 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 98f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 992:	8b 50 04             	mov    0x4(%eax),%edx
+ 995:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 998:	8b 00                	mov    (%eax),%eax
+ 99a:	8b 40 04             	mov    0x4(%eax),%eax
+ 99d:	01 c2                	add    %eax,%edx
+ 99f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9a2:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9a5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9a8:	8b 00                	mov    (%eax),%eax
+ 9aa:	8b 10                	mov    (%eax),%edx
+ 9ac:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9af:	89 10                	mov    %edx,(%eax)
+ 9b1:	eb 0a                	jmp    9bd <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 9b3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9b6:	8b 10                	mov    (%eax),%edx
+ 9b8:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9bb:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 9bd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9c0:	8b 40 04             	mov    0x4(%eax),%eax
+ 9c3:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 9ca:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9cd:	01 d0                	add    %edx,%eax
+ 9cf:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 9d2:	75 20                	jne    9f4 <free+0xcf>
+    p->s.size += bp->s.size;
+ 9d4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9d7:	8b 50 04             	mov    0x4(%eax),%edx
+ 9da:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9dd:	8b 40 04             	mov    0x4(%eax),%eax
+ 9e0:	01 c2                	add    %eax,%edx
+ 9e2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9e5:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 9e8:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9eb:	8b 10                	mov    (%eax),%edx
+ 9ed:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9f0:	89 10                	mov    %edx,(%eax)
+ 9f2:	eb 08                	jmp    9fc <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 9f4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9f7:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 9fa:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 9fc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9ff:	a3 2c 20 00 00       	mov    %eax,0x202c
+}
+ a04:	90                   	nop
+ a05:	c9                   	leave
+ a06:	c3                   	ret
+
+00000a07 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ a07:	55                   	push   %ebp
+ a08:	89 e5                	mov    %esp,%ebp
+ a0a:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ a0d:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ a14:	77 07                	ja     a1d <morecore+0x16>
+    nu = 4096;
+ a16:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ a1d:	8b 45 08             	mov    0x8(%ebp),%eax
+ a20:	c1 e0 03             	shl    $0x3,%eax
+ a23:	83 ec 0c             	sub    $0xc,%esp
+ a26:	50                   	push   %eax
+ a27:	e8 4b fc ff ff       	call   677 <sbrk>
+ a2c:	83 c4 10             	add    $0x10,%esp
+ a2f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ a32:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ a36:	75 07                	jne    a3f <morecore+0x38>
+    return 0;
+ a38:	b8 00 00 00 00       	mov    $0x0,%eax
+ a3d:	eb 26                	jmp    a65 <morecore+0x5e>
+  hp = (Header*)p;
+ a3f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a42:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ a45:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a48:	8b 55 08             	mov    0x8(%ebp),%edx
+ a4b:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ a4e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a51:	83 c0 08             	add    $0x8,%eax
+ a54:	83 ec 0c             	sub    $0xc,%esp
+ a57:	50                   	push   %eax
+ a58:	e8 c8 fe ff ff       	call   925 <free>
+ a5d:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ a60:	a1 2c 20 00 00       	mov    0x202c,%eax
+}
+ a65:	c9                   	leave
+ a66:	c3                   	ret
+
+00000a67 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ a67:	55                   	push   %ebp
+ a68:	89 e5                	mov    %esp,%ebp
+ a6a:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a6d:	8b 45 08             	mov    0x8(%ebp),%eax
+ a70:	83 c0 07             	add    $0x7,%eax
+ a73:	c1 e8 03             	shr    $0x3,%eax
+ a76:	83 c0 01             	add    $0x1,%eax
+ a79:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ a7c:	a1 2c 20 00 00       	mov    0x202c,%eax
+ a81:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ a84:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ a88:	75 23                	jne    aad <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ a8a:	c7 45 f0 24 20 00 00 	movl   $0x2024,-0x10(%ebp)
+ a91:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a94:	a3 2c 20 00 00       	mov    %eax,0x202c
+ a99:	a1 2c 20 00 00       	mov    0x202c,%eax
+ a9e:	a3 24 20 00 00       	mov    %eax,0x2024
+    base.s.size = 0;
+ aa3:	c7 05 28 20 00 00 00 	movl   $0x0,0x2028
+ aaa:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ aad:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ab0:	8b 00                	mov    (%eax),%eax
+ ab2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ ab5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ab8:	8b 40 04             	mov    0x4(%eax),%eax
+ abb:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ abe:	72 4d                	jb     b0d <malloc+0xa6>
+      if(p->s.size == nunits)
+ ac0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ac3:	8b 40 04             	mov    0x4(%eax),%eax
+ ac6:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ ac9:	75 0c                	jne    ad7 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ acb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ace:	8b 10                	mov    (%eax),%edx
+ ad0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ad3:	89 10                	mov    %edx,(%eax)
+ ad5:	eb 26                	jmp    afd <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ ad7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ada:	8b 40 04             	mov    0x4(%eax),%eax
+ add:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ ae0:	89 c2                	mov    %eax,%edx
+ ae2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ae5:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ ae8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ aeb:	8b 40 04             	mov    0x4(%eax),%eax
+ aee:	c1 e0 03             	shl    $0x3,%eax
+ af1:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ af4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ af7:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ afa:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ afd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b00:	a3 2c 20 00 00       	mov    %eax,0x202c
+      return (void*)(p + 1);
+ b05:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b08:	83 c0 08             	add    $0x8,%eax
+ b0b:	eb 3b                	jmp    b48 <malloc+0xe1>
+    }
+    if(p == freep)
+ b0d:	a1 2c 20 00 00       	mov    0x202c,%eax
+ b12:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ b15:	75 1e                	jne    b35 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ b17:	83 ec 0c             	sub    $0xc,%esp
+ b1a:	ff 75 ec             	push   -0x14(%ebp)
+ b1d:	e8 e5 fe ff ff       	call   a07 <morecore>
+ b22:	83 c4 10             	add    $0x10,%esp
+ b25:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ b28:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b2c:	75 07                	jne    b35 <malloc+0xce>
+        return 0;
+ b2e:	b8 00 00 00 00       	mov    $0x0,%eax
+ b33:	eb 13                	jmp    b48 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b35:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b38:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ b3b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b3e:	8b 00                	mov    (%eax),%eax
+ b40:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ b43:	e9 6d ff ff ff       	jmp    ab5 <malloc+0x4e>
+  }
+}
+ b48:	c9                   	leave
+ b49:	c3                   	ret
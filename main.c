@@ -6,6 +6,7 @@
 #include "proc.h"
 #include "x86.h"
 #include "vfs.h"
+#include "bcache.h"
 
 static void startothers(void);
 static void mpmain(void)  __attribute__((noreturn));
@@ -25,6 +26,7 @@ main(void)
   seginit();       // segment descriptors
   picinit();       // disable pic
   ioapicinit();    // another interrupt controller
+  slabinit();      // small object allocator
   vfs_init();      // VFS subsystem
   consoleinit();   // console hardware
   uartinit();      // serial port
@@ -36,6 +38,7 @@ main(void)
   idtinit();       // load idt register
 
   sti();           // enable interrupts
+  bcache_init();   // block cache
   ideinit();       // disk
   sfs_init();      // SFS filesystem
 
@@ -1,65 +1,179 @@
 #include "map.h"
-#include "queue.h"
+#include "types.h"
 #include "defs.h"
+#include "mmu.h"
 
-#define BUCKET_CAPACITY 256
+//
+// Open-addressing hash map with linear probing
+//
+// Slots live in a single array, whose capacity is always a power of two.
+// Removed entries leave a tombstone behind, so that probe sequences running
+// through them are not cut short. The table is rebuilt (and grown, if it is
+// actually full of live entries) once live entries plus tombstones exceed
+// 3/4 of the capacity.
+//
 
-struct entry {
+#define MAP_MIN_CAPACITY 16
+
+// slot states -- any other key value is a live entry
+#define MAP_EMPTY     ((const void*)0)
+#define MAP_TOMBSTONE ((const void*)-1)
+
+struct slot {
     const void* key;
     void* value;
+    uint hash;
 };
 
-typedef struct link {
-    struct link* next;
-    struct entry e;
-} *link_t;
-
+// the slot array has to fit into what kmalloc() can hand out
+#define MAP_MAX_CAPACITY (PGSIZE / sizeof(struct slot))
 
 struct map {
-    link_t buckets[BUCKET_CAPACITY];
+    struct slot* slots;
+    int capacity;
     int size;
+    int used; // live entries + tombstones
 };
 
+static void* map_alloc(int size)
+{
+    return kmalloc(size);
+}
+
+static void map_free(void* ptr)
+{
+    kfree_small(ptr);
+}
+
+static struct slot* slots_create(int capacity)
+{
+    struct slot* slots = map_alloc(capacity * sizeof(struct slot));
+    memset(slots, 0, capacity * sizeof(struct slot));
+
+    return slots;
+}
+
+static inline int is_live(const struct slot* s)
+{
+    return s->key != MAP_EMPTY && s->key != MAP_TOMBSTONE;
+}
+
+// Rebuild the slot array with the given capacity, dropping all tombstones
+static void map_rehash(map_t m, int capacity)
+{
+    struct slot* old = m->slots;
+    int old_capacity = m->capacity;
+
+    m->slots = slots_create(capacity);
+    m->capacity = capacity;
+    m->used = m->size;
+
+    for(int i = 0; i < old_capacity; i++) {
+        if(!is_live(&old[i])) {
+            continue;
+        }
+
+        uint pos = old[i].hash & (capacity - 1);
+
+        while(m->slots[pos].key != MAP_EMPTY) {
+            pos = (pos + 1) & (capacity - 1);
+        }
+
+        m->slots[pos] = old[i];
+    }
+
+    map_free(old);
+}
+
+// Find the slot holding key, or -1 if key is not in the map
+static int map_find(map_t m, const void* key, uint h, int (*equal)(const void*, const void*))
+{
+    uint pos = h & (m->capacity - 1);
+
+    for(int i = 0; i < m->capacity; i++) {
+        struct slot* s = &m->slots[pos];
+
+        if(s->key == MAP_EMPTY) {
+            break;
+        }
+
+        if(s->key != MAP_TOMBSTONE && s->hash == h && equal(s->key, key)) {
+            return pos;
+        }
+
+        pos = (pos + 1) & (m->capacity - 1);
+    }
+
+    return -1;
+}
+
 map_t map_create()
 {
-    map_t m = (void*)kalloc();
-    memset(m, 0, 4096);
+    map_t m = map_alloc(sizeof(struct map));
+
+    m->slots = slots_create(MAP_MIN_CAPACITY);
+    m->capacity = MAP_MIN_CAPACITY;
     m->size = 0;
+    m->used = 0;
 
     return m;
 }
 
+void map_destroy(map_t m)
+{
+    if(m == 0) {
+        return;
+    }
+
+    map_free(m->slots);
+    map_free(m);
+}
+
 void map_put(map_t m, const void* key, void* value, int (*hash)(const void*), int (*equal)(const void*, const void*))
 {
     if(m == 0) {
         return;
     }
 
-    int h = hash(key);
-    int pos = h % BUCKET_CAPACITY;
+    uint h = hash(key);
+    int pos = map_find(m, key, h, equal);
 
-    if(m->buckets[pos] != 0) {
-        link_t ptr = m->buckets[pos];
+    if(pos >= 0) {
+        m->slots[pos].value = value;
+        return;
+    }
 
-        while(ptr != 0) {
+    // keep the load (including tombstones) under 3/4
+    if((m->used + 1) * 4 > m->capacity * 3) {
+        int capacity = m->capacity;
 
-            if(equal(ptr->e.key, key)){
-                ptr->e.value = value;
-                return;
-            }
+        // only grow if the table is really full of live entries
+        if((m->size + 1) * 2 > capacity) {
+            capacity *= 2;
+        }
 
-            ptr = ptr->next;
+        if(capacity > MAP_MAX_CAPACITY) {
+            panic("map_put: map is full");
         }
+
+        map_rehash(m, capacity);
     }
 
-    link_t lk = (void*)kalloc();
+    // first empty slot or tombstone along the probe sequence
+    pos = h & (m->capacity - 1);
 
-    struct entry e = {.key = key, .value = value};
+    while(is_live(&m->slots[pos])) {
+        pos = (pos + 1) & (m->capacity - 1);
+    }
+
+    if(m->slots[pos].key == MAP_EMPTY) {
+        m->used++;
+    }
 
-    lk->next = m->buckets[pos];
-    lk->e = e;
+    m->slots[pos].key = key;
+    m->slots[pos].value = value;
+    m->slots[pos].hash = h;
 
-    m->buckets[pos] = lk;
     m->size++;
 }
 
@@ -69,18 +183,34 @@ void* map_get(map_t m, const void* key, int (*hash)(const void*), int (*equal)(c
         return 0;
     }
 
-    int h = hash(key);
-    int pos = h % BUCKET_CAPACITY;
+    int pos = map_find(m, key, hash(key), equal);
 
-    link_t ptr = m->buckets[pos];
+    if(pos < 0) {
+        return 0;
+    }
 
-    while(ptr != 0) {
-        if(equal(ptr->e.key, key)) {
-            return ptr->e.value;
-        }
+    return m->slots[pos].value;
+}
+
+void* map_remove(map_t m, const void* key, int (*hash)(const void*), int (*equal)(const void*, const void*))
+{
+    if(m == 0) {
+        return 0;
     }
 
-    return 0;
+    int pos = map_find(m, key, hash(key), equal);
+
+    if(pos < 0) {
+        return 0;
+    }
+
+    void* value = m->slots[pos].value;
+
+    m->slots[pos].key = MAP_TOMBSTONE;
+    m->slots[pos].value = 0;
+    m->size--;
+
+    return value;
 }
 
 int map_size(map_t m)
@@ -94,22 +224,67 @@ int map_size(map_t m)
 
 void map_keys(map_t m, const void** buffer)
 {
+    struct map_iter it;
+    int pos = 0;
+
     if(m == 0) {
         *buffer = 0;
         return;
     }
 
-    int pos = 0;
+    map_iter_init(m, &it);
 
-    for(int i = 0; i < BUCKET_CAPACITY; i++)
-    {
-        link_t ptr = m->buckets[i];
+    while(map_iter_next(&it, &buffer[pos], 0)) {
+        pos++;
+    }
+}
+
+void map_iter_init(map_t m, struct map_iter* it)
+{
+    it->m = m;
+    it->pos = 0;
+}
+
+int map_iter_next(struct map_iter* it, const void** key, void** value)
+{
+    map_t m = it->m;
+
+    if(m == 0) {
+        return 0;
+    }
+
+    while(it->pos < m->capacity) {
+        struct slot* s = &m->slots[it->pos];
+        it->pos++;
 
-        while(ptr != 0) {
-            buffer[pos] = ptr->e.key;
+        if(!is_live(s)) {
+            continue;
+        }
+
+        if(key) {
+            *key = s->key;
+        }
 
-            pos++;
-            ptr = ptr->next;
+        if(value) {
+            *value = s->value;
         }
+
+        return 1;
+    }
+
+    return 0;
+}
+
+int map_strhash(const void* key)
+{
+    const uchar* str = key;
+    uint h = 2166136261u;
+
+    while(*str != '\0') {
+        h ^= *str;
+        h *= 16777619u;
+        str++;
     }
+
+    return h;
 }
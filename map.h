@@ -3,10 +3,109 @@
 struct map;
 typedef struct map* map_t;
 
+/**
+ * Map iterator
+ *
+ * Walks all entries of a map, in no particular order. The map must not be
+ * modified while it is being iterated over.
+ */
+struct map_iter {
+    map_t m;
+    int pos;
+};
+
+/**
+ * Create and initialise an empty map
+ * @return the new map opaque pointer
+ */
 map_t map_create();
+
+/**
+ * Destroy the given map, freeing any resources that were allocated for it
+ *
+ * The keys and values themselves are owned by the caller and are not freed.
+ *
+ * @param m - map to destroy (clean up)
+ */
 void map_destroy(map_t m);
 
+/**
+ * Associate a value with a key, replacing any previous value
+ *
+ * The key pointer is stored as-is (not copied), so it must stay valid for as long as
+ * the entry is in the map.
+ *
+ * @param m - map to modify
+ * @param key - key of the entry
+ * @param value - value to associate with key
+ * @param hash - hash function for keys
+ * @param equal - equality function for keys
+ */
 void map_put(map_t m, const void* key, void* value, int (*hash)(const void*), int (*equal)(const void*, const void*));
+
+/**
+ * Look up the value associated with a key
+ *
+ * @param m - map to search
+ * @param key - key to look for
+ * @param hash - hash function for keys
+ * @param equal - equality function for keys
+ *
+ * @return the associated value, or 0 if key is not in the map
+ */
 void* map_get(map_t m, const void* key, int (*hash)(const void*), int (*equal)(const void*, const void*));
+
+/**
+ * Remove a key (and its value) from the map
+ *
+ * @param m - map to modify
+ * @param key - key to remove
+ * @param hash - hash function for keys
+ * @param equal - equality function for keys
+ *
+ * @return the value that was associated with key, or 0 if key was not in the map
+ */
+void* map_remove(map_t m, const void* key, int (*hash)(const void*), int (*equal)(const void*, const void*));
+
+/**
+ * Number of entries in the map
+ *
+ * @param m - map to query
+ * @return the number of keys
+ */
 int map_size(map_t m);
+
+/**
+ * Copy all keys of the map into buffer
+ *
+ * @param m - map to query
+ * @param buffer - destination, which must have room for map_size(m) keys
+ */
 void map_keys(map_t m, const void** buffer);
+
+/**
+ * Start iterating over the entries of a map
+ *
+ * @param m - map to iterate over
+ * @param it - iterator to initialise
+ */
+void map_iter_init(map_t m, struct map_iter* it);
+
+/**
+ * Advance a map iterator
+ *
+ * @param it - iterator to advance
+ * @param key - where to place the key of the next entry (may be 0)
+ * @param value - where to place the value of the next entry (may be 0)
+ *
+ * @return 1 if an entry was produced, or 0 once all entries have been visited
+ */
+int map_iter_next(struct map_iter* it, const void** key, void** value);
+
+/**
+ * FNV-1a hash of a NUL-terminated string, for use as a map hash function
+ *
+ * @param key - the string to hash
+ * @return the hash value
+ */
+int map_strhash(const void* key);
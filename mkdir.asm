@@ -0,0 +1,1272 @@
+
+_mkdir:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	83 ec 10             	sub    $0x10,%esp
+  12:	89 cb                	mov    %ecx,%ebx
+  int i;
+
+  if(argc < 2){
+  14:	83 3b 01             	cmpl   $0x1,(%ebx)
+  17:	7f 17                	jg     30 <main+0x30>
+    printf(2, "Usage: mkdir files...\n");
+  19:	83 ec 08             	sub    $0x8,%esp
+  1c:	68 00 10 00 00       	push   $0x1000
+  21:	6a 02                	push   $0x2
+  23:	e8 40 05 00 00       	call   568 <printf>
+  28:	83 c4 10             	add    $0x10,%esp
+    exit();
+  2b:	e8 94 03 00 00       	call   3c4 <exit>
+  }
+
+  for(i = 1; i < argc; i++){
+  30:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  37:	eb 4b                	jmp    84 <main+0x84>
+    if(mkdir(argv[i]) < 0){
+  39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  3c:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  43:	8b 43 04             	mov    0x4(%ebx),%eax
+  46:	01 d0                	add    %edx,%eax
+  48:	8b 00                	mov    (%eax),%eax
+  4a:	83 ec 0c             	sub    $0xc,%esp
+  4d:	50                   	push   %eax
+  4e:	e8 d9 03 00 00       	call   42c <mkdir>
+  53:	83 c4 10             	add    $0x10,%esp
+  56:	85 c0                	test   %eax,%eax
+  58:	79 26                	jns    80 <main+0x80>
+      printf(2, "mkdir: %s failed to create\n", argv[i]);
+  5a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  5d:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  64:	8b 43 04             	mov    0x4(%ebx),%eax
+  67:	01 d0                	add    %edx,%eax
+  69:	8b 00                	mov    (%eax),%eax
+  6b:	83 ec 04             	sub    $0x4,%esp
+  6e:	50                   	push   %eax
+  6f:	68 17 10 00 00       	push   $0x1017
+  74:	6a 02                	push   $0x2
+  76:	e8 ed 04 00 00       	call   568 <printf>
+  7b:	83 c4 10             	add    $0x10,%esp
+      break;
+  7e:	eb 0b                	jmp    8b <main+0x8b>
+  for(i = 1; i < argc; i++){
+  80:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  84:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  87:	3b 03                	cmp    (%ebx),%eax
+  89:	7c ae                	jl     39 <main+0x39>
+    }
+  }
+
+  exit();
+  8b:	e8 34 03 00 00       	call   3c4 <exit>
+
+00000090 <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+  90:	55                   	push   %ebp
+  91:	89 e5                	mov    %esp,%ebp
+  93:	57                   	push   %edi
+  94:	53                   	push   %ebx
+    if(cc < 1)
+  95:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  98:	8b 55 10             	mov    0x10(%ebp),%edx
+  9b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  9e:	89 cb                	mov    %ecx,%ebx
+  a0:	89 df                	mov    %ebx,%edi
+  a2:	89 d1                	mov    %edx,%ecx
+  a4:	fc                   	cld
+  a5:	f3 aa                	rep stos %al,%es:(%edi)
+  a7:	89 ca                	mov    %ecx,%edx
+  a9:	89 fb                	mov    %edi,%ebx
+  ab:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  ae:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+  b1:	90                   	nop
+  b2:	5b                   	pop    %ebx
+  b3:	5f                   	pop    %edi
+  b4:	5d                   	pop    %ebp
+  b5:	c3                   	ret
+
+000000b6 <strcpy>:
+{
+  b6:	55                   	push   %ebp
+  b7:	89 e5                	mov    %esp,%ebp
+  b9:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+  bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  bf:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+  c2:	90                   	nop
+  c3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  c6:	8d 42 01             	lea    0x1(%edx),%eax
+  c9:	89 45 0c             	mov    %eax,0xc(%ebp)
+  cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  cf:	8d 48 01             	lea    0x1(%eax),%ecx
+  d2:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  d5:	0f b6 12             	movzbl (%edx),%edx
+  d8:	88 10                	mov    %dl,(%eax)
+  da:	0f b6 00             	movzbl (%eax),%eax
+  dd:	84 c0                	test   %al,%al
+  df:	75 e2                	jne    c3 <strcpy+0xd>
+  return os;
+  e1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  e4:	c9                   	leave
+  e5:	c3                   	ret
+
+000000e6 <strcmp>:
+{
+  e6:	55                   	push   %ebp
+  e7:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+  e9:	eb 08                	jmp    f3 <strcmp+0xd>
+    p++, q++;
+  eb:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  ef:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+  f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  f6:	0f b6 00             	movzbl (%eax),%eax
+  f9:	84 c0                	test   %al,%al
+  fb:	74 10                	je     10d <strcmp+0x27>
+  fd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 100:	0f b6 10             	movzbl (%eax),%edx
+ 103:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 106:	0f b6 00             	movzbl (%eax),%eax
+ 109:	38 c2                	cmp    %al,%dl
+ 10b:	74 de                	je     eb <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 10d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 110:	0f b6 00             	movzbl (%eax),%eax
+ 113:	0f b6 d0             	movzbl %al,%edx
+ 116:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 119:	0f b6 00             	movzbl (%eax),%eax
+ 11c:	0f b6 c0             	movzbl %al,%eax
+ 11f:	29 c2                	sub    %eax,%edx
+ 121:	89 d0                	mov    %edx,%eax
+}
+ 123:	5d                   	pop    %ebp
+ 124:	c3                   	ret
+
+00000125 <strlen>:
+{
+ 125:	55                   	push   %ebp
+ 126:	89 e5                	mov    %esp,%ebp
+ 128:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 12b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 132:	eb 04                	jmp    138 <strlen+0x13>
+ 134:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 138:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 13b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 13e:	01 d0                	add    %edx,%eax
+ 140:	0f b6 00             	movzbl (%eax),%eax
+ 143:	84 c0                	test   %al,%al
+ 145:	75 ed                	jne    134 <strlen+0xf>
+  return n;
+ 147:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 14a:	c9                   	leave
+ 14b:	c3                   	ret
+
+0000014c <memset>:
+{
+ 14c:	55                   	push   %ebp
+ 14d:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 14f:	8b 45 10             	mov    0x10(%ebp),%eax
+ 152:	50                   	push   %eax
+ 153:	ff 75 0c             	push   0xc(%ebp)
+ 156:	ff 75 08             	push   0x8(%ebp)
+ 159:	e8 32 ff ff ff       	call   90 <stosb>
+ 15e:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 161:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 164:	c9                   	leave
+ 165:	c3                   	ret
+
+00000166 <strchr>:
+{
+ 166:	55                   	push   %ebp
+ 167:	89 e5                	mov    %esp,%ebp
+ 169:	83 ec 04             	sub    $0x4,%esp
+ 16c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 16f:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 172:	eb 14                	jmp    188 <strchr+0x22>
+    if(*s == c)
+ 174:	8b 45 08             	mov    0x8(%ebp),%eax
+ 177:	0f b6 00             	movzbl (%eax),%eax
+ 17a:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 17d:	75 05                	jne    184 <strchr+0x1e>
+      return (char*)s;
+ 17f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 182:	eb 13                	jmp    197 <strchr+0x31>
+  for(; *s; s++)
+ 184:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 188:	8b 45 08             	mov    0x8(%ebp),%eax
+ 18b:	0f b6 00             	movzbl (%eax),%eax
+ 18e:	84 c0                	test   %al,%al
+ 190:	75 e2                	jne    174 <strchr+0xe>
+  return 0;
+ 192:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 197:	c9                   	leave
+ 198:	c3                   	ret
+
+00000199 <gets>:
+{
+ 199:	55                   	push   %ebp
+ 19a:	89 e5                	mov    %esp,%ebp
+ 19c:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 19f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 1a6:	eb 42                	jmp    1ea <gets+0x51>
+    cc = read(0, &c, 1);
+ 1a8:	83 ec 04             	sub    $0x4,%esp
+ 1ab:	6a 01                	push   $0x1
+ 1ad:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 1b0:	50                   	push   %eax
+ 1b1:	6a 00                	push   $0x0
+ 1b3:	e8 24 02 00 00       	call   3dc <read>
+ 1b8:	83 c4 10             	add    $0x10,%esp
+ 1bb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 1be:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 1c2:	7e 33                	jle    1f7 <gets+0x5e>
+    buf[i++] = c;
+ 1c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1c7:	8d 50 01             	lea    0x1(%eax),%edx
+ 1ca:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 1cd:	89 c2                	mov    %eax,%edx
+ 1cf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d2:	01 c2                	add    %eax,%edx
+ 1d4:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1d8:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 1da:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1de:	3c 0a                	cmp    $0xa,%al
+ 1e0:	74 16                	je     1f8 <gets+0x5f>
+ 1e2:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1e6:	3c 0d                	cmp    $0xd,%al
+ 1e8:	74 0e                	je     1f8 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 1ea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1ed:	83 c0 01             	add    $0x1,%eax
+ 1f0:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 1f3:	7f b3                	jg     1a8 <gets+0xf>
+ 1f5:	eb 01                	jmp    1f8 <gets+0x5f>
+      break;
+ 1f7:	90                   	nop
+  }
+  buf[i] = '\0';
+ 1f8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 1fb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1fe:	01 d0                	add    %edx,%eax
+ 200:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 203:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 206:	c9                   	leave
+ 207:	c3                   	ret
+
+00000208 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 208:	55                   	push   %ebp
+ 209:	89 e5                	mov    %esp,%ebp
+ 20b:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 20e:	83 ec 08             	sub    $0x8,%esp
+ 211:	6a 00                	push   $0x0
+ 213:	ff 75 08             	push   0x8(%ebp)
+ 216:	e8 e9 01 00 00       	call   404 <open>
+ 21b:	83 c4 10             	add    $0x10,%esp
+ 21e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 221:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 225:	79 07                	jns    22e <stat+0x26>
+    return -1;
+ 227:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 22c:	eb 25                	jmp    253 <stat+0x4b>
+  r = fstat(fd, st);
+ 22e:	83 ec 08             	sub    $0x8,%esp
+ 231:	ff 75 0c             	push   0xc(%ebp)
+ 234:	ff 75 f4             	push   -0xc(%ebp)
+ 237:	e8 e0 01 00 00       	call   41c <fstat>
+ 23c:	83 c4 10             	add    $0x10,%esp
+ 23f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 242:	83 ec 0c             	sub    $0xc,%esp
+ 245:	ff 75 f4             	push   -0xc(%ebp)
+ 248:	e8 9f 01 00 00       	call   3ec <close>
+ 24d:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 250:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 253:	c9                   	leave
+ 254:	c3                   	ret
+
+00000255 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 255:	55                   	push   %ebp
+ 256:	89 e5                	mov    %esp,%ebp
+ 258:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 25b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 262:	eb 25                	jmp    289 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 264:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 267:	89 d0                	mov    %edx,%eax
+ 269:	c1 e0 02             	shl    $0x2,%eax
+ 26c:	01 d0                	add    %edx,%eax
+ 26e:	01 c0                	add    %eax,%eax
+ 270:	89 c1                	mov    %eax,%ecx
+ 272:	8b 45 08             	mov    0x8(%ebp),%eax
+ 275:	8d 50 01             	lea    0x1(%eax),%edx
+ 278:	89 55 08             	mov    %edx,0x8(%ebp)
+ 27b:	0f b6 00             	movzbl (%eax),%eax
+ 27e:	0f be c0             	movsbl %al,%eax
+ 281:	01 c8                	add    %ecx,%eax
+ 283:	83 e8 30             	sub    $0x30,%eax
+ 286:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 289:	8b 45 08             	mov    0x8(%ebp),%eax
+ 28c:	0f b6 00             	movzbl (%eax),%eax
+ 28f:	3c 2f                	cmp    $0x2f,%al
+ 291:	7e 0a                	jle    29d <atoi+0x48>
+ 293:	8b 45 08             	mov    0x8(%ebp),%eax
+ 296:	0f b6 00             	movzbl (%eax),%eax
+ 299:	3c 39                	cmp    $0x39,%al
+ 29b:	7e c7                	jle    264 <atoi+0xf>
+  return n;
+ 29d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 2a0:	c9                   	leave
+ 2a1:	c3                   	ret
+
+000002a2 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 2a2:	55                   	push   %ebp
+ 2a3:	89 e5                	mov    %esp,%ebp
+ 2a5:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+
+  dst = vdst;
+ 2a8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2ab:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 2ae:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2b1:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 2b4:	eb 17                	jmp    2cd <memmove+0x2b>
+    *dst++ = *src++;
+ 2b6:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 2b9:	8d 42 01             	lea    0x1(%edx),%eax
+ 2bc:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 2bf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 2c2:	8d 48 01             	lea    0x1(%eax),%ecx
+ 2c5:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 2c8:	0f b6 12             	movzbl (%edx),%edx
+ 2cb:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 2cd:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2d0:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 2d3:	89 55 10             	mov    %edx,0x10(%ebp)
+ 2d6:	85 c0                	test   %eax,%eax
+ 2d8:	7f dc                	jg     2b6 <memmove+0x14>
+  return vdst;
+ 2da:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2dd:	c9                   	leave
+ 2de:	c3                   	ret
+
+000002df <opendir>:
+    int fd;
+    int child;
+} DIR;
+
+DIR* opendir(const char* name)
+{
+ 2df:	55                   	push   %ebp
+ 2e0:	89 e5                	mov    %esp,%ebp
+ 2e2:	83 ec 18             	sub    $0x18,%esp
+    DIR* dp = malloc(sizeof(*dp));
+ 2e5:	83 ec 0c             	sub    $0xc,%esp
+ 2e8:	6a 08                	push   $0x8
+ 2ea:	e8 4d 05 00 00       	call   83c <malloc>
+ 2ef:	83 c4 10             	add    $0x10,%esp
+ 2f2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+    dp->fd = open((char*)name, 0);
+ 2f5:	83 ec 08             	sub    $0x8,%esp
+ 2f8:	6a 00                	push   $0x0
+ 2fa:	ff 75 08             	push   0x8(%ebp)
+ 2fd:	e8 02 01 00 00       	call   404 <open>
+ 302:	83 c4 10             	add    $0x10,%esp
+ 305:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 308:	89 02                	mov    %eax,(%edx)
+    dp->child = 0;
+ 30a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 30d:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+
+    return dp;
+ 314:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 317:	c9                   	leave
+ 318:	c3                   	ret
+
+00000319 <closedir>:
+
+void closedir(DIR* dp)
+{
+ 319:	55                   	push   %ebp
+ 31a:	89 e5                	mov    %esp,%ebp
+ 31c:	83 ec 08             	sub    $0x8,%esp
+    if(dp == 0) {
+ 31f:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 323:	74 21                	je     346 <closedir+0x2d>
+        return;
+    }
+
+    close(dp->fd);
+ 325:	8b 45 08             	mov    0x8(%ebp),%eax
+ 328:	8b 00                	mov    (%eax),%eax
+ 32a:	83 ec 0c             	sub    $0xc,%esp
+ 32d:	50                   	push   %eax
+ 32e:	e8 b9 00 00 00       	call   3ec <close>
+ 333:	83 c4 10             	add    $0x10,%esp
+    free(dp);
+ 336:	83 ec 0c             	sub    $0xc,%esp
+ 339:	ff 75 08             	push   0x8(%ebp)
+ 33c:	e8 b9 03 00 00       	call   6fa <free>
+ 341:	83 c4 10             	add    $0x10,%esp
+ 344:	eb 01                	jmp    347 <closedir+0x2e>
+        return;
+ 346:	90                   	nop
+}
+ 347:	c9                   	leave
+ 348:	c3                   	ret
+
+00000349 <readdir>:
+
+struct dirent* readdir(DIR* dp)
+{
+ 349:	55                   	push   %ebp
+ 34a:	89 e5                	mov    %esp,%ebp
+ 34c:	83 ec 18             	sub    $0x18,%esp
+    if(dp == 0) {
+ 34f:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 353:	75 07                	jne    35c <readdir+0x13>
+      return 0;
+ 355:	b8 00 00 00 00       	mov    $0x0,%eax
+ 35a:	eb 5e                	jmp    3ba <readdir+0x71>
+    }
+
+    struct dirent* de = malloc(sizeof(*de));
+ 35c:	83 ec 0c             	sub    $0xc,%esp
+ 35f:	68 0c 01 00 00       	push   $0x10c
+ 364:	e8 d3 04 00 00       	call   83c <malloc>
+ 369:	83 c4 10             	add    $0x10,%esp
+ 36c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    int res = direntry(dp->fd, dp->child, de);
+ 36f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 372:	8b 50 04             	mov    0x4(%eax),%edx
+ 375:	8b 45 08             	mov    0x8(%ebp),%eax
+ 378:	8b 00                	mov    (%eax),%eax
+ 37a:	83 ec 04             	sub    $0x4,%esp
+ 37d:	ff 75 f4             	push   -0xc(%ebp)
+ 380:	52                   	push   %edx
+ 381:	50                   	push   %eax
+ 382:	e8 e5 00 00 00       	call   46c <direntry>
+ 387:	83 c4 10             	add    $0x10,%esp
+ 38a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+
+    // out of children or other error
+    if(res == -1) {
+ 38d:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+ 391:	75 15                	jne    3a8 <readdir+0x5f>
+        free(de);
+ 393:	83 ec 0c             	sub    $0xc,%esp
+ 396:	ff 75 f4             	push   -0xc(%ebp)
+ 399:	e8 5c 03 00 00       	call   6fa <free>
+ 39e:	83 c4 10             	add    $0x10,%esp
+        return 0;
+ 3a1:	b8 00 00 00 00       	mov    $0x0,%eax
+ 3a6:	eb 12                	jmp    3ba <readdir+0x71>
+    }
+
+    dp->child++;
+ 3a8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3ab:	8b 40 04             	mov    0x4(%eax),%eax
+ 3ae:	8d 50 01             	lea    0x1(%eax),%edx
+ 3b1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3b4:	89 50 04             	mov    %edx,0x4(%eax)
+    return de;
+ 3b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 3ba:	c9                   	leave
+ 3bb:	c3                   	ret
+
+000003bc <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 3bc:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3c1:	cd 40                	int    $0x40
+ 3c3:	c3                   	ret
+
+000003c4 <exit>:
+SYSCALL(exit)
+ 3c4:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3c9:	cd 40                	int    $0x40
+ 3cb:	c3                   	ret
+
+000003cc <wait>:
+SYSCALL(wait)
+ 3cc:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3d1:	cd 40                	int    $0x40
+ 3d3:	c3                   	ret
+
+000003d4 <pipe>:
+SYSCALL(pipe)
+ 3d4:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3d9:	cd 40                	int    $0x40
+ 3db:	c3                   	ret
+
+000003dc <read>:
+SYSCALL(read)
+ 3dc:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3e1:	cd 40                	int    $0x40
+ 3e3:	c3                   	ret
+
+000003e4 <write>:
+SYSCALL(write)
+ 3e4:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3e9:	cd 40                	int    $0x40
+ 3eb:	c3                   	ret
+
+000003ec <close>:
+SYSCALL(close)
+ 3ec:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3f1:	cd 40                	int    $0x40
+ 3f3:	c3                   	ret
+
+000003f4 <kill>:
+SYSCALL(kill)
+ 3f4:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3f9:	cd 40                	int    $0x40
+ 3fb:	c3                   	ret
+
+000003fc <exec>:
+SYSCALL(exec)
+ 3fc:	b8 07 00 00 00       	mov    $0x7,%eax
+ 401:	cd 40                	int    $0x40
+ 403:	c3                   	ret
+
+00000404 <open>:
+SYSCALL(open)
+ 404:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 409:	cd 40                	int    $0x40
+ 40b:	c3                   	ret
+
+0000040c <mknod>:
+SYSCALL(mknod)
+ 40c:	b8 11 00 00 00       	mov    $0x11,%eax
+ 411:	cd 40                	int    $0x40
+ 413:	c3                   	ret
+
+00000414 <unlink>:
+SYSCALL(unlink)
+ 414:	b8 12 00 00 00       	mov    $0x12,%eax
+ 419:	cd 40                	int    $0x40
+ 41b:	c3                   	ret
+
+0000041c <fstat>:
+SYSCALL(fstat)
+ 41c:	b8 08 00 00 00       	mov    $0x8,%eax
+ 421:	cd 40                	int    $0x40
+ 423:	c3                   	ret
+
+00000424 <link>:
+SYSCALL(link)
+ 424:	b8 13 00 00 00       	mov    $0x13,%eax
+ 429:	cd 40                	int    $0x40
+ 42b:	c3                   	ret
+
+0000042c <mkdir>:
+SYSCALL(mkdir)
+ 42c:	b8 14 00 00 00       	mov    $0x14,%eax
+ 431:	cd 40                	int    $0x40
+ 433:	c3                   	ret
+
+00000434 <chdir>:
+SYSCALL(chdir)
+ 434:	b8 09 00 00 00       	mov    $0x9,%eax
+ 439:	cd 40                	int    $0x40
+ 43b:	c3                   	ret
+
+0000043c <dup>:
+SYSCALL(dup)
+ 43c:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 441:	cd 40                	int    $0x40
+ 443:	c3                   	ret
+
+00000444 <getpid>:
+SYSCALL(getpid)
+ 444:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 449:	cd 40                	int    $0x40
+ 44b:	c3                   	ret
+
+0000044c <sbrk>:
+SYSCALL(sbrk)
+ 44c:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 451:	cd 40                	int    $0x40
+ 453:	c3                   	ret
+
+00000454 <sleep>:
+SYSCALL(sleep)
+ 454:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 459:	cd 40                	int    $0x40
+ 45b:	c3                   	ret
+
+0000045c <uptime>:
+SYSCALL(uptime)
+ 45c:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 461:	cd 40                	int    $0x40
+ 463:	c3                   	ret
+
+00000464 <mount>:
+SYSCALL(mount)
+ 464:	b8 16 00 00 00       	mov    $0x16,%eax
+ 469:	cd 40                	int    $0x40
+ 46b:	c3                   	ret
+
+0000046c <direntry>:
+SYSCALL(direntry)
+ 46c:	b8 17 00 00 00       	mov    $0x17,%eax
+ 471:	cd 40                	int    $0x40
+ 473:	c3                   	ret
+
+00000474 <sync>:
+SYSCALL(sync)
+ 474:	b8 18 00 00 00       	mov    $0x18,%eax
+ 479:	cd 40                	int    $0x40
+ 47b:	c3                   	ret
+
+0000047c <fsync>:
+SYSCALL(fsync)
+ 47c:	b8 19 00 00 00       	mov    $0x19,%eax
+ 481:	cd 40                	int    $0x40
+ 483:	c3                   	ret
+
+00000484 <mmap>:
+SYSCALL(mmap)
+ 484:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 489:	cd 40                	int    $0x40
+ 48b:	c3                   	ret
+
+0000048c <munmap>:
+SYSCALL(munmap)
+ 48c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 491:	cd 40                	int    $0x40
+ 493:	c3                   	ret
+
+00000494 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 494:	55                   	push   %ebp
+ 495:	89 e5                	mov    %esp,%ebp
+ 497:	83 ec 18             	sub    $0x18,%esp
+ 49a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 49d:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 4a0:	83 ec 04             	sub    $0x4,%esp
+ 4a3:	6a 01                	push   $0x1
+ 4a5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 4a8:	50                   	push   %eax
+ 4a9:	ff 75 08             	push   0x8(%ebp)
+ 4ac:	e8 33 ff ff ff       	call   3e4 <write>
+ 4b1:	83 c4 10             	add    $0x10,%esp
+}
+ 4b4:	90                   	nop
+ 4b5:	c9                   	leave
+ 4b6:	c3                   	ret
+
+000004b7 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 4b7:	55                   	push   %ebp
+ 4b8:	89 e5                	mov    %esp,%ebp
+ 4ba:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 4bd:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 4c4:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 4c8:	74 17                	je     4e1 <printint+0x2a>
+ 4ca:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 4ce:	79 11                	jns    4e1 <printint+0x2a>
+    neg = 1;
+ 4d0:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 4d7:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4da:	f7 d8                	neg    %eax
+ 4dc:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 4df:	eb 06                	jmp    4e7 <printint+0x30>
+  } else {
+    x = xx;
+ 4e1:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4e4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 4e7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 4ee:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 4f1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 4f4:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4f9:	f7 f1                	div    %ecx
+ 4fb:	89 d1                	mov    %edx,%ecx
+ 4fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 500:	8d 50 01             	lea    0x1(%eax),%edx
+ 503:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 506:	0f b6 91 00 20 00 00 	movzbl 0x2000(%ecx),%edx
+ 50d:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 511:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 514:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 517:	ba 00 00 00 00       	mov    $0x0,%edx
+ 51c:	f7 f1                	div    %ecx
+ 51e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 521:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 525:	75 c7                	jne    4ee <printint+0x37>
+  if(neg)
+ 527:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 52b:	74 2d                	je     55a <printint+0xa3>
+    buf[i++] = '-';
+ 52d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 530:	8d 50 01             	lea    0x1(%eax),%edx
+ 533:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 536:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 53b:	eb 1d                	jmp    55a <printint+0xa3>
+    putc(fd, buf[i]);
+ 53d:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 540:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 543:	01 d0                	add    %edx,%eax
+ 545:	0f b6 00             	movzbl (%eax),%eax
+ 548:	0f be c0             	movsbl %al,%eax
+ 54b:	83 ec 08             	sub    $0x8,%esp
+ 54e:	50                   	push   %eax
+ 54f:	ff 75 08             	push   0x8(%ebp)
+ 552:	e8 3d ff ff ff       	call   494 <putc>
+ 557:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 55a:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 55e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 562:	79 d9                	jns    53d <printint+0x86>
+}
+ 564:	90                   	nop
+ 565:	90                   	nop
+ 566:	c9                   	leave
+ 567:	c3                   	ret
+
+00000568 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 568:	55                   	push   %ebp
+ 569:	89 e5                	mov    %esp,%ebp
+ 56b:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 56e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 575:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 578:	83 c0 04             	add    $0x4,%eax
+ 57b:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 57e:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 585:	e9 59 01 00 00       	jmp    6e3 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 58a:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 58d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 590:	01 d0                	add    %edx,%eax
+ 592:	0f b6 00             	movzbl (%eax),%eax
+ 595:	0f be c0             	movsbl %al,%eax
+ 598:	25 ff 00 00 00       	and    $0xff,%eax
+ 59d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 5a0:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 5a4:	75 2c                	jne    5d2 <printf+0x6a>
+      if(c == '%'){
+ 5a6:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 5aa:	75 0c                	jne    5b8 <printf+0x50>
+        state = '%';
+ 5ac:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 5b3:	e9 27 01 00 00       	jmp    6df <printf+0x177>
+      } else {
+        putc(fd, c);
+ 5b8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 5bb:	0f be c0             	movsbl %al,%eax
+ 5be:	83 ec 08             	sub    $0x8,%esp
+ 5c1:	50                   	push   %eax
+ 5c2:	ff 75 08             	push   0x8(%ebp)
+ 5c5:	e8 ca fe ff ff       	call   494 <putc>
+ 5ca:	83 c4 10             	add    $0x10,%esp
+ 5cd:	e9 0d 01 00 00       	jmp    6df <printf+0x177>
+      }
+    } else if(state == '%'){
+ 5d2:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 5d6:	0f 85 03 01 00 00    	jne    6df <printf+0x177>
+      if(c == 'd'){
+ 5dc:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 5e0:	75 1e                	jne    600 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 5e2:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5e5:	8b 00                	mov    (%eax),%eax
+ 5e7:	6a 01                	push   $0x1
+ 5e9:	6a 0a                	push   $0xa
+ 5eb:	50                   	push   %eax
+ 5ec:	ff 75 08             	push   0x8(%ebp)
+ 5ef:	e8 c3 fe ff ff       	call   4b7 <printint>
+ 5f4:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 5f7:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 5fb:	e9 d8 00 00 00       	jmp    6d8 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 600:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 604:	74 06                	je     60c <printf+0xa4>
+ 606:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 60a:	75 1e                	jne    62a <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 60c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 60f:	8b 00                	mov    (%eax),%eax
+ 611:	6a 00                	push   $0x0
+ 613:	6a 10                	push   $0x10
+ 615:	50                   	push   %eax
+ 616:	ff 75 08             	push   0x8(%ebp)
+ 619:	e8 99 fe ff ff       	call   4b7 <printint>
+ 61e:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 621:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 625:	e9 ae 00 00 00       	jmp    6d8 <printf+0x170>
+      } else if(c == 's'){
+ 62a:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 62e:	75 43                	jne    673 <printf+0x10b>
+        s = (char*)*ap;
+ 630:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 633:	8b 00                	mov    (%eax),%eax
+ 635:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 638:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 63c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 640:	75 25                	jne    667 <printf+0xff>
+          s = "(null)";
+ 642:	c7 45 f4 33 10 00 00 	movl   $0x1033,-0xc(%ebp)
+        while(*s != 0){
+ 649:	eb 1c                	jmp    667 <printf+0xff>
+          putc(fd, *s);
+ 64b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 64e:	0f b6 00             	movzbl (%eax),%eax
+ 651:	0f be c0             	movsbl %al,%eax
+ 654:	83 ec 08             	sub    $0x8,%esp
+ 657:	50                   	push   %eax
+ 658:	ff 75 08             	push   0x8(%ebp)
+ 65b:	e8 34 fe ff ff       	call   494 <putc>
+ 660:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 663:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 667:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 66a:	0f b6 00             	movzbl (%eax),%eax
+ 66d:	84 c0                	test   %al,%al
+ 66f:	75 da                	jne    64b <printf+0xe3>
+ 671:	eb 65                	jmp    6d8 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 673:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 677:	75 1d                	jne    696 <printf+0x12e>
+        putc(fd, *ap);
+ 679:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 67c:	8b 00                	mov    (%eax),%eax
+ 67e:	0f be c0             	movsbl %al,%eax
+ 681:	83 ec 08             	sub    $0x8,%esp
+ 684:	50                   	push   %eax
+ 685:	ff 75 08             	push   0x8(%ebp)
+ 688:	e8 07 fe ff ff       	call   494 <putc>
+ 68d:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 690:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 694:	eb 42                	jmp    6d8 <printf+0x170>
+      } else if(c == '%'){
+ 696:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 69a:	75 17                	jne    6b3 <printf+0x14b>
+        putc(fd, c);
+ 69c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 69f:	0f be c0             	movsbl %al,%eax
+ 6a2:	83 ec 08             	sub    $0x8,%esp
+ 6a5:	50                   	push   %eax
+ 6a6:	ff 75 08             	push   0x8(%ebp)
+ 6a9:	e8 e6 fd ff ff       	call   494 <putc>
+ 6ae:	83 c4 10             	add    $0x10,%esp
+ 6b1:	eb 25                	jmp    6d8 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 6b3:	83 ec 08             	sub    $0x8,%esp
+ 6b6:	6a 25                	push   $0x25
+ 6b8:	ff 75 08             	push   0x8(%ebp)
+ 6bb:	e8 d4 fd ff ff       	call   494 <putc>
+ 6c0:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 6c3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 6c6:	0f be c0             	movsbl %al,%eax
+ 6c9:	83 ec 08             	sub    $0x8,%esp
+ 6cc:	50                   	push   %eax
+ 6cd:	ff 75 08             	push   0x8(%ebp)
+ 6d0:	e8 bf fd ff ff       	call   494 <putc>
+ 6d5:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 6d8:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 6df:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 6e3:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 6e6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 6e9:	01 d0                	add    %edx,%eax
+ 6eb:	0f b6 00             	movzbl (%eax),%eax
+ 6ee:	84 c0                	test   %al,%al
+ 6f0:	0f 85 94 fe ff ff    	jne    58a <printf+0x22>
+    }
+  }
+}
+ 6f6:	90                   	nop
+ 6f7:	90                   	nop
+ 6f8:	c9                   	leave
+ 6f9:	c3                   	ret
+
+000006fa <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 6fa:	55                   	push   %ebp
+ 6fb:	89 e5                	mov    %esp,%ebp
+ 6fd:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 700:	8b 45 08             	mov    0x8(%ebp),%eax
+ 703:	83 e8 08             	sub    $0x8,%eax
+ 706:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 709:	a1 1c 20 00 00       	mov    0x201c,%eax
+ 70e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 711:	eb 24                	jmp    737 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 713:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 716:	8b 00                	mov    (%eax),%eax
+ 718:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 71b:	72 12                	jb     72f <free+0x35>
+ 71d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 720:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 723:	72 24                	jb     749 <free+0x4f>
+ 725:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 728:	8b 00                	mov    (%eax),%eax
+ 72a:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 72d:	72 1a                	jb     749 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 72f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 732:	8b 00                	mov    (%eax),%eax
+ 734:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 737:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 73a:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 73d:	73 d4                	jae    713 <free+0x19>
+ 73f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 742:	8b 00                	mov    (%eax),%eax
+ 744:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 747:	73 ca                	jae    713 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 749:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 74c:	8b 40 04             	mov    0x4(%eax),%eax
+ 74f:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 756:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 759:	01 c2                	add    %eax,%edx
+ 75b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 75e:	8b 00                	mov    (%eax),%eax
+ 760:	39 c2                	cmp    %eax,%edx
+ 762:	75 24                	jne    788 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 764:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 767:	8b 50 04             	mov    0x4(%eax),%edx
+ 76a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 76d:	8b 00                	mov    (%eax),%eax
+ 76f:	8b 40 04             	mov    0x4(%eax),%eax
+ 772:	01 c2                	add    %eax,%edx
+ 774:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 777:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 77a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 77d:	8b 00                	mov    (%eax),%eax
+ 77f:	8b 10                	mov    (%eax),%edx
+ 781:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 784:	89 10                	mov    %edx,(%eax)
+ 786:	eb 0a                	jmp    792 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 788:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 78b:	8b 10                	mov    (%eax),%edx
+ 78d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 790:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 792:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 795:	8b 40 04             	mov    0x4(%eax),%eax
+ 798:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 79f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7a2:	01 d0                	add    %edx,%eax
+ 7a4:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 7a7:	75 20                	jne    7c9 <free+0xcf>
+    p->s.size += bp->s.size;
+ 7a9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7ac:	8b 50 04             	mov    0x4(%eax),%edx
+ 7af:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7b2:	8b 40 04             	mov    0x4(%eax),%eax
+ 7b5:	01 c2                	add    %eax,%edx
+ 7b7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7ba:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 7bd:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7c0:	8b 10                	mov    (%eax),%edx
+ 7c2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7c5:	89 10                	mov    %edx,(%eax)
+ 7c7:	eb 08                	jmp    7d1 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 7c9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7cc:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 7cf:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 7d1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7d4:	a3 1c 20 00 00       	mov    %eax,0x201c
+}
+ 7d9:	90                   	nop
+ 7da:	c9                   	leave
+ 7db:	c3                   	ret
+
+000007dc <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 7dc:	55                   	push   %ebp
+ 7dd:	89 e5                	mov    %esp,%ebp
+ 7df:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 7e2:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 7e9:	77 07                	ja     7f2 <morecore+0x16>
+    nu = 4096;
+ 7eb:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 7f2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7f5:	c1 e0 03             	shl    $0x3,%eax
+ 7f8:	83 ec 0c             	sub    $0xc,%esp
+ 7fb:	50                   	push   %eax
+ 7fc:	e8 4b fc ff ff       	call   44c <sbrk>
+ 801:	83 c4 10             	add    $0x10,%esp
+ 804:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 807:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 80b:	75 07                	jne    814 <morecore+0x38>
+    return 0;
+ 80d:	b8 00 00 00 00       	mov    $0x0,%eax
+ 812:	eb 26                	jmp    83a <morecore+0x5e>
+  hp = (Header*)p;
+ 814:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 817:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 81a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 81d:	8b 55 08             	mov    0x8(%ebp),%edx
+ 820:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 823:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 826:	83 c0 08             	add    $0x8,%eax
+ 829:	83 ec 0c             	sub    $0xc,%esp
+ 82c:	50                   	push   %eax
+ 82d:	e8 c8 fe ff ff       	call   6fa <free>
+ 832:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 835:	a1 1c 20 00 00       	mov    0x201c,%eax
+}
+ 83a:	c9                   	leave
+ 83b:	c3                   	ret
+
+0000083c <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 83c:	55                   	push   %ebp
+ 83d:	89 e5                	mov    %esp,%ebp
+ 83f:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 842:	8b 45 08             	mov    0x8(%ebp),%eax
+ 845:	83 c0 07             	add    $0x7,%eax
+ 848:	c1 e8 03             	shr    $0x3,%eax
+ 84b:	83 c0 01             	add    $0x1,%eax
+ 84e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 851:	a1 1c 20 00 00       	mov    0x201c,%eax
+ 856:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 859:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 85d:	75 23                	jne    882 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 85f:	c7 45 f0 14 20 00 00 	movl   $0x2014,-0x10(%ebp)
+ 866:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 869:	a3 1c 20 00 00       	mov    %eax,0x201c
+ 86e:	a1 1c 20 00 00       	mov    0x201c,%eax
+ 873:	a3 14 20 00 00       	mov    %eax,0x2014
+    base.s.size = 0;
+ 878:	c7 05 18 20 00 00 00 	movl   $0x0,0x2018
+ 87f:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 882:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 885:	8b 00                	mov    (%eax),%eax
+ 887:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 88a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 88d:	8b 40 04             	mov    0x4(%eax),%eax
+ 890:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 893:	72 4d                	jb     8e2 <malloc+0xa6>
+      if(p->s.size == nunits)
+ 895:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 898:	8b 40 04             	mov    0x4(%eax),%eax
+ 89b:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 89e:	75 0c                	jne    8ac <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 8a0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8a3:	8b 10                	mov    (%eax),%edx
+ 8a5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8a8:	89 10                	mov    %edx,(%eax)
+ 8aa:	eb 26                	jmp    8d2 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 8ac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8af:	8b 40 04             	mov    0x4(%eax),%eax
+ 8b2:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 8b5:	89 c2                	mov    %eax,%edx
+ 8b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8ba:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 8bd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8c0:	8b 40 04             	mov    0x4(%eax),%eax
+ 8c3:	c1 e0 03             	shl    $0x3,%eax
+ 8c6:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 8c9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8cc:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 8cf:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 8d2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8d5:	a3 1c 20 00 00       	mov    %eax,0x201c
+      return (void*)(p + 1);
+ 8da:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8dd:	83 c0 08             	add    $0x8,%eax
+ 8e0:	eb 3b                	jmp    91d <malloc+0xe1>
+    }
+    if(p == freep)
+ 8e2:	a1 1c 20 00 00       	mov    0x201c,%eax
+ 8e7:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 8ea:	75 1e                	jne    90a <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 8ec:	83 ec 0c             	sub    $0xc,%esp
+ 8ef:	ff 75 ec             	push   -0x14(%ebp)
+ 8f2:	e8 e5 fe ff ff       	call   7dc <morecore>
+ 8f7:	83 c4 10             	add    $0x10,%esp
+ 8fa:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 8fd:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 901:	75 07                	jne    90a <malloc+0xce>
+        return 0;
+ 903:	b8 00 00 00 00       	mov    $0x0,%eax
+ 908:	eb 13                	jmp    91d <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 90a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 90d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 910:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 913:	8b 00                	mov    (%eax),%eax
+ 915:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 918:	e9 6d ff ff ff       	jmp    88a <malloc+0x4e>
+  }
+}
+ 91d:	c9                   	leave
+ 91e:	c3                   	ret
@@ -8,17 +8,20 @@
 
 #define VFS_BLOCK_SIZE 512
 
-#define SFS_MAGIC 0x3F3C007
+#define SFS_MAGIC 0x3F3C00B
 #define SFS_MAX_LENGTH 32
-#define SFS_MAX_CHILDREN 16
-#define SFS_MAX_INDIRECT_BLOCKS 64
-#define SFS_SB_INODE_BITSIZE 4
-#define SFS_SB_BLOCK_BITSIZE 120
+#define SFS_MAX_EXTENTS 8
+#define SFS_ITABLE_START 1
+#define SFS_BPB (VFS_BLOCK_SIZE * 8)
+
+// one inode per this many blocks of the partition
+#define SFS_BLOCKS_PER_INODE 8
 
 struct superblock {
     int magic, root;
-    int finode[SFS_SB_INODE_BITSIZE];
-    int fblock[SFS_SB_BLOCK_BITSIZE];
+    int ninodes, data_start;
+    int ibitmap, bbitmap;
+    int rotor;
 };
 
 enum sfs_type {
@@ -26,51 +29,86 @@ enum sfs_type {
     SFS_INODE_FILE
 };
 
-struct inode {
+struct extent {
+    int start, len;
+};
+
+#define SFS_EXTENTS_PER_BLOCK ((VFS_BLOCK_SIZE - 2 * sizeof(int)) / sizeof(struct extent))
+
+struct extent_block {
+    int next, n_ext;
+    struct extent ext[SFS_EXTENTS_PER_BLOCK];
+};
+
+struct dirent {
+    unsigned hash;
+    int inum;
+    char name[SFS_MAX_LENGTH];
+};
+
+#define SFS_DIRENTS ((VFS_BLOCK_SIZE - sizeof(int)) / sizeof(struct dirent))
+
+struct dirblock {
+    int count;
+    struct dirent ent[SFS_DIRENTS];
+};
+
+struct dinode {
     char name[SFS_MAX_LENGTH];
     int type, inum;
 
     int parent;
 
-    int child[SFS_MAX_CHILDREN];
-    int indir[SFS_MAX_INDIRECT_BLOCKS];
+    struct extent ext[SFS_MAX_EXTENTS];
+    int n_ext, ext_next;
 
     int n_child, size;
     int n_blocks;
 };
 
+#define SFS_IPB (VFS_BLOCK_SIZE / sizeof(struct dinode))
+
+// number of blocks in the partition being formatted
+static int part_blocks;
+
+// inode and block bitmaps, written out to sb->ibitmap and sb->bbitmap at the end
+static int* imap;
+static int* bmap;
+
 static inline void set_bit(int* map, int bit)
 {
     *map |= (1 << bit);
 }
 
-static void write_inode(struct inode* ip, FILE* fp, int off)
+static void write_inode(struct dinode* ip, FILE* fp, int off)
 {
-    int block = ip->inum + 1;
+    int block = SFS_ITABLE_START + ip->inum / SFS_IPB;
+    int slot = ip->inum % SFS_IPB;
 
-    fseek(fp, off + block * VFS_BLOCK_SIZE, 0);
+    fseek(fp, off + (block + 1) * VFS_BLOCK_SIZE + slot * sizeof(*ip), 0);
     fwrite(ip, sizeof(*ip), 1, fp);
 }
 
-static struct inode* make_inode(const char* name, struct superblock* sb)
+static struct dinode* make_inode(const char* name, struct superblock* sb)
 {
-    struct inode* ip = calloc(1, sizeof(*ip));
+    struct dinode* ip = calloc(1, sizeof(*ip));
 
     int fpos = 0;
-    ip->inum = ffs(~(sb->finode[fpos])) - 1;
+    int bit = ffs(~(imap[fpos])) - 1;
 
-    while(ip->inum == -1) {
+    while(bit == -1) {
         fpos++;
 
-        if(fpos >= SFS_SB_INODE_BITSIZE) {
+        if(fpos >= sb->ninodes / 32) {
             printf("error. out of inodes!\n");
             exit(-1);
         }
 
-        ip->inum = ffs(~(sb->finode[fpos])) - 1;
+        bit = ffs(~(imap[fpos])) - 1;
     }
 
-    set_bit(&sb->finode[fpos], ip->inum);
+    set_bit(&imap[fpos], bit);
+    ip->inum = fpos * 32 + bit;
 
     ip->parent = 1;
     ip->type = SFS_INODE_FILE;
@@ -82,7 +120,90 @@ static struct inode* make_inode(const char* name, struct superblock* sb)
     return ip;
 }
 
-static void write_blocks(struct inode* ip, struct superblock* sb, const char* file, FILE* fsp, int off)
+static int alloc_block(struct superblock* sb)
+{
+    int fpos = 0;
+    int bit = ffs(~(bmap[fpos])) - 1;
+
+    while(bit == -1) {
+        fpos++;
+
+        if(fpos * 32 >= part_blocks - sb->data_start) {
+            printf("error. out of file blocks\n");
+            exit(-1);
+        }
+
+        bit = ffs(~(bmap[fpos])) - 1;
+    }
+
+    int b_num = fpos * 32 + bit + sb->data_start;
+
+    if(b_num >= part_blocks) {
+        printf("error. out of file blocks\n");
+        exit(-1);
+    }
+
+    set_bit(&bmap[fpos], bit);
+    return b_num;
+}
+
+static void write_block(FILE* fsp, int off, int b_num, const void* block)
+{
+    fseek(fsp, off + VFS_BLOCK_SIZE * (b_num + 1), 0);
+    fwrite(block, VFS_BLOCK_SIZE, 1, fsp);
+}
+
+// Record the file's blocks as extents: in the inode first, then in a chain
+// of indirect extent blocks
+static void write_extents(struct dinode* ip, struct superblock* sb, const int* blocks, int count, FILE* fsp, int off)
+{
+    struct extent_block eb;
+    int cur = 0;
+
+    memset(&eb, 0, sizeof(eb));
+
+    for(int i = 0; i < count; i++) {
+        int b_num = blocks[i];
+
+        struct extent* ext = cur == 0 ? ip->ext : eb.ext;
+        int* n_ext = cur == 0 ? &ip->n_ext : &eb.n_ext;
+        int max = cur == 0 ? SFS_MAX_EXTENTS : SFS_EXTENTS_PER_BLOCK;
+
+        if(*n_ext > 0 && ext[*n_ext - 1].start + ext[*n_ext - 1].len == b_num) {
+            ext[*n_ext - 1].len++;
+            continue;
+        }
+
+        if(*n_ext == max) {
+            int next = alloc_block(sb);
+
+            if(cur == 0) {
+                ip->ext_next = next;
+            }
+            else {
+                eb.next = next;
+                write_block(fsp, off, cur, &eb);
+                memset(&eb, 0, sizeof(eb));
+            }
+
+            cur = next;
+            ext = eb.ext;
+            n_ext = &eb.n_ext;
+        }
+
+        ext[*n_ext].start = b_num;
+        ext[*n_ext].len = 1;
+        (*n_ext)++;
+    }
+
+    if(cur != 0) {
+        write_block(fsp, off, cur, &eb);
+    }
+
+    ip->n_blocks = count;
+}
+
+static void write_blocks(struct dinode* ip, struct superblock* sb, const char* file, FILE* fsp, int off)
 {
     FILE* fp = fopen(file, "rb");
 
@@ -92,46 +213,83 @@ static void write_blocks(struct inode* ip, struct superblock* sb, const char* fi
 
     ip->size = sz;
     int count = (sz + VFS_BLOCK_SIZE - 1) / VFS_BLOCK_SIZE;
-
-    if(count > SFS_MAX_INDIRECT_BLOCKS) {
-        printf("warning. file is too big, skipping\n");
-        fclose(fp);
-
-        return;
-    }
+    int* blocks = calloc(count + 1, sizeof(int));
 
     for(int i = 0; i < count; i++) {
         char block[VFS_BLOCK_SIZE];
         memset(block, 0, VFS_BLOCK_SIZE);
 
-        int fpos = 0;
-        int bit = ffs(~(sb->fblock[fpos])) - 1;
+        blocks[i] = alloc_block(sb);
+
+        fread(block, VFS_BLOCK_SIZE, 1, fp);
+        write_block(fsp, off, blocks[i], block);
+    }
+
+    write_extents(ip, sb, blocks, count, fsp, off);
+
+    free(blocks);
+    fclose(fp);
+}
+
+// FNV-1a, same as the kernel
+static unsigned name_hash(const char* name)
+{
+    unsigned h = 2166136261u;
+
+    for(; *name != '\0'; name++) {
+        h ^= (unsigned char)*name;
+        h *= 16777619u;
+    }
 
-        while(bit == -1) {
-            fpos++;
+    return h;
+}
+
+// Write out a directory: a hash table with the fewest (power of two)
+// buckets that holds all entries without overflowing
+static void write_dir(struct dinode* dp, struct superblock* sb, struct dirent* ents, int n, FILE* fsp, int off)
+{
+    int buckets = n == 0 ? 0 : 1;
+    char (*blocks)[VFS_BLOCK_SIZE] = 0;
 
-            if(fpos >= SFS_SB_BLOCK_BITSIZE) {
-                printf("error. out of file blocks\n");
-                exit(-1);
+    while(buckets != 0) {
+        blocks = calloc(buckets, VFS_BLOCK_SIZE);
+        int i;
+
+        for(i = 0; i < n; i++) {
+            struct dirblock* db = (struct dirblock*)blocks[ents[i].hash & (buckets - 1)];
+
+            if(db->count == SFS_DIRENTS) {
+                break;
             }
 
-            bit = ffs(~(sb->fblock[fpos])) - 1;
+            db->ent[db->count++] = ents[i];
+        }
+
+        if(i == n) {
+            break;
         }
 
-        ip->indir[i] = fpos * 32 + bit + 128;
-        set_bit(&sb->fblock[fpos], bit);
+        free(blocks);
+        buckets *= 2;
+    }
 
-        fread(block, VFS_BLOCK_SIZE, 1, fp);
+    int* b_nums = calloc(buckets + 1, sizeof(int));
 
-        fseek(fsp, off + VFS_BLOCK_SIZE * (ip->indir[i] + 1), 0);
-        fwrite(block, VFS_BLOCK_SIZE, 1, fsp);
+    for(int i = 0; i < buckets; i++) {
+        b_nums[i] = alloc_block(sb);
+        write_block(fsp, off, b_nums[i], blocks[i]);
     }
 
-    ip->n_blocks += count;
-    fclose(fp);
+    write_extents(dp, sb, b_nums, buckets, fsp, off);
+
+    dp->size = buckets * VFS_BLOCK_SIZE;
+    dp->n_child = n;
+
+    free(b_nums);
+    free(blocks);
 }
 
-#define DISK_SIZE (512 * 1024)
+#define DISK_SIZE (2 * 1024 * 1024)
 
 void make_disk(const char* path)
 {
@@ -229,28 +387,66 @@ int main(int argc, const char* argv[])
         return -1;
     }
 
+    part_blocks = mbr->p[part].count;
+
     // create superblock
     struct superblock* sb = calloc(1, sizeof(*sb));
     sb->magic = SFS_MAGIC;
     sb->root = 1;
 
+    // size the inode table to the partition, in whole bitmap words
+    sb->ninodes = part_blocks / SFS_BLOCKS_PER_INODE / 32 * 32;
+
+    if(sb->ninodes == 0) {
+        printf("error. partition too small\n");
+        return -1;
+    }
+
+    int ibitmap_blocks = (sb->ninodes + SFS_BPB - 1) / SFS_BPB;
+
+    sb->ibitmap = SFS_ITABLE_START + sb->ninodes / SFS_IPB;
+    sb->bbitmap = sb->ibitmap + ibitmap_blocks;
+
+    // enough block bitmap for everything after it (a bit more than the
+    // data blocks)
+    int bbitmap_blocks = (part_blocks - sb->bbitmap + SFS_BPB - 1) / SFS_BPB;
+
+    sb->data_start = sb->bbitmap + bbitmap_blocks;
+
+    if(sb->data_start >= part_blocks) {
+        printf("error. partition too small\n");
+        return -1;
+    }
+
+    imap = calloc(ibitmap_blocks, VFS_BLOCK_SIZE);
+    bmap = calloc(bbitmap_blocks, VFS_BLOCK_SIZE);
+
+    // clear the inode table
+    char zero[VFS_BLOCK_SIZE];
+    memset(zero, 0, VFS_BLOCK_SIZE);
+
+    for(int b = SFS_ITABLE_START; b < sb->ibitmap; b++) {
+        write_block(fp, off, b, zero);
+    }
+
     // create root inode
-    set_bit(&sb->finode[0], 0);
-    set_bit(&sb->finode[0], 1);
+    set_bit(&imap[0], 0);
+    set_bit(&imap[0], 1);
 
-    struct inode* root = calloc(1, sizeof(*root));
+    struct dinode* root = calloc(1, sizeof(*root));
     strcpy(root->name, "/");
 
     root->type = SFS_INODE_DIR;
     root->inum = 1;
     root->parent = root->inum;
 
+    struct dirent* ents = calloc(argc, sizeof(*ents));
     int pos = 0;
 
     for(int i = 3; i < argc; i++) {
         // ignore the leading underscore
         const char* file = argv[i][0] == '_' ? argv[i] + 1 : argv[i];
-        struct inode* ip = make_inode(file, sb);
+        struct dinode* ip = make_inode(file, sb);
 
         // write out the blocks
         write_blocks(ip, sb, argv[i], fp, off);
@@ -258,17 +454,34 @@ int main(int argc, const char* argv[])
         // write the inode
         write_inode(ip, fp, off);
 
-        root->child[pos] = ip->inum;
+        ents[pos].hash = name_hash(ip->name);
+        ents[pos].inum = ip->inum;
+        strncpy(ents[pos].name, ip->name, SFS_MAX_LENGTH);
         pos++;
 
         free(ip);
     }
 
-    root->n_child = pos;
+    write_dir(root, sb, ents, pos, fp, off);
+    free(ents);
 
     // write root inode
     write_inode(root, fp, off);
 
+    // write the inode bitmap
+    for(int b = 0; b < ibitmap_blocks; b++) {
+        write_block(fp, off, sb->ibitmap + b, (char*)imap + b * VFS_BLOCK_SIZE);
+    }
+
+    free(imap);
+
+    // write the block bitmap
+    for(int b = 0; b < bbitmap_blocks; b++) {
+        write_block(fp, off, sb->bbitmap + b, (char*)bmap + b * VFS_BLOCK_SIZE);
+    }
+
+    free(bmap);
+
     // write superblock
     fseek(fp, off + VFS_BLOCK_SIZE, 0);
     fwrite(sb, sizeof(*sb), 1, fp);
@@ -0,0 +1,13 @@
+// Memory-mapped files
+
+// mmap() protection
+#define PROT_NONE   0x0
+#define PROT_READ   0x1
+#define PROT_WRITE  0x2
+
+// mmap() flags: shared mappings see the file itself (and are read-only),
+// private mappings get a copy of each page they write to
+#define MAP_SHARED  0x1
+#define MAP_PRIVATE 0x2
+
+#define MAP_FAILED  ((void*)-1)
@@ -141,6 +141,13 @@ struct segdesc {
 #define PTE_D           0x040   // Dirty
 #define PTE_PS          0x080   // Page Size
 #define PTE_MBZ         0x180   // Bits must be zero
+#define PTE_PCACHE      0x200   // Page belongs to the page cache (software bit)
+#define PTE_COW         0x400   // Shared copy-on-write page (software bit)
+
+// Page fault error code bits
+#define FEC_PR          0x1     // Page was present (protection violation)
+#define FEC_WR          0x2     // Fault was caused by a write
+#define FEC_U           0x4     // Fault happened in user mode
 
 // Address in page table or page directory entry
 #define PTE_ADDR(pte)   ((uint)(pte) & ~0xFFF)
@@ -0,0 +1,1254 @@
+
+_mount:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+int main(int argc, const char* argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 14             	sub    $0x14,%esp
+  11:	89 c8                	mov    %ecx,%eax
+    if(argc < 3) {
+  13:	83 38 02             	cmpl   $0x2,(%eax)
+  16:	7f 29                	jg     41 <main+0x41>
+        printf(1, "error. expected device and path\n");
+  18:	83 ec 08             	sub    $0x8,%esp
+  1b:	68 00 10 00 00       	push   $0x1000
+  20:	6a 01                	push   $0x1
+  22:	e8 1f 05 00 00       	call   546 <printf>
+  27:	83 c4 10             	add    $0x10,%esp
+        printf(1, "e.g. mount /dev/sda1 /mnt\n");
+  2a:	83 ec 08             	sub    $0x8,%esp
+  2d:	68 21 10 00 00       	push   $0x1021
+  32:	6a 01                	push   $0x1
+  34:	e8 0d 05 00 00       	call   546 <printf>
+  39:	83 c4 10             	add    $0x10,%esp
+        exit();
+  3c:	e8 61 03 00 00       	call   3a2 <exit>
+    }
+
+    const char* dev = argv[1];
+  41:	8b 50 04             	mov    0x4(%eax),%edx
+  44:	8b 52 04             	mov    0x4(%edx),%edx
+  47:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    const char* mnt = argv[2];
+  4a:	8b 40 04             	mov    0x4(%eax),%eax
+  4d:	8b 40 08             	mov    0x8(%eax),%eax
+  50:	89 45 f0             	mov    %eax,-0x10(%ebp)
+
+    mount(dev, mnt, "sfs");
+  53:	83 ec 04             	sub    $0x4,%esp
+  56:	68 3c 10 00 00       	push   $0x103c
+  5b:	ff 75 f0             	push   -0x10(%ebp)
+  5e:	ff 75 f4             	push   -0xc(%ebp)
+  61:	e8 dc 03 00 00       	call   442 <mount>
+  66:	83 c4 10             	add    $0x10,%esp
+    exit();
+  69:	e8 34 03 00 00       	call   3a2 <exit>
+
+0000006e <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+  6e:	55                   	push   %ebp
+  6f:	89 e5                	mov    %esp,%ebp
+  71:	57                   	push   %edi
+  72:	53                   	push   %ebx
+    if(cc < 1)
+  73:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  76:	8b 55 10             	mov    0x10(%ebp),%edx
+  79:	8b 45 0c             	mov    0xc(%ebp),%eax
+  7c:	89 cb                	mov    %ecx,%ebx
+  7e:	89 df                	mov    %ebx,%edi
+  80:	89 d1                	mov    %edx,%ecx
+  82:	fc                   	cld
+  83:	f3 aa                	rep stos %al,%es:(%edi)
+  85:	89 ca                	mov    %ecx,%edx
+  87:	89 fb                	mov    %edi,%ebx
+  89:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  8c:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+  8f:	90                   	nop
+  90:	5b                   	pop    %ebx
+  91:	5f                   	pop    %edi
+  92:	5d                   	pop    %ebp
+  93:	c3                   	ret
+
+00000094 <strcpy>:
+{
+  94:	55                   	push   %ebp
+  95:	89 e5                	mov    %esp,%ebp
+  97:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+  9a:	8b 45 08             	mov    0x8(%ebp),%eax
+  9d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+  a0:	90                   	nop
+  a1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  a4:	8d 42 01             	lea    0x1(%edx),%eax
+  a7:	89 45 0c             	mov    %eax,0xc(%ebp)
+  aa:	8b 45 08             	mov    0x8(%ebp),%eax
+  ad:	8d 48 01             	lea    0x1(%eax),%ecx
+  b0:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  b3:	0f b6 12             	movzbl (%edx),%edx
+  b6:	88 10                	mov    %dl,(%eax)
+  b8:	0f b6 00             	movzbl (%eax),%eax
+  bb:	84 c0                	test   %al,%al
+  bd:	75 e2                	jne    a1 <strcpy+0xd>
+  return os;
+  bf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  c2:	c9                   	leave
+  c3:	c3                   	ret
+
+000000c4 <strcmp>:
+{
+  c4:	55                   	push   %ebp
+  c5:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+  c7:	eb 08                	jmp    d1 <strcmp+0xd>
+    p++, q++;
+  c9:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  cd:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+  d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  d4:	0f b6 00             	movzbl (%eax),%eax
+  d7:	84 c0                	test   %al,%al
+  d9:	74 10                	je     eb <strcmp+0x27>
+  db:	8b 45 08             	mov    0x8(%ebp),%eax
+  de:	0f b6 10             	movzbl (%eax),%edx
+  e1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  e4:	0f b6 00             	movzbl (%eax),%eax
+  e7:	38 c2                	cmp    %al,%dl
+  e9:	74 de                	je     c9 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+  eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  ee:	0f b6 00             	movzbl (%eax),%eax
+  f1:	0f b6 d0             	movzbl %al,%edx
+  f4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  f7:	0f b6 00             	movzbl (%eax),%eax
+  fa:	0f b6 c0             	movzbl %al,%eax
+  fd:	29 c2                	sub    %eax,%edx
+  ff:	89 d0                	mov    %edx,%eax
+}
+ 101:	5d                   	pop    %ebp
+ 102:	c3                   	ret
+
+00000103 <strlen>:
+{
+ 103:	55                   	push   %ebp
+ 104:	89 e5                	mov    %esp,%ebp
+ 106:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 109:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 110:	eb 04                	jmp    116 <strlen+0x13>
+ 112:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 116:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 119:	8b 45 08             	mov    0x8(%ebp),%eax
+ 11c:	01 d0                	add    %edx,%eax
+ 11e:	0f b6 00             	movzbl (%eax),%eax
+ 121:	84 c0                	test   %al,%al
+ 123:	75 ed                	jne    112 <strlen+0xf>
+  return n;
+ 125:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 128:	c9                   	leave
+ 129:	c3                   	ret
+
+0000012a <memset>:
+{
+ 12a:	55                   	push   %ebp
+ 12b:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 12d:	8b 45 10             	mov    0x10(%ebp),%eax
+ 130:	50                   	push   %eax
+ 131:	ff 75 0c             	push   0xc(%ebp)
+ 134:	ff 75 08             	push   0x8(%ebp)
+ 137:	e8 32 ff ff ff       	call   6e <stosb>
+ 13c:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 13f:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 142:	c9                   	leave
+ 143:	c3                   	ret
+
+00000144 <strchr>:
+{
+ 144:	55                   	push   %ebp
+ 145:	89 e5                	mov    %esp,%ebp
+ 147:	83 ec 04             	sub    $0x4,%esp
+ 14a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 14d:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 150:	eb 14                	jmp    166 <strchr+0x22>
+    if(*s == c)
+ 152:	8b 45 08             	mov    0x8(%ebp),%eax
+ 155:	0f b6 00             	movzbl (%eax),%eax
+ 158:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 15b:	75 05                	jne    162 <strchr+0x1e>
+      return (char*)s;
+ 15d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 160:	eb 13                	jmp    175 <strchr+0x31>
+  for(; *s; s++)
+ 162:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 166:	8b 45 08             	mov    0x8(%ebp),%eax
+ 169:	0f b6 00             	movzbl (%eax),%eax
+ 16c:	84 c0                	test   %al,%al
+ 16e:	75 e2                	jne    152 <strchr+0xe>
+  return 0;
+ 170:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 175:	c9                   	leave
+ 176:	c3                   	ret
+
+00000177 <gets>:
+{
+ 177:	55                   	push   %ebp
+ 178:	89 e5                	mov    %esp,%ebp
+ 17a:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 17d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 184:	eb 42                	jmp    1c8 <gets+0x51>
+    cc = read(0, &c, 1);
+ 186:	83 ec 04             	sub    $0x4,%esp
+ 189:	6a 01                	push   $0x1
+ 18b:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 18e:	50                   	push   %eax
+ 18f:	6a 00                	push   $0x0
+ 191:	e8 24 02 00 00       	call   3ba <read>
+ 196:	83 c4 10             	add    $0x10,%esp
+ 199:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 19c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 1a0:	7e 33                	jle    1d5 <gets+0x5e>
+    buf[i++] = c;
+ 1a2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1a5:	8d 50 01             	lea    0x1(%eax),%edx
+ 1a8:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 1ab:	89 c2                	mov    %eax,%edx
+ 1ad:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b0:	01 c2                	add    %eax,%edx
+ 1b2:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1b6:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 1b8:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1bc:	3c 0a                	cmp    $0xa,%al
+ 1be:	74 16                	je     1d6 <gets+0x5f>
+ 1c0:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1c4:	3c 0d                	cmp    $0xd,%al
+ 1c6:	74 0e                	je     1d6 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 1c8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1cb:	83 c0 01             	add    $0x1,%eax
+ 1ce:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 1d1:	7f b3                	jg     186 <gets+0xf>
+ 1d3:	eb 01                	jmp    1d6 <gets+0x5f>
+      break;
+ 1d5:	90                   	nop
+  }
+  buf[i] = '\0';
+ 1d6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 1d9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1dc:	01 d0                	add    %edx,%eax
+ 1de:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 1e1:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1e4:	c9                   	leave
+ 1e5:	c3                   	ret
+
+000001e6 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 1e6:	55                   	push   %ebp
+ 1e7:	89 e5                	mov    %esp,%ebp
+ 1e9:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1ec:	83 ec 08             	sub    $0x8,%esp
+ 1ef:	6a 00                	push   $0x0
+ 1f1:	ff 75 08             	push   0x8(%ebp)
+ 1f4:	e8 e9 01 00 00       	call   3e2 <open>
+ 1f9:	83 c4 10             	add    $0x10,%esp
+ 1fc:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 1ff:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 203:	79 07                	jns    20c <stat+0x26>
+    return -1;
+ 205:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 20a:	eb 25                	jmp    231 <stat+0x4b>
+  r = fstat(fd, st);
+ 20c:	83 ec 08             	sub    $0x8,%esp
+ 20f:	ff 75 0c             	push   0xc(%ebp)
+ 212:	ff 75 f4             	push   -0xc(%ebp)
+ 215:	e8 e0 01 00 00       	call   3fa <fstat>
+ 21a:	83 c4 10             	add    $0x10,%esp
+ 21d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 220:	83 ec 0c             	sub    $0xc,%esp
+ 223:	ff 75 f4             	push   -0xc(%ebp)
+ 226:	e8 9f 01 00 00       	call   3ca <close>
+ 22b:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 22e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 231:	c9                   	leave
+ 232:	c3                   	ret
+
+00000233 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 233:	55                   	push   %ebp
+ 234:	89 e5                	mov    %esp,%ebp
+ 236:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 239:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 240:	eb 25                	jmp    267 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 242:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 245:	89 d0                	mov    %edx,%eax
+ 247:	c1 e0 02             	shl    $0x2,%eax
+ 24a:	01 d0                	add    %edx,%eax
+ 24c:	01 c0                	add    %eax,%eax
+ 24e:	89 c1                	mov    %eax,%ecx
+ 250:	8b 45 08             	mov    0x8(%ebp),%eax
+ 253:	8d 50 01             	lea    0x1(%eax),%edx
+ 256:	89 55 08             	mov    %edx,0x8(%ebp)
+ 259:	0f b6 00             	movzbl (%eax),%eax
+ 25c:	0f be c0             	movsbl %al,%eax
+ 25f:	01 c8                	add    %ecx,%eax
+ 261:	83 e8 30             	sub    $0x30,%eax
+ 264:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 267:	8b 45 08             	mov    0x8(%ebp),%eax
+ 26a:	0f b6 00             	movzbl (%eax),%eax
+ 26d:	3c 2f                	cmp    $0x2f,%al
+ 26f:	7e 0a                	jle    27b <atoi+0x48>
+ 271:	8b 45 08             	mov    0x8(%ebp),%eax
+ 274:	0f b6 00             	movzbl (%eax),%eax
+ 277:	3c 39                	cmp    $0x39,%al
+ 279:	7e c7                	jle    242 <atoi+0xf>
+  return n;
+ 27b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 27e:	c9                   	leave
+ 27f:	c3                   	ret
+
+00000280 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+
+  dst = vdst;
+ 286:	8b 45 08             	mov    0x8(%ebp),%eax
+ 289:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 28c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 28f:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 292:	eb 17                	jmp    2ab <memmove+0x2b>
+    *dst++ = *src++;
+ 294:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 297:	8d 42 01             	lea    0x1(%edx),%eax
+ 29a:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 29d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 2a0:	8d 48 01             	lea    0x1(%eax),%ecx
+ 2a3:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 2a6:	0f b6 12             	movzbl (%edx),%edx
+ 2a9:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 2ab:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2ae:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 2b1:	89 55 10             	mov    %edx,0x10(%ebp)
+ 2b4:	85 c0                	test   %eax,%eax
+ 2b6:	7f dc                	jg     294 <memmove+0x14>
+  return vdst;
+ 2b8:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2bb:	c9                   	leave
+ 2bc:	c3                   	ret
+
+000002bd <opendir>:
+    int fd;
+    int child;
+} DIR;
+
+DIR* opendir(const char* name)
+{
+ 2bd:	55                   	push   %ebp
+ 2be:	89 e5                	mov    %esp,%ebp
+ 2c0:	83 ec 18             	sub    $0x18,%esp
+    DIR* dp = malloc(sizeof(*dp));
+ 2c3:	83 ec 0c             	sub    $0xc,%esp
+ 2c6:	6a 08                	push   $0x8
+ 2c8:	e8 4d 05 00 00       	call   81a <malloc>
+ 2cd:	83 c4 10             	add    $0x10,%esp
+ 2d0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+    dp->fd = open((char*)name, 0);
+ 2d3:	83 ec 08             	sub    $0x8,%esp
+ 2d6:	6a 00                	push   $0x0
+ 2d8:	ff 75 08             	push   0x8(%ebp)
+ 2db:	e8 02 01 00 00       	call   3e2 <open>
+ 2e0:	83 c4 10             	add    $0x10,%esp
+ 2e3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 2e6:	89 02                	mov    %eax,(%edx)
+    dp->child = 0;
+ 2e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2eb:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+
+    return dp;
+ 2f2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 2f5:	c9                   	leave
+ 2f6:	c3                   	ret
+
+000002f7 <closedir>:
+
+void closedir(DIR* dp)
+{
+ 2f7:	55                   	push   %ebp
+ 2f8:	89 e5                	mov    %esp,%ebp
+ 2fa:	83 ec 08             	sub    $0x8,%esp
+    if(dp == 0) {
+ 2fd:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 301:	74 21                	je     324 <closedir+0x2d>
+        return;
+    }
+
+    close(dp->fd);
+ 303:	8b 45 08             	mov    0x8(%ebp),%eax
+ 306:	8b 00                	mov    (%eax),%eax
+ 308:	83 ec 0c             	sub    $0xc,%esp
+ 30b:	50                   	push   %eax
+ 30c:	e8 b9 00 00 00       	call   3ca <close>
+ 311:	83 c4 10             	add    $0x10,%esp
+    free(dp);
+ 314:	83 ec 0c             	sub    $0xc,%esp
+ 317:	ff 75 08             	push   0x8(%ebp)
+ 31a:	e8 b9 03 00 00       	call   6d8 <free>
+ 31f:	83 c4 10             	add    $0x10,%esp
+ 322:	eb 01                	jmp    325 <closedir+0x2e>
+        return;
+ 324:	90                   	nop
+}
+ 325:	c9                   	leave
+ 326:	c3                   	ret
+
+00000327 <readdir>:
+
+struct dirent* readdir(DIR* dp)
+{
+ 327:	55                   	push   %ebp
+ 328:	89 e5                	mov    %esp,%ebp
+ 32a:	83 ec 18             	sub    $0x18,%esp
+    if(dp == 0) {
+ 32d:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 331:	75 07                	jne    33a <readdir+0x13>
+      return 0;
+ 333:	b8 00 00 00 00       	mov    $0x0,%eax
+ 338:	eb 5e                	jmp    398 <readdir+0x71>
+    }
+
+    struct dirent* de = malloc(sizeof(*de));
+ 33a:	83 ec 0c             	sub    $0xc,%esp
+ 33d:	68 0c 01 00 00       	push   $0x10c
+ 342:	e8 d3 04 00 00       	call   81a <malloc>
+ 347:	83 c4 10             	add    $0x10,%esp
+ 34a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    int res = direntry(dp->fd, dp->child, de);
+ 34d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 350:	8b 50 04             	mov    0x4(%eax),%edx
+ 353:	8b 45 08             	mov    0x8(%ebp),%eax
+ 356:	8b 00                	mov    (%eax),%eax
+ 358:	83 ec 04             	sub    $0x4,%esp
+ 35b:	ff 75 f4             	push   -0xc(%ebp)
+ 35e:	52                   	push   %edx
+ 35f:	50                   	push   %eax
+ 360:	e8 e5 00 00 00       	call   44a <direntry>
+ 365:	83 c4 10             	add    $0x10,%esp
+ 368:	89 45 f0             	mov    %eax,-0x10(%ebp)
+
+    // out of children or other error
+    if(res == -1) {
+ 36b:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+ 36f:	75 15                	jne    386 <readdir+0x5f>
+        free(de);
+ 371:	83 ec 0c             	sub    $0xc,%esp
+ 374:	ff 75 f4             	push   -0xc(%ebp)
+ 377:	e8 5c 03 00 00       	call   6d8 <free>
+ 37c:	83 c4 10             	add    $0x10,%esp
+        return 0;
+ 37f:	b8 00 00 00 00       	mov    $0x0,%eax
+ 384:	eb 12                	jmp    398 <readdir+0x71>
+    }
+
+    dp->child++;
+ 386:	8b 45 08             	mov    0x8(%ebp),%eax
+ 389:	8b 40 04             	mov    0x4(%eax),%eax
+ 38c:	8d 50 01             	lea    0x1(%eax),%edx
+ 38f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 392:	89 50 04             	mov    %edx,0x4(%eax)
+    return de;
+ 395:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 398:	c9                   	leave
+ 399:	c3                   	ret
+
+0000039a <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 39a:	b8 01 00 00 00       	mov    $0x1,%eax
+ 39f:	cd 40                	int    $0x40
+ 3a1:	c3                   	ret
+
+000003a2 <exit>:
+SYSCALL(exit)
+ 3a2:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3a7:	cd 40                	int    $0x40
+ 3a9:	c3                   	ret
+
+000003aa <wait>:
+SYSCALL(wait)
+ 3aa:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3af:	cd 40                	int    $0x40
+ 3b1:	c3                   	ret
+
+000003b2 <pipe>:
+SYSCALL(pipe)
+ 3b2:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3b7:	cd 40                	int    $0x40
+ 3b9:	c3                   	ret
+
+000003ba <read>:
+SYSCALL(read)
+ 3ba:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3bf:	cd 40                	int    $0x40
+ 3c1:	c3                   	ret
+
+000003c2 <write>:
+SYSCALL(write)
+ 3c2:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3c7:	cd 40                	int    $0x40
+ 3c9:	c3                   	ret
+
+000003ca <close>:
+SYSCALL(close)
+ 3ca:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3cf:	cd 40                	int    $0x40
+ 3d1:	c3                   	ret
+
+000003d2 <kill>:
+SYSCALL(kill)
+ 3d2:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3d7:	cd 40                	int    $0x40
+ 3d9:	c3                   	ret
+
+000003da <exec>:
+SYSCALL(exec)
+ 3da:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3df:	cd 40                	int    $0x40
+ 3e1:	c3                   	ret
+
+000003e2 <open>:
+SYSCALL(open)
+ 3e2:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3e7:	cd 40                	int    $0x40
+ 3e9:	c3                   	ret
+
+000003ea <mknod>:
+SYSCALL(mknod)
+ 3ea:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3ef:	cd 40                	int    $0x40
+ 3f1:	c3                   	ret
+
+000003f2 <unlink>:
+SYSCALL(unlink)
+ 3f2:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3f7:	cd 40                	int    $0x40
+ 3f9:	c3                   	ret
+
+000003fa <fstat>:
+SYSCALL(fstat)
+ 3fa:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3ff:	cd 40                	int    $0x40
+ 401:	c3                   	ret
+
+00000402 <link>:
+SYSCALL(link)
+ 402:	b8 13 00 00 00       	mov    $0x13,%eax
+ 407:	cd 40                	int    $0x40
+ 409:	c3                   	ret
+
+0000040a <mkdir>:
+SYSCALL(mkdir)
+ 40a:	b8 14 00 00 00       	mov    $0x14,%eax
+ 40f:	cd 40                	int    $0x40
+ 411:	c3                   	ret
+
+00000412 <chdir>:
+SYSCALL(chdir)
+ 412:	b8 09 00 00 00       	mov    $0x9,%eax
+ 417:	cd 40                	int    $0x40
+ 419:	c3                   	ret
+
+0000041a <dup>:
+SYSCALL(dup)
+ 41a:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 41f:	cd 40                	int    $0x40
+ 421:	c3                   	ret
+
+00000422 <getpid>:
+SYSCALL(getpid)
+ 422:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 427:	cd 40                	int    $0x40
+ 429:	c3                   	ret
+
+0000042a <sbrk>:
+SYSCALL(sbrk)
+ 42a:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 42f:	cd 40                	int    $0x40
+ 431:	c3                   	ret
+
+00000432 <sleep>:
+SYSCALL(sleep)
+ 432:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 437:	cd 40                	int    $0x40
+ 439:	c3                   	ret
+
+0000043a <uptime>:
+SYSCALL(uptime)
+ 43a:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 43f:	cd 40                	int    $0x40
+ 441:	c3                   	ret
+
+00000442 <mount>:
+SYSCALL(mount)
+ 442:	b8 16 00 00 00       	mov    $0x16,%eax
+ 447:	cd 40                	int    $0x40
+ 449:	c3                   	ret
+
+0000044a <direntry>:
+SYSCALL(direntry)
+ 44a:	b8 17 00 00 00       	mov    $0x17,%eax
+ 44f:	cd 40                	int    $0x40
+ 451:	c3                   	ret
+
+00000452 <sync>:
+SYSCALL(sync)
+ 452:	b8 18 00 00 00       	mov    $0x18,%eax
+ 457:	cd 40                	int    $0x40
+ 459:	c3                   	ret
+
+0000045a <fsync>:
+SYSCALL(fsync)
+ 45a:	b8 19 00 00 00       	mov    $0x19,%eax
+ 45f:	cd 40                	int    $0x40
+ 461:	c3                   	ret
+
+00000462 <mmap>:
+SYSCALL(mmap)
+ 462:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 467:	cd 40                	int    $0x40
+ 469:	c3                   	ret
+
+0000046a <munmap>:
+SYSCALL(munmap)
+ 46a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 46f:	cd 40                	int    $0x40
+ 471:	c3                   	ret
+
+00000472 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 472:	55                   	push   %ebp
+ 473:	89 e5                	mov    %esp,%ebp
+ 475:	83 ec 18             	sub    $0x18,%esp
+ 478:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 47b:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 47e:	83 ec 04             	sub    $0x4,%esp
+ 481:	6a 01                	push   $0x1
+ 483:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 486:	50                   	push   %eax
+ 487:	ff 75 08             	push   0x8(%ebp)
+ 48a:	e8 33 ff ff ff       	call   3c2 <write>
+ 48f:	83 c4 10             	add    $0x10,%esp
+}
+ 492:	90                   	nop
+ 493:	c9                   	leave
+ 494:	c3                   	ret
+
+00000495 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 495:	55                   	push   %ebp
+ 496:	89 e5                	mov    %esp,%ebp
+ 498:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 49b:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 4a2:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 4a6:	74 17                	je     4bf <printint+0x2a>
+ 4a8:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 4ac:	79 11                	jns    4bf <printint+0x2a>
+    neg = 1;
+ 4ae:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 4b5:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4b8:	f7 d8                	neg    %eax
+ 4ba:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 4bd:	eb 06                	jmp    4c5 <printint+0x30>
+  } else {
+    x = xx;
+ 4bf:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4c2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 4c5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 4cc:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 4cf:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 4d2:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4d7:	f7 f1                	div    %ecx
+ 4d9:	89 d1                	mov    %edx,%ecx
+ 4db:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4de:	8d 50 01             	lea    0x1(%eax),%edx
+ 4e1:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 4e4:	0f b6 91 00 20 00 00 	movzbl 0x2000(%ecx),%edx
+ 4eb:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 4ef:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 4f2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 4f5:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4fa:	f7 f1                	div    %ecx
+ 4fc:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 4ff:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 503:	75 c7                	jne    4cc <printint+0x37>
+  if(neg)
+ 505:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 509:	74 2d                	je     538 <printint+0xa3>
+    buf[i++] = '-';
+ 50b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 50e:	8d 50 01             	lea    0x1(%eax),%edx
+ 511:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 514:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 519:	eb 1d                	jmp    538 <printint+0xa3>
+    putc(fd, buf[i]);
+ 51b:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 51e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 521:	01 d0                	add    %edx,%eax
+ 523:	0f b6 00             	movzbl (%eax),%eax
+ 526:	0f be c0             	movsbl %al,%eax
+ 529:	83 ec 08             	sub    $0x8,%esp
+ 52c:	50                   	push   %eax
+ 52d:	ff 75 08             	push   0x8(%ebp)
+ 530:	e8 3d ff ff ff       	call   472 <putc>
+ 535:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 538:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 53c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 540:	79 d9                	jns    51b <printint+0x86>
+}
+ 542:	90                   	nop
+ 543:	90                   	nop
+ 544:	c9                   	leave
+ 545:	c3                   	ret
+
+00000546 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 546:	55                   	push   %ebp
+ 547:	89 e5                	mov    %esp,%ebp
+ 549:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 54c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 553:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 556:	83 c0 04             	add    $0x4,%eax
+ 559:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 55c:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 563:	e9 59 01 00 00       	jmp    6c1 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 568:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 56b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 56e:	01 d0                	add    %edx,%eax
+ 570:	0f b6 00             	movzbl (%eax),%eax
+ 573:	0f be c0             	movsbl %al,%eax
+ 576:	25 ff 00 00 00       	and    $0xff,%eax
+ 57b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 57e:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 582:	75 2c                	jne    5b0 <printf+0x6a>
+      if(c == '%'){
+ 584:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 588:	75 0c                	jne    596 <printf+0x50>
+        state = '%';
+ 58a:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 591:	e9 27 01 00 00       	jmp    6bd <printf+0x177>
+      } else {
+        putc(fd, c);
+ 596:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 599:	0f be c0             	movsbl %al,%eax
+ 59c:	83 ec 08             	sub    $0x8,%esp
+ 59f:	50                   	push   %eax
+ 5a0:	ff 75 08             	push   0x8(%ebp)
+ 5a3:	e8 ca fe ff ff       	call   472 <putc>
+ 5a8:	83 c4 10             	add    $0x10,%esp
+ 5ab:	e9 0d 01 00 00       	jmp    6bd <printf+0x177>
+      }
+    } else if(state == '%'){
+ 5b0:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 5b4:	0f 85 03 01 00 00    	jne    6bd <printf+0x177>
+      if(c == 'd'){
+ 5ba:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 5be:	75 1e                	jne    5de <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 5c0:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5c3:	8b 00                	mov    (%eax),%eax
+ 5c5:	6a 01                	push   $0x1
+ 5c7:	6a 0a                	push   $0xa
+ 5c9:	50                   	push   %eax
+ 5ca:	ff 75 08             	push   0x8(%ebp)
+ 5cd:	e8 c3 fe ff ff       	call   495 <printint>
+ 5d2:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 5d5:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 5d9:	e9 d8 00 00 00       	jmp    6b6 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 5de:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 5e2:	74 06                	je     5ea <printf+0xa4>
+ 5e4:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 5e8:	75 1e                	jne    608 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 5ea:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5ed:	8b 00                	mov    (%eax),%eax
+ 5ef:	6a 00                	push   $0x0
+ 5f1:	6a 10                	push   $0x10
+ 5f3:	50                   	push   %eax
+ 5f4:	ff 75 08             	push   0x8(%ebp)
+ 5f7:	e8 99 fe ff ff       	call   495 <printint>
+ 5fc:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 5ff:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 603:	e9 ae 00 00 00       	jmp    6b6 <printf+0x170>
+      } else if(c == 's'){
+ 608:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 60c:	75 43                	jne    651 <printf+0x10b>
+        s = (char*)*ap;
+ 60e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 611:	8b 00                	mov    (%eax),%eax
+ 613:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 616:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 61a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 61e:	75 25                	jne    645 <printf+0xff>
+          s = "(null)";
+ 620:	c7 45 f4 40 10 00 00 	movl   $0x1040,-0xc(%ebp)
+        while(*s != 0){
+ 627:	eb 1c                	jmp    645 <printf+0xff>
+          putc(fd, *s);
+ 629:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 62c:	0f b6 00             	movzbl (%eax),%eax
+ 62f:	0f be c0             	movsbl %al,%eax
+ 632:	83 ec 08             	sub    $0x8,%esp
+ 635:	50                   	push   %eax
+ 636:	ff 75 08             	push   0x8(%ebp)
+ 639:	e8 34 fe ff ff       	call   472 <putc>
+ 63e:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 641:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 645:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 648:	0f b6 00             	movzbl (%eax),%eax
+ 64b:	84 c0                	test   %al,%al
+ 64d:	75 da                	jne    629 <printf+0xe3>
+ 64f:	eb 65                	jmp    6b6 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 651:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 655:	75 1d                	jne    674 <printf+0x12e>
+        putc(fd, *ap);
+ 657:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 65a:	8b 00                	mov    (%eax),%eax
+ 65c:	0f be c0             	movsbl %al,%eax
+ 65f:	83 ec 08             	sub    $0x8,%esp
+ 662:	50                   	push   %eax
+ 663:	ff 75 08             	push   0x8(%ebp)
+ 666:	e8 07 fe ff ff       	call   472 <putc>
+ 66b:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 66e:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 672:	eb 42                	jmp    6b6 <printf+0x170>
+      } else if(c == '%'){
+ 674:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 678:	75 17                	jne    691 <printf+0x14b>
+        putc(fd, c);
+ 67a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 67d:	0f be c0             	movsbl %al,%eax
+ 680:	83 ec 08             	sub    $0x8,%esp
+ 683:	50                   	push   %eax
+ 684:	ff 75 08             	push   0x8(%ebp)
+ 687:	e8 e6 fd ff ff       	call   472 <putc>
+ 68c:	83 c4 10             	add    $0x10,%esp
+ 68f:	eb 25                	jmp    6b6 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 691:	83 ec 08             	sub    $0x8,%esp
+ 694:	6a 25                	push   $0x25
+ 696:	ff 75 08             	push   0x8(%ebp)
+ 699:	e8 d4 fd ff ff       	call   472 <putc>
+ 69e:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 6a1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 6a4:	0f be c0             	movsbl %al,%eax
+ 6a7:	83 ec 08             	sub    $0x8,%esp
+ 6aa:	50                   	push   %eax
+ 6ab:	ff 75 08             	push   0x8(%ebp)
+ 6ae:	e8 bf fd ff ff       	call   472 <putc>
+ 6b3:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 6b6:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 6bd:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 6c1:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 6c4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 6c7:	01 d0                	add    %edx,%eax
+ 6c9:	0f b6 00             	movzbl (%eax),%eax
+ 6cc:	84 c0                	test   %al,%al
+ 6ce:	0f 85 94 fe ff ff    	jne    568 <printf+0x22>
+    }
+  }
+}
+ 6d4:	90                   	nop
+ 6d5:	90                   	nop
+ 6d6:	c9                   	leave
+ 6d7:	c3                   	ret
+
+000006d8 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 6d8:	55                   	push   %ebp
+ 6d9:	89 e5                	mov    %esp,%ebp
+ 6db:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 6de:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6e1:	83 e8 08             	sub    $0x8,%eax
+ 6e4:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6e7:	a1 1c 20 00 00       	mov    0x201c,%eax
+ 6ec:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 6ef:	eb 24                	jmp    715 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6f1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6f4:	8b 00                	mov    (%eax),%eax
+ 6f6:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 6f9:	72 12                	jb     70d <free+0x35>
+ 6fb:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6fe:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 701:	72 24                	jb     727 <free+0x4f>
+ 703:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 706:	8b 00                	mov    (%eax),%eax
+ 708:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 70b:	72 1a                	jb     727 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 70d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 710:	8b 00                	mov    (%eax),%eax
+ 712:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 715:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 718:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 71b:	73 d4                	jae    6f1 <free+0x19>
+ 71d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 720:	8b 00                	mov    (%eax),%eax
+ 722:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 725:	73 ca                	jae    6f1 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 727:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 72a:	8b 40 04             	mov    0x4(%eax),%eax
+ 72d:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 734:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 737:	01 c2                	add    %eax,%edx
+ 739:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 73c:	8b 00                	mov    (%eax),%eax
+ 73e:	39 c2                	cmp    %eax,%edx
+ 740:	75 24                	jne    766 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 742:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 745:	8b 50 04             	mov    0x4(%eax),%edx
+ 748:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 74b:	8b 00                	mov    (%eax),%eax
+ 74d:	8b 40 04             	mov    0x4(%eax),%eax
+ 750:	01 c2                	add    %eax,%edx
+ 752:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 755:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 758:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 75b:	8b 00                	mov    (%eax),%eax
+ 75d:	8b 10                	mov    (%eax),%edx
+ 75f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 762:	89 10                	mov    %edx,(%eax)
+ 764:	eb 0a                	jmp    770 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 766:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 769:	8b 10                	mov    (%eax),%edx
+ 76b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 76e:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 770:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 773:	8b 40 04             	mov    0x4(%eax),%eax
+ 776:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 77d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 780:	01 d0                	add    %edx,%eax
+ 782:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 785:	75 20                	jne    7a7 <free+0xcf>
+    p->s.size += bp->s.size;
+ 787:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 78a:	8b 50 04             	mov    0x4(%eax),%edx
+ 78d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 790:	8b 40 04             	mov    0x4(%eax),%eax
+ 793:	01 c2                	add    %eax,%edx
+ 795:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 798:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 79b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 79e:	8b 10                	mov    (%eax),%edx
+ 7a0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7a3:	89 10                	mov    %edx,(%eax)
+ 7a5:	eb 08                	jmp    7af <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 7a7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7aa:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 7ad:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 7af:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7b2:	a3 1c 20 00 00       	mov    %eax,0x201c
+}
+ 7b7:	90                   	nop
+ 7b8:	c9                   	leave
+ 7b9:	c3                   	ret
+
+000007ba <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 7ba:	55                   	push   %ebp
+ 7bb:	89 e5                	mov    %esp,%ebp
+ 7bd:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 7c0:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 7c7:	77 07                	ja     7d0 <morecore+0x16>
+    nu = 4096;
+ 7c9:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 7d0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7d3:	c1 e0 03             	shl    $0x3,%eax
+ 7d6:	83 ec 0c             	sub    $0xc,%esp
+ 7d9:	50                   	push   %eax
+ 7da:	e8 4b fc ff ff       	call   42a <sbrk>
+ 7df:	83 c4 10             	add    $0x10,%esp
+ 7e2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 7e5:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 7e9:	75 07                	jne    7f2 <morecore+0x38>
+    return 0;
+ 7eb:	b8 00 00 00 00       	mov    $0x0,%eax
+ 7f0:	eb 26                	jmp    818 <morecore+0x5e>
+  hp = (Header*)p;
+ 7f2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7f5:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 7f8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7fb:	8b 55 08             	mov    0x8(%ebp),%edx
+ 7fe:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 801:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 804:	83 c0 08             	add    $0x8,%eax
+ 807:	83 ec 0c             	sub    $0xc,%esp
+ 80a:	50                   	push   %eax
+ 80b:	e8 c8 fe ff ff       	call   6d8 <free>
+ 810:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 813:	a1 1c 20 00 00       	mov    0x201c,%eax
+}
+ 818:	c9                   	leave
+ 819:	c3                   	ret
+
+0000081a <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 81a:	55                   	push   %ebp
+ 81b:	89 e5                	mov    %esp,%ebp
+ 81d:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 820:	8b 45 08             	mov    0x8(%ebp),%eax
+ 823:	83 c0 07             	add    $0x7,%eax
+ 826:	c1 e8 03             	shr    $0x3,%eax
+ 829:	83 c0 01             	add    $0x1,%eax
+ 82c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 82f:	a1 1c 20 00 00       	mov    0x201c,%eax
+ 834:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 837:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 83b:	75 23                	jne    860 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 83d:	c7 45 f0 14 20 00 00 	movl   $0x2014,-0x10(%ebp)
+ 844:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 847:	a3 1c 20 00 00       	mov    %eax,0x201c
+ 84c:	a1 1c 20 00 00       	mov    0x201c,%eax
+ 851:	a3 14 20 00 00       	mov    %eax,0x2014
+    base.s.size = 0;
+ 856:	c7 05 18 20 00 00 00 	movl   $0x0,0x2018
+ 85d:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 860:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 863:	8b 00                	mov    (%eax),%eax
+ 865:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 868:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 86b:	8b 40 04             	mov    0x4(%eax),%eax
+ 86e:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 871:	72 4d                	jb     8c0 <malloc+0xa6>
+      if(p->s.size == nunits)
+ 873:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 876:	8b 40 04             	mov    0x4(%eax),%eax
+ 879:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 87c:	75 0c                	jne    88a <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 87e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 881:	8b 10                	mov    (%eax),%edx
+ 883:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 886:	89 10                	mov    %edx,(%eax)
+ 888:	eb 26                	jmp    8b0 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 88a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 88d:	8b 40 04             	mov    0x4(%eax),%eax
+ 890:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 893:	89 c2                	mov    %eax,%edx
+ 895:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 898:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 89b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 89e:	8b 40 04             	mov    0x4(%eax),%eax
+ 8a1:	c1 e0 03             	shl    $0x3,%eax
+ 8a4:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 8a7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8aa:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 8ad:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 8b0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8b3:	a3 1c 20 00 00       	mov    %eax,0x201c
+      return (void*)(p + 1);
+ 8b8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8bb:	83 c0 08             	add    $0x8,%eax
+ 8be:	eb 3b                	jmp    8fb <malloc+0xe1>
+    }
+    if(p == freep)
+ 8c0:	a1 1c 20 00 00       	mov    0x201c,%eax
+ 8c5:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 8c8:	75 1e                	jne    8e8 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 8ca:	83 ec 0c             	sub    $0xc,%esp
+ 8cd:	ff 75 ec             	push   -0x14(%ebp)
+ 8d0:	e8 e5 fe ff ff       	call   7ba <morecore>
+ 8d5:	83 c4 10             	add    $0x10,%esp
+ 8d8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 8db:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 8df:	75 07                	jne    8e8 <malloc+0xce>
+        return 0;
+ 8e1:	b8 00 00 00 00       	mov    $0x0,%eax
+ 8e6:	eb 13                	jmp    8fb <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8eb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 8ee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8f1:	8b 00                	mov    (%eax),%eax
+ 8f3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 8f6:	e9 6d ff ff ff       	jmp    868 <malloc+0x4e>
+  }
+}
+ 8fb:	c9                   	leave
+ 8fc:	c3                   	ret
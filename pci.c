@@ -0,0 +1,56 @@
+// Minimal PCI configuration space access, through configuration
+// mechanism #1 (I/O ports 0xCF8/0xCFC). Only what the drivers need
+// to find their controllers -- no bridges, no interrupt routing.
+
+#include "types.h"
+#include "x86.h"
+#include "pci.h"
+
+#define PCI_CONFIG_ADDR 0xCF8
+#define PCI_CONFIG_DATA 0xCFC
+
+#define PCI_NBUS  256
+#define PCI_NDEV  32
+#define PCI_NFUNC 8
+
+static uint pci_addr(struct pci_dev* pd, int reg)
+{
+    return 0x80000000 | (pd->bus << 16) | (pd->dev << 11) | (pd->func << 8) | (reg & 0xFC);
+}
+
+uint pci_read(struct pci_dev* pd, int reg)
+{
+    outl(PCI_CONFIG_ADDR, pci_addr(pd, reg));
+    return inl(PCI_CONFIG_DATA);
+}
+
+void pci_write(struct pci_dev* pd, int reg, uint value)
+{
+    outl(PCI_CONFIG_ADDR, pci_addr(pd, reg));
+    outl(PCI_CONFIG_DATA, value);
+}
+
+int pci_find(int class, int subclass, struct pci_dev* out)
+{
+    struct pci_dev pd;
+
+    for(pd.bus = 0; pd.bus < PCI_NBUS; pd.bus++) {
+        for(pd.dev = 0; pd.dev < PCI_NDEV; pd.dev++) {
+            for(pd.func = 0; pd.func < PCI_NFUNC; pd.func++) {
+                // no function here
+                if((pci_read(&pd, 0) & 0xFFFF) == 0xFFFF) {
+                    continue;
+                }
+
+                uint cl = pci_read(&pd, PCI_CLASS);
+
+                if(((cl >> 24) & 0xFF) == class && ((cl >> 16) & 0xFF) == subclass) {
+                    *out = pd;
+                    return 0;
+                }
+            }
+        }
+    }
+
+    return -1;
+}
@@ -0,0 +1,49 @@
+#pragma once
+#include "types.h"
+
+#define PCI_CLASS_STORAGE 0x01
+#define PCI_SUBCLASS_IDE  0x01
+
+// configuration space registers
+#define PCI_COMMAND 0x04
+#define PCI_CLASS   0x08
+#define PCI_BAR4    0x20
+
+#define PCI_COMMAND_IO     0x1
+#define PCI_COMMAND_MASTER 0x4
+
+/**
+ * PCI function address
+ */
+struct pci_dev {
+    int bus, dev, func;
+};
+
+/**
+ * Read a 32-bit register from a function's configuration space
+ *
+ * @param pd - function to read from
+ * @param reg - register offset (dword aligned)
+ * @return the register value
+ */
+uint pci_read(struct pci_dev* pd, int reg);
+
+/**
+ * Write a 32-bit register in a function's configuration space
+ *
+ * @param pd - function to write to
+ * @param reg - register offset (dword aligned)
+ * @param value - value to write
+ */
+void pci_write(struct pci_dev* pd, int reg, uint value);
+
+/**
+ * Find the first function with the given class and subclass
+ *
+ * @param class - class code
+ * @param subclass - subclass code
+ * @param out - where to place the function address (out variable)
+ *
+ * @return 0 if a function was found, -1 otherwise
+ */
+int pci_find(int class, int subclass, struct pci_dev* out);
@@ -1,3 +1,3 @@
 parted -s fs.img -- mklabel msdos \
-	mkpart primary ext2 0 256KiB \
-	mkpart primary ext2 257KiB -1s
+	mkpart primary ext2 0 1536KiB \
+	mkpart primary ext2 1537KiB -1s
@@ -8,23 +8,53 @@
 #include "spinlock.h"
 #include "vfs.h"
 
+// Per-CPU queue of RUNNABLE processes. Each CPU's scheduler
+// runs processes from its own queue, and only looks at (and
+// steals from) the others when its own is empty.
+struct runq {
+  struct spinlock lock;
+  struct proc *head, *tail;
+  int n;                       // length; peeked at without the lock
+};
+
+// Processes sleeping on channels that hash to the same
+// bucket. wakeup(chan) only looks at its bucket.
+#define NWAITQ 64
+
+struct waitq {
+  struct spinlock lock;
+  struct proc *head;
+};
+
 struct {
   struct spinlock lock;
   struct proc proc[NPROC];
+  struct runq rq[NCPU];
+  struct waitq wq[NWAITQ];
 } ptable;
 
+// Wait queue for chan (Fibonacci hashing of the address).
+#define WAITQ(chan) (&ptable.wq[((uint)(chan) * 2654435761U) >> 26])
+
 static struct proc *initproc;
 
 int nextpid = 1;
 extern void forkret(void);
 extern void trapret(void);
 
-static void wakeup1(void *chan);
-
 void
 pinit(void)
 {
+  struct proc *p;
+  int i;
+
   initlock(&ptable.lock, "ptable");
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+    initlock(&p->lock, "proc");
+  for(i = 0; i < NCPU; i++)
+    initlock(&ptable.rq[i].lock, "runq");
+  for(i = 0; i < NWAITQ; i++)
+    initlock(&ptable.wq[i].lock, "waitq");
 }
 
 // Must be called with interrupts disabled
@@ -89,6 +119,8 @@ allocproc(void)
 found:
   p->state = EMBRYO;
   p->pid = nextpid++;
+  p->cpu = -1;
+  p->nlazy = 0;
 
   release(&ptable.lock);
 
@@ -147,26 +179,42 @@ userinit(void)
   // run this process. the acquire forces the above
   // writes to be visible, and the lock is also needed
   // because the assignment might not be atomic.
-  acquire(&ptable.lock);
+  acquire(&p->lock);
 
-  p->state = RUNNABLE;
+  setrunnable(p);
 
-  release(&ptable.lock);
+  release(&p->lock);
 }
 
 // Grow current process's memory by n bytes.
+// Growing only reserves the address space and the memory
+// (see kreserve); the pages are zero-filled by the page
+// fault handler when first used.
 // Return 0 on success, -1 on failure.
 int
 growproc(int n)
 {
   uint sz;
+  int npages;
   struct proc *curproc = myproc();
 
   sz = curproc->sz;
   if(n > 0){
-    if((sz = allocuvm(curproc->pgdir, sz, sz + n)) == 0)
+    // the heap must not run into the mmap() area
+    if(sz + n > MMAPBASE || sz + n < sz)
+      return -1;
+    npages = (PGROUNDUP(sz + n) - PGROUNDUP(sz)) / PGSIZE;
+    if(kreserve(npages) < 0)
       return -1;
+    curproc->nlazy += npages;
+    sz += n;
   } else if(n < 0){
+    // untouched pages give back their reservation
+    npages = uvmabsent(curproc->pgdir, sz + n, sz);
+    if(npages > curproc->nlazy)
+      npages = curproc->nlazy;
+    kunreserve(npages);
+    curproc->nlazy -= npages;
     if((sz = deallocuvm(curproc->pgdir, sz, sz + n)) == 0)
       return -1;
   }
@@ -197,6 +245,26 @@ fork(void)
     np->state = UNUSED;
     return -1;
   }
+  if(vmacopy(curproc, np) < 0){
+    vmafree(np);
+    freevm(np->pgdir);
+    np->pgdir = 0;
+    kfree(np->kstack);
+    np->kstack = 0;
+    np->state = UNUSED;
+    return -1;
+  }
+  // the child may touch the untouched heap pages too
+  if(kreserve(curproc->nlazy) < 0){
+    vmafree(np);
+    freevm(np->pgdir);
+    np->pgdir = 0;
+    kfree(np->kstack);
+    np->kstack = 0;
+    np->state = UNUSED;
+    return -1;
+  }
+  np->nlazy = curproc->nlazy;
   np->sz = curproc->sz;
   np->parent = curproc;
   *np->tf = *curproc->tf;
@@ -208,17 +276,17 @@ fork(void)
     if(curproc->ofile[i])
       np->ofile[i] = filedup(curproc->ofile[i]);
 
-  np->cwd = curproc->cwd;
+  np->cwd = vfs_idup(curproc->cwd);
 
   safestrcpy(np->name, curproc->name, sizeof(curproc->name));
 
   pid = np->pid;
 
-  acquire(&ptable.lock);
+  acquire(&np->lock);
 
-  np->state = RUNNABLE;
+  setrunnable(np);
 
-  release(&ptable.lock);
+  release(&np->lock);
 
   return pid;
 }
@@ -231,11 +299,16 @@ exit(void)
 {
   struct proc *curproc = myproc();
   struct proc *p;
-  int fd;
+  int fd, orphans;
 
   if(curproc == initproc)
     panic("init exiting");
 
+  // Drop memory-mapped files and the heap's reservation.
+  vmafree(curproc);
+  kunreserve(curproc->nlazy);
+  curproc->nlazy = 0;
+
   // Close all open files.
   for(fd = 0; fd < NOFILE; fd++){
     if(curproc->ofile[fd]){
@@ -244,27 +317,33 @@ exit(void)
     }
   }
 
-  //begin_op();
-  //iput(curproc->cwd);
-  //end_op();
+  vfs_iput(curproc->cwd);
   curproc->cwd = 0;
 
   acquire(&ptable.lock);
 
   // Parent might be sleeping in wait().
-  wakeup1(curproc->parent);
+  wakeup(curproc->parent);
 
-  // Pass abandoned children to init.
+  // Pass abandoned children to init; it will find
+  // any zombies among them when it next waits.
+  orphans = 0;
   for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
     if(p->parent == curproc){
       p->parent = initproc;
-      if(p->state == ZOMBIE)
-        wakeup1(initproc);
+      orphans = 1;
     }
   }
+  if(orphans)
+    wakeup(initproc);
 
   // Jump into the scheduler, never to return.
+  // The parent's wait() can't look at us before
+  // ptable.lock is released, or free us before
+  // sched() has released curproc->lock.
+  acquire(&curproc->lock);
   curproc->state = ZOMBIE;
+  release(&ptable.lock);
   sched();
   panic("zombie exit");
 }
@@ -286,6 +365,7 @@ wait(void)
       if(p->parent != curproc)
         continue;
       havekids = 1;
+      acquire(&p->lock);
       if(p->state == ZOMBIE){
         // Found one.
         pid = p->pid;
@@ -297,9 +377,11 @@ wait(void)
         p->name[0] = 0;
         p->killed = 0;
         p->state = UNUSED;
+        release(&p->lock);
         release(&ptable.lock);
         return pid;
       }
+      release(&p->lock);
     }
 
     // No point waiting if we don't have any children.
@@ -308,16 +390,97 @@ wait(void)
       return -1;
     }
 
-    // Wait for children to exit.  (See wakeup1 call in proc_exit.)
+    // Wait for children to exit.  (See wakeup call in exit.)
     sleep(curproc, &ptable.lock);  //DOC: wait-sleep
   }
 }
 
 //PAGEBREAK: 42
+// Append p to run queue q.
+static void
+rqpush(struct runq *q, struct proc *p)
+{
+  acquire(&q->lock);
+  p->rqnext = 0;
+  if(q->tail)
+    q->tail->rqnext = p;
+  else
+    q->head = p;
+  q->tail = p;
+  q->n++;
+  release(&q->lock);
+}
+
+// Take the process at the head of run queue q, or return 0.
+static struct proc*
+rqpop(struct runq *q)
+{
+  struct proc *p;
+
+  if(q->n == 0)
+    return 0;
+  acquire(&q->lock);
+  if((p = q->head) != 0){
+    q->head = p->rqnext;
+    if(q->head == 0)
+      q->tail = 0;
+    q->n--;
+  }
+  release(&q->lock);
+  return p;
+}
+
+// Make p RUNNABLE and put it on a run queue. Caller must
+// hold p->lock. This is the migration policy:
+//  - a new process goes to the CPU with the shortest queue;
+//  - otherwise p goes back to the CPU it last ran on, whose
+//    cache may still be warm, unless that CPU's queue is
+//    longer than this CPU's by more than one, in which case
+//    p moves here.
+// Idle CPUs also steal work, see scheduler().
+void
+setrunnable(struct proc *p)
+{
+  int i, cpu, here;
+
+  if(!holding(&p->lock))
+    panic("setrunnable");
+
+  here = cpuid();
+  cpu = p->cpu;
+  if(cpu < 0){
+    cpu = here;
+    for(i = 0; i < ncpu; i++)
+      if(ptable.rq[i].n < ptable.rq[cpu].n)
+        cpu = i;
+  } else if(ptable.rq[cpu].n > ptable.rq[here].n + 1)
+    cpu = here;
+
+  p->state = RUNNABLE;
+  rqpush(&ptable.rq[cpu], p);
+}
+
+// Steal a process for CPU self from the longest other queue.
+static struct proc*
+steal(int self)
+{
+  int i, victim;
+
+  victim = -1;
+  for(i = 0; i < ncpu; i++)
+    if(i != self && ptable.rq[i].n > 0 &&
+       (victim < 0 || ptable.rq[i].n > ptable.rq[victim].n))
+      victim = i;
+  if(victim < 0)
+    return 0;
+  return rqpop(&ptable.rq[victim]);
+}
+
 // Per-CPU process scheduler.
 // Each CPU calls scheduler() after setting itself up.
 // Scheduler never returns.  It loops, doing:
-//  - choose a process to run
+//  - choose a process to run: the next one on this CPU's
+//    run queue, or one stolen from another CPU's
 //  - swtch to start running that process
 //  - eventually that process transfers control
 //      via swtch back to the scheduler.
@@ -326,38 +489,39 @@ scheduler(void)
 {
   struct proc *p;
   struct cpu *c = mycpu();
+  int self = cpuid();
   c->proc = 0;
   
   for(;;){
     // Enable interrupts on this processor.
     sti();
 
-    // Loop over process table looking for process to run.
-    acquire(&ptable.lock);
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->state != RUNNABLE)
-        continue;
-
-      // Switch to chosen process.  It is the process's job
-      // to release ptable.lock and then reacquire it
-      // before jumping back to us.
-      c->proc = p;
-      switchuvm(p);
-      p->state = RUNNING;
-
-      swtch(&(c->scheduler), p->context);
-      switchkvm();
-
-      // Process is done running for now.
-      // It should have changed its p->state before coming back.
-      c->proc = 0;
-    }
-    release(&ptable.lock);
+    if((p = rqpop(&ptable.rq[self])) == 0 && (p = steal(self)) == 0)
+      continue;
 
+    // Switch to chosen process.  It is the process's job
+    // to release p->lock and then reacquire it before
+    // jumping back to us. If p is still on its way out
+    // of another CPU, this waits for it to get there.
+    acquire(&p->lock);
+    if(p->state != RUNNABLE)
+      panic("scheduler");
+    c->proc = p;
+    p->cpu = self;
+    switchuvm(p);
+    p->state = RUNNING;
+
+    swtch(&(c->scheduler), p->context);
+    switchkvm();
+
+    // Process is done running for now.
+    // It should have changed its p->state before coming back.
+    c->proc = 0;
+    release(&p->lock);
   }
 }
 
-// Enter scheduler.  Must hold only ptable.lock
+// Enter scheduler.  Must hold only p->lock
 // and have changed proc->state. Saves and restores
 // intena because intena is a property of this
 // kernel thread, not this CPU. It should
@@ -370,8 +534,8 @@ sched(void)
   int intena;
   struct proc *p = myproc();
 
-  if(!holding(&ptable.lock))
-    panic("sched ptable.lock");
+  if(!holding(&p->lock))
+    panic("sched p->lock");
   if(mycpu()->ncli != 1)
     panic("sched locks");
   if(p->state == RUNNING)
@@ -387,10 +551,12 @@ sched(void)
 void
 yield(void)
 {
-  acquire(&ptable.lock);  //DOC: yieldlock
-  myproc()->state = RUNNABLE;
+  struct proc *p = myproc();
+
+  acquire(&p->lock);  //DOC: yieldlock
+  setrunnable(p);
   sched();
-  release(&ptable.lock);
+  release(&p->lock);
 }
 
 // A fork child's very first scheduling by scheduler()
@@ -399,8 +565,8 @@ void
 forkret(void)
 {
   static int first = 1;
-  // Still holding ptable.lock from scheduler.
-  release(&ptable.lock);
+  // Still holding p->lock from scheduler.
+  release(&myproc()->lock);
 
   if (first) {
     // Some initialization functions must be run in the context
@@ -420,6 +586,7 @@ void
 sleep(void *chan, struct spinlock *lk)
 {
   struct proc *p = myproc();
+  struct waitq *wq;
   
   if(p == 0)
     panic("sleep");
@@ -427,19 +594,23 @@ sleep(void *chan, struct spinlock *lk)
   if(lk == 0)
     panic("sleep without lk");
 
-  // Must acquire ptable.lock in order to
+  // Must acquire p->lock in order to
   // change p->state and then call sched.
-  // Once we hold ptable.lock, we can be
-  // guaranteed that we won't miss any wakeup
-  // (wakeup runs with ptable.lock locked),
+  // Once we hold chan's wait queue lock, we
+  // can be guaranteed that we won't miss any
+  // wakeup (wakeup locks the queue),
   // so it's okay to release lk.
-  if(lk != &ptable.lock){  //DOC: sleeplock0
-    acquire(&ptable.lock);  //DOC: sleeplock1
-    release(lk);
-  }
+  wq = WAITQ(chan);
+  acquire(&wq->lock);  //DOC: sleeplock1
+  acquire(&p->lock);
+  release(lk);
+
   // Go to sleep.
   p->chan = chan;
   p->state = SLEEPING;
+  p->wqnext = wq->head;
+  wq->head = p;
+  release(&wq->lock);
 
   sched();
 
@@ -447,32 +618,46 @@ sleep(void *chan, struct spinlock *lk)
   p->chan = 0;
 
   // Reacquire original lock.
-  if(lk != &ptable.lock){  //DOC: sleeplock2
-    release(&ptable.lock);
-    acquire(lk);
-  }
+  release(&p->lock);
+  acquire(lk);
 }
 
 //PAGEBREAK!
 // Wake up all processes sleeping on chan.
-// The ptable lock must be held.
-static void
-wakeup1(void *chan)
+// Must not be called with any p->lock held.
+void
+wakeup(void *chan)
 {
-  struct proc *p;
-
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if(p->state == SLEEPING && p->chan == chan)
-      p->state = RUNNABLE;
+  struct waitq *wq;
+  struct proc *p, **pp;
+
+  wq = WAITQ(chan);
+  acquire(&wq->lock);
+  for(pp = &wq->head; (p = *pp) != 0; ){
+    if(p->chan != chan){
+      pp = &p->wqnext;
+      continue;
+    }
+    *pp = p->wqnext;
+    acquire(&p->lock);
+    setrunnable(p);
+    release(&p->lock);
+  }
+  release(&wq->lock);
 }
 
-// Wake up all processes sleeping on chan.
-void
-wakeup(void *chan)
+// Take SLEEPING process p off its wait queue and make it
+// RUNNABLE. Caller holds the queue's lock and p->lock.
+static void
+unsleep(struct waitq *wq, struct proc *p)
 {
-  acquire(&ptable.lock);
-  wakeup1(chan);
-  release(&ptable.lock);
+  struct proc **pp;
+
+  for(pp = &wq->head; *pp != p; pp = &(*pp)->wqnext)
+    if(*pp == 0)
+      panic("unsleep");
+  *pp = p->wqnext;
+  setrunnable(p);
 }
 
 // Kill the process with the given pid.
@@ -482,19 +667,33 @@ int
 kill(int pid)
 {
   struct proc *p;
+  struct waitq *wq;
+  void *chan;
 
-  acquire(&ptable.lock);
   for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    acquire(&p->lock);
     if(p->pid == pid){
       p->killed = 1;
-      // Wake process from sleep if necessary.
-      if(p->state == SLEEPING)
-        p->state = RUNNABLE;
-      release(&ptable.lock);
+      chan = p->chan;
+      if(p->state != SLEEPING){
+        release(&p->lock);
+        return 0;
+      }
+      // Wake process from sleep. The wait queue lock
+      // comes before p->lock, so look again after
+      // taking both.
+      release(&p->lock);
+      wq = WAITQ(chan);
+      acquire(&wq->lock);
+      acquire(&p->lock);
+      if(p->state == SLEEPING && p->chan == chan)
+        unsleep(wq, p);
+      release(&p->lock);
+      release(&wq->lock);
       return 0;
     }
+    release(&p->lock);
   }
-  release(&ptable.lock);
   return -1;
 }
 
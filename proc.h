@@ -1,4 +1,5 @@
 #include "vfs.h"
+#include "spinlock.h"
 
 // Per-CPU state
 struct cpu {
@@ -34,10 +35,28 @@ struct context {
   uint eip;
 };
 
+// A memory-mapped file region [start, end), see vmamap() in vm.c;
+// exec() maps the program's segments the same way.
+// The slot is free if ip is 0.
+struct vma {
+  uint start, end;             // page aligned
+  uint off;                    // file offset of start
+  uint filesz;                 // bytes backed by the file, the rest is zero
+  int prot, flags;             // PROT_* and MAP_* from mman.h
+  struct vfs_inode *ip;
+};
+
 enum procstate { UNUSED, EMBRYO, SLEEPING, RUNNABLE, RUNNING, ZOMBIE };
 
 // Per-process state
+//
+// p->lock protects state, chan, killed and pid, and is held
+// across swtch() in sched() and scheduler(). ptable.lock in
+// proc.c protects parent and the UNUSED/EMBRYO transitions.
+// A SLEEPING process is on the wait queue for its chan, under
+// that queue's lock.
 struct proc {
+  struct spinlock lock;
   uint sz;                     // Size of process memory (bytes)
   pde_t* pgdir;                // Page table
   char *kstack;                // Bottom of kernel stack for this process
@@ -50,6 +69,11 @@ struct proc {
   int killed;                  // If non-zero, have been killed
   struct file *ofile[NOFILE];  // Open files
   struct vfs_inode *cwd;           // Current directory
+  struct vma vma[NVMA];        // Memory-mapped files
+  int cpu;                     // CPU last run on, or -1
+  int nlazy;                   // Heap pages reserved, not yet touched
+  struct proc *rqnext;         // Next on the run queue
+  struct proc *wqnext;         // Next on the wait queue of chan
   char name[16];               // Process name (debugging)
 };
 
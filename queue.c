@@ -16,7 +16,7 @@ struct queue {
 
 queue_t queue_create()
 {
-    queue_t q = (queue_t)kalloc();
+    queue_t q = kmalloc(sizeof(struct queue));
 
     q->head = 0;
     q->tail = 0;
@@ -30,7 +30,7 @@ void queue_enq(queue_t q, void* data)
         return;
     }
 
-    link_t elem = (link_t)kalloc();
+    link_t elem = kmalloc(sizeof(struct link));
 
     elem->data = data;
     elem->next = 0;
@@ -53,7 +53,7 @@ void* queue_deq(queue_t q)
     void* data = q->head->data;;
 
     if(q->head == q->tail) {
-        kfree((void*)q->head);
+        kfree_small(q->head);
 
         q->head = 0;
         q->tail = 0;
@@ -62,7 +62,7 @@ void* queue_deq(queue_t q)
     }
 
     link_t save = q->head->next;
-    kfree((void*)q->head);
+    kfree_small(q->head);
 
     q->head = save;
     return data;
@@ -87,10 +87,10 @@ void queue_destroy(queue_t q)
 
     while(ptr != 0) {
         link_t save = ptr->next;
-        kfree((char*)ptr);
+        kfree_small(ptr);
 
         ptr = save;
     }
 
-    kfree((char*)q);
+    kfree_small(q);
 }
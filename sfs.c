@@ -1,59 +1,378 @@
 #include "vfs.h"
 #include "defs.h"
+#include "param.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "x86.h"
 
 #define SFS_MAX_LENGTH 32
-#define SFS_MAX_CHILDREN 16
-#define SFS_MAX_INDIRECT_BLOCKS 64
-#define SFS_MAGIC 0x3F3C007
-#define SFS_SB_INODE_BITSIZE 4
-#define SFS_SB_BLOCK_BITSIZE 120
+#define SFS_MAX_EXTENTS 8  // extents in the inode itself
+#define SFS_MAX_BUCKETS 4096  // directory hash table size limit
+#define SFS_MAGIC 0x3F3C00B
+#define SFS_ITABLE_START 1  // first block of the inode table
+#define SFS_BPB (VFS_BLOCK_SIZE * 8)  // bits per bitmap block
+#define SFS_MAX_RUN 16  // most blocks per breadv in sfs_readi
+
+// the VFS holds one reference per cached vfs inode, plus transient ones
+#define SFS_NINODE (2 * NINODE)
 
 enum sfs_type {
     SFS_INODE_DIR,
     SFS_INODE_FILE
 };
 
+// On-disk superblock. The inode table starts right after it and is followed
+// by the inode bitmap (one bit per inode), the block bitmap (one bit per data
+// block, bit 0 is block data_start), each in as many blocks as it takes, and
+// then the data blocks. mkfs sizes the inode table to the partition.
+struct dsuperblock {
+    int magic, root;
+    int ninodes;    // inodes in the table
+    int data_start; // first data block
+    int ibitmap;    // first block of the inode bitmap
+    int bbitmap;    // first block of the block bitmap
+    int rotor;      // block bitmap word where the last allocation ended
+};
+
+// In-memory superblock
 struct superblock {
+    // copy of the on-disk superblock
     int magic, root;
-    int finode[SFS_SB_INODE_BITSIZE];
-    int fblock[SFS_SB_BLOCK_BITSIZE];
+    int ninodes;
+    int data_start;
+    int ibitmap;
+    int bbitmap;
+    int rotor;
+
+    // in-memory only
+    struct sleeplock lock; // block allocation: the fields below and rotor
+    int nfree;             // free data blocks, counted at mount
+    int map_block;         // block bitmap block held in map, or -1
+    int map[SFS_BPB / 32]; // here rather than on the (deep) stack of balloc
+};
+
+// A run of len consecutive blocks, starting at block start
+struct extent {
+    int start, len;
+};
+
+#define SFS_EXTENTS_PER_BLOCK ((VFS_BLOCK_SIZE - 2 * sizeof(int)) / sizeof(struct extent))
+
+// Indirect extent block. Extents that do not fit into the inode continue
+// in a chain of these, starting at the inode's ext_next.
+struct extent_block {
+    int next, n_ext;
+    struct extent ext[SFS_EXTENTS_PER_BLOCK];
 };
 
+// Directory entry
+struct dirent {
+    uint hash;
+    int inum;
+    char name[SFS_MAX_LENGTH];
+};
+
+#define SFS_DIRENTS ((VFS_BLOCK_SIZE - sizeof(int)) / sizeof(struct dirent))
+
+// Directory block. The blocks of a directory form a hash table with a
+// power-of-two number of buckets, one block each: an entry lives in
+// bucket (hash & (n_blocks - 1)). When a bucket fills up, the table
+// doubles and every bucket splits on the next hash bit.
+struct dirblock {
+    int count;
+    struct dirent ent[SFS_DIRENTS];
+};
+
+// On-disk inode. SFS_IPB of them are packed into each inode table block:
+// inode inum lives in slot (inum % SFS_IPB) of block
+// (SFS_ITABLE_START + inum / SFS_IPB).
+struct dinode {
+    char name[SFS_MAX_LENGTH];
+    int type, inum;
+
+    int parent;
+
+    // file blocks, in order (for directories: the buckets)
+    struct extent ext[SFS_MAX_EXTENTS];
+    int n_ext, ext_next;
+
+    int n_child, size;
+    int n_blocks;
+};
+
+#define SFS_IPB (VFS_BLOCK_SIZE / sizeof(struct dinode))
+
+// In-memory inode
 struct inode {
-    // on disk format
+    // copy of the on-disk inode
     char name[SFS_MAX_LENGTH];
     int type, inum;
 
     int parent;
 
-    int child[SFS_MAX_CHILDREN];
-    int indir[SFS_MAX_INDIRECT_BLOCKS];
+    struct extent ext[SFS_MAX_EXTENTS];
+    int n_ext, ext_next;
 
     int n_child, size;
     int n_blocks;
 
-    // additional in-memory fields
+    // in-memory only
     struct block_driver* drv;
     int valid;
+    int ref;
+    uint lru;
 };
 
+// In-memory cache of inodes, keyed by (driver, inum).
+//
+// A slot is in use when its ref is non-zero. Unreferenced inodes stay valid
+// (the on-disk copy is always up to date), so that looking them up again does
+// not have to touch the disk. They are recycled least recently used first.
+static struct {
+    struct spinlock lock;
+    struct inode inode[SFS_NINODE];
+    uint clock;
+} icache;
+
+// Several inodes share an inode table block, so updating one is a
+// read-modify-write of the whole block. This lock serializes those, and
+// the inode bitmap, so that concurrent updates of different inodes do not
+// write back stale copies of each other. (One lock for all SFS mounts.)
+static struct sleeplock itable_lock;
+
+// Find a valid cached inode. Caller must hold icache.lock.
+static struct inode* ifind(struct block_driver* drv, int inum)
+{
+    struct inode* ip;
+
+    for(ip = icache.inode; ip < icache.inode + SFS_NINODE; ip++) {
+        if(ip->valid && ip->drv == drv && ip->inum == inum) {
+            return ip;
+        }
+    }
+
+    return 0;
+}
+
+// Pick a slot to recycle: an empty one if possible, otherwise the
+// unreferenced inode that was released the longest ago.
+// Caller must hold icache.lock.
+static struct inode* ivictim()
+{
+    struct inode* ip;
+    struct inode* victim = 0;
+
+    for(ip = icache.inode; ip < icache.inode + SFS_NINODE; ip++) {
+        if(ip->ref != 0) {
+            continue;
+        }
+
+        if(!ip->valid) {
+            return ip;
+        }
+
+        if(victim == 0 || ip->lru < victim->lru) {
+            victim = ip;
+        }
+    }
+
+    if(victim == 0) {
+        panic("sfs iget: no inodes");
+    }
+
+    return victim;
+}
+
+static inline int iblock(int inum)
+{
+    return SFS_ITABLE_START + inum / SFS_IPB;
+}
+
+// Copy an on-disk inode into an in-memory one
+static void iload(struct inode* ip, const struct dinode* dip)
+{
+    memmove(ip->name, dip->name, SFS_MAX_LENGTH);
+    ip->type = dip->type;
+    ip->parent = dip->parent;
+
+    memmove(ip->ext, dip->ext, sizeof(ip->ext));
+    ip->n_ext = dip->n_ext;
+    ip->ext_next = dip->ext_next;
+
+    ip->n_child = dip->n_child;
+    ip->size = dip->size;
+    ip->n_blocks = dip->n_blocks;
+}
+
+// Find the inode with number inum on drv and return a referenced in-memory copy.
+// If load is 0, the on-disk contents are not read (used for brand new inodes).
+static struct inode* iget(struct block_driver* drv, int inum, int load)
+{
+    struct inode* ip;
+    struct dinode table[SFS_IPB];
+
+    if(load) {
+        acquire(&icache.lock);
+
+        if((ip = ifind(drv, inum)) != 0) {
+            ip->ref++;
+            release(&icache.lock);
+
+            return ip;
+        }
+
+        release(&icache.lock);
+
+        // not cached -- read it in without holding the lock
+        acquiresleep(&itable_lock);
+        drv->bread(drv, table, iblock(inum));
+        releasesleep(&itable_lock);
+    }
+
+    acquire(&icache.lock);
+
+    // someone else may have brought it in meanwhile
+    if((ip = ifind(drv, inum)) != 0 && load) {
+        ip->ref++;
+        release(&icache.lock);
+
+        return ip;
+    }
+
+    // a brand new inode replaces any stale copy of the same number
+    if(ip == 0) {
+        ip = ivictim();
+    }
+    else if(ip->ref != 0) {
+        panic("sfs iget: new inode in use");
+    }
+
+    if(load) {
+        iload(ip, &table[inum % SFS_IPB]);
+    }
+    else {
+        memset(ip, 0, sizeof(*ip));
+    }
+
+    ip->inum = inum;
+    ip->drv = drv;
+    ip->valid = 1;
+    ip->ref = 1;
+
+    release(&icache.lock);
+    return ip;
+}
+
+void sfs_iput(struct inode* ip)
+{
+    acquire(&icache.lock);
+
+    if(ip->ref < 1) {
+        panic("sfs iput");
+    }
+
+    ip->ref--;
+
+    if(ip->ref == 0) {
+        icache.clock++;
+        ip->lru = icache.clock;
+    }
+
+    release(&icache.lock);
+}
+
+// Write an in-memory inode back to its slot in the inode table
+static void iupdate(struct inode* ip)
+{
+    struct dinode table[SFS_IPB];
+    struct dinode* dip = &table[ip->inum % SFS_IPB];
+
+    // the other inodes of the block have to be preserved
+    acquiresleep(&itable_lock);
+    ip->drv->bread(ip->drv, table, iblock(ip->inum));
+
+    memset(dip, 0, sizeof(*dip));
+    memmove(dip->name, ip->name, SFS_MAX_LENGTH);
+    dip->type = ip->type;
+    dip->inum = ip->inum;
+    dip->parent = ip->parent;
+
+    memmove(dip->ext, ip->ext, sizeof(dip->ext));
+    dip->n_ext = ip->n_ext;
+    dip->ext_next = ip->ext_next;
+
+    dip->n_child = ip->n_child;
+    dip->size = ip->size;
+    dip->n_blocks = ip->n_blocks;
+
+    ip->drv->bwrite(ip->drv, table, iblock(ip->inum));
+    releasesleep(&itable_lock);
+}
+
+static int count_free(struct superblock* sb, struct block_driver* drv);
+
 struct superblock* sfs_readsb(struct block_driver* drv)
 {
-    struct superblock* sb = (void*)kalloc();
-    drv->bread(drv, sb, 0);
+    char block[VFS_BLOCK_SIZE];
+    struct dsuperblock* dsb = (struct dsuperblock*)block;
+
+    drv->bread(drv, block, 0);
 
     // bad magic value (not SFS or corrupted!)
-    if(sb->magic != SFS_MAGIC) {
-        kfree((void*)sb);
+    if(dsb->magic != SFS_MAGIC) {
         return 0;
     }
 
+    int part = drv->info.b_end - drv->info.b_start;
+    int itable = (dsb->ninodes + SFS_IPB - 1) / SFS_IPB;
+    int ibitmap = (dsb->ninodes + SFS_BPB - 1) / SFS_BPB;
+    int bbitmap = (part - dsb->data_start + SFS_BPB - 1) / SFS_BPB;
+
+    // inode table, bitmaps and data blocks overlap, or the bitmap does not
+    // cover the partition
+    if(dsb->ninodes <= 0 || dsb->ibitmap < SFS_ITABLE_START + itable ||
+       dsb->bbitmap < dsb->ibitmap + ibitmap || dsb->data_start >= part ||
+       dsb->data_start < dsb->bbitmap + bbitmap) {
+        return 0;
+    }
+
+    struct superblock* sb = kmalloc(sizeof(*sb));
+
+    sb->magic = dsb->magic;
+    sb->root = dsb->root;
+    sb->ninodes = dsb->ninodes;
+    sb->data_start = dsb->data_start;
+    sb->ibitmap = dsb->ibitmap;
+    sb->bbitmap = dsb->bbitmap;
+    sb->rotor = dsb->rotor;
+
+    // only a hint -- don't trust it blindly
+    if(sb->rotor < 0 || sb->rotor * 32 >= part - sb->data_start) {
+        sb->rotor = 0;
+    }
+
+    initsleeplock(&sb->lock, "sfs sb");
+    sb->map_block = -1;
+    sb->nfree = count_free(sb, drv);
+
     return sb;
 }
 
 void sfs_writesb(struct superblock* sb, struct block_driver* drv)
 {
-    drv->bwrite(drv, sb, 0);
+    char block[VFS_BLOCK_SIZE];
+    struct dsuperblock* dsb = (struct dsuperblock*)block;
+
+    memset(block, 0, VFS_BLOCK_SIZE);
+    dsb->magic = sb->magic;
+    dsb->root = sb->root;
+    dsb->ninodes = sb->ninodes;
+    dsb->data_start = sb->data_start;
+    dsb->ibitmap = sb->ibitmap;
+    dsb->bbitmap = sb->bbitmap;
+    dsb->rotor = sb->rotor;
+
+    drv->bwrite(drv, block, 0);
 }
 
 static int slen(const char* path)
@@ -68,60 +387,48 @@ static int slen(const char* path)
     return count;
 }
 
-struct inode* sfs_namei(const char* path, struct superblock* sb, struct block_driver* drv)
-{
-    struct inode* root = (void*)kalloc();
-    struct inode* tmp = root + 1;
-
-    drv->bread(drv, root, sb->root);
+static int dir_lookup(struct inode* dp, const char* name, int len);
 
-    // sfs_namei("/", ...)
-    if(path[0] == '/' && path[1] == '\0') {
-        root->drv = drv;
-        root->valid = 1;
+struct inode* sfs_lookup(struct inode* dp, const char* name, int len)
+{
+    int inum = dir_lookup(dp, name, len);
 
-        return root;
+    if(inum < 0) {
+        return 0;
     }
 
-    path++;
-
-    while(1)
-    {
-        int len = slen(path);
-        struct inode* old = root;
-
-        for(int i = 0; i < root->n_child; i++)
-        {
-            drv->bread(drv, tmp, root->child[i]);
-            int diff = strncmp(path, tmp->name, len);
-
-            // found a partial match
-            if(diff == 0 && strlen(tmp->name) == len)
-            {
-                // partial --> full match
-                if(path[len] == '\0') {
-                    root = tmp;
+    return iget(dp->drv, inum, 1);
+}
 
-                    root->drv = drv;
-                    root->valid = 1;
+struct inode* sfs_iget(int inum, struct superblock* sb, struct block_driver* drv)
+{
+    return iget(drv, inum, 1);
+}
 
-                    return root;
-                }
+struct inode* sfs_namei(const char* path, struct superblock* sb, struct block_driver* drv)
+{
+    struct inode* ip = iget(drv, sb->root, 1);
 
-                root = tmp;
-                path += len + 1;
-                len = slen(path);
-                i = -1;
-            }
+    while(ip != 0) {
+        // the leading '/' is optional
+        while(*path == '/') {
+            path++;
         }
 
-        // no matches
-        if(old == root) {
+        if(*path == '\0') {
             break;
         }
+
+        int len = slen(path);
+        struct inode* next = sfs_lookup(ip, path, len);
+
+        sfs_iput(ip);
+
+        ip = next;
+        path += len;
     }
 
-    return 0;
+    return ip;
 }
 
 static inline int num_blocks(int size)
@@ -129,6 +436,44 @@ static inline int num_blocks(int size)
     return (size + VFS_BLOCK_SIZE - 1) / VFS_BLOCK_SIZE;
 }
 
+// Map block lblk of the file to its block on disk. If run is not 0, it is set
+// to the number of blocks, starting there, that are consecutive on disk.
+// Returns -1 if lblk is not part of the file.
+static int bmap(struct inode* ip, int lblk, int* run)
+{
+    struct extent_block eb;
+    struct extent* ext = ip->ext;
+    int n_ext = ip->n_ext;
+    int next = ip->ext_next;
+
+    if(lblk < 0 || lblk >= ip->n_blocks) {
+        return -1;
+    }
+
+    for(;;) {
+        for(int i = 0; i < n_ext; i++) {
+            if(lblk < ext[i].len) {
+                if(run) {
+                    *run = ext[i].len - lblk;
+                }
+
+                return ext[i].start + lblk;
+            }
+
+            lblk -= ext[i].len;
+        }
+
+        // continue with the next indirect extent block
+        if(next == 0 || ip->drv->bread(ip->drv, &eb, next) < 0) {
+            return -1;
+        }
+
+        ext = eb.ext;
+        n_ext = eb.n_ext;
+        next = eb.next;
+    }
+}
+
 int sfs_readi(struct inode* ip, char* dst, int off, int size)
 {
     // bad inode
@@ -136,72 +481,102 @@ int sfs_readi(struct inode* ip, char* dst, int off, int size)
         return -1;
     }
 
-    // figure out how many blocks to read
-    int start = off / VFS_BLOCK_SIZE;
+    if(off >= ip->size || size <= 0) {
+        return 0;
+    }
+
     size = (off + size) > ip->size ? ip->size - off : size;
 
-    off = off - start * VFS_BLOCK_SIZE;
+    char block[VFS_BLOCK_SIZE];
+    int start = off / VFS_BLOCK_SIZE;
     int pos = 0;
 
+    off = off % VFS_BLOCK_SIZE;
+
+    // partial first block
     if(off != 0) {
-        char block[VFS_BLOCK_SIZE];
-        ip->drv->bread(ip->drv, block, ip->indir[start]);
+        if(ip->drv->bread(ip->drv, block, bmap(ip, start, 0)) < 0) {
+            return -1;
+        }
 
-        int diff = size > VFS_BLOCK_SIZE ? VFS_BLOCK_SIZE - off : size;
+        int diff = size < VFS_BLOCK_SIZE - off ? size : VFS_BLOCK_SIZE - off;
         memmove(dst, block + off, diff);
 
+        start++;
         pos += diff;
-        size -= diff;
     }
 
-    int i = 0;
+    // whole blocks, read straight into dst -- one request per extent
+    // (or SFS_MAX_RUN blocks of it)
+    while(size - pos >= VFS_BLOCK_SIZE) {
+        void* buffers[SFS_MAX_RUN];
+        int run;
+        int b_num = bmap(ip, start, &run);
 
-    while(size > 0) {
-        // already processed this block
-        if(i == 0 && off != 0) {
-            start++;
-            i++;
-            continue;
+        if(b_num < 0) {
+            return -1;
         }
 
-        char block[VFS_BLOCK_SIZE];
-        ip->drv->bread(ip->drv, block, ip->indir[start]);
+        int n = (size - pos) / VFS_BLOCK_SIZE;
+        n = n < run ? n : run;
+        n = n < SFS_MAX_RUN ? n : SFS_MAX_RUN;
 
-        int diff = size < VFS_BLOCK_SIZE ? size : VFS_BLOCK_SIZE;
-        memmove(dst + pos, block, diff);
+        for(int i = 0; i < n; i++) {
+            buffers[i] = dst + pos + i * VFS_BLOCK_SIZE;
+        }
 
-        start++;
-        pos += diff;
-        size -= diff;
+        if(ip->drv->breadv(ip->drv, buffers, b_num, n) < 0) {
+            return -1;
+        }
+
+        start += n;
+        pos += n * VFS_BLOCK_SIZE;
+    }
+
+    // partial last block
+    if(pos < size) {
+        if(ip->drv->bread(ip->drv, block, bmap(ip, start, 0)) < 0) {
+            return -1;
+        }
+
+        memmove(dst + pos, block, size - pos);
+        pos = size;
     }
 
     return pos;
 }
 
-//
-// glibc implementation of ffs()
-//   FIXME: this is GPL'd so it will have to be removed, since the rest
-//   of this code is not under (nor do I want it to be) the GPL
-//
-static int ffs (int i)
+void sfs_readahead(struct inode* ip, int off, int size)
 {
-  static const unsigned char table[] =
-    {
-      0,1,2,2,3,3,3,3,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-      6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
-      7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
-      7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
-      8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
-      8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
-      8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
-      8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8
-    };
-  unsigned int a;
-  unsigned int x = i & -i;
+    if(ip == 0 || ip->type != SFS_INODE_FILE || ip->drv->breadahead == 0 || off < 0) {
+        return;
+    }
 
-  a = x <= 0xffff ? (x <= 0xff ? 0 : 8) : (x <= 0xffffff ?  16 : 24);
+    if(off + size > ip->size) {
+        size = ip->size - off;
+    }
 
-  return table[x >> a] + a;
+    if(size <= 0) {
+        return;
+    }
+
+    int start = off / VFS_BLOCK_SIZE;
+    int end = num_blocks(off + size);
+
+    // one hint per extent (or the part of it that is in the range)
+    while(start < end) {
+        int run;
+        int b_num = bmap(ip, start, &run);
+
+        if(b_num < 0) {
+            return;
+        }
+
+        run = run < end - start ? run : end - start;
+        ip->drv->breadahead(ip->drv, b_num, run);
+
+        start += run;
+    }
 }
 
 static inline void set_bit(int* map, int bit)
@@ -209,94 +584,537 @@ static inline void set_bit(int* map, int bit)
     *map |= (1 << bit);
 }
 
-static void allocate_block(struct superblock* sb, struct inode* ip)
+static inline int bit_isset(const int* map, int bit)
 {
-    int fpos = 0;
-    int bit = ffs(~(sb->fblock[fpos])) - 1;
+    return (map[bit / 32] >> (bit % 32)) & 1;
+}
 
-    while(bit == -1) {
-        fpos++;
+static inline int popcount(uint x)
+{
+    x = x - ((x >> 1) & 0x55555555);
+    x = (x & 0x33333333) + ((x >> 2) & 0x33333333);
+    x = (x + (x >> 4)) & 0x0F0F0F0F;
+
+    return (x * 0x01010101) >> 24;
+}
 
-        if(fpos >= SFS_SB_BLOCK_BITSIZE) {
-            panic("sfs: out of file blocks\n");
+// Claim the first clear bit of a bitmap of nwords words, or return -1
+static int bitmap_alloc(int* map, int nwords)
+{
+    for(int i = 0; i < nwords; i++) {
+        if(map[i] != ~0) {
+            int bit = bsf(~(uint)map[i]);
+            set_bit(&map[i], bit);
+
+            return i * 32 + bit;
         }
+    }
 
-        bit = ffs(~(sb->fblock[fpos])) - 1;
+    return -1;
+}
+
+// Number of data blocks, i.e. of block bitmap bits in use
+static int block_bits(struct superblock* sb, struct block_driver* drv)
+{
+    return drv->info.b_end - drv->info.b_start - sb->data_start;
+}
+
+// Word w of the block bitmap. Reads the bitmap block that holds it into
+// sb->map, unless that is the one already there. Only balloc writes the
+// block bitmap, and it writes sb->map, so the copy never goes stale.
+static int* bword(struct superblock* sb, struct block_driver* drv, int w)
+{
+    int b = w / (SFS_BPB / 32);
+
+    if(sb->map_block != b) {
+        drv->bread(drv, sb->map, sb->bbitmap + b);
+        sb->map_block = b;
     }
 
-    set_bit(&sb->fblock[fpos], bit);
+    return &sb->map[w % (SFS_BPB / 32)];
+}
+
+// Number of free data blocks, read from the block bitmap (at mount)
+static int count_free(struct superblock* sb, struct block_driver* drv)
+{
+    int max = block_bits(sb, drv);
+    int n = 0;
+
+    for(int w = 0; w * 32 < max; w++) {
+        uint free = ~(uint)*bword(sb, drv, w);
+
+        if(max - w * 32 < 32) {
+            free &= (1u << (max - w * 32)) - 1;
+        }
+
+        n += popcount(free);
+    }
 
-    ip->indir[ip->n_blocks] = fpos * 32 + bit + 128;
-    ip->n_blocks++;
+    return n;
 }
 
-int sfs_writei(struct inode* ip, struct superblock* sb, const char* src, int off, int size)
+// Allocate up to want consecutive blocks, preferably starting right at goal
+// (so that appends stay contiguous). Otherwise, scan the bitmap a word at a
+// time from the rotor: first for a word with room for the whole run, then
+// for any free block. Sets *got to the length of the run that was found.
+// Caller must hold sb->lock.
+//
+// Returns the first block of the run.
+static int balloc(struct superblock* sb, struct block_driver* drv, int goal, int want, int* got)
 {
-    // bad inode
-    if(ip == 0 || ip->type != SFS_INODE_FILE) {
+    int max = block_bits(sb, drv);
+    int nwords = (max + 31) / 32;
+    int bit = -1;
+
+    goal -= sb->data_start;
+
+    if(goal >= 0 && goal < max) {
+        bword(sb, drv, goal / 32);
+
+        if(!bit_isset(sb->map, goal % SFS_BPB)) {
+            bit = goal;
+        }
+    }
+
+    for(int pass = 0; bit < 0 && pass < 2; pass++) {
+        int need = pass == 0 ? (want < 32 ? want : 32) : 1;
+
+        for(int i = 0; i < nwords; i++) {
+            int w = (sb->rotor + i) % nwords;
+            uint free = ~(uint)*bword(sb, drv, w);
+
+            // bits past the end of the partition
+            if(w == nwords - 1 && max % 32 != 0) {
+                free &= (1u << (max % 32)) - 1;
+            }
+
+            if(free != 0 && popcount(free) >= need) {
+                bit = w * 32 + bsf(free);
+                break;
+            }
+        }
+    }
+
+    if(bit < 0) {
+        panic("sfs: out of file blocks\n");
+    }
+
+    // the run ends with the bitmap block (or the partition)
+    int end = (bit / SFS_BPB + 1) * SFS_BPB;
+    int n = 0;
+
+    end = end < max ? end : max;
+    bword(sb, drv, bit / 32);
+
+    while(n < want && bit + n < end && !bit_isset(sb->map, (bit + n) % SFS_BPB)) {
+        set_bit(&sb->map[(bit + n) % SFS_BPB / 32], (bit + n) % 32);
+        n++;
+    }
+
+    drv->bwrite(drv, sb->map, sb->bbitmap + bit / SFS_BPB);
+
+    sb->nfree -= n;
+    sb->rotor = ((bit + n) / 32) % nwords;
+    *got = n;
+
+    return bit + sb->data_start;
+}
+
+// Add the run of len blocks at start to the end of the file, growing the
+// last extent if the run directly follows it
+static void extent_append(struct superblock* sb, struct inode* ip, int start, int len)
+{
+    int got;
+
+    ip->n_blocks += len;
+
+    if(ip->ext_next == 0) {
+        struct extent* last = &ip->ext[ip->n_ext - 1];
+
+        if(ip->n_ext > 0 && last->start + last->len == start) {
+            last->len += len;
+            return;
+        }
+
+        if(ip->n_ext < SFS_MAX_EXTENTS) {
+            ip->ext[ip->n_ext].start = start;
+            ip->ext[ip->n_ext].len = len;
+            ip->n_ext++;
+
+            return;
+        }
+    }
+
+    struct extent_block eb;
+    int cur = ip->ext_next;
+
+    if(cur == 0) {
+        // the inode is full -- start the indirect chain
+        cur = ip->ext_next = balloc(sb, ip->drv, 0, 1, &got);
+        memset(&eb, 0, sizeof(eb));
+    }
+    else {
+        // find the end of the chain
+        ip->drv->bread(ip->drv, &eb, cur);
+
+        while(eb.next != 0) {
+            cur = eb.next;
+            ip->drv->bread(ip->drv, &eb, cur);
+        }
+    }
+
+    struct extent* last = &eb.ext[eb.n_ext - 1];
+
+    if(eb.n_ext > 0 && last->start + last->len == start) {
+        last->len += len;
+    }
+    else {
+        if(eb.n_ext == SFS_EXTENTS_PER_BLOCK) {
+            int next = balloc(sb, ip->drv, 0, 1, &got);
+
+            eb.next = next;
+            ip->drv->bwrite(ip->drv, &eb, cur);
+
+            cur = next;
+            memset(&eb, 0, sizeof(eb));
+        }
+
+        eb.ext[eb.n_ext].start = start;
+        eb.ext[eb.n_ext].len = len;
+        eb.n_ext++;
+    }
+
+    ip->drv->bwrite(ip->drv, &eb, cur);
+}
+
+// Add count blocks to the end of the file, continuing where it ends on disk.
+// Returns -1, without allocating anything, if there are not enough free blocks
+// (counting the indirect extent blocks that the new runs might need).
+//
+// Holds sb->lock throughout, so that the check stays true until the blocks
+// are taken and concurrent extends never claim the same bit.
+static int iextend(struct superblock* sb, struct inode* ip, int count)
+{
+    acquiresleep(&sb->lock);
+
+    if(count + 1 + count / SFS_EXTENTS_PER_BLOCK > sb->nfree) {
+        releasesleep(&sb->lock);
         return -1;
     }
 
-    // compute how much additional byte-space is needed
-    int left = ip->n_blocks * VFS_BLOCK_SIZE - ip->size;
-    int n_size = size - left;
+    while(count > 0) {
+        int goal = ip->n_blocks > 0 ? bmap(ip, ip->n_blocks - 1, 0) + 1 : 0;
+        int got;
+        int start = balloc(sb, ip->drv, goal, count, &got);
 
-    if(n_size < 0) {
-        n_size = 0;
+        extent_append(sb, ip, start, got);
+        count -= got;
     }
 
-    int blocks = num_blocks(n_size);
-    int start = ip->n_blocks - 1;
-    int special = 0;
+    releasesleep(&sb->lock);
+    return 0;
+}
 
-    if(start < 0) {
-        start = 0;
-        special = 1;
+int sfs_writei(struct inode* ip, struct superblock* sb, const char* src, int off, int size)
+{
+    // bad inode
+    if(ip == 0 || ip->type != SFS_INODE_FILE || off < 0 || size < 0) {
+        return -1;
     }
 
+    char block[VFS_BLOCK_SIZE];
+    int old = ip->n_blocks;
+
     // allocate the new blocks
-    for(int i = 0; i < blocks; i++) {
-        allocate_block(sb, ip);
+    if(ip->n_blocks < num_blocks(off + size) &&
+       iextend(sb, ip, num_blocks(off + size) - ip->n_blocks) < 0) {
+        return -1;
+    }
+
+    // zero any blocks skipped over by writing past the end
+    memset(block, 0, VFS_BLOCK_SIZE);
+
+    for(int lblk = old; lblk < off / VFS_BLOCK_SIZE; lblk++) {
+        ip->drv->bwrite(ip->drv, block, bmap(ip, lblk, 0));
     }
 
-    // handle left-over space in pre-existing block
     int pos = 0;
 
-    if(left != 0) {
-        char block[VFS_BLOCK_SIZE];
-        ip->drv->bread(ip->drv, block, ip->indir[start]);
+    while(pos < size) {
+        int lblk = (off + pos) / VFS_BLOCK_SIZE;
+        int boff = (off + pos) % VFS_BLOCK_SIZE;
+        int bytes = VFS_BLOCK_SIZE - boff;
+        int b_num = bmap(ip, lblk, 0);
 
-        int bytes = left > size ? size : left;
-        memmove(block + VFS_BLOCK_SIZE - left, src, bytes);
+        if(bytes > size - pos) {
+            bytes = size - pos;
+        }
+
+        // partially overwritten block -- keep the rest of it
+        if(bytes != VFS_BLOCK_SIZE) {
+            if(lblk < old) {
+                ip->drv->bread(ip->drv, block, b_num);
+            }
+            else {
+                memset(block, 0, VFS_BLOCK_SIZE);
+            }
+        }
 
-        ip->drv->bwrite(ip->drv, block, ip->indir[start]);
+        memmove(block + boff, src + pos, bytes);
+        ip->drv->bwrite(ip->drv, block, b_num);
 
-        start++;
         pos += bytes;
-        size -= bytes;
     }
-    else if (!special) {
-        start++;
+
+    // update inode on disk
+    if(off + pos > ip->size) {
+        ip->size = off + pos;
     }
 
-    while(size > 0)
-    {
-        char block[VFS_BLOCK_SIZE];
-        int bytes = VFS_BLOCK_SIZE > size ? size : VFS_BLOCK_SIZE;
+    iupdate(ip);
 
-        memmove(block, src + pos, bytes);
-        ip->drv->bwrite(ip->drv, block, ip->indir[start]);
+    return pos;
+}
 
-        start++;
-        pos += bytes;
-        size -= bytes;
+static uint name_hash(const char* name, int len)
+{
+    uint h = 2166136261u;
+
+    for(int i = 0; i < len; i++) {
+        h ^= (uchar)name[i];
+        h *= 16777619u;
     }
 
-    // update inode on disk
-    ip->size += pos;
-    ip->drv->bwrite(ip->drv, ip, ip->inum);
+    return h;
+}
 
-    return pos;
+// Read bucket b of directory dp into db and return its block number, or -1
+// (leaving db empty) if it cannot be read. The entry count comes from disk,
+// so it is clamped to what fits in a block before anything indexes with it.
+static int dir_read(struct inode* dp, int b, struct dirblock* db)
+{
+    int b_num = bmap(dp, b, 0);
+
+    if(b_num < 0 || dp->drv->bread(dp->drv, db, b_num) < 0) {
+        db->count = 0;
+        return -1;
+    }
+
+    if(db->count < 0) {
+        db->count = 0;
+    }
+    else if(db->count > SFS_DIRENTS) {
+        db->count = SFS_DIRENTS;
+    }
+
+    return b_num;
+}
+
+// Look name up in directory dp: a single block read.
+// Returns the inode number, or -1 if there is no such entry.
+static int dir_lookup(struct inode* dp, const char* name, int len)
+{
+    char block[VFS_BLOCK_SIZE];
+    struct dirblock* db = (struct dirblock*)block;
+
+    if(dp->type != SFS_INODE_DIR || dp->n_blocks == 0 || len >= SFS_MAX_LENGTH) {
+        return -1;
+    }
+
+    uint h = name_hash(name, len);
+
+    if(dir_read(dp, h & (dp->n_blocks - 1), db) < 0) {
+        return -1;
+    }
+
+    for(int i = 0; i < db->count; i++) {
+        struct dirent* de = &db->ent[i];
+
+        if(de->hash == h && strncmp(de->name, name, len) == 0 && de->name[len] == '\0') {
+            return de->inum;
+        }
+    }
+
+    return -1;
+}
+
+// Double the number of buckets of directory dp (or create the first one),
+// splitting every bucket b into b and b + n on the next bit of the hash
+static int dir_grow(struct superblock* sb, struct inode* dp)
+{
+    char lo[VFS_BLOCK_SIZE], hi[VFS_BLOCK_SIZE];
+    struct dirblock* lb = (struct dirblock*)lo;
+    struct dirblock* hb = (struct dirblock*)hi;
+    int n = dp->n_blocks;
+
+    if(n >= SFS_MAX_BUCKETS || iextend(sb, dp, n == 0 ? 1 : n) < 0) {
+        return -1;
+    }
+
+    if(n == 0) {
+        memset(lo, 0, VFS_BLOCK_SIZE);
+        dp->drv->bwrite(dp->drv, lo, bmap(dp, 0, 0));
+    }
+
+    for(int b = 0; b < n; b++) {
+        int lo_num = dir_read(dp, b, lb);
+        int keep = 0;
+
+        memset(hi, 0, VFS_BLOCK_SIZE);
+
+        for(int i = 0; i < lb->count; i++) {
+            if(lb->ent[i].hash & n) {
+                hb->ent[hb->count++] = lb->ent[i];
+            }
+            else {
+                lb->ent[keep++] = lb->ent[i];
+            }
+        }
+
+        lb->count = keep;
+
+        // an unreadable bucket is left alone; its new half starts empty
+        if(lo_num >= 0) {
+            dp->drv->bwrite(dp->drv, lo, lo_num);
+        }
+
+        dp->drv->bwrite(dp->drv, hi, bmap(dp, b + n, 0));
+    }
+
+    dp->size = dp->n_blocks * VFS_BLOCK_SIZE;
+    return 0;
+}
+
+// Number of buckets the table of a directory with n buckets needs so that
+// the bucket of hash h, currently holding the entries of db, has room for one
+// more entry. Splitting only ever moves entries out of a bucket, so this is
+// decided by db alone. Returns -1 if no table size up to SFS_MAX_BUCKETS does.
+static int dir_need(const struct dirblock* db, uint h, int n)
+{
+    for(n *= 2; n <= SFS_MAX_BUCKETS; n *= 2) {
+        int same = 0;
+
+        for(int i = 0; i < db->count; i++) {
+            if(((db->ent[i].hash ^ h) & (n - 1)) == 0) {
+                same++;
+            }
+        }
+
+        if(same < SFS_DIRENTS) {
+            return n;
+        }
+    }
+
+    return -1;
+}
+
+// Free blocks that growing a directory from n to need buckets may take: the
+// sum of what iextend asks for at each doubling
+static int dir_grow_cost(int n, int need)
+{
+    int cost = 0;
+
+    while(n < need) {
+        int count = n == 0 ? 1 : n;
+
+        cost += count + 1 + count / SFS_EXTENTS_PER_BLOCK;
+        n += count;
+    }
+
+    return cost;
+}
+
+// Add an entry for inum to directory dp.
+// Returns -1 if the name already exists or the directory is full.
+//
+// Every doubling of the table moves entries to the new buckets on disk, so
+// dp is written back after each one: if a later one fails, the inode on
+// disk still covers all the buckets.
+static int dir_add(struct superblock* sb, struct inode* dp, const char* name, int inum)
+{
+    char block[VFS_BLOCK_SIZE];
+    struct dirblock* db = (struct dirblock*)block;
+    int len = strlen(name);
+    uint h = name_hash(name, len);
+
+    if(dp->n_blocks == 0) {
+        if(dir_grow(sb, dp) < 0) {
+            return -1;
+        }
+
+        iupdate(dp);
+    }
+
+    for(;;) {
+        int b_num = dir_read(dp, h & (dp->n_blocks - 1), db);
+
+        if(b_num < 0) {
+            return -1;
+        }
+
+        for(int i = 0; i < db->count; i++) {
+            if(db->ent[i].hash == h && strncmp(db->ent[i].name, name, SFS_MAX_LENGTH) == 0) {
+                return -1;
+            }
+        }
+
+        if(db->count < SFS_DIRENTS) {
+            struct dirent* de = &db->ent[db->count++];
+
+            de->hash = h;
+            de->inum = inum;
+            memset(de->name, 0, SFS_MAX_LENGTH);
+            memmove(de->name, name, len);
+
+            dp->drv->bwrite(dp->drv, block, b_num);
+            dp->n_child++;
+
+            return 0;
+        }
+
+        // bucket is full -- grow the table until it has room, if there is
+        // space for that (names colliding in many hash bits could otherwise
+        // blow it up to SFS_MAX_BUCKETS blocks). nfree is only a snapshot;
+        // iextend checks again.
+        int need = dir_need(db, h, dp->n_blocks);
+
+        if(need < 0 || dir_grow_cost(dp->n_blocks, need) > sb->nfree) {
+            return -1;
+        }
+
+        while(dp->n_blocks < need) {
+            if(dir_grow(sb, dp) < 0) {
+                return -1;
+            }
+
+            iupdate(dp);
+        }
+    }
+}
+
+// Inode number of the n-th entry of directory dp, or -1
+static int dir_entry(struct inode* dp, int n)
+{
+    char block[VFS_BLOCK_SIZE];
+    struct dirblock* db = (struct dirblock*)block;
+
+    if(dp->type != SFS_INODE_DIR || n < 0 || n >= dp->n_child) {
+        return -1;
+    }
+
+    for(int b = 0; b < dp->n_blocks; b++) {
+        if(dir_read(dp, b, db) < 0) {
+            return -1;
+        }
+
+        if(n < db->count) {
+            return db->ent[n].inum;
+        }
+
+        n -= db->count;
+    }
+
+    return -1;
 }
 
 static int last_slash(const char* path)
@@ -316,29 +1134,65 @@ static int last_slash(const char* path)
     return pos;
 }
 
-static struct inode* allocate_inode(struct superblock* sb, const char* name)
+// Claim a free inode number in the inode bitmap, or return -1
+static int ialloc(struct superblock* sb, struct block_driver* drv)
 {
-    int fpos = 0;
-    int bit = ffs(~(sb->finode[fpos])) - 1;
+    int map[SFS_BPB / 32];
+    int inum = -1;
 
-    while(bit == -1) {
-        fpos++;
+    acquiresleep(&itable_lock);
 
-        if(fpos >= SFS_SB_INODE_BITSIZE) {
-            panic("sfs: out of inode blocks\n");
+    for(int b = 0; b * SFS_BPB < sb->ninodes && inum < 0; b++) {
+        int bits = sb->ninodes - b * SFS_BPB;
+        int bit;
+
+        if(bits > SFS_BPB) {
+            bits = SFS_BPB;
         }
 
-        bit = ffs(~(sb->finode[fpos])) - 1;
+        drv->bread(drv, map, sb->ibitmap + b);
+
+        if((bit = bitmap_alloc(map, (bits + 31) / 32)) >= 0 && bit < bits) {
+            drv->bwrite(drv, map, sb->ibitmap + b);
+            inum = b * SFS_BPB + bit;
+        }
     }
 
-    set_bit(&sb->finode[fpos], bit);
+    releasesleep(&itable_lock);
+    return inum;
+}
+
+// Give inode number inum back to the inode bitmap
+static void ifree(struct superblock* sb, struct block_driver* drv, int inum)
+{
+    int map[SFS_BPB / 32];
+    int b = sb->ibitmap + inum / SFS_BPB;
 
-    struct inode* ip = (void*)kalloc();
+    acquiresleep(&itable_lock);
+
+    drv->bread(drv, map, b);
+    map[inum % SFS_BPB / 32] &= ~(1 << (inum % 32));
+    drv->bwrite(drv, map, b);
+
+    releasesleep(&itable_lock);
+}
+
+// Returns a new in-memory inode, or 0 if there are no free inodes left
+static struct inode* allocate_inode(struct superblock* sb, struct block_driver* drv, const char* name)
+{
+    int inum = ialloc(sb, drv);
+
+    if(inum < 0) {
+        return 0;
+    }
+
+    struct inode* ip = iget(drv, inum, 0);
 
-    ip->inum = fpos * 32 + bit;
     ip->n_child = 0;
     ip->size = 0;
     ip->n_blocks = 0;
+    ip->n_ext = 0;
+    ip->ext_next = 0;
 
     int len = strlen(name);
     strncpy(ip->name, name, len);
@@ -350,39 +1204,62 @@ static struct inode* allocate_inode(struct superblock* sb, const char* name)
 struct inode* sfs_createi(const char* path, int type, struct superblock* sb, struct block_driver* drv)
 {
     int pos = last_slash(path);
-    char* buffer = kalloc();
+    const char* name = path[pos] == '/' ? path + pos + 1 : path;
+    char* buffer = kmalloc(pos + 2);
 
-    // keep leading '/'
+    // parent path -- the root if there is nothing before the last '/'
     if(pos == 0) {
+        buffer[0] = '/';
         pos++;
     }
+    else {
+        memmove(buffer, path, pos);
+    }
 
-    memmove(buffer, path, pos);
     buffer[pos] = '\0';
 
     struct inode* parent = sfs_namei(buffer, sb, drv);
+    kfree_small(buffer);
 
     // bad parent path
     if(parent == 0) {
         return 0;
     }
 
-    if(pos != 1) {
-        pos++;
+    // bad name, or it exists already
+    if(parent->type != SFS_INODE_DIR || *name == '\0' || strlen(name) >= SFS_MAX_LENGTH ||
+       dir_lookup(parent, name, strlen(name)) >= 0) {
+        sfs_iput(parent);
+        return 0;
+    }
+
+    struct inode* ip = allocate_inode(sb, drv, name);
+
+    // out of inodes
+    if(ip == 0) {
+        sfs_iput(parent);
+        return 0;
     }
 
-    struct inode* ip = allocate_inode(sb, path + pos);
     ip->type = (type == VFS_INODE_FILE) ? SFS_INODE_FILE : SFS_INODE_DIR;
     ip->parent = parent->inum;
-    ip->drv = drv;
 
-    parent->child[parent->n_child] = ip->inum;
-    parent->n_child++;
+    // directory is full -- give the inode back (dir_add has written back
+    // whatever growing the parent it did)
+    if(dir_add(sb, parent, name, ip->inum) < 0) {
+        ifree(sb, drv, ip->inum);
+
+        sfs_iput(ip);
+        sfs_iput(parent);
+
+        return 0;
+    }
 
     // update inodes on disk
-    drv->bwrite(drv, ip, ip->inum);
-    drv->bwrite(drv, parent, parent->inum);
+    iupdate(ip);
+    iupdate(parent);
 
+    sfs_iput(parent);
     return ip;
 }
 
@@ -396,19 +1273,14 @@ void sfs_stati(struct inode* ip, struct stat* st)
 
 struct inode* sfs_childi(struct inode* ip, int child)
 {
+    int inum = dir_entry(ip, child);
+
     // invalid child number
-    if(child >= ip->n_child) {
+    if(inum < 0) {
         return 0;
     }
 
-    int block = ip->child[child];
-
-    struct inode* cip = (void*)kalloc();
-
-    ip->drv->bread(ip->drv, cip, block);
-    cip->drv = ip->drv;
-
-    return cip;
+    return iget(ip->drv, inum, 1);
 }
 
 const char* sfs_iname(struct inode* ip, int full)
@@ -423,14 +1295,7 @@ struct inode* sfs_parenti(struct inode* ip)
         return 0;
     }
 
-    int block = ip->parent;
-
-    struct inode* pip = (void*)kalloc();
-
-    ip->drv->bread(ip->drv, pip, block);
-    pip->drv = ip->drv;
-
-    return pip;
+    return iget(ip->drv, ip->parent, 1);
 }
 
 static struct fs_ops ops = {
@@ -441,13 +1306,19 @@ static struct fs_ops ops = {
     .createi = sfs_createi,
     .writei = sfs_writei,
     .readi = sfs_readi,
+    .readahead = sfs_readahead,
     .stati = sfs_stati,
     .childi = sfs_childi,
     .iname = sfs_iname,
-    .parenti = sfs_parenti
+    .parenti = sfs_parenti,
+    .iput = sfs_iput,
+    .lookup = sfs_lookup,
+    .iget = sfs_iget
 };
 
 void sfs_init()
 {
+    initlock(&icache.lock, "sfs icache");
+    initsleeplock(&itable_lock, "sfs itable");
     vfs_register_fs("sfs", &ops);
 }
@@ -0,0 +1,256 @@
+// Small object allocator.
+//
+// kalloc() only hands out whole pages, which is far too much for most of the
+// kernel's bookkeeping structures. kmalloc() serves requests of up to
+// SLAB_MAX bytes from power-of-two size classes instead. Each class carves
+// kalloc'd pages (slabs) into equally sized objects; the slab header lives at
+// the start of the page, so kfree_small() can find it -- and with it the size
+// class -- by rounding the pointer down. Larger requests get a whole page.
+//
+// Every CPU keeps a small magazine of free objects per size class. Most
+// allocations and frees only touch the magazine (with interrupts off), and
+// the per-class lock is only taken to refill or drain a magazine in batches.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "spinlock.h"
+
+#define SLAB_MIN_SHIFT 4                     // smallest class: 16 bytes
+#define SLAB_NCLASS    7                     // 16, 32, ..., 1024 bytes
+#define SLAB_MAX       (1 << (SLAB_MIN_SHIFT + SLAB_NCLASS - 1))
+
+#define MAG_SIZE  16             // objects per magazine
+#define MAG_BATCH (MAG_SIZE / 2) // objects moved per refill/drain
+
+struct object {
+    struct object* next;
+};
+
+// Slab header, at the start of each slab page
+struct slab {
+    struct slab* prev; // partial list of the class
+    struct slab* next;
+    struct object* free;
+    int cls;
+    int inuse;
+};
+
+struct slab_class {
+    struct spinlock lock;
+    int size;
+    struct slab* partial; // slabs with at least one free object
+};
+
+struct magazine {
+    int count;
+    void* obj[MAG_SIZE];
+};
+
+static struct slab_class classes[SLAB_NCLASS];
+static struct magazine mags[NCPU][SLAB_NCLASS];
+
+void slabinit()
+{
+    for(int i = 0; i < SLAB_NCLASS; i++) {
+        initlock(&classes[i].lock, "slab");
+        classes[i].size = 1 << (SLAB_MIN_SHIFT + i);
+        classes[i].partial = 0;
+    }
+}
+
+static int size_class(uint size)
+{
+    int cls = 0;
+
+    while((1u << (SLAB_MIN_SHIFT + cls)) < size) {
+        cls++;
+    }
+
+    return cls;
+}
+
+// Caller must hold c->lock
+static void partial_remove(struct slab_class* c, struct slab* s)
+{
+    if(s->prev != 0) {
+        s->prev->next = s->next;
+    }
+    else {
+        c->partial = s->next;
+    }
+
+    if(s->next != 0) {
+        s->next->prev = s->prev;
+    }
+
+    s->prev = s->next = 0;
+}
+
+// Caller must hold c->lock
+static void partial_insert(struct slab_class* c, struct slab* s)
+{
+    s->prev = 0;
+    s->next = c->partial;
+
+    if(c->partial != 0) {
+        c->partial->prev = s;
+    }
+
+    c->partial = s;
+}
+
+// Carve a new page into objects of class cls
+static struct slab* slab_create(int cls)
+{
+    struct slab* s = (struct slab*)kalloc();
+
+    if(s == 0) {
+        return 0;
+    }
+
+    int size = classes[cls].size;
+
+    s->prev = s->next = 0;
+    s->free = 0;
+    s->cls = cls;
+    s->inuse = 0;
+
+    // objects are laid out from the end of the page, so they are all
+    // aligned to their size and never overlap the header
+    for(uint off = PGSIZE - size; off >= sizeof(struct slab); off -= size) {
+        struct object* obj = (struct object*)((char*)s + off);
+        obj->next = s->free;
+        s->free = obj;
+    }
+
+    return s;
+}
+
+// Move up to n free objects of class cls into buffer.
+// Caller must hold the class lock. Returns the number of objects moved.
+static int slab_take(int cls, void** buffer, int n)
+{
+    struct slab_class* c = &classes[cls];
+    int got = 0;
+
+    while(got < n) {
+        struct slab* s = c->partial;
+
+        if(s == 0) {
+            // kalloc() takes its own lock; no need to drop ours
+            if((s = slab_create(cls)) == 0) {
+                break;
+            }
+
+            partial_insert(c, s);
+        }
+
+        while(got < n && s->free != 0) {
+            buffer[got++] = s->free;
+            s->free = s->free->next;
+            s->inuse++;
+        }
+
+        if(s->free == 0) {
+            partial_remove(c, s);
+        }
+    }
+
+    return got;
+}
+
+// Return n objects of class cls to their slabs, releasing slabs that become
+// completely free (as long as another partial slab remains).
+// Caller must hold the class lock.
+static void slab_give(int cls, void** buffer, int n)
+{
+    struct slab_class* c = &classes[cls];
+
+    for(int i = 0; i < n; i++) {
+        struct object* obj = buffer[i];
+        struct slab* s = (struct slab*)PGROUNDDOWN((uint)obj);
+
+        if(s->free == 0) {
+            partial_insert(c, s);
+        }
+
+        obj->next = s->free;
+        s->free = obj;
+        s->inuse--;
+
+        if(s->inuse == 0 && (s->prev != 0 || s->next != 0)) {
+            partial_remove(c, s);
+            kfree((char*)s);
+        }
+    }
+}
+
+void* kmalloc(uint size)
+{
+    if(size == 0) {
+        return 0;
+    }
+
+    if(size > SLAB_MAX) {
+        if(size > PGSIZE) {
+            panic("kmalloc: too big");
+        }
+
+        return kalloc();
+    }
+
+    int cls = size_class(size);
+    void* obj = 0;
+
+    pushcli();
+    struct magazine* m = &mags[cpuid()][cls];
+
+    if(m->count == 0) {
+        acquire(&classes[cls].lock);
+        m->count = slab_take(cls, m->obj, MAG_BATCH);
+        release(&classes[cls].lock);
+    }
+
+    if(m->count > 0) {
+        obj = m->obj[--m->count];
+    }
+
+    popcli();
+    return obj;
+}
+
+void kfree_small(void* ptr)
+{
+    if(ptr == 0) {
+        return;
+    }
+
+    // whole pages (from the kalloc fallback) are page aligned, slab objects never are
+    if((uint)ptr % PGSIZE == 0) {
+        kfree(ptr);
+        return;
+    }
+
+    struct slab* s = (struct slab*)PGROUNDDOWN((uint)ptr);
+    int cls = s->cls;
+
+    if(cls < 0 || cls >= SLAB_NCLASS) {
+        panic("kfree_small");
+    }
+
+    pushcli();
+    struct magazine* m = &mags[cpuid()][cls];
+
+    if(m->count == MAG_SIZE) {
+        acquire(&classes[cls].lock);
+        slab_give(cls, &m->obj[MAG_SIZE - MAG_BATCH], MAG_BATCH);
+        release(&classes[cls].lock);
+
+        m->count -= MAG_BATCH;
+    }
+
+    m->obj[m->count++] = ptr;
+    popcli();
+}
@@ -27,7 +27,7 @@ acquiresleep(struct sleeplock *lk)
     sleep(lk, &lk->lk);
   }
   lk->locked = 1;
-  lk->pid = myproc()->pid;
+  lk->pid = myproc() ? myproc()->pid : 0;  // no process while booting
   release(&lk->lk);
 }
 
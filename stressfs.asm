@@ -0,0 +1,1338 @@
+
+_stressfs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "user.h"
+#include "fcntl.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	81 ec 24 02 00 00    	sub    $0x224,%esp
+  int fd, i;
+  char path[] = "stressfs0";
+  14:	c7 45 e6 73 74 72 65 	movl   $0x65727473,-0x1a(%ebp)
+  1b:	c7 45 ea 73 73 66 73 	movl   $0x73667373,-0x16(%ebp)
+  22:	66 c7 45 ee 30 00    	movw   $0x30,-0x12(%ebp)
+  char data[512];
+
+  printf(1, "stressfs starting\n");
+  28:	83 ec 08             	sub    $0x8,%esp
+  2b:	68 00 10 00 00       	push   $0x1000
+  30:	6a 01                	push   $0x1
+  32:	e8 f3 05 00 00       	call   62a <printf>
+  37:	83 c4 10             	add    $0x10,%esp
+  memset(data, 'a', sizeof(data));
+  3a:	83 ec 04             	sub    $0x4,%esp
+  3d:	68 00 02 00 00       	push   $0x200
+  42:	6a 61                	push   $0x61
+  44:	8d 85 e6 fd ff ff    	lea    -0x21a(%ebp),%eax
+  4a:	50                   	push   %eax
+  4b:	e8 be 01 00 00       	call   20e <memset>
+  50:	83 c4 10             	add    $0x10,%esp
+
+  for(i = 0; i < 4; i++)
+  53:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  5a:	eb 0d                	jmp    69 <main+0x69>
+    if(fork() > 0)
+  5c:	e8 1d 04 00 00       	call   47e <fork>
+  61:	85 c0                	test   %eax,%eax
+  63:	7f 0c                	jg     71 <main+0x71>
+  for(i = 0; i < 4; i++)
+  65:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  69:	83 7d f4 03          	cmpl   $0x3,-0xc(%ebp)
+  6d:	7e ed                	jle    5c <main+0x5c>
+  6f:	eb 01                	jmp    72 <main+0x72>
+      break;
+  71:	90                   	nop
+
+  printf(1, "write %d\n", i);
+  72:	83 ec 04             	sub    $0x4,%esp
+  75:	ff 75 f4             	push   -0xc(%ebp)
+  78:	68 13 10 00 00       	push   $0x1013
+  7d:	6a 01                	push   $0x1
+  7f:	e8 a6 05 00 00       	call   62a <printf>
+  84:	83 c4 10             	add    $0x10,%esp
+
+  path[8] += i;
+  87:	0f b6 45 ee          	movzbl -0x12(%ebp),%eax
+  8b:	89 c2                	mov    %eax,%edx
+  8d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  90:	01 d0                	add    %edx,%eax
+  92:	88 45 ee             	mov    %al,-0x12(%ebp)
+  fd = open(path, O_CREATE | O_RDWR);
+  95:	83 ec 08             	sub    $0x8,%esp
+  98:	68 02 02 00 00       	push   $0x202
+  9d:	8d 45 e6             	lea    -0x1a(%ebp),%eax
+  a0:	50                   	push   %eax
+  a1:	e8 20 04 00 00       	call   4c6 <open>
+  a6:	83 c4 10             	add    $0x10,%esp
+  a9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(i = 0; i < 20; i++)
+  ac:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  b3:	eb 1e                	jmp    d3 <main+0xd3>
+//    printf(fd, "%d\n", i);
+    write(fd, data, sizeof(data));
+  b5:	83 ec 04             	sub    $0x4,%esp
+  b8:	68 00 02 00 00       	push   $0x200
+  bd:	8d 85 e6 fd ff ff    	lea    -0x21a(%ebp),%eax
+  c3:	50                   	push   %eax
+  c4:	ff 75 f0             	push   -0x10(%ebp)
+  c7:	e8 da 03 00 00       	call   4a6 <write>
+  cc:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 20; i++)
+  cf:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  d3:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+  d7:	7e dc                	jle    b5 <main+0xb5>
+  close(fd);
+  d9:	83 ec 0c             	sub    $0xc,%esp
+  dc:	ff 75 f0             	push   -0x10(%ebp)
+  df:	e8 ca 03 00 00       	call   4ae <close>
+  e4:	83 c4 10             	add    $0x10,%esp
+
+  printf(1, "read\n");
+  e7:	83 ec 08             	sub    $0x8,%esp
+  ea:	68 1d 10 00 00       	push   $0x101d
+  ef:	6a 01                	push   $0x1
+  f1:	e8 34 05 00 00       	call   62a <printf>
+  f6:	83 c4 10             	add    $0x10,%esp
+
+  fd = open(path, O_RDONLY);
+  f9:	83 ec 08             	sub    $0x8,%esp
+  fc:	6a 00                	push   $0x0
+  fe:	8d 45 e6             	lea    -0x1a(%ebp),%eax
+ 101:	50                   	push   %eax
+ 102:	e8 bf 03 00 00       	call   4c6 <open>
+ 107:	83 c4 10             	add    $0x10,%esp
+ 10a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for (i = 0; i < 20; i++)
+ 10d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 114:	eb 1e                	jmp    134 <main+0x134>
+    read(fd, data, sizeof(data));
+ 116:	83 ec 04             	sub    $0x4,%esp
+ 119:	68 00 02 00 00       	push   $0x200
+ 11e:	8d 85 e6 fd ff ff    	lea    -0x21a(%ebp),%eax
+ 124:	50                   	push   %eax
+ 125:	ff 75 f0             	push   -0x10(%ebp)
+ 128:	e8 71 03 00 00       	call   49e <read>
+ 12d:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < 20; i++)
+ 130:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 134:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+ 138:	7e dc                	jle    116 <main+0x116>
+  close(fd);
+ 13a:	83 ec 0c             	sub    $0xc,%esp
+ 13d:	ff 75 f0             	push   -0x10(%ebp)
+ 140:	e8 69 03 00 00       	call   4ae <close>
+ 145:	83 c4 10             	add    $0x10,%esp
+
+  wait();
+ 148:	e8 41 03 00 00       	call   48e <wait>
+
+  exit();
+ 14d:	e8 34 03 00 00       	call   486 <exit>
+
+00000152 <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 152:	55                   	push   %ebp
+ 153:	89 e5                	mov    %esp,%ebp
+ 155:	57                   	push   %edi
+ 156:	53                   	push   %ebx
+    if(cc < 1)
+ 157:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 15a:	8b 55 10             	mov    0x10(%ebp),%edx
+ 15d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 160:	89 cb                	mov    %ecx,%ebx
+ 162:	89 df                	mov    %ebx,%edi
+ 164:	89 d1                	mov    %edx,%ecx
+ 166:	fc                   	cld
+ 167:	f3 aa                	rep stos %al,%es:(%edi)
+ 169:	89 ca                	mov    %ecx,%edx
+ 16b:	89 fb                	mov    %edi,%ebx
+ 16d:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 170:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+ 173:	90                   	nop
+ 174:	5b                   	pop    %ebx
+ 175:	5f                   	pop    %edi
+ 176:	5d                   	pop    %ebp
+ 177:	c3                   	ret
+
+00000178 <strcpy>:
+{
+ 178:	55                   	push   %ebp
+ 179:	89 e5                	mov    %esp,%ebp
+ 17b:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 17e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 181:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 184:	90                   	nop
+ 185:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 188:	8d 42 01             	lea    0x1(%edx),%eax
+ 18b:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 18e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 191:	8d 48 01             	lea    0x1(%eax),%ecx
+ 194:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 197:	0f b6 12             	movzbl (%edx),%edx
+ 19a:	88 10                	mov    %dl,(%eax)
+ 19c:	0f b6 00             	movzbl (%eax),%eax
+ 19f:	84 c0                	test   %al,%al
+ 1a1:	75 e2                	jne    185 <strcpy+0xd>
+  return os;
+ 1a3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1a6:	c9                   	leave
+ 1a7:	c3                   	ret
+
+000001a8 <strcmp>:
+{
+ 1a8:	55                   	push   %ebp
+ 1a9:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 1ab:	eb 08                	jmp    1b5 <strcmp+0xd>
+    p++, q++;
+ 1ad:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 1b1:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 1b5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b8:	0f b6 00             	movzbl (%eax),%eax
+ 1bb:	84 c0                	test   %al,%al
+ 1bd:	74 10                	je     1cf <strcmp+0x27>
+ 1bf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1c2:	0f b6 10             	movzbl (%eax),%edx
+ 1c5:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1c8:	0f b6 00             	movzbl (%eax),%eax
+ 1cb:	38 c2                	cmp    %al,%dl
+ 1cd:	74 de                	je     1ad <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 1cf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d2:	0f b6 00             	movzbl (%eax),%eax
+ 1d5:	0f b6 d0             	movzbl %al,%edx
+ 1d8:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1db:	0f b6 00             	movzbl (%eax),%eax
+ 1de:	0f b6 c0             	movzbl %al,%eax
+ 1e1:	29 c2                	sub    %eax,%edx
+ 1e3:	89 d0                	mov    %edx,%eax
+}
+ 1e5:	5d                   	pop    %ebp
+ 1e6:	c3                   	ret
+
+000001e7 <strlen>:
+{
+ 1e7:	55                   	push   %ebp
+ 1e8:	89 e5                	mov    %esp,%ebp
+ 1ea:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 1ed:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 1f4:	eb 04                	jmp    1fa <strlen+0x13>
+ 1f6:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 1fa:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 1fd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 200:	01 d0                	add    %edx,%eax
+ 202:	0f b6 00             	movzbl (%eax),%eax
+ 205:	84 c0                	test   %al,%al
+ 207:	75 ed                	jne    1f6 <strlen+0xf>
+  return n;
+ 209:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 20c:	c9                   	leave
+ 20d:	c3                   	ret
+
+0000020e <memset>:
+{
+ 20e:	55                   	push   %ebp
+ 20f:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 211:	8b 45 10             	mov    0x10(%ebp),%eax
+ 214:	50                   	push   %eax
+ 215:	ff 75 0c             	push   0xc(%ebp)
+ 218:	ff 75 08             	push   0x8(%ebp)
+ 21b:	e8 32 ff ff ff       	call   152 <stosb>
+ 220:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 223:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 226:	c9                   	leave
+ 227:	c3                   	ret
+
+00000228 <strchr>:
+{
+ 228:	55                   	push   %ebp
+ 229:	89 e5                	mov    %esp,%ebp
+ 22b:	83 ec 04             	sub    $0x4,%esp
+ 22e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 231:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 234:	eb 14                	jmp    24a <strchr+0x22>
+    if(*s == c)
+ 236:	8b 45 08             	mov    0x8(%ebp),%eax
+ 239:	0f b6 00             	movzbl (%eax),%eax
+ 23c:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 23f:	75 05                	jne    246 <strchr+0x1e>
+      return (char*)s;
+ 241:	8b 45 08             	mov    0x8(%ebp),%eax
+ 244:	eb 13                	jmp    259 <strchr+0x31>
+  for(; *s; s++)
+ 246:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 24a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 24d:	0f b6 00             	movzbl (%eax),%eax
+ 250:	84 c0                	test   %al,%al
+ 252:	75 e2                	jne    236 <strchr+0xe>
+  return 0;
+ 254:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 259:	c9                   	leave
+ 25a:	c3                   	ret
+
+0000025b <gets>:
+{
+ 25b:	55                   	push   %ebp
+ 25c:	89 e5                	mov    %esp,%ebp
+ 25e:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 261:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 268:	eb 42                	jmp    2ac <gets+0x51>
+    cc = read(0, &c, 1);
+ 26a:	83 ec 04             	sub    $0x4,%esp
+ 26d:	6a 01                	push   $0x1
+ 26f:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 272:	50                   	push   %eax
+ 273:	6a 00                	push   $0x0
+ 275:	e8 24 02 00 00       	call   49e <read>
+ 27a:	83 c4 10             	add    $0x10,%esp
+ 27d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 280:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 284:	7e 33                	jle    2b9 <gets+0x5e>
+    buf[i++] = c;
+ 286:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 289:	8d 50 01             	lea    0x1(%eax),%edx
+ 28c:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 28f:	89 c2                	mov    %eax,%edx
+ 291:	8b 45 08             	mov    0x8(%ebp),%eax
+ 294:	01 c2                	add    %eax,%edx
+ 296:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 29a:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 29c:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2a0:	3c 0a                	cmp    $0xa,%al
+ 2a2:	74 16                	je     2ba <gets+0x5f>
+ 2a4:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2a8:	3c 0d                	cmp    $0xd,%al
+ 2aa:	74 0e                	je     2ba <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 2ac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2af:	83 c0 01             	add    $0x1,%eax
+ 2b2:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 2b5:	7f b3                	jg     26a <gets+0xf>
+ 2b7:	eb 01                	jmp    2ba <gets+0x5f>
+      break;
+ 2b9:	90                   	nop
+  }
+  buf[i] = '\0';
+ 2ba:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 2bd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c0:	01 d0                	add    %edx,%eax
+ 2c2:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 2c5:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2c8:	c9                   	leave
+ 2c9:	c3                   	ret
+
+000002ca <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 2ca:	55                   	push   %ebp
+ 2cb:	89 e5                	mov    %esp,%ebp
+ 2cd:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2d0:	83 ec 08             	sub    $0x8,%esp
+ 2d3:	6a 00                	push   $0x0
+ 2d5:	ff 75 08             	push   0x8(%ebp)
+ 2d8:	e8 e9 01 00 00       	call   4c6 <open>
+ 2dd:	83 c4 10             	add    $0x10,%esp
+ 2e0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 2e3:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 2e7:	79 07                	jns    2f0 <stat+0x26>
+    return -1;
+ 2e9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 2ee:	eb 25                	jmp    315 <stat+0x4b>
+  r = fstat(fd, st);
+ 2f0:	83 ec 08             	sub    $0x8,%esp
+ 2f3:	ff 75 0c             	push   0xc(%ebp)
+ 2f6:	ff 75 f4             	push   -0xc(%ebp)
+ 2f9:	e8 e0 01 00 00       	call   4de <fstat>
+ 2fe:	83 c4 10             	add    $0x10,%esp
+ 301:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 304:	83 ec 0c             	sub    $0xc,%esp
+ 307:	ff 75 f4             	push   -0xc(%ebp)
+ 30a:	e8 9f 01 00 00       	call   4ae <close>
+ 30f:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 312:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 315:	c9                   	leave
+ 316:	c3                   	ret
+
+00000317 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 317:	55                   	push   %ebp
+ 318:	89 e5                	mov    %esp,%ebp
+ 31a:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 31d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 324:	eb 25                	jmp    34b <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 326:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 329:	89 d0                	mov    %edx,%eax
+ 32b:	c1 e0 02             	shl    $0x2,%eax
+ 32e:	01 d0                	add    %edx,%eax
+ 330:	01 c0                	add    %eax,%eax
+ 332:	89 c1                	mov    %eax,%ecx
+ 334:	8b 45 08             	mov    0x8(%ebp),%eax
+ 337:	8d 50 01             	lea    0x1(%eax),%edx
+ 33a:	89 55 08             	mov    %edx,0x8(%ebp)
+ 33d:	0f b6 00             	movzbl (%eax),%eax
+ 340:	0f be c0             	movsbl %al,%eax
+ 343:	01 c8                	add    %ecx,%eax
+ 345:	83 e8 30             	sub    $0x30,%eax
+ 348:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 34b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 34e:	0f b6 00             	movzbl (%eax),%eax
+ 351:	3c 2f                	cmp    $0x2f,%al
+ 353:	7e 0a                	jle    35f <atoi+0x48>
+ 355:	8b 45 08             	mov    0x8(%ebp),%eax
+ 358:	0f b6 00             	movzbl (%eax),%eax
+ 35b:	3c 39                	cmp    $0x39,%al
+ 35d:	7e c7                	jle    326 <atoi+0xf>
+  return n;
+ 35f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 362:	c9                   	leave
+ 363:	c3                   	ret
+
+00000364 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 364:	55                   	push   %ebp
+ 365:	89 e5                	mov    %esp,%ebp
+ 367:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+
+  dst = vdst;
+ 36a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 36d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 370:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 373:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 376:	eb 17                	jmp    38f <memmove+0x2b>
+    *dst++ = *src++;
+ 378:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 37b:	8d 42 01             	lea    0x1(%edx),%eax
+ 37e:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 381:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 384:	8d 48 01             	lea    0x1(%eax),%ecx
+ 387:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 38a:	0f b6 12             	movzbl (%edx),%edx
+ 38d:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 38f:	8b 45 10             	mov    0x10(%ebp),%eax
+ 392:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 395:	89 55 10             	mov    %edx,0x10(%ebp)
+ 398:	85 c0                	test   %eax,%eax
+ 39a:	7f dc                	jg     378 <memmove+0x14>
+  return vdst;
+ 39c:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 39f:	c9                   	leave
+ 3a0:	c3                   	ret
+
+000003a1 <opendir>:
+    int fd;
+    int child;
+} DIR;
+
+DIR* opendir(const char* name)
+{
+ 3a1:	55                   	push   %ebp
+ 3a2:	89 e5                	mov    %esp,%ebp
+ 3a4:	83 ec 18             	sub    $0x18,%esp
+    DIR* dp = malloc(sizeof(*dp));
+ 3a7:	83 ec 0c             	sub    $0xc,%esp
+ 3aa:	6a 08                	push   $0x8
+ 3ac:	e8 4d 05 00 00       	call   8fe <malloc>
+ 3b1:	83 c4 10             	add    $0x10,%esp
+ 3b4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+    dp->fd = open((char*)name, 0);
+ 3b7:	83 ec 08             	sub    $0x8,%esp
+ 3ba:	6a 00                	push   $0x0
+ 3bc:	ff 75 08             	push   0x8(%ebp)
+ 3bf:	e8 02 01 00 00       	call   4c6 <open>
+ 3c4:	83 c4 10             	add    $0x10,%esp
+ 3c7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 3ca:	89 02                	mov    %eax,(%edx)
+    dp->child = 0;
+ 3cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 3cf:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+
+    return dp;
+ 3d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 3d9:	c9                   	leave
+ 3da:	c3                   	ret
+
+000003db <closedir>:
+
+void closedir(DIR* dp)
+{
+ 3db:	55                   	push   %ebp
+ 3dc:	89 e5                	mov    %esp,%ebp
+ 3de:	83 ec 08             	sub    $0x8,%esp
+    if(dp == 0) {
+ 3e1:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 3e5:	74 21                	je     408 <closedir+0x2d>
+        return;
+    }
+
+    close(dp->fd);
+ 3e7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3ea:	8b 00                	mov    (%eax),%eax
+ 3ec:	83 ec 0c             	sub    $0xc,%esp
+ 3ef:	50                   	push   %eax
+ 3f0:	e8 b9 00 00 00       	call   4ae <close>
+ 3f5:	83 c4 10             	add    $0x10,%esp
+    free(dp);
+ 3f8:	83 ec 0c             	sub    $0xc,%esp
+ 3fb:	ff 75 08             	push   0x8(%ebp)
+ 3fe:	e8 b9 03 00 00       	call   7bc <free>
+ 403:	83 c4 10             	add    $0x10,%esp
+ 406:	eb 01                	jmp    409 <closedir+0x2e>
+        return;
+ 408:	90                   	nop
+}
+ 409:	c9                   	leave
+ 40a:	c3                   	ret
+
+0000040b <readdir>:
+
+struct dirent* readdir(DIR* dp)
+{
+ 40b:	55                   	push   %ebp
+ 40c:	89 e5                	mov    %esp,%ebp
+ 40e:	83 ec 18             	sub    $0x18,%esp
+    if(dp == 0) {
+ 411:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 415:	75 07                	jne    41e <readdir+0x13>
+      return 0;
+ 417:	b8 00 00 00 00       	mov    $0x0,%eax
+ 41c:	eb 5e                	jmp    47c <readdir+0x71>
+    }
+
+    struct dirent* de = malloc(sizeof(*de));
+ 41e:	83 ec 0c             	sub    $0xc,%esp
+ 421:	68 0c 01 00 00       	push   $0x10c
+ 426:	e8 d3 04 00 00       	call   8fe <malloc>
+ 42b:	83 c4 10             	add    $0x10,%esp
+ 42e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    int res = direntry(dp->fd, dp->child, de);
+ 431:	8b 45 08             	mov    0x8(%ebp),%eax
+ 434:	8b 50 04             	mov    0x4(%eax),%edx
+ 437:	8b 45 08             	mov    0x8(%ebp),%eax
+ 43a:	8b 00                	mov    (%eax),%eax
+ 43c:	83 ec 04             	sub    $0x4,%esp
+ 43f:	ff 75 f4             	push   -0xc(%ebp)
+ 442:	52                   	push   %edx
+ 443:	50                   	push   %eax
+ 444:	e8 e5 00 00 00       	call   52e <direntry>
+ 449:	83 c4 10             	add    $0x10,%esp
+ 44c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+
+    // out of children or other error
+    if(res == -1) {
+ 44f:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+ 453:	75 15                	jne    46a <readdir+0x5f>
+        free(de);
+ 455:	83 ec 0c             	sub    $0xc,%esp
+ 458:	ff 75 f4             	push   -0xc(%ebp)
+ 45b:	e8 5c 03 00 00       	call   7bc <free>
+ 460:	83 c4 10             	add    $0x10,%esp
+        return 0;
+ 463:	b8 00 00 00 00       	mov    $0x0,%eax
+ 468:	eb 12                	jmp    47c <readdir+0x71>
+    }
+
+    dp->child++;
+ 46a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 46d:	8b 40 04             	mov    0x4(%eax),%eax
+ 470:	8d 50 01             	lea    0x1(%eax),%edx
+ 473:	8b 45 08             	mov    0x8(%ebp),%eax
+ 476:	89 50 04             	mov    %edx,0x4(%eax)
+    return de;
+ 479:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 47c:	c9                   	leave
+ 47d:	c3                   	ret
+
+0000047e <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 47e:	b8 01 00 00 00       	mov    $0x1,%eax
+ 483:	cd 40                	int    $0x40
+ 485:	c3                   	ret
+
+00000486 <exit>:
+SYSCALL(exit)
+ 486:	b8 02 00 00 00       	mov    $0x2,%eax
+ 48b:	cd 40                	int    $0x40
+ 48d:	c3                   	ret
+
+0000048e <wait>:
+SYSCALL(wait)
+ 48e:	b8 03 00 00 00       	mov    $0x3,%eax
+ 493:	cd 40                	int    $0x40
+ 495:	c3                   	ret
+
+00000496 <pipe>:
+SYSCALL(pipe)
+ 496:	b8 04 00 00 00       	mov    $0x4,%eax
+ 49b:	cd 40                	int    $0x40
+ 49d:	c3                   	ret
+
+0000049e <read>:
+SYSCALL(read)
+ 49e:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4a3:	cd 40                	int    $0x40
+ 4a5:	c3                   	ret
+
+000004a6 <write>:
+SYSCALL(write)
+ 4a6:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4ab:	cd 40                	int    $0x40
+ 4ad:	c3                   	ret
+
+000004ae <close>:
+SYSCALL(close)
+ 4ae:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4b3:	cd 40                	int    $0x40
+ 4b5:	c3                   	ret
+
+000004b6 <kill>:
+SYSCALL(kill)
+ 4b6:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4bb:	cd 40                	int    $0x40
+ 4bd:	c3                   	ret
+
+000004be <exec>:
+SYSCALL(exec)
+ 4be:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4c3:	cd 40                	int    $0x40
+ 4c5:	c3                   	ret
+
+000004c6 <open>:
+SYSCALL(open)
+ 4c6:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4cb:	cd 40                	int    $0x40
+ 4cd:	c3                   	ret
+
+000004ce <mknod>:
+SYSCALL(mknod)
+ 4ce:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4d3:	cd 40                	int    $0x40
+ 4d5:	c3                   	ret
+
+000004d6 <unlink>:
+SYSCALL(unlink)
+ 4d6:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4db:	cd 40                	int    $0x40
+ 4dd:	c3                   	ret
+
+000004de <fstat>:
+SYSCALL(fstat)
+ 4de:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4e3:	cd 40                	int    $0x40
+ 4e5:	c3                   	ret
+
+000004e6 <link>:
+SYSCALL(link)
+ 4e6:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4eb:	cd 40                	int    $0x40
+ 4ed:	c3                   	ret
+
+000004ee <mkdir>:
+SYSCALL(mkdir)
+ 4ee:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4f3:	cd 40                	int    $0x40
+ 4f5:	c3                   	ret
+
+000004f6 <chdir>:
+SYSCALL(chdir)
+ 4f6:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4fb:	cd 40                	int    $0x40
+ 4fd:	c3                   	ret
+
+000004fe <dup>:
+SYSCALL(dup)
+ 4fe:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 503:	cd 40                	int    $0x40
+ 505:	c3                   	ret
+
+00000506 <getpid>:
+SYSCALL(getpid)
+ 506:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 50b:	cd 40                	int    $0x40
+ 50d:	c3                   	ret
+
+0000050e <sbrk>:
+SYSCALL(sbrk)
+ 50e:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 513:	cd 40                	int    $0x40
+ 515:	c3                   	ret
+
+00000516 <sleep>:
+SYSCALL(sleep)
+ 516:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 51b:	cd 40                	int    $0x40
+ 51d:	c3                   	ret
+
+0000051e <uptime>:
+SYSCALL(uptime)
+ 51e:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 523:	cd 40                	int    $0x40
+ 525:	c3                   	ret
+
+00000526 <mount>:
+SYSCALL(mount)
+ 526:	b8 16 00 00 00       	mov    $0x16,%eax
+ 52b:	cd 40                	int    $0x40
+ 52d:	c3                   	ret
+
+0000052e <direntry>:
+SYSCALL(direntry)
+ 52e:	b8 17 00 00 00       	mov    $0x17,%eax
+ 533:	cd 40                	int    $0x40
+ 535:	c3                   	ret
+
+00000536 <sync>:
+SYSCALL(sync)
+ 536:	b8 18 00 00 00       	mov    $0x18,%eax
+ 53b:	cd 40                	int    $0x40
+ 53d:	c3                   	ret
+
+0000053e <fsync>:
+SYSCALL(fsync)
+ 53e:	b8 19 00 00 00       	mov    $0x19,%eax
+ 543:	cd 40                	int    $0x40
+ 545:	c3                   	ret
+
+00000546 <mmap>:
+SYSCALL(mmap)
+ 546:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 54b:	cd 40                	int    $0x40
+ 54d:	c3                   	ret
+
+0000054e <munmap>:
+SYSCALL(munmap)
+ 54e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 553:	cd 40                	int    $0x40
+ 555:	c3                   	ret
+
+00000556 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 556:	55                   	push   %ebp
+ 557:	89 e5                	mov    %esp,%ebp
+ 559:	83 ec 18             	sub    $0x18,%esp
+ 55c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 55f:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 562:	83 ec 04             	sub    $0x4,%esp
+ 565:	6a 01                	push   $0x1
+ 567:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 56a:	50                   	push   %eax
+ 56b:	ff 75 08             	push   0x8(%ebp)
+ 56e:	e8 33 ff ff ff       	call   4a6 <write>
+ 573:	83 c4 10             	add    $0x10,%esp
+}
+ 576:	90                   	nop
+ 577:	c9                   	leave
+ 578:	c3                   	ret
+
+00000579 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 579:	55                   	push   %ebp
+ 57a:	89 e5                	mov    %esp,%ebp
+ 57c:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 57f:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 586:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 58a:	74 17                	je     5a3 <printint+0x2a>
+ 58c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 590:	79 11                	jns    5a3 <printint+0x2a>
+    neg = 1;
+ 592:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 599:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 59c:	f7 d8                	neg    %eax
+ 59e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 5a1:	eb 06                	jmp    5a9 <printint+0x30>
+  } else {
+    x = xx;
+ 5a3:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5a6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 5a9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 5b0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 5b3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 5b6:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5bb:	f7 f1                	div    %ecx
+ 5bd:	89 d1                	mov    %edx,%ecx
+ 5bf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5c2:	8d 50 01             	lea    0x1(%eax),%edx
+ 5c5:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 5c8:	0f b6 91 00 20 00 00 	movzbl 0x2000(%ecx),%edx
+ 5cf:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 5d3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 5d6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 5d9:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5de:	f7 f1                	div    %ecx
+ 5e0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 5e3:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 5e7:	75 c7                	jne    5b0 <printint+0x37>
+  if(neg)
+ 5e9:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 5ed:	74 2d                	je     61c <printint+0xa3>
+    buf[i++] = '-';
+ 5ef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5f2:	8d 50 01             	lea    0x1(%eax),%edx
+ 5f5:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 5f8:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 5fd:	eb 1d                	jmp    61c <printint+0xa3>
+    putc(fd, buf[i]);
+ 5ff:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 602:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 605:	01 d0                	add    %edx,%eax
+ 607:	0f b6 00             	movzbl (%eax),%eax
+ 60a:	0f be c0             	movsbl %al,%eax
+ 60d:	83 ec 08             	sub    $0x8,%esp
+ 610:	50                   	push   %eax
+ 611:	ff 75 08             	push   0x8(%ebp)
+ 614:	e8 3d ff ff ff       	call   556 <putc>
+ 619:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 61c:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 620:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 624:	79 d9                	jns    5ff <printint+0x86>
+}
+ 626:	90                   	nop
+ 627:	90                   	nop
+ 628:	c9                   	leave
+ 629:	c3                   	ret
+
+0000062a <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 62a:	55                   	push   %ebp
+ 62b:	89 e5                	mov    %esp,%ebp
+ 62d:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 630:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 637:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 63a:	83 c0 04             	add    $0x4,%eax
+ 63d:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 640:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 647:	e9 59 01 00 00       	jmp    7a5 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 64c:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 64f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 652:	01 d0                	add    %edx,%eax
+ 654:	0f b6 00             	movzbl (%eax),%eax
+ 657:	0f be c0             	movsbl %al,%eax
+ 65a:	25 ff 00 00 00       	and    $0xff,%eax
+ 65f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 662:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 666:	75 2c                	jne    694 <printf+0x6a>
+      if(c == '%'){
+ 668:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 66c:	75 0c                	jne    67a <printf+0x50>
+        state = '%';
+ 66e:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 675:	e9 27 01 00 00       	jmp    7a1 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 67a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 67d:	0f be c0             	movsbl %al,%eax
+ 680:	83 ec 08             	sub    $0x8,%esp
+ 683:	50                   	push   %eax
+ 684:	ff 75 08             	push   0x8(%ebp)
+ 687:	e8 ca fe ff ff       	call   556 <putc>
+ 68c:	83 c4 10             	add    $0x10,%esp
+ 68f:	e9 0d 01 00 00       	jmp    7a1 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 694:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 698:	0f 85 03 01 00 00    	jne    7a1 <printf+0x177>
+      if(c == 'd'){
+ 69e:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 6a2:	75 1e                	jne    6c2 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 6a4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6a7:	8b 00                	mov    (%eax),%eax
+ 6a9:	6a 01                	push   $0x1
+ 6ab:	6a 0a                	push   $0xa
+ 6ad:	50                   	push   %eax
+ 6ae:	ff 75 08             	push   0x8(%ebp)
+ 6b1:	e8 c3 fe ff ff       	call   579 <printint>
+ 6b6:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 6b9:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 6bd:	e9 d8 00 00 00       	jmp    79a <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 6c2:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 6c6:	74 06                	je     6ce <printf+0xa4>
+ 6c8:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 6cc:	75 1e                	jne    6ec <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 6ce:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6d1:	8b 00                	mov    (%eax),%eax
+ 6d3:	6a 00                	push   $0x0
+ 6d5:	6a 10                	push   $0x10
+ 6d7:	50                   	push   %eax
+ 6d8:	ff 75 08             	push   0x8(%ebp)
+ 6db:	e8 99 fe ff ff       	call   579 <printint>
+ 6e0:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 6e3:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 6e7:	e9 ae 00 00 00       	jmp    79a <printf+0x170>
+      } else if(c == 's'){
+ 6ec:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 6f0:	75 43                	jne    735 <printf+0x10b>
+        s = (char*)*ap;
+ 6f2:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6f5:	8b 00                	mov    (%eax),%eax
+ 6f7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 6fa:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 6fe:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 702:	75 25                	jne    729 <printf+0xff>
+          s = "(null)";
+ 704:	c7 45 f4 23 10 00 00 	movl   $0x1023,-0xc(%ebp)
+        while(*s != 0){
+ 70b:	eb 1c                	jmp    729 <printf+0xff>
+          putc(fd, *s);
+ 70d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 710:	0f b6 00             	movzbl (%eax),%eax
+ 713:	0f be c0             	movsbl %al,%eax
+ 716:	83 ec 08             	sub    $0x8,%esp
+ 719:	50                   	push   %eax
+ 71a:	ff 75 08             	push   0x8(%ebp)
+ 71d:	e8 34 fe ff ff       	call   556 <putc>
+ 722:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 725:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 729:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 72c:	0f b6 00             	movzbl (%eax),%eax
+ 72f:	84 c0                	test   %al,%al
+ 731:	75 da                	jne    70d <printf+0xe3>
+ 733:	eb 65                	jmp    79a <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 735:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 739:	75 1d                	jne    758 <printf+0x12e>
+        putc(fd, *ap);
+ 73b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 73e:	8b 00                	mov    (%eax),%eax
+ 740:	0f be c0             	movsbl %al,%eax
+ 743:	83 ec 08             	sub    $0x8,%esp
+ 746:	50                   	push   %eax
+ 747:	ff 75 08             	push   0x8(%ebp)
+ 74a:	e8 07 fe ff ff       	call   556 <putc>
+ 74f:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 752:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 756:	eb 42                	jmp    79a <printf+0x170>
+      } else if(c == '%'){
+ 758:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 75c:	75 17                	jne    775 <printf+0x14b>
+        putc(fd, c);
+ 75e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 761:	0f be c0             	movsbl %al,%eax
+ 764:	83 ec 08             	sub    $0x8,%esp
+ 767:	50                   	push   %eax
+ 768:	ff 75 08             	push   0x8(%ebp)
+ 76b:	e8 e6 fd ff ff       	call   556 <putc>
+ 770:	83 c4 10             	add    $0x10,%esp
+ 773:	eb 25                	jmp    79a <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 775:	83 ec 08             	sub    $0x8,%esp
+ 778:	6a 25                	push   $0x25
+ 77a:	ff 75 08             	push   0x8(%ebp)
+ 77d:	e8 d4 fd ff ff       	call   556 <putc>
+ 782:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 785:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 788:	0f be c0             	movsbl %al,%eax
+ 78b:	83 ec 08             	sub    $0x8,%esp
+ 78e:	50                   	push   %eax
+ 78f:	ff 75 08             	push   0x8(%ebp)
+ 792:	e8 bf fd ff ff       	call   556 <putc>
+ 797:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 79a:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 7a1:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 7a5:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 7a8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7ab:	01 d0                	add    %edx,%eax
+ 7ad:	0f b6 00             	movzbl (%eax),%eax
+ 7b0:	84 c0                	test   %al,%al
+ 7b2:	0f 85 94 fe ff ff    	jne    64c <printf+0x22>
+    }
+  }
+}
+ 7b8:	90                   	nop
+ 7b9:	90                   	nop
+ 7ba:	c9                   	leave
+ 7bb:	c3                   	ret
+
+000007bc <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 7bc:	55                   	push   %ebp
+ 7bd:	89 e5                	mov    %esp,%ebp
+ 7bf:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 7c2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7c5:	83 e8 08             	sub    $0x8,%eax
+ 7c8:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7cb:	a1 1c 20 00 00       	mov    0x201c,%eax
+ 7d0:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 7d3:	eb 24                	jmp    7f9 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7d5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7d8:	8b 00                	mov    (%eax),%eax
+ 7da:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 7dd:	72 12                	jb     7f1 <free+0x35>
+ 7df:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7e2:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 7e5:	72 24                	jb     80b <free+0x4f>
+ 7e7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7ea:	8b 00                	mov    (%eax),%eax
+ 7ec:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 7ef:	72 1a                	jb     80b <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7f1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7f4:	8b 00                	mov    (%eax),%eax
+ 7f6:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 7f9:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7fc:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 7ff:	73 d4                	jae    7d5 <free+0x19>
+ 801:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 804:	8b 00                	mov    (%eax),%eax
+ 806:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 809:	73 ca                	jae    7d5 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 80b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 80e:	8b 40 04             	mov    0x4(%eax),%eax
+ 811:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 818:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 81b:	01 c2                	add    %eax,%edx
+ 81d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 820:	8b 00                	mov    (%eax),%eax
+ 822:	39 c2                	cmp    %eax,%edx
+ 824:	75 24                	jne    84a <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 826:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 829:	8b 50 04             	mov    0x4(%eax),%edx
+ 82c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 82f:	8b 00                	mov    (%eax),%eax
+ 831:	8b 40 04             	mov    0x4(%eax),%eax
+ 834:	01 c2                	add    %eax,%edx
+ 836:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 839:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 83c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 83f:	8b 00                	mov    (%eax),%eax
+ 841:	8b 10                	mov    (%eax),%edx
+ 843:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 846:	89 10                	mov    %edx,(%eax)
+ 848:	eb 0a                	jmp    854 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 84a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 84d:	8b 10                	mov    (%eax),%edx
+ 84f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 852:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 854:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 857:	8b 40 04             	mov    0x4(%eax),%eax
+ 85a:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 861:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 864:	01 d0                	add    %edx,%eax
+ 866:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 869:	75 20                	jne    88b <free+0xcf>
+    p->s.size += bp->s.size;
+ 86b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 86e:	8b 50 04             	mov    0x4(%eax),%edx
+ 871:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 874:	8b 40 04             	mov    0x4(%eax),%eax
+ 877:	01 c2                	add    %eax,%edx
+ 879:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 87c:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 87f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 882:	8b 10                	mov    (%eax),%edx
+ 884:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 887:	89 10                	mov    %edx,(%eax)
+ 889:	eb 08                	jmp    893 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 88b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 88e:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 891:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 893:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 896:	a3 1c 20 00 00       	mov    %eax,0x201c
+}
+ 89b:	90                   	nop
+ 89c:	c9                   	leave
+ 89d:	c3                   	ret
+
+0000089e <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 89e:	55                   	push   %ebp
+ 89f:	89 e5                	mov    %esp,%ebp
+ 8a1:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 8a4:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 8ab:	77 07                	ja     8b4 <morecore+0x16>
+    nu = 4096;
+ 8ad:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 8b4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8b7:	c1 e0 03             	shl    $0x3,%eax
+ 8ba:	83 ec 0c             	sub    $0xc,%esp
+ 8bd:	50                   	push   %eax
+ 8be:	e8 4b fc ff ff       	call   50e <sbrk>
+ 8c3:	83 c4 10             	add    $0x10,%esp
+ 8c6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 8c9:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 8cd:	75 07                	jne    8d6 <morecore+0x38>
+    return 0;
+ 8cf:	b8 00 00 00 00       	mov    $0x0,%eax
+ 8d4:	eb 26                	jmp    8fc <morecore+0x5e>
+  hp = (Header*)p;
+ 8d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8d9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 8dc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8df:	8b 55 08             	mov    0x8(%ebp),%edx
+ 8e2:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 8e5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8e8:	83 c0 08             	add    $0x8,%eax
+ 8eb:	83 ec 0c             	sub    $0xc,%esp
+ 8ee:	50                   	push   %eax
+ 8ef:	e8 c8 fe ff ff       	call   7bc <free>
+ 8f4:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 8f7:	a1 1c 20 00 00       	mov    0x201c,%eax
+}
+ 8fc:	c9                   	leave
+ 8fd:	c3                   	ret
+
+000008fe <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 8fe:	55                   	push   %ebp
+ 8ff:	89 e5                	mov    %esp,%ebp
+ 901:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 904:	8b 45 08             	mov    0x8(%ebp),%eax
+ 907:	83 c0 07             	add    $0x7,%eax
+ 90a:	c1 e8 03             	shr    $0x3,%eax
+ 90d:	83 c0 01             	add    $0x1,%eax
+ 910:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 913:	a1 1c 20 00 00       	mov    0x201c,%eax
+ 918:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 91b:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 91f:	75 23                	jne    944 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 921:	c7 45 f0 14 20 00 00 	movl   $0x2014,-0x10(%ebp)
+ 928:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 92b:	a3 1c 20 00 00       	mov    %eax,0x201c
+ 930:	a1 1c 20 00 00       	mov    0x201c,%eax
+ 935:	a3 14 20 00 00       	mov    %eax,0x2014
+    base.s.size = 0;
+ 93a:	c7 05 18 20 00 00 00 	movl   $0x0,0x2018
+ 941:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 944:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 947:	8b 00                	mov    (%eax),%eax
+ 949:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 94c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 94f:	8b 40 04             	mov    0x4(%eax),%eax
+ 952:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 955:	72 4d                	jb     9a4 <malloc+0xa6>
+      if(p->s.size == nunits)
+ 957:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 95a:	8b 40 04             	mov    0x4(%eax),%eax
+ 95d:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 960:	75 0c                	jne    96e <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 962:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 965:	8b 10                	mov    (%eax),%edx
+ 967:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 96a:	89 10                	mov    %edx,(%eax)
+ 96c:	eb 26                	jmp    994 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 96e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 971:	8b 40 04             	mov    0x4(%eax),%eax
+ 974:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 977:	89 c2                	mov    %eax,%edx
+ 979:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 97c:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 97f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 982:	8b 40 04             	mov    0x4(%eax),%eax
+ 985:	c1 e0 03             	shl    $0x3,%eax
+ 988:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 98b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 98e:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 991:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 994:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 997:	a3 1c 20 00 00       	mov    %eax,0x201c
+      return (void*)(p + 1);
+ 99c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 99f:	83 c0 08             	add    $0x8,%eax
+ 9a2:	eb 3b                	jmp    9df <malloc+0xe1>
+    }
+    if(p == freep)
+ 9a4:	a1 1c 20 00 00       	mov    0x201c,%eax
+ 9a9:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 9ac:	75 1e                	jne    9cc <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 9ae:	83 ec 0c             	sub    $0xc,%esp
+ 9b1:	ff 75 ec             	push   -0x14(%ebp)
+ 9b4:	e8 e5 fe ff ff       	call   89e <morecore>
+ 9b9:	83 c4 10             	add    $0x10,%esp
+ 9bc:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 9bf:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 9c3:	75 07                	jne    9cc <malloc+0xce>
+        return 0;
+ 9c5:	b8 00 00 00 00       	mov    $0x0,%eax
+ 9ca:	eb 13                	jmp    9df <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9cf:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 9d2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9d5:	8b 00                	mov    (%eax),%eax
+ 9d7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 9da:	e9 6d ff ff ff       	jmp    94c <malloc+0x4e>
+  }
+}
+ 9df:	c9                   	leave
+ 9e0:	c3                   	ret
@@ -19,7 +19,7 @@ fetchint(uint addr, int *ip)
 {
   struct proc *curproc = myproc();
 
-  if(addr >= curproc->sz || addr+4 > curproc->sz)
+  if(uvmcheck(curproc, addr, 4, 0) < 0)
     return -1;
   *ip = *(int*)(addr);
   return 0;
@@ -33,12 +33,20 @@ fetchstr(uint addr, char **pp)
 {
   char *s, *ep;
   struct proc *curproc = myproc();
+  struct vma *v;
 
-  if(addr >= curproc->sz)
+  if(addr < curproc->sz)
+    ep = (char*)curproc->sz;
+  else if((v = vmalookup(curproc, addr)) != 0)
+    ep = (char*)v->end;
+  else
     return -1;
   *pp = (char*)addr;
-  ep = (char*)curproc->sz;
   for(s = *pp; s < ep; s++){
+    // fault in each page of the string before looking at it
+    if((s == *pp || (uint)s % PGSIZE == 0) &&
+       uvmcheck(curproc, (uint)s, 1, 0) < 0)
+      return -1;
     if(*s == 0)
       return s - *pp;
   }
@@ -63,7 +71,22 @@ argptr(int n, char **pp, int size)
  
   if(argint(n, &i) < 0)
     return -1;
-  if(size < 0 || (uint)i >= curproc->sz || (uint)i+size > curproc->sz)
+  if(size < 0 || uvmcheck(curproc, (uint)i, size, 0) < 0)
+    return -1;
+  *pp = (char*)i;
+  return 0;
+}
+
+// Same as argptr, for memory the kernel is going to write to.
+int
+argwptr(int n, char **pp, int size)
+{
+  int i;
+  struct proc *curproc = myproc();
+
+  if(argint(n, &i) < 0)
+    return -1;
+  if(size < 0 || uvmcheck(curproc, (uint)i, size, 1) < 0)
     return -1;
   *pp = (char*)i;
   return 0;
@@ -105,6 +128,10 @@ extern int sys_write(void);
 extern int sys_uptime(void);
 extern int sys_mount(void);
 extern int sys_direntry(void);
+extern int sys_sync(void);
+extern int sys_fsync(void);
+extern int sys_mmap(void);
+extern int sys_munmap(void);
 
 static int (*syscalls[])(void) = {
 [SYS_fork]    sys_fork,
@@ -130,6 +157,10 @@ static int (*syscalls[])(void) = {
 [SYS_close]   sys_close,
 [SYS_mount]   sys_mount,
 [SYS_direntry] sys_direntry,
+[SYS_sync]    sys_sync,
+[SYS_fsync]   sys_fsync,
+[SYS_mmap]    sys_mmap,
+[SYS_munmap]  sys_munmap,
 };
 
 void
@@ -22,3 +22,7 @@
 #define SYS_close  21
 #define SYS_mount  22
 #define SYS_direntry 23
+#define SYS_sync   24
+#define SYS_fsync  25
+#define SYS_mmap   26
+#define SYS_munmap 27
@@ -15,6 +15,7 @@
 #include "file.h"
 #include "fcntl.h"
 #include "vfs.h"
+#include "mman.h"
 
 // Fetch the nth word-sized system call argument as a file descriptor
 // and return both the descriptor and the corresponding struct file.
@@ -73,7 +74,7 @@ sys_read(void)
   int n;
   char *p;
 
-  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argwptr(1, &p, n) < 0)
     return -1;
   return fileread(f, p, n);
 }
@@ -109,7 +110,7 @@ sys_fstat(void)
   struct file *f;
   struct stat *st;
 
-  if(argfd(0, 0, &f) < 0 || argptr(1, (void*)&st, sizeof(*st)) < 0)
+  if(argfd(0, 0, &f) < 0 || argwptr(1, (void*)&st, sizeof(*st)) < 0)
     return -1;
   return filestat(f, st);
 }
@@ -309,12 +310,16 @@ sys_open(void)
   if((f = filealloc()) == 0 || (fd = fdalloc(f)) < 0){
     if(f)
       fileclose(f);
+    vfs_iput(ip);
     return -1;
   }
 
   f->type = FD_INODE;
   f->ip = ip;
   f->off = 0;
+  f->ra_next = 0;
+  f->ra_end = 0;
+  f->ra_win = 0;
   f->readable = !(omode & O_WRONLY);
   f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
   return fd;
@@ -330,6 +335,7 @@ sys_mkdir(void)
     return -1;
   }
 
+  vfs_iput(ip);
   return 0;
 }
 
@@ -347,6 +353,7 @@ sys_mknod(void)
     return -1;
   }
 
+  vfs_iput(ip);
   return 0;
 }
 
@@ -361,6 +368,7 @@ sys_chdir(void)
     return -1;
   }
 
+  vfs_iput(curproc->cwd);
   curproc->cwd = ip;
   return 0;
 }
@@ -398,7 +406,7 @@ sys_pipe(void)
   struct file *rf, *wf;
   int fd0, fd1;
 
-  if(argptr(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
+  if(argwptr(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
     return -1;
   if(pipealloc(&rf, &wf) < 0)
     return -1;
@@ -430,15 +438,8 @@ int sys_mount(void)
   if(argstr(2, &fs_type) < 0)
       return -1;
 
-  // make a defensive copy -- since the vfs holds onto this pointer
-  // so keeping the user pointer is dangerous (and could change on us!)
-  char* equiv = kalloc();
-  int len = strlen(path);
-
-  strncpy(equiv, path, len);
-  equiv[len] = '\0';
-
-  vfs_mount_fs(equiv, src, fs_type);
+  // the vfs copies the mount point into its mount table
+  vfs_mount_fs(path, src, fs_type);
   return 0;
 }
 
@@ -462,7 +463,7 @@ int sys_direntry(void)
     if(argint(1, &child) < 0)
         return -1;
 
-    if(argptr(2, (char**)&de, sizeof(*de)) < 0)
+    if(argwptr(2, (char**)&de, sizeof(*de)) < 0)
         return -1;
 
     struct vfs_inode* vi = vfs_childi(fp->ip, child);
@@ -484,5 +485,69 @@ int sys_direntry(void)
     strncpy(de->name, name, len);
     de->name[len] = '\0';
 
+    vfs_iput(vi);
     return 0;
 }
+
+int sys_sync(void)
+{
+    vfs_sync();
+    return 0;
+}
+
+int sys_fsync(void)
+{
+    struct file* fp;
+
+    if(argfd(0, 0, &fp) < 0)
+        return -1;
+
+    // pipes never reach the disk
+    if(fp->type != FD_INODE)
+        return -1;
+
+    return vfs_fsync(fp->ip);
+}
+
+int sys_mmap(void)
+{
+    struct file* fp;
+    struct stat st;
+    int addr, length, prot, flags, off;
+
+    if(argint(0, &addr) < 0 || argint(1, &length) < 0 || argint(2, &prot) < 0 ||
+       argint(3, &flags) < 0 || argfd(4, 0, &fp) < 0 || argint(5, &off) < 0)
+        return -1;
+
+    // no placement hints; the file offset has to be page aligned
+    if(addr != 0 || length <= 0 || off < 0 || off % PGSIZE != 0)
+        return -1;
+
+    if((prot & ~(PROT_READ | PROT_WRITE)) != 0 || (flags != MAP_SHARED && flags != MAP_PRIVATE))
+        return -1;
+
+    // mapped pages are never written back, so shared mappings are read-only
+    if(flags == MAP_SHARED && (prot & PROT_WRITE))
+        return -1;
+
+    // only regular files can be mapped
+    if(fp->type != FD_INODE || !fp->readable)
+        return -1;
+
+    vfs_stati(fp->ip, &st);
+
+    if(st.type != T_FILE)
+        return -1;
+
+    return vmamap(myproc(), fp->ip, off, length, prot, flags);
+}
+
+int sys_munmap(void)
+{
+    int addr, length;
+
+    if(argint(0, &addr) < 0 || argint(1, &length) < 0 || length <= 0)
+        return -1;
+
+    return vmaunmap(myproc(), addr, length);
+}
@@ -78,6 +78,15 @@ trap(struct trapframe *tf)
     lapiceoi();
     break;
 
+  case T_PGFLT:
+    // a write to a copy-on-write page, or a page of a
+    // memory-mapped file that is not mapped (writably) yet
+    if(myproc() != 0 && rcr2() < KERNBASE &&
+       uvmfault(myproc(), rcr2(), tf->err & FEC_WR) == 0)
+      break;
+    // otherwise, a real fault
+    // fall through
+
   //PAGEBREAK: 13
   default:
     if(myproc() == 0 || (tf->cs&3) == 0){
@@ -32,6 +32,10 @@ int sleep(int);
 int uptime(void);
 int mount(const char* src, const char* target, const char* fs_type);
 int direntry(int fd, int child, struct dirent* de);
+int sync(void);
+int fsync(int fd);
+void* mmap(void* addr, int length, int prot, int flags, int fd, int offset);
+int munmap(void* addr, int length);
 
 // ulib.c
 typedef struct DIR DIR;
@@ -0,0 +1,8482 @@
+
+_usertests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <iputtest>:
+int stdout = 1;
+
+// does chdir() call iput(p->cwd) in a transaction?
+void
+iputtest(void)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 08             	sub    $0x8,%esp
+  printf(stdout, "iput test\n");
+       6:	a1 14 80 00 00       	mov    0x8014,%eax
+       b:	83 ec 08             	sub    $0x8,%esp
+       e:	68 16 50 00 00       	push   $0x5016
+      13:	50                   	push   %eax
+      14:	e8 2c 4a 00 00       	call   4a45 <printf>
+      19:	83 c4 10             	add    $0x10,%esp
+
+  if(mkdir("iputdir") < 0){
+      1c:	83 ec 0c             	sub    $0xc,%esp
+      1f:	68 21 50 00 00       	push   $0x5021
+      24:	e8 e0 48 00 00       	call   4909 <mkdir>
+      29:	83 c4 10             	add    $0x10,%esp
+      2c:	85 c0                	test   %eax,%eax
+      2e:	79 1b                	jns    4b <iputtest+0x4b>
+    printf(stdout, "mkdir failed\n");
+      30:	a1 14 80 00 00       	mov    0x8014,%eax
+      35:	83 ec 08             	sub    $0x8,%esp
+      38:	68 29 50 00 00       	push   $0x5029
+      3d:	50                   	push   %eax
+      3e:	e8 02 4a 00 00       	call   4a45 <printf>
+      43:	83 c4 10             	add    $0x10,%esp
+    exit();
+      46:	e8 56 48 00 00       	call   48a1 <exit>
+  }
+  if(chdir("iputdir") < 0){
+      4b:	83 ec 0c             	sub    $0xc,%esp
+      4e:	68 21 50 00 00       	push   $0x5021
+      53:	e8 b9 48 00 00       	call   4911 <chdir>
+      58:	83 c4 10             	add    $0x10,%esp
+      5b:	85 c0                	test   %eax,%eax
+      5d:	79 1b                	jns    7a <iputtest+0x7a>
+    printf(stdout, "chdir iputdir failed\n");
+      5f:	a1 14 80 00 00       	mov    0x8014,%eax
+      64:	83 ec 08             	sub    $0x8,%esp
+      67:	68 37 50 00 00       	push   $0x5037
+      6c:	50                   	push   %eax
+      6d:	e8 d3 49 00 00       	call   4a45 <printf>
+      72:	83 c4 10             	add    $0x10,%esp
+    exit();
+      75:	e8 27 48 00 00       	call   48a1 <exit>
+  }
+  if(unlink("../iputdir") < 0){
+      7a:	83 ec 0c             	sub    $0xc,%esp
+      7d:	68 4d 50 00 00       	push   $0x504d
+      82:	e8 6a 48 00 00       	call   48f1 <unlink>
+      87:	83 c4 10             	add    $0x10,%esp
+      8a:	85 c0                	test   %eax,%eax
+      8c:	79 1b                	jns    a9 <iputtest+0xa9>
+    printf(stdout, "unlink ../iputdir failed\n");
+      8e:	a1 14 80 00 00       	mov    0x8014,%eax
+      93:	83 ec 08             	sub    $0x8,%esp
+      96:	68 58 50 00 00       	push   $0x5058
+      9b:	50                   	push   %eax
+      9c:	e8 a4 49 00 00       	call   4a45 <printf>
+      a1:	83 c4 10             	add    $0x10,%esp
+    exit();
+      a4:	e8 f8 47 00 00       	call   48a1 <exit>
+  }
+  if(chdir("/") < 0){
+      a9:	83 ec 0c             	sub    $0xc,%esp
+      ac:	68 72 50 00 00       	push   $0x5072
+      b1:	e8 5b 48 00 00       	call   4911 <chdir>
+      b6:	83 c4 10             	add    $0x10,%esp
+      b9:	85 c0                	test   %eax,%eax
+      bb:	79 1b                	jns    d8 <iputtest+0xd8>
+    printf(stdout, "chdir / failed\n");
+      bd:	a1 14 80 00 00       	mov    0x8014,%eax
+      c2:	83 ec 08             	sub    $0x8,%esp
+      c5:	68 74 50 00 00       	push   $0x5074
+      ca:	50                   	push   %eax
+      cb:	e8 75 49 00 00       	call   4a45 <printf>
+      d0:	83 c4 10             	add    $0x10,%esp
+    exit();
+      d3:	e8 c9 47 00 00       	call   48a1 <exit>
+  }
+  printf(stdout, "iput test ok\n");
+      d8:	a1 14 80 00 00       	mov    0x8014,%eax
+      dd:	83 ec 08             	sub    $0x8,%esp
+      e0:	68 84 50 00 00       	push   $0x5084
+      e5:	50                   	push   %eax
+      e6:	e8 5a 49 00 00       	call   4a45 <printf>
+      eb:	83 c4 10             	add    $0x10,%esp
+}
+      ee:	90                   	nop
+      ef:	c9                   	leave
+      f0:	c3                   	ret
+
+000000f1 <exitiputtest>:
+
+// does exit() call iput(p->cwd) in a transaction?
+void
+exitiputtest(void)
+{
+      f1:	55                   	push   %ebp
+      f2:	89 e5                	mov    %esp,%ebp
+      f4:	83 ec 18             	sub    $0x18,%esp
+  int pid;
+
+  printf(stdout, "exitiput test\n");
+      f7:	a1 14 80 00 00       	mov    0x8014,%eax
+      fc:	83 ec 08             	sub    $0x8,%esp
+      ff:	68 92 50 00 00       	push   $0x5092
+     104:	50                   	push   %eax
+     105:	e8 3b 49 00 00       	call   4a45 <printf>
+     10a:	83 c4 10             	add    $0x10,%esp
+
+  pid = fork();
+     10d:	e8 87 47 00 00       	call   4899 <fork>
+     112:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(pid < 0){
+     115:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     119:	79 1b                	jns    136 <exitiputtest+0x45>
+    printf(stdout, "fork failed\n");
+     11b:	a1 14 80 00 00       	mov    0x8014,%eax
+     120:	83 ec 08             	sub    $0x8,%esp
+     123:	68 a1 50 00 00       	push   $0x50a1
+     128:	50                   	push   %eax
+     129:	e8 17 49 00 00       	call   4a45 <printf>
+     12e:	83 c4 10             	add    $0x10,%esp
+    exit();
+     131:	e8 6b 47 00 00       	call   48a1 <exit>
+  }
+  if(pid == 0){
+     136:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     13a:	0f 85 92 00 00 00    	jne    1d2 <exitiputtest+0xe1>
+    if(mkdir("iputdir") < 0){
+     140:	83 ec 0c             	sub    $0xc,%esp
+     143:	68 21 50 00 00       	push   $0x5021
+     148:	e8 bc 47 00 00       	call   4909 <mkdir>
+     14d:	83 c4 10             	add    $0x10,%esp
+     150:	85 c0                	test   %eax,%eax
+     152:	79 1b                	jns    16f <exitiputtest+0x7e>
+      printf(stdout, "mkdir failed\n");
+     154:	a1 14 80 00 00       	mov    0x8014,%eax
+     159:	83 ec 08             	sub    $0x8,%esp
+     15c:	68 29 50 00 00       	push   $0x5029
+     161:	50                   	push   %eax
+     162:	e8 de 48 00 00       	call   4a45 <printf>
+     167:	83 c4 10             	add    $0x10,%esp
+      exit();
+     16a:	e8 32 47 00 00       	call   48a1 <exit>
+    }
+    if(chdir("iputdir") < 0){
+     16f:	83 ec 0c             	sub    $0xc,%esp
+     172:	68 21 50 00 00       	push   $0x5021
+     177:	e8 95 47 00 00       	call   4911 <chdir>
+     17c:	83 c4 10             	add    $0x10,%esp
+     17f:	85 c0                	test   %eax,%eax
+     181:	79 1b                	jns    19e <exitiputtest+0xad>
+      printf(stdout, "child chdir failed\n");
+     183:	a1 14 80 00 00       	mov    0x8014,%eax
+     188:	83 ec 08             	sub    $0x8,%esp
+     18b:	68 ae 50 00 00       	push   $0x50ae
+     190:	50                   	push   %eax
+     191:	e8 af 48 00 00       	call   4a45 <printf>
+     196:	83 c4 10             	add    $0x10,%esp
+      exit();
+     199:	e8 03 47 00 00       	call   48a1 <exit>
+    }
+    if(unlink("../iputdir") < 0){
+     19e:	83 ec 0c             	sub    $0xc,%esp
+     1a1:	68 4d 50 00 00       	push   $0x504d
+     1a6:	e8 46 47 00 00       	call   48f1 <unlink>
+     1ab:	83 c4 10             	add    $0x10,%esp
+     1ae:	85 c0                	test   %eax,%eax
+     1b0:	79 1b                	jns    1cd <exitiputtest+0xdc>
+      printf(stdout, "unlink ../iputdir failed\n");
+     1b2:	a1 14 80 00 00       	mov    0x8014,%eax
+     1b7:	83 ec 08             	sub    $0x8,%esp
+     1ba:	68 58 50 00 00       	push   $0x5058
+     1bf:	50                   	push   %eax
+     1c0:	e8 80 48 00 00       	call   4a45 <printf>
+     1c5:	83 c4 10             	add    $0x10,%esp
+      exit();
+     1c8:	e8 d4 46 00 00       	call   48a1 <exit>
+    }
+    exit();
+     1cd:	e8 cf 46 00 00       	call   48a1 <exit>
+  }
+  wait();
+     1d2:	e8 d2 46 00 00       	call   48a9 <wait>
+  printf(stdout, "exitiput test ok\n");
+     1d7:	a1 14 80 00 00       	mov    0x8014,%eax
+     1dc:	83 ec 08             	sub    $0x8,%esp
+     1df:	68 c2 50 00 00       	push   $0x50c2
+     1e4:	50                   	push   %eax
+     1e5:	e8 5b 48 00 00       	call   4a45 <printf>
+     1ea:	83 c4 10             	add    $0x10,%esp
+}
+     1ed:	90                   	nop
+     1ee:	c9                   	leave
+     1ef:	c3                   	ret
+
+000001f0 <openiputtest>:
+//      for(i = 0; i < 10000; i++)
+//        yield();
+//    }
+void
+openiputtest(void)
+{
+     1f0:	55                   	push   %ebp
+     1f1:	89 e5                	mov    %esp,%ebp
+     1f3:	83 ec 18             	sub    $0x18,%esp
+  int pid;
+
+  printf(stdout, "openiput test\n");
+     1f6:	a1 14 80 00 00       	mov    0x8014,%eax
+     1fb:	83 ec 08             	sub    $0x8,%esp
+     1fe:	68 d4 50 00 00       	push   $0x50d4
+     203:	50                   	push   %eax
+     204:	e8 3c 48 00 00       	call   4a45 <printf>
+     209:	83 c4 10             	add    $0x10,%esp
+  if(mkdir("oidir") < 0){
+     20c:	83 ec 0c             	sub    $0xc,%esp
+     20f:	68 e3 50 00 00       	push   $0x50e3
+     214:	e8 f0 46 00 00       	call   4909 <mkdir>
+     219:	83 c4 10             	add    $0x10,%esp
+     21c:	85 c0                	test   %eax,%eax
+     21e:	79 1b                	jns    23b <openiputtest+0x4b>
+    printf(stdout, "mkdir oidir failed\n");
+     220:	a1 14 80 00 00       	mov    0x8014,%eax
+     225:	83 ec 08             	sub    $0x8,%esp
+     228:	68 e9 50 00 00       	push   $0x50e9
+     22d:	50                   	push   %eax
+     22e:	e8 12 48 00 00       	call   4a45 <printf>
+     233:	83 c4 10             	add    $0x10,%esp
+    exit();
+     236:	e8 66 46 00 00       	call   48a1 <exit>
+  }
+  pid = fork();
+     23b:	e8 59 46 00 00       	call   4899 <fork>
+     240:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(pid < 0){
+     243:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     247:	79 1b                	jns    264 <openiputtest+0x74>
+    printf(stdout, "fork failed\n");
+     249:	a1 14 80 00 00       	mov    0x8014,%eax
+     24e:	83 ec 08             	sub    $0x8,%esp
+     251:	68 a1 50 00 00       	push   $0x50a1
+     256:	50                   	push   %eax
+     257:	e8 e9 47 00 00       	call   4a45 <printf>
+     25c:	83 c4 10             	add    $0x10,%esp
+    exit();
+     25f:	e8 3d 46 00 00       	call   48a1 <exit>
+  }
+  if(pid == 0){
+     264:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     268:	75 3b                	jne    2a5 <openiputtest+0xb5>
+    int fd = open("oidir", O_RDWR);
+     26a:	83 ec 08             	sub    $0x8,%esp
+     26d:	6a 02                	push   $0x2
+     26f:	68 e3 50 00 00       	push   $0x50e3
+     274:	e8 68 46 00 00       	call   48e1 <open>
+     279:	83 c4 10             	add    $0x10,%esp
+     27c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(fd >= 0){
+     27f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     283:	78 1b                	js     2a0 <openiputtest+0xb0>
+      printf(stdout, "open directory for write succeeded\n");
+     285:	a1 14 80 00 00       	mov    0x8014,%eax
+     28a:	83 ec 08             	sub    $0x8,%esp
+     28d:	68 00 51 00 00       	push   $0x5100
+     292:	50                   	push   %eax
+     293:	e8 ad 47 00 00       	call   4a45 <printf>
+     298:	83 c4 10             	add    $0x10,%esp
+      exit();
+     29b:	e8 01 46 00 00       	call   48a1 <exit>
+    }
+    exit();
+     2a0:	e8 fc 45 00 00       	call   48a1 <exit>
+  }
+  sleep(1);
+     2a5:	83 ec 0c             	sub    $0xc,%esp
+     2a8:	6a 01                	push   $0x1
+     2aa:	e8 82 46 00 00       	call   4931 <sleep>
+     2af:	83 c4 10             	add    $0x10,%esp
+  if(unlink("oidir") != 0){
+     2b2:	83 ec 0c             	sub    $0xc,%esp
+     2b5:	68 e3 50 00 00       	push   $0x50e3
+     2ba:	e8 32 46 00 00       	call   48f1 <unlink>
+     2bf:	83 c4 10             	add    $0x10,%esp
+     2c2:	85 c0                	test   %eax,%eax
+     2c4:	74 1b                	je     2e1 <openiputtest+0xf1>
+    printf(stdout, "unlink failed\n");
+     2c6:	a1 14 80 00 00       	mov    0x8014,%eax
+     2cb:	83 ec 08             	sub    $0x8,%esp
+     2ce:	68 24 51 00 00       	push   $0x5124
+     2d3:	50                   	push   %eax
+     2d4:	e8 6c 47 00 00       	call   4a45 <printf>
+     2d9:	83 c4 10             	add    $0x10,%esp
+    exit();
+     2dc:	e8 c0 45 00 00       	call   48a1 <exit>
+  }
+  wait();
+     2e1:	e8 c3 45 00 00       	call   48a9 <wait>
+  printf(stdout, "openiput test ok\n");
+     2e6:	a1 14 80 00 00       	mov    0x8014,%eax
+     2eb:	83 ec 08             	sub    $0x8,%esp
+     2ee:	68 33 51 00 00       	push   $0x5133
+     2f3:	50                   	push   %eax
+     2f4:	e8 4c 47 00 00       	call   4a45 <printf>
+     2f9:	83 c4 10             	add    $0x10,%esp
+}
+     2fc:	90                   	nop
+     2fd:	c9                   	leave
+     2fe:	c3                   	ret
+
+000002ff <opentest>:
+
+// simple file system tests
+
+void
+opentest(void)
+{
+     2ff:	55                   	push   %ebp
+     300:	89 e5                	mov    %esp,%ebp
+     302:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  printf(stdout, "open test\n");
+     305:	a1 14 80 00 00       	mov    0x8014,%eax
+     30a:	83 ec 08             	sub    $0x8,%esp
+     30d:	68 45 51 00 00       	push   $0x5145
+     312:	50                   	push   %eax
+     313:	e8 2d 47 00 00       	call   4a45 <printf>
+     318:	83 c4 10             	add    $0x10,%esp
+  fd = open("echo", 0);
+     31b:	83 ec 08             	sub    $0x8,%esp
+     31e:	6a 00                	push   $0x0
+     320:	68 00 50 00 00       	push   $0x5000
+     325:	e8 b7 45 00 00       	call   48e1 <open>
+     32a:	83 c4 10             	add    $0x10,%esp
+     32d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+     330:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     334:	79 1b                	jns    351 <opentest+0x52>
+    printf(stdout, "open echo failed!\n");
+     336:	a1 14 80 00 00       	mov    0x8014,%eax
+     33b:	83 ec 08             	sub    $0x8,%esp
+     33e:	68 50 51 00 00       	push   $0x5150
+     343:	50                   	push   %eax
+     344:	e8 fc 46 00 00       	call   4a45 <printf>
+     349:	83 c4 10             	add    $0x10,%esp
+    exit();
+     34c:	e8 50 45 00 00       	call   48a1 <exit>
+  }
+  close(fd);
+     351:	83 ec 0c             	sub    $0xc,%esp
+     354:	ff 75 f4             	push   -0xc(%ebp)
+     357:	e8 6d 45 00 00       	call   48c9 <close>
+     35c:	83 c4 10             	add    $0x10,%esp
+  fd = open("doesnotexist", 0);
+     35f:	83 ec 08             	sub    $0x8,%esp
+     362:	6a 00                	push   $0x0
+     364:	68 63 51 00 00       	push   $0x5163
+     369:	e8 73 45 00 00       	call   48e1 <open>
+     36e:	83 c4 10             	add    $0x10,%esp
+     371:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd >= 0){
+     374:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     378:	78 1b                	js     395 <opentest+0x96>
+    printf(stdout, "open doesnotexist succeeded!\n");
+     37a:	a1 14 80 00 00       	mov    0x8014,%eax
+     37f:	83 ec 08             	sub    $0x8,%esp
+     382:	68 70 51 00 00       	push   $0x5170
+     387:	50                   	push   %eax
+     388:	e8 b8 46 00 00       	call   4a45 <printf>
+     38d:	83 c4 10             	add    $0x10,%esp
+    exit();
+     390:	e8 0c 45 00 00       	call   48a1 <exit>
+  }
+  printf(stdout, "open test ok\n");
+     395:	a1 14 80 00 00       	mov    0x8014,%eax
+     39a:	83 ec 08             	sub    $0x8,%esp
+     39d:	68 8e 51 00 00       	push   $0x518e
+     3a2:	50                   	push   %eax
+     3a3:	e8 9d 46 00 00       	call   4a45 <printf>
+     3a8:	83 c4 10             	add    $0x10,%esp
+}
+     3ab:	90                   	nop
+     3ac:	c9                   	leave
+     3ad:	c3                   	ret
+
+000003ae <writetest>:
+
+void
+writetest(void)
+{
+     3ae:	55                   	push   %ebp
+     3af:	89 e5                	mov    %esp,%ebp
+     3b1:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int i;
+
+  printf(stdout, "small file test\n");
+     3b4:	a1 14 80 00 00       	mov    0x8014,%eax
+     3b9:	83 ec 08             	sub    $0x8,%esp
+     3bc:	68 9c 51 00 00       	push   $0x519c
+     3c1:	50                   	push   %eax
+     3c2:	e8 7e 46 00 00       	call   4a45 <printf>
+     3c7:	83 c4 10             	add    $0x10,%esp
+  fd = open("small", O_CREATE|O_RDWR);
+     3ca:	83 ec 08             	sub    $0x8,%esp
+     3cd:	68 02 02 00 00       	push   $0x202
+     3d2:	68 ad 51 00 00       	push   $0x51ad
+     3d7:	e8 05 45 00 00       	call   48e1 <open>
+     3dc:	83 c4 10             	add    $0x10,%esp
+     3df:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(fd >= 0){
+     3e2:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     3e6:	78 22                	js     40a <writetest+0x5c>
+    printf(stdout, "creat small succeeded; ok\n");
+     3e8:	a1 14 80 00 00       	mov    0x8014,%eax
+     3ed:	83 ec 08             	sub    $0x8,%esp
+     3f0:	68 b3 51 00 00       	push   $0x51b3
+     3f5:	50                   	push   %eax
+     3f6:	e8 4a 46 00 00       	call   4a45 <printf>
+     3fb:	83 c4 10             	add    $0x10,%esp
+  } else {
+    printf(stdout, "error: creat small failed!\n");
+    exit();
+  }
+  for(i = 0; i < 100; i++){
+     3fe:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     405:	e9 8f 00 00 00       	jmp    499 <writetest+0xeb>
+    printf(stdout, "error: creat small failed!\n");
+     40a:	a1 14 80 00 00       	mov    0x8014,%eax
+     40f:	83 ec 08             	sub    $0x8,%esp
+     412:	68 ce 51 00 00       	push   $0x51ce
+     417:	50                   	push   %eax
+     418:	e8 28 46 00 00       	call   4a45 <printf>
+     41d:	83 c4 10             	add    $0x10,%esp
+    exit();
+     420:	e8 7c 44 00 00       	call   48a1 <exit>
+    if(write(fd, "aaaaaaaaaa", 10) != 10){
+     425:	83 ec 04             	sub    $0x4,%esp
+     428:	6a 0a                	push   $0xa
+     42a:	68 ea 51 00 00       	push   $0x51ea
+     42f:	ff 75 f0             	push   -0x10(%ebp)
+     432:	e8 8a 44 00 00       	call   48c1 <write>
+     437:	83 c4 10             	add    $0x10,%esp
+     43a:	83 f8 0a             	cmp    $0xa,%eax
+     43d:	74 1e                	je     45d <writetest+0xaf>
+      printf(stdout, "error: write aa %d new file failed\n", i);
+     43f:	a1 14 80 00 00       	mov    0x8014,%eax
+     444:	83 ec 04             	sub    $0x4,%esp
+     447:	ff 75 f4             	push   -0xc(%ebp)
+     44a:	68 f8 51 00 00       	push   $0x51f8
+     44f:	50                   	push   %eax
+     450:	e8 f0 45 00 00       	call   4a45 <printf>
+     455:	83 c4 10             	add    $0x10,%esp
+      exit();
+     458:	e8 44 44 00 00       	call   48a1 <exit>
+    }
+    if(write(fd, "bbbbbbbbbb", 10) != 10){
+     45d:	83 ec 04             	sub    $0x4,%esp
+     460:	6a 0a                	push   $0xa
+     462:	68 1c 52 00 00       	push   $0x521c
+     467:	ff 75 f0             	push   -0x10(%ebp)
+     46a:	e8 52 44 00 00       	call   48c1 <write>
+     46f:	83 c4 10             	add    $0x10,%esp
+     472:	83 f8 0a             	cmp    $0xa,%eax
+     475:	74 1e                	je     495 <writetest+0xe7>
+      printf(stdout, "error: write bb %d new file failed\n", i);
+     477:	a1 14 80 00 00       	mov    0x8014,%eax
+     47c:	83 ec 04             	sub    $0x4,%esp
+     47f:	ff 75 f4             	push   -0xc(%ebp)
+     482:	68 28 52 00 00       	push   $0x5228
+     487:	50                   	push   %eax
+     488:	e8 b8 45 00 00       	call   4a45 <printf>
+     48d:	83 c4 10             	add    $0x10,%esp
+      exit();
+     490:	e8 0c 44 00 00       	call   48a1 <exit>
+  for(i = 0; i < 100; i++){
+     495:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     499:	83 7d f4 63          	cmpl   $0x63,-0xc(%ebp)
+     49d:	7e 86                	jle    425 <writetest+0x77>
+    }
+  }
+  printf(stdout, "writes ok\n");
+     49f:	a1 14 80 00 00       	mov    0x8014,%eax
+     4a4:	83 ec 08             	sub    $0x8,%esp
+     4a7:	68 4c 52 00 00       	push   $0x524c
+     4ac:	50                   	push   %eax
+     4ad:	e8 93 45 00 00       	call   4a45 <printf>
+     4b2:	83 c4 10             	add    $0x10,%esp
+  close(fd);
+     4b5:	83 ec 0c             	sub    $0xc,%esp
+     4b8:	ff 75 f0             	push   -0x10(%ebp)
+     4bb:	e8 09 44 00 00       	call   48c9 <close>
+     4c0:	83 c4 10             	add    $0x10,%esp
+  fd = open("small", O_RDONLY);
+     4c3:	83 ec 08             	sub    $0x8,%esp
+     4c6:	6a 00                	push   $0x0
+     4c8:	68 ad 51 00 00       	push   $0x51ad
+     4cd:	e8 0f 44 00 00       	call   48e1 <open>
+     4d2:	83 c4 10             	add    $0x10,%esp
+     4d5:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(fd >= 0){
+     4d8:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     4dc:	78 3c                	js     51a <writetest+0x16c>
+    printf(stdout, "open small succeeded ok\n");
+     4de:	a1 14 80 00 00       	mov    0x8014,%eax
+     4e3:	83 ec 08             	sub    $0x8,%esp
+     4e6:	68 57 52 00 00       	push   $0x5257
+     4eb:	50                   	push   %eax
+     4ec:	e8 54 45 00 00       	call   4a45 <printf>
+     4f1:	83 c4 10             	add    $0x10,%esp
+  } else {
+    printf(stdout, "error: open small failed!\n");
+    exit();
+  }
+  i = read(fd, buf, 2000);
+     4f4:	83 ec 04             	sub    $0x4,%esp
+     4f7:	68 d0 07 00 00       	push   $0x7d0
+     4fc:	68 a0 80 00 00       	push   $0x80a0
+     501:	ff 75 f0             	push   -0x10(%ebp)
+     504:	e8 b0 43 00 00       	call   48b9 <read>
+     509:	83 c4 10             	add    $0x10,%esp
+     50c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(i == 2000){
+     50f:	81 7d f4 d0 07 00 00 	cmpl   $0x7d0,-0xc(%ebp)
+     516:	75 57                	jne    56f <writetest+0x1c1>
+     518:	eb 1b                	jmp    535 <writetest+0x187>
+    printf(stdout, "error: open small failed!\n");
+     51a:	a1 14 80 00 00       	mov    0x8014,%eax
+     51f:	83 ec 08             	sub    $0x8,%esp
+     522:	68 70 52 00 00       	push   $0x5270
+     527:	50                   	push   %eax
+     528:	e8 18 45 00 00       	call   4a45 <printf>
+     52d:	83 c4 10             	add    $0x10,%esp
+    exit();
+     530:	e8 6c 43 00 00       	call   48a1 <exit>
+    printf(stdout, "read succeeded ok\n");
+     535:	a1 14 80 00 00       	mov    0x8014,%eax
+     53a:	83 ec 08             	sub    $0x8,%esp
+     53d:	68 8b 52 00 00       	push   $0x528b
+     542:	50                   	push   %eax
+     543:	e8 fd 44 00 00       	call   4a45 <printf>
+     548:	83 c4 10             	add    $0x10,%esp
+  } else {
+    printf(stdout, "read failed\n");
+    exit();
+  }
+  close(fd);
+     54b:	83 ec 0c             	sub    $0xc,%esp
+     54e:	ff 75 f0             	push   -0x10(%ebp)
+     551:	e8 73 43 00 00       	call   48c9 <close>
+     556:	83 c4 10             	add    $0x10,%esp
+
+  if(unlink("small") < 0){
+     559:	83 ec 0c             	sub    $0xc,%esp
+     55c:	68 ad 51 00 00       	push   $0x51ad
+     561:	e8 8b 43 00 00       	call   48f1 <unlink>
+     566:	83 c4 10             	add    $0x10,%esp
+     569:	85 c0                	test   %eax,%eax
+     56b:	79 38                	jns    5a5 <writetest+0x1f7>
+     56d:	eb 1b                	jmp    58a <writetest+0x1dc>
+    printf(stdout, "read failed\n");
+     56f:	a1 14 80 00 00       	mov    0x8014,%eax
+     574:	83 ec 08             	sub    $0x8,%esp
+     577:	68 9e 52 00 00       	push   $0x529e
+     57c:	50                   	push   %eax
+     57d:	e8 c3 44 00 00       	call   4a45 <printf>
+     582:	83 c4 10             	add    $0x10,%esp
+    exit();
+     585:	e8 17 43 00 00       	call   48a1 <exit>
+    printf(stdout, "unlink small failed\n");
+     58a:	a1 14 80 00 00       	mov    0x8014,%eax
+     58f:	83 ec 08             	sub    $0x8,%esp
+     592:	68 ab 52 00 00       	push   $0x52ab
+     597:	50                   	push   %eax
+     598:	e8 a8 44 00 00       	call   4a45 <printf>
+     59d:	83 c4 10             	add    $0x10,%esp
+    exit();
+     5a0:	e8 fc 42 00 00       	call   48a1 <exit>
+  }
+  printf(stdout, "small file test ok\n");
+     5a5:	a1 14 80 00 00       	mov    0x8014,%eax
+     5aa:	83 ec 08             	sub    $0x8,%esp
+     5ad:	68 c0 52 00 00       	push   $0x52c0
+     5b2:	50                   	push   %eax
+     5b3:	e8 8d 44 00 00       	call   4a45 <printf>
+     5b8:	83 c4 10             	add    $0x10,%esp
+}
+     5bb:	90                   	nop
+     5bc:	c9                   	leave
+     5bd:	c3                   	ret
+
+000005be <writetest1>:
+
+#define MAXFILE 10
+
+void
+writetest1(void)
+{
+     5be:	55                   	push   %ebp
+     5bf:	89 e5                	mov    %esp,%ebp
+     5c1:	83 ec 18             	sub    $0x18,%esp
+  int i, fd, n;
+
+  printf(stdout, "big files test\n");
+     5c4:	a1 14 80 00 00       	mov    0x8014,%eax
+     5c9:	83 ec 08             	sub    $0x8,%esp
+     5cc:	68 d4 52 00 00       	push   $0x52d4
+     5d1:	50                   	push   %eax
+     5d2:	e8 6e 44 00 00       	call   4a45 <printf>
+     5d7:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("big", O_CREATE|O_RDWR);
+     5da:	83 ec 08             	sub    $0x8,%esp
+     5dd:	68 02 02 00 00       	push   $0x202
+     5e2:	68 e4 52 00 00       	push   $0x52e4
+     5e7:	e8 f5 42 00 00       	call   48e1 <open>
+     5ec:	83 c4 10             	add    $0x10,%esp
+     5ef:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(fd < 0){
+     5f2:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     5f6:	79 1b                	jns    613 <writetest1+0x55>
+    printf(stdout, "error: creat big failed!\n");
+     5f8:	a1 14 80 00 00       	mov    0x8014,%eax
+     5fd:	83 ec 08             	sub    $0x8,%esp
+     600:	68 e8 52 00 00       	push   $0x52e8
+     605:	50                   	push   %eax
+     606:	e8 3a 44 00 00       	call   4a45 <printf>
+     60b:	83 c4 10             	add    $0x10,%esp
+    exit();
+     60e:	e8 8e 42 00 00       	call   48a1 <exit>
+  }
+
+  for(i = 0; i < MAXFILE; i++){
+     613:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     61a:	eb 4b                	jmp    667 <writetest1+0xa9>
+    ((int*)buf)[0] = i;
+     61c:	ba a0 80 00 00       	mov    $0x80a0,%edx
+     621:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     624:	89 02                	mov    %eax,(%edx)
+    if(write(fd, buf, 512) != 512){
+     626:	83 ec 04             	sub    $0x4,%esp
+     629:	68 00 02 00 00       	push   $0x200
+     62e:	68 a0 80 00 00       	push   $0x80a0
+     633:	ff 75 ec             	push   -0x14(%ebp)
+     636:	e8 86 42 00 00       	call   48c1 <write>
+     63b:	83 c4 10             	add    $0x10,%esp
+     63e:	3d 00 02 00 00       	cmp    $0x200,%eax
+     643:	74 1e                	je     663 <writetest1+0xa5>
+      printf(stdout, "error: write big file failed\n", i);
+     645:	a1 14 80 00 00       	mov    0x8014,%eax
+     64a:	83 ec 04             	sub    $0x4,%esp
+     64d:	ff 75 f4             	push   -0xc(%ebp)
+     650:	68 02 53 00 00       	push   $0x5302
+     655:	50                   	push   %eax
+     656:	e8 ea 43 00 00       	call   4a45 <printf>
+     65b:	83 c4 10             	add    $0x10,%esp
+      exit();
+     65e:	e8 3e 42 00 00       	call   48a1 <exit>
+  for(i = 0; i < MAXFILE; i++){
+     663:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     667:	83 7d f4 09          	cmpl   $0x9,-0xc(%ebp)
+     66b:	7e af                	jle    61c <writetest1+0x5e>
+    }
+  }
+
+  close(fd);
+     66d:	83 ec 0c             	sub    $0xc,%esp
+     670:	ff 75 ec             	push   -0x14(%ebp)
+     673:	e8 51 42 00 00       	call   48c9 <close>
+     678:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("big", O_RDONLY);
+     67b:	83 ec 08             	sub    $0x8,%esp
+     67e:	6a 00                	push   $0x0
+     680:	68 e4 52 00 00       	push   $0x52e4
+     685:	e8 57 42 00 00       	call   48e1 <open>
+     68a:	83 c4 10             	add    $0x10,%esp
+     68d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(fd < 0){
+     690:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     694:	79 1b                	jns    6b1 <writetest1+0xf3>
+    printf(stdout, "error: open big failed!\n");
+     696:	a1 14 80 00 00       	mov    0x8014,%eax
+     69b:	83 ec 08             	sub    $0x8,%esp
+     69e:	68 20 53 00 00       	push   $0x5320
+     6a3:	50                   	push   %eax
+     6a4:	e8 9c 43 00 00       	call   4a45 <printf>
+     6a9:	83 c4 10             	add    $0x10,%esp
+    exit();
+     6ac:	e8 f0 41 00 00       	call   48a1 <exit>
+  }
+
+  n = 0;
+     6b1:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  for(;;){
+    i = read(fd, buf, 512);
+     6b8:	83 ec 04             	sub    $0x4,%esp
+     6bb:	68 00 02 00 00       	push   $0x200
+     6c0:	68 a0 80 00 00       	push   $0x80a0
+     6c5:	ff 75 ec             	push   -0x14(%ebp)
+     6c8:	e8 ec 41 00 00       	call   48b9 <read>
+     6cd:	83 c4 10             	add    $0x10,%esp
+     6d0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(i == 0){
+     6d3:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     6d7:	75 24                	jne    6fd <writetest1+0x13f>
+      if(n == MAXFILE - 1){
+     6d9:	83 7d f0 09          	cmpl   $0x9,-0x10(%ebp)
+     6dd:	75 7d                	jne    75c <writetest1+0x19e>
+        printf(stdout, "read only %d blocks from big", n);
+     6df:	a1 14 80 00 00       	mov    0x8014,%eax
+     6e4:	83 ec 04             	sub    $0x4,%esp
+     6e7:	ff 75 f0             	push   -0x10(%ebp)
+     6ea:	68 39 53 00 00       	push   $0x5339
+     6ef:	50                   	push   %eax
+     6f0:	e8 50 43 00 00       	call   4a45 <printf>
+     6f5:	83 c4 10             	add    $0x10,%esp
+        exit();
+     6f8:	e8 a4 41 00 00       	call   48a1 <exit>
+      }
+      break;
+    } else if(i != 512){
+     6fd:	81 7d f4 00 02 00 00 	cmpl   $0x200,-0xc(%ebp)
+     704:	74 1e                	je     724 <writetest1+0x166>
+      printf(stdout, "read failed %d\n", i);
+     706:	a1 14 80 00 00       	mov    0x8014,%eax
+     70b:	83 ec 04             	sub    $0x4,%esp
+     70e:	ff 75 f4             	push   -0xc(%ebp)
+     711:	68 56 53 00 00       	push   $0x5356
+     716:	50                   	push   %eax
+     717:	e8 29 43 00 00       	call   4a45 <printf>
+     71c:	83 c4 10             	add    $0x10,%esp
+      exit();
+     71f:	e8 7d 41 00 00       	call   48a1 <exit>
+    }
+    if(((int*)buf)[0] != n){
+     724:	b8 a0 80 00 00       	mov    $0x80a0,%eax
+     729:	8b 00                	mov    (%eax),%eax
+     72b:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+     72e:	74 23                	je     753 <writetest1+0x195>
+      printf(stdout, "read content of block %d is %d\n",
+             n, ((int*)buf)[0]);
+     730:	b8 a0 80 00 00       	mov    $0x80a0,%eax
+      printf(stdout, "read content of block %d is %d\n",
+     735:	8b 10                	mov    (%eax),%edx
+     737:	a1 14 80 00 00       	mov    0x8014,%eax
+     73c:	52                   	push   %edx
+     73d:	ff 75 f0             	push   -0x10(%ebp)
+     740:	68 68 53 00 00       	push   $0x5368
+     745:	50                   	push   %eax
+     746:	e8 fa 42 00 00       	call   4a45 <printf>
+     74b:	83 c4 10             	add    $0x10,%esp
+      exit();
+     74e:	e8 4e 41 00 00       	call   48a1 <exit>
+    }
+    n++;
+     753:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    i = read(fd, buf, 512);
+     757:	e9 5c ff ff ff       	jmp    6b8 <writetest1+0xfa>
+      break;
+     75c:	90                   	nop
+  }
+  close(fd);
+     75d:	83 ec 0c             	sub    $0xc,%esp
+     760:	ff 75 ec             	push   -0x14(%ebp)
+     763:	e8 61 41 00 00       	call   48c9 <close>
+     768:	83 c4 10             	add    $0x10,%esp
+  if(unlink("big") < 0){
+     76b:	83 ec 0c             	sub    $0xc,%esp
+     76e:	68 e4 52 00 00       	push   $0x52e4
+     773:	e8 79 41 00 00       	call   48f1 <unlink>
+     778:	83 c4 10             	add    $0x10,%esp
+     77b:	85 c0                	test   %eax,%eax
+     77d:	79 1b                	jns    79a <writetest1+0x1dc>
+    printf(stdout, "unlink big failed\n");
+     77f:	a1 14 80 00 00       	mov    0x8014,%eax
+     784:	83 ec 08             	sub    $0x8,%esp
+     787:	68 88 53 00 00       	push   $0x5388
+     78c:	50                   	push   %eax
+     78d:	e8 b3 42 00 00       	call   4a45 <printf>
+     792:	83 c4 10             	add    $0x10,%esp
+    exit();
+     795:	e8 07 41 00 00       	call   48a1 <exit>
+  }
+  printf(stdout, "big files ok\n");
+     79a:	a1 14 80 00 00       	mov    0x8014,%eax
+     79f:	83 ec 08             	sub    $0x8,%esp
+     7a2:	68 9b 53 00 00       	push   $0x539b
+     7a7:	50                   	push   %eax
+     7a8:	e8 98 42 00 00       	call   4a45 <printf>
+     7ad:	83 c4 10             	add    $0x10,%esp
+}
+     7b0:	90                   	nop
+     7b1:	c9                   	leave
+     7b2:	c3                   	ret
+
+000007b3 <createtest>:
+
+void
+createtest(void)
+{
+     7b3:	55                   	push   %ebp
+     7b4:	89 e5                	mov    %esp,%ebp
+     7b6:	83 ec 18             	sub    $0x18,%esp
+  int i, fd;
+
+  printf(stdout, "many creates, followed by unlink test\n");
+     7b9:	a1 14 80 00 00       	mov    0x8014,%eax
+     7be:	83 ec 08             	sub    $0x8,%esp
+     7c1:	68 ac 53 00 00       	push   $0x53ac
+     7c6:	50                   	push   %eax
+     7c7:	e8 79 42 00 00       	call   4a45 <printf>
+     7cc:	83 c4 10             	add    $0x10,%esp
+
+  name[0] = 'a';
+     7cf:	c6 05 a0 a0 00 00 61 	movb   $0x61,0xa0a0
+  name[2] = '\0';
+     7d6:	c6 05 a2 a0 00 00 00 	movb   $0x0,0xa0a2
+  for(i = 0; i < 52; i++){
+     7dd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     7e4:	eb 35                	jmp    81b <createtest+0x68>
+    name[1] = '0' + i;
+     7e6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     7e9:	83 c0 30             	add    $0x30,%eax
+     7ec:	a2 a1 a0 00 00       	mov    %al,0xa0a1
+    fd = open(name, O_CREATE|O_RDWR);
+     7f1:	83 ec 08             	sub    $0x8,%esp
+     7f4:	68 02 02 00 00       	push   $0x202
+     7f9:	68 a0 a0 00 00       	push   $0xa0a0
+     7fe:	e8 de 40 00 00       	call   48e1 <open>
+     803:	83 c4 10             	add    $0x10,%esp
+     806:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    close(fd);
+     809:	83 ec 0c             	sub    $0xc,%esp
+     80c:	ff 75 f0             	push   -0x10(%ebp)
+     80f:	e8 b5 40 00 00       	call   48c9 <close>
+     814:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 52; i++){
+     817:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     81b:	83 7d f4 33          	cmpl   $0x33,-0xc(%ebp)
+     81f:	7e c5                	jle    7e6 <createtest+0x33>
+  }
+  name[0] = 'a';
+     821:	c6 05 a0 a0 00 00 61 	movb   $0x61,0xa0a0
+  name[2] = '\0';
+     828:	c6 05 a2 a0 00 00 00 	movb   $0x0,0xa0a2
+  for(i = 0; i < 52; i++){
+     82f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     836:	eb 1f                	jmp    857 <createtest+0xa4>
+    name[1] = '0' + i;
+     838:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     83b:	83 c0 30             	add    $0x30,%eax
+     83e:	a2 a1 a0 00 00       	mov    %al,0xa0a1
+    unlink(name);
+     843:	83 ec 0c             	sub    $0xc,%esp
+     846:	68 a0 a0 00 00       	push   $0xa0a0
+     84b:	e8 a1 40 00 00       	call   48f1 <unlink>
+     850:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 52; i++){
+     853:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     857:	83 7d f4 33          	cmpl   $0x33,-0xc(%ebp)
+     85b:	7e db                	jle    838 <createtest+0x85>
+  }
+  printf(stdout, "many creates, followed by unlink; ok\n");
+     85d:	a1 14 80 00 00       	mov    0x8014,%eax
+     862:	83 ec 08             	sub    $0x8,%esp
+     865:	68 d4 53 00 00       	push   $0x53d4
+     86a:	50                   	push   %eax
+     86b:	e8 d5 41 00 00       	call   4a45 <printf>
+     870:	83 c4 10             	add    $0x10,%esp
+}
+     873:	90                   	nop
+     874:	c9                   	leave
+     875:	c3                   	ret
+
+00000876 <dirtest>:
+
+void dirtest(void)
+{
+     876:	55                   	push   %ebp
+     877:	89 e5                	mov    %esp,%ebp
+     879:	83 ec 08             	sub    $0x8,%esp
+  printf(stdout, "mkdir test\n");
+     87c:	a1 14 80 00 00       	mov    0x8014,%eax
+     881:	83 ec 08             	sub    $0x8,%esp
+     884:	68 fa 53 00 00       	push   $0x53fa
+     889:	50                   	push   %eax
+     88a:	e8 b6 41 00 00       	call   4a45 <printf>
+     88f:	83 c4 10             	add    $0x10,%esp
+
+  if(mkdir("dir0") < 0){
+     892:	83 ec 0c             	sub    $0xc,%esp
+     895:	68 06 54 00 00       	push   $0x5406
+     89a:	e8 6a 40 00 00       	call   4909 <mkdir>
+     89f:	83 c4 10             	add    $0x10,%esp
+     8a2:	85 c0                	test   %eax,%eax
+     8a4:	79 1b                	jns    8c1 <dirtest+0x4b>
+    printf(stdout, "mkdir failed\n");
+     8a6:	a1 14 80 00 00       	mov    0x8014,%eax
+     8ab:	83 ec 08             	sub    $0x8,%esp
+     8ae:	68 29 50 00 00       	push   $0x5029
+     8b3:	50                   	push   %eax
+     8b4:	e8 8c 41 00 00       	call   4a45 <printf>
+     8b9:	83 c4 10             	add    $0x10,%esp
+    exit();
+     8bc:	e8 e0 3f 00 00       	call   48a1 <exit>
+  }
+
+  if(chdir("dir0") < 0){
+     8c1:	83 ec 0c             	sub    $0xc,%esp
+     8c4:	68 06 54 00 00       	push   $0x5406
+     8c9:	e8 43 40 00 00       	call   4911 <chdir>
+     8ce:	83 c4 10             	add    $0x10,%esp
+     8d1:	85 c0                	test   %eax,%eax
+     8d3:	79 1b                	jns    8f0 <dirtest+0x7a>
+    printf(stdout, "chdir dir0 failed\n");
+     8d5:	a1 14 80 00 00       	mov    0x8014,%eax
+     8da:	83 ec 08             	sub    $0x8,%esp
+     8dd:	68 0b 54 00 00       	push   $0x540b
+     8e2:	50                   	push   %eax
+     8e3:	e8 5d 41 00 00       	call   4a45 <printf>
+     8e8:	83 c4 10             	add    $0x10,%esp
+    exit();
+     8eb:	e8 b1 3f 00 00       	call   48a1 <exit>
+  }
+
+  if(chdir("..") < 0){
+     8f0:	83 ec 0c             	sub    $0xc,%esp
+     8f3:	68 1e 54 00 00       	push   $0x541e
+     8f8:	e8 14 40 00 00       	call   4911 <chdir>
+     8fd:	83 c4 10             	add    $0x10,%esp
+     900:	85 c0                	test   %eax,%eax
+     902:	79 1b                	jns    91f <dirtest+0xa9>
+    printf(stdout, "chdir .. failed\n");
+     904:	a1 14 80 00 00       	mov    0x8014,%eax
+     909:	83 ec 08             	sub    $0x8,%esp
+     90c:	68 21 54 00 00       	push   $0x5421
+     911:	50                   	push   %eax
+     912:	e8 2e 41 00 00       	call   4a45 <printf>
+     917:	83 c4 10             	add    $0x10,%esp
+    exit();
+     91a:	e8 82 3f 00 00       	call   48a1 <exit>
+  }
+
+  if(unlink("dir0") < 0){
+     91f:	83 ec 0c             	sub    $0xc,%esp
+     922:	68 06 54 00 00       	push   $0x5406
+     927:	e8 c5 3f 00 00       	call   48f1 <unlink>
+     92c:	83 c4 10             	add    $0x10,%esp
+     92f:	85 c0                	test   %eax,%eax
+     931:	79 1b                	jns    94e <dirtest+0xd8>
+    printf(stdout, "unlink dir0 failed\n");
+     933:	a1 14 80 00 00       	mov    0x8014,%eax
+     938:	83 ec 08             	sub    $0x8,%esp
+     93b:	68 32 54 00 00       	push   $0x5432
+     940:	50                   	push   %eax
+     941:	e8 ff 40 00 00       	call   4a45 <printf>
+     946:	83 c4 10             	add    $0x10,%esp
+    exit();
+     949:	e8 53 3f 00 00       	call   48a1 <exit>
+  }
+  printf(stdout, "mkdir test ok\n");
+     94e:	a1 14 80 00 00       	mov    0x8014,%eax
+     953:	83 ec 08             	sub    $0x8,%esp
+     956:	68 46 54 00 00       	push   $0x5446
+     95b:	50                   	push   %eax
+     95c:	e8 e4 40 00 00       	call   4a45 <printf>
+     961:	83 c4 10             	add    $0x10,%esp
+}
+     964:	90                   	nop
+     965:	c9                   	leave
+     966:	c3                   	ret
+
+00000967 <exectest>:
+
+void
+exectest(void)
+{
+     967:	55                   	push   %ebp
+     968:	89 e5                	mov    %esp,%ebp
+     96a:	83 ec 08             	sub    $0x8,%esp
+  printf(stdout, "exec test\n");
+     96d:	a1 14 80 00 00       	mov    0x8014,%eax
+     972:	83 ec 08             	sub    $0x8,%esp
+     975:	68 55 54 00 00       	push   $0x5455
+     97a:	50                   	push   %eax
+     97b:	e8 c5 40 00 00       	call   4a45 <printf>
+     980:	83 c4 10             	add    $0x10,%esp
+  if(exec("echo", echoargv) < 0){
+     983:	83 ec 08             	sub    $0x8,%esp
+     986:	68 00 80 00 00       	push   $0x8000
+     98b:	68 00 50 00 00       	push   $0x5000
+     990:	e8 44 3f 00 00       	call   48d9 <exec>
+     995:	83 c4 10             	add    $0x10,%esp
+     998:	85 c0                	test   %eax,%eax
+     99a:	79 1b                	jns    9b7 <exectest+0x50>
+    printf(stdout, "exec echo failed\n");
+     99c:	a1 14 80 00 00       	mov    0x8014,%eax
+     9a1:	83 ec 08             	sub    $0x8,%esp
+     9a4:	68 60 54 00 00       	push   $0x5460
+     9a9:	50                   	push   %eax
+     9aa:	e8 96 40 00 00       	call   4a45 <printf>
+     9af:	83 c4 10             	add    $0x10,%esp
+    exit();
+     9b2:	e8 ea 3e 00 00       	call   48a1 <exit>
+  }
+}
+     9b7:	90                   	nop
+     9b8:	c9                   	leave
+     9b9:	c3                   	ret
+
+000009ba <pipe1>:
+
+// simple fork and pipe read/write
+
+void
+pipe1(void)
+{
+     9ba:	55                   	push   %ebp
+     9bb:	89 e5                	mov    %esp,%ebp
+     9bd:	83 ec 28             	sub    $0x28,%esp
+  int fds[2], pid;
+  int seq, i, n, cc, total;
+
+  if(pipe(fds) != 0){
+     9c0:	83 ec 0c             	sub    $0xc,%esp
+     9c3:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     9c6:	50                   	push   %eax
+     9c7:	e8 e5 3e 00 00       	call   48b1 <pipe>
+     9cc:	83 c4 10             	add    $0x10,%esp
+     9cf:	85 c0                	test   %eax,%eax
+     9d1:	74 17                	je     9ea <pipe1+0x30>
+    printf(1, "pipe() failed\n");
+     9d3:	83 ec 08             	sub    $0x8,%esp
+     9d6:	68 72 54 00 00       	push   $0x5472
+     9db:	6a 01                	push   $0x1
+     9dd:	e8 63 40 00 00       	call   4a45 <printf>
+     9e2:	83 c4 10             	add    $0x10,%esp
+    exit();
+     9e5:	e8 b7 3e 00 00       	call   48a1 <exit>
+  }
+  pid = fork();
+     9ea:	e8 aa 3e 00 00       	call   4899 <fork>
+     9ef:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  seq = 0;
+     9f2:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  if(pid == 0){
+     9f9:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+     9fd:	0f 85 89 00 00 00    	jne    a8c <pipe1+0xd2>
+    close(fds[0]);
+     a03:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     a06:	83 ec 0c             	sub    $0xc,%esp
+     a09:	50                   	push   %eax
+     a0a:	e8 ba 3e 00 00       	call   48c9 <close>
+     a0f:	83 c4 10             	add    $0x10,%esp
+    for(n = 0; n < 5; n++){
+     a12:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+     a19:	eb 66                	jmp    a81 <pipe1+0xc7>
+      for(i = 0; i < 1033; i++)
+     a1b:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     a22:	eb 19                	jmp    a3d <pipe1+0x83>
+        buf[i] = seq++;
+     a24:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     a27:	8d 50 01             	lea    0x1(%eax),%edx
+     a2a:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     a2d:	89 c2                	mov    %eax,%edx
+     a2f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     a32:	05 a0 80 00 00       	add    $0x80a0,%eax
+     a37:	88 10                	mov    %dl,(%eax)
+      for(i = 0; i < 1033; i++)
+     a39:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     a3d:	81 7d f0 08 04 00 00 	cmpl   $0x408,-0x10(%ebp)
+     a44:	7e de                	jle    a24 <pipe1+0x6a>
+      if(write(fds[1], buf, 1033) != 1033){
+     a46:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     a49:	83 ec 04             	sub    $0x4,%esp
+     a4c:	68 09 04 00 00       	push   $0x409
+     a51:	68 a0 80 00 00       	push   $0x80a0
+     a56:	50                   	push   %eax
+     a57:	e8 65 3e 00 00       	call   48c1 <write>
+     a5c:	83 c4 10             	add    $0x10,%esp
+     a5f:	3d 09 04 00 00       	cmp    $0x409,%eax
+     a64:	74 17                	je     a7d <pipe1+0xc3>
+        printf(1, "pipe1 oops 1\n");
+     a66:	83 ec 08             	sub    $0x8,%esp
+     a69:	68 81 54 00 00       	push   $0x5481
+     a6e:	6a 01                	push   $0x1
+     a70:	e8 d0 3f 00 00       	call   4a45 <printf>
+     a75:	83 c4 10             	add    $0x10,%esp
+        exit();
+     a78:	e8 24 3e 00 00       	call   48a1 <exit>
+    for(n = 0; n < 5; n++){
+     a7d:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+     a81:	83 7d ec 04          	cmpl   $0x4,-0x14(%ebp)
+     a85:	7e 94                	jle    a1b <pipe1+0x61>
+      }
+    }
+    exit();
+     a87:	e8 15 3e 00 00       	call   48a1 <exit>
+  } else if(pid > 0){
+     a8c:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+     a90:	0f 8e f4 00 00 00    	jle    b8a <pipe1+0x1d0>
+    close(fds[1]);
+     a96:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     a99:	83 ec 0c             	sub    $0xc,%esp
+     a9c:	50                   	push   %eax
+     a9d:	e8 27 3e 00 00       	call   48c9 <close>
+     aa2:	83 c4 10             	add    $0x10,%esp
+    total = 0;
+     aa5:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+    cc = 1;
+     aac:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+    while((n = read(fds[0], buf, cc)) > 0){
+     ab3:	eb 66                	jmp    b1b <pipe1+0x161>
+      for(i = 0; i < n; i++){
+     ab5:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     abc:	eb 3b                	jmp    af9 <pipe1+0x13f>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     abe:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     ac1:	05 a0 80 00 00       	add    $0x80a0,%eax
+     ac6:	0f b6 00             	movzbl (%eax),%eax
+     ac9:	0f be c8             	movsbl %al,%ecx
+     acc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     acf:	8d 50 01             	lea    0x1(%eax),%edx
+     ad2:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     ad5:	31 c8                	xor    %ecx,%eax
+     ad7:	0f b6 c0             	movzbl %al,%eax
+     ada:	85 c0                	test   %eax,%eax
+     adc:	74 17                	je     af5 <pipe1+0x13b>
+          printf(1, "pipe1 oops 2\n");
+     ade:	83 ec 08             	sub    $0x8,%esp
+     ae1:	68 8f 54 00 00       	push   $0x548f
+     ae6:	6a 01                	push   $0x1
+     ae8:	e8 58 3f 00 00       	call   4a45 <printf>
+     aed:	83 c4 10             	add    $0x10,%esp
+     af0:	e9 ac 00 00 00       	jmp    ba1 <pipe1+0x1e7>
+      for(i = 0; i < n; i++){
+     af5:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     af9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     afc:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+     aff:	7c bd                	jl     abe <pipe1+0x104>
+          return;
+        }
+      }
+      total += n;
+     b01:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     b04:	01 45 e4             	add    %eax,-0x1c(%ebp)
+      cc = cc * 2;
+     b07:	d1 65 e8             	shll   -0x18(%ebp)
+      if(cc > sizeof(buf))
+     b0a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     b0d:	3d 00 20 00 00       	cmp    $0x2000,%eax
+     b12:	76 07                	jbe    b1b <pipe1+0x161>
+        cc = sizeof(buf);
+     b14:	c7 45 e8 00 20 00 00 	movl   $0x2000,-0x18(%ebp)
+    while((n = read(fds[0], buf, cc)) > 0){
+     b1b:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     b1e:	83 ec 04             	sub    $0x4,%esp
+     b21:	ff 75 e8             	push   -0x18(%ebp)
+     b24:	68 a0 80 00 00       	push   $0x80a0
+     b29:	50                   	push   %eax
+     b2a:	e8 8a 3d 00 00       	call   48b9 <read>
+     b2f:	83 c4 10             	add    $0x10,%esp
+     b32:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     b35:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     b39:	0f 8f 76 ff ff ff    	jg     ab5 <pipe1+0xfb>
+    }
+    if(total != 5 * 1033){
+     b3f:	81 7d e4 2d 14 00 00 	cmpl   $0x142d,-0x1c(%ebp)
+     b46:	74 1a                	je     b62 <pipe1+0x1a8>
+      printf(1, "pipe1 oops 3 total %d\n", total);
+     b48:	83 ec 04             	sub    $0x4,%esp
+     b4b:	ff 75 e4             	push   -0x1c(%ebp)
+     b4e:	68 9d 54 00 00       	push   $0x549d
+     b53:	6a 01                	push   $0x1
+     b55:	e8 eb 3e 00 00       	call   4a45 <printf>
+     b5a:	83 c4 10             	add    $0x10,%esp
+      exit();
+     b5d:	e8 3f 3d 00 00       	call   48a1 <exit>
+    }
+    close(fds[0]);
+     b62:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     b65:	83 ec 0c             	sub    $0xc,%esp
+     b68:	50                   	push   %eax
+     b69:	e8 5b 3d 00 00       	call   48c9 <close>
+     b6e:	83 c4 10             	add    $0x10,%esp
+    wait();
+     b71:	e8 33 3d 00 00       	call   48a9 <wait>
+  } else {
+    printf(1, "fork() failed\n");
+    exit();
+  }
+  printf(1, "pipe1 ok\n");
+     b76:	83 ec 08             	sub    $0x8,%esp
+     b79:	68 c3 54 00 00       	push   $0x54c3
+     b7e:	6a 01                	push   $0x1
+     b80:	e8 c0 3e 00 00       	call   4a45 <printf>
+     b85:	83 c4 10             	add    $0x10,%esp
+     b88:	eb 17                	jmp    ba1 <pipe1+0x1e7>
+    printf(1, "fork() failed\n");
+     b8a:	83 ec 08             	sub    $0x8,%esp
+     b8d:	68 b4 54 00 00       	push   $0x54b4
+     b92:	6a 01                	push   $0x1
+     b94:	e8 ac 3e 00 00       	call   4a45 <printf>
+     b99:	83 c4 10             	add    $0x10,%esp
+    exit();
+     b9c:	e8 00 3d 00 00       	call   48a1 <exit>
+}
+     ba1:	c9                   	leave
+     ba2:	c3                   	ret
+
+00000ba3 <preempt>:
+
+// meant to be run w/ at most two CPUs
+void
+preempt(void)
+{
+     ba3:	55                   	push   %ebp
+     ba4:	89 e5                	mov    %esp,%ebp
+     ba6:	83 ec 28             	sub    $0x28,%esp
+  int pid1, pid2, pid3;
+  int pfds[2];
+
+  printf(1, "preempt: ");
+     ba9:	83 ec 08             	sub    $0x8,%esp
+     bac:	68 cd 54 00 00       	push   $0x54cd
+     bb1:	6a 01                	push   $0x1
+     bb3:	e8 8d 3e 00 00       	call   4a45 <printf>
+     bb8:	83 c4 10             	add    $0x10,%esp
+  pid1 = fork();
+     bbb:	e8 d9 3c 00 00       	call   4899 <fork>
+     bc0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(pid1 == 0)
+     bc3:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     bc7:	75 03                	jne    bcc <preempt+0x29>
+    for(;;)
+     bc9:	90                   	nop
+     bca:	eb fd                	jmp    bc9 <preempt+0x26>
+      ;
+
+  pid2 = fork();
+     bcc:	e8 c8 3c 00 00       	call   4899 <fork>
+     bd1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(pid2 == 0)
+     bd4:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     bd8:	75 03                	jne    bdd <preempt+0x3a>
+    for(;;)
+     bda:	90                   	nop
+     bdb:	eb fd                	jmp    bda <preempt+0x37>
+      ;
+
+  pipe(pfds);
+     bdd:	83 ec 0c             	sub    $0xc,%esp
+     be0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     be3:	50                   	push   %eax
+     be4:	e8 c8 3c 00 00       	call   48b1 <pipe>
+     be9:	83 c4 10             	add    $0x10,%esp
+  pid3 = fork();
+     bec:	e8 a8 3c 00 00       	call   4899 <fork>
+     bf1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(pid3 == 0){
+     bf4:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     bf8:	75 4e                	jne    c48 <preempt+0xa5>
+    close(pfds[0]);
+     bfa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     bfd:	83 ec 0c             	sub    $0xc,%esp
+     c00:	50                   	push   %eax
+     c01:	e8 c3 3c 00 00       	call   48c9 <close>
+     c06:	83 c4 10             	add    $0x10,%esp
+    if(write(pfds[1], "x", 1) != 1)
+     c09:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     c0c:	83 ec 04             	sub    $0x4,%esp
+     c0f:	6a 01                	push   $0x1
+     c11:	68 d7 54 00 00       	push   $0x54d7
+     c16:	50                   	push   %eax
+     c17:	e8 a5 3c 00 00       	call   48c1 <write>
+     c1c:	83 c4 10             	add    $0x10,%esp
+     c1f:	83 f8 01             	cmp    $0x1,%eax
+     c22:	74 12                	je     c36 <preempt+0x93>
+      printf(1, "preempt write error");
+     c24:	83 ec 08             	sub    $0x8,%esp
+     c27:	68 d9 54 00 00       	push   $0x54d9
+     c2c:	6a 01                	push   $0x1
+     c2e:	e8 12 3e 00 00       	call   4a45 <printf>
+     c33:	83 c4 10             	add    $0x10,%esp
+    close(pfds[1]);
+     c36:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     c39:	83 ec 0c             	sub    $0xc,%esp
+     c3c:	50                   	push   %eax
+     c3d:	e8 87 3c 00 00       	call   48c9 <close>
+     c42:	83 c4 10             	add    $0x10,%esp
+    for(;;)
+     c45:	90                   	nop
+     c46:	eb fd                	jmp    c45 <preempt+0xa2>
+      ;
+  }
+
+  close(pfds[1]);
+     c48:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     c4b:	83 ec 0c             	sub    $0xc,%esp
+     c4e:	50                   	push   %eax
+     c4f:	e8 75 3c 00 00       	call   48c9 <close>
+     c54:	83 c4 10             	add    $0x10,%esp
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+     c57:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     c5a:	83 ec 04             	sub    $0x4,%esp
+     c5d:	68 00 20 00 00       	push   $0x2000
+     c62:	68 a0 80 00 00       	push   $0x80a0
+     c67:	50                   	push   %eax
+     c68:	e8 4c 3c 00 00       	call   48b9 <read>
+     c6d:	83 c4 10             	add    $0x10,%esp
+     c70:	83 f8 01             	cmp    $0x1,%eax
+     c73:	74 14                	je     c89 <preempt+0xe6>
+    printf(1, "preempt read error");
+     c75:	83 ec 08             	sub    $0x8,%esp
+     c78:	68 ed 54 00 00       	push   $0x54ed
+     c7d:	6a 01                	push   $0x1
+     c7f:	e8 c1 3d 00 00       	call   4a45 <printf>
+     c84:	83 c4 10             	add    $0x10,%esp
+     c87:	eb 7e                	jmp    d07 <preempt+0x164>
+    return;
+  }
+  close(pfds[0]);
+     c89:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     c8c:	83 ec 0c             	sub    $0xc,%esp
+     c8f:	50                   	push   %eax
+     c90:	e8 34 3c 00 00       	call   48c9 <close>
+     c95:	83 c4 10             	add    $0x10,%esp
+  printf(1, "kill... ");
+     c98:	83 ec 08             	sub    $0x8,%esp
+     c9b:	68 00 55 00 00       	push   $0x5500
+     ca0:	6a 01                	push   $0x1
+     ca2:	e8 9e 3d 00 00       	call   4a45 <printf>
+     ca7:	83 c4 10             	add    $0x10,%esp
+  kill(pid1);
+     caa:	83 ec 0c             	sub    $0xc,%esp
+     cad:	ff 75 f4             	push   -0xc(%ebp)
+     cb0:	e8 1c 3c 00 00       	call   48d1 <kill>
+     cb5:	83 c4 10             	add    $0x10,%esp
+  kill(pid2);
+     cb8:	83 ec 0c             	sub    $0xc,%esp
+     cbb:	ff 75 f0             	push   -0x10(%ebp)
+     cbe:	e8 0e 3c 00 00       	call   48d1 <kill>
+     cc3:	83 c4 10             	add    $0x10,%esp
+  kill(pid3);
+     cc6:	83 ec 0c             	sub    $0xc,%esp
+     cc9:	ff 75 ec             	push   -0x14(%ebp)
+     ccc:	e8 00 3c 00 00       	call   48d1 <kill>
+     cd1:	83 c4 10             	add    $0x10,%esp
+  printf(1, "wait... ");
+     cd4:	83 ec 08             	sub    $0x8,%esp
+     cd7:	68 09 55 00 00       	push   $0x5509
+     cdc:	6a 01                	push   $0x1
+     cde:	e8 62 3d 00 00       	call   4a45 <printf>
+     ce3:	83 c4 10             	add    $0x10,%esp
+  wait();
+     ce6:	e8 be 3b 00 00       	call   48a9 <wait>
+  wait();
+     ceb:	e8 b9 3b 00 00       	call   48a9 <wait>
+  wait();
+     cf0:	e8 b4 3b 00 00       	call   48a9 <wait>
+  printf(1, "preempt ok\n");
+     cf5:	83 ec 08             	sub    $0x8,%esp
+     cf8:	68 12 55 00 00       	push   $0x5512
+     cfd:	6a 01                	push   $0x1
+     cff:	e8 41 3d 00 00       	call   4a45 <printf>
+     d04:	83 c4 10             	add    $0x10,%esp
+}
+     d07:	c9                   	leave
+     d08:	c3                   	ret
+
+00000d09 <exitwait>:
+
+// try to find any races between exit and wait
+void
+exitwait(void)
+{
+     d09:	55                   	push   %ebp
+     d0a:	89 e5                	mov    %esp,%ebp
+     d0c:	83 ec 18             	sub    $0x18,%esp
+  int i, pid;
+
+  for(i = 0; i < 100; i++){
+     d0f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     d16:	eb 4f                	jmp    d67 <exitwait+0x5e>
+    pid = fork();
+     d18:	e8 7c 3b 00 00       	call   4899 <fork>
+     d1d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(pid < 0){
+     d20:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     d24:	79 14                	jns    d3a <exitwait+0x31>
+      printf(1, "fork failed\n");
+     d26:	83 ec 08             	sub    $0x8,%esp
+     d29:	68 a1 50 00 00       	push   $0x50a1
+     d2e:	6a 01                	push   $0x1
+     d30:	e8 10 3d 00 00       	call   4a45 <printf>
+     d35:	83 c4 10             	add    $0x10,%esp
+      return;
+     d38:	eb 45                	jmp    d7f <exitwait+0x76>
+    }
+    if(pid){
+     d3a:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     d3e:	74 1e                	je     d5e <exitwait+0x55>
+      if(wait() != pid){
+     d40:	e8 64 3b 00 00       	call   48a9 <wait>
+     d45:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+     d48:	74 19                	je     d63 <exitwait+0x5a>
+        printf(1, "wait wrong pid\n");
+     d4a:	83 ec 08             	sub    $0x8,%esp
+     d4d:	68 1e 55 00 00       	push   $0x551e
+     d52:	6a 01                	push   $0x1
+     d54:	e8 ec 3c 00 00       	call   4a45 <printf>
+     d59:	83 c4 10             	add    $0x10,%esp
+        return;
+     d5c:	eb 21                	jmp    d7f <exitwait+0x76>
+      }
+    } else {
+      exit();
+     d5e:	e8 3e 3b 00 00       	call   48a1 <exit>
+  for(i = 0; i < 100; i++){
+     d63:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     d67:	83 7d f4 63          	cmpl   $0x63,-0xc(%ebp)
+     d6b:	7e ab                	jle    d18 <exitwait+0xf>
+    }
+  }
+  printf(1, "exitwait ok\n");
+     d6d:	83 ec 08             	sub    $0x8,%esp
+     d70:	68 2e 55 00 00       	push   $0x552e
+     d75:	6a 01                	push   $0x1
+     d77:	e8 c9 3c 00 00       	call   4a45 <printf>
+     d7c:	83 c4 10             	add    $0x10,%esp
+}
+     d7f:	c9                   	leave
+     d80:	c3                   	ret
+
+00000d81 <mem>:
+
+void
+mem(void)
+{
+     d81:	55                   	push   %ebp
+     d82:	89 e5                	mov    %esp,%ebp
+     d84:	83 ec 18             	sub    $0x18,%esp
+  void *m1, *m2;
+  int pid, ppid;
+
+  printf(1, "mem test\n");
+     d87:	83 ec 08             	sub    $0x8,%esp
+     d8a:	68 3b 55 00 00       	push   $0x553b
+     d8f:	6a 01                	push   $0x1
+     d91:	e8 af 3c 00 00       	call   4a45 <printf>
+     d96:	83 c4 10             	add    $0x10,%esp
+  ppid = getpid();
+     d99:	e8 83 3b 00 00       	call   4921 <getpid>
+     d9e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((pid = fork()) == 0){
+     da1:	e8 f3 3a 00 00       	call   4899 <fork>
+     da6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     da9:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     dad:	0f 85 b7 00 00 00    	jne    e6a <mem+0xe9>
+    m1 = 0;
+     db3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    while((m2 = malloc(10001)) != 0){
+     dba:	eb 0e                	jmp    dca <mem+0x49>
+      *(char**)m2 = m1;
+     dbc:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     dbf:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     dc2:	89 10                	mov    %edx,(%eax)
+      m1 = m2;
+     dc4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     dc7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    while((m2 = malloc(10001)) != 0){
+     dca:	83 ec 0c             	sub    $0xc,%esp
+     dcd:	68 11 27 00 00       	push   $0x2711
+     dd2:	e8 42 3f 00 00       	call   4d19 <malloc>
+     dd7:	83 c4 10             	add    $0x10,%esp
+     dda:	89 45 e8             	mov    %eax,-0x18(%ebp)
+     ddd:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     de1:	75 d9                	jne    dbc <mem+0x3b>
+    }
+    while(m1){
+     de3:	eb 1c                	jmp    e01 <mem+0x80>
+      m2 = *(char**)m1;
+     de5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     de8:	8b 00                	mov    (%eax),%eax
+     dea:	89 45 e8             	mov    %eax,-0x18(%ebp)
+      free(m1);
+     ded:	83 ec 0c             	sub    $0xc,%esp
+     df0:	ff 75 f4             	push   -0xc(%ebp)
+     df3:	e8 df 3d 00 00       	call   4bd7 <free>
+     df8:	83 c4 10             	add    $0x10,%esp
+      m1 = m2;
+     dfb:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     dfe:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    while(m1){
+     e01:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     e05:	75 de                	jne    de5 <mem+0x64>
+    }
+    m1 = malloc(1024*20);
+     e07:	83 ec 0c             	sub    $0xc,%esp
+     e0a:	68 00 50 00 00       	push   $0x5000
+     e0f:	e8 05 3f 00 00       	call   4d19 <malloc>
+     e14:	83 c4 10             	add    $0x10,%esp
+     e17:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(m1 == 0){
+     e1a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     e1e:	75 25                	jne    e45 <mem+0xc4>
+      printf(1, "couldn't allocate mem?!!\n");
+     e20:	83 ec 08             	sub    $0x8,%esp
+     e23:	68 45 55 00 00       	push   $0x5545
+     e28:	6a 01                	push   $0x1
+     e2a:	e8 16 3c 00 00       	call   4a45 <printf>
+     e2f:	83 c4 10             	add    $0x10,%esp
+      kill(ppid);
+     e32:	83 ec 0c             	sub    $0xc,%esp
+     e35:	ff 75 f0             	push   -0x10(%ebp)
+     e38:	e8 94 3a 00 00       	call   48d1 <kill>
+     e3d:	83 c4 10             	add    $0x10,%esp
+      exit();
+     e40:	e8 5c 3a 00 00       	call   48a1 <exit>
+    }
+    free(m1);
+     e45:	83 ec 0c             	sub    $0xc,%esp
+     e48:	ff 75 f4             	push   -0xc(%ebp)
+     e4b:	e8 87 3d 00 00       	call   4bd7 <free>
+     e50:	83 c4 10             	add    $0x10,%esp
+    printf(1, "mem ok\n");
+     e53:	83 ec 08             	sub    $0x8,%esp
+     e56:	68 5f 55 00 00       	push   $0x555f
+     e5b:	6a 01                	push   $0x1
+     e5d:	e8 e3 3b 00 00       	call   4a45 <printf>
+     e62:	83 c4 10             	add    $0x10,%esp
+    exit();
+     e65:	e8 37 3a 00 00       	call   48a1 <exit>
+  } else {
+    wait();
+     e6a:	e8 3a 3a 00 00       	call   48a9 <wait>
+  }
+}
+     e6f:	90                   	nop
+     e70:	c9                   	leave
+     e71:	c3                   	ret
+
+00000e72 <sharedfd>:
+
+// two processes write to the same file descriptor
+// is the offset shared? does inode locking work?
+void
+sharedfd(void)
+{
+     e72:	55                   	push   %ebp
+     e73:	89 e5                	mov    %esp,%ebp
+     e75:	83 ec 38             	sub    $0x38,%esp
+  int fd, pid, i, n, nc, np;
+  char buf[10];
+
+  printf(1, "sharedfd test\n");
+     e78:	83 ec 08             	sub    $0x8,%esp
+     e7b:	68 67 55 00 00       	push   $0x5567
+     e80:	6a 01                	push   $0x1
+     e82:	e8 be 3b 00 00       	call   4a45 <printf>
+     e87:	83 c4 10             	add    $0x10,%esp
+
+  unlink("sharedfd");
+     e8a:	83 ec 0c             	sub    $0xc,%esp
+     e8d:	68 76 55 00 00       	push   $0x5576
+     e92:	e8 5a 3a 00 00       	call   48f1 <unlink>
+     e97:	83 c4 10             	add    $0x10,%esp
+  fd = open("sharedfd", O_CREATE|O_RDWR);
+     e9a:	83 ec 08             	sub    $0x8,%esp
+     e9d:	68 02 02 00 00       	push   $0x202
+     ea2:	68 76 55 00 00       	push   $0x5576
+     ea7:	e8 35 3a 00 00       	call   48e1 <open>
+     eac:	83 c4 10             	add    $0x10,%esp
+     eaf:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if(fd < 0){
+     eb2:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     eb6:	79 17                	jns    ecf <sharedfd+0x5d>
+    printf(1, "fstests: cannot open sharedfd for writing");
+     eb8:	83 ec 08             	sub    $0x8,%esp
+     ebb:	68 80 55 00 00       	push   $0x5580
+     ec0:	6a 01                	push   $0x1
+     ec2:	e8 7e 3b 00 00       	call   4a45 <printf>
+     ec7:	83 c4 10             	add    $0x10,%esp
+    return;
+     eca:	e9 84 01 00 00       	jmp    1053 <sharedfd+0x1e1>
+  }
+  pid = fork();
+     ecf:	e8 c5 39 00 00       	call   4899 <fork>
+     ed4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     ed7:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+     edb:	75 07                	jne    ee4 <sharedfd+0x72>
+     edd:	b8 63 00 00 00       	mov    $0x63,%eax
+     ee2:	eb 05                	jmp    ee9 <sharedfd+0x77>
+     ee4:	b8 70 00 00 00       	mov    $0x70,%eax
+     ee9:	83 ec 04             	sub    $0x4,%esp
+     eec:	6a 0a                	push   $0xa
+     eee:	50                   	push   %eax
+     eef:	8d 45 d6             	lea    -0x2a(%ebp),%eax
+     ef2:	50                   	push   %eax
+     ef3:	e8 31 37 00 00       	call   4629 <memset>
+     ef8:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 1000; i++){
+     efb:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     f02:	eb 31                	jmp    f35 <sharedfd+0xc3>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+     f04:	83 ec 04             	sub    $0x4,%esp
+     f07:	6a 0a                	push   $0xa
+     f09:	8d 45 d6             	lea    -0x2a(%ebp),%eax
+     f0c:	50                   	push   %eax
+     f0d:	ff 75 e8             	push   -0x18(%ebp)
+     f10:	e8 ac 39 00 00       	call   48c1 <write>
+     f15:	83 c4 10             	add    $0x10,%esp
+     f18:	83 f8 0a             	cmp    $0xa,%eax
+     f1b:	74 14                	je     f31 <sharedfd+0xbf>
+      printf(1, "fstests: write sharedfd failed\n");
+     f1d:	83 ec 08             	sub    $0x8,%esp
+     f20:	68 ac 55 00 00       	push   $0x55ac
+     f25:	6a 01                	push   $0x1
+     f27:	e8 19 3b 00 00       	call   4a45 <printf>
+     f2c:	83 c4 10             	add    $0x10,%esp
+      break;
+     f2f:	eb 0d                	jmp    f3e <sharedfd+0xcc>
+  for(i = 0; i < 1000; i++){
+     f31:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     f35:	81 7d f4 e7 03 00 00 	cmpl   $0x3e7,-0xc(%ebp)
+     f3c:	7e c6                	jle    f04 <sharedfd+0x92>
+    }
+  }
+  if(pid == 0)
+     f3e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+     f42:	75 05                	jne    f49 <sharedfd+0xd7>
+    exit();
+     f44:	e8 58 39 00 00       	call   48a1 <exit>
+  else
+    wait();
+     f49:	e8 5b 39 00 00       	call   48a9 <wait>
+  close(fd);
+     f4e:	83 ec 0c             	sub    $0xc,%esp
+     f51:	ff 75 e8             	push   -0x18(%ebp)
+     f54:	e8 70 39 00 00       	call   48c9 <close>
+     f59:	83 c4 10             	add    $0x10,%esp
+  fd = open("sharedfd", 0);
+     f5c:	83 ec 08             	sub    $0x8,%esp
+     f5f:	6a 00                	push   $0x0
+     f61:	68 76 55 00 00       	push   $0x5576
+     f66:	e8 76 39 00 00       	call   48e1 <open>
+     f6b:	83 c4 10             	add    $0x10,%esp
+     f6e:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if(fd < 0){
+     f71:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     f75:	79 17                	jns    f8e <sharedfd+0x11c>
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+     f77:	83 ec 08             	sub    $0x8,%esp
+     f7a:	68 cc 55 00 00       	push   $0x55cc
+     f7f:	6a 01                	push   $0x1
+     f81:	e8 bf 3a 00 00       	call   4a45 <printf>
+     f86:	83 c4 10             	add    $0x10,%esp
+    return;
+     f89:	e9 c5 00 00 00       	jmp    1053 <sharedfd+0x1e1>
+  }
+  nc = np = 0;
+     f8e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+     f95:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     f98:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+     f9b:	eb 3b                	jmp    fd8 <sharedfd+0x166>
+    for(i = 0; i < sizeof(buf); i++){
+     f9d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     fa4:	eb 2a                	jmp    fd0 <sharedfd+0x15e>
+      if(buf[i] == 'c')
+     fa6:	8d 55 d6             	lea    -0x2a(%ebp),%edx
+     fa9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fac:	01 d0                	add    %edx,%eax
+     fae:	0f b6 00             	movzbl (%eax),%eax
+     fb1:	3c 63                	cmp    $0x63,%al
+     fb3:	75 04                	jne    fb9 <sharedfd+0x147>
+        nc++;
+     fb5:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+      if(buf[i] == 'p')
+     fb9:	8d 55 d6             	lea    -0x2a(%ebp),%edx
+     fbc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fbf:	01 d0                	add    %edx,%eax
+     fc1:	0f b6 00             	movzbl (%eax),%eax
+     fc4:	3c 70                	cmp    $0x70,%al
+     fc6:	75 04                	jne    fcc <sharedfd+0x15a>
+        np++;
+     fc8:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+    for(i = 0; i < sizeof(buf); i++){
+     fcc:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     fd0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fd3:	83 f8 09             	cmp    $0x9,%eax
+     fd6:	76 ce                	jbe    fa6 <sharedfd+0x134>
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+     fd8:	83 ec 04             	sub    $0x4,%esp
+     fdb:	6a 0a                	push   $0xa
+     fdd:	8d 45 d6             	lea    -0x2a(%ebp),%eax
+     fe0:	50                   	push   %eax
+     fe1:	ff 75 e8             	push   -0x18(%ebp)
+     fe4:	e8 d0 38 00 00       	call   48b9 <read>
+     fe9:	83 c4 10             	add    $0x10,%esp
+     fec:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     fef:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+     ff3:	7f a8                	jg     f9d <sharedfd+0x12b>
+    }
+  }
+  close(fd);
+     ff5:	83 ec 0c             	sub    $0xc,%esp
+     ff8:	ff 75 e8             	push   -0x18(%ebp)
+     ffb:	e8 c9 38 00 00       	call   48c9 <close>
+    1000:	83 c4 10             	add    $0x10,%esp
+  unlink("sharedfd");
+    1003:	83 ec 0c             	sub    $0xc,%esp
+    1006:	68 76 55 00 00       	push   $0x5576
+    100b:	e8 e1 38 00 00       	call   48f1 <unlink>
+    1010:	83 c4 10             	add    $0x10,%esp
+  if(nc == 10000 && np == 10000){
+    1013:	81 7d f0 10 27 00 00 	cmpl   $0x2710,-0x10(%ebp)
+    101a:	75 1d                	jne    1039 <sharedfd+0x1c7>
+    101c:	81 7d ec 10 27 00 00 	cmpl   $0x2710,-0x14(%ebp)
+    1023:	75 14                	jne    1039 <sharedfd+0x1c7>
+    printf(1, "sharedfd ok\n");
+    1025:	83 ec 08             	sub    $0x8,%esp
+    1028:	68 f7 55 00 00       	push   $0x55f7
+    102d:	6a 01                	push   $0x1
+    102f:	e8 11 3a 00 00       	call   4a45 <printf>
+    1034:	83 c4 10             	add    $0x10,%esp
+    1037:	eb 1a                	jmp    1053 <sharedfd+0x1e1>
+  } else {
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+    1039:	ff 75 ec             	push   -0x14(%ebp)
+    103c:	ff 75 f0             	push   -0x10(%ebp)
+    103f:	68 04 56 00 00       	push   $0x5604
+    1044:	6a 01                	push   $0x1
+    1046:	e8 fa 39 00 00       	call   4a45 <printf>
+    104b:	83 c4 10             	add    $0x10,%esp
+    exit();
+    104e:	e8 4e 38 00 00       	call   48a1 <exit>
+  }
+}
+    1053:	c9                   	leave
+    1054:	c3                   	ret
+
+00001055 <fourfiles>:
+
+// four processes write different files at the same
+// time, to test block allocation.
+void
+fourfiles(void)
+{
+    1055:	55                   	push   %ebp
+    1056:	89 e5                	mov    %esp,%ebp
+    1058:	83 ec 38             	sub    $0x38,%esp
+  int fd, pid, i, j, n, total, pi;
+  char *names[] = { "f0", "f1", "f2", "f3" };
+    105b:	c7 45 c8 19 56 00 00 	movl   $0x5619,-0x38(%ebp)
+    1062:	c7 45 cc 1c 56 00 00 	movl   $0x561c,-0x34(%ebp)
+    1069:	c7 45 d0 1f 56 00 00 	movl   $0x561f,-0x30(%ebp)
+    1070:	c7 45 d4 22 56 00 00 	movl   $0x5622,-0x2c(%ebp)
+  char *fname;
+
+  printf(1, "fourfiles test\n");
+    1077:	83 ec 08             	sub    $0x8,%esp
+    107a:	68 25 56 00 00       	push   $0x5625
+    107f:	6a 01                	push   $0x1
+    1081:	e8 bf 39 00 00       	call   4a45 <printf>
+    1086:	83 c4 10             	add    $0x10,%esp
+
+  for(pi = 0; pi < 4; pi++){
+    1089:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+    1090:	e9 f0 00 00 00       	jmp    1185 <fourfiles+0x130>
+    fname = names[pi];
+    1095:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1098:	8b 44 85 c8          	mov    -0x38(%ebp,%eax,4),%eax
+    109c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    unlink(fname);
+    109f:	83 ec 0c             	sub    $0xc,%esp
+    10a2:	ff 75 e4             	push   -0x1c(%ebp)
+    10a5:	e8 47 38 00 00       	call   48f1 <unlink>
+    10aa:	83 c4 10             	add    $0x10,%esp
+
+    pid = fork();
+    10ad:	e8 e7 37 00 00       	call   4899 <fork>
+    10b2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+    if(pid < 0){
+    10b5:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+    10b9:	79 17                	jns    10d2 <fourfiles+0x7d>
+      printf(1, "fork failed\n");
+    10bb:	83 ec 08             	sub    $0x8,%esp
+    10be:	68 a1 50 00 00       	push   $0x50a1
+    10c3:	6a 01                	push   $0x1
+    10c5:	e8 7b 39 00 00       	call   4a45 <printf>
+    10ca:	83 c4 10             	add    $0x10,%esp
+      exit();
+    10cd:	e8 cf 37 00 00       	call   48a1 <exit>
+    }
+
+    if(pid == 0){
+    10d2:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+    10d6:	0f 85 a5 00 00 00    	jne    1181 <fourfiles+0x12c>
+      fd = open(fname, O_CREATE | O_RDWR);
+    10dc:	83 ec 08             	sub    $0x8,%esp
+    10df:	68 02 02 00 00       	push   $0x202
+    10e4:	ff 75 e4             	push   -0x1c(%ebp)
+    10e7:	e8 f5 37 00 00       	call   48e1 <open>
+    10ec:	83 c4 10             	add    $0x10,%esp
+    10ef:	89 45 e0             	mov    %eax,-0x20(%ebp)
+      if(fd < 0){
+    10f2:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+    10f6:	79 17                	jns    110f <fourfiles+0xba>
+        printf(1, "create failed\n");
+    10f8:	83 ec 08             	sub    $0x8,%esp
+    10fb:	68 35 56 00 00       	push   $0x5635
+    1100:	6a 01                	push   $0x1
+    1102:	e8 3e 39 00 00       	call   4a45 <printf>
+    1107:	83 c4 10             	add    $0x10,%esp
+        exit();
+    110a:	e8 92 37 00 00       	call   48a1 <exit>
+      }
+
+      memset(buf, '0'+pi, 512);
+    110f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1112:	83 c0 30             	add    $0x30,%eax
+    1115:	83 ec 04             	sub    $0x4,%esp
+    1118:	68 00 02 00 00       	push   $0x200
+    111d:	50                   	push   %eax
+    111e:	68 a0 80 00 00       	push   $0x80a0
+    1123:	e8 01 35 00 00       	call   4629 <memset>
+    1128:	83 c4 10             	add    $0x10,%esp
+      for(i = 0; i < 12; i++){
+    112b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1132:	eb 42                	jmp    1176 <fourfiles+0x121>
+        if((n = write(fd, buf, 500)) != 500){
+    1134:	83 ec 04             	sub    $0x4,%esp
+    1137:	68 f4 01 00 00       	push   $0x1f4
+    113c:	68 a0 80 00 00       	push   $0x80a0
+    1141:	ff 75 e0             	push   -0x20(%ebp)
+    1144:	e8 78 37 00 00       	call   48c1 <write>
+    1149:	83 c4 10             	add    $0x10,%esp
+    114c:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    114f:	81 7d dc f4 01 00 00 	cmpl   $0x1f4,-0x24(%ebp)
+    1156:	74 1a                	je     1172 <fourfiles+0x11d>
+          printf(1, "write failed %d\n", n);
+    1158:	83 ec 04             	sub    $0x4,%esp
+    115b:	ff 75 dc             	push   -0x24(%ebp)
+    115e:	68 44 56 00 00       	push   $0x5644
+    1163:	6a 01                	push   $0x1
+    1165:	e8 db 38 00 00       	call   4a45 <printf>
+    116a:	83 c4 10             	add    $0x10,%esp
+          exit();
+    116d:	e8 2f 37 00 00       	call   48a1 <exit>
+      for(i = 0; i < 12; i++){
+    1172:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1176:	83 7d f4 0b          	cmpl   $0xb,-0xc(%ebp)
+    117a:	7e b8                	jle    1134 <fourfiles+0xdf>
+        }
+      }
+      exit();
+    117c:	e8 20 37 00 00       	call   48a1 <exit>
+  for(pi = 0; pi < 4; pi++){
+    1181:	83 45 e8 01          	addl   $0x1,-0x18(%ebp)
+    1185:	83 7d e8 03          	cmpl   $0x3,-0x18(%ebp)
+    1189:	0f 8e 06 ff ff ff    	jle    1095 <fourfiles+0x40>
+    }
+  }
+
+  for(pi = 0; pi < 4; pi++){
+    118f:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+    1196:	eb 09                	jmp    11a1 <fourfiles+0x14c>
+    wait();
+    1198:	e8 0c 37 00 00       	call   48a9 <wait>
+  for(pi = 0; pi < 4; pi++){
+    119d:	83 45 e8 01          	addl   $0x1,-0x18(%ebp)
+    11a1:	83 7d e8 03          	cmpl   $0x3,-0x18(%ebp)
+    11a5:	7e f1                	jle    1198 <fourfiles+0x143>
+  }
+
+  for(i = 0; i < 2; i++){
+    11a7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    11ae:	e9 d4 00 00 00       	jmp    1287 <fourfiles+0x232>
+    fname = names[i];
+    11b3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    11b6:	8b 44 85 c8          	mov    -0x38(%ebp,%eax,4),%eax
+    11ba:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    fd = open(fname, 0);
+    11bd:	83 ec 08             	sub    $0x8,%esp
+    11c0:	6a 00                	push   $0x0
+    11c2:	ff 75 e4             	push   -0x1c(%ebp)
+    11c5:	e8 17 37 00 00       	call   48e1 <open>
+    11ca:	83 c4 10             	add    $0x10,%esp
+    11cd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    total = 0;
+    11d0:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    11d7:	eb 4a                	jmp    1223 <fourfiles+0x1ce>
+      for(j = 0; j < n; j++){
+    11d9:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    11e0:	eb 33                	jmp    1215 <fourfiles+0x1c0>
+        if(buf[j] != '0'+i){
+    11e2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    11e5:	05 a0 80 00 00       	add    $0x80a0,%eax
+    11ea:	0f b6 00             	movzbl (%eax),%eax
+    11ed:	0f be d0             	movsbl %al,%edx
+    11f0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    11f3:	83 c0 30             	add    $0x30,%eax
+    11f6:	39 c2                	cmp    %eax,%edx
+    11f8:	74 17                	je     1211 <fourfiles+0x1bc>
+          printf(1, "wrong char\n");
+    11fa:	83 ec 08             	sub    $0x8,%esp
+    11fd:	68 55 56 00 00       	push   $0x5655
+    1202:	6a 01                	push   $0x1
+    1204:	e8 3c 38 00 00       	call   4a45 <printf>
+    1209:	83 c4 10             	add    $0x10,%esp
+          exit();
+    120c:	e8 90 36 00 00       	call   48a1 <exit>
+      for(j = 0; j < n; j++){
+    1211:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    1215:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1218:	3b 45 dc             	cmp    -0x24(%ebp),%eax
+    121b:	7c c5                	jl     11e2 <fourfiles+0x18d>
+        }
+      }
+      total += n;
+    121d:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    1220:	01 45 ec             	add    %eax,-0x14(%ebp)
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    1223:	83 ec 04             	sub    $0x4,%esp
+    1226:	68 00 20 00 00       	push   $0x2000
+    122b:	68 a0 80 00 00       	push   $0x80a0
+    1230:	ff 75 e0             	push   -0x20(%ebp)
+    1233:	e8 81 36 00 00       	call   48b9 <read>
+    1238:	83 c4 10             	add    $0x10,%esp
+    123b:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    123e:	83 7d dc 00          	cmpl   $0x0,-0x24(%ebp)
+    1242:	7f 95                	jg     11d9 <fourfiles+0x184>
+    }
+    close(fd);
+    1244:	83 ec 0c             	sub    $0xc,%esp
+    1247:	ff 75 e0             	push   -0x20(%ebp)
+    124a:	e8 7a 36 00 00       	call   48c9 <close>
+    124f:	83 c4 10             	add    $0x10,%esp
+    if(total != 12*500){
+    1252:	81 7d ec 70 17 00 00 	cmpl   $0x1770,-0x14(%ebp)
+    1259:	74 1a                	je     1275 <fourfiles+0x220>
+      printf(1, "wrong length %d\n", total);
+    125b:	83 ec 04             	sub    $0x4,%esp
+    125e:	ff 75 ec             	push   -0x14(%ebp)
+    1261:	68 61 56 00 00       	push   $0x5661
+    1266:	6a 01                	push   $0x1
+    1268:	e8 d8 37 00 00       	call   4a45 <printf>
+    126d:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1270:	e8 2c 36 00 00       	call   48a1 <exit>
+    }
+    unlink(fname);
+    1275:	83 ec 0c             	sub    $0xc,%esp
+    1278:	ff 75 e4             	push   -0x1c(%ebp)
+    127b:	e8 71 36 00 00       	call   48f1 <unlink>
+    1280:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 2; i++){
+    1283:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1287:	83 7d f4 01          	cmpl   $0x1,-0xc(%ebp)
+    128b:	0f 8e 22 ff ff ff    	jle    11b3 <fourfiles+0x15e>
+  }
+
+  printf(1, "fourfiles ok\n");
+    1291:	83 ec 08             	sub    $0x8,%esp
+    1294:	68 72 56 00 00       	push   $0x5672
+    1299:	6a 01                	push   $0x1
+    129b:	e8 a5 37 00 00       	call   4a45 <printf>
+    12a0:	83 c4 10             	add    $0x10,%esp
+}
+    12a3:	90                   	nop
+    12a4:	c9                   	leave
+    12a5:	c3                   	ret
+
+000012a6 <createdelete>:
+
+// four processes create and delete different files in same directory
+void
+createdelete(void)
+{
+    12a6:	55                   	push   %ebp
+    12a7:	89 e5                	mov    %esp,%ebp
+    12a9:	83 ec 38             	sub    $0x38,%esp
+  enum { N = 20 };
+  int pid, i, fd, pi;
+  char name[32];
+
+  printf(1, "createdelete test\n");
+    12ac:	83 ec 08             	sub    $0x8,%esp
+    12af:	68 80 56 00 00       	push   $0x5680
+    12b4:	6a 01                	push   $0x1
+    12b6:	e8 8a 37 00 00       	call   4a45 <printf>
+    12bb:	83 c4 10             	add    $0x10,%esp
+
+  for(pi = 0; pi < 4; pi++){
+    12be:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    12c5:	e9 f6 00 00 00       	jmp    13c0 <createdelete+0x11a>
+    pid = fork();
+    12ca:	e8 ca 35 00 00       	call   4899 <fork>
+    12cf:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(pid < 0){
+    12d2:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    12d6:	79 17                	jns    12ef <createdelete+0x49>
+      printf(1, "fork failed\n");
+    12d8:	83 ec 08             	sub    $0x8,%esp
+    12db:	68 a1 50 00 00       	push   $0x50a1
+    12e0:	6a 01                	push   $0x1
+    12e2:	e8 5e 37 00 00       	call   4a45 <printf>
+    12e7:	83 c4 10             	add    $0x10,%esp
+      exit();
+    12ea:	e8 b2 35 00 00       	call   48a1 <exit>
+    }
+
+    if(pid == 0){
+    12ef:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    12f3:	0f 85 c3 00 00 00    	jne    13bc <createdelete+0x116>
+      name[0] = 'p' + pi;
+    12f9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    12fc:	83 c0 70             	add    $0x70,%eax
+    12ff:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[2] = '\0';
+    1302:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+      for(i = 0; i < N; i++){
+    1306:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    130d:	e9 9b 00 00 00       	jmp    13ad <createdelete+0x107>
+        name[1] = '0' + i;
+    1312:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1315:	83 c0 30             	add    $0x30,%eax
+    1318:	88 45 c9             	mov    %al,-0x37(%ebp)
+        fd = open(name, O_CREATE | O_RDWR);
+    131b:	83 ec 08             	sub    $0x8,%esp
+    131e:	68 02 02 00 00       	push   $0x202
+    1323:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    1326:	50                   	push   %eax
+    1327:	e8 b5 35 00 00       	call   48e1 <open>
+    132c:	83 c4 10             	add    $0x10,%esp
+    132f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+        if(fd < 0){
+    1332:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1336:	79 17                	jns    134f <createdelete+0xa9>
+          printf(1, "create failed\n");
+    1338:	83 ec 08             	sub    $0x8,%esp
+    133b:	68 35 56 00 00       	push   $0x5635
+    1340:	6a 01                	push   $0x1
+    1342:	e8 fe 36 00 00       	call   4a45 <printf>
+    1347:	83 c4 10             	add    $0x10,%esp
+          exit();
+    134a:	e8 52 35 00 00       	call   48a1 <exit>
+        }
+        close(fd);
+    134f:	83 ec 0c             	sub    $0xc,%esp
+    1352:	ff 75 ec             	push   -0x14(%ebp)
+    1355:	e8 6f 35 00 00       	call   48c9 <close>
+    135a:	83 c4 10             	add    $0x10,%esp
+        if(i > 0 && (i % 2 ) == 0){
+    135d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1361:	7e 46                	jle    13a9 <createdelete+0x103>
+    1363:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1366:	83 e0 01             	and    $0x1,%eax
+    1369:	85 c0                	test   %eax,%eax
+    136b:	75 3c                	jne    13a9 <createdelete+0x103>
+          name[1] = '0' + (i / 2);
+    136d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1370:	89 c2                	mov    %eax,%edx
+    1372:	c1 ea 1f             	shr    $0x1f,%edx
+    1375:	01 d0                	add    %edx,%eax
+    1377:	d1 f8                	sar    %eax
+    1379:	83 c0 30             	add    $0x30,%eax
+    137c:	88 45 c9             	mov    %al,-0x37(%ebp)
+          if(unlink(name) < 0){
+    137f:	83 ec 0c             	sub    $0xc,%esp
+    1382:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    1385:	50                   	push   %eax
+    1386:	e8 66 35 00 00       	call   48f1 <unlink>
+    138b:	83 c4 10             	add    $0x10,%esp
+    138e:	85 c0                	test   %eax,%eax
+    1390:	79 17                	jns    13a9 <createdelete+0x103>
+            printf(1, "unlink failed\n");
+    1392:	83 ec 08             	sub    $0x8,%esp
+    1395:	68 24 51 00 00       	push   $0x5124
+    139a:	6a 01                	push   $0x1
+    139c:	e8 a4 36 00 00       	call   4a45 <printf>
+    13a1:	83 c4 10             	add    $0x10,%esp
+            exit();
+    13a4:	e8 f8 34 00 00       	call   48a1 <exit>
+      for(i = 0; i < N; i++){
+    13a9:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    13ad:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+    13b1:	0f 8e 5b ff ff ff    	jle    1312 <createdelete+0x6c>
+          }
+        }
+      }
+      exit();
+    13b7:	e8 e5 34 00 00       	call   48a1 <exit>
+  for(pi = 0; pi < 4; pi++){
+    13bc:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    13c0:	83 7d f0 03          	cmpl   $0x3,-0x10(%ebp)
+    13c4:	0f 8e 00 ff ff ff    	jle    12ca <createdelete+0x24>
+    }
+  }
+
+  for(pi = 0; pi < 4; pi++){
+    13ca:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    13d1:	eb 09                	jmp    13dc <createdelete+0x136>
+    wait();
+    13d3:	e8 d1 34 00 00       	call   48a9 <wait>
+  for(pi = 0; pi < 4; pi++){
+    13d8:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    13dc:	83 7d f0 03          	cmpl   $0x3,-0x10(%ebp)
+    13e0:	7e f1                	jle    13d3 <createdelete+0x12d>
+  }
+
+  name[0] = name[1] = name[2] = 0;
+    13e2:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+    13e6:	0f b6 45 ca          	movzbl -0x36(%ebp),%eax
+    13ea:	88 45 c9             	mov    %al,-0x37(%ebp)
+    13ed:	0f b6 45 c9          	movzbl -0x37(%ebp),%eax
+    13f1:	88 45 c8             	mov    %al,-0x38(%ebp)
+  for(i = 0; i < N; i++){
+    13f4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    13fb:	e9 b2 00 00 00       	jmp    14b2 <createdelete+0x20c>
+    for(pi = 0; pi < 4; pi++){
+    1400:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    1407:	e9 98 00 00 00       	jmp    14a4 <createdelete+0x1fe>
+      name[0] = 'p' + pi;
+    140c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    140f:	83 c0 70             	add    $0x70,%eax
+    1412:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[1] = '0' + i;
+    1415:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1418:	83 c0 30             	add    $0x30,%eax
+    141b:	88 45 c9             	mov    %al,-0x37(%ebp)
+      fd = open(name, 0);
+    141e:	83 ec 08             	sub    $0x8,%esp
+    1421:	6a 00                	push   $0x0
+    1423:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    1426:	50                   	push   %eax
+    1427:	e8 b5 34 00 00       	call   48e1 <open>
+    142c:	83 c4 10             	add    $0x10,%esp
+    142f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      if((i == 0 || i >= N/2) && fd < 0){
+    1432:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1436:	74 06                	je     143e <createdelete+0x198>
+    1438:	83 7d f4 09          	cmpl   $0x9,-0xc(%ebp)
+    143c:	7e 21                	jle    145f <createdelete+0x1b9>
+    143e:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1442:	79 1b                	jns    145f <createdelete+0x1b9>
+        printf(1, "oops createdelete %s didn't exist\n", name);
+    1444:	83 ec 04             	sub    $0x4,%esp
+    1447:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    144a:	50                   	push   %eax
+    144b:	68 94 56 00 00       	push   $0x5694
+    1450:	6a 01                	push   $0x1
+    1452:	e8 ee 35 00 00       	call   4a45 <printf>
+    1457:	83 c4 10             	add    $0x10,%esp
+        exit();
+    145a:	e8 42 34 00 00       	call   48a1 <exit>
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    145f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1463:	7e 27                	jle    148c <createdelete+0x1e6>
+    1465:	83 7d f4 09          	cmpl   $0x9,-0xc(%ebp)
+    1469:	7f 21                	jg     148c <createdelete+0x1e6>
+    146b:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    146f:	78 1b                	js     148c <createdelete+0x1e6>
+        printf(1, "oops createdelete %s did exist\n", name);
+    1471:	83 ec 04             	sub    $0x4,%esp
+    1474:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    1477:	50                   	push   %eax
+    1478:	68 b8 56 00 00       	push   $0x56b8
+    147d:	6a 01                	push   $0x1
+    147f:	e8 c1 35 00 00       	call   4a45 <printf>
+    1484:	83 c4 10             	add    $0x10,%esp
+        exit();
+    1487:	e8 15 34 00 00       	call   48a1 <exit>
+      }
+      if(fd >= 0)
+    148c:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1490:	78 0e                	js     14a0 <createdelete+0x1fa>
+        close(fd);
+    1492:	83 ec 0c             	sub    $0xc,%esp
+    1495:	ff 75 ec             	push   -0x14(%ebp)
+    1498:	e8 2c 34 00 00       	call   48c9 <close>
+    149d:	83 c4 10             	add    $0x10,%esp
+    for(pi = 0; pi < 4; pi++){
+    14a0:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    14a4:	83 7d f0 03          	cmpl   $0x3,-0x10(%ebp)
+    14a8:	0f 8e 5e ff ff ff    	jle    140c <createdelete+0x166>
+  for(i = 0; i < N; i++){
+    14ae:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    14b2:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+    14b6:	0f 8e 44 ff ff ff    	jle    1400 <createdelete+0x15a>
+    }
+  }
+
+  for(i = 0; i < N; i++){
+    14bc:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    14c3:	eb 38                	jmp    14fd <createdelete+0x257>
+    for(pi = 0; pi < 4; pi++){
+    14c5:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    14cc:	eb 25                	jmp    14f3 <createdelete+0x24d>
+      name[0] = 'p' + i;
+    14ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    14d1:	83 c0 70             	add    $0x70,%eax
+    14d4:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[1] = '0' + i;
+    14d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    14da:	83 c0 30             	add    $0x30,%eax
+    14dd:	88 45 c9             	mov    %al,-0x37(%ebp)
+      unlink(name);
+    14e0:	83 ec 0c             	sub    $0xc,%esp
+    14e3:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    14e6:	50                   	push   %eax
+    14e7:	e8 05 34 00 00       	call   48f1 <unlink>
+    14ec:	83 c4 10             	add    $0x10,%esp
+    for(pi = 0; pi < 4; pi++){
+    14ef:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    14f3:	83 7d f0 03          	cmpl   $0x3,-0x10(%ebp)
+    14f7:	7e d5                	jle    14ce <createdelete+0x228>
+  for(i = 0; i < N; i++){
+    14f9:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    14fd:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+    1501:	7e c2                	jle    14c5 <createdelete+0x21f>
+    }
+  }
+
+  printf(1, "createdelete ok\n");
+    1503:	83 ec 08             	sub    $0x8,%esp
+    1506:	68 d8 56 00 00       	push   $0x56d8
+    150b:	6a 01                	push   $0x1
+    150d:	e8 33 35 00 00       	call   4a45 <printf>
+    1512:	83 c4 10             	add    $0x10,%esp
+}
+    1515:	90                   	nop
+    1516:	c9                   	leave
+    1517:	c3                   	ret
+
+00001518 <unlinkread>:
+
+// can I unlink a file and still read it?
+void
+unlinkread(void)
+{
+    1518:	55                   	push   %ebp
+    1519:	89 e5                	mov    %esp,%ebp
+    151b:	83 ec 18             	sub    $0x18,%esp
+  int fd, fd1;
+
+  printf(1, "unlinkread test\n");
+    151e:	83 ec 08             	sub    $0x8,%esp
+    1521:	68 e9 56 00 00       	push   $0x56e9
+    1526:	6a 01                	push   $0x1
+    1528:	e8 18 35 00 00       	call   4a45 <printf>
+    152d:	83 c4 10             	add    $0x10,%esp
+  fd = open("unlinkread", O_CREATE | O_RDWR);
+    1530:	83 ec 08             	sub    $0x8,%esp
+    1533:	68 02 02 00 00       	push   $0x202
+    1538:	68 fa 56 00 00       	push   $0x56fa
+    153d:	e8 9f 33 00 00       	call   48e1 <open>
+    1542:	83 c4 10             	add    $0x10,%esp
+    1545:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    1548:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    154c:	79 17                	jns    1565 <unlinkread+0x4d>
+    printf(1, "create unlinkread failed\n");
+    154e:	83 ec 08             	sub    $0x8,%esp
+    1551:	68 05 57 00 00       	push   $0x5705
+    1556:	6a 01                	push   $0x1
+    1558:	e8 e8 34 00 00       	call   4a45 <printf>
+    155d:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1560:	e8 3c 33 00 00       	call   48a1 <exit>
+  }
+  write(fd, "hello", 5);
+    1565:	83 ec 04             	sub    $0x4,%esp
+    1568:	6a 05                	push   $0x5
+    156a:	68 1f 57 00 00       	push   $0x571f
+    156f:	ff 75 f4             	push   -0xc(%ebp)
+    1572:	e8 4a 33 00 00       	call   48c1 <write>
+    1577:	83 c4 10             	add    $0x10,%esp
+  close(fd);
+    157a:	83 ec 0c             	sub    $0xc,%esp
+    157d:	ff 75 f4             	push   -0xc(%ebp)
+    1580:	e8 44 33 00 00       	call   48c9 <close>
+    1585:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("unlinkread", O_RDWR);
+    1588:	83 ec 08             	sub    $0x8,%esp
+    158b:	6a 02                	push   $0x2
+    158d:	68 fa 56 00 00       	push   $0x56fa
+    1592:	e8 4a 33 00 00       	call   48e1 <open>
+    1597:	83 c4 10             	add    $0x10,%esp
+    159a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    159d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    15a1:	79 17                	jns    15ba <unlinkread+0xa2>
+    printf(1, "open unlinkread failed\n");
+    15a3:	83 ec 08             	sub    $0x8,%esp
+    15a6:	68 25 57 00 00       	push   $0x5725
+    15ab:	6a 01                	push   $0x1
+    15ad:	e8 93 34 00 00       	call   4a45 <printf>
+    15b2:	83 c4 10             	add    $0x10,%esp
+    exit();
+    15b5:	e8 e7 32 00 00       	call   48a1 <exit>
+  }
+  if(unlink("unlinkread") != 0){
+    15ba:	83 ec 0c             	sub    $0xc,%esp
+    15bd:	68 fa 56 00 00       	push   $0x56fa
+    15c2:	e8 2a 33 00 00       	call   48f1 <unlink>
+    15c7:	83 c4 10             	add    $0x10,%esp
+    15ca:	85 c0                	test   %eax,%eax
+    15cc:	74 17                	je     15e5 <unlinkread+0xcd>
+    printf(1, "unlink unlinkread failed\n");
+    15ce:	83 ec 08             	sub    $0x8,%esp
+    15d1:	68 3d 57 00 00       	push   $0x573d
+    15d6:	6a 01                	push   $0x1
+    15d8:	e8 68 34 00 00       	call   4a45 <printf>
+    15dd:	83 c4 10             	add    $0x10,%esp
+    exit();
+    15e0:	e8 bc 32 00 00       	call   48a1 <exit>
+  }
+
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    15e5:	83 ec 08             	sub    $0x8,%esp
+    15e8:	68 02 02 00 00       	push   $0x202
+    15ed:	68 fa 56 00 00       	push   $0x56fa
+    15f2:	e8 ea 32 00 00       	call   48e1 <open>
+    15f7:	83 c4 10             	add    $0x10,%esp
+    15fa:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  write(fd1, "yyy", 3);
+    15fd:	83 ec 04             	sub    $0x4,%esp
+    1600:	6a 03                	push   $0x3
+    1602:	68 57 57 00 00       	push   $0x5757
+    1607:	ff 75 f0             	push   -0x10(%ebp)
+    160a:	e8 b2 32 00 00       	call   48c1 <write>
+    160f:	83 c4 10             	add    $0x10,%esp
+  close(fd1);
+    1612:	83 ec 0c             	sub    $0xc,%esp
+    1615:	ff 75 f0             	push   -0x10(%ebp)
+    1618:	e8 ac 32 00 00       	call   48c9 <close>
+    161d:	83 c4 10             	add    $0x10,%esp
+
+  if(read(fd, buf, sizeof(buf)) != 5){
+    1620:	83 ec 04             	sub    $0x4,%esp
+    1623:	68 00 20 00 00       	push   $0x2000
+    1628:	68 a0 80 00 00       	push   $0x80a0
+    162d:	ff 75 f4             	push   -0xc(%ebp)
+    1630:	e8 84 32 00 00       	call   48b9 <read>
+    1635:	83 c4 10             	add    $0x10,%esp
+    1638:	83 f8 05             	cmp    $0x5,%eax
+    163b:	74 17                	je     1654 <unlinkread+0x13c>
+    printf(1, "unlinkread read failed");
+    163d:	83 ec 08             	sub    $0x8,%esp
+    1640:	68 5b 57 00 00       	push   $0x575b
+    1645:	6a 01                	push   $0x1
+    1647:	e8 f9 33 00 00       	call   4a45 <printf>
+    164c:	83 c4 10             	add    $0x10,%esp
+    exit();
+    164f:	e8 4d 32 00 00       	call   48a1 <exit>
+  }
+  if(buf[0] != 'h'){
+    1654:	0f b6 05 a0 80 00 00 	movzbl 0x80a0,%eax
+    165b:	3c 68                	cmp    $0x68,%al
+    165d:	74 17                	je     1676 <unlinkread+0x15e>
+    printf(1, "unlinkread wrong data\n");
+    165f:	83 ec 08             	sub    $0x8,%esp
+    1662:	68 72 57 00 00       	push   $0x5772
+    1667:	6a 01                	push   $0x1
+    1669:	e8 d7 33 00 00       	call   4a45 <printf>
+    166e:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1671:	e8 2b 32 00 00       	call   48a1 <exit>
+  }
+  if(write(fd, buf, 10) != 10){
+    1676:	83 ec 04             	sub    $0x4,%esp
+    1679:	6a 0a                	push   $0xa
+    167b:	68 a0 80 00 00       	push   $0x80a0
+    1680:	ff 75 f4             	push   -0xc(%ebp)
+    1683:	e8 39 32 00 00       	call   48c1 <write>
+    1688:	83 c4 10             	add    $0x10,%esp
+    168b:	83 f8 0a             	cmp    $0xa,%eax
+    168e:	74 17                	je     16a7 <unlinkread+0x18f>
+    printf(1, "unlinkread write failed\n");
+    1690:	83 ec 08             	sub    $0x8,%esp
+    1693:	68 89 57 00 00       	push   $0x5789
+    1698:	6a 01                	push   $0x1
+    169a:	e8 a6 33 00 00       	call   4a45 <printf>
+    169f:	83 c4 10             	add    $0x10,%esp
+    exit();
+    16a2:	e8 fa 31 00 00       	call   48a1 <exit>
+  }
+  close(fd);
+    16a7:	83 ec 0c             	sub    $0xc,%esp
+    16aa:	ff 75 f4             	push   -0xc(%ebp)
+    16ad:	e8 17 32 00 00       	call   48c9 <close>
+    16b2:	83 c4 10             	add    $0x10,%esp
+  unlink("unlinkread");
+    16b5:	83 ec 0c             	sub    $0xc,%esp
+    16b8:	68 fa 56 00 00       	push   $0x56fa
+    16bd:	e8 2f 32 00 00       	call   48f1 <unlink>
+    16c2:	83 c4 10             	add    $0x10,%esp
+  printf(1, "unlinkread ok\n");
+    16c5:	83 ec 08             	sub    $0x8,%esp
+    16c8:	68 a2 57 00 00       	push   $0x57a2
+    16cd:	6a 01                	push   $0x1
+    16cf:	e8 71 33 00 00       	call   4a45 <printf>
+    16d4:	83 c4 10             	add    $0x10,%esp
+}
+    16d7:	90                   	nop
+    16d8:	c9                   	leave
+    16d9:	c3                   	ret
+
+000016da <linktest>:
+
+void
+linktest(void)
+{
+    16da:	55                   	push   %ebp
+    16db:	89 e5                	mov    %esp,%ebp
+    16dd:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  printf(1, "linktest\n");
+    16e0:	83 ec 08             	sub    $0x8,%esp
+    16e3:	68 b1 57 00 00       	push   $0x57b1
+    16e8:	6a 01                	push   $0x1
+    16ea:	e8 56 33 00 00       	call   4a45 <printf>
+    16ef:	83 c4 10             	add    $0x10,%esp
+
+  unlink("lf1");
+    16f2:	83 ec 0c             	sub    $0xc,%esp
+    16f5:	68 bb 57 00 00       	push   $0x57bb
+    16fa:	e8 f2 31 00 00       	call   48f1 <unlink>
+    16ff:	83 c4 10             	add    $0x10,%esp
+  unlink("lf2");
+    1702:	83 ec 0c             	sub    $0xc,%esp
+    1705:	68 bf 57 00 00       	push   $0x57bf
+    170a:	e8 e2 31 00 00       	call   48f1 <unlink>
+    170f:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("lf1", O_CREATE|O_RDWR);
+    1712:	83 ec 08             	sub    $0x8,%esp
+    1715:	68 02 02 00 00       	push   $0x202
+    171a:	68 bb 57 00 00       	push   $0x57bb
+    171f:	e8 bd 31 00 00       	call   48e1 <open>
+    1724:	83 c4 10             	add    $0x10,%esp
+    1727:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    172a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    172e:	79 17                	jns    1747 <linktest+0x6d>
+    printf(1, "create lf1 failed\n");
+    1730:	83 ec 08             	sub    $0x8,%esp
+    1733:	68 c3 57 00 00       	push   $0x57c3
+    1738:	6a 01                	push   $0x1
+    173a:	e8 06 33 00 00       	call   4a45 <printf>
+    173f:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1742:	e8 5a 31 00 00       	call   48a1 <exit>
+  }
+  if(write(fd, "hello", 5) != 5){
+    1747:	83 ec 04             	sub    $0x4,%esp
+    174a:	6a 05                	push   $0x5
+    174c:	68 1f 57 00 00       	push   $0x571f
+    1751:	ff 75 f4             	push   -0xc(%ebp)
+    1754:	e8 68 31 00 00       	call   48c1 <write>
+    1759:	83 c4 10             	add    $0x10,%esp
+    175c:	83 f8 05             	cmp    $0x5,%eax
+    175f:	74 17                	je     1778 <linktest+0x9e>
+    printf(1, "write lf1 failed\n");
+    1761:	83 ec 08             	sub    $0x8,%esp
+    1764:	68 d6 57 00 00       	push   $0x57d6
+    1769:	6a 01                	push   $0x1
+    176b:	e8 d5 32 00 00       	call   4a45 <printf>
+    1770:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1773:	e8 29 31 00 00       	call   48a1 <exit>
+  }
+  close(fd);
+    1778:	83 ec 0c             	sub    $0xc,%esp
+    177b:	ff 75 f4             	push   -0xc(%ebp)
+    177e:	e8 46 31 00 00       	call   48c9 <close>
+    1783:	83 c4 10             	add    $0x10,%esp
+
+  if(link("lf1", "lf2") < 0){
+    1786:	83 ec 08             	sub    $0x8,%esp
+    1789:	68 bf 57 00 00       	push   $0x57bf
+    178e:	68 bb 57 00 00       	push   $0x57bb
+    1793:	e8 69 31 00 00       	call   4901 <link>
+    1798:	83 c4 10             	add    $0x10,%esp
+    179b:	85 c0                	test   %eax,%eax
+    179d:	79 17                	jns    17b6 <linktest+0xdc>
+    printf(1, "link lf1 lf2 failed\n");
+    179f:	83 ec 08             	sub    $0x8,%esp
+    17a2:	68 e8 57 00 00       	push   $0x57e8
+    17a7:	6a 01                	push   $0x1
+    17a9:	e8 97 32 00 00       	call   4a45 <printf>
+    17ae:	83 c4 10             	add    $0x10,%esp
+    exit();
+    17b1:	e8 eb 30 00 00       	call   48a1 <exit>
+  }
+  unlink("lf1");
+    17b6:	83 ec 0c             	sub    $0xc,%esp
+    17b9:	68 bb 57 00 00       	push   $0x57bb
+    17be:	e8 2e 31 00 00       	call   48f1 <unlink>
+    17c3:	83 c4 10             	add    $0x10,%esp
+
+  if(open("lf1", 0) >= 0){
+    17c6:	83 ec 08             	sub    $0x8,%esp
+    17c9:	6a 00                	push   $0x0
+    17cb:	68 bb 57 00 00       	push   $0x57bb
+    17d0:	e8 0c 31 00 00       	call   48e1 <open>
+    17d5:	83 c4 10             	add    $0x10,%esp
+    17d8:	85 c0                	test   %eax,%eax
+    17da:	78 17                	js     17f3 <linktest+0x119>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    17dc:	83 ec 08             	sub    $0x8,%esp
+    17df:	68 00 58 00 00       	push   $0x5800
+    17e4:	6a 01                	push   $0x1
+    17e6:	e8 5a 32 00 00       	call   4a45 <printf>
+    17eb:	83 c4 10             	add    $0x10,%esp
+    exit();
+    17ee:	e8 ae 30 00 00       	call   48a1 <exit>
+  }
+
+  fd = open("lf2", 0);
+    17f3:	83 ec 08             	sub    $0x8,%esp
+    17f6:	6a 00                	push   $0x0
+    17f8:	68 bf 57 00 00       	push   $0x57bf
+    17fd:	e8 df 30 00 00       	call   48e1 <open>
+    1802:	83 c4 10             	add    $0x10,%esp
+    1805:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    1808:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    180c:	79 17                	jns    1825 <linktest+0x14b>
+    printf(1, "open lf2 failed\n");
+    180e:	83 ec 08             	sub    $0x8,%esp
+    1811:	68 25 58 00 00       	push   $0x5825
+    1816:	6a 01                	push   $0x1
+    1818:	e8 28 32 00 00       	call   4a45 <printf>
+    181d:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1820:	e8 7c 30 00 00       	call   48a1 <exit>
+  }
+  if(read(fd, buf, sizeof(buf)) != 5){
+    1825:	83 ec 04             	sub    $0x4,%esp
+    1828:	68 00 20 00 00       	push   $0x2000
+    182d:	68 a0 80 00 00       	push   $0x80a0
+    1832:	ff 75 f4             	push   -0xc(%ebp)
+    1835:	e8 7f 30 00 00       	call   48b9 <read>
+    183a:	83 c4 10             	add    $0x10,%esp
+    183d:	83 f8 05             	cmp    $0x5,%eax
+    1840:	74 17                	je     1859 <linktest+0x17f>
+    printf(1, "read lf2 failed\n");
+    1842:	83 ec 08             	sub    $0x8,%esp
+    1845:	68 36 58 00 00       	push   $0x5836
+    184a:	6a 01                	push   $0x1
+    184c:	e8 f4 31 00 00       	call   4a45 <printf>
+    1851:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1854:	e8 48 30 00 00       	call   48a1 <exit>
+  }
+  close(fd);
+    1859:	83 ec 0c             	sub    $0xc,%esp
+    185c:	ff 75 f4             	push   -0xc(%ebp)
+    185f:	e8 65 30 00 00       	call   48c9 <close>
+    1864:	83 c4 10             	add    $0x10,%esp
+
+  if(link("lf2", "lf2") >= 0){
+    1867:	83 ec 08             	sub    $0x8,%esp
+    186a:	68 bf 57 00 00       	push   $0x57bf
+    186f:	68 bf 57 00 00       	push   $0x57bf
+    1874:	e8 88 30 00 00       	call   4901 <link>
+    1879:	83 c4 10             	add    $0x10,%esp
+    187c:	85 c0                	test   %eax,%eax
+    187e:	78 17                	js     1897 <linktest+0x1bd>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    1880:	83 ec 08             	sub    $0x8,%esp
+    1883:	68 47 58 00 00       	push   $0x5847
+    1888:	6a 01                	push   $0x1
+    188a:	e8 b6 31 00 00       	call   4a45 <printf>
+    188f:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1892:	e8 0a 30 00 00       	call   48a1 <exit>
+  }
+
+  unlink("lf2");
+    1897:	83 ec 0c             	sub    $0xc,%esp
+    189a:	68 bf 57 00 00       	push   $0x57bf
+    189f:	e8 4d 30 00 00       	call   48f1 <unlink>
+    18a4:	83 c4 10             	add    $0x10,%esp
+  if(link("lf2", "lf1") >= 0){
+    18a7:	83 ec 08             	sub    $0x8,%esp
+    18aa:	68 bb 57 00 00       	push   $0x57bb
+    18af:	68 bf 57 00 00       	push   $0x57bf
+    18b4:	e8 48 30 00 00       	call   4901 <link>
+    18b9:	83 c4 10             	add    $0x10,%esp
+    18bc:	85 c0                	test   %eax,%eax
+    18be:	78 17                	js     18d7 <linktest+0x1fd>
+    printf(1, "link non-existant succeeded! oops\n");
+    18c0:	83 ec 08             	sub    $0x8,%esp
+    18c3:	68 68 58 00 00       	push   $0x5868
+    18c8:	6a 01                	push   $0x1
+    18ca:	e8 76 31 00 00       	call   4a45 <printf>
+    18cf:	83 c4 10             	add    $0x10,%esp
+    exit();
+    18d2:	e8 ca 2f 00 00       	call   48a1 <exit>
+  }
+
+  if(link(".", "lf1") >= 0){
+    18d7:	83 ec 08             	sub    $0x8,%esp
+    18da:	68 bb 57 00 00       	push   $0x57bb
+    18df:	68 8b 58 00 00       	push   $0x588b
+    18e4:	e8 18 30 00 00       	call   4901 <link>
+    18e9:	83 c4 10             	add    $0x10,%esp
+    18ec:	85 c0                	test   %eax,%eax
+    18ee:	78 17                	js     1907 <linktest+0x22d>
+    printf(1, "link . lf1 succeeded! oops\n");
+    18f0:	83 ec 08             	sub    $0x8,%esp
+    18f3:	68 8d 58 00 00       	push   $0x588d
+    18f8:	6a 01                	push   $0x1
+    18fa:	e8 46 31 00 00       	call   4a45 <printf>
+    18ff:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1902:	e8 9a 2f 00 00       	call   48a1 <exit>
+  }
+
+  printf(1, "linktest ok\n");
+    1907:	83 ec 08             	sub    $0x8,%esp
+    190a:	68 a9 58 00 00       	push   $0x58a9
+    190f:	6a 01                	push   $0x1
+    1911:	e8 2f 31 00 00       	call   4a45 <printf>
+    1916:	83 c4 10             	add    $0x10,%esp
+}
+    1919:	90                   	nop
+    191a:	c9                   	leave
+    191b:	c3                   	ret
+
+0000191c <concreate>:
+
+// test concurrent create/link/unlink of the same file
+void
+concreate(void)
+{
+    191c:	55                   	push   %ebp
+    191d:	89 e5                	mov    %esp,%ebp
+    191f:	83 ec 58             	sub    $0x58,%esp
+  struct {
+    ushort inum;
+    char name[14];
+  } de;
+
+  printf(1, "concreate test\n");
+    1922:	83 ec 08             	sub    $0x8,%esp
+    1925:	68 b6 58 00 00       	push   $0x58b6
+    192a:	6a 01                	push   $0x1
+    192c:	e8 14 31 00 00       	call   4a45 <printf>
+    1931:	83 c4 10             	add    $0x10,%esp
+  file[0] = 'C';
+    1934:	c6 45 e5 43          	movb   $0x43,-0x1b(%ebp)
+  file[2] = '\0';
+    1938:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+  for(i = 0; i < 40; i++){
+    193c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1943:	e9 fc 00 00 00       	jmp    1a44 <concreate+0x128>
+    file[1] = '0' + i;
+    1948:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    194b:	83 c0 30             	add    $0x30,%eax
+    194e:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    unlink(file);
+    1951:	83 ec 0c             	sub    $0xc,%esp
+    1954:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1957:	50                   	push   %eax
+    1958:	e8 94 2f 00 00       	call   48f1 <unlink>
+    195d:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+    1960:	e8 34 2f 00 00       	call   4899 <fork>
+    1965:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(pid && (i % 3) == 1){
+    1968:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    196c:	74 3b                	je     19a9 <concreate+0x8d>
+    196e:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    1971:	ba 56 55 55 55       	mov    $0x55555556,%edx
+    1976:	89 c8                	mov    %ecx,%eax
+    1978:	f7 ea                	imul   %edx
+    197a:	89 c8                	mov    %ecx,%eax
+    197c:	c1 f8 1f             	sar    $0x1f,%eax
+    197f:	29 c2                	sub    %eax,%edx
+    1981:	89 d0                	mov    %edx,%eax
+    1983:	01 c0                	add    %eax,%eax
+    1985:	01 d0                	add    %edx,%eax
+    1987:	29 c1                	sub    %eax,%ecx
+    1989:	89 ca                	mov    %ecx,%edx
+    198b:	83 fa 01             	cmp    $0x1,%edx
+    198e:	75 19                	jne    19a9 <concreate+0x8d>
+      link("C0", file);
+    1990:	83 ec 08             	sub    $0x8,%esp
+    1993:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1996:	50                   	push   %eax
+    1997:	68 c6 58 00 00       	push   $0x58c6
+    199c:	e8 60 2f 00 00       	call   4901 <link>
+    19a1:	83 c4 10             	add    $0x10,%esp
+    19a4:	e9 87 00 00 00       	jmp    1a30 <concreate+0x114>
+    } else if(pid == 0 && (i % 5) == 1){
+    19a9:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    19ad:	75 3b                	jne    19ea <concreate+0xce>
+    19af:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    19b2:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    19b7:	89 c8                	mov    %ecx,%eax
+    19b9:	f7 ea                	imul   %edx
+    19bb:	d1 fa                	sar    %edx
+    19bd:	89 c8                	mov    %ecx,%eax
+    19bf:	c1 f8 1f             	sar    $0x1f,%eax
+    19c2:	29 c2                	sub    %eax,%edx
+    19c4:	89 d0                	mov    %edx,%eax
+    19c6:	c1 e0 02             	shl    $0x2,%eax
+    19c9:	01 d0                	add    %edx,%eax
+    19cb:	29 c1                	sub    %eax,%ecx
+    19cd:	89 ca                	mov    %ecx,%edx
+    19cf:	83 fa 01             	cmp    $0x1,%edx
+    19d2:	75 16                	jne    19ea <concreate+0xce>
+      link("C0", file);
+    19d4:	83 ec 08             	sub    $0x8,%esp
+    19d7:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    19da:	50                   	push   %eax
+    19db:	68 c6 58 00 00       	push   $0x58c6
+    19e0:	e8 1c 2f 00 00       	call   4901 <link>
+    19e5:	83 c4 10             	add    $0x10,%esp
+    19e8:	eb 46                	jmp    1a30 <concreate+0x114>
+    } else {
+      fd = open(file, O_CREATE | O_RDWR);
+    19ea:	83 ec 08             	sub    $0x8,%esp
+    19ed:	68 02 02 00 00       	push   $0x202
+    19f2:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    19f5:	50                   	push   %eax
+    19f6:	e8 e6 2e 00 00       	call   48e1 <open>
+    19fb:	83 c4 10             	add    $0x10,%esp
+    19fe:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      if(fd < 0){
+    1a01:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1a05:	79 1b                	jns    1a22 <concreate+0x106>
+        printf(1, "concreate create %s failed\n", file);
+    1a07:	83 ec 04             	sub    $0x4,%esp
+    1a0a:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1a0d:	50                   	push   %eax
+    1a0e:	68 c9 58 00 00       	push   $0x58c9
+    1a13:	6a 01                	push   $0x1
+    1a15:	e8 2b 30 00 00       	call   4a45 <printf>
+    1a1a:	83 c4 10             	add    $0x10,%esp
+        exit();
+    1a1d:	e8 7f 2e 00 00       	call   48a1 <exit>
+      }
+      close(fd);
+    1a22:	83 ec 0c             	sub    $0xc,%esp
+    1a25:	ff 75 ec             	push   -0x14(%ebp)
+    1a28:	e8 9c 2e 00 00       	call   48c9 <close>
+    1a2d:	83 c4 10             	add    $0x10,%esp
+    }
+    if(pid == 0)
+    1a30:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1a34:	75 05                	jne    1a3b <concreate+0x11f>
+      exit();
+    1a36:	e8 66 2e 00 00       	call   48a1 <exit>
+    else
+      wait();
+    1a3b:	e8 69 2e 00 00       	call   48a9 <wait>
+  for(i = 0; i < 40; i++){
+    1a40:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1a44:	83 7d f4 27          	cmpl   $0x27,-0xc(%ebp)
+    1a48:	0f 8e fa fe ff ff    	jle    1948 <concreate+0x2c>
+  }
+
+  memset(fa, 0, sizeof(fa));
+    1a4e:	83 ec 04             	sub    $0x4,%esp
+    1a51:	6a 28                	push   $0x28
+    1a53:	6a 00                	push   $0x0
+    1a55:	8d 45 bd             	lea    -0x43(%ebp),%eax
+    1a58:	50                   	push   %eax
+    1a59:	e8 cb 2b 00 00       	call   4629 <memset>
+    1a5e:	83 c4 10             	add    $0x10,%esp
+  fd = open(".", 0);
+    1a61:	83 ec 08             	sub    $0x8,%esp
+    1a64:	6a 00                	push   $0x0
+    1a66:	68 8b 58 00 00       	push   $0x588b
+    1a6b:	e8 71 2e 00 00       	call   48e1 <open>
+    1a70:	83 c4 10             	add    $0x10,%esp
+    1a73:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  n = 0;
+    1a76:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  while(read(fd, &de, sizeof(de)) > 0){
+    1a7d:	e9 99 00 00 00       	jmp    1b1b <concreate+0x1ff>
+    if(de.inum == 0)
+    1a82:	0f b7 45 ac          	movzwl -0x54(%ebp),%eax
+    1a86:	66 85 c0             	test   %ax,%ax
+    1a89:	0f 84 8b 00 00 00    	je     1b1a <concreate+0x1fe>
+      continue;
+    if(de.name[0] == 'C' && de.name[2] == '\0'){
+    1a8f:	0f b6 45 ae          	movzbl -0x52(%ebp),%eax
+    1a93:	3c 43                	cmp    $0x43,%al
+    1a95:	0f 85 80 00 00 00    	jne    1b1b <concreate+0x1ff>
+    1a9b:	0f b6 45 b0          	movzbl -0x50(%ebp),%eax
+    1a9f:	84 c0                	test   %al,%al
+    1aa1:	75 78                	jne    1b1b <concreate+0x1ff>
+      i = de.name[1] - '0';
+    1aa3:	0f b6 45 af          	movzbl -0x51(%ebp),%eax
+    1aa7:	0f be c0             	movsbl %al,%eax
+    1aaa:	83 e8 30             	sub    $0x30,%eax
+    1aad:	89 45 f4             	mov    %eax,-0xc(%ebp)
+      if(i < 0 || i >= sizeof(fa)){
+    1ab0:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1ab4:	78 08                	js     1abe <concreate+0x1a2>
+    1ab6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1ab9:	83 f8 27             	cmp    $0x27,%eax
+    1abc:	76 1e                	jbe    1adc <concreate+0x1c0>
+        printf(1, "concreate weird file %s\n", de.name);
+    1abe:	83 ec 04             	sub    $0x4,%esp
+    1ac1:	8d 45 ac             	lea    -0x54(%ebp),%eax
+    1ac4:	83 c0 02             	add    $0x2,%eax
+    1ac7:	50                   	push   %eax
+    1ac8:	68 e5 58 00 00       	push   $0x58e5
+    1acd:	6a 01                	push   $0x1
+    1acf:	e8 71 2f 00 00       	call   4a45 <printf>
+    1ad4:	83 c4 10             	add    $0x10,%esp
+        exit();
+    1ad7:	e8 c5 2d 00 00       	call   48a1 <exit>
+      }
+      if(fa[i]){
+    1adc:	8d 55 bd             	lea    -0x43(%ebp),%edx
+    1adf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1ae2:	01 d0                	add    %edx,%eax
+    1ae4:	0f b6 00             	movzbl (%eax),%eax
+    1ae7:	84 c0                	test   %al,%al
+    1ae9:	74 1e                	je     1b09 <concreate+0x1ed>
+        printf(1, "concreate duplicate file %s\n", de.name);
+    1aeb:	83 ec 04             	sub    $0x4,%esp
+    1aee:	8d 45 ac             	lea    -0x54(%ebp),%eax
+    1af1:	83 c0 02             	add    $0x2,%eax
+    1af4:	50                   	push   %eax
+    1af5:	68 fe 58 00 00       	push   $0x58fe
+    1afa:	6a 01                	push   $0x1
+    1afc:	e8 44 2f 00 00       	call   4a45 <printf>
+    1b01:	83 c4 10             	add    $0x10,%esp
+        exit();
+    1b04:	e8 98 2d 00 00       	call   48a1 <exit>
+      }
+      fa[i] = 1;
+    1b09:	8d 55 bd             	lea    -0x43(%ebp),%edx
+    1b0c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1b0f:	01 d0                	add    %edx,%eax
+    1b11:	c6 00 01             	movb   $0x1,(%eax)
+      n++;
+    1b14:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    1b18:	eb 01                	jmp    1b1b <concreate+0x1ff>
+      continue;
+    1b1a:	90                   	nop
+  while(read(fd, &de, sizeof(de)) > 0){
+    1b1b:	83 ec 04             	sub    $0x4,%esp
+    1b1e:	6a 10                	push   $0x10
+    1b20:	8d 45 ac             	lea    -0x54(%ebp),%eax
+    1b23:	50                   	push   %eax
+    1b24:	ff 75 ec             	push   -0x14(%ebp)
+    1b27:	e8 8d 2d 00 00       	call   48b9 <read>
+    1b2c:	83 c4 10             	add    $0x10,%esp
+    1b2f:	85 c0                	test   %eax,%eax
+    1b31:	0f 8f 4b ff ff ff    	jg     1a82 <concreate+0x166>
+    }
+  }
+  close(fd);
+    1b37:	83 ec 0c             	sub    $0xc,%esp
+    1b3a:	ff 75 ec             	push   -0x14(%ebp)
+    1b3d:	e8 87 2d 00 00       	call   48c9 <close>
+    1b42:	83 c4 10             	add    $0x10,%esp
+
+  if(n != 40){
+    1b45:	83 7d f0 28          	cmpl   $0x28,-0x10(%ebp)
+    1b49:	74 17                	je     1b62 <concreate+0x246>
+    printf(1, "concreate not enough files in directory listing\n");
+    1b4b:	83 ec 08             	sub    $0x8,%esp
+    1b4e:	68 1c 59 00 00       	push   $0x591c
+    1b53:	6a 01                	push   $0x1
+    1b55:	e8 eb 2e 00 00       	call   4a45 <printf>
+    1b5a:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1b5d:	e8 3f 2d 00 00       	call   48a1 <exit>
+  }
+
+  for(i = 0; i < 40; i++){
+    1b62:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1b69:	e9 43 01 00 00       	jmp    1cb1 <concreate+0x395>
+    file[1] = '0' + i;
+    1b6e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1b71:	83 c0 30             	add    $0x30,%eax
+    1b74:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    pid = fork();
+    1b77:	e8 1d 2d 00 00       	call   4899 <fork>
+    1b7c:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(pid < 0){
+    1b7f:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1b83:	79 17                	jns    1b9c <concreate+0x280>
+      printf(1, "fork failed\n");
+    1b85:	83 ec 08             	sub    $0x8,%esp
+    1b88:	68 a1 50 00 00       	push   $0x50a1
+    1b8d:	6a 01                	push   $0x1
+    1b8f:	e8 b1 2e 00 00       	call   4a45 <printf>
+    1b94:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1b97:	e8 05 2d 00 00       	call   48a1 <exit>
+    }
+    if(((i % 3) == 0 && pid == 0) ||
+    1b9c:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    1b9f:	ba 56 55 55 55       	mov    $0x55555556,%edx
+    1ba4:	89 c8                	mov    %ecx,%eax
+    1ba6:	f7 ea                	imul   %edx
+    1ba8:	89 c8                	mov    %ecx,%eax
+    1baa:	c1 f8 1f             	sar    $0x1f,%eax
+    1bad:	29 c2                	sub    %eax,%edx
+    1baf:	89 d0                	mov    %edx,%eax
+    1bb1:	01 c0                	add    %eax,%eax
+    1bb3:	01 d0                	add    %edx,%eax
+    1bb5:	29 c1                	sub    %eax,%ecx
+    1bb7:	89 ca                	mov    %ecx,%edx
+    1bb9:	85 d2                	test   %edx,%edx
+    1bbb:	75 06                	jne    1bc3 <concreate+0x2a7>
+    1bbd:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1bc1:	74 28                	je     1beb <concreate+0x2cf>
+       ((i % 3) == 1 && pid != 0)){
+    1bc3:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    1bc6:	ba 56 55 55 55       	mov    $0x55555556,%edx
+    1bcb:	89 c8                	mov    %ecx,%eax
+    1bcd:	f7 ea                	imul   %edx
+    1bcf:	89 c8                	mov    %ecx,%eax
+    1bd1:	c1 f8 1f             	sar    $0x1f,%eax
+    1bd4:	29 c2                	sub    %eax,%edx
+    1bd6:	89 d0                	mov    %edx,%eax
+    1bd8:	01 c0                	add    %eax,%eax
+    1bda:	01 d0                	add    %edx,%eax
+    1bdc:	29 c1                	sub    %eax,%ecx
+    1bde:	89 ca                	mov    %ecx,%edx
+    if(((i % 3) == 0 && pid == 0) ||
+    1be0:	83 fa 01             	cmp    $0x1,%edx
+    1be3:	75 7c                	jne    1c61 <concreate+0x345>
+       ((i % 3) == 1 && pid != 0)){
+    1be5:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1be9:	74 76                	je     1c61 <concreate+0x345>
+      close(open(file, 0));
+    1beb:	83 ec 08             	sub    $0x8,%esp
+    1bee:	6a 00                	push   $0x0
+    1bf0:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1bf3:	50                   	push   %eax
+    1bf4:	e8 e8 2c 00 00       	call   48e1 <open>
+    1bf9:	83 c4 10             	add    $0x10,%esp
+    1bfc:	83 ec 0c             	sub    $0xc,%esp
+    1bff:	50                   	push   %eax
+    1c00:	e8 c4 2c 00 00       	call   48c9 <close>
+    1c05:	83 c4 10             	add    $0x10,%esp
+      close(open(file, 0));
+    1c08:	83 ec 08             	sub    $0x8,%esp
+    1c0b:	6a 00                	push   $0x0
+    1c0d:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1c10:	50                   	push   %eax
+    1c11:	e8 cb 2c 00 00       	call   48e1 <open>
+    1c16:	83 c4 10             	add    $0x10,%esp
+    1c19:	83 ec 0c             	sub    $0xc,%esp
+    1c1c:	50                   	push   %eax
+    1c1d:	e8 a7 2c 00 00       	call   48c9 <close>
+    1c22:	83 c4 10             	add    $0x10,%esp
+      close(open(file, 0));
+    1c25:	83 ec 08             	sub    $0x8,%esp
+    1c28:	6a 00                	push   $0x0
+    1c2a:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1c2d:	50                   	push   %eax
+    1c2e:	e8 ae 2c 00 00       	call   48e1 <open>
+    1c33:	83 c4 10             	add    $0x10,%esp
+    1c36:	83 ec 0c             	sub    $0xc,%esp
+    1c39:	50                   	push   %eax
+    1c3a:	e8 8a 2c 00 00       	call   48c9 <close>
+    1c3f:	83 c4 10             	add    $0x10,%esp
+      close(open(file, 0));
+    1c42:	83 ec 08             	sub    $0x8,%esp
+    1c45:	6a 00                	push   $0x0
+    1c47:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1c4a:	50                   	push   %eax
+    1c4b:	e8 91 2c 00 00       	call   48e1 <open>
+    1c50:	83 c4 10             	add    $0x10,%esp
+    1c53:	83 ec 0c             	sub    $0xc,%esp
+    1c56:	50                   	push   %eax
+    1c57:	e8 6d 2c 00 00       	call   48c9 <close>
+    1c5c:	83 c4 10             	add    $0x10,%esp
+    1c5f:	eb 3c                	jmp    1c9d <concreate+0x381>
+    } else {
+      unlink(file);
+    1c61:	83 ec 0c             	sub    $0xc,%esp
+    1c64:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1c67:	50                   	push   %eax
+    1c68:	e8 84 2c 00 00       	call   48f1 <unlink>
+    1c6d:	83 c4 10             	add    $0x10,%esp
+      unlink(file);
+    1c70:	83 ec 0c             	sub    $0xc,%esp
+    1c73:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1c76:	50                   	push   %eax
+    1c77:	e8 75 2c 00 00       	call   48f1 <unlink>
+    1c7c:	83 c4 10             	add    $0x10,%esp
+      unlink(file);
+    1c7f:	83 ec 0c             	sub    $0xc,%esp
+    1c82:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1c85:	50                   	push   %eax
+    1c86:	e8 66 2c 00 00       	call   48f1 <unlink>
+    1c8b:	83 c4 10             	add    $0x10,%esp
+      unlink(file);
+    1c8e:	83 ec 0c             	sub    $0xc,%esp
+    1c91:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1c94:	50                   	push   %eax
+    1c95:	e8 57 2c 00 00       	call   48f1 <unlink>
+    1c9a:	83 c4 10             	add    $0x10,%esp
+    }
+    if(pid == 0)
+    1c9d:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1ca1:	75 05                	jne    1ca8 <concreate+0x38c>
+      exit();
+    1ca3:	e8 f9 2b 00 00       	call   48a1 <exit>
+    else
+      wait();
+    1ca8:	e8 fc 2b 00 00       	call   48a9 <wait>
+  for(i = 0; i < 40; i++){
+    1cad:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1cb1:	83 7d f4 27          	cmpl   $0x27,-0xc(%ebp)
+    1cb5:	0f 8e b3 fe ff ff    	jle    1b6e <concreate+0x252>
+  }
+
+  printf(1, "concreate ok\n");
+    1cbb:	83 ec 08             	sub    $0x8,%esp
+    1cbe:	68 4d 59 00 00       	push   $0x594d
+    1cc3:	6a 01                	push   $0x1
+    1cc5:	e8 7b 2d 00 00       	call   4a45 <printf>
+    1cca:	83 c4 10             	add    $0x10,%esp
+}
+    1ccd:	90                   	nop
+    1cce:	c9                   	leave
+    1ccf:	c3                   	ret
+
+00001cd0 <linkunlink>:
+
+// another concurrent link/unlink/create test,
+// to look for deadlocks.
+void
+linkunlink()
+{
+    1cd0:	55                   	push   %ebp
+    1cd1:	89 e5                	mov    %esp,%ebp
+    1cd3:	83 ec 18             	sub    $0x18,%esp
+  int pid, i;
+
+  printf(1, "linkunlink test\n");
+    1cd6:	83 ec 08             	sub    $0x8,%esp
+    1cd9:	68 5b 59 00 00       	push   $0x595b
+    1cde:	6a 01                	push   $0x1
+    1ce0:	e8 60 2d 00 00       	call   4a45 <printf>
+    1ce5:	83 c4 10             	add    $0x10,%esp
+
+  unlink("x");
+    1ce8:	83 ec 0c             	sub    $0xc,%esp
+    1ceb:	68 d7 54 00 00       	push   $0x54d7
+    1cf0:	e8 fc 2b 00 00       	call   48f1 <unlink>
+    1cf5:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    1cf8:	e8 9c 2b 00 00       	call   4899 <fork>
+    1cfd:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(pid < 0){
+    1d00:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1d04:	79 17                	jns    1d1d <linkunlink+0x4d>
+    printf(1, "fork failed\n");
+    1d06:	83 ec 08             	sub    $0x8,%esp
+    1d09:	68 a1 50 00 00       	push   $0x50a1
+    1d0e:	6a 01                	push   $0x1
+    1d10:	e8 30 2d 00 00       	call   4a45 <printf>
+    1d15:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1d18:	e8 84 2b 00 00       	call   48a1 <exit>
+  }
+
+  unsigned int x = (pid ? 1 : 97);
+    1d1d:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1d21:	74 07                	je     1d2a <linkunlink+0x5a>
+    1d23:	b8 01 00 00 00       	mov    $0x1,%eax
+    1d28:	eb 05                	jmp    1d2f <linkunlink+0x5f>
+    1d2a:	b8 61 00 00 00       	mov    $0x61,%eax
+    1d2f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(i = 0; i < 100; i++){
+    1d32:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1d39:	e9 98 00 00 00       	jmp    1dd6 <linkunlink+0x106>
+    x = x * 1103515245 + 12345;
+    1d3e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1d41:	69 c0 6d 4e c6 41    	imul   $0x41c64e6d,%eax,%eax
+    1d47:	05 39 30 00 00       	add    $0x3039,%eax
+    1d4c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if((x % 3) == 0){
+    1d4f:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+    1d52:	ba ab aa aa aa       	mov    $0xaaaaaaab,%edx
+    1d57:	89 c8                	mov    %ecx,%eax
+    1d59:	f7 e2                	mul    %edx
+    1d5b:	d1 ea                	shr    %edx
+    1d5d:	89 d0                	mov    %edx,%eax
+    1d5f:	01 c0                	add    %eax,%eax
+    1d61:	01 d0                	add    %edx,%eax
+    1d63:	29 c1                	sub    %eax,%ecx
+    1d65:	89 ca                	mov    %ecx,%edx
+    1d67:	85 d2                	test   %edx,%edx
+    1d69:	75 23                	jne    1d8e <linkunlink+0xbe>
+      close(open("x", O_RDWR | O_CREATE));
+    1d6b:	83 ec 08             	sub    $0x8,%esp
+    1d6e:	68 02 02 00 00       	push   $0x202
+    1d73:	68 d7 54 00 00       	push   $0x54d7
+    1d78:	e8 64 2b 00 00       	call   48e1 <open>
+    1d7d:	83 c4 10             	add    $0x10,%esp
+    1d80:	83 ec 0c             	sub    $0xc,%esp
+    1d83:	50                   	push   %eax
+    1d84:	e8 40 2b 00 00       	call   48c9 <close>
+    1d89:	83 c4 10             	add    $0x10,%esp
+    1d8c:	eb 44                	jmp    1dd2 <linkunlink+0x102>
+    } else if((x % 3) == 1){
+    1d8e:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+    1d91:	ba ab aa aa aa       	mov    $0xaaaaaaab,%edx
+    1d96:	89 c8                	mov    %ecx,%eax
+    1d98:	f7 e2                	mul    %edx
+    1d9a:	d1 ea                	shr    %edx
+    1d9c:	89 d0                	mov    %edx,%eax
+    1d9e:	01 c0                	add    %eax,%eax
+    1da0:	01 d0                	add    %edx,%eax
+    1da2:	29 c1                	sub    %eax,%ecx
+    1da4:	89 ca                	mov    %ecx,%edx
+    1da6:	83 fa 01             	cmp    $0x1,%edx
+    1da9:	75 17                	jne    1dc2 <linkunlink+0xf2>
+      link("cat", "x");
+    1dab:	83 ec 08             	sub    $0x8,%esp
+    1dae:	68 d7 54 00 00       	push   $0x54d7
+    1db3:	68 6c 59 00 00       	push   $0x596c
+    1db8:	e8 44 2b 00 00       	call   4901 <link>
+    1dbd:	83 c4 10             	add    $0x10,%esp
+    1dc0:	eb 10                	jmp    1dd2 <linkunlink+0x102>
+    } else {
+      unlink("x");
+    1dc2:	83 ec 0c             	sub    $0xc,%esp
+    1dc5:	68 d7 54 00 00       	push   $0x54d7
+    1dca:	e8 22 2b 00 00       	call   48f1 <unlink>
+    1dcf:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    1dd2:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1dd6:	83 7d f4 63          	cmpl   $0x63,-0xc(%ebp)
+    1dda:	0f 8e 5e ff ff ff    	jle    1d3e <linkunlink+0x6e>
+    }
+  }
+
+  if(pid)
+    1de0:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1de4:	74 07                	je     1ded <linkunlink+0x11d>
+    wait();
+    1de6:	e8 be 2a 00 00       	call   48a9 <wait>
+    1deb:	eb 05                	jmp    1df2 <linkunlink+0x122>
+  else
+    exit();
+    1ded:	e8 af 2a 00 00       	call   48a1 <exit>
+
+  printf(1, "linkunlink ok\n");
+    1df2:	83 ec 08             	sub    $0x8,%esp
+    1df5:	68 70 59 00 00       	push   $0x5970
+    1dfa:	6a 01                	push   $0x1
+    1dfc:	e8 44 2c 00 00       	call   4a45 <printf>
+    1e01:	83 c4 10             	add    $0x10,%esp
+}
+    1e04:	90                   	nop
+    1e05:	c9                   	leave
+    1e06:	c3                   	ret
+
+00001e07 <bigdir>:
+
+// directory that uses indirect blocks
+void
+bigdir(void)
+{
+    1e07:	55                   	push   %ebp
+    1e08:	89 e5                	mov    %esp,%ebp
+    1e0a:	83 ec 28             	sub    $0x28,%esp
+  int i, fd;
+  char name[10];
+
+  printf(1, "bigdir test\n");
+    1e0d:	83 ec 08             	sub    $0x8,%esp
+    1e10:	68 7f 59 00 00       	push   $0x597f
+    1e15:	6a 01                	push   $0x1
+    1e17:	e8 29 2c 00 00       	call   4a45 <printf>
+    1e1c:	83 c4 10             	add    $0x10,%esp
+  unlink("bd");
+    1e1f:	83 ec 0c             	sub    $0xc,%esp
+    1e22:	68 8c 59 00 00       	push   $0x598c
+    1e27:	e8 c5 2a 00 00       	call   48f1 <unlink>
+    1e2c:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("bd", O_CREATE);
+    1e2f:	83 ec 08             	sub    $0x8,%esp
+    1e32:	68 00 02 00 00       	push   $0x200
+    1e37:	68 8c 59 00 00       	push   $0x598c
+    1e3c:	e8 a0 2a 00 00       	call   48e1 <open>
+    1e41:	83 c4 10             	add    $0x10,%esp
+    1e44:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(fd < 0){
+    1e47:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1e4b:	79 17                	jns    1e64 <bigdir+0x5d>
+    printf(1, "bigdir create failed\n");
+    1e4d:	83 ec 08             	sub    $0x8,%esp
+    1e50:	68 8f 59 00 00       	push   $0x598f
+    1e55:	6a 01                	push   $0x1
+    1e57:	e8 e9 2b 00 00       	call   4a45 <printf>
+    1e5c:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1e5f:	e8 3d 2a 00 00       	call   48a1 <exit>
+  }
+  close(fd);
+    1e64:	83 ec 0c             	sub    $0xc,%esp
+    1e67:	ff 75 f0             	push   -0x10(%ebp)
+    1e6a:	e8 5a 2a 00 00       	call   48c9 <close>
+    1e6f:	83 c4 10             	add    $0x10,%esp
+
+  for(i = 0; i < 500; i++){
+    1e72:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1e79:	eb 69                	jmp    1ee4 <bigdir+0xdd>
+    name[0] = 'x';
+    1e7b:	c6 45 e6 78          	movb   $0x78,-0x1a(%ebp)
+    name[1] = '0' + (i / 64);
+    1e7f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1e82:	8d 50 3f             	lea    0x3f(%eax),%edx
+    1e85:	85 c0                	test   %eax,%eax
+    1e87:	0f 48 c2             	cmovs  %edx,%eax
+    1e8a:	c1 f8 06             	sar    $0x6,%eax
+    1e8d:	83 c0 30             	add    $0x30,%eax
+    1e90:	88 45 e7             	mov    %al,-0x19(%ebp)
+    name[2] = '0' + (i % 64);
+    1e93:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1e96:	89 d0                	mov    %edx,%eax
+    1e98:	c1 f8 1f             	sar    $0x1f,%eax
+    1e9b:	c1 e8 1a             	shr    $0x1a,%eax
+    1e9e:	01 c2                	add    %eax,%edx
+    1ea0:	83 e2 3f             	and    $0x3f,%edx
+    1ea3:	29 c2                	sub    %eax,%edx
+    1ea5:	89 d0                	mov    %edx,%eax
+    1ea7:	83 c0 30             	add    $0x30,%eax
+    1eaa:	88 45 e8             	mov    %al,-0x18(%ebp)
+    name[3] = '\0';
+    1ead:	c6 45 e9 00          	movb   $0x0,-0x17(%ebp)
+    if(link("bd", name) != 0){
+    1eb1:	83 ec 08             	sub    $0x8,%esp
+    1eb4:	8d 45 e6             	lea    -0x1a(%ebp),%eax
+    1eb7:	50                   	push   %eax
+    1eb8:	68 8c 59 00 00       	push   $0x598c
+    1ebd:	e8 3f 2a 00 00       	call   4901 <link>
+    1ec2:	83 c4 10             	add    $0x10,%esp
+    1ec5:	85 c0                	test   %eax,%eax
+    1ec7:	74 17                	je     1ee0 <bigdir+0xd9>
+      printf(1, "bigdir link failed\n");
+    1ec9:	83 ec 08             	sub    $0x8,%esp
+    1ecc:	68 a5 59 00 00       	push   $0x59a5
+    1ed1:	6a 01                	push   $0x1
+    1ed3:	e8 6d 2b 00 00       	call   4a45 <printf>
+    1ed8:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1edb:	e8 c1 29 00 00       	call   48a1 <exit>
+  for(i = 0; i < 500; i++){
+    1ee0:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1ee4:	81 7d f4 f3 01 00 00 	cmpl   $0x1f3,-0xc(%ebp)
+    1eeb:	7e 8e                	jle    1e7b <bigdir+0x74>
+    }
+  }
+
+  unlink("bd");
+    1eed:	83 ec 0c             	sub    $0xc,%esp
+    1ef0:	68 8c 59 00 00       	push   $0x598c
+    1ef5:	e8 f7 29 00 00       	call   48f1 <unlink>
+    1efa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 500; i++){
+    1efd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1f04:	eb 64                	jmp    1f6a <bigdir+0x163>
+    name[0] = 'x';
+    1f06:	c6 45 e6 78          	movb   $0x78,-0x1a(%ebp)
+    name[1] = '0' + (i / 64);
+    1f0a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1f0d:	8d 50 3f             	lea    0x3f(%eax),%edx
+    1f10:	85 c0                	test   %eax,%eax
+    1f12:	0f 48 c2             	cmovs  %edx,%eax
+    1f15:	c1 f8 06             	sar    $0x6,%eax
+    1f18:	83 c0 30             	add    $0x30,%eax
+    1f1b:	88 45 e7             	mov    %al,-0x19(%ebp)
+    name[2] = '0' + (i % 64);
+    1f1e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1f21:	89 d0                	mov    %edx,%eax
+    1f23:	c1 f8 1f             	sar    $0x1f,%eax
+    1f26:	c1 e8 1a             	shr    $0x1a,%eax
+    1f29:	01 c2                	add    %eax,%edx
+    1f2b:	83 e2 3f             	and    $0x3f,%edx
+    1f2e:	29 c2                	sub    %eax,%edx
+    1f30:	89 d0                	mov    %edx,%eax
+    1f32:	83 c0 30             	add    $0x30,%eax
+    1f35:	88 45 e8             	mov    %al,-0x18(%ebp)
+    name[3] = '\0';
+    1f38:	c6 45 e9 00          	movb   $0x0,-0x17(%ebp)
+    if(unlink(name) != 0){
+    1f3c:	83 ec 0c             	sub    $0xc,%esp
+    1f3f:	8d 45 e6             	lea    -0x1a(%ebp),%eax
+    1f42:	50                   	push   %eax
+    1f43:	e8 a9 29 00 00       	call   48f1 <unlink>
+    1f48:	83 c4 10             	add    $0x10,%esp
+    1f4b:	85 c0                	test   %eax,%eax
+    1f4d:	74 17                	je     1f66 <bigdir+0x15f>
+      printf(1, "bigdir unlink failed");
+    1f4f:	83 ec 08             	sub    $0x8,%esp
+    1f52:	68 b9 59 00 00       	push   $0x59b9
+    1f57:	6a 01                	push   $0x1
+    1f59:	e8 e7 2a 00 00       	call   4a45 <printf>
+    1f5e:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1f61:	e8 3b 29 00 00       	call   48a1 <exit>
+  for(i = 0; i < 500; i++){
+    1f66:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1f6a:	81 7d f4 f3 01 00 00 	cmpl   $0x1f3,-0xc(%ebp)
+    1f71:	7e 93                	jle    1f06 <bigdir+0xff>
+    }
+  }
+
+  printf(1, "bigdir ok\n");
+    1f73:	83 ec 08             	sub    $0x8,%esp
+    1f76:	68 ce 59 00 00       	push   $0x59ce
+    1f7b:	6a 01                	push   $0x1
+    1f7d:	e8 c3 2a 00 00       	call   4a45 <printf>
+    1f82:	83 c4 10             	add    $0x10,%esp
+}
+    1f85:	90                   	nop
+    1f86:	c9                   	leave
+    1f87:	c3                   	ret
+
+00001f88 <subdir>:
+
+void
+subdir(void)
+{
+    1f88:	55                   	push   %ebp
+    1f89:	89 e5                	mov    %esp,%ebp
+    1f8b:	83 ec 18             	sub    $0x18,%esp
+  int fd, cc;
+
+  printf(1, "subdir test\n");
+    1f8e:	83 ec 08             	sub    $0x8,%esp
+    1f91:	68 d9 59 00 00       	push   $0x59d9
+    1f96:	6a 01                	push   $0x1
+    1f98:	e8 a8 2a 00 00       	call   4a45 <printf>
+    1f9d:	83 c4 10             	add    $0x10,%esp
+
+  unlink("ff");
+    1fa0:	83 ec 0c             	sub    $0xc,%esp
+    1fa3:	68 e6 59 00 00       	push   $0x59e6
+    1fa8:	e8 44 29 00 00       	call   48f1 <unlink>
+    1fad:	83 c4 10             	add    $0x10,%esp
+  if(mkdir("dd") != 0){
+    1fb0:	83 ec 0c             	sub    $0xc,%esp
+    1fb3:	68 e9 59 00 00       	push   $0x59e9
+    1fb8:	e8 4c 29 00 00       	call   4909 <mkdir>
+    1fbd:	83 c4 10             	add    $0x10,%esp
+    1fc0:	85 c0                	test   %eax,%eax
+    1fc2:	74 17                	je     1fdb <subdir+0x53>
+    printf(1, "subdir mkdir dd failed\n");
+    1fc4:	83 ec 08             	sub    $0x8,%esp
+    1fc7:	68 ec 59 00 00       	push   $0x59ec
+    1fcc:	6a 01                	push   $0x1
+    1fce:	e8 72 2a 00 00       	call   4a45 <printf>
+    1fd3:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1fd6:	e8 c6 28 00 00       	call   48a1 <exit>
+  }
+
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    1fdb:	83 ec 08             	sub    $0x8,%esp
+    1fde:	68 02 02 00 00       	push   $0x202
+    1fe3:	68 04 5a 00 00       	push   $0x5a04
+    1fe8:	e8 f4 28 00 00       	call   48e1 <open>
+    1fed:	83 c4 10             	add    $0x10,%esp
+    1ff0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    1ff3:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1ff7:	79 17                	jns    2010 <subdir+0x88>
+    printf(1, "create dd/ff failed\n");
+    1ff9:	83 ec 08             	sub    $0x8,%esp
+    1ffc:	68 0a 5a 00 00       	push   $0x5a0a
+    2001:	6a 01                	push   $0x1
+    2003:	e8 3d 2a 00 00       	call   4a45 <printf>
+    2008:	83 c4 10             	add    $0x10,%esp
+    exit();
+    200b:	e8 91 28 00 00       	call   48a1 <exit>
+  }
+  write(fd, "ff", 2);
+    2010:	83 ec 04             	sub    $0x4,%esp
+    2013:	6a 02                	push   $0x2
+    2015:	68 e6 59 00 00       	push   $0x59e6
+    201a:	ff 75 f4             	push   -0xc(%ebp)
+    201d:	e8 9f 28 00 00       	call   48c1 <write>
+    2022:	83 c4 10             	add    $0x10,%esp
+  close(fd);
+    2025:	83 ec 0c             	sub    $0xc,%esp
+    2028:	ff 75 f4             	push   -0xc(%ebp)
+    202b:	e8 99 28 00 00       	call   48c9 <close>
+    2030:	83 c4 10             	add    $0x10,%esp
+
+  if(unlink("dd") >= 0){
+    2033:	83 ec 0c             	sub    $0xc,%esp
+    2036:	68 e9 59 00 00       	push   $0x59e9
+    203b:	e8 b1 28 00 00       	call   48f1 <unlink>
+    2040:	83 c4 10             	add    $0x10,%esp
+    2043:	85 c0                	test   %eax,%eax
+    2045:	78 17                	js     205e <subdir+0xd6>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    2047:	83 ec 08             	sub    $0x8,%esp
+    204a:	68 20 5a 00 00       	push   $0x5a20
+    204f:	6a 01                	push   $0x1
+    2051:	e8 ef 29 00 00       	call   4a45 <printf>
+    2056:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2059:	e8 43 28 00 00       	call   48a1 <exit>
+  }
+
+  if(mkdir("/dd/dd") != 0){
+    205e:	83 ec 0c             	sub    $0xc,%esp
+    2061:	68 46 5a 00 00       	push   $0x5a46
+    2066:	e8 9e 28 00 00       	call   4909 <mkdir>
+    206b:	83 c4 10             	add    $0x10,%esp
+    206e:	85 c0                	test   %eax,%eax
+    2070:	74 17                	je     2089 <subdir+0x101>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    2072:	83 ec 08             	sub    $0x8,%esp
+    2075:	68 4d 5a 00 00       	push   $0x5a4d
+    207a:	6a 01                	push   $0x1
+    207c:	e8 c4 29 00 00       	call   4a45 <printf>
+    2081:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2084:	e8 18 28 00 00       	call   48a1 <exit>
+  }
+
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    2089:	83 ec 08             	sub    $0x8,%esp
+    208c:	68 02 02 00 00       	push   $0x202
+    2091:	68 68 5a 00 00       	push   $0x5a68
+    2096:	e8 46 28 00 00       	call   48e1 <open>
+    209b:	83 c4 10             	add    $0x10,%esp
+    209e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    20a1:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    20a5:	79 17                	jns    20be <subdir+0x136>
+    printf(1, "create dd/dd/ff failed\n");
+    20a7:	83 ec 08             	sub    $0x8,%esp
+    20aa:	68 71 5a 00 00       	push   $0x5a71
+    20af:	6a 01                	push   $0x1
+    20b1:	e8 8f 29 00 00       	call   4a45 <printf>
+    20b6:	83 c4 10             	add    $0x10,%esp
+    exit();
+    20b9:	e8 e3 27 00 00       	call   48a1 <exit>
+  }
+  write(fd, "FF", 2);
+    20be:	83 ec 04             	sub    $0x4,%esp
+    20c1:	6a 02                	push   $0x2
+    20c3:	68 89 5a 00 00       	push   $0x5a89
+    20c8:	ff 75 f4             	push   -0xc(%ebp)
+    20cb:	e8 f1 27 00 00       	call   48c1 <write>
+    20d0:	83 c4 10             	add    $0x10,%esp
+  close(fd);
+    20d3:	83 ec 0c             	sub    $0xc,%esp
+    20d6:	ff 75 f4             	push   -0xc(%ebp)
+    20d9:	e8 eb 27 00 00       	call   48c9 <close>
+    20de:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("dd/dd/../ff", 0);
+    20e1:	83 ec 08             	sub    $0x8,%esp
+    20e4:	6a 00                	push   $0x0
+    20e6:	68 8c 5a 00 00       	push   $0x5a8c
+    20eb:	e8 f1 27 00 00       	call   48e1 <open>
+    20f0:	83 c4 10             	add    $0x10,%esp
+    20f3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    20f6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    20fa:	79 17                	jns    2113 <subdir+0x18b>
+    printf(1, "open dd/dd/../ff failed\n");
+    20fc:	83 ec 08             	sub    $0x8,%esp
+    20ff:	68 98 5a 00 00       	push   $0x5a98
+    2104:	6a 01                	push   $0x1
+    2106:	e8 3a 29 00 00       	call   4a45 <printf>
+    210b:	83 c4 10             	add    $0x10,%esp
+    exit();
+    210e:	e8 8e 27 00 00       	call   48a1 <exit>
+  }
+  cc = read(fd, buf, sizeof(buf));
+    2113:	83 ec 04             	sub    $0x4,%esp
+    2116:	68 00 20 00 00       	push   $0x2000
+    211b:	68 a0 80 00 00       	push   $0x80a0
+    2120:	ff 75 f4             	push   -0xc(%ebp)
+    2123:	e8 91 27 00 00       	call   48b9 <read>
+    2128:	83 c4 10             	add    $0x10,%esp
+    212b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(cc != 2 || buf[0] != 'f'){
+    212e:	83 7d f0 02          	cmpl   $0x2,-0x10(%ebp)
+    2132:	75 0b                	jne    213f <subdir+0x1b7>
+    2134:	0f b6 05 a0 80 00 00 	movzbl 0x80a0,%eax
+    213b:	3c 66                	cmp    $0x66,%al
+    213d:	74 17                	je     2156 <subdir+0x1ce>
+    printf(1, "dd/dd/../ff wrong content\n");
+    213f:	83 ec 08             	sub    $0x8,%esp
+    2142:	68 b1 5a 00 00       	push   $0x5ab1
+    2147:	6a 01                	push   $0x1
+    2149:	e8 f7 28 00 00       	call   4a45 <printf>
+    214e:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2151:	e8 4b 27 00 00       	call   48a1 <exit>
+  }
+  close(fd);
+    2156:	83 ec 0c             	sub    $0xc,%esp
+    2159:	ff 75 f4             	push   -0xc(%ebp)
+    215c:	e8 68 27 00 00       	call   48c9 <close>
+    2161:	83 c4 10             	add    $0x10,%esp
+
+  if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    2164:	83 ec 08             	sub    $0x8,%esp
+    2167:	68 cc 5a 00 00       	push   $0x5acc
+    216c:	68 68 5a 00 00       	push   $0x5a68
+    2171:	e8 8b 27 00 00       	call   4901 <link>
+    2176:	83 c4 10             	add    $0x10,%esp
+    2179:	85 c0                	test   %eax,%eax
+    217b:	74 17                	je     2194 <subdir+0x20c>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    217d:	83 ec 08             	sub    $0x8,%esp
+    2180:	68 d8 5a 00 00       	push   $0x5ad8
+    2185:	6a 01                	push   $0x1
+    2187:	e8 b9 28 00 00       	call   4a45 <printf>
+    218c:	83 c4 10             	add    $0x10,%esp
+    exit();
+    218f:	e8 0d 27 00 00       	call   48a1 <exit>
+  }
+
+  if(unlink("dd/dd/ff") != 0){
+    2194:	83 ec 0c             	sub    $0xc,%esp
+    2197:	68 68 5a 00 00       	push   $0x5a68
+    219c:	e8 50 27 00 00       	call   48f1 <unlink>
+    21a1:	83 c4 10             	add    $0x10,%esp
+    21a4:	85 c0                	test   %eax,%eax
+    21a6:	74 17                	je     21bf <subdir+0x237>
+    printf(1, "unlink dd/dd/ff failed\n");
+    21a8:	83 ec 08             	sub    $0x8,%esp
+    21ab:	68 f9 5a 00 00       	push   $0x5af9
+    21b0:	6a 01                	push   $0x1
+    21b2:	e8 8e 28 00 00       	call   4a45 <printf>
+    21b7:	83 c4 10             	add    $0x10,%esp
+    exit();
+    21ba:	e8 e2 26 00 00       	call   48a1 <exit>
+  }
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    21bf:	83 ec 08             	sub    $0x8,%esp
+    21c2:	6a 00                	push   $0x0
+    21c4:	68 68 5a 00 00       	push   $0x5a68
+    21c9:	e8 13 27 00 00       	call   48e1 <open>
+    21ce:	83 c4 10             	add    $0x10,%esp
+    21d1:	85 c0                	test   %eax,%eax
+    21d3:	78 17                	js     21ec <subdir+0x264>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    21d5:	83 ec 08             	sub    $0x8,%esp
+    21d8:	68 14 5b 00 00       	push   $0x5b14
+    21dd:	6a 01                	push   $0x1
+    21df:	e8 61 28 00 00       	call   4a45 <printf>
+    21e4:	83 c4 10             	add    $0x10,%esp
+    exit();
+    21e7:	e8 b5 26 00 00       	call   48a1 <exit>
+  }
+
+  if(chdir("dd") != 0){
+    21ec:	83 ec 0c             	sub    $0xc,%esp
+    21ef:	68 e9 59 00 00       	push   $0x59e9
+    21f4:	e8 18 27 00 00       	call   4911 <chdir>
+    21f9:	83 c4 10             	add    $0x10,%esp
+    21fc:	85 c0                	test   %eax,%eax
+    21fe:	74 17                	je     2217 <subdir+0x28f>
+    printf(1, "chdir dd failed\n");
+    2200:	83 ec 08             	sub    $0x8,%esp
+    2203:	68 38 5b 00 00       	push   $0x5b38
+    2208:	6a 01                	push   $0x1
+    220a:	e8 36 28 00 00       	call   4a45 <printf>
+    220f:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2212:	e8 8a 26 00 00       	call   48a1 <exit>
+  }
+  if(chdir("dd/../../dd") != 0){
+    2217:	83 ec 0c             	sub    $0xc,%esp
+    221a:	68 49 5b 00 00       	push   $0x5b49
+    221f:	e8 ed 26 00 00       	call   4911 <chdir>
+    2224:	83 c4 10             	add    $0x10,%esp
+    2227:	85 c0                	test   %eax,%eax
+    2229:	74 17                	je     2242 <subdir+0x2ba>
+    printf(1, "chdir dd/../../dd failed\n");
+    222b:	83 ec 08             	sub    $0x8,%esp
+    222e:	68 55 5b 00 00       	push   $0x5b55
+    2233:	6a 01                	push   $0x1
+    2235:	e8 0b 28 00 00       	call   4a45 <printf>
+    223a:	83 c4 10             	add    $0x10,%esp
+    exit();
+    223d:	e8 5f 26 00 00       	call   48a1 <exit>
+  }
+  if(chdir("dd/../../../dd") != 0){
+    2242:	83 ec 0c             	sub    $0xc,%esp
+    2245:	68 6f 5b 00 00       	push   $0x5b6f
+    224a:	e8 c2 26 00 00       	call   4911 <chdir>
+    224f:	83 c4 10             	add    $0x10,%esp
+    2252:	85 c0                	test   %eax,%eax
+    2254:	74 17                	je     226d <subdir+0x2e5>
+    printf(1, "chdir dd/../../dd failed\n");
+    2256:	83 ec 08             	sub    $0x8,%esp
+    2259:	68 55 5b 00 00       	push   $0x5b55
+    225e:	6a 01                	push   $0x1
+    2260:	e8 e0 27 00 00       	call   4a45 <printf>
+    2265:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2268:	e8 34 26 00 00       	call   48a1 <exit>
+  }
+  if(chdir("./..") != 0){
+    226d:	83 ec 0c             	sub    $0xc,%esp
+    2270:	68 7e 5b 00 00       	push   $0x5b7e
+    2275:	e8 97 26 00 00       	call   4911 <chdir>
+    227a:	83 c4 10             	add    $0x10,%esp
+    227d:	85 c0                	test   %eax,%eax
+    227f:	74 17                	je     2298 <subdir+0x310>
+    printf(1, "chdir ./.. failed\n");
+    2281:	83 ec 08             	sub    $0x8,%esp
+    2284:	68 83 5b 00 00       	push   $0x5b83
+    2289:	6a 01                	push   $0x1
+    228b:	e8 b5 27 00 00       	call   4a45 <printf>
+    2290:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2293:	e8 09 26 00 00       	call   48a1 <exit>
+  }
+
+  fd = open("dd/dd/ffff", 0);
+    2298:	83 ec 08             	sub    $0x8,%esp
+    229b:	6a 00                	push   $0x0
+    229d:	68 cc 5a 00 00       	push   $0x5acc
+    22a2:	e8 3a 26 00 00       	call   48e1 <open>
+    22a7:	83 c4 10             	add    $0x10,%esp
+    22aa:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    22ad:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    22b1:	79 17                	jns    22ca <subdir+0x342>
+    printf(1, "open dd/dd/ffff failed\n");
+    22b3:	83 ec 08             	sub    $0x8,%esp
+    22b6:	68 96 5b 00 00       	push   $0x5b96
+    22bb:	6a 01                	push   $0x1
+    22bd:	e8 83 27 00 00       	call   4a45 <printf>
+    22c2:	83 c4 10             	add    $0x10,%esp
+    exit();
+    22c5:	e8 d7 25 00 00       	call   48a1 <exit>
+  }
+  if(read(fd, buf, sizeof(buf)) != 2){
+    22ca:	83 ec 04             	sub    $0x4,%esp
+    22cd:	68 00 20 00 00       	push   $0x2000
+    22d2:	68 a0 80 00 00       	push   $0x80a0
+    22d7:	ff 75 f4             	push   -0xc(%ebp)
+    22da:	e8 da 25 00 00       	call   48b9 <read>
+    22df:	83 c4 10             	add    $0x10,%esp
+    22e2:	83 f8 02             	cmp    $0x2,%eax
+    22e5:	74 17                	je     22fe <subdir+0x376>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    22e7:	83 ec 08             	sub    $0x8,%esp
+    22ea:	68 ae 5b 00 00       	push   $0x5bae
+    22ef:	6a 01                	push   $0x1
+    22f1:	e8 4f 27 00 00       	call   4a45 <printf>
+    22f6:	83 c4 10             	add    $0x10,%esp
+    exit();
+    22f9:	e8 a3 25 00 00       	call   48a1 <exit>
+  }
+  close(fd);
+    22fe:	83 ec 0c             	sub    $0xc,%esp
+    2301:	ff 75 f4             	push   -0xc(%ebp)
+    2304:	e8 c0 25 00 00       	call   48c9 <close>
+    2309:	83 c4 10             	add    $0x10,%esp
+
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    230c:	83 ec 08             	sub    $0x8,%esp
+    230f:	6a 00                	push   $0x0
+    2311:	68 68 5a 00 00       	push   $0x5a68
+    2316:	e8 c6 25 00 00       	call   48e1 <open>
+    231b:	83 c4 10             	add    $0x10,%esp
+    231e:	85 c0                	test   %eax,%eax
+    2320:	78 17                	js     2339 <subdir+0x3b1>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    2322:	83 ec 08             	sub    $0x8,%esp
+    2325:	68 cc 5b 00 00       	push   $0x5bcc
+    232a:	6a 01                	push   $0x1
+    232c:	e8 14 27 00 00       	call   4a45 <printf>
+    2331:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2334:	e8 68 25 00 00       	call   48a1 <exit>
+  }
+
+  if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    2339:	83 ec 08             	sub    $0x8,%esp
+    233c:	68 02 02 00 00       	push   $0x202
+    2341:	68 f1 5b 00 00       	push   $0x5bf1
+    2346:	e8 96 25 00 00       	call   48e1 <open>
+    234b:	83 c4 10             	add    $0x10,%esp
+    234e:	85 c0                	test   %eax,%eax
+    2350:	78 17                	js     2369 <subdir+0x3e1>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    2352:	83 ec 08             	sub    $0x8,%esp
+    2355:	68 fa 5b 00 00       	push   $0x5bfa
+    235a:	6a 01                	push   $0x1
+    235c:	e8 e4 26 00 00       	call   4a45 <printf>
+    2361:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2364:	e8 38 25 00 00       	call   48a1 <exit>
+  }
+  if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    2369:	83 ec 08             	sub    $0x8,%esp
+    236c:	68 02 02 00 00       	push   $0x202
+    2371:	68 16 5c 00 00       	push   $0x5c16
+    2376:	e8 66 25 00 00       	call   48e1 <open>
+    237b:	83 c4 10             	add    $0x10,%esp
+    237e:	85 c0                	test   %eax,%eax
+    2380:	78 17                	js     2399 <subdir+0x411>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    2382:	83 ec 08             	sub    $0x8,%esp
+    2385:	68 1f 5c 00 00       	push   $0x5c1f
+    238a:	6a 01                	push   $0x1
+    238c:	e8 b4 26 00 00       	call   4a45 <printf>
+    2391:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2394:	e8 08 25 00 00       	call   48a1 <exit>
+  }
+  if(open("dd", O_CREATE) >= 0){
+    2399:	83 ec 08             	sub    $0x8,%esp
+    239c:	68 00 02 00 00       	push   $0x200
+    23a1:	68 e9 59 00 00       	push   $0x59e9
+    23a6:	e8 36 25 00 00       	call   48e1 <open>
+    23ab:	83 c4 10             	add    $0x10,%esp
+    23ae:	85 c0                	test   %eax,%eax
+    23b0:	78 17                	js     23c9 <subdir+0x441>
+    printf(1, "create dd succeeded!\n");
+    23b2:	83 ec 08             	sub    $0x8,%esp
+    23b5:	68 3b 5c 00 00       	push   $0x5c3b
+    23ba:	6a 01                	push   $0x1
+    23bc:	e8 84 26 00 00       	call   4a45 <printf>
+    23c1:	83 c4 10             	add    $0x10,%esp
+    exit();
+    23c4:	e8 d8 24 00 00       	call   48a1 <exit>
+  }
+  if(open("dd", O_RDWR) >= 0){
+    23c9:	83 ec 08             	sub    $0x8,%esp
+    23cc:	6a 02                	push   $0x2
+    23ce:	68 e9 59 00 00       	push   $0x59e9
+    23d3:	e8 09 25 00 00       	call   48e1 <open>
+    23d8:	83 c4 10             	add    $0x10,%esp
+    23db:	85 c0                	test   %eax,%eax
+    23dd:	78 17                	js     23f6 <subdir+0x46e>
+    printf(1, "open dd rdwr succeeded!\n");
+    23df:	83 ec 08             	sub    $0x8,%esp
+    23e2:	68 51 5c 00 00       	push   $0x5c51
+    23e7:	6a 01                	push   $0x1
+    23e9:	e8 57 26 00 00       	call   4a45 <printf>
+    23ee:	83 c4 10             	add    $0x10,%esp
+    exit();
+    23f1:	e8 ab 24 00 00       	call   48a1 <exit>
+  }
+  if(open("dd", O_WRONLY) >= 0){
+    23f6:	83 ec 08             	sub    $0x8,%esp
+    23f9:	6a 01                	push   $0x1
+    23fb:	68 e9 59 00 00       	push   $0x59e9
+    2400:	e8 dc 24 00 00       	call   48e1 <open>
+    2405:	83 c4 10             	add    $0x10,%esp
+    2408:	85 c0                	test   %eax,%eax
+    240a:	78 17                	js     2423 <subdir+0x49b>
+    printf(1, "open dd wronly succeeded!\n");
+    240c:	83 ec 08             	sub    $0x8,%esp
+    240f:	68 6a 5c 00 00       	push   $0x5c6a
+    2414:	6a 01                	push   $0x1
+    2416:	e8 2a 26 00 00       	call   4a45 <printf>
+    241b:	83 c4 10             	add    $0x10,%esp
+    exit();
+    241e:	e8 7e 24 00 00       	call   48a1 <exit>
+  }
+  if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    2423:	83 ec 08             	sub    $0x8,%esp
+    2426:	68 85 5c 00 00       	push   $0x5c85
+    242b:	68 f1 5b 00 00       	push   $0x5bf1
+    2430:	e8 cc 24 00 00       	call   4901 <link>
+    2435:	83 c4 10             	add    $0x10,%esp
+    2438:	85 c0                	test   %eax,%eax
+    243a:	75 17                	jne    2453 <subdir+0x4cb>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    243c:	83 ec 08             	sub    $0x8,%esp
+    243f:	68 90 5c 00 00       	push   $0x5c90
+    2444:	6a 01                	push   $0x1
+    2446:	e8 fa 25 00 00       	call   4a45 <printf>
+    244b:	83 c4 10             	add    $0x10,%esp
+    exit();
+    244e:	e8 4e 24 00 00       	call   48a1 <exit>
+  }
+  if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    2453:	83 ec 08             	sub    $0x8,%esp
+    2456:	68 85 5c 00 00       	push   $0x5c85
+    245b:	68 16 5c 00 00       	push   $0x5c16
+    2460:	e8 9c 24 00 00       	call   4901 <link>
+    2465:	83 c4 10             	add    $0x10,%esp
+    2468:	85 c0                	test   %eax,%eax
+    246a:	75 17                	jne    2483 <subdir+0x4fb>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    246c:	83 ec 08             	sub    $0x8,%esp
+    246f:	68 b4 5c 00 00       	push   $0x5cb4
+    2474:	6a 01                	push   $0x1
+    2476:	e8 ca 25 00 00       	call   4a45 <printf>
+    247b:	83 c4 10             	add    $0x10,%esp
+    exit();
+    247e:	e8 1e 24 00 00       	call   48a1 <exit>
+  }
+  if(link("dd/ff", "dd/dd/ffff") == 0){
+    2483:	83 ec 08             	sub    $0x8,%esp
+    2486:	68 cc 5a 00 00       	push   $0x5acc
+    248b:	68 04 5a 00 00       	push   $0x5a04
+    2490:	e8 6c 24 00 00       	call   4901 <link>
+    2495:	83 c4 10             	add    $0x10,%esp
+    2498:	85 c0                	test   %eax,%eax
+    249a:	75 17                	jne    24b3 <subdir+0x52b>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    249c:	83 ec 08             	sub    $0x8,%esp
+    249f:	68 d8 5c 00 00       	push   $0x5cd8
+    24a4:	6a 01                	push   $0x1
+    24a6:	e8 9a 25 00 00       	call   4a45 <printf>
+    24ab:	83 c4 10             	add    $0x10,%esp
+    exit();
+    24ae:	e8 ee 23 00 00       	call   48a1 <exit>
+  }
+  if(mkdir("dd/ff/ff") == 0){
+    24b3:	83 ec 0c             	sub    $0xc,%esp
+    24b6:	68 f1 5b 00 00       	push   $0x5bf1
+    24bb:	e8 49 24 00 00       	call   4909 <mkdir>
+    24c0:	83 c4 10             	add    $0x10,%esp
+    24c3:	85 c0                	test   %eax,%eax
+    24c5:	75 17                	jne    24de <subdir+0x556>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    24c7:	83 ec 08             	sub    $0x8,%esp
+    24ca:	68 fa 5c 00 00       	push   $0x5cfa
+    24cf:	6a 01                	push   $0x1
+    24d1:	e8 6f 25 00 00       	call   4a45 <printf>
+    24d6:	83 c4 10             	add    $0x10,%esp
+    exit();
+    24d9:	e8 c3 23 00 00       	call   48a1 <exit>
+  }
+  if(mkdir("dd/xx/ff") == 0){
+    24de:	83 ec 0c             	sub    $0xc,%esp
+    24e1:	68 16 5c 00 00       	push   $0x5c16
+    24e6:	e8 1e 24 00 00       	call   4909 <mkdir>
+    24eb:	83 c4 10             	add    $0x10,%esp
+    24ee:	85 c0                	test   %eax,%eax
+    24f0:	75 17                	jne    2509 <subdir+0x581>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    24f2:	83 ec 08             	sub    $0x8,%esp
+    24f5:	68 15 5d 00 00       	push   $0x5d15
+    24fa:	6a 01                	push   $0x1
+    24fc:	e8 44 25 00 00       	call   4a45 <printf>
+    2501:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2504:	e8 98 23 00 00       	call   48a1 <exit>
+  }
+  if(mkdir("dd/dd/ffff") == 0){
+    2509:	83 ec 0c             	sub    $0xc,%esp
+    250c:	68 cc 5a 00 00       	push   $0x5acc
+    2511:	e8 f3 23 00 00       	call   4909 <mkdir>
+    2516:	83 c4 10             	add    $0x10,%esp
+    2519:	85 c0                	test   %eax,%eax
+    251b:	75 17                	jne    2534 <subdir+0x5ac>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    251d:	83 ec 08             	sub    $0x8,%esp
+    2520:	68 30 5d 00 00       	push   $0x5d30
+    2525:	6a 01                	push   $0x1
+    2527:	e8 19 25 00 00       	call   4a45 <printf>
+    252c:	83 c4 10             	add    $0x10,%esp
+    exit();
+    252f:	e8 6d 23 00 00       	call   48a1 <exit>
+  }
+  if(unlink("dd/xx/ff") == 0){
+    2534:	83 ec 0c             	sub    $0xc,%esp
+    2537:	68 16 5c 00 00       	push   $0x5c16
+    253c:	e8 b0 23 00 00       	call   48f1 <unlink>
+    2541:	83 c4 10             	add    $0x10,%esp
+    2544:	85 c0                	test   %eax,%eax
+    2546:	75 17                	jne    255f <subdir+0x5d7>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    2548:	83 ec 08             	sub    $0x8,%esp
+    254b:	68 4d 5d 00 00       	push   $0x5d4d
+    2550:	6a 01                	push   $0x1
+    2552:	e8 ee 24 00 00       	call   4a45 <printf>
+    2557:	83 c4 10             	add    $0x10,%esp
+    exit();
+    255a:	e8 42 23 00 00       	call   48a1 <exit>
+  }
+  if(unlink("dd/ff/ff") == 0){
+    255f:	83 ec 0c             	sub    $0xc,%esp
+    2562:	68 f1 5b 00 00       	push   $0x5bf1
+    2567:	e8 85 23 00 00       	call   48f1 <unlink>
+    256c:	83 c4 10             	add    $0x10,%esp
+    256f:	85 c0                	test   %eax,%eax
+    2571:	75 17                	jne    258a <subdir+0x602>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    2573:	83 ec 08             	sub    $0x8,%esp
+    2576:	68 69 5d 00 00       	push   $0x5d69
+    257b:	6a 01                	push   $0x1
+    257d:	e8 c3 24 00 00       	call   4a45 <printf>
+    2582:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2585:	e8 17 23 00 00       	call   48a1 <exit>
+  }
+  if(chdir("dd/ff") == 0){
+    258a:	83 ec 0c             	sub    $0xc,%esp
+    258d:	68 04 5a 00 00       	push   $0x5a04
+    2592:	e8 7a 23 00 00       	call   4911 <chdir>
+    2597:	83 c4 10             	add    $0x10,%esp
+    259a:	85 c0                	test   %eax,%eax
+    259c:	75 17                	jne    25b5 <subdir+0x62d>
+    printf(1, "chdir dd/ff succeeded!\n");
+    259e:	83 ec 08             	sub    $0x8,%esp
+    25a1:	68 85 5d 00 00       	push   $0x5d85
+    25a6:	6a 01                	push   $0x1
+    25a8:	e8 98 24 00 00       	call   4a45 <printf>
+    25ad:	83 c4 10             	add    $0x10,%esp
+    exit();
+    25b0:	e8 ec 22 00 00       	call   48a1 <exit>
+  }
+  if(chdir("dd/xx") == 0){
+    25b5:	83 ec 0c             	sub    $0xc,%esp
+    25b8:	68 9d 5d 00 00       	push   $0x5d9d
+    25bd:	e8 4f 23 00 00       	call   4911 <chdir>
+    25c2:	83 c4 10             	add    $0x10,%esp
+    25c5:	85 c0                	test   %eax,%eax
+    25c7:	75 17                	jne    25e0 <subdir+0x658>
+    printf(1, "chdir dd/xx succeeded!\n");
+    25c9:	83 ec 08             	sub    $0x8,%esp
+    25cc:	68 a3 5d 00 00       	push   $0x5da3
+    25d1:	6a 01                	push   $0x1
+    25d3:	e8 6d 24 00 00       	call   4a45 <printf>
+    25d8:	83 c4 10             	add    $0x10,%esp
+    exit();
+    25db:	e8 c1 22 00 00       	call   48a1 <exit>
+  }
+
+  if(unlink("dd/dd/ffff") != 0){
+    25e0:	83 ec 0c             	sub    $0xc,%esp
+    25e3:	68 cc 5a 00 00       	push   $0x5acc
+    25e8:	e8 04 23 00 00       	call   48f1 <unlink>
+    25ed:	83 c4 10             	add    $0x10,%esp
+    25f0:	85 c0                	test   %eax,%eax
+    25f2:	74 17                	je     260b <subdir+0x683>
+    printf(1, "unlink dd/dd/ff failed\n");
+    25f4:	83 ec 08             	sub    $0x8,%esp
+    25f7:	68 f9 5a 00 00       	push   $0x5af9
+    25fc:	6a 01                	push   $0x1
+    25fe:	e8 42 24 00 00       	call   4a45 <printf>
+    2603:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2606:	e8 96 22 00 00       	call   48a1 <exit>
+  }
+  if(unlink("dd/ff") != 0){
+    260b:	83 ec 0c             	sub    $0xc,%esp
+    260e:	68 04 5a 00 00       	push   $0x5a04
+    2613:	e8 d9 22 00 00       	call   48f1 <unlink>
+    2618:	83 c4 10             	add    $0x10,%esp
+    261b:	85 c0                	test   %eax,%eax
+    261d:	74 17                	je     2636 <subdir+0x6ae>
+    printf(1, "unlink dd/ff failed\n");
+    261f:	83 ec 08             	sub    $0x8,%esp
+    2622:	68 bb 5d 00 00       	push   $0x5dbb
+    2627:	6a 01                	push   $0x1
+    2629:	e8 17 24 00 00       	call   4a45 <printf>
+    262e:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2631:	e8 6b 22 00 00       	call   48a1 <exit>
+  }
+  if(unlink("dd") == 0){
+    2636:	83 ec 0c             	sub    $0xc,%esp
+    2639:	68 e9 59 00 00       	push   $0x59e9
+    263e:	e8 ae 22 00 00       	call   48f1 <unlink>
+    2643:	83 c4 10             	add    $0x10,%esp
+    2646:	85 c0                	test   %eax,%eax
+    2648:	75 17                	jne    2661 <subdir+0x6d9>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    264a:	83 ec 08             	sub    $0x8,%esp
+    264d:	68 d0 5d 00 00       	push   $0x5dd0
+    2652:	6a 01                	push   $0x1
+    2654:	e8 ec 23 00 00       	call   4a45 <printf>
+    2659:	83 c4 10             	add    $0x10,%esp
+    exit();
+    265c:	e8 40 22 00 00       	call   48a1 <exit>
+  }
+  if(unlink("dd/dd") < 0){
+    2661:	83 ec 0c             	sub    $0xc,%esp
+    2664:	68 f0 5d 00 00       	push   $0x5df0
+    2669:	e8 83 22 00 00       	call   48f1 <unlink>
+    266e:	83 c4 10             	add    $0x10,%esp
+    2671:	85 c0                	test   %eax,%eax
+    2673:	79 17                	jns    268c <subdir+0x704>
+    printf(1, "unlink dd/dd failed\n");
+    2675:	83 ec 08             	sub    $0x8,%esp
+    2678:	68 f6 5d 00 00       	push   $0x5df6
+    267d:	6a 01                	push   $0x1
+    267f:	e8 c1 23 00 00       	call   4a45 <printf>
+    2684:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2687:	e8 15 22 00 00       	call   48a1 <exit>
+  }
+  if(unlink("dd") < 0){
+    268c:	83 ec 0c             	sub    $0xc,%esp
+    268f:	68 e9 59 00 00       	push   $0x59e9
+    2694:	e8 58 22 00 00       	call   48f1 <unlink>
+    2699:	83 c4 10             	add    $0x10,%esp
+    269c:	85 c0                	test   %eax,%eax
+    269e:	79 17                	jns    26b7 <subdir+0x72f>
+    printf(1, "unlink dd failed\n");
+    26a0:	83 ec 08             	sub    $0x8,%esp
+    26a3:	68 0b 5e 00 00       	push   $0x5e0b
+    26a8:	6a 01                	push   $0x1
+    26aa:	e8 96 23 00 00       	call   4a45 <printf>
+    26af:	83 c4 10             	add    $0x10,%esp
+    exit();
+    26b2:	e8 ea 21 00 00       	call   48a1 <exit>
+  }
+
+  printf(1, "subdir ok\n");
+    26b7:	83 ec 08             	sub    $0x8,%esp
+    26ba:	68 1d 5e 00 00       	push   $0x5e1d
+    26bf:	6a 01                	push   $0x1
+    26c1:	e8 7f 23 00 00       	call   4a45 <printf>
+    26c6:	83 c4 10             	add    $0x10,%esp
+}
+    26c9:	90                   	nop
+    26ca:	c9                   	leave
+    26cb:	c3                   	ret
+
+000026cc <bigwrite>:
+
+// test writes that are larger than the log.
+void
+bigwrite(void)
+{
+    26cc:	55                   	push   %ebp
+    26cd:	89 e5                	mov    %esp,%ebp
+    26cf:	83 ec 18             	sub    $0x18,%esp
+  int fd, sz;
+
+  printf(1, "bigwrite test\n");
+    26d2:	83 ec 08             	sub    $0x8,%esp
+    26d5:	68 28 5e 00 00       	push   $0x5e28
+    26da:	6a 01                	push   $0x1
+    26dc:	e8 64 23 00 00       	call   4a45 <printf>
+    26e1:	83 c4 10             	add    $0x10,%esp
+
+  unlink("bigwrite");
+    26e4:	83 ec 0c             	sub    $0xc,%esp
+    26e7:	68 37 5e 00 00       	push   $0x5e37
+    26ec:	e8 00 22 00 00       	call   48f1 <unlink>
+    26f1:	83 c4 10             	add    $0x10,%esp
+  for(sz = 499; sz < 12*512; sz += 471){
+    26f4:	c7 45 f4 f3 01 00 00 	movl   $0x1f3,-0xc(%ebp)
+    26fb:	e9 a8 00 00 00       	jmp    27a8 <bigwrite+0xdc>
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    2700:	83 ec 08             	sub    $0x8,%esp
+    2703:	68 02 02 00 00       	push   $0x202
+    2708:	68 37 5e 00 00       	push   $0x5e37
+    270d:	e8 cf 21 00 00       	call   48e1 <open>
+    2712:	83 c4 10             	add    $0x10,%esp
+    2715:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if(fd < 0){
+    2718:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    271c:	79 17                	jns    2735 <bigwrite+0x69>
+      printf(1, "cannot create bigwrite\n");
+    271e:	83 ec 08             	sub    $0x8,%esp
+    2721:	68 40 5e 00 00       	push   $0x5e40
+    2726:	6a 01                	push   $0x1
+    2728:	e8 18 23 00 00       	call   4a45 <printf>
+    272d:	83 c4 10             	add    $0x10,%esp
+      exit();
+    2730:	e8 6c 21 00 00       	call   48a1 <exit>
+    }
+    int i;
+    for(i = 0; i < 2; i++){
+    2735:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    273c:	eb 3f                	jmp    277d <bigwrite+0xb1>
+      int cc = write(fd, buf, sz);
+    273e:	83 ec 04             	sub    $0x4,%esp
+    2741:	ff 75 f4             	push   -0xc(%ebp)
+    2744:	68 a0 80 00 00       	push   $0x80a0
+    2749:	ff 75 ec             	push   -0x14(%ebp)
+    274c:	e8 70 21 00 00       	call   48c1 <write>
+    2751:	83 c4 10             	add    $0x10,%esp
+    2754:	89 45 e8             	mov    %eax,-0x18(%ebp)
+      if(cc != sz){
+    2757:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    275a:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    275d:	74 1a                	je     2779 <bigwrite+0xad>
+        printf(1, "write(%d) ret %d\n", sz, cc);
+    275f:	ff 75 e8             	push   -0x18(%ebp)
+    2762:	ff 75 f4             	push   -0xc(%ebp)
+    2765:	68 58 5e 00 00       	push   $0x5e58
+    276a:	6a 01                	push   $0x1
+    276c:	e8 d4 22 00 00       	call   4a45 <printf>
+    2771:	83 c4 10             	add    $0x10,%esp
+        exit();
+    2774:	e8 28 21 00 00       	call   48a1 <exit>
+    for(i = 0; i < 2; i++){
+    2779:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    277d:	83 7d f0 01          	cmpl   $0x1,-0x10(%ebp)
+    2781:	7e bb                	jle    273e <bigwrite+0x72>
+      }
+    }
+    close(fd);
+    2783:	83 ec 0c             	sub    $0xc,%esp
+    2786:	ff 75 ec             	push   -0x14(%ebp)
+    2789:	e8 3b 21 00 00       	call   48c9 <close>
+    278e:	83 c4 10             	add    $0x10,%esp
+    unlink("bigwrite");
+    2791:	83 ec 0c             	sub    $0xc,%esp
+    2794:	68 37 5e 00 00       	push   $0x5e37
+    2799:	e8 53 21 00 00       	call   48f1 <unlink>
+    279e:	83 c4 10             	add    $0x10,%esp
+  for(sz = 499; sz < 12*512; sz += 471){
+    27a1:	81 45 f4 d7 01 00 00 	addl   $0x1d7,-0xc(%ebp)
+    27a8:	81 7d f4 ff 17 00 00 	cmpl   $0x17ff,-0xc(%ebp)
+    27af:	0f 8e 4b ff ff ff    	jle    2700 <bigwrite+0x34>
+  }
+
+  printf(1, "bigwrite ok\n");
+    27b5:	83 ec 08             	sub    $0x8,%esp
+    27b8:	68 6a 5e 00 00       	push   $0x5e6a
+    27bd:	6a 01                	push   $0x1
+    27bf:	e8 81 22 00 00       	call   4a45 <printf>
+    27c4:	83 c4 10             	add    $0x10,%esp
+}
+    27c7:	90                   	nop
+    27c8:	c9                   	leave
+    27c9:	c3                   	ret
+
+000027ca <bigfile>:
+
+void
+bigfile(void)
+{
+    27ca:	55                   	push   %ebp
+    27cb:	89 e5                	mov    %esp,%ebp
+    27cd:	83 ec 18             	sub    $0x18,%esp
+  int fd, i, total, cc;
+
+  printf(1, "bigfile test\n");
+    27d0:	83 ec 08             	sub    $0x8,%esp
+    27d3:	68 77 5e 00 00       	push   $0x5e77
+    27d8:	6a 01                	push   $0x1
+    27da:	e8 66 22 00 00       	call   4a45 <printf>
+    27df:	83 c4 10             	add    $0x10,%esp
+
+  unlink("bigfile");
+    27e2:	83 ec 0c             	sub    $0xc,%esp
+    27e5:	68 85 5e 00 00       	push   $0x5e85
+    27ea:	e8 02 21 00 00       	call   48f1 <unlink>
+    27ef:	83 c4 10             	add    $0x10,%esp
+  fd = open("bigfile", O_CREATE | O_RDWR);
+    27f2:	83 ec 08             	sub    $0x8,%esp
+    27f5:	68 02 02 00 00       	push   $0x202
+    27fa:	68 85 5e 00 00       	push   $0x5e85
+    27ff:	e8 dd 20 00 00       	call   48e1 <open>
+    2804:	83 c4 10             	add    $0x10,%esp
+    2807:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(fd < 0){
+    280a:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    280e:	79 17                	jns    2827 <bigfile+0x5d>
+    printf(1, "cannot create bigfile");
+    2810:	83 ec 08             	sub    $0x8,%esp
+    2813:	68 8d 5e 00 00       	push   $0x5e8d
+    2818:	6a 01                	push   $0x1
+    281a:	e8 26 22 00 00       	call   4a45 <printf>
+    281f:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2822:	e8 7a 20 00 00       	call   48a1 <exit>
+  }
+  for(i = 0; i < 20; i++){
+    2827:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    282e:	eb 52                	jmp    2882 <bigfile+0xb8>
+    memset(buf, i, 600);
+    2830:	83 ec 04             	sub    $0x4,%esp
+    2833:	68 58 02 00 00       	push   $0x258
+    2838:	ff 75 f4             	push   -0xc(%ebp)
+    283b:	68 a0 80 00 00       	push   $0x80a0
+    2840:	e8 e4 1d 00 00       	call   4629 <memset>
+    2845:	83 c4 10             	add    $0x10,%esp
+    if(write(fd, buf, 600) != 600){
+    2848:	83 ec 04             	sub    $0x4,%esp
+    284b:	68 58 02 00 00       	push   $0x258
+    2850:	68 a0 80 00 00       	push   $0x80a0
+    2855:	ff 75 ec             	push   -0x14(%ebp)
+    2858:	e8 64 20 00 00       	call   48c1 <write>
+    285d:	83 c4 10             	add    $0x10,%esp
+    2860:	3d 58 02 00 00       	cmp    $0x258,%eax
+    2865:	74 17                	je     287e <bigfile+0xb4>
+      printf(1, "write bigfile failed\n");
+    2867:	83 ec 08             	sub    $0x8,%esp
+    286a:	68 a3 5e 00 00       	push   $0x5ea3
+    286f:	6a 01                	push   $0x1
+    2871:	e8 cf 21 00 00       	call   4a45 <printf>
+    2876:	83 c4 10             	add    $0x10,%esp
+      exit();
+    2879:	e8 23 20 00 00       	call   48a1 <exit>
+  for(i = 0; i < 20; i++){
+    287e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    2882:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+    2886:	7e a8                	jle    2830 <bigfile+0x66>
+    }
+  }
+  close(fd);
+    2888:	83 ec 0c             	sub    $0xc,%esp
+    288b:	ff 75 ec             	push   -0x14(%ebp)
+    288e:	e8 36 20 00 00       	call   48c9 <close>
+    2893:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("bigfile", 0);
+    2896:	83 ec 08             	sub    $0x8,%esp
+    2899:	6a 00                	push   $0x0
+    289b:	68 85 5e 00 00       	push   $0x5e85
+    28a0:	e8 3c 20 00 00       	call   48e1 <open>
+    28a5:	83 c4 10             	add    $0x10,%esp
+    28a8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(fd < 0){
+    28ab:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    28af:	79 17                	jns    28c8 <bigfile+0xfe>
+    printf(1, "cannot open bigfile\n");
+    28b1:	83 ec 08             	sub    $0x8,%esp
+    28b4:	68 b9 5e 00 00       	push   $0x5eb9
+    28b9:	6a 01                	push   $0x1
+    28bb:	e8 85 21 00 00       	call   4a45 <printf>
+    28c0:	83 c4 10             	add    $0x10,%esp
+    exit();
+    28c3:	e8 d9 1f 00 00       	call   48a1 <exit>
+  }
+  total = 0;
+    28c8:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  for(i = 0; ; i++){
+    28cf:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    cc = read(fd, buf, 300);
+    28d6:	83 ec 04             	sub    $0x4,%esp
+    28d9:	68 2c 01 00 00       	push   $0x12c
+    28de:	68 a0 80 00 00       	push   $0x80a0
+    28e3:	ff 75 ec             	push   -0x14(%ebp)
+    28e6:	e8 ce 1f 00 00       	call   48b9 <read>
+    28eb:	83 c4 10             	add    $0x10,%esp
+    28ee:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(cc < 0){
+    28f1:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    28f5:	79 17                	jns    290e <bigfile+0x144>
+      printf(1, "read bigfile failed\n");
+    28f7:	83 ec 08             	sub    $0x8,%esp
+    28fa:	68 ce 5e 00 00       	push   $0x5ece
+    28ff:	6a 01                	push   $0x1
+    2901:	e8 3f 21 00 00       	call   4a45 <printf>
+    2906:	83 c4 10             	add    $0x10,%esp
+      exit();
+    2909:	e8 93 1f 00 00       	call   48a1 <exit>
+    }
+    if(cc == 0)
+    290e:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    2912:	74 7a                	je     298e <bigfile+0x1c4>
+      break;
+    if(cc != 300){
+    2914:	81 7d e8 2c 01 00 00 	cmpl   $0x12c,-0x18(%ebp)
+    291b:	74 17                	je     2934 <bigfile+0x16a>
+      printf(1, "short read bigfile\n");
+    291d:	83 ec 08             	sub    $0x8,%esp
+    2920:	68 e3 5e 00 00       	push   $0x5ee3
+    2925:	6a 01                	push   $0x1
+    2927:	e8 19 21 00 00       	call   4a45 <printf>
+    292c:	83 c4 10             	add    $0x10,%esp
+      exit();
+    292f:	e8 6d 1f 00 00       	call   48a1 <exit>
+    }
+    if(buf[0] != i/2 || buf[299] != i/2){
+    2934:	0f b6 05 a0 80 00 00 	movzbl 0x80a0,%eax
+    293b:	0f be d0             	movsbl %al,%edx
+    293e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2941:	89 c1                	mov    %eax,%ecx
+    2943:	c1 e9 1f             	shr    $0x1f,%ecx
+    2946:	01 c8                	add    %ecx,%eax
+    2948:	d1 f8                	sar    %eax
+    294a:	39 c2                	cmp    %eax,%edx
+    294c:	75 1a                	jne    2968 <bigfile+0x19e>
+    294e:	0f b6 05 cb 81 00 00 	movzbl 0x81cb,%eax
+    2955:	0f be d0             	movsbl %al,%edx
+    2958:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    295b:	89 c1                	mov    %eax,%ecx
+    295d:	c1 e9 1f             	shr    $0x1f,%ecx
+    2960:	01 c8                	add    %ecx,%eax
+    2962:	d1 f8                	sar    %eax
+    2964:	39 c2                	cmp    %eax,%edx
+    2966:	74 17                	je     297f <bigfile+0x1b5>
+      printf(1, "read bigfile wrong data\n");
+    2968:	83 ec 08             	sub    $0x8,%esp
+    296b:	68 f7 5e 00 00       	push   $0x5ef7
+    2970:	6a 01                	push   $0x1
+    2972:	e8 ce 20 00 00       	call   4a45 <printf>
+    2977:	83 c4 10             	add    $0x10,%esp
+      exit();
+    297a:	e8 22 1f 00 00       	call   48a1 <exit>
+    }
+    total += cc;
+    297f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    2982:	01 45 f0             	add    %eax,-0x10(%ebp)
+  for(i = 0; ; i++){
+    2985:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    cc = read(fd, buf, 300);
+    2989:	e9 48 ff ff ff       	jmp    28d6 <bigfile+0x10c>
+      break;
+    298e:	90                   	nop
+  }
+  close(fd);
+    298f:	83 ec 0c             	sub    $0xc,%esp
+    2992:	ff 75 ec             	push   -0x14(%ebp)
+    2995:	e8 2f 1f 00 00       	call   48c9 <close>
+    299a:	83 c4 10             	add    $0x10,%esp
+  if(total != 20*600){
+    299d:	81 7d f0 e0 2e 00 00 	cmpl   $0x2ee0,-0x10(%ebp)
+    29a4:	74 17                	je     29bd <bigfile+0x1f3>
+    printf(1, "read bigfile wrong total\n");
+    29a6:	83 ec 08             	sub    $0x8,%esp
+    29a9:	68 10 5f 00 00       	push   $0x5f10
+    29ae:	6a 01                	push   $0x1
+    29b0:	e8 90 20 00 00       	call   4a45 <printf>
+    29b5:	83 c4 10             	add    $0x10,%esp
+    exit();
+    29b8:	e8 e4 1e 00 00       	call   48a1 <exit>
+  }
+  unlink("bigfile");
+    29bd:	83 ec 0c             	sub    $0xc,%esp
+    29c0:	68 85 5e 00 00       	push   $0x5e85
+    29c5:	e8 27 1f 00 00       	call   48f1 <unlink>
+    29ca:	83 c4 10             	add    $0x10,%esp
+
+  printf(1, "bigfile test ok\n");
+    29cd:	83 ec 08             	sub    $0x8,%esp
+    29d0:	68 2a 5f 00 00       	push   $0x5f2a
+    29d5:	6a 01                	push   $0x1
+    29d7:	e8 69 20 00 00       	call   4a45 <printf>
+    29dc:	83 c4 10             	add    $0x10,%esp
+}
+    29df:	90                   	nop
+    29e0:	c9                   	leave
+    29e1:	c3                   	ret
+
+000029e2 <fourteen>:
+
+void
+fourteen(void)
+{
+    29e2:	55                   	push   %ebp
+    29e3:	89 e5                	mov    %esp,%ebp
+    29e5:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  // DIRSIZ is 14.
+  printf(1, "fourteen test\n");
+    29e8:	83 ec 08             	sub    $0x8,%esp
+    29eb:	68 3b 5f 00 00       	push   $0x5f3b
+    29f0:	6a 01                	push   $0x1
+    29f2:	e8 4e 20 00 00       	call   4a45 <printf>
+    29f7:	83 c4 10             	add    $0x10,%esp
+
+  if(mkdir("12345678901234") != 0){
+    29fa:	83 ec 0c             	sub    $0xc,%esp
+    29fd:	68 4a 5f 00 00       	push   $0x5f4a
+    2a02:	e8 02 1f 00 00       	call   4909 <mkdir>
+    2a07:	83 c4 10             	add    $0x10,%esp
+    2a0a:	85 c0                	test   %eax,%eax
+    2a0c:	74 17                	je     2a25 <fourteen+0x43>
+    printf(1, "mkdir 12345678901234 failed\n");
+    2a0e:	83 ec 08             	sub    $0x8,%esp
+    2a11:	68 59 5f 00 00       	push   $0x5f59
+    2a16:	6a 01                	push   $0x1
+    2a18:	e8 28 20 00 00       	call   4a45 <printf>
+    2a1d:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2a20:	e8 7c 1e 00 00       	call   48a1 <exit>
+  }
+  if(mkdir("12345678901234/123456789012345") != 0){
+    2a25:	83 ec 0c             	sub    $0xc,%esp
+    2a28:	68 78 5f 00 00       	push   $0x5f78
+    2a2d:	e8 d7 1e 00 00       	call   4909 <mkdir>
+    2a32:	83 c4 10             	add    $0x10,%esp
+    2a35:	85 c0                	test   %eax,%eax
+    2a37:	74 17                	je     2a50 <fourteen+0x6e>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    2a39:	83 ec 08             	sub    $0x8,%esp
+    2a3c:	68 98 5f 00 00       	push   $0x5f98
+    2a41:	6a 01                	push   $0x1
+    2a43:	e8 fd 1f 00 00       	call   4a45 <printf>
+    2a48:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2a4b:	e8 51 1e 00 00       	call   48a1 <exit>
+  }
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+    2a50:	83 ec 08             	sub    $0x8,%esp
+    2a53:	68 00 02 00 00       	push   $0x200
+    2a58:	68 c8 5f 00 00       	push   $0x5fc8
+    2a5d:	e8 7f 1e 00 00       	call   48e1 <open>
+    2a62:	83 c4 10             	add    $0x10,%esp
+    2a65:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    2a68:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    2a6c:	79 17                	jns    2a85 <fourteen+0xa3>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    2a6e:	83 ec 08             	sub    $0x8,%esp
+    2a71:	68 f8 5f 00 00       	push   $0x5ff8
+    2a76:	6a 01                	push   $0x1
+    2a78:	e8 c8 1f 00 00       	call   4a45 <printf>
+    2a7d:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2a80:	e8 1c 1e 00 00       	call   48a1 <exit>
+  }
+  close(fd);
+    2a85:	83 ec 0c             	sub    $0xc,%esp
+    2a88:	ff 75 f4             	push   -0xc(%ebp)
+    2a8b:	e8 39 1e 00 00       	call   48c9 <close>
+    2a90:	83 c4 10             	add    $0x10,%esp
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+    2a93:	83 ec 08             	sub    $0x8,%esp
+    2a96:	6a 00                	push   $0x0
+    2a98:	68 38 60 00 00       	push   $0x6038
+    2a9d:	e8 3f 1e 00 00       	call   48e1 <open>
+    2aa2:	83 c4 10             	add    $0x10,%esp
+    2aa5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    2aa8:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    2aac:	79 17                	jns    2ac5 <fourteen+0xe3>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    2aae:	83 ec 08             	sub    $0x8,%esp
+    2ab1:	68 68 60 00 00       	push   $0x6068
+    2ab6:	6a 01                	push   $0x1
+    2ab8:	e8 88 1f 00 00       	call   4a45 <printf>
+    2abd:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2ac0:	e8 dc 1d 00 00       	call   48a1 <exit>
+  }
+  close(fd);
+    2ac5:	83 ec 0c             	sub    $0xc,%esp
+    2ac8:	ff 75 f4             	push   -0xc(%ebp)
+    2acb:	e8 f9 1d 00 00       	call   48c9 <close>
+    2ad0:	83 c4 10             	add    $0x10,%esp
+
+  if(mkdir("12345678901234/12345678901234") == 0){
+    2ad3:	83 ec 0c             	sub    $0xc,%esp
+    2ad6:	68 a2 60 00 00       	push   $0x60a2
+    2adb:	e8 29 1e 00 00       	call   4909 <mkdir>
+    2ae0:	83 c4 10             	add    $0x10,%esp
+    2ae3:	85 c0                	test   %eax,%eax
+    2ae5:	75 17                	jne    2afe <fourteen+0x11c>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    2ae7:	83 ec 08             	sub    $0x8,%esp
+    2aea:	68 c0 60 00 00       	push   $0x60c0
+    2aef:	6a 01                	push   $0x1
+    2af1:	e8 4f 1f 00 00       	call   4a45 <printf>
+    2af6:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2af9:	e8 a3 1d 00 00       	call   48a1 <exit>
+  }
+  if(mkdir("123456789012345/12345678901234") == 0){
+    2afe:	83 ec 0c             	sub    $0xc,%esp
+    2b01:	68 f0 60 00 00       	push   $0x60f0
+    2b06:	e8 fe 1d 00 00       	call   4909 <mkdir>
+    2b0b:	83 c4 10             	add    $0x10,%esp
+    2b0e:	85 c0                	test   %eax,%eax
+    2b10:	75 17                	jne    2b29 <fourteen+0x147>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    2b12:	83 ec 08             	sub    $0x8,%esp
+    2b15:	68 10 61 00 00       	push   $0x6110
+    2b1a:	6a 01                	push   $0x1
+    2b1c:	e8 24 1f 00 00       	call   4a45 <printf>
+    2b21:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2b24:	e8 78 1d 00 00       	call   48a1 <exit>
+  }
+
+  printf(1, "fourteen ok\n");
+    2b29:	83 ec 08             	sub    $0x8,%esp
+    2b2c:	68 41 61 00 00       	push   $0x6141
+    2b31:	6a 01                	push   $0x1
+    2b33:	e8 0d 1f 00 00       	call   4a45 <printf>
+    2b38:	83 c4 10             	add    $0x10,%esp
+}
+    2b3b:	90                   	nop
+    2b3c:	c9                   	leave
+    2b3d:	c3                   	ret
+
+00002b3e <rmdot>:
+
+void
+rmdot(void)
+{
+    2b3e:	55                   	push   %ebp
+    2b3f:	89 e5                	mov    %esp,%ebp
+    2b41:	83 ec 08             	sub    $0x8,%esp
+  printf(1, "rmdot test\n");
+    2b44:	83 ec 08             	sub    $0x8,%esp
+    2b47:	68 4e 61 00 00       	push   $0x614e
+    2b4c:	6a 01                	push   $0x1
+    2b4e:	e8 f2 1e 00 00       	call   4a45 <printf>
+    2b53:	83 c4 10             	add    $0x10,%esp
+  if(mkdir("dots") != 0){
+    2b56:	83 ec 0c             	sub    $0xc,%esp
+    2b59:	68 5a 61 00 00       	push   $0x615a
+    2b5e:	e8 a6 1d 00 00       	call   4909 <mkdir>
+    2b63:	83 c4 10             	add    $0x10,%esp
+    2b66:	85 c0                	test   %eax,%eax
+    2b68:	74 17                	je     2b81 <rmdot+0x43>
+    printf(1, "mkdir dots failed\n");
+    2b6a:	83 ec 08             	sub    $0x8,%esp
+    2b6d:	68 5f 61 00 00       	push   $0x615f
+    2b72:	6a 01                	push   $0x1
+    2b74:	e8 cc 1e 00 00       	call   4a45 <printf>
+    2b79:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2b7c:	e8 20 1d 00 00       	call   48a1 <exit>
+  }
+  if(chdir("dots") != 0){
+    2b81:	83 ec 0c             	sub    $0xc,%esp
+    2b84:	68 5a 61 00 00       	push   $0x615a
+    2b89:	e8 83 1d 00 00       	call   4911 <chdir>
+    2b8e:	83 c4 10             	add    $0x10,%esp
+    2b91:	85 c0                	test   %eax,%eax
+    2b93:	74 17                	je     2bac <rmdot+0x6e>
+    printf(1, "chdir dots failed\n");
+    2b95:	83 ec 08             	sub    $0x8,%esp
+    2b98:	68 72 61 00 00       	push   $0x6172
+    2b9d:	6a 01                	push   $0x1
+    2b9f:	e8 a1 1e 00 00       	call   4a45 <printf>
+    2ba4:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2ba7:	e8 f5 1c 00 00       	call   48a1 <exit>
+  }
+  if(unlink(".") == 0){
+    2bac:	83 ec 0c             	sub    $0xc,%esp
+    2baf:	68 8b 58 00 00       	push   $0x588b
+    2bb4:	e8 38 1d 00 00       	call   48f1 <unlink>
+    2bb9:	83 c4 10             	add    $0x10,%esp
+    2bbc:	85 c0                	test   %eax,%eax
+    2bbe:	75 17                	jne    2bd7 <rmdot+0x99>
+    printf(1, "rm . worked!\n");
+    2bc0:	83 ec 08             	sub    $0x8,%esp
+    2bc3:	68 85 61 00 00       	push   $0x6185
+    2bc8:	6a 01                	push   $0x1
+    2bca:	e8 76 1e 00 00       	call   4a45 <printf>
+    2bcf:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2bd2:	e8 ca 1c 00 00       	call   48a1 <exit>
+  }
+  if(unlink("..") == 0){
+    2bd7:	83 ec 0c             	sub    $0xc,%esp
+    2bda:	68 1e 54 00 00       	push   $0x541e
+    2bdf:	e8 0d 1d 00 00       	call   48f1 <unlink>
+    2be4:	83 c4 10             	add    $0x10,%esp
+    2be7:	85 c0                	test   %eax,%eax
+    2be9:	75 17                	jne    2c02 <rmdot+0xc4>
+    printf(1, "rm .. worked!\n");
+    2beb:	83 ec 08             	sub    $0x8,%esp
+    2bee:	68 93 61 00 00       	push   $0x6193
+    2bf3:	6a 01                	push   $0x1
+    2bf5:	e8 4b 1e 00 00       	call   4a45 <printf>
+    2bfa:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2bfd:	e8 9f 1c 00 00       	call   48a1 <exit>
+  }
+  if(chdir("/") != 0){
+    2c02:	83 ec 0c             	sub    $0xc,%esp
+    2c05:	68 72 50 00 00       	push   $0x5072
+    2c0a:	e8 02 1d 00 00       	call   4911 <chdir>
+    2c0f:	83 c4 10             	add    $0x10,%esp
+    2c12:	85 c0                	test   %eax,%eax
+    2c14:	74 17                	je     2c2d <rmdot+0xef>
+    printf(1, "chdir / failed\n");
+    2c16:	83 ec 08             	sub    $0x8,%esp
+    2c19:	68 74 50 00 00       	push   $0x5074
+    2c1e:	6a 01                	push   $0x1
+    2c20:	e8 20 1e 00 00       	call   4a45 <printf>
+    2c25:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2c28:	e8 74 1c 00 00       	call   48a1 <exit>
+  }
+  if(unlink("dots/.") == 0){
+    2c2d:	83 ec 0c             	sub    $0xc,%esp
+    2c30:	68 a2 61 00 00       	push   $0x61a2
+    2c35:	e8 b7 1c 00 00       	call   48f1 <unlink>
+    2c3a:	83 c4 10             	add    $0x10,%esp
+    2c3d:	85 c0                	test   %eax,%eax
+    2c3f:	75 17                	jne    2c58 <rmdot+0x11a>
+    printf(1, "unlink dots/. worked!\n");
+    2c41:	83 ec 08             	sub    $0x8,%esp
+    2c44:	68 a9 61 00 00       	push   $0x61a9
+    2c49:	6a 01                	push   $0x1
+    2c4b:	e8 f5 1d 00 00       	call   4a45 <printf>
+    2c50:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2c53:	e8 49 1c 00 00       	call   48a1 <exit>
+  }
+  if(unlink("dots/..") == 0){
+    2c58:	83 ec 0c             	sub    $0xc,%esp
+    2c5b:	68 c0 61 00 00       	push   $0x61c0
+    2c60:	e8 8c 1c 00 00       	call   48f1 <unlink>
+    2c65:	83 c4 10             	add    $0x10,%esp
+    2c68:	85 c0                	test   %eax,%eax
+    2c6a:	75 17                	jne    2c83 <rmdot+0x145>
+    printf(1, "unlink dots/.. worked!\n");
+    2c6c:	83 ec 08             	sub    $0x8,%esp
+    2c6f:	68 c8 61 00 00       	push   $0x61c8
+    2c74:	6a 01                	push   $0x1
+    2c76:	e8 ca 1d 00 00       	call   4a45 <printf>
+    2c7b:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2c7e:	e8 1e 1c 00 00       	call   48a1 <exit>
+  }
+  if(unlink("dots") != 0){
+    2c83:	83 ec 0c             	sub    $0xc,%esp
+    2c86:	68 5a 61 00 00       	push   $0x615a
+    2c8b:	e8 61 1c 00 00       	call   48f1 <unlink>
+    2c90:	83 c4 10             	add    $0x10,%esp
+    2c93:	85 c0                	test   %eax,%eax
+    2c95:	74 17                	je     2cae <rmdot+0x170>
+    printf(1, "unlink dots failed!\n");
+    2c97:	83 ec 08             	sub    $0x8,%esp
+    2c9a:	68 e0 61 00 00       	push   $0x61e0
+    2c9f:	6a 01                	push   $0x1
+    2ca1:	e8 9f 1d 00 00       	call   4a45 <printf>
+    2ca6:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2ca9:	e8 f3 1b 00 00       	call   48a1 <exit>
+  }
+  printf(1, "rmdot ok\n");
+    2cae:	83 ec 08             	sub    $0x8,%esp
+    2cb1:	68 f5 61 00 00       	push   $0x61f5
+    2cb6:	6a 01                	push   $0x1
+    2cb8:	e8 88 1d 00 00       	call   4a45 <printf>
+    2cbd:	83 c4 10             	add    $0x10,%esp
+}
+    2cc0:	90                   	nop
+    2cc1:	c9                   	leave
+    2cc2:	c3                   	ret
+
+00002cc3 <dirfile>:
+
+void
+dirfile(void)
+{
+    2cc3:	55                   	push   %ebp
+    2cc4:	89 e5                	mov    %esp,%ebp
+    2cc6:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  printf(1, "dir vs file\n");
+    2cc9:	83 ec 08             	sub    $0x8,%esp
+    2ccc:	68 ff 61 00 00       	push   $0x61ff
+    2cd1:	6a 01                	push   $0x1
+    2cd3:	e8 6d 1d 00 00       	call   4a45 <printf>
+    2cd8:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("dirfile", O_CREATE);
+    2cdb:	83 ec 08             	sub    $0x8,%esp
+    2cde:	68 00 02 00 00       	push   $0x200
+    2ce3:	68 0c 62 00 00       	push   $0x620c
+    2ce8:	e8 f4 1b 00 00       	call   48e1 <open>
+    2ced:	83 c4 10             	add    $0x10,%esp
+    2cf0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    2cf3:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    2cf7:	79 17                	jns    2d10 <dirfile+0x4d>
+    printf(1, "create dirfile failed\n");
+    2cf9:	83 ec 08             	sub    $0x8,%esp
+    2cfc:	68 14 62 00 00       	push   $0x6214
+    2d01:	6a 01                	push   $0x1
+    2d03:	e8 3d 1d 00 00       	call   4a45 <printf>
+    2d08:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2d0b:	e8 91 1b 00 00       	call   48a1 <exit>
+  }
+  close(fd);
+    2d10:	83 ec 0c             	sub    $0xc,%esp
+    2d13:	ff 75 f4             	push   -0xc(%ebp)
+    2d16:	e8 ae 1b 00 00       	call   48c9 <close>
+    2d1b:	83 c4 10             	add    $0x10,%esp
+  if(chdir("dirfile") == 0){
+    2d1e:	83 ec 0c             	sub    $0xc,%esp
+    2d21:	68 0c 62 00 00       	push   $0x620c
+    2d26:	e8 e6 1b 00 00       	call   4911 <chdir>
+    2d2b:	83 c4 10             	add    $0x10,%esp
+    2d2e:	85 c0                	test   %eax,%eax
+    2d30:	75 17                	jne    2d49 <dirfile+0x86>
+    printf(1, "chdir dirfile succeeded!\n");
+    2d32:	83 ec 08             	sub    $0x8,%esp
+    2d35:	68 2b 62 00 00       	push   $0x622b
+    2d3a:	6a 01                	push   $0x1
+    2d3c:	e8 04 1d 00 00       	call   4a45 <printf>
+    2d41:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2d44:	e8 58 1b 00 00       	call   48a1 <exit>
+  }
+  fd = open("dirfile/xx", 0);
+    2d49:	83 ec 08             	sub    $0x8,%esp
+    2d4c:	6a 00                	push   $0x0
+    2d4e:	68 45 62 00 00       	push   $0x6245
+    2d53:	e8 89 1b 00 00       	call   48e1 <open>
+    2d58:	83 c4 10             	add    $0x10,%esp
+    2d5b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd >= 0){
+    2d5e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    2d62:	78 17                	js     2d7b <dirfile+0xb8>
+    printf(1, "create dirfile/xx succeeded!\n");
+    2d64:	83 ec 08             	sub    $0x8,%esp
+    2d67:	68 50 62 00 00       	push   $0x6250
+    2d6c:	6a 01                	push   $0x1
+    2d6e:	e8 d2 1c 00 00       	call   4a45 <printf>
+    2d73:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2d76:	e8 26 1b 00 00       	call   48a1 <exit>
+  }
+  fd = open("dirfile/xx", O_CREATE);
+    2d7b:	83 ec 08             	sub    $0x8,%esp
+    2d7e:	68 00 02 00 00       	push   $0x200
+    2d83:	68 45 62 00 00       	push   $0x6245
+    2d88:	e8 54 1b 00 00       	call   48e1 <open>
+    2d8d:	83 c4 10             	add    $0x10,%esp
+    2d90:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd >= 0){
+    2d93:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    2d97:	78 17                	js     2db0 <dirfile+0xed>
+    printf(1, "create dirfile/xx succeeded!\n");
+    2d99:	83 ec 08             	sub    $0x8,%esp
+    2d9c:	68 50 62 00 00       	push   $0x6250
+    2da1:	6a 01                	push   $0x1
+    2da3:	e8 9d 1c 00 00       	call   4a45 <printf>
+    2da8:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2dab:	e8 f1 1a 00 00       	call   48a1 <exit>
+  }
+  if(mkdir("dirfile/xx") == 0){
+    2db0:	83 ec 0c             	sub    $0xc,%esp
+    2db3:	68 45 62 00 00       	push   $0x6245
+    2db8:	e8 4c 1b 00 00       	call   4909 <mkdir>
+    2dbd:	83 c4 10             	add    $0x10,%esp
+    2dc0:	85 c0                	test   %eax,%eax
+    2dc2:	75 17                	jne    2ddb <dirfile+0x118>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    2dc4:	83 ec 08             	sub    $0x8,%esp
+    2dc7:	68 6e 62 00 00       	push   $0x626e
+    2dcc:	6a 01                	push   $0x1
+    2dce:	e8 72 1c 00 00       	call   4a45 <printf>
+    2dd3:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2dd6:	e8 c6 1a 00 00       	call   48a1 <exit>
+  }
+  if(unlink("dirfile/xx") == 0){
+    2ddb:	83 ec 0c             	sub    $0xc,%esp
+    2dde:	68 45 62 00 00       	push   $0x6245
+    2de3:	e8 09 1b 00 00       	call   48f1 <unlink>
+    2de8:	83 c4 10             	add    $0x10,%esp
+    2deb:	85 c0                	test   %eax,%eax
+    2ded:	75 17                	jne    2e06 <dirfile+0x143>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    2def:	83 ec 08             	sub    $0x8,%esp
+    2df2:	68 8b 62 00 00       	push   $0x628b
+    2df7:	6a 01                	push   $0x1
+    2df9:	e8 47 1c 00 00       	call   4a45 <printf>
+    2dfe:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2e01:	e8 9b 1a 00 00       	call   48a1 <exit>
+  }
+  if(link("README", "dirfile/xx") == 0){
+    2e06:	83 ec 08             	sub    $0x8,%esp
+    2e09:	68 45 62 00 00       	push   $0x6245
+    2e0e:	68 a9 62 00 00       	push   $0x62a9
+    2e13:	e8 e9 1a 00 00       	call   4901 <link>
+    2e18:	83 c4 10             	add    $0x10,%esp
+    2e1b:	85 c0                	test   %eax,%eax
+    2e1d:	75 17                	jne    2e36 <dirfile+0x173>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    2e1f:	83 ec 08             	sub    $0x8,%esp
+    2e22:	68 b0 62 00 00       	push   $0x62b0
+    2e27:	6a 01                	push   $0x1
+    2e29:	e8 17 1c 00 00       	call   4a45 <printf>
+    2e2e:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2e31:	e8 6b 1a 00 00       	call   48a1 <exit>
+  }
+  if(unlink("dirfile") != 0){
+    2e36:	83 ec 0c             	sub    $0xc,%esp
+    2e39:	68 0c 62 00 00       	push   $0x620c
+    2e3e:	e8 ae 1a 00 00       	call   48f1 <unlink>
+    2e43:	83 c4 10             	add    $0x10,%esp
+    2e46:	85 c0                	test   %eax,%eax
+    2e48:	74 17                	je     2e61 <dirfile+0x19e>
+    printf(1, "unlink dirfile failed!\n");
+    2e4a:	83 ec 08             	sub    $0x8,%esp
+    2e4d:	68 cf 62 00 00       	push   $0x62cf
+    2e52:	6a 01                	push   $0x1
+    2e54:	e8 ec 1b 00 00       	call   4a45 <printf>
+    2e59:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2e5c:	e8 40 1a 00 00       	call   48a1 <exit>
+  }
+
+  fd = open(".", O_RDWR);
+    2e61:	83 ec 08             	sub    $0x8,%esp
+    2e64:	6a 02                	push   $0x2
+    2e66:	68 8b 58 00 00       	push   $0x588b
+    2e6b:	e8 71 1a 00 00       	call   48e1 <open>
+    2e70:	83 c4 10             	add    $0x10,%esp
+    2e73:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd >= 0){
+    2e76:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    2e7a:	78 17                	js     2e93 <dirfile+0x1d0>
+    printf(1, "open . for writing succeeded!\n");
+    2e7c:	83 ec 08             	sub    $0x8,%esp
+    2e7f:	68 e8 62 00 00       	push   $0x62e8
+    2e84:	6a 01                	push   $0x1
+    2e86:	e8 ba 1b 00 00       	call   4a45 <printf>
+    2e8b:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2e8e:	e8 0e 1a 00 00       	call   48a1 <exit>
+  }
+  fd = open(".", 0);
+    2e93:	83 ec 08             	sub    $0x8,%esp
+    2e96:	6a 00                	push   $0x0
+    2e98:	68 8b 58 00 00       	push   $0x588b
+    2e9d:	e8 3f 1a 00 00       	call   48e1 <open>
+    2ea2:	83 c4 10             	add    $0x10,%esp
+    2ea5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(write(fd, "x", 1) > 0){
+    2ea8:	83 ec 04             	sub    $0x4,%esp
+    2eab:	6a 01                	push   $0x1
+    2ead:	68 d7 54 00 00       	push   $0x54d7
+    2eb2:	ff 75 f4             	push   -0xc(%ebp)
+    2eb5:	e8 07 1a 00 00       	call   48c1 <write>
+    2eba:	83 c4 10             	add    $0x10,%esp
+    2ebd:	85 c0                	test   %eax,%eax
+    2ebf:	7e 17                	jle    2ed8 <dirfile+0x215>
+    printf(1, "write . succeeded!\n");
+    2ec1:	83 ec 08             	sub    $0x8,%esp
+    2ec4:	68 07 63 00 00       	push   $0x6307
+    2ec9:	6a 01                	push   $0x1
+    2ecb:	e8 75 1b 00 00       	call   4a45 <printf>
+    2ed0:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2ed3:	e8 c9 19 00 00       	call   48a1 <exit>
+  }
+  close(fd);
+    2ed8:	83 ec 0c             	sub    $0xc,%esp
+    2edb:	ff 75 f4             	push   -0xc(%ebp)
+    2ede:	e8 e6 19 00 00       	call   48c9 <close>
+    2ee3:	83 c4 10             	add    $0x10,%esp
+
+  printf(1, "dir vs file OK\n");
+    2ee6:	83 ec 08             	sub    $0x8,%esp
+    2ee9:	68 1b 63 00 00       	push   $0x631b
+    2eee:	6a 01                	push   $0x1
+    2ef0:	e8 50 1b 00 00       	call   4a45 <printf>
+    2ef5:	83 c4 10             	add    $0x10,%esp
+}
+    2ef8:	90                   	nop
+    2ef9:	c9                   	leave
+    2efa:	c3                   	ret
+
+00002efb <iref>:
+
+// test that iput() is called at the end of _namei()
+void
+iref(void)
+{
+    2efb:	55                   	push   %ebp
+    2efc:	89 e5                	mov    %esp,%ebp
+    2efe:	83 ec 18             	sub    $0x18,%esp
+  int i, fd;
+
+  printf(1, "empty file name\n");
+    2f01:	83 ec 08             	sub    $0x8,%esp
+    2f04:	68 2b 63 00 00       	push   $0x632b
+    2f09:	6a 01                	push   $0x1
+    2f0b:	e8 35 1b 00 00       	call   4a45 <printf>
+    2f10:	83 c4 10             	add    $0x10,%esp
+
+  // the 50 is NINODE
+  for(i = 0; i < 50 + 1; i++){
+    2f13:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    2f1a:	e9 e7 00 00 00       	jmp    3006 <iref+0x10b>
+    if(mkdir("irefd") != 0){
+    2f1f:	83 ec 0c             	sub    $0xc,%esp
+    2f22:	68 3c 63 00 00       	push   $0x633c
+    2f27:	e8 dd 19 00 00       	call   4909 <mkdir>
+    2f2c:	83 c4 10             	add    $0x10,%esp
+    2f2f:	85 c0                	test   %eax,%eax
+    2f31:	74 17                	je     2f4a <iref+0x4f>
+      printf(1, "mkdir irefd failed\n");
+    2f33:	83 ec 08             	sub    $0x8,%esp
+    2f36:	68 42 63 00 00       	push   $0x6342
+    2f3b:	6a 01                	push   $0x1
+    2f3d:	e8 03 1b 00 00       	call   4a45 <printf>
+    2f42:	83 c4 10             	add    $0x10,%esp
+      exit();
+    2f45:	e8 57 19 00 00       	call   48a1 <exit>
+    }
+    if(chdir("irefd") != 0){
+    2f4a:	83 ec 0c             	sub    $0xc,%esp
+    2f4d:	68 3c 63 00 00       	push   $0x633c
+    2f52:	e8 ba 19 00 00       	call   4911 <chdir>
+    2f57:	83 c4 10             	add    $0x10,%esp
+    2f5a:	85 c0                	test   %eax,%eax
+    2f5c:	74 17                	je     2f75 <iref+0x7a>
+      printf(1, "chdir irefd failed\n");
+    2f5e:	83 ec 08             	sub    $0x8,%esp
+    2f61:	68 56 63 00 00       	push   $0x6356
+    2f66:	6a 01                	push   $0x1
+    2f68:	e8 d8 1a 00 00       	call   4a45 <printf>
+    2f6d:	83 c4 10             	add    $0x10,%esp
+      exit();
+    2f70:	e8 2c 19 00 00       	call   48a1 <exit>
+    }
+
+    mkdir("");
+    2f75:	83 ec 0c             	sub    $0xc,%esp
+    2f78:	68 6a 63 00 00       	push   $0x636a
+    2f7d:	e8 87 19 00 00       	call   4909 <mkdir>
+    2f82:	83 c4 10             	add    $0x10,%esp
+    link("README", "");
+    2f85:	83 ec 08             	sub    $0x8,%esp
+    2f88:	68 6a 63 00 00       	push   $0x636a
+    2f8d:	68 a9 62 00 00       	push   $0x62a9
+    2f92:	e8 6a 19 00 00       	call   4901 <link>
+    2f97:	83 c4 10             	add    $0x10,%esp
+    fd = open("", O_CREATE);
+    2f9a:	83 ec 08             	sub    $0x8,%esp
+    2f9d:	68 00 02 00 00       	push   $0x200
+    2fa2:	68 6a 63 00 00       	push   $0x636a
+    2fa7:	e8 35 19 00 00       	call   48e1 <open>
+    2fac:	83 c4 10             	add    $0x10,%esp
+    2faf:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(fd >= 0)
+    2fb2:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    2fb6:	78 0e                	js     2fc6 <iref+0xcb>
+      close(fd);
+    2fb8:	83 ec 0c             	sub    $0xc,%esp
+    2fbb:	ff 75 f0             	push   -0x10(%ebp)
+    2fbe:	e8 06 19 00 00       	call   48c9 <close>
+    2fc3:	83 c4 10             	add    $0x10,%esp
+    fd = open("xx", O_CREATE);
+    2fc6:	83 ec 08             	sub    $0x8,%esp
+    2fc9:	68 00 02 00 00       	push   $0x200
+    2fce:	68 6b 63 00 00       	push   $0x636b
+    2fd3:	e8 09 19 00 00       	call   48e1 <open>
+    2fd8:	83 c4 10             	add    $0x10,%esp
+    2fdb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(fd >= 0)
+    2fde:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    2fe2:	78 0e                	js     2ff2 <iref+0xf7>
+      close(fd);
+    2fe4:	83 ec 0c             	sub    $0xc,%esp
+    2fe7:	ff 75 f0             	push   -0x10(%ebp)
+    2fea:	e8 da 18 00 00       	call   48c9 <close>
+    2fef:	83 c4 10             	add    $0x10,%esp
+    unlink("xx");
+    2ff2:	83 ec 0c             	sub    $0xc,%esp
+    2ff5:	68 6b 63 00 00       	push   $0x636b
+    2ffa:	e8 f2 18 00 00       	call   48f1 <unlink>
+    2fff:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 50 + 1; i++){
+    3002:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    3006:	83 7d f4 32          	cmpl   $0x32,-0xc(%ebp)
+    300a:	0f 8e 0f ff ff ff    	jle    2f1f <iref+0x24>
+  }
+
+  chdir("/");
+    3010:	83 ec 0c             	sub    $0xc,%esp
+    3013:	68 72 50 00 00       	push   $0x5072
+    3018:	e8 f4 18 00 00       	call   4911 <chdir>
+    301d:	83 c4 10             	add    $0x10,%esp
+  printf(1, "empty file name OK\n");
+    3020:	83 ec 08             	sub    $0x8,%esp
+    3023:	68 6e 63 00 00       	push   $0x636e
+    3028:	6a 01                	push   $0x1
+    302a:	e8 16 1a 00 00       	call   4a45 <printf>
+    302f:	83 c4 10             	add    $0x10,%esp
+}
+    3032:	90                   	nop
+    3033:	c9                   	leave
+    3034:	c3                   	ret
+
+00003035 <forktest>:
+// test that fork fails gracefully
+// the forktest binary also does this, but it runs out of proc entries first.
+// inside the bigger usertests binary, we run out of memory first.
+void
+forktest(void)
+{
+    3035:	55                   	push   %ebp
+    3036:	89 e5                	mov    %esp,%ebp
+    3038:	83 ec 18             	sub    $0x18,%esp
+  int n, pid;
+
+  printf(1, "fork test\n");
+    303b:	83 ec 08             	sub    $0x8,%esp
+    303e:	68 82 63 00 00       	push   $0x6382
+    3043:	6a 01                	push   $0x1
+    3045:	e8 fb 19 00 00       	call   4a45 <printf>
+    304a:	83 c4 10             	add    $0x10,%esp
+
+  for(n=0; n<1000; n++){
+    304d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    3054:	eb 1d                	jmp    3073 <forktest+0x3e>
+    pid = fork();
+    3056:	e8 3e 18 00 00       	call   4899 <fork>
+    305b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(pid < 0)
+    305e:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    3062:	78 1a                	js     307e <forktest+0x49>
+      break;
+    if(pid == 0)
+    3064:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    3068:	75 05                	jne    306f <forktest+0x3a>
+      exit();
+    306a:	e8 32 18 00 00       	call   48a1 <exit>
+  for(n=0; n<1000; n++){
+    306f:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    3073:	81 7d f4 e7 03 00 00 	cmpl   $0x3e7,-0xc(%ebp)
+    307a:	7e da                	jle    3056 <forktest+0x21>
+    307c:	eb 01                	jmp    307f <forktest+0x4a>
+      break;
+    307e:	90                   	nop
+  }
+
+  if(n == 1000){
+    307f:	81 7d f4 e8 03 00 00 	cmpl   $0x3e8,-0xc(%ebp)
+    3086:	75 3b                	jne    30c3 <forktest+0x8e>
+    printf(1, "fork claimed to work 1000 times!\n");
+    3088:	83 ec 08             	sub    $0x8,%esp
+    308b:	68 90 63 00 00       	push   $0x6390
+    3090:	6a 01                	push   $0x1
+    3092:	e8 ae 19 00 00       	call   4a45 <printf>
+    3097:	83 c4 10             	add    $0x10,%esp
+    exit();
+    309a:	e8 02 18 00 00       	call   48a1 <exit>
+  }
+
+  for(; n > 0; n--){
+    if(wait() < 0){
+    309f:	e8 05 18 00 00       	call   48a9 <wait>
+    30a4:	85 c0                	test   %eax,%eax
+    30a6:	79 17                	jns    30bf <forktest+0x8a>
+      printf(1, "wait stopped early\n");
+    30a8:	83 ec 08             	sub    $0x8,%esp
+    30ab:	68 b2 63 00 00       	push   $0x63b2
+    30b0:	6a 01                	push   $0x1
+    30b2:	e8 8e 19 00 00       	call   4a45 <printf>
+    30b7:	83 c4 10             	add    $0x10,%esp
+      exit();
+    30ba:	e8 e2 17 00 00       	call   48a1 <exit>
+  for(; n > 0; n--){
+    30bf:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+    30c3:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    30c7:	7f d6                	jg     309f <forktest+0x6a>
+    }
+  }
+
+  if(wait() != -1){
+    30c9:	e8 db 17 00 00       	call   48a9 <wait>
+    30ce:	83 f8 ff             	cmp    $0xffffffff,%eax
+    30d1:	74 17                	je     30ea <forktest+0xb5>
+    printf(1, "wait got too many\n");
+    30d3:	83 ec 08             	sub    $0x8,%esp
+    30d6:	68 c6 63 00 00       	push   $0x63c6
+    30db:	6a 01                	push   $0x1
+    30dd:	e8 63 19 00 00       	call   4a45 <printf>
+    30e2:	83 c4 10             	add    $0x10,%esp
+    exit();
+    30e5:	e8 b7 17 00 00       	call   48a1 <exit>
+  }
+
+  printf(1, "fork test OK\n");
+    30ea:	83 ec 08             	sub    $0x8,%esp
+    30ed:	68 d9 63 00 00       	push   $0x63d9
+    30f2:	6a 01                	push   $0x1
+    30f4:	e8 4c 19 00 00       	call   4a45 <printf>
+    30f9:	83 c4 10             	add    $0x10,%esp
+}
+    30fc:	90                   	nop
+    30fd:	c9                   	leave
+    30fe:	c3                   	ret
+
+000030ff <cowtest>:
+
+// after fork, parent and child each see only their own writes
+// to pages they shared copy-on-write
+void
+cowtest(void)
+{
+    30ff:	55                   	push   %ebp
+    3100:	89 e5                	mov    %esp,%ebp
+    3102:	81 ec 88 00 00 00    	sub    $0x88,%esp
+  int fds[2], pid, ppid;
+  char *heap, stack[100], c;
+
+  printf(stdout, "cow test\n");
+    3108:	a1 14 80 00 00       	mov    0x8014,%eax
+    310d:	83 ec 08             	sub    $0x8,%esp
+    3110:	68 e7 63 00 00       	push   $0x63e7
+    3115:	50                   	push   %eax
+    3116:	e8 2a 19 00 00       	call   4a45 <printf>
+    311b:	83 c4 10             	add    $0x10,%esp
+  ppid = getpid();
+    311e:	e8 fe 17 00 00       	call   4921 <getpid>
+    3123:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  heap = sbrk(4096);
+    3126:	83 ec 0c             	sub    $0xc,%esp
+    3129:	68 00 10 00 00       	push   $0x1000
+    312e:	e8 f6 17 00 00       	call   4929 <sbrk>
+    3133:	83 c4 10             	add    $0x10,%esp
+    3136:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  heap[0] = 'h';
+    3139:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    313c:	c6 00 68             	movb   $0x68,(%eax)
+  cowdata[0] = 'd';
+    313f:	c6 05 20 80 00 00 64 	movb   $0x64,0x8020
+  stack[0] = 's';
+    3146:	c6 45 80 73          	movb   $0x73,-0x80(%ebp)
+  if(pipe(fds) != 0){
+    314a:	83 ec 0c             	sub    $0xc,%esp
+    314d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    3150:	50                   	push   %eax
+    3151:	e8 5b 17 00 00       	call   48b1 <pipe>
+    3156:	83 c4 10             	add    $0x10,%esp
+    3159:	85 c0                	test   %eax,%eax
+    315b:	74 1b                	je     3178 <cowtest+0x79>
+    printf(stdout, "pipe() failed\n");
+    315d:	a1 14 80 00 00       	mov    0x8014,%eax
+    3162:	83 ec 08             	sub    $0x8,%esp
+    3165:	68 72 54 00 00       	push   $0x5472
+    316a:	50                   	push   %eax
+    316b:	e8 d5 18 00 00       	call   4a45 <printf>
+    3170:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3173:	e8 29 17 00 00       	call   48a1 <exit>
+  }
+
+  // the parent writes after fork, the child must not see it
+  pid = fork();
+    3178:	e8 1c 17 00 00       	call   4899 <fork>
+    317d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(pid < 0){
+    3180:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    3184:	79 1b                	jns    31a1 <cowtest+0xa2>
+    printf(stdout, "fork failed\n");
+    3186:	a1 14 80 00 00       	mov    0x8014,%eax
+    318b:	83 ec 08             	sub    $0x8,%esp
+    318e:	68 a1 50 00 00       	push   $0x50a1
+    3193:	50                   	push   %eax
+    3194:	e8 ac 18 00 00       	call   4a45 <printf>
+    3199:	83 c4 10             	add    $0x10,%esp
+    exit();
+    319c:	e8 00 17 00 00       	call   48a1 <exit>
+  }
+  if(pid == 0){
+    31a1:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    31a5:	0f 85 a2 00 00 00    	jne    324d <cowtest+0x14e>
+    if(read(fds[0], &c, 1) != 1){
+    31ab:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    31ae:	83 ec 04             	sub    $0x4,%esp
+    31b1:	6a 01                	push   $0x1
+    31b3:	8d 95 7f ff ff ff    	lea    -0x81(%ebp),%edx
+    31b9:	52                   	push   %edx
+    31ba:	50                   	push   %eax
+    31bb:	e8 f9 16 00 00       	call   48b9 <read>
+    31c0:	83 c4 10             	add    $0x10,%esp
+    31c3:	83 f8 01             	cmp    $0x1,%eax
+    31c6:	74 29                	je     31f1 <cowtest+0xf2>
+      printf(stdout, "cow test read pipe failed\n");
+    31c8:	a1 14 80 00 00       	mov    0x8014,%eax
+    31cd:	83 ec 08             	sub    $0x8,%esp
+    31d0:	68 f1 63 00 00       	push   $0x63f1
+    31d5:	50                   	push   %eax
+    31d6:	e8 6a 18 00 00       	call   4a45 <printf>
+    31db:	83 c4 10             	add    $0x10,%esp
+      kill(ppid);
+    31de:	83 ec 0c             	sub    $0xc,%esp
+    31e1:	ff 75 f4             	push   -0xc(%ebp)
+    31e4:	e8 e8 16 00 00       	call   48d1 <kill>
+    31e9:	83 c4 10             	add    $0x10,%esp
+      exit();
+    31ec:	e8 b0 16 00 00       	call   48a1 <exit>
+    }
+    if(heap[0] != 'h' || cowdata[0] != 'd' || stack[0] != 's'){
+    31f1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    31f4:	0f b6 00             	movzbl (%eax),%eax
+    31f7:	3c 68                	cmp    $0x68,%al
+    31f9:	75 13                	jne    320e <cowtest+0x10f>
+    31fb:	0f b6 05 20 80 00 00 	movzbl 0x8020,%eax
+    3202:	3c 64                	cmp    $0x64,%al
+    3204:	75 08                	jne    320e <cowtest+0x10f>
+    3206:	0f b6 45 80          	movzbl -0x80(%ebp),%eax
+    320a:	3c 73                	cmp    $0x73,%al
+    320c:	74 29                	je     3237 <cowtest+0x138>
+      printf(stdout, "cow test: child sees parent's writes\n");
+    320e:	a1 14 80 00 00       	mov    0x8014,%eax
+    3213:	83 ec 08             	sub    $0x8,%esp
+    3216:	68 0c 64 00 00       	push   $0x640c
+    321b:	50                   	push   %eax
+    321c:	e8 24 18 00 00       	call   4a45 <printf>
+    3221:	83 c4 10             	add    $0x10,%esp
+      kill(ppid);
+    3224:	83 ec 0c             	sub    $0xc,%esp
+    3227:	ff 75 f4             	push   -0xc(%ebp)
+    322a:	e8 a2 16 00 00       	call   48d1 <kill>
+    322f:	83 c4 10             	add    $0x10,%esp
+      exit();
+    3232:	e8 6a 16 00 00       	call   48a1 <exit>
+    }
+    // and the parent must not see the child's
+    heap[0] = 'c';
+    3237:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    323a:	c6 00 63             	movb   $0x63,(%eax)
+    cowdata[0] = 'c';
+    323d:	c6 05 20 80 00 00 63 	movb   $0x63,0x8020
+    stack[0] = 'c';
+    3244:	c6 45 80 63          	movb   $0x63,-0x80(%ebp)
+    exit();
+    3248:	e8 54 16 00 00       	call   48a1 <exit>
+  }
+  heap[0] = 'H';
+    324d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    3250:	c6 00 48             	movb   $0x48,(%eax)
+  cowdata[0] = 'D';
+    3253:	c6 05 20 80 00 00 44 	movb   $0x44,0x8020
+  stack[0] = 'S';
+    325a:	c6 45 80 53          	movb   $0x53,-0x80(%ebp)
+  write(fds[1], "x", 1);
+    325e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    3261:	83 ec 04             	sub    $0x4,%esp
+    3264:	6a 01                	push   $0x1
+    3266:	68 d7 54 00 00       	push   $0x54d7
+    326b:	50                   	push   %eax
+    326c:	e8 50 16 00 00       	call   48c1 <write>
+    3271:	83 c4 10             	add    $0x10,%esp
+  wait();
+    3274:	e8 30 16 00 00       	call   48a9 <wait>
+  if(heap[0] != 'H' || cowdata[0] != 'D' || stack[0] != 'S'){
+    3279:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    327c:	0f b6 00             	movzbl (%eax),%eax
+    327f:	3c 48                	cmp    $0x48,%al
+    3281:	75 13                	jne    3296 <cowtest+0x197>
+    3283:	0f b6 05 20 80 00 00 	movzbl 0x8020,%eax
+    328a:	3c 44                	cmp    $0x44,%al
+    328c:	75 08                	jne    3296 <cowtest+0x197>
+    328e:	0f b6 45 80          	movzbl -0x80(%ebp),%eax
+    3292:	3c 53                	cmp    $0x53,%al
+    3294:	74 1b                	je     32b1 <cowtest+0x1b2>
+    printf(stdout, "cow test: parent sees child's writes\n");
+    3296:	a1 14 80 00 00       	mov    0x8014,%eax
+    329b:	83 ec 08             	sub    $0x8,%esp
+    329e:	68 34 64 00 00       	push   $0x6434
+    32a3:	50                   	push   %eax
+    32a4:	e8 9c 17 00 00       	call   4a45 <printf>
+    32a9:	83 c4 10             	add    $0x10,%esp
+    exit();
+    32ac:	e8 f0 15 00 00       	call   48a1 <exit>
+  }
+
+  // the kernel writing into copy-on-write pages (read into
+  // a dirty heap page and a dirty stack buffer)
+  pid = fork();
+    32b1:	e8 e3 15 00 00       	call   4899 <fork>
+    32b6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(pid < 0){
+    32b9:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    32bd:	79 1b                	jns    32da <cowtest+0x1db>
+    printf(stdout, "fork failed\n");
+    32bf:	a1 14 80 00 00       	mov    0x8014,%eax
+    32c4:	83 ec 08             	sub    $0x8,%esp
+    32c7:	68 a1 50 00 00       	push   $0x50a1
+    32cc:	50                   	push   %eax
+    32cd:	e8 73 17 00 00       	call   4a45 <printf>
+    32d2:	83 c4 10             	add    $0x10,%esp
+    exit();
+    32d5:	e8 c7 15 00 00       	call   48a1 <exit>
+  }
+  if(pid == 0){
+    32da:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    32de:	0f 85 b1 00 00 00    	jne    3395 <cowtest+0x296>
+    if(read(fds[0], heap, 5) != 5 || read(fds[0], stack, 5) != 5){
+    32e4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    32e7:	83 ec 04             	sub    $0x4,%esp
+    32ea:	6a 05                	push   $0x5
+    32ec:	ff 75 f0             	push   -0x10(%ebp)
+    32ef:	50                   	push   %eax
+    32f0:	e8 c4 15 00 00       	call   48b9 <read>
+    32f5:	83 c4 10             	add    $0x10,%esp
+    32f8:	83 f8 05             	cmp    $0x5,%eax
+    32fb:	75 1a                	jne    3317 <cowtest+0x218>
+    32fd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    3300:	83 ec 04             	sub    $0x4,%esp
+    3303:	6a 05                	push   $0x5
+    3305:	8d 55 80             	lea    -0x80(%ebp),%edx
+    3308:	52                   	push   %edx
+    3309:	50                   	push   %eax
+    330a:	e8 aa 15 00 00       	call   48b9 <read>
+    330f:	83 c4 10             	add    $0x10,%esp
+    3312:	83 f8 05             	cmp    $0x5,%eax
+    3315:	74 29                	je     3340 <cowtest+0x241>
+      printf(stdout, "cow test: read into cow page failed\n");
+    3317:	a1 14 80 00 00       	mov    0x8014,%eax
+    331c:	83 ec 08             	sub    $0x8,%esp
+    331f:	68 5c 64 00 00       	push   $0x645c
+    3324:	50                   	push   %eax
+    3325:	e8 1b 17 00 00       	call   4a45 <printf>
+    332a:	83 c4 10             	add    $0x10,%esp
+      kill(ppid);
+    332d:	83 ec 0c             	sub    $0xc,%esp
+    3330:	ff 75 f4             	push   -0xc(%ebp)
+    3333:	e8 99 15 00 00       	call   48d1 <kill>
+    3338:	83 c4 10             	add    $0x10,%esp
+      exit();
+    333b:	e8 61 15 00 00       	call   48a1 <exit>
+    }
+    if(heap[0] != '0' || heap[4] != '4' || stack[0] != '5' || stack[4] != '9'){
+    3340:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    3343:	0f b6 00             	movzbl (%eax),%eax
+    3346:	3c 30                	cmp    $0x30,%al
+    3348:	75 1d                	jne    3367 <cowtest+0x268>
+    334a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    334d:	83 c0 04             	add    $0x4,%eax
+    3350:	0f b6 00             	movzbl (%eax),%eax
+    3353:	3c 34                	cmp    $0x34,%al
+    3355:	75 10                	jne    3367 <cowtest+0x268>
+    3357:	0f b6 45 80          	movzbl -0x80(%ebp),%eax
+    335b:	3c 35                	cmp    $0x35,%al
+    335d:	75 08                	jne    3367 <cowtest+0x268>
+    335f:	0f b6 45 84          	movzbl -0x7c(%ebp),%eax
+    3363:	3c 39                	cmp    $0x39,%al
+    3365:	74 29                	je     3390 <cowtest+0x291>
+      printf(stdout, "cow test: read into cow page wrong\n");
+    3367:	a1 14 80 00 00       	mov    0x8014,%eax
+    336c:	83 ec 08             	sub    $0x8,%esp
+    336f:	68 84 64 00 00       	push   $0x6484
+    3374:	50                   	push   %eax
+    3375:	e8 cb 16 00 00       	call   4a45 <printf>
+    337a:	83 c4 10             	add    $0x10,%esp
+      kill(ppid);
+    337d:	83 ec 0c             	sub    $0xc,%esp
+    3380:	ff 75 f4             	push   -0xc(%ebp)
+    3383:	e8 49 15 00 00       	call   48d1 <kill>
+    3388:	83 c4 10             	add    $0x10,%esp
+      exit();
+    338b:	e8 11 15 00 00       	call   48a1 <exit>
+    }
+    exit();
+    3390:	e8 0c 15 00 00       	call   48a1 <exit>
+  }
+  write(fds[1], "0123456789", 10);
+    3395:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    3398:	83 ec 04             	sub    $0x4,%esp
+    339b:	6a 0a                	push   $0xa
+    339d:	68 a8 64 00 00       	push   $0x64a8
+    33a2:	50                   	push   %eax
+    33a3:	e8 19 15 00 00       	call   48c1 <write>
+    33a8:	83 c4 10             	add    $0x10,%esp
+  wait();
+    33ab:	e8 f9 14 00 00       	call   48a9 <wait>
+  if(heap[0] != 'H' || stack[0] != 'S'){
+    33b0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    33b3:	0f b6 00             	movzbl (%eax),%eax
+    33b6:	3c 48                	cmp    $0x48,%al
+    33b8:	75 08                	jne    33c2 <cowtest+0x2c3>
+    33ba:	0f b6 45 80          	movzbl -0x80(%ebp),%eax
+    33be:	3c 53                	cmp    $0x53,%al
+    33c0:	74 1b                	je     33dd <cowtest+0x2de>
+    printf(stdout, "cow test: child's read reached the parent\n");
+    33c2:	a1 14 80 00 00       	mov    0x8014,%eax
+    33c7:	83 ec 08             	sub    $0x8,%esp
+    33ca:	68 b4 64 00 00       	push   $0x64b4
+    33cf:	50                   	push   %eax
+    33d0:	e8 70 16 00 00       	call   4a45 <printf>
+    33d5:	83 c4 10             	add    $0x10,%esp
+    exit();
+    33d8:	e8 c4 14 00 00       	call   48a1 <exit>
+  }
+
+  close(fds[0]);
+    33dd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    33e0:	83 ec 0c             	sub    $0xc,%esp
+    33e3:	50                   	push   %eax
+    33e4:	e8 e0 14 00 00       	call   48c9 <close>
+    33e9:	83 c4 10             	add    $0x10,%esp
+  close(fds[1]);
+    33ec:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    33ef:	83 ec 0c             	sub    $0xc,%esp
+    33f2:	50                   	push   %eax
+    33f3:	e8 d1 14 00 00       	call   48c9 <close>
+    33f8:	83 c4 10             	add    $0x10,%esp
+  sbrk(-4096);
+    33fb:	83 ec 0c             	sub    $0xc,%esp
+    33fe:	68 00 f0 ff ff       	push   $0xfffff000
+    3403:	e8 21 15 00 00       	call   4929 <sbrk>
+    3408:	83 c4 10             	add    $0x10,%esp
+  printf(stdout, "cow test ok\n");
+    340b:	a1 14 80 00 00       	mov    0x8014,%eax
+    3410:	83 ec 08             	sub    $0x8,%esp
+    3413:	68 df 64 00 00       	push   $0x64df
+    3418:	50                   	push   %eax
+    3419:	e8 27 16 00 00       	call   4a45 <printf>
+    341e:	83 c4 10             	add    $0x10,%esp
+}
+    3421:	90                   	nop
+    3422:	c9                   	leave
+    3423:	c3                   	ret
+
+00003424 <mmaptest>:
+
+// mmap(): shared and private file mappings, munmap(),
+// fork, and system calls on mapped memory
+void
+mmaptest(void)
+{
+    3424:	55                   	push   %ebp
+    3425:	89 e5                	mov    %esp,%ebp
+    3427:	83 ec 28             	sub    $0x28,%esp
+  int fd, i, pid, ppid;
+  char *p, *q, c;
+
+  printf(stdout, "mmap test\n");
+    342a:	a1 14 80 00 00       	mov    0x8014,%eax
+    342f:	83 ec 08             	sub    $0x8,%esp
+    3432:	68 ec 64 00 00       	push   $0x64ec
+    3437:	50                   	push   %eax
+    3438:	e8 08 16 00 00       	call   4a45 <printf>
+    343d:	83 c4 10             	add    $0x10,%esp
+  ppid = getpid();
+    3440:	e8 dc 14 00 00       	call   4921 <getpid>
+    3445:	89 45 f0             	mov    %eax,-0x10(%ebp)
+
+  for(i = 0; i < sizeof(buf); i++)
+    3448:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    344f:	eb 33                	jmp    3484 <mmaptest+0x60>
+    buf[i] = 'a' + i % 23;
+    3451:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    3454:	ba c9 42 16 b2       	mov    $0xb21642c9,%edx
+    3459:	89 c8                	mov    %ecx,%eax
+    345b:	f7 ea                	imul   %edx
+    345d:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+    3460:	c1 f8 04             	sar    $0x4,%eax
+    3463:	89 ca                	mov    %ecx,%edx
+    3465:	c1 fa 1f             	sar    $0x1f,%edx
+    3468:	29 d0                	sub    %edx,%eax
+    346a:	6b d0 17             	imul   $0x17,%eax,%edx
+    346d:	89 c8                	mov    %ecx,%eax
+    346f:	29 d0                	sub    %edx,%eax
+    3471:	83 c0 61             	add    $0x61,%eax
+    3474:	89 c2                	mov    %eax,%edx
+    3476:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3479:	05 a0 80 00 00       	add    $0x80a0,%eax
+    347e:	88 10                	mov    %dl,(%eax)
+  for(i = 0; i < sizeof(buf); i++)
+    3480:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    3484:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3487:	3d ff 1f 00 00       	cmp    $0x1fff,%eax
+    348c:	76 c3                	jbe    3451 <mmaptest+0x2d>
+  fd = open("mmapfile", O_CREATE|O_RDWR);
+    348e:	83 ec 08             	sub    $0x8,%esp
+    3491:	68 02 02 00 00       	push   $0x202
+    3496:	68 f7 64 00 00       	push   $0x64f7
+    349b:	e8 41 14 00 00       	call   48e1 <open>
+    34a0:	83 c4 10             	add    $0x10,%esp
+    34a3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(fd < 0 || write(fd, buf, sizeof(buf)) != sizeof(buf)){
+    34a6:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    34aa:	78 1f                	js     34cb <mmaptest+0xa7>
+    34ac:	83 ec 04             	sub    $0x4,%esp
+    34af:	68 00 20 00 00       	push   $0x2000
+    34b4:	68 a0 80 00 00       	push   $0x80a0
+    34b9:	ff 75 ec             	push   -0x14(%ebp)
+    34bc:	e8 00 14 00 00       	call   48c1 <write>
+    34c1:	83 c4 10             	add    $0x10,%esp
+    34c4:	3d 00 20 00 00       	cmp    $0x2000,%eax
+    34c9:	74 1b                	je     34e6 <mmaptest+0xc2>
+    printf(stdout, "mmap test: cannot write mmapfile\n");
+    34cb:	a1 14 80 00 00       	mov    0x8014,%eax
+    34d0:	83 ec 08             	sub    $0x8,%esp
+    34d3:	68 00 65 00 00       	push   $0x6500
+    34d8:	50                   	push   %eax
+    34d9:	e8 67 15 00 00       	call   4a45 <printf>
+    34de:	83 c4 10             	add    $0x10,%esp
+    exit();
+    34e1:	e8 bb 13 00 00       	call   48a1 <exit>
+  }
+  close(fd);
+    34e6:	83 ec 0c             	sub    $0xc,%esp
+    34e9:	ff 75 ec             	push   -0x14(%ebp)
+    34ec:	e8 d8 13 00 00       	call   48c9 <close>
+    34f1:	83 c4 10             	add    $0x10,%esp
+
+  // a shared read-only mapping has the file's bytes
+  fd = open("mmapfile", O_RDONLY);
+    34f4:	83 ec 08             	sub    $0x8,%esp
+    34f7:	6a 00                	push   $0x0
+    34f9:	68 f7 64 00 00       	push   $0x64f7
+    34fe:	e8 de 13 00 00       	call   48e1 <open>
+    3503:	83 c4 10             	add    $0x10,%esp
+    3506:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  p = mmap(0, sizeof(buf), PROT_READ, MAP_SHARED, fd, 0);
+    3509:	83 ec 08             	sub    $0x8,%esp
+    350c:	6a 00                	push   $0x0
+    350e:	ff 75 ec             	push   -0x14(%ebp)
+    3511:	6a 01                	push   $0x1
+    3513:	6a 01                	push   $0x1
+    3515:	68 00 20 00 00       	push   $0x2000
+    351a:	6a 00                	push   $0x0
+    351c:	e8 40 14 00 00       	call   4961 <mmap>
+    3521:	83 c4 20             	add    $0x20,%esp
+    3524:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if(p == MAP_FAILED){
+    3527:	83 7d e8 ff          	cmpl   $0xffffffff,-0x18(%ebp)
+    352b:	75 1b                	jne    3548 <mmaptest+0x124>
+    printf(stdout, "mmap shared failed\n");
+    352d:	a1 14 80 00 00       	mov    0x8014,%eax
+    3532:	83 ec 08             	sub    $0x8,%esp
+    3535:	68 22 65 00 00       	push   $0x6522
+    353a:	50                   	push   %eax
+    353b:	e8 05 15 00 00       	call   4a45 <printf>
+    3540:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3543:	e8 59 13 00 00       	call   48a1 <exit>
+  }
+  for(i = 0; i < sizeof(buf); i++){
+    3548:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    354f:	eb 3c                	jmp    358d <mmaptest+0x169>
+    if(p[i] != buf[i]){
+    3551:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    3554:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    3557:	01 d0                	add    %edx,%eax
+    3559:	0f b6 10             	movzbl (%eax),%edx
+    355c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    355f:	05 a0 80 00 00       	add    $0x80a0,%eax
+    3564:	0f b6 00             	movzbl (%eax),%eax
+    3567:	38 c2                	cmp    %al,%dl
+    3569:	74 1e                	je     3589 <mmaptest+0x165>
+      printf(stdout, "mmap shared: wrong byte at %d\n", i);
+    356b:	a1 14 80 00 00       	mov    0x8014,%eax
+    3570:	83 ec 04             	sub    $0x4,%esp
+    3573:	ff 75 f4             	push   -0xc(%ebp)
+    3576:	68 38 65 00 00       	push   $0x6538
+    357b:	50                   	push   %eax
+    357c:	e8 c4 14 00 00       	call   4a45 <printf>
+    3581:	83 c4 10             	add    $0x10,%esp
+      exit();
+    3584:	e8 18 13 00 00       	call   48a1 <exit>
+  for(i = 0; i < sizeof(buf); i++){
+    3589:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    358d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3590:	3d ff 1f 00 00       	cmp    $0x1fff,%eax
+    3595:	76 ba                	jbe    3551 <mmaptest+0x12d>
+    }
+  }
+
+  // writes to a private mapping do not reach the file
+  q = mmap(0, sizeof(buf), PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, 0);
+    3597:	83 ec 08             	sub    $0x8,%esp
+    359a:	6a 00                	push   $0x0
+    359c:	ff 75 ec             	push   -0x14(%ebp)
+    359f:	6a 02                	push   $0x2
+    35a1:	6a 03                	push   $0x3
+    35a3:	68 00 20 00 00       	push   $0x2000
+    35a8:	6a 00                	push   $0x0
+    35aa:	e8 b2 13 00 00       	call   4961 <mmap>
+    35af:	83 c4 20             	add    $0x20,%esp
+    35b2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(q == MAP_FAILED){
+    35b5:	83 7d e4 ff          	cmpl   $0xffffffff,-0x1c(%ebp)
+    35b9:	75 1b                	jne    35d6 <mmaptest+0x1b2>
+    printf(stdout, "mmap private failed\n");
+    35bb:	a1 14 80 00 00       	mov    0x8014,%eax
+    35c0:	83 ec 08             	sub    $0x8,%esp
+    35c3:	68 57 65 00 00       	push   $0x6557
+    35c8:	50                   	push   %eax
+    35c9:	e8 77 14 00 00       	call   4a45 <printf>
+    35ce:	83 c4 10             	add    $0x10,%esp
+    exit();
+    35d1:	e8 cb 12 00 00       	call   48a1 <exit>
+  }
+  q[0] = 'X';
+    35d6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    35d9:	c6 00 58             	movb   $0x58,(%eax)
+  q[4097] = 'Y';
+    35dc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    35df:	05 01 10 00 00       	add    $0x1001,%eax
+    35e4:	c6 00 59             	movb   $0x59,(%eax)
+  close(fd);
+    35e7:	83 ec 0c             	sub    $0xc,%esp
+    35ea:	ff 75 ec             	push   -0x14(%ebp)
+    35ed:	e8 d7 12 00 00       	call   48c9 <close>
+    35f2:	83 c4 10             	add    $0x10,%esp
+  fd = open("mmapfile", O_RDONLY);
+    35f5:	83 ec 08             	sub    $0x8,%esp
+    35f8:	6a 00                	push   $0x0
+    35fa:	68 f7 64 00 00       	push   $0x64f7
+    35ff:	e8 dd 12 00 00       	call   48e1 <open>
+    3604:	83 c4 10             	add    $0x10,%esp
+    3607:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(read(fd, &c, 1) != 1 || c != buf[0] || p[0] != buf[0] || p[4097] != buf[4097]){
+    360a:	83 ec 04             	sub    $0x4,%esp
+    360d:	6a 01                	push   $0x1
+    360f:	8d 45 df             	lea    -0x21(%ebp),%eax
+    3612:	50                   	push   %eax
+    3613:	ff 75 ec             	push   -0x14(%ebp)
+    3616:	e8 9e 12 00 00       	call   48b9 <read>
+    361b:	83 c4 10             	add    $0x10,%esp
+    361e:	83 f8 01             	cmp    $0x1,%eax
+    3621:	75 36                	jne    3659 <mmaptest+0x235>
+    3623:	0f b6 15 a0 80 00 00 	movzbl 0x80a0,%edx
+    362a:	0f b6 45 df          	movzbl -0x21(%ebp),%eax
+    362e:	38 c2                	cmp    %al,%dl
+    3630:	75 27                	jne    3659 <mmaptest+0x235>
+    3632:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    3635:	0f b6 10             	movzbl (%eax),%edx
+    3638:	0f b6 05 a0 80 00 00 	movzbl 0x80a0,%eax
+    363f:	38 c2                	cmp    %al,%dl
+    3641:	75 16                	jne    3659 <mmaptest+0x235>
+    3643:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    3646:	05 01 10 00 00       	add    $0x1001,%eax
+    364b:	0f b6 10             	movzbl (%eax),%edx
+    364e:	0f b6 05 a1 90 00 00 	movzbl 0x90a1,%eax
+    3655:	38 c2                	cmp    %al,%dl
+    3657:	74 1b                	je     3674 <mmaptest+0x250>
+    printf(stdout, "mmap private: write reached the file\n");
+    3659:	a1 14 80 00 00       	mov    0x8014,%eax
+    365e:	83 ec 08             	sub    $0x8,%esp
+    3661:	68 6c 65 00 00       	push   $0x656c
+    3666:	50                   	push   %eax
+    3667:	e8 d9 13 00 00       	call   4a45 <printf>
+    366c:	83 c4 10             	add    $0x10,%esp
+    exit();
+    366f:	e8 2d 12 00 00       	call   48a1 <exit>
+  }
+
+  // read() into a mapped buffer, and not into a read-only one
+  if(read(fd, q + 100, 200) != 200){
+    3674:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    3677:	83 c0 64             	add    $0x64,%eax
+    367a:	83 ec 04             	sub    $0x4,%esp
+    367d:	68 c8 00 00 00       	push   $0xc8
+    3682:	50                   	push   %eax
+    3683:	ff 75 ec             	push   -0x14(%ebp)
+    3686:	e8 2e 12 00 00       	call   48b9 <read>
+    368b:	83 c4 10             	add    $0x10,%esp
+    368e:	3d c8 00 00 00       	cmp    $0xc8,%eax
+    3693:	74 1b                	je     36b0 <mmaptest+0x28c>
+    printf(stdout, "mmap: read into mapping failed\n");
+    3695:	a1 14 80 00 00       	mov    0x8014,%eax
+    369a:	83 ec 08             	sub    $0x8,%esp
+    369d:	68 94 65 00 00       	push   $0x6594
+    36a2:	50                   	push   %eax
+    36a3:	e8 9d 13 00 00       	call   4a45 <printf>
+    36a8:	83 c4 10             	add    $0x10,%esp
+    exit();
+    36ab:	e8 f1 11 00 00       	call   48a1 <exit>
+  }
+  for(i = 0; i < 200; i++){
+    36b0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    36b7:	eb 40                	jmp    36f9 <mmaptest+0x2d5>
+    if(q[100 + i] != buf[1 + i]){
+    36b9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    36bc:	83 c0 64             	add    $0x64,%eax
+    36bf:	89 c2                	mov    %eax,%edx
+    36c1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    36c4:	01 d0                	add    %edx,%eax
+    36c6:	0f b6 10             	movzbl (%eax),%edx
+    36c9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    36cc:	83 c0 01             	add    $0x1,%eax
+    36cf:	0f b6 80 a0 80 00 00 	movzbl 0x80a0(%eax),%eax
+    36d6:	38 c2                	cmp    %al,%dl
+    36d8:	74 1b                	je     36f5 <mmaptest+0x2d1>
+      printf(stdout, "mmap: read into mapping wrong\n");
+    36da:	a1 14 80 00 00       	mov    0x8014,%eax
+    36df:	83 ec 08             	sub    $0x8,%esp
+    36e2:	68 b4 65 00 00       	push   $0x65b4
+    36e7:	50                   	push   %eax
+    36e8:	e8 58 13 00 00       	call   4a45 <printf>
+    36ed:	83 c4 10             	add    $0x10,%esp
+      exit();
+    36f0:	e8 ac 11 00 00       	call   48a1 <exit>
+  for(i = 0; i < 200; i++){
+    36f5:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    36f9:	81 7d f4 c7 00 00 00 	cmpl   $0xc7,-0xc(%ebp)
+    3700:	7e b7                	jle    36b9 <mmaptest+0x295>
+    }
+  }
+  if(read(fd, p, 10) >= 0){
+    3702:	83 ec 04             	sub    $0x4,%esp
+    3705:	6a 0a                	push   $0xa
+    3707:	ff 75 e8             	push   -0x18(%ebp)
+    370a:	ff 75 ec             	push   -0x14(%ebp)
+    370d:	e8 a7 11 00 00       	call   48b9 <read>
+    3712:	83 c4 10             	add    $0x10,%esp
+    3715:	85 c0                	test   %eax,%eax
+    3717:	78 1b                	js     3734 <mmaptest+0x310>
+    printf(stdout, "mmap: read into read-only mapping succeeded\n");
+    3719:	a1 14 80 00 00       	mov    0x8014,%eax
+    371e:	83 ec 08             	sub    $0x8,%esp
+    3721:	68 d4 65 00 00       	push   $0x65d4
+    3726:	50                   	push   %eax
+    3727:	e8 19 13 00 00       	call   4a45 <printf>
+    372c:	83 c4 10             	add    $0x10,%esp
+    exit();
+    372f:	e8 6d 11 00 00       	call   48a1 <exit>
+  }
+  close(fd);
+    3734:	83 ec 0c             	sub    $0xc,%esp
+    3737:	ff 75 ec             	push   -0x14(%ebp)
+    373a:	e8 8a 11 00 00       	call   48c9 <close>
+    373f:	83 c4 10             	add    $0x10,%esp
+
+  // a forked child sees the parent's private pages
+  pid = fork();
+    3742:	e8 52 11 00 00       	call   4899 <fork>
+    3747:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(pid < 0){
+    374a:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+    374e:	79 1b                	jns    376b <mmaptest+0x347>
+    printf(stdout, "fork failed\n");
+    3750:	a1 14 80 00 00       	mov    0x8014,%eax
+    3755:	83 ec 08             	sub    $0x8,%esp
+    3758:	68 a1 50 00 00       	push   $0x50a1
+    375d:	50                   	push   %eax
+    375e:	e8 e2 12 00 00       	call   4a45 <printf>
+    3763:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3766:	e8 36 11 00 00       	call   48a1 <exit>
+  }
+  if(pid == 0){
+    376b:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+    376f:	75 5c                	jne    37cd <mmaptest+0x3a9>
+    if(q[0] != 'X' || q[4097] != 'Y' || q[100] != buf[1]){
+    3771:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    3774:	0f b6 00             	movzbl (%eax),%eax
+    3777:	3c 58                	cmp    $0x58,%al
+    3779:	75 23                	jne    379e <mmaptest+0x37a>
+    377b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    377e:	05 01 10 00 00       	add    $0x1001,%eax
+    3783:	0f b6 00             	movzbl (%eax),%eax
+    3786:	3c 59                	cmp    $0x59,%al
+    3788:	75 14                	jne    379e <mmaptest+0x37a>
+    378a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    378d:	83 c0 64             	add    $0x64,%eax
+    3790:	0f b6 10             	movzbl (%eax),%edx
+    3793:	0f b6 05 a1 80 00 00 	movzbl 0x80a1,%eax
+    379a:	38 c2                	cmp    %al,%dl
+    379c:	74 24                	je     37c2 <mmaptest+0x39e>
+      printf(stdout, "mmap: child does not see private pages\n");
+    379e:	a1 14 80 00 00       	mov    0x8014,%eax
+    37a3:	83 ec 08             	sub    $0x8,%esp
+    37a6:	68 04 66 00 00       	push   $0x6604
+    37ab:	50                   	push   %eax
+    37ac:	e8 94 12 00 00       	call   4a45 <printf>
+    37b1:	83 c4 10             	add    $0x10,%esp
+      kill(ppid);
+    37b4:	83 ec 0c             	sub    $0xc,%esp
+    37b7:	ff 75 f0             	push   -0x10(%ebp)
+    37ba:	e8 12 11 00 00       	call   48d1 <kill>
+    37bf:	83 c4 10             	add    $0x10,%esp
+    }
+    q[0] = 'Z';
+    37c2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    37c5:	c6 00 5a             	movb   $0x5a,(%eax)
+    exit();
+    37c8:	e8 d4 10 00 00       	call   48a1 <exit>
+  }
+  wait();
+    37cd:	e8 d7 10 00 00       	call   48a9 <wait>
+  if(q[0] != 'X'){
+    37d2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    37d5:	0f b6 00             	movzbl (%eax),%eax
+    37d8:	3c 58                	cmp    $0x58,%al
+    37da:	74 1b                	je     37f7 <mmaptest+0x3d3>
+    printf(stdout, "mmap: child's write reached the parent\n");
+    37dc:	a1 14 80 00 00       	mov    0x8014,%eax
+    37e1:	83 ec 08             	sub    $0x8,%esp
+    37e4:	68 2c 66 00 00       	push   $0x662c
+    37e9:	50                   	push   %eax
+    37ea:	e8 56 12 00 00       	call   4a45 <printf>
+    37ef:	83 c4 10             	add    $0x10,%esp
+    exit();
+    37f2:	e8 aa 10 00 00       	call   48a1 <exit>
+  }
+
+  // touching a page after munmap() kills the process
+  if(munmap(p, sizeof(buf)) != 0 || munmap(q, sizeof(buf)) != 0){
+    37f7:	83 ec 08             	sub    $0x8,%esp
+    37fa:	68 00 20 00 00       	push   $0x2000
+    37ff:	ff 75 e8             	push   -0x18(%ebp)
+    3802:	e8 62 11 00 00       	call   4969 <munmap>
+    3807:	83 c4 10             	add    $0x10,%esp
+    380a:	85 c0                	test   %eax,%eax
+    380c:	75 17                	jne    3825 <mmaptest+0x401>
+    380e:	83 ec 08             	sub    $0x8,%esp
+    3811:	68 00 20 00 00       	push   $0x2000
+    3816:	ff 75 e4             	push   -0x1c(%ebp)
+    3819:	e8 4b 11 00 00       	call   4969 <munmap>
+    381e:	83 c4 10             	add    $0x10,%esp
+    3821:	85 c0                	test   %eax,%eax
+    3823:	74 1b                	je     3840 <mmaptest+0x41c>
+    printf(stdout, "munmap failed\n");
+    3825:	a1 14 80 00 00       	mov    0x8014,%eax
+    382a:	83 ec 08             	sub    $0x8,%esp
+    382d:	68 54 66 00 00       	push   $0x6654
+    3832:	50                   	push   %eax
+    3833:	e8 0d 12 00 00       	call   4a45 <printf>
+    3838:	83 c4 10             	add    $0x10,%esp
+    exit();
+    383b:	e8 61 10 00 00       	call   48a1 <exit>
+  }
+  pid = fork();
+    3840:	e8 54 10 00 00       	call   4899 <fork>
+    3845:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(pid < 0){
+    3848:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+    384c:	79 1b                	jns    3869 <mmaptest+0x445>
+    printf(stdout, "fork failed\n");
+    384e:	a1 14 80 00 00       	mov    0x8014,%eax
+    3853:	83 ec 08             	sub    $0x8,%esp
+    3856:	68 a1 50 00 00       	push   $0x50a1
+    385b:	50                   	push   %eax
+    385c:	e8 e4 11 00 00       	call   4a45 <printf>
+    3861:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3864:	e8 38 10 00 00       	call   48a1 <exit>
+  }
+  if(pid == 0){
+    3869:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+    386d:	75 3a                	jne    38a9 <mmaptest+0x485>
+    c = p[0];
+    386f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    3872:	0f b6 00             	movzbl (%eax),%eax
+    3875:	88 45 df             	mov    %al,-0x21(%ebp)
+    printf(stdout, "mmap: could read %x = %x after munmap\n", p, c);
+    3878:	0f b6 45 df          	movzbl -0x21(%ebp),%eax
+    387c:	0f be d0             	movsbl %al,%edx
+    387f:	a1 14 80 00 00       	mov    0x8014,%eax
+    3884:	52                   	push   %edx
+    3885:	ff 75 e8             	push   -0x18(%ebp)
+    3888:	68 64 66 00 00       	push   $0x6664
+    388d:	50                   	push   %eax
+    388e:	e8 b2 11 00 00       	call   4a45 <printf>
+    3893:	83 c4 10             	add    $0x10,%esp
+    kill(ppid);
+    3896:	83 ec 0c             	sub    $0xc,%esp
+    3899:	ff 75 f0             	push   -0x10(%ebp)
+    389c:	e8 30 10 00 00       	call   48d1 <kill>
+    38a1:	83 c4 10             	add    $0x10,%esp
+    exit();
+    38a4:	e8 f8 0f 00 00       	call   48a1 <exit>
+  }
+  wait();
+    38a9:	e8 fb 0f 00 00       	call   48a9 <wait>
+
+  printf(stdout, "mmap test ok\n");
+    38ae:	a1 14 80 00 00       	mov    0x8014,%eax
+    38b3:	83 ec 08             	sub    $0x8,%esp
+    38b6:	68 8b 66 00 00       	push   $0x668b
+    38bb:	50                   	push   %eax
+    38bc:	e8 84 11 00 00       	call   4a45 <printf>
+    38c1:	83 c4 10             	add    $0x10,%esp
+}
+    38c4:	90                   	nop
+    38c5:	c9                   	leave
+    38c6:	c3                   	ret
+
+000038c7 <sbrktest>:
+
+void
+sbrktest(void)
+{
+    38c7:	55                   	push   %ebp
+    38c8:	89 e5                	mov    %esp,%ebp
+    38ca:	83 ec 68             	sub    $0x68,%esp
+  int fds[2], pid, pids[10], ppid;
+  char *a, *b, *c, *lastaddr, *oldbrk, *p, scratch;
+  uint amt;
+
+  printf(stdout, "sbrk test\n");
+    38cd:	a1 14 80 00 00       	mov    0x8014,%eax
+    38d2:	83 ec 08             	sub    $0x8,%esp
+    38d5:	68 99 66 00 00       	push   $0x6699
+    38da:	50                   	push   %eax
+    38db:	e8 65 11 00 00       	call   4a45 <printf>
+    38e0:	83 c4 10             	add    $0x10,%esp
+  oldbrk = sbrk(0);
+    38e3:	83 ec 0c             	sub    $0xc,%esp
+    38e6:	6a 00                	push   $0x0
+    38e8:	e8 3c 10 00 00       	call   4929 <sbrk>
+    38ed:	83 c4 10             	add    $0x10,%esp
+    38f0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+
+  // can one sbrk() less than a page?
+  a = sbrk(0);
+    38f3:	83 ec 0c             	sub    $0xc,%esp
+    38f6:	6a 00                	push   $0x0
+    38f8:	e8 2c 10 00 00       	call   4929 <sbrk>
+    38fd:	83 c4 10             	add    $0x10,%esp
+    3900:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  int i;
+  for(i = 0; i < 5000; i++){
+    3903:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    390a:	eb 4f                	jmp    395b <sbrktest+0x94>
+    b = sbrk(1);
+    390c:	83 ec 0c             	sub    $0xc,%esp
+    390f:	6a 01                	push   $0x1
+    3911:	e8 13 10 00 00       	call   4929 <sbrk>
+    3916:	83 c4 10             	add    $0x10,%esp
+    3919:	89 45 d0             	mov    %eax,-0x30(%ebp)
+    if(b != a){
+    391c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    391f:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    3922:	74 24                	je     3948 <sbrktest+0x81>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+    3924:	a1 14 80 00 00       	mov    0x8014,%eax
+    3929:	83 ec 0c             	sub    $0xc,%esp
+    392c:	ff 75 d0             	push   -0x30(%ebp)
+    392f:	ff 75 f4             	push   -0xc(%ebp)
+    3932:	ff 75 f0             	push   -0x10(%ebp)
+    3935:	68 a4 66 00 00       	push   $0x66a4
+    393a:	50                   	push   %eax
+    393b:	e8 05 11 00 00       	call   4a45 <printf>
+    3940:	83 c4 20             	add    $0x20,%esp
+      exit();
+    3943:	e8 59 0f 00 00       	call   48a1 <exit>
+    }
+    *b = 1;
+    3948:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    394b:	c6 00 01             	movb   $0x1,(%eax)
+    a = b + 1;
+    394e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    3951:	83 c0 01             	add    $0x1,%eax
+    3954:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  for(i = 0; i < 5000; i++){
+    3957:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    395b:	81 7d f0 87 13 00 00 	cmpl   $0x1387,-0x10(%ebp)
+    3962:	7e a8                	jle    390c <sbrktest+0x45>
+  }
+  pid = fork();
+    3964:	e8 30 0f 00 00       	call   4899 <fork>
+    3969:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if(pid < 0){
+    396c:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    3970:	79 1b                	jns    398d <sbrktest+0xc6>
+    printf(stdout, "sbrk test fork failed\n");
+    3972:	a1 14 80 00 00       	mov    0x8014,%eax
+    3977:	83 ec 08             	sub    $0x8,%esp
+    397a:	68 bf 66 00 00       	push   $0x66bf
+    397f:	50                   	push   %eax
+    3980:	e8 c0 10 00 00       	call   4a45 <printf>
+    3985:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3988:	e8 14 0f 00 00       	call   48a1 <exit>
+  }
+  c = sbrk(1);
+    398d:	83 ec 0c             	sub    $0xc,%esp
+    3990:	6a 01                	push   $0x1
+    3992:	e8 92 0f 00 00       	call   4929 <sbrk>
+    3997:	83 c4 10             	add    $0x10,%esp
+    399a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  c = sbrk(1);
+    399d:	83 ec 0c             	sub    $0xc,%esp
+    39a0:	6a 01                	push   $0x1
+    39a2:	e8 82 0f 00 00       	call   4929 <sbrk>
+    39a7:	83 c4 10             	add    $0x10,%esp
+    39aa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(c != a + 1){
+    39ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    39b0:	83 c0 01             	add    $0x1,%eax
+    39b3:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    39b6:	74 1b                	je     39d3 <sbrktest+0x10c>
+    printf(stdout, "sbrk test failed post-fork\n");
+    39b8:	a1 14 80 00 00       	mov    0x8014,%eax
+    39bd:	83 ec 08             	sub    $0x8,%esp
+    39c0:	68 d6 66 00 00       	push   $0x66d6
+    39c5:	50                   	push   %eax
+    39c6:	e8 7a 10 00 00       	call   4a45 <printf>
+    39cb:	83 c4 10             	add    $0x10,%esp
+    exit();
+    39ce:	e8 ce 0e 00 00       	call   48a1 <exit>
+  }
+  if(pid == 0)
+    39d3:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    39d7:	75 05                	jne    39de <sbrktest+0x117>
+    exit();
+    39d9:	e8 c3 0e 00 00       	call   48a1 <exit>
+  wait();
+    39de:	e8 c6 0e 00 00       	call   48a9 <wait>
+
+  // can one grow address space to something big?
+#define BIG (100*1024*1024)
+  a = sbrk(0);
+    39e3:	83 ec 0c             	sub    $0xc,%esp
+    39e6:	6a 00                	push   $0x0
+    39e8:	e8 3c 0f 00 00       	call   4929 <sbrk>
+    39ed:	83 c4 10             	add    $0x10,%esp
+    39f0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  amt = (BIG) - (uint)a;
+    39f3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    39f6:	ba 00 00 40 06       	mov    $0x6400000,%edx
+    39fb:	29 c2                	sub    %eax,%edx
+    39fd:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  p = sbrk(amt);
+    3a00:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    3a03:	83 ec 0c             	sub    $0xc,%esp
+    3a06:	50                   	push   %eax
+    3a07:	e8 1d 0f 00 00       	call   4929 <sbrk>
+    3a0c:	83 c4 10             	add    $0x10,%esp
+    3a0f:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  if (p != a) {
+    3a12:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    3a15:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    3a18:	74 1b                	je     3a35 <sbrktest+0x16e>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    3a1a:	a1 14 80 00 00       	mov    0x8014,%eax
+    3a1f:	83 ec 08             	sub    $0x8,%esp
+    3a22:	68 f4 66 00 00       	push   $0x66f4
+    3a27:	50                   	push   %eax
+    3a28:	e8 18 10 00 00       	call   4a45 <printf>
+    3a2d:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3a30:	e8 6c 0e 00 00       	call   48a1 <exit>
+  }
+  lastaddr = (char*) (BIG-1);
+    3a35:	c7 45 d8 ff ff 3f 06 	movl   $0x63fffff,-0x28(%ebp)
+  *lastaddr = 99;
+    3a3c:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    3a3f:	c6 00 63             	movb   $0x63,(%eax)
+
+  // can one de-allocate?
+  a = sbrk(0);
+    3a42:	83 ec 0c             	sub    $0xc,%esp
+    3a45:	6a 00                	push   $0x0
+    3a47:	e8 dd 0e 00 00       	call   4929 <sbrk>
+    3a4c:	83 c4 10             	add    $0x10,%esp
+    3a4f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  c = sbrk(-4096);
+    3a52:	83 ec 0c             	sub    $0xc,%esp
+    3a55:	68 00 f0 ff ff       	push   $0xfffff000
+    3a5a:	e8 ca 0e 00 00       	call   4929 <sbrk>
+    3a5f:	83 c4 10             	add    $0x10,%esp
+    3a62:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(c == (char*)0xffffffff){
+    3a65:	83 7d e4 ff          	cmpl   $0xffffffff,-0x1c(%ebp)
+    3a69:	75 1b                	jne    3a86 <sbrktest+0x1bf>
+    printf(stdout, "sbrk could not deallocate\n");
+    3a6b:	a1 14 80 00 00       	mov    0x8014,%eax
+    3a70:	83 ec 08             	sub    $0x8,%esp
+    3a73:	68 32 67 00 00       	push   $0x6732
+    3a78:	50                   	push   %eax
+    3a79:	e8 c7 0f 00 00       	call   4a45 <printf>
+    3a7e:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3a81:	e8 1b 0e 00 00       	call   48a1 <exit>
+  }
+  c = sbrk(0);
+    3a86:	83 ec 0c             	sub    $0xc,%esp
+    3a89:	6a 00                	push   $0x0
+    3a8b:	e8 99 0e 00 00       	call   4929 <sbrk>
+    3a90:	83 c4 10             	add    $0x10,%esp
+    3a93:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(c != a - 4096){
+    3a96:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3a99:	2d 00 10 00 00       	sub    $0x1000,%eax
+    3a9e:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    3aa1:	74 1e                	je     3ac1 <sbrktest+0x1fa>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    3aa3:	a1 14 80 00 00       	mov    0x8014,%eax
+    3aa8:	ff 75 e4             	push   -0x1c(%ebp)
+    3aab:	ff 75 f4             	push   -0xc(%ebp)
+    3aae:	68 50 67 00 00       	push   $0x6750
+    3ab3:	50                   	push   %eax
+    3ab4:	e8 8c 0f 00 00       	call   4a45 <printf>
+    3ab9:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3abc:	e8 e0 0d 00 00       	call   48a1 <exit>
+  }
+
+  // can one re-allocate that page?
+  a = sbrk(0);
+    3ac1:	83 ec 0c             	sub    $0xc,%esp
+    3ac4:	6a 00                	push   $0x0
+    3ac6:	e8 5e 0e 00 00       	call   4929 <sbrk>
+    3acb:	83 c4 10             	add    $0x10,%esp
+    3ace:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  c = sbrk(4096);
+    3ad1:	83 ec 0c             	sub    $0xc,%esp
+    3ad4:	68 00 10 00 00       	push   $0x1000
+    3ad9:	e8 4b 0e 00 00       	call   4929 <sbrk>
+    3ade:	83 c4 10             	add    $0x10,%esp
+    3ae1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(c != a || sbrk(0) != a + 4096){
+    3ae4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    3ae7:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    3aea:	75 1a                	jne    3b06 <sbrktest+0x23f>
+    3aec:	83 ec 0c             	sub    $0xc,%esp
+    3aef:	6a 00                	push   $0x0
+    3af1:	e8 33 0e 00 00       	call   4929 <sbrk>
+    3af6:	83 c4 10             	add    $0x10,%esp
+    3af9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    3afc:	81 c2 00 10 00 00    	add    $0x1000,%edx
+    3b02:	39 d0                	cmp    %edx,%eax
+    3b04:	74 1e                	je     3b24 <sbrktest+0x25d>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    3b06:	a1 14 80 00 00       	mov    0x8014,%eax
+    3b0b:	ff 75 e4             	push   -0x1c(%ebp)
+    3b0e:	ff 75 f4             	push   -0xc(%ebp)
+    3b11:	68 88 67 00 00       	push   $0x6788
+    3b16:	50                   	push   %eax
+    3b17:	e8 29 0f 00 00       	call   4a45 <printf>
+    3b1c:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3b1f:	e8 7d 0d 00 00       	call   48a1 <exit>
+  }
+  if(*lastaddr == 99){
+    3b24:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    3b27:	0f b6 00             	movzbl (%eax),%eax
+    3b2a:	3c 63                	cmp    $0x63,%al
+    3b2c:	75 1b                	jne    3b49 <sbrktest+0x282>
+    // should be zero
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    3b2e:	a1 14 80 00 00       	mov    0x8014,%eax
+    3b33:	83 ec 08             	sub    $0x8,%esp
+    3b36:	68 b0 67 00 00       	push   $0x67b0
+    3b3b:	50                   	push   %eax
+    3b3c:	e8 04 0f 00 00       	call   4a45 <printf>
+    3b41:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3b44:	e8 58 0d 00 00       	call   48a1 <exit>
+  }
+
+  a = sbrk(0);
+    3b49:	83 ec 0c             	sub    $0xc,%esp
+    3b4c:	6a 00                	push   $0x0
+    3b4e:	e8 d6 0d 00 00       	call   4929 <sbrk>
+    3b53:	83 c4 10             	add    $0x10,%esp
+    3b56:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  c = sbrk(-(sbrk(0) - oldbrk));
+    3b59:	83 ec 0c             	sub    $0xc,%esp
+    3b5c:	6a 00                	push   $0x0
+    3b5e:	e8 c6 0d 00 00       	call   4929 <sbrk>
+    3b63:	83 c4 10             	add    $0x10,%esp
+    3b66:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    3b69:	29 c2                	sub    %eax,%edx
+    3b6b:	83 ec 0c             	sub    $0xc,%esp
+    3b6e:	52                   	push   %edx
+    3b6f:	e8 b5 0d 00 00       	call   4929 <sbrk>
+    3b74:	83 c4 10             	add    $0x10,%esp
+    3b77:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(c != a){
+    3b7a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    3b7d:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    3b80:	74 1e                	je     3ba0 <sbrktest+0x2d9>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    3b82:	a1 14 80 00 00       	mov    0x8014,%eax
+    3b87:	ff 75 e4             	push   -0x1c(%ebp)
+    3b8a:	ff 75 f4             	push   -0xc(%ebp)
+    3b8d:	68 e0 67 00 00       	push   $0x67e0
+    3b92:	50                   	push   %eax
+    3b93:	e8 ad 0e 00 00       	call   4a45 <printf>
+    3b98:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3b9b:	e8 01 0d 00 00       	call   48a1 <exit>
+  }
+
+  // can we read the kernel's memory?
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    3ba0:	c7 45 f4 00 00 00 80 	movl   $0x80000000,-0xc(%ebp)
+    3ba7:	eb 76                	jmp    3c1f <sbrktest+0x358>
+    ppid = getpid();
+    3ba9:	e8 73 0d 00 00       	call   4921 <getpid>
+    3bae:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    pid = fork();
+    3bb1:	e8 e3 0c 00 00       	call   4899 <fork>
+    3bb6:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(pid < 0){
+    3bb9:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    3bbd:	79 1b                	jns    3bda <sbrktest+0x313>
+      printf(stdout, "fork failed\n");
+    3bbf:	a1 14 80 00 00       	mov    0x8014,%eax
+    3bc4:	83 ec 08             	sub    $0x8,%esp
+    3bc7:	68 a1 50 00 00       	push   $0x50a1
+    3bcc:	50                   	push   %eax
+    3bcd:	e8 73 0e 00 00       	call   4a45 <printf>
+    3bd2:	83 c4 10             	add    $0x10,%esp
+      exit();
+    3bd5:	e8 c7 0c 00 00       	call   48a1 <exit>
+    }
+    if(pid == 0){
+    3bda:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    3bde:	75 33                	jne    3c13 <sbrktest+0x34c>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+    3be0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3be3:	0f b6 00             	movzbl (%eax),%eax
+    3be6:	0f be d0             	movsbl %al,%edx
+    3be9:	a1 14 80 00 00       	mov    0x8014,%eax
+    3bee:	52                   	push   %edx
+    3bef:	ff 75 f4             	push   -0xc(%ebp)
+    3bf2:	68 01 68 00 00       	push   $0x6801
+    3bf7:	50                   	push   %eax
+    3bf8:	e8 48 0e 00 00       	call   4a45 <printf>
+    3bfd:	83 c4 10             	add    $0x10,%esp
+      kill(ppid);
+    3c00:	83 ec 0c             	sub    $0xc,%esp
+    3c03:	ff 75 d4             	push   -0x2c(%ebp)
+    3c06:	e8 c6 0c 00 00       	call   48d1 <kill>
+    3c0b:	83 c4 10             	add    $0x10,%esp
+      exit();
+    3c0e:	e8 8e 0c 00 00       	call   48a1 <exit>
+    }
+    wait();
+    3c13:	e8 91 0c 00 00       	call   48a9 <wait>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    3c18:	81 45 f4 50 c3 00 00 	addl   $0xc350,-0xc(%ebp)
+    3c1f:	81 7d f4 7f 84 1e 80 	cmpl   $0x801e847f,-0xc(%ebp)
+    3c26:	76 81                	jbe    3ba9 <sbrktest+0x2e2>
+  }
+
+  // if we run the system out of memory, does it clean up the last
+  // failed allocation?
+  if(pipe(fds) != 0){
+    3c28:	83 ec 0c             	sub    $0xc,%esp
+    3c2b:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    3c2e:	50                   	push   %eax
+    3c2f:	e8 7d 0c 00 00       	call   48b1 <pipe>
+    3c34:	83 c4 10             	add    $0x10,%esp
+    3c37:	85 c0                	test   %eax,%eax
+    3c39:	74 17                	je     3c52 <sbrktest+0x38b>
+    printf(1, "pipe() failed\n");
+    3c3b:	83 ec 08             	sub    $0x8,%esp
+    3c3e:	68 72 54 00 00       	push   $0x5472
+    3c43:	6a 01                	push   $0x1
+    3c45:	e8 fb 0d 00 00       	call   4a45 <printf>
+    3c4a:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3c4d:	e8 4f 0c 00 00       	call   48a1 <exit>
+  }
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3c52:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    3c59:	e9 86 00 00 00       	jmp    3ce4 <sbrktest+0x41d>
+    if((pids[i] = fork()) == 0){
+    3c5e:	e8 36 0c 00 00       	call   4899 <fork>
+    3c63:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    3c66:	89 44 95 a0          	mov    %eax,-0x60(%ebp,%edx,4)
+    3c6a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    3c6d:	8b 44 85 a0          	mov    -0x60(%ebp,%eax,4),%eax
+    3c71:	85 c0                	test   %eax,%eax
+    3c73:	75 4a                	jne    3cbf <sbrktest+0x3f8>
+      // allocate a lot of memory
+      sbrk(BIG - (uint)sbrk(0));
+    3c75:	83 ec 0c             	sub    $0xc,%esp
+    3c78:	6a 00                	push   $0x0
+    3c7a:	e8 aa 0c 00 00       	call   4929 <sbrk>
+    3c7f:	83 c4 10             	add    $0x10,%esp
+    3c82:	89 c2                	mov    %eax,%edx
+    3c84:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    3c89:	29 d0                	sub    %edx,%eax
+    3c8b:	83 ec 0c             	sub    $0xc,%esp
+    3c8e:	50                   	push   %eax
+    3c8f:	e8 95 0c 00 00       	call   4929 <sbrk>
+    3c94:	83 c4 10             	add    $0x10,%esp
+      write(fds[1], "x", 1);
+    3c97:	8b 45 cc             	mov    -0x34(%ebp),%eax
+    3c9a:	83 ec 04             	sub    $0x4,%esp
+    3c9d:	6a 01                	push   $0x1
+    3c9f:	68 d7 54 00 00       	push   $0x54d7
+    3ca4:	50                   	push   %eax
+    3ca5:	e8 17 0c 00 00       	call   48c1 <write>
+    3caa:	83 c4 10             	add    $0x10,%esp
+      // sit around until killed
+      for(;;) sleep(1000);
+    3cad:	83 ec 0c             	sub    $0xc,%esp
+    3cb0:	68 e8 03 00 00       	push   $0x3e8
+    3cb5:	e8 77 0c 00 00       	call   4931 <sleep>
+    3cba:	83 c4 10             	add    $0x10,%esp
+    3cbd:	eb ee                	jmp    3cad <sbrktest+0x3e6>
+    }
+    if(pids[i] != -1)
+    3cbf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    3cc2:	8b 44 85 a0          	mov    -0x60(%ebp,%eax,4),%eax
+    3cc6:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3cc9:	74 15                	je     3ce0 <sbrktest+0x419>
+      read(fds[0], &scratch, 1);
+    3ccb:	8b 45 c8             	mov    -0x38(%ebp),%eax
+    3cce:	83 ec 04             	sub    $0x4,%esp
+    3cd1:	6a 01                	push   $0x1
+    3cd3:	8d 55 9f             	lea    -0x61(%ebp),%edx
+    3cd6:	52                   	push   %edx
+    3cd7:	50                   	push   %eax
+    3cd8:	e8 dc 0b 00 00       	call   48b9 <read>
+    3cdd:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3ce0:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    3ce4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    3ce7:	83 f8 09             	cmp    $0x9,%eax
+    3cea:	0f 86 6e ff ff ff    	jbe    3c5e <sbrktest+0x397>
+  }
+  // if those failed allocations freed up the pages they did allocate,
+  // we'll be able to allocate here
+  c = sbrk(4096);
+    3cf0:	83 ec 0c             	sub    $0xc,%esp
+    3cf3:	68 00 10 00 00       	push   $0x1000
+    3cf8:	e8 2c 0c 00 00       	call   4929 <sbrk>
+    3cfd:	83 c4 10             	add    $0x10,%esp
+    3d00:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3d03:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    3d0a:	eb 2b                	jmp    3d37 <sbrktest+0x470>
+    if(pids[i] == -1)
+    3d0c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    3d0f:	8b 44 85 a0          	mov    -0x60(%ebp,%eax,4),%eax
+    3d13:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3d16:	74 1a                	je     3d32 <sbrktest+0x46b>
+      continue;
+    kill(pids[i]);
+    3d18:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    3d1b:	8b 44 85 a0          	mov    -0x60(%ebp,%eax,4),%eax
+    3d1f:	83 ec 0c             	sub    $0xc,%esp
+    3d22:	50                   	push   %eax
+    3d23:	e8 a9 0b 00 00       	call   48d1 <kill>
+    3d28:	83 c4 10             	add    $0x10,%esp
+    wait();
+    3d2b:	e8 79 0b 00 00       	call   48a9 <wait>
+    3d30:	eb 01                	jmp    3d33 <sbrktest+0x46c>
+      continue;
+    3d32:	90                   	nop
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3d33:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    3d37:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    3d3a:	83 f8 09             	cmp    $0x9,%eax
+    3d3d:	76 cd                	jbe    3d0c <sbrktest+0x445>
+  }
+  if(c == (char*)0xffffffff){
+    3d3f:	83 7d e4 ff          	cmpl   $0xffffffff,-0x1c(%ebp)
+    3d43:	75 1b                	jne    3d60 <sbrktest+0x499>
+    printf(stdout, "failed sbrk leaked memory\n");
+    3d45:	a1 14 80 00 00       	mov    0x8014,%eax
+    3d4a:	83 ec 08             	sub    $0x8,%esp
+    3d4d:	68 1a 68 00 00       	push   $0x681a
+    3d52:	50                   	push   %eax
+    3d53:	e8 ed 0c 00 00       	call   4a45 <printf>
+    3d58:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3d5b:	e8 41 0b 00 00       	call   48a1 <exit>
+  }
+
+  if(sbrk(0) > oldbrk)
+    3d60:	83 ec 0c             	sub    $0xc,%esp
+    3d63:	6a 00                	push   $0x0
+    3d65:	e8 bf 0b 00 00       	call   4929 <sbrk>
+    3d6a:	83 c4 10             	add    $0x10,%esp
+    3d6d:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+    3d70:	73 1e                	jae    3d90 <sbrktest+0x4c9>
+    sbrk(-(sbrk(0) - oldbrk));
+    3d72:	83 ec 0c             	sub    $0xc,%esp
+    3d75:	6a 00                	push   $0x0
+    3d77:	e8 ad 0b 00 00       	call   4929 <sbrk>
+    3d7c:	83 c4 10             	add    $0x10,%esp
+    3d7f:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    3d82:	29 c2                	sub    %eax,%edx
+    3d84:	83 ec 0c             	sub    $0xc,%esp
+    3d87:	52                   	push   %edx
+    3d88:	e8 9c 0b 00 00       	call   4929 <sbrk>
+    3d8d:	83 c4 10             	add    $0x10,%esp
+
+  printf(stdout, "sbrk test OK\n");
+    3d90:	a1 14 80 00 00       	mov    0x8014,%eax
+    3d95:	83 ec 08             	sub    $0x8,%esp
+    3d98:	68 35 68 00 00       	push   $0x6835
+    3d9d:	50                   	push   %eax
+    3d9e:	e8 a2 0c 00 00       	call   4a45 <printf>
+    3da3:	83 c4 10             	add    $0x10,%esp
+}
+    3da6:	90                   	nop
+    3da7:	c9                   	leave
+    3da8:	c3                   	ret
+
+00003da9 <validateint>:
+
+void
+validateint(int *p)
+{
+    3da9:	55                   	push   %ebp
+    3daa:	89 e5                	mov    %esp,%ebp
+    3dac:	53                   	push   %ebx
+    3dad:	83 ec 10             	sub    $0x10,%esp
+  int res;
+  asm("mov %%esp, %%ebx\n\t"
+    3db0:	b8 0d 00 00 00       	mov    $0xd,%eax
+    3db5:	8b 55 08             	mov    0x8(%ebp),%edx
+    3db8:	89 d1                	mov    %edx,%ecx
+    3dba:	89 e3                	mov    %esp,%ebx
+    3dbc:	89 cc                	mov    %ecx,%esp
+    3dbe:	cd 40                	int    $0x40
+    3dc0:	89 dc                	mov    %ebx,%esp
+    3dc2:	89 45 f8             	mov    %eax,-0x8(%ebp)
+      "int %2\n\t"
+      "mov %%ebx, %%esp" :
+      "=a" (res) :
+      "a" (SYS_sleep), "n" (T_SYSCALL), "c" (p) :
+      "ebx");
+}
+    3dc5:	90                   	nop
+    3dc6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3dc9:	c9                   	leave
+    3dca:	c3                   	ret
+
+00003dcb <validatetest>:
+
+void
+validatetest(void)
+{
+    3dcb:	55                   	push   %ebp
+    3dcc:	89 e5                	mov    %esp,%ebp
+    3dce:	83 ec 18             	sub    $0x18,%esp
+  int hi, pid;
+  uint p;
+
+  printf(stdout, "validate test\n");
+    3dd1:	a1 14 80 00 00       	mov    0x8014,%eax
+    3dd6:	83 ec 08             	sub    $0x8,%esp
+    3dd9:	68 43 68 00 00       	push   $0x6843
+    3dde:	50                   	push   %eax
+    3ddf:	e8 61 0c 00 00       	call   4a45 <printf>
+    3de4:	83 c4 10             	add    $0x10,%esp
+  hi = 1100*1024;
+    3de7:	c7 45 f0 00 30 11 00 	movl   $0x113000,-0x10(%ebp)
+
+  for(p = 0; p <= (uint)hi; p += 4096){
+    3dee:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    3df5:	e9 8a 00 00 00       	jmp    3e84 <validatetest+0xb9>
+    if((pid = fork()) == 0){
+    3dfa:	e8 9a 0a 00 00       	call   4899 <fork>
+    3dff:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    3e02:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    3e06:	75 14                	jne    3e1c <validatetest+0x51>
+      // try to crash the kernel by passing in a badly placed integer
+      validateint((int*)p);
+    3e08:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3e0b:	83 ec 0c             	sub    $0xc,%esp
+    3e0e:	50                   	push   %eax
+    3e0f:	e8 95 ff ff ff       	call   3da9 <validateint>
+    3e14:	83 c4 10             	add    $0x10,%esp
+      exit();
+    3e17:	e8 85 0a 00 00       	call   48a1 <exit>
+    }
+    sleep(0);
+    3e1c:	83 ec 0c             	sub    $0xc,%esp
+    3e1f:	6a 00                	push   $0x0
+    3e21:	e8 0b 0b 00 00       	call   4931 <sleep>
+    3e26:	83 c4 10             	add    $0x10,%esp
+    sleep(0);
+    3e29:	83 ec 0c             	sub    $0xc,%esp
+    3e2c:	6a 00                	push   $0x0
+    3e2e:	e8 fe 0a 00 00       	call   4931 <sleep>
+    3e33:	83 c4 10             	add    $0x10,%esp
+    kill(pid);
+    3e36:	83 ec 0c             	sub    $0xc,%esp
+    3e39:	ff 75 ec             	push   -0x14(%ebp)
+    3e3c:	e8 90 0a 00 00       	call   48d1 <kill>
+    3e41:	83 c4 10             	add    $0x10,%esp
+    wait();
+    3e44:	e8 60 0a 00 00       	call   48a9 <wait>
+
+    // try to crash the kernel by passing in a bad string pointer
+    if(link("nosuchfile", (char*)p) != -1){
+    3e49:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3e4c:	83 ec 08             	sub    $0x8,%esp
+    3e4f:	50                   	push   %eax
+    3e50:	68 52 68 00 00       	push   $0x6852
+    3e55:	e8 a7 0a 00 00       	call   4901 <link>
+    3e5a:	83 c4 10             	add    $0x10,%esp
+    3e5d:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3e60:	74 1b                	je     3e7d <validatetest+0xb2>
+      printf(stdout, "link should not succeed\n");
+    3e62:	a1 14 80 00 00       	mov    0x8014,%eax
+    3e67:	83 ec 08             	sub    $0x8,%esp
+    3e6a:	68 5d 68 00 00       	push   $0x685d
+    3e6f:	50                   	push   %eax
+    3e70:	e8 d0 0b 00 00       	call   4a45 <printf>
+    3e75:	83 c4 10             	add    $0x10,%esp
+      exit();
+    3e78:	e8 24 0a 00 00       	call   48a1 <exit>
+  for(p = 0; p <= (uint)hi; p += 4096){
+    3e7d:	81 45 f4 00 10 00 00 	addl   $0x1000,-0xc(%ebp)
+    3e84:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    3e87:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    3e8a:	0f 83 6a ff ff ff    	jae    3dfa <validatetest+0x2f>
+    }
+  }
+
+  printf(stdout, "validate ok\n");
+    3e90:	a1 14 80 00 00       	mov    0x8014,%eax
+    3e95:	83 ec 08             	sub    $0x8,%esp
+    3e98:	68 76 68 00 00       	push   $0x6876
+    3e9d:	50                   	push   %eax
+    3e9e:	e8 a2 0b 00 00       	call   4a45 <printf>
+    3ea3:	83 c4 10             	add    $0x10,%esp
+}
+    3ea6:	90                   	nop
+    3ea7:	c9                   	leave
+    3ea8:	c3                   	ret
+
+00003ea9 <bsstest>:
+
+// does unintialized data start out zero?
+char uninit[10000];
+void
+bsstest(void)
+{
+    3ea9:	55                   	push   %ebp
+    3eaa:	89 e5                	mov    %esp,%ebp
+    3eac:	83 ec 18             	sub    $0x18,%esp
+  int i;
+
+  printf(stdout, "bss test\n");
+    3eaf:	a1 14 80 00 00       	mov    0x8014,%eax
+    3eb4:	83 ec 08             	sub    $0x8,%esp
+    3eb7:	68 83 68 00 00       	push   $0x6883
+    3ebc:	50                   	push   %eax
+    3ebd:	e8 83 0b 00 00       	call   4a45 <printf>
+    3ec2:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(uninit); i++){
+    3ec5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    3ecc:	eb 2e                	jmp    3efc <bsstest+0x53>
+    if(uninit[i] != '\0'){
+    3ece:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3ed1:	05 c0 a0 00 00       	add    $0xa0c0,%eax
+    3ed6:	0f b6 00             	movzbl (%eax),%eax
+    3ed9:	84 c0                	test   %al,%al
+    3edb:	74 1b                	je     3ef8 <bsstest+0x4f>
+      printf(stdout, "bss test failed\n");
+    3edd:	a1 14 80 00 00       	mov    0x8014,%eax
+    3ee2:	83 ec 08             	sub    $0x8,%esp
+    3ee5:	68 8d 68 00 00       	push   $0x688d
+    3eea:	50                   	push   %eax
+    3eeb:	e8 55 0b 00 00       	call   4a45 <printf>
+    3ef0:	83 c4 10             	add    $0x10,%esp
+      exit();
+    3ef3:	e8 a9 09 00 00       	call   48a1 <exit>
+  for(i = 0; i < sizeof(uninit); i++){
+    3ef8:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    3efc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3eff:	3d 0f 27 00 00       	cmp    $0x270f,%eax
+    3f04:	76 c8                	jbe    3ece <bsstest+0x25>
+    }
+  }
+  printf(stdout, "bss test ok\n");
+    3f06:	a1 14 80 00 00       	mov    0x8014,%eax
+    3f0b:	83 ec 08             	sub    $0x8,%esp
+    3f0e:	68 9e 68 00 00       	push   $0x689e
+    3f13:	50                   	push   %eax
+    3f14:	e8 2c 0b 00 00       	call   4a45 <printf>
+    3f19:	83 c4 10             	add    $0x10,%esp
+}
+    3f1c:	90                   	nop
+    3f1d:	c9                   	leave
+    3f1e:	c3                   	ret
+
+00003f1f <bigargtest>:
+// does exec return an error if the arguments
+// are larger than a page? or does it write
+// below the stack and wreck the instructions/data?
+void
+bigargtest(void)
+{
+    3f1f:	55                   	push   %ebp
+    3f20:	89 e5                	mov    %esp,%ebp
+    3f22:	83 ec 18             	sub    $0x18,%esp
+  int pid, fd;
+
+  unlink("bigarg-ok");
+    3f25:	83 ec 0c             	sub    $0xc,%esp
+    3f28:	68 ab 68 00 00       	push   $0x68ab
+    3f2d:	e8 bf 09 00 00       	call   48f1 <unlink>
+    3f32:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    3f35:	e8 5f 09 00 00       	call   4899 <fork>
+    3f3a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(pid == 0){
+    3f3d:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    3f41:	0f 85 97 00 00 00    	jne    3fde <bigargtest+0xbf>
+    static char *args[MAXARG];
+    int i;
+    for(i = 0; i < MAXARG-1; i++)
+    3f47:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    3f4e:	eb 12                	jmp    3f62 <bigargtest+0x43>
+      args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
+    3f50:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3f53:	c7 04 85 e0 c7 00 00 	movl   $0x68b8,0xc7e0(,%eax,4)
+    3f5a:	b8 68 00 00 
+    for(i = 0; i < MAXARG-1; i++)
+    3f5e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    3f62:	83 7d f4 1e          	cmpl   $0x1e,-0xc(%ebp)
+    3f66:	7e e8                	jle    3f50 <bigargtest+0x31>
+    args[MAXARG-1] = 0;
+    3f68:	c7 05 5c c8 00 00 00 	movl   $0x0,0xc85c
+    3f6f:	00 00 00 
+    printf(stdout, "bigarg test\n");
+    3f72:	a1 14 80 00 00       	mov    0x8014,%eax
+    3f77:	83 ec 08             	sub    $0x8,%esp
+    3f7a:	68 95 69 00 00       	push   $0x6995
+    3f7f:	50                   	push   %eax
+    3f80:	e8 c0 0a 00 00       	call   4a45 <printf>
+    3f85:	83 c4 10             	add    $0x10,%esp
+    exec("echo", args);
+    3f88:	83 ec 08             	sub    $0x8,%esp
+    3f8b:	68 e0 c7 00 00       	push   $0xc7e0
+    3f90:	68 00 50 00 00       	push   $0x5000
+    3f95:	e8 3f 09 00 00       	call   48d9 <exec>
+    3f9a:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "bigarg test ok\n");
+    3f9d:	a1 14 80 00 00       	mov    0x8014,%eax
+    3fa2:	83 ec 08             	sub    $0x8,%esp
+    3fa5:	68 a2 69 00 00       	push   $0x69a2
+    3faa:	50                   	push   %eax
+    3fab:	e8 95 0a 00 00       	call   4a45 <printf>
+    3fb0:	83 c4 10             	add    $0x10,%esp
+    fd = open("bigarg-ok", O_CREATE);
+    3fb3:	83 ec 08             	sub    $0x8,%esp
+    3fb6:	68 00 02 00 00       	push   $0x200
+    3fbb:	68 ab 68 00 00       	push   $0x68ab
+    3fc0:	e8 1c 09 00 00       	call   48e1 <open>
+    3fc5:	83 c4 10             	add    $0x10,%esp
+    3fc8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    close(fd);
+    3fcb:	83 ec 0c             	sub    $0xc,%esp
+    3fce:	ff 75 ec             	push   -0x14(%ebp)
+    3fd1:	e8 f3 08 00 00       	call   48c9 <close>
+    3fd6:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3fd9:	e8 c3 08 00 00       	call   48a1 <exit>
+  } else if(pid < 0){
+    3fde:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    3fe2:	79 1b                	jns    3fff <bigargtest+0xe0>
+    printf(stdout, "bigargtest: fork failed\n");
+    3fe4:	a1 14 80 00 00       	mov    0x8014,%eax
+    3fe9:	83 ec 08             	sub    $0x8,%esp
+    3fec:	68 b2 69 00 00       	push   $0x69b2
+    3ff1:	50                   	push   %eax
+    3ff2:	e8 4e 0a 00 00       	call   4a45 <printf>
+    3ff7:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3ffa:	e8 a2 08 00 00       	call   48a1 <exit>
+  }
+  wait();
+    3fff:	e8 a5 08 00 00       	call   48a9 <wait>
+  fd = open("bigarg-ok", 0);
+    4004:	83 ec 08             	sub    $0x8,%esp
+    4007:	6a 00                	push   $0x0
+    4009:	68 ab 68 00 00       	push   $0x68ab
+    400e:	e8 ce 08 00 00       	call   48e1 <open>
+    4013:	83 c4 10             	add    $0x10,%esp
+    4016:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(fd < 0){
+    4019:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    401d:	79 1b                	jns    403a <bigargtest+0x11b>
+    printf(stdout, "bigarg test failed!\n");
+    401f:	a1 14 80 00 00       	mov    0x8014,%eax
+    4024:	83 ec 08             	sub    $0x8,%esp
+    4027:	68 cb 69 00 00       	push   $0x69cb
+    402c:	50                   	push   %eax
+    402d:	e8 13 0a 00 00       	call   4a45 <printf>
+    4032:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4035:	e8 67 08 00 00       	call   48a1 <exit>
+  }
+  close(fd);
+    403a:	83 ec 0c             	sub    $0xc,%esp
+    403d:	ff 75 ec             	push   -0x14(%ebp)
+    4040:	e8 84 08 00 00       	call   48c9 <close>
+    4045:	83 c4 10             	add    $0x10,%esp
+  unlink("bigarg-ok");
+    4048:	83 ec 0c             	sub    $0xc,%esp
+    404b:	68 ab 68 00 00       	push   $0x68ab
+    4050:	e8 9c 08 00 00       	call   48f1 <unlink>
+    4055:	83 c4 10             	add    $0x10,%esp
+}
+    4058:	90                   	nop
+    4059:	c9                   	leave
+    405a:	c3                   	ret
+
+0000405b <fsfull>:
+
+// what happens when the file system runs out of blocks?
+// answer: balloc panics, so this test is not useful.
+void
+fsfull()
+{
+    405b:	55                   	push   %ebp
+    405c:	89 e5                	mov    %esp,%ebp
+    405e:	53                   	push   %ebx
+    405f:	83 ec 64             	sub    $0x64,%esp
+  int nfiles;
+  int fsblocks = 0;
+    4062:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+
+  printf(1, "fsfull test\n");
+    4069:	83 ec 08             	sub    $0x8,%esp
+    406c:	68 e0 69 00 00       	push   $0x69e0
+    4071:	6a 01                	push   $0x1
+    4073:	e8 cd 09 00 00       	call   4a45 <printf>
+    4078:	83 c4 10             	add    $0x10,%esp
+
+  for(nfiles = 0; ; nfiles++){
+    407b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    char name[64];
+    name[0] = 'f';
+    4082:	c6 45 a4 66          	movb   $0x66,-0x5c(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    4086:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    4089:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    408e:	89 c8                	mov    %ecx,%eax
+    4090:	f7 ea                	imul   %edx
+    4092:	c1 fa 06             	sar    $0x6,%edx
+    4095:	89 c8                	mov    %ecx,%eax
+    4097:	c1 f8 1f             	sar    $0x1f,%eax
+    409a:	29 c2                	sub    %eax,%edx
+    409c:	89 d0                	mov    %edx,%eax
+    409e:	83 c0 30             	add    $0x30,%eax
+    40a1:	88 45 a5             	mov    %al,-0x5b(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    40a4:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+    40a7:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    40ac:	89 d8                	mov    %ebx,%eax
+    40ae:	f7 ea                	imul   %edx
+    40b0:	c1 fa 06             	sar    $0x6,%edx
+    40b3:	89 d8                	mov    %ebx,%eax
+    40b5:	c1 f8 1f             	sar    $0x1f,%eax
+    40b8:	89 d1                	mov    %edx,%ecx
+    40ba:	29 c1                	sub    %eax,%ecx
+    40bc:	69 c1 e8 03 00 00    	imul   $0x3e8,%ecx,%eax
+    40c2:	29 c3                	sub    %eax,%ebx
+    40c4:	89 d9                	mov    %ebx,%ecx
+    40c6:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+    40cb:	89 c8                	mov    %ecx,%eax
+    40cd:	f7 ea                	imul   %edx
+    40cf:	c1 fa 05             	sar    $0x5,%edx
+    40d2:	89 c8                	mov    %ecx,%eax
+    40d4:	c1 f8 1f             	sar    $0x1f,%eax
+    40d7:	29 c2                	sub    %eax,%edx
+    40d9:	89 d0                	mov    %edx,%eax
+    40db:	83 c0 30             	add    $0x30,%eax
+    40de:	88 45 a6             	mov    %al,-0x5a(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    40e1:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+    40e4:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+    40e9:	89 d8                	mov    %ebx,%eax
+    40eb:	f7 ea                	imul   %edx
+    40ed:	c1 fa 05             	sar    $0x5,%edx
+    40f0:	89 d8                	mov    %ebx,%eax
+    40f2:	c1 f8 1f             	sar    $0x1f,%eax
+    40f5:	89 d1                	mov    %edx,%ecx
+    40f7:	29 c1                	sub    %eax,%ecx
+    40f9:	6b c1 64             	imul   $0x64,%ecx,%eax
+    40fc:	29 c3                	sub    %eax,%ebx
+    40fe:	89 d9                	mov    %ebx,%ecx
+    4100:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    4105:	89 c8                	mov    %ecx,%eax
+    4107:	f7 ea                	imul   %edx
+    4109:	c1 fa 02             	sar    $0x2,%edx
+    410c:	89 c8                	mov    %ecx,%eax
+    410e:	c1 f8 1f             	sar    $0x1f,%eax
+    4111:	29 c2                	sub    %eax,%edx
+    4113:	89 d0                	mov    %edx,%eax
+    4115:	83 c0 30             	add    $0x30,%eax
+    4118:	88 45 a7             	mov    %al,-0x59(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    411b:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    411e:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    4123:	89 c8                	mov    %ecx,%eax
+    4125:	f7 ea                	imul   %edx
+    4127:	c1 fa 02             	sar    $0x2,%edx
+    412a:	89 c8                	mov    %ecx,%eax
+    412c:	c1 f8 1f             	sar    $0x1f,%eax
+    412f:	29 c2                	sub    %eax,%edx
+    4131:	89 d0                	mov    %edx,%eax
+    4133:	c1 e0 02             	shl    $0x2,%eax
+    4136:	01 d0                	add    %edx,%eax
+    4138:	01 c0                	add    %eax,%eax
+    413a:	29 c1                	sub    %eax,%ecx
+    413c:	89 ca                	mov    %ecx,%edx
+    413e:	89 d0                	mov    %edx,%eax
+    4140:	83 c0 30             	add    $0x30,%eax
+    4143:	88 45 a8             	mov    %al,-0x58(%ebp)
+    name[5] = '\0';
+    4146:	c6 45 a9 00          	movb   $0x0,-0x57(%ebp)
+    printf(1, "writing %s\n", name);
+    414a:	83 ec 04             	sub    $0x4,%esp
+    414d:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+    4150:	50                   	push   %eax
+    4151:	68 ed 69 00 00       	push   $0x69ed
+    4156:	6a 01                	push   $0x1
+    4158:	e8 e8 08 00 00       	call   4a45 <printf>
+    415d:	83 c4 10             	add    $0x10,%esp
+    int fd = open(name, O_CREATE|O_RDWR);
+    4160:	83 ec 08             	sub    $0x8,%esp
+    4163:	68 02 02 00 00       	push   $0x202
+    4168:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+    416b:	50                   	push   %eax
+    416c:	e8 70 07 00 00       	call   48e1 <open>
+    4171:	83 c4 10             	add    $0x10,%esp
+    4174:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(fd < 0){
+    4177:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    417b:	79 18                	jns    4195 <fsfull+0x13a>
+      printf(1, "open %s failed\n", name);
+    417d:	83 ec 04             	sub    $0x4,%esp
+    4180:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+    4183:	50                   	push   %eax
+    4184:	68 f9 69 00 00       	push   $0x69f9
+    4189:	6a 01                	push   $0x1
+    418b:	e8 b5 08 00 00       	call   4a45 <printf>
+    4190:	83 c4 10             	add    $0x10,%esp
+      break;
+    4193:	eb 6b                	jmp    4200 <fsfull+0x1a5>
+    }
+    int total = 0;
+    4195:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    while(1){
+      int cc = write(fd, buf, 512);
+    419c:	83 ec 04             	sub    $0x4,%esp
+    419f:	68 00 02 00 00       	push   $0x200
+    41a4:	68 a0 80 00 00       	push   $0x80a0
+    41a9:	ff 75 e8             	push   -0x18(%ebp)
+    41ac:	e8 10 07 00 00       	call   48c1 <write>
+    41b1:	83 c4 10             	add    $0x10,%esp
+    41b4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+      if(cc < 512)
+    41b7:	81 7d e4 ff 01 00 00 	cmpl   $0x1ff,-0x1c(%ebp)
+    41be:	7e 0c                	jle    41cc <fsfull+0x171>
+        break;
+      total += cc;
+    41c0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    41c3:	01 45 ec             	add    %eax,-0x14(%ebp)
+      fsblocks++;
+    41c6:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    while(1){
+    41ca:	eb d0                	jmp    419c <fsfull+0x141>
+        break;
+    41cc:	90                   	nop
+    }
+    printf(1, "wrote %d bytes\n", total);
+    41cd:	83 ec 04             	sub    $0x4,%esp
+    41d0:	ff 75 ec             	push   -0x14(%ebp)
+    41d3:	68 09 6a 00 00       	push   $0x6a09
+    41d8:	6a 01                	push   $0x1
+    41da:	e8 66 08 00 00       	call   4a45 <printf>
+    41df:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+    41e2:	83 ec 0c             	sub    $0xc,%esp
+    41e5:	ff 75 e8             	push   -0x18(%ebp)
+    41e8:	e8 dc 06 00 00       	call   48c9 <close>
+    41ed:	83 c4 10             	add    $0x10,%esp
+    if(total == 0)
+    41f0:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    41f4:	74 09                	je     41ff <fsfull+0x1a4>
+  for(nfiles = 0; ; nfiles++){
+    41f6:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    41fa:	e9 83 fe ff ff       	jmp    4082 <fsfull+0x27>
+      break;
+    41ff:	90                   	nop
+  }
+
+  while(nfiles >= 0){
+    4200:	e9 db 00 00 00       	jmp    42e0 <fsfull+0x285>
+    char name[64];
+    name[0] = 'f';
+    4205:	c6 45 a4 66          	movb   $0x66,-0x5c(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    4209:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    420c:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    4211:	89 c8                	mov    %ecx,%eax
+    4213:	f7 ea                	imul   %edx
+    4215:	c1 fa 06             	sar    $0x6,%edx
+    4218:	89 c8                	mov    %ecx,%eax
+    421a:	c1 f8 1f             	sar    $0x1f,%eax
+    421d:	29 c2                	sub    %eax,%edx
+    421f:	89 d0                	mov    %edx,%eax
+    4221:	83 c0 30             	add    $0x30,%eax
+    4224:	88 45 a5             	mov    %al,-0x5b(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4227:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+    422a:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    422f:	89 d8                	mov    %ebx,%eax
+    4231:	f7 ea                	imul   %edx
+    4233:	c1 fa 06             	sar    $0x6,%edx
+    4236:	89 d8                	mov    %ebx,%eax
+    4238:	c1 f8 1f             	sar    $0x1f,%eax
+    423b:	89 d1                	mov    %edx,%ecx
+    423d:	29 c1                	sub    %eax,%ecx
+    423f:	69 c1 e8 03 00 00    	imul   $0x3e8,%ecx,%eax
+    4245:	29 c3                	sub    %eax,%ebx
+    4247:	89 d9                	mov    %ebx,%ecx
+    4249:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+    424e:	89 c8                	mov    %ecx,%eax
+    4250:	f7 ea                	imul   %edx
+    4252:	c1 fa 05             	sar    $0x5,%edx
+    4255:	89 c8                	mov    %ecx,%eax
+    4257:	c1 f8 1f             	sar    $0x1f,%eax
+    425a:	29 c2                	sub    %eax,%edx
+    425c:	89 d0                	mov    %edx,%eax
+    425e:	83 c0 30             	add    $0x30,%eax
+    4261:	88 45 a6             	mov    %al,-0x5a(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    4264:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+    4267:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+    426c:	89 d8                	mov    %ebx,%eax
+    426e:	f7 ea                	imul   %edx
+    4270:	c1 fa 05             	sar    $0x5,%edx
+    4273:	89 d8                	mov    %ebx,%eax
+    4275:	c1 f8 1f             	sar    $0x1f,%eax
+    4278:	89 d1                	mov    %edx,%ecx
+    427a:	29 c1                	sub    %eax,%ecx
+    427c:	6b c1 64             	imul   $0x64,%ecx,%eax
+    427f:	29 c3                	sub    %eax,%ebx
+    4281:	89 d9                	mov    %ebx,%ecx
+    4283:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    4288:	89 c8                	mov    %ecx,%eax
+    428a:	f7 ea                	imul   %edx
+    428c:	c1 fa 02             	sar    $0x2,%edx
+    428f:	89 c8                	mov    %ecx,%eax
+    4291:	c1 f8 1f             	sar    $0x1f,%eax
+    4294:	29 c2                	sub    %eax,%edx
+    4296:	89 d0                	mov    %edx,%eax
+    4298:	83 c0 30             	add    $0x30,%eax
+    429b:	88 45 a7             	mov    %al,-0x59(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    429e:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    42a1:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    42a6:	89 c8                	mov    %ecx,%eax
+    42a8:	f7 ea                	imul   %edx
+    42aa:	c1 fa 02             	sar    $0x2,%edx
+    42ad:	89 c8                	mov    %ecx,%eax
+    42af:	c1 f8 1f             	sar    $0x1f,%eax
+    42b2:	29 c2                	sub    %eax,%edx
+    42b4:	89 d0                	mov    %edx,%eax
+    42b6:	c1 e0 02             	shl    $0x2,%eax
+    42b9:	01 d0                	add    %edx,%eax
+    42bb:	01 c0                	add    %eax,%eax
+    42bd:	29 c1                	sub    %eax,%ecx
+    42bf:	89 ca                	mov    %ecx,%edx
+    42c1:	89 d0                	mov    %edx,%eax
+    42c3:	83 c0 30             	add    $0x30,%eax
+    42c6:	88 45 a8             	mov    %al,-0x58(%ebp)
+    name[5] = '\0';
+    42c9:	c6 45 a9 00          	movb   $0x0,-0x57(%ebp)
+    unlink(name);
+    42cd:	83 ec 0c             	sub    $0xc,%esp
+    42d0:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+    42d3:	50                   	push   %eax
+    42d4:	e8 18 06 00 00       	call   48f1 <unlink>
+    42d9:	83 c4 10             	add    $0x10,%esp
+    nfiles--;
+    42dc:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+  while(nfiles >= 0){
+    42e0:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    42e4:	0f 89 1b ff ff ff    	jns    4205 <fsfull+0x1aa>
+  }
+
+  printf(1, "fsfull test finished\n");
+    42ea:	83 ec 08             	sub    $0x8,%esp
+    42ed:	68 19 6a 00 00       	push   $0x6a19
+    42f2:	6a 01                	push   $0x1
+    42f4:	e8 4c 07 00 00       	call   4a45 <printf>
+    42f9:	83 c4 10             	add    $0x10,%esp
+}
+    42fc:	90                   	nop
+    42fd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4300:	c9                   	leave
+    4301:	c3                   	ret
+
+00004302 <uio>:
+
+void
+uio()
+{
+    4302:	55                   	push   %ebp
+    4303:	89 e5                	mov    %esp,%ebp
+    4305:	83 ec 18             	sub    $0x18,%esp
+  #define RTC_ADDR 0x70
+  #define RTC_DATA 0x71
+
+  ushort port = 0;
+    4308:	66 c7 45 f6 00 00    	movw   $0x0,-0xa(%ebp)
+  uchar val = 0;
+    430e:	c6 45 f5 00          	movb   $0x0,-0xb(%ebp)
+  int pid;
+
+  printf(1, "uio test\n");
+    4312:	83 ec 08             	sub    $0x8,%esp
+    4315:	68 2f 6a 00 00       	push   $0x6a2f
+    431a:	6a 01                	push   $0x1
+    431c:	e8 24 07 00 00       	call   4a45 <printf>
+    4321:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    4324:	e8 70 05 00 00       	call   4899 <fork>
+    4329:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(pid == 0){
+    432c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    4330:	75 3a                	jne    436c <uio+0x6a>
+    port = RTC_ADDR;
+    4332:	66 c7 45 f6 70 00    	movw   $0x70,-0xa(%ebp)
+    val = 0x09;  /* year */
+    4338:	c6 45 f5 09          	movb   $0x9,-0xb(%ebp)
+    /* http://wiki.osdev.org/Inline_Assembly/Examples */
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    433c:	0f b6 45 f5          	movzbl -0xb(%ebp),%eax
+    4340:	0f b7 55 f6          	movzwl -0xa(%ebp),%edx
+    4344:	ee                   	out    %al,(%dx)
+    port = RTC_DATA;
+    4345:	66 c7 45 f6 71 00    	movw   $0x71,-0xa(%ebp)
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    434b:	0f b7 45 f6          	movzwl -0xa(%ebp),%eax
+    434f:	89 c2                	mov    %eax,%edx
+    4351:	ec                   	in     (%dx),%al
+    4352:	88 45 f5             	mov    %al,-0xb(%ebp)
+    printf(1, "uio: uio succeeded; test FAILED\n");
+    4355:	83 ec 08             	sub    $0x8,%esp
+    4358:	68 3c 6a 00 00       	push   $0x6a3c
+    435d:	6a 01                	push   $0x1
+    435f:	e8 e1 06 00 00       	call   4a45 <printf>
+    4364:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4367:	e8 35 05 00 00       	call   48a1 <exit>
+  } else if(pid < 0){
+    436c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    4370:	79 17                	jns    4389 <uio+0x87>
+    printf (1, "fork failed\n");
+    4372:	83 ec 08             	sub    $0x8,%esp
+    4375:	68 a1 50 00 00       	push   $0x50a1
+    437a:	6a 01                	push   $0x1
+    437c:	e8 c4 06 00 00       	call   4a45 <printf>
+    4381:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4384:	e8 18 05 00 00       	call   48a1 <exit>
+  }
+  wait();
+    4389:	e8 1b 05 00 00       	call   48a9 <wait>
+  printf(1, "uio test done\n");
+    438e:	83 ec 08             	sub    $0x8,%esp
+    4391:	68 5d 6a 00 00       	push   $0x6a5d
+    4396:	6a 01                	push   $0x1
+    4398:	e8 a8 06 00 00       	call   4a45 <printf>
+    439d:	83 c4 10             	add    $0x10,%esp
+}
+    43a0:	90                   	nop
+    43a1:	c9                   	leave
+    43a2:	c3                   	ret
+
+000043a3 <argptest>:
+
+void argptest()
+{
+    43a3:	55                   	push   %ebp
+    43a4:	89 e5                	mov    %esp,%ebp
+    43a6:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  fd = open("init", O_RDONLY);
+    43a9:	83 ec 08             	sub    $0x8,%esp
+    43ac:	6a 00                	push   $0x0
+    43ae:	68 6c 6a 00 00       	push   $0x6a6c
+    43b3:	e8 29 05 00 00       	call   48e1 <open>
+    43b8:	83 c4 10             	add    $0x10,%esp
+    43bb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if (fd < 0) {
+    43be:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    43c2:	79 17                	jns    43db <argptest+0x38>
+    printf(2, "open failed\n");
+    43c4:	83 ec 08             	sub    $0x8,%esp
+    43c7:	68 71 6a 00 00       	push   $0x6a71
+    43cc:	6a 02                	push   $0x2
+    43ce:	e8 72 06 00 00       	call   4a45 <printf>
+    43d3:	83 c4 10             	add    $0x10,%esp
+    exit();
+    43d6:	e8 c6 04 00 00       	call   48a1 <exit>
+  }
+  read(fd, sbrk(0) - 1, -1);
+    43db:	83 ec 0c             	sub    $0xc,%esp
+    43de:	6a 00                	push   $0x0
+    43e0:	e8 44 05 00 00       	call   4929 <sbrk>
+    43e5:	83 c4 10             	add    $0x10,%esp
+    43e8:	83 e8 01             	sub    $0x1,%eax
+    43eb:	83 ec 04             	sub    $0x4,%esp
+    43ee:	6a ff                	push   $0xffffffff
+    43f0:	50                   	push   %eax
+    43f1:	ff 75 f4             	push   -0xc(%ebp)
+    43f4:	e8 c0 04 00 00       	call   48b9 <read>
+    43f9:	83 c4 10             	add    $0x10,%esp
+  close(fd);
+    43fc:	83 ec 0c             	sub    $0xc,%esp
+    43ff:	ff 75 f4             	push   -0xc(%ebp)
+    4402:	e8 c2 04 00 00       	call   48c9 <close>
+    4407:	83 c4 10             	add    $0x10,%esp
+  printf(1, "arg test passed\n");
+    440a:	83 ec 08             	sub    $0x8,%esp
+    440d:	68 7e 6a 00 00       	push   $0x6a7e
+    4412:	6a 01                	push   $0x1
+    4414:	e8 2c 06 00 00       	call   4a45 <printf>
+    4419:	83 c4 10             	add    $0x10,%esp
+}
+    441c:	90                   	nop
+    441d:	c9                   	leave
+    441e:	c3                   	ret
+
+0000441f <rand>:
+
+unsigned long randstate = 1;
+unsigned int
+rand()
+{
+    441f:	55                   	push   %ebp
+    4420:	89 e5                	mov    %esp,%ebp
+  randstate = randstate * 1664525 + 1013904223;
+    4422:	a1 84 80 00 00       	mov    0x8084,%eax
+    4427:	69 c0 0d 66 19 00    	imul   $0x19660d,%eax,%eax
+    442d:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    4432:	a3 84 80 00 00       	mov    %eax,0x8084
+  return randstate;
+    4437:	a1 84 80 00 00       	mov    0x8084,%eax
+}
+    443c:	5d                   	pop    %ebp
+    443d:	c3                   	ret
+
+0000443e <main>:
+
+int
+main(int argc, char *argv[])
+{
+    443e:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    4442:	83 e4 f0             	and    $0xfffffff0,%esp
+    4445:	ff 71 fc             	push   -0x4(%ecx)
+    4448:	55                   	push   %ebp
+    4449:	89 e5                	mov    %esp,%ebp
+    444b:	51                   	push   %ecx
+    444c:	83 ec 04             	sub    $0x4,%esp
+  printf(1, "usertests starting\n");
+    444f:	83 ec 08             	sub    $0x8,%esp
+    4452:	68 8f 6a 00 00       	push   $0x6a8f
+    4457:	6a 01                	push   $0x1
+    4459:	e8 e7 05 00 00       	call   4a45 <printf>
+    445e:	83 c4 10             	add    $0x10,%esp
+
+  if(open("usertests.ran", 0) >= 0){
+    4461:	83 ec 08             	sub    $0x8,%esp
+    4464:	6a 00                	push   $0x0
+    4466:	68 a3 6a 00 00       	push   $0x6aa3
+    446b:	e8 71 04 00 00       	call   48e1 <open>
+    4470:	83 c4 10             	add    $0x10,%esp
+    4473:	85 c0                	test   %eax,%eax
+    4475:	78 17                	js     448e <main+0x50>
+    printf(1, "already ran user tests -- rebuild fs.img\n");
+    4477:	83 ec 08             	sub    $0x8,%esp
+    447a:	68 b4 6a 00 00       	push   $0x6ab4
+    447f:	6a 01                	push   $0x1
+    4481:	e8 bf 05 00 00       	call   4a45 <printf>
+    4486:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4489:	e8 13 04 00 00       	call   48a1 <exit>
+  }
+  close(open("usertests.ran", O_CREATE));
+    448e:	83 ec 08             	sub    $0x8,%esp
+    4491:	68 00 02 00 00       	push   $0x200
+    4496:	68 a3 6a 00 00       	push   $0x6aa3
+    449b:	e8 41 04 00 00       	call   48e1 <open>
+    44a0:	83 c4 10             	add    $0x10,%esp
+    44a3:	83 ec 0c             	sub    $0xc,%esp
+    44a6:	50                   	push   %eax
+    44a7:	e8 1d 04 00 00       	call   48c9 <close>
+    44ac:	83 c4 10             	add    $0x10,%esp
+
+  argptest();
+    44af:	e8 ef fe ff ff       	call   43a3 <argptest>
+  createdelete();
+    44b4:	e8 ed cd ff ff       	call   12a6 <createdelete>
+  linkunlink();
+    44b9:	e8 12 d8 ff ff       	call   1cd0 <linkunlink>
+  concreate();
+    44be:	e8 59 d4 ff ff       	call   191c <concreate>
+  fourfiles();
+    44c3:	e8 8d cb ff ff       	call   1055 <fourfiles>
+  sharedfd();
+    44c8:	e8 a5 c9 ff ff       	call   e72 <sharedfd>
+
+  bigargtest();
+    44cd:	e8 4d fa ff ff       	call   3f1f <bigargtest>
+  bigwrite();
+    44d2:	e8 f5 e1 ff ff       	call   26cc <bigwrite>
+  bigargtest();
+    44d7:	e8 43 fa ff ff       	call   3f1f <bigargtest>
+  bsstest();
+    44dc:	e8 c8 f9 ff ff       	call   3ea9 <bsstest>
+  sbrktest();
+    44e1:	e8 e1 f3 ff ff       	call   38c7 <sbrktest>
+  mmaptest();
+    44e6:	e8 39 ef ff ff       	call   3424 <mmaptest>
+  validatetest();
+    44eb:	e8 db f8 ff ff       	call   3dcb <validatetest>
+
+  opentest();
+    44f0:	e8 0a be ff ff       	call   2ff <opentest>
+  writetest();
+    44f5:	e8 b4 be ff ff       	call   3ae <writetest>
+  writetest1();
+    44fa:	e8 bf c0 ff ff       	call   5be <writetest1>
+  createtest();
+    44ff:	e8 af c2 ff ff       	call   7b3 <createtest>
+
+  openiputtest();
+    4504:	e8 e7 bc ff ff       	call   1f0 <openiputtest>
+  exitiputtest();
+    4509:	e8 e3 bb ff ff       	call   f1 <exitiputtest>
+  iputtest();
+    450e:	e8 ed ba ff ff       	call   0 <iputtest>
+
+  mem();
+    4513:	e8 69 c8 ff ff       	call   d81 <mem>
+  pipe1();
+    4518:	e8 9d c4 ff ff       	call   9ba <pipe1>
+  preempt();
+    451d:	e8 81 c6 ff ff       	call   ba3 <preempt>
+  exitwait();
+    4522:	e8 e2 c7 ff ff       	call   d09 <exitwait>
+
+  rmdot();
+    4527:	e8 12 e6 ff ff       	call   2b3e <rmdot>
+  fourteen();
+    452c:	e8 b1 e4 ff ff       	call   29e2 <fourteen>
+  bigfile();
+    4531:	e8 94 e2 ff ff       	call   27ca <bigfile>
+  subdir();
+    4536:	e8 4d da ff ff       	call   1f88 <subdir>
+  linktest();
+    453b:	e8 9a d1 ff ff       	call   16da <linktest>
+  unlinkread();
+    4540:	e8 d3 cf ff ff       	call   1518 <unlinkread>
+  dirfile();
+    4545:	e8 79 e7 ff ff       	call   2cc3 <dirfile>
+  iref();
+    454a:	e8 ac e9 ff ff       	call   2efb <iref>
+  forktest();
+    454f:	e8 e1 ea ff ff       	call   3035 <forktest>
+  cowtest();
+    4554:	e8 a6 eb ff ff       	call   30ff <cowtest>
+  bigdir(); // slow
+    4559:	e8 a9 d8 ff ff       	call   1e07 <bigdir>
+
+  uio();
+    455e:	e8 9f fd ff ff       	call   4302 <uio>
+
+  exectest();
+    4563:	e8 ff c3 ff ff       	call   967 <exectest>
+
+  exit();
+    4568:	e8 34 03 00 00       	call   48a1 <exit>
+
+0000456d <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    456d:	55                   	push   %ebp
+    456e:	89 e5                	mov    %esp,%ebp
+    4570:	57                   	push   %edi
+    4571:	53                   	push   %ebx
+    if(cc < 1)
+    4572:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    4575:	8b 55 10             	mov    0x10(%ebp),%edx
+    4578:	8b 45 0c             	mov    0xc(%ebp),%eax
+    457b:	89 cb                	mov    %ecx,%ebx
+    457d:	89 df                	mov    %ebx,%edi
+    457f:	89 d1                	mov    %edx,%ecx
+    4581:	fc                   	cld
+    4582:	f3 aa                	rep stos %al,%es:(%edi)
+    4584:	89 ca                	mov    %ecx,%edx
+    4586:	89 fb                	mov    %edi,%ebx
+    4588:	89 5d 08             	mov    %ebx,0x8(%ebp)
+    458b:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+    458e:	90                   	nop
+    458f:	5b                   	pop    %ebx
+    4590:	5f                   	pop    %edi
+    4591:	5d                   	pop    %ebp
+    4592:	c3                   	ret
+
+00004593 <strcpy>:
+{
+    4593:	55                   	push   %ebp
+    4594:	89 e5                	mov    %esp,%ebp
+    4596:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+    4599:	8b 45 08             	mov    0x8(%ebp),%eax
+    459c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+    459f:	90                   	nop
+    45a0:	8b 55 0c             	mov    0xc(%ebp),%edx
+    45a3:	8d 42 01             	lea    0x1(%edx),%eax
+    45a6:	89 45 0c             	mov    %eax,0xc(%ebp)
+    45a9:	8b 45 08             	mov    0x8(%ebp),%eax
+    45ac:	8d 48 01             	lea    0x1(%eax),%ecx
+    45af:	89 4d 08             	mov    %ecx,0x8(%ebp)
+    45b2:	0f b6 12             	movzbl (%edx),%edx
+    45b5:	88 10                	mov    %dl,(%eax)
+    45b7:	0f b6 00             	movzbl (%eax),%eax
+    45ba:	84 c0                	test   %al,%al
+    45bc:	75 e2                	jne    45a0 <strcpy+0xd>
+  return os;
+    45be:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+    45c1:	c9                   	leave
+    45c2:	c3                   	ret
+
+000045c3 <strcmp>:
+{
+    45c3:	55                   	push   %ebp
+    45c4:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+    45c6:	eb 08                	jmp    45d0 <strcmp+0xd>
+    p++, q++;
+    45c8:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+    45cc:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+    45d0:	8b 45 08             	mov    0x8(%ebp),%eax
+    45d3:	0f b6 00             	movzbl (%eax),%eax
+    45d6:	84 c0                	test   %al,%al
+    45d8:	74 10                	je     45ea <strcmp+0x27>
+    45da:	8b 45 08             	mov    0x8(%ebp),%eax
+    45dd:	0f b6 10             	movzbl (%eax),%edx
+    45e0:	8b 45 0c             	mov    0xc(%ebp),%eax
+    45e3:	0f b6 00             	movzbl (%eax),%eax
+    45e6:	38 c2                	cmp    %al,%dl
+    45e8:	74 de                	je     45c8 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+    45ea:	8b 45 08             	mov    0x8(%ebp),%eax
+    45ed:	0f b6 00             	movzbl (%eax),%eax
+    45f0:	0f b6 d0             	movzbl %al,%edx
+    45f3:	8b 45 0c             	mov    0xc(%ebp),%eax
+    45f6:	0f b6 00             	movzbl (%eax),%eax
+    45f9:	0f b6 c0             	movzbl %al,%eax
+    45fc:	29 c2                	sub    %eax,%edx
+    45fe:	89 d0                	mov    %edx,%eax
+}
+    4600:	5d                   	pop    %ebp
+    4601:	c3                   	ret
+
+00004602 <strlen>:
+{
+    4602:	55                   	push   %ebp
+    4603:	89 e5                	mov    %esp,%ebp
+    4605:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+    4608:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    460f:	eb 04                	jmp    4615 <strlen+0x13>
+    4611:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+    4615:	8b 55 fc             	mov    -0x4(%ebp),%edx
+    4618:	8b 45 08             	mov    0x8(%ebp),%eax
+    461b:	01 d0                	add    %edx,%eax
+    461d:	0f b6 00             	movzbl (%eax),%eax
+    4620:	84 c0                	test   %al,%al
+    4622:	75 ed                	jne    4611 <strlen+0xf>
+  return n;
+    4624:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+    4627:	c9                   	leave
+    4628:	c3                   	ret
+
+00004629 <memset>:
+{
+    4629:	55                   	push   %ebp
+    462a:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+    462c:	8b 45 10             	mov    0x10(%ebp),%eax
+    462f:	50                   	push   %eax
+    4630:	ff 75 0c             	push   0xc(%ebp)
+    4633:	ff 75 08             	push   0x8(%ebp)
+    4636:	e8 32 ff ff ff       	call   456d <stosb>
+    463b:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+    463e:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    4641:	c9                   	leave
+    4642:	c3                   	ret
+
+00004643 <strchr>:
+{
+    4643:	55                   	push   %ebp
+    4644:	89 e5                	mov    %esp,%ebp
+    4646:	83 ec 04             	sub    $0x4,%esp
+    4649:	8b 45 0c             	mov    0xc(%ebp),%eax
+    464c:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+    464f:	eb 14                	jmp    4665 <strchr+0x22>
+    if(*s == c)
+    4651:	8b 45 08             	mov    0x8(%ebp),%eax
+    4654:	0f b6 00             	movzbl (%eax),%eax
+    4657:	38 45 fc             	cmp    %al,-0x4(%ebp)
+    465a:	75 05                	jne    4661 <strchr+0x1e>
+      return (char*)s;
+    465c:	8b 45 08             	mov    0x8(%ebp),%eax
+    465f:	eb 13                	jmp    4674 <strchr+0x31>
+  for(; *s; s++)
+    4661:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+    4665:	8b 45 08             	mov    0x8(%ebp),%eax
+    4668:	0f b6 00             	movzbl (%eax),%eax
+    466b:	84 c0                	test   %al,%al
+    466d:	75 e2                	jne    4651 <strchr+0xe>
+  return 0;
+    466f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    4674:	c9                   	leave
+    4675:	c3                   	ret
+
+00004676 <gets>:
+{
+    4676:	55                   	push   %ebp
+    4677:	89 e5                	mov    %esp,%ebp
+    4679:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+    467c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    4683:	eb 42                	jmp    46c7 <gets+0x51>
+    cc = read(0, &c, 1);
+    4685:	83 ec 04             	sub    $0x4,%esp
+    4688:	6a 01                	push   $0x1
+    468a:	8d 45 ef             	lea    -0x11(%ebp),%eax
+    468d:	50                   	push   %eax
+    468e:	6a 00                	push   $0x0
+    4690:	e8 24 02 00 00       	call   48b9 <read>
+    4695:	83 c4 10             	add    $0x10,%esp
+    4698:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+    469b:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    469f:	7e 33                	jle    46d4 <gets+0x5e>
+    buf[i++] = c;
+    46a1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    46a4:	8d 50 01             	lea    0x1(%eax),%edx
+    46a7:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    46aa:	89 c2                	mov    %eax,%edx
+    46ac:	8b 45 08             	mov    0x8(%ebp),%eax
+    46af:	01 c2                	add    %eax,%edx
+    46b1:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    46b5:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+    46b7:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    46bb:	3c 0a                	cmp    $0xa,%al
+    46bd:	74 16                	je     46d5 <gets+0x5f>
+    46bf:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    46c3:	3c 0d                	cmp    $0xd,%al
+    46c5:	74 0e                	je     46d5 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+    46c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    46ca:	83 c0 01             	add    $0x1,%eax
+    46cd:	39 45 0c             	cmp    %eax,0xc(%ebp)
+    46d0:	7f b3                	jg     4685 <gets+0xf>
+    46d2:	eb 01                	jmp    46d5 <gets+0x5f>
+      break;
+    46d4:	90                   	nop
+  }
+  buf[i] = '\0';
+    46d5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    46d8:	8b 45 08             	mov    0x8(%ebp),%eax
+    46db:	01 d0                	add    %edx,%eax
+    46dd:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+    46e0:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    46e3:	c9                   	leave
+    46e4:	c3                   	ret
+
+000046e5 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+    46e5:	55                   	push   %ebp
+    46e6:	89 e5                	mov    %esp,%ebp
+    46e8:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    46eb:	83 ec 08             	sub    $0x8,%esp
+    46ee:	6a 00                	push   $0x0
+    46f0:	ff 75 08             	push   0x8(%ebp)
+    46f3:	e8 e9 01 00 00       	call   48e1 <open>
+    46f8:	83 c4 10             	add    $0x10,%esp
+    46fb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+    46fe:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    4702:	79 07                	jns    470b <stat+0x26>
+    return -1;
+    4704:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    4709:	eb 25                	jmp    4730 <stat+0x4b>
+  r = fstat(fd, st);
+    470b:	83 ec 08             	sub    $0x8,%esp
+    470e:	ff 75 0c             	push   0xc(%ebp)
+    4711:	ff 75 f4             	push   -0xc(%ebp)
+    4714:	e8 e0 01 00 00       	call   48f9 <fstat>
+    4719:	83 c4 10             	add    $0x10,%esp
+    471c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+    471f:	83 ec 0c             	sub    $0xc,%esp
+    4722:	ff 75 f4             	push   -0xc(%ebp)
+    4725:	e8 9f 01 00 00       	call   48c9 <close>
+    472a:	83 c4 10             	add    $0x10,%esp
+  return r;
+    472d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+    4730:	c9                   	leave
+    4731:	c3                   	ret
+
+00004732 <atoi>:
+
+int
+atoi(const char *s)
+{
+    4732:	55                   	push   %ebp
+    4733:	89 e5                	mov    %esp,%ebp
+    4735:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+    4738:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+    473f:	eb 25                	jmp    4766 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+    4741:	8b 55 fc             	mov    -0x4(%ebp),%edx
+    4744:	89 d0                	mov    %edx,%eax
+    4746:	c1 e0 02             	shl    $0x2,%eax
+    4749:	01 d0                	add    %edx,%eax
+    474b:	01 c0                	add    %eax,%eax
+    474d:	89 c1                	mov    %eax,%ecx
+    474f:	8b 45 08             	mov    0x8(%ebp),%eax
+    4752:	8d 50 01             	lea    0x1(%eax),%edx
+    4755:	89 55 08             	mov    %edx,0x8(%ebp)
+    4758:	0f b6 00             	movzbl (%eax),%eax
+    475b:	0f be c0             	movsbl %al,%eax
+    475e:	01 c8                	add    %ecx,%eax
+    4760:	83 e8 30             	sub    $0x30,%eax
+    4763:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+    4766:	8b 45 08             	mov    0x8(%ebp),%eax
+    4769:	0f b6 00             	movzbl (%eax),%eax
+    476c:	3c 2f                	cmp    $0x2f,%al
+    476e:	7e 0a                	jle    477a <atoi+0x48>
+    4770:	8b 45 08             	mov    0x8(%ebp),%eax
+    4773:	0f b6 00             	movzbl (%eax),%eax
+    4776:	3c 39                	cmp    $0x39,%al
+    4778:	7e c7                	jle    4741 <atoi+0xf>
+  return n;
+    477a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+    477d:	c9                   	leave
+    477e:	c3                   	ret
+
+0000477f <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+    477f:	55                   	push   %ebp
+    4780:	89 e5                	mov    %esp,%ebp
+    4782:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+
+  dst = vdst;
+    4785:	8b 45 08             	mov    0x8(%ebp),%eax
+    4788:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+    478b:	8b 45 0c             	mov    0xc(%ebp),%eax
+    478e:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+    4791:	eb 17                	jmp    47aa <memmove+0x2b>
+    *dst++ = *src++;
+    4793:	8b 55 f8             	mov    -0x8(%ebp),%edx
+    4796:	8d 42 01             	lea    0x1(%edx),%eax
+    4799:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    479c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    479f:	8d 48 01             	lea    0x1(%eax),%ecx
+    47a2:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+    47a5:	0f b6 12             	movzbl (%edx),%edx
+    47a8:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+    47aa:	8b 45 10             	mov    0x10(%ebp),%eax
+    47ad:	8d 50 ff             	lea    -0x1(%eax),%edx
+    47b0:	89 55 10             	mov    %edx,0x10(%ebp)
+    47b3:	85 c0                	test   %eax,%eax
+    47b5:	7f dc                	jg     4793 <memmove+0x14>
+  return vdst;
+    47b7:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    47ba:	c9                   	leave
+    47bb:	c3                   	ret
+
+000047bc <opendir>:
+    int fd;
+    int child;
+} DIR;
+
+DIR* opendir(const char* name)
+{
+    47bc:	55                   	push   %ebp
+    47bd:	89 e5                	mov    %esp,%ebp
+    47bf:	83 ec 18             	sub    $0x18,%esp
+    DIR* dp = malloc(sizeof(*dp));
+    47c2:	83 ec 0c             	sub    $0xc,%esp
+    47c5:	6a 08                	push   $0x8
+    47c7:	e8 4d 05 00 00       	call   4d19 <malloc>
+    47cc:	83 c4 10             	add    $0x10,%esp
+    47cf:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+    dp->fd = open((char*)name, 0);
+    47d2:	83 ec 08             	sub    $0x8,%esp
+    47d5:	6a 00                	push   $0x0
+    47d7:	ff 75 08             	push   0x8(%ebp)
+    47da:	e8 02 01 00 00       	call   48e1 <open>
+    47df:	83 c4 10             	add    $0x10,%esp
+    47e2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    47e5:	89 02                	mov    %eax,(%edx)
+    dp->child = 0;
+    47e7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    47ea:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+
+    return dp;
+    47f1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    47f4:	c9                   	leave
+    47f5:	c3                   	ret
+
+000047f6 <closedir>:
+
+void closedir(DIR* dp)
+{
+    47f6:	55                   	push   %ebp
+    47f7:	89 e5                	mov    %esp,%ebp
+    47f9:	83 ec 08             	sub    $0x8,%esp
+    if(dp == 0) {
+    47fc:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    4800:	74 21                	je     4823 <closedir+0x2d>
+        return;
+    }
+
+    close(dp->fd);
+    4802:	8b 45 08             	mov    0x8(%ebp),%eax
+    4805:	8b 00                	mov    (%eax),%eax
+    4807:	83 ec 0c             	sub    $0xc,%esp
+    480a:	50                   	push   %eax
+    480b:	e8 b9 00 00 00       	call   48c9 <close>
+    4810:	83 c4 10             	add    $0x10,%esp
+    free(dp);
+    4813:	83 ec 0c             	sub    $0xc,%esp
+    4816:	ff 75 08             	push   0x8(%ebp)
+    4819:	e8 b9 03 00 00       	call   4bd7 <free>
+    481e:	83 c4 10             	add    $0x10,%esp
+    4821:	eb 01                	jmp    4824 <closedir+0x2e>
+        return;
+    4823:	90                   	nop
+}
+    4824:	c9                   	leave
+    4825:	c3                   	ret
+
+00004826 <readdir>:
+
+struct dirent* readdir(DIR* dp)
+{
+    4826:	55                   	push   %ebp
+    4827:	89 e5                	mov    %esp,%ebp
+    4829:	83 ec 18             	sub    $0x18,%esp
+    if(dp == 0) {
+    482c:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    4830:	75 07                	jne    4839 <readdir+0x13>
+      return 0;
+    4832:	b8 00 00 00 00       	mov    $0x0,%eax
+    4837:	eb 5e                	jmp    4897 <readdir+0x71>
+    }
+
+    struct dirent* de = malloc(sizeof(*de));
+    4839:	83 ec 0c             	sub    $0xc,%esp
+    483c:	68 0c 01 00 00       	push   $0x10c
+    4841:	e8 d3 04 00 00       	call   4d19 <malloc>
+    4846:	83 c4 10             	add    $0x10,%esp
+    4849:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    int res = direntry(dp->fd, dp->child, de);
+    484c:	8b 45 08             	mov    0x8(%ebp),%eax
+    484f:	8b 50 04             	mov    0x4(%eax),%edx
+    4852:	8b 45 08             	mov    0x8(%ebp),%eax
+    4855:	8b 00                	mov    (%eax),%eax
+    4857:	83 ec 04             	sub    $0x4,%esp
+    485a:	ff 75 f4             	push   -0xc(%ebp)
+    485d:	52                   	push   %edx
+    485e:	50                   	push   %eax
+    485f:	e8 e5 00 00 00       	call   4949 <direntry>
+    4864:	83 c4 10             	add    $0x10,%esp
+    4867:	89 45 f0             	mov    %eax,-0x10(%ebp)
+
+    // out of children or other error
+    if(res == -1) {
+    486a:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+    486e:	75 15                	jne    4885 <readdir+0x5f>
+        free(de);
+    4870:	83 ec 0c             	sub    $0xc,%esp
+    4873:	ff 75 f4             	push   -0xc(%ebp)
+    4876:	e8 5c 03 00 00       	call   4bd7 <free>
+    487b:	83 c4 10             	add    $0x10,%esp
+        return 0;
+    487e:	b8 00 00 00 00       	mov    $0x0,%eax
+    4883:	eb 12                	jmp    4897 <readdir+0x71>
+    }
+
+    dp->child++;
+    4885:	8b 45 08             	mov    0x8(%ebp),%eax
+    4888:	8b 40 04             	mov    0x4(%eax),%eax
+    488b:	8d 50 01             	lea    0x1(%eax),%edx
+    488e:	8b 45 08             	mov    0x8(%ebp),%eax
+    4891:	89 50 04             	mov    %edx,0x4(%eax)
+    return de;
+    4894:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    4897:	c9                   	leave
+    4898:	c3                   	ret
+
+00004899 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    4899:	b8 01 00 00 00       	mov    $0x1,%eax
+    489e:	cd 40                	int    $0x40
+    48a0:	c3                   	ret
+
+000048a1 <exit>:
+SYSCALL(exit)
+    48a1:	b8 02 00 00 00       	mov    $0x2,%eax
+    48a6:	cd 40                	int    $0x40
+    48a8:	c3                   	ret
+
+000048a9 <wait>:
+SYSCALL(wait)
+    48a9:	b8 03 00 00 00       	mov    $0x3,%eax
+    48ae:	cd 40                	int    $0x40
+    48b0:	c3                   	ret
+
+000048b1 <pipe>:
+SYSCALL(pipe)
+    48b1:	b8 04 00 00 00       	mov    $0x4,%eax
+    48b6:	cd 40                	int    $0x40
+    48b8:	c3                   	ret
+
+000048b9 <read>:
+SYSCALL(read)
+    48b9:	b8 05 00 00 00       	mov    $0x5,%eax
+    48be:	cd 40                	int    $0x40
+    48c0:	c3                   	ret
+
+000048c1 <write>:
+SYSCALL(write)
+    48c1:	b8 10 00 00 00       	mov    $0x10,%eax
+    48c6:	cd 40                	int    $0x40
+    48c8:	c3                   	ret
+
+000048c9 <close>:
+SYSCALL(close)
+    48c9:	b8 15 00 00 00       	mov    $0x15,%eax
+    48ce:	cd 40                	int    $0x40
+    48d0:	c3                   	ret
+
+000048d1 <kill>:
+SYSCALL(kill)
+    48d1:	b8 06 00 00 00       	mov    $0x6,%eax
+    48d6:	cd 40                	int    $0x40
+    48d8:	c3                   	ret
+
+000048d9 <exec>:
+SYSCALL(exec)
+    48d9:	b8 07 00 00 00       	mov    $0x7,%eax
+    48de:	cd 40                	int    $0x40
+    48e0:	c3                   	ret
+
+000048e1 <open>:
+SYSCALL(open)
+    48e1:	b8 0f 00 00 00       	mov    $0xf,%eax
+    48e6:	cd 40                	int    $0x40
+    48e8:	c3                   	ret
+
+000048e9 <mknod>:
+SYSCALL(mknod)
+    48e9:	b8 11 00 00 00       	mov    $0x11,%eax
+    48ee:	cd 40                	int    $0x40
+    48f0:	c3                   	ret
+
+000048f1 <unlink>:
+SYSCALL(unlink)
+    48f1:	b8 12 00 00 00       	mov    $0x12,%eax
+    48f6:	cd 40                	int    $0x40
+    48f8:	c3                   	ret
+
+000048f9 <fstat>:
+SYSCALL(fstat)
+    48f9:	b8 08 00 00 00       	mov    $0x8,%eax
+    48fe:	cd 40                	int    $0x40
+    4900:	c3                   	ret
+
+00004901 <link>:
+SYSCALL(link)
+    4901:	b8 13 00 00 00       	mov    $0x13,%eax
+    4906:	cd 40                	int    $0x40
+    4908:	c3                   	ret
+
+00004909 <mkdir>:
+SYSCALL(mkdir)
+    4909:	b8 14 00 00 00       	mov    $0x14,%eax
+    490e:	cd 40                	int    $0x40
+    4910:	c3                   	ret
+
+00004911 <chdir>:
+SYSCALL(chdir)
+    4911:	b8 09 00 00 00       	mov    $0x9,%eax
+    4916:	cd 40                	int    $0x40
+    4918:	c3                   	ret
+
+00004919 <dup>:
+SYSCALL(dup)
+    4919:	b8 0a 00 00 00       	mov    $0xa,%eax
+    491e:	cd 40                	int    $0x40
+    4920:	c3                   	ret
+
+00004921 <getpid>:
+SYSCALL(getpid)
+    4921:	b8 0b 00 00 00       	mov    $0xb,%eax
+    4926:	cd 40                	int    $0x40
+    4928:	c3                   	ret
+
+00004929 <sbrk>:
+SYSCALL(sbrk)
+    4929:	b8 0c 00 00 00       	mov    $0xc,%eax
+    492e:	cd 40                	int    $0x40
+    4930:	c3                   	ret
+
+00004931 <sleep>:
+SYSCALL(sleep)
+    4931:	b8 0d 00 00 00       	mov    $0xd,%eax
+    4936:	cd 40                	int    $0x40
+    4938:	c3                   	ret
+
+00004939 <uptime>:
+SYSCALL(uptime)
+    4939:	b8 0e 00 00 00       	mov    $0xe,%eax
+    493e:	cd 40                	int    $0x40
+    4940:	c3                   	ret
+
+00004941 <mount>:
+SYSCALL(mount)
+    4941:	b8 16 00 00 00       	mov    $0x16,%eax
+    4946:	cd 40                	int    $0x40
+    4948:	c3                   	ret
+
+00004949 <direntry>:
+SYSCALL(direntry)
+    4949:	b8 17 00 00 00       	mov    $0x17,%eax
+    494e:	cd 40                	int    $0x40
+    4950:	c3                   	ret
+
+00004951 <sync>:
+SYSCALL(sync)
+    4951:	b8 18 00 00 00       	mov    $0x18,%eax
+    4956:	cd 40                	int    $0x40
+    4958:	c3                   	ret
+
+00004959 <fsync>:
+SYSCALL(fsync)
+    4959:	b8 19 00 00 00       	mov    $0x19,%eax
+    495e:	cd 40                	int    $0x40
+    4960:	c3                   	ret
+
+00004961 <mmap>:
+SYSCALL(mmap)
+    4961:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    4966:	cd 40                	int    $0x40
+    4968:	c3                   	ret
+
+00004969 <munmap>:
+SYSCALL(munmap)
+    4969:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    496e:	cd 40                	int    $0x40
+    4970:	c3                   	ret
+
+00004971 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+    4971:	55                   	push   %ebp
+    4972:	89 e5                	mov    %esp,%ebp
+    4974:	83 ec 18             	sub    $0x18,%esp
+    4977:	8b 45 0c             	mov    0xc(%ebp),%eax
+    497a:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+    497d:	83 ec 04             	sub    $0x4,%esp
+    4980:	6a 01                	push   $0x1
+    4982:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    4985:	50                   	push   %eax
+    4986:	ff 75 08             	push   0x8(%ebp)
+    4989:	e8 33 ff ff ff       	call   48c1 <write>
+    498e:	83 c4 10             	add    $0x10,%esp
+}
+    4991:	90                   	nop
+    4992:	c9                   	leave
+    4993:	c3                   	ret
+
+00004994 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    4994:	55                   	push   %ebp
+    4995:	89 e5                	mov    %esp,%ebp
+    4997:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+    499a:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+    49a1:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+    49a5:	74 17                	je     49be <printint+0x2a>
+    49a7:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+    49ab:	79 11                	jns    49be <printint+0x2a>
+    neg = 1;
+    49ad:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+    49b4:	8b 45 0c             	mov    0xc(%ebp),%eax
+    49b7:	f7 d8                	neg    %eax
+    49b9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    49bc:	eb 06                	jmp    49c4 <printint+0x30>
+  } else {
+    x = xx;
+    49be:	8b 45 0c             	mov    0xc(%ebp),%eax
+    49c1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+    49c4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+    49cb:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    49ce:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    49d1:	ba 00 00 00 00       	mov    $0x0,%edx
+    49d6:	f7 f1                	div    %ecx
+    49d8:	89 d1                	mov    %edx,%ecx
+    49da:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    49dd:	8d 50 01             	lea    0x1(%eax),%edx
+    49e0:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    49e3:	0f b6 91 88 80 00 00 	movzbl 0x8088(%ecx),%edx
+    49ea:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+    49ee:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    49f1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    49f4:	ba 00 00 00 00       	mov    $0x0,%edx
+    49f9:	f7 f1                	div    %ecx
+    49fb:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    49fe:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    4a02:	75 c7                	jne    49cb <printint+0x37>
+  if(neg)
+    4a04:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    4a08:	74 2d                	je     4a37 <printint+0xa3>
+    buf[i++] = '-';
+    4a0a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4a0d:	8d 50 01             	lea    0x1(%eax),%edx
+    4a10:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    4a13:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+    4a18:	eb 1d                	jmp    4a37 <printint+0xa3>
+    putc(fd, buf[i]);
+    4a1a:	8d 55 dc             	lea    -0x24(%ebp),%edx
+    4a1d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4a20:	01 d0                	add    %edx,%eax
+    4a22:	0f b6 00             	movzbl (%eax),%eax
+    4a25:	0f be c0             	movsbl %al,%eax
+    4a28:	83 ec 08             	sub    $0x8,%esp
+    4a2b:	50                   	push   %eax
+    4a2c:	ff 75 08             	push   0x8(%ebp)
+    4a2f:	e8 3d ff ff ff       	call   4971 <putc>
+    4a34:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+    4a37:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+    4a3b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    4a3f:	79 d9                	jns    4a1a <printint+0x86>
+}
+    4a41:	90                   	nop
+    4a42:	90                   	nop
+    4a43:	c9                   	leave
+    4a44:	c3                   	ret
+
+00004a45 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    4a45:	55                   	push   %ebp
+    4a46:	89 e5                	mov    %esp,%ebp
+    4a48:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+    4a4b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+    4a52:	8d 45 0c             	lea    0xc(%ebp),%eax
+    4a55:	83 c0 04             	add    $0x4,%eax
+    4a58:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+    4a5b:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    4a62:	e9 59 01 00 00       	jmp    4bc0 <printf+0x17b>
+    c = fmt[i] & 0xff;
+    4a67:	8b 55 0c             	mov    0xc(%ebp),%edx
+    4a6a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    4a6d:	01 d0                	add    %edx,%eax
+    4a6f:	0f b6 00             	movzbl (%eax),%eax
+    4a72:	0f be c0             	movsbl %al,%eax
+    4a75:	25 ff 00 00 00       	and    $0xff,%eax
+    4a7a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+    4a7d:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    4a81:	75 2c                	jne    4aaf <printf+0x6a>
+      if(c == '%'){
+    4a83:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+    4a87:	75 0c                	jne    4a95 <printf+0x50>
+        state = '%';
+    4a89:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+    4a90:	e9 27 01 00 00       	jmp    4bbc <printf+0x177>
+      } else {
+        putc(fd, c);
+    4a95:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    4a98:	0f be c0             	movsbl %al,%eax
+    4a9b:	83 ec 08             	sub    $0x8,%esp
+    4a9e:	50                   	push   %eax
+    4a9f:	ff 75 08             	push   0x8(%ebp)
+    4aa2:	e8 ca fe ff ff       	call   4971 <putc>
+    4aa7:	83 c4 10             	add    $0x10,%esp
+    4aaa:	e9 0d 01 00 00       	jmp    4bbc <printf+0x177>
+      }
+    } else if(state == '%'){
+    4aaf:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+    4ab3:	0f 85 03 01 00 00    	jne    4bbc <printf+0x177>
+      if(c == 'd'){
+    4ab9:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+    4abd:	75 1e                	jne    4add <printf+0x98>
+        printint(fd, *ap, 10, 1);
+    4abf:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    4ac2:	8b 00                	mov    (%eax),%eax
+    4ac4:	6a 01                	push   $0x1
+    4ac6:	6a 0a                	push   $0xa
+    4ac8:	50                   	push   %eax
+    4ac9:	ff 75 08             	push   0x8(%ebp)
+    4acc:	e8 c3 fe ff ff       	call   4994 <printint>
+    4ad1:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    4ad4:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    4ad8:	e9 d8 00 00 00       	jmp    4bb5 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+    4add:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+    4ae1:	74 06                	je     4ae9 <printf+0xa4>
+    4ae3:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+    4ae7:	75 1e                	jne    4b07 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+    4ae9:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    4aec:	8b 00                	mov    (%eax),%eax
+    4aee:	6a 00                	push   $0x0
+    4af0:	6a 10                	push   $0x10
+    4af2:	50                   	push   %eax
+    4af3:	ff 75 08             	push   0x8(%ebp)
+    4af6:	e8 99 fe ff ff       	call   4994 <printint>
+    4afb:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    4afe:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    4b02:	e9 ae 00 00 00       	jmp    4bb5 <printf+0x170>
+      } else if(c == 's'){
+    4b07:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+    4b0b:	75 43                	jne    4b50 <printf+0x10b>
+        s = (char*)*ap;
+    4b0d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    4b10:	8b 00                	mov    (%eax),%eax
+    4b12:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+    4b15:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+    4b19:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    4b1d:	75 25                	jne    4b44 <printf+0xff>
+          s = "(null)";
+    4b1f:	c7 45 f4 de 6a 00 00 	movl   $0x6ade,-0xc(%ebp)
+        while(*s != 0){
+    4b26:	eb 1c                	jmp    4b44 <printf+0xff>
+          putc(fd, *s);
+    4b28:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4b2b:	0f b6 00             	movzbl (%eax),%eax
+    4b2e:	0f be c0             	movsbl %al,%eax
+    4b31:	83 ec 08             	sub    $0x8,%esp
+    4b34:	50                   	push   %eax
+    4b35:	ff 75 08             	push   0x8(%ebp)
+    4b38:	e8 34 fe ff ff       	call   4971 <putc>
+    4b3d:	83 c4 10             	add    $0x10,%esp
+          s++;
+    4b40:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+    4b44:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4b47:	0f b6 00             	movzbl (%eax),%eax
+    4b4a:	84 c0                	test   %al,%al
+    4b4c:	75 da                	jne    4b28 <printf+0xe3>
+    4b4e:	eb 65                	jmp    4bb5 <printf+0x170>
+        }
+      } else if(c == 'c'){
+    4b50:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+    4b54:	75 1d                	jne    4b73 <printf+0x12e>
+        putc(fd, *ap);
+    4b56:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    4b59:	8b 00                	mov    (%eax),%eax
+    4b5b:	0f be c0             	movsbl %al,%eax
+    4b5e:	83 ec 08             	sub    $0x8,%esp
+    4b61:	50                   	push   %eax
+    4b62:	ff 75 08             	push   0x8(%ebp)
+    4b65:	e8 07 fe ff ff       	call   4971 <putc>
+    4b6a:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    4b6d:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    4b71:	eb 42                	jmp    4bb5 <printf+0x170>
+      } else if(c == '%'){
+    4b73:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+    4b77:	75 17                	jne    4b90 <printf+0x14b>
+        putc(fd, c);
+    4b79:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    4b7c:	0f be c0             	movsbl %al,%eax
+    4b7f:	83 ec 08             	sub    $0x8,%esp
+    4b82:	50                   	push   %eax
+    4b83:	ff 75 08             	push   0x8(%ebp)
+    4b86:	e8 e6 fd ff ff       	call   4971 <putc>
+    4b8b:	83 c4 10             	add    $0x10,%esp
+    4b8e:	eb 25                	jmp    4bb5 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+    4b90:	83 ec 08             	sub    $0x8,%esp
+    4b93:	6a 25                	push   $0x25
+    4b95:	ff 75 08             	push   0x8(%ebp)
+    4b98:	e8 d4 fd ff ff       	call   4971 <putc>
+    4b9d:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+    4ba0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    4ba3:	0f be c0             	movsbl %al,%eax
+    4ba6:	83 ec 08             	sub    $0x8,%esp
+    4ba9:	50                   	push   %eax
+    4baa:	ff 75 08             	push   0x8(%ebp)
+    4bad:	e8 bf fd ff ff       	call   4971 <putc>
+    4bb2:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+    4bb5:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+    4bbc:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    4bc0:	8b 55 0c             	mov    0xc(%ebp),%edx
+    4bc3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    4bc6:	01 d0                	add    %edx,%eax
+    4bc8:	0f b6 00             	movzbl (%eax),%eax
+    4bcb:	84 c0                	test   %al,%al
+    4bcd:	0f 85 94 fe ff ff    	jne    4a67 <printf+0x22>
+    }
+  }
+}
+    4bd3:	90                   	nop
+    4bd4:	90                   	nop
+    4bd5:	c9                   	leave
+    4bd6:	c3                   	ret
+
+00004bd7 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    4bd7:	55                   	push   %ebp
+    4bd8:	89 e5                	mov    %esp,%ebp
+    4bda:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    4bdd:	8b 45 08             	mov    0x8(%ebp),%eax
+    4be0:	83 e8 08             	sub    $0x8,%eax
+    4be3:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    4be6:	a1 68 c8 00 00       	mov    0xc868,%eax
+    4beb:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    4bee:	eb 24                	jmp    4c14 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    4bf0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    4bf3:	8b 00                	mov    (%eax),%eax
+    4bf5:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    4bf8:	72 12                	jb     4c0c <free+0x35>
+    4bfa:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    4bfd:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    4c00:	72 24                	jb     4c26 <free+0x4f>
+    4c02:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    4c05:	8b 00                	mov    (%eax),%eax
+    4c07:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+    4c0a:	72 1a                	jb     4c26 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    4c0c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    4c0f:	8b 00                	mov    (%eax),%eax
+    4c11:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    4c14:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    4c17:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    4c1a:	73 d4                	jae    4bf0 <free+0x19>
+    4c1c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    4c1f:	8b 00                	mov    (%eax),%eax
+    4c21:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+    4c24:	73 ca                	jae    4bf0 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    4c26:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    4c29:	8b 40 04             	mov    0x4(%eax),%eax
+    4c2c:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    4c33:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    4c36:	01 c2                	add    %eax,%edx
+    4c38:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    4c3b:	8b 00                	mov    (%eax),%eax
+    4c3d:	39 c2                	cmp    %eax,%edx
+    4c3f:	75 24                	jne    4c65 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+    4c41:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    4c44:	8b 50 04             	mov    0x4(%eax),%edx
+    4c47:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    4c4a:	8b 00                	mov    (%eax),%eax
+    4c4c:	8b 40 04             	mov    0x4(%eax),%eax
+    4c4f:	01 c2                	add    %eax,%edx
+    4c51:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    4c54:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    4c57:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    4c5a:	8b 00                	mov    (%eax),%eax
+    4c5c:	8b 10                	mov    (%eax),%edx
+    4c5e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    4c61:	89 10                	mov    %edx,(%eax)
+    4c63:	eb 0a                	jmp    4c6f <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+    4c65:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    4c68:	8b 10                	mov    (%eax),%edx
+    4c6a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    4c6d:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+    4c6f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    4c72:	8b 40 04             	mov    0x4(%eax),%eax
+    4c75:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    4c7c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    4c7f:	01 d0                	add    %edx,%eax
+    4c81:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+    4c84:	75 20                	jne    4ca6 <free+0xcf>
+    p->s.size += bp->s.size;
+    4c86:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    4c89:	8b 50 04             	mov    0x4(%eax),%edx
+    4c8c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    4c8f:	8b 40 04             	mov    0x4(%eax),%eax
+    4c92:	01 c2                	add    %eax,%edx
+    4c94:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    4c97:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+    4c9a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    4c9d:	8b 10                	mov    (%eax),%edx
+    4c9f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    4ca2:	89 10                	mov    %edx,(%eax)
+    4ca4:	eb 08                	jmp    4cae <free+0xd7>
+  } else
+    p->s.ptr = bp;
+    4ca6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    4ca9:	8b 55 f8             	mov    -0x8(%ebp),%edx
+    4cac:	89 10                	mov    %edx,(%eax)
+  freep = p;
+    4cae:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    4cb1:	a3 68 c8 00 00       	mov    %eax,0xc868
+}
+    4cb6:	90                   	nop
+    4cb7:	c9                   	leave
+    4cb8:	c3                   	ret
+
+00004cb9 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+    4cb9:	55                   	push   %ebp
+    4cba:	89 e5                	mov    %esp,%ebp
+    4cbc:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+    4cbf:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+    4cc6:	77 07                	ja     4ccf <morecore+0x16>
+    nu = 4096;
+    4cc8:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+    4ccf:	8b 45 08             	mov    0x8(%ebp),%eax
+    4cd2:	c1 e0 03             	shl    $0x3,%eax
+    4cd5:	83 ec 0c             	sub    $0xc,%esp
+    4cd8:	50                   	push   %eax
+    4cd9:	e8 4b fc ff ff       	call   4929 <sbrk>
+    4cde:	83 c4 10             	add    $0x10,%esp
+    4ce1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+    4ce4:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+    4ce8:	75 07                	jne    4cf1 <morecore+0x38>
+    return 0;
+    4cea:	b8 00 00 00 00       	mov    $0x0,%eax
+    4cef:	eb 26                	jmp    4d17 <morecore+0x5e>
+  hp = (Header*)p;
+    4cf1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4cf4:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+    4cf7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    4cfa:	8b 55 08             	mov    0x8(%ebp),%edx
+    4cfd:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+    4d00:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    4d03:	83 c0 08             	add    $0x8,%eax
+    4d06:	83 ec 0c             	sub    $0xc,%esp
+    4d09:	50                   	push   %eax
+    4d0a:	e8 c8 fe ff ff       	call   4bd7 <free>
+    4d0f:	83 c4 10             	add    $0x10,%esp
+  return freep;
+    4d12:	a1 68 c8 00 00       	mov    0xc868,%eax
+}
+    4d17:	c9                   	leave
+    4d18:	c3                   	ret
+
+00004d19 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    4d19:	55                   	push   %ebp
+    4d1a:	89 e5                	mov    %esp,%ebp
+    4d1c:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    4d1f:	8b 45 08             	mov    0x8(%ebp),%eax
+    4d22:	83 c0 07             	add    $0x7,%eax
+    4d25:	c1 e8 03             	shr    $0x3,%eax
+    4d28:	83 c0 01             	add    $0x1,%eax
+    4d2b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+    4d2e:	a1 68 c8 00 00       	mov    0xc868,%eax
+    4d33:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    4d36:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    4d3a:	75 23                	jne    4d5f <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+    4d3c:	c7 45 f0 60 c8 00 00 	movl   $0xc860,-0x10(%ebp)
+    4d43:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    4d46:	a3 68 c8 00 00       	mov    %eax,0xc868
+    4d4b:	a1 68 c8 00 00       	mov    0xc868,%eax
+    4d50:	a3 60 c8 00 00       	mov    %eax,0xc860
+    base.s.size = 0;
+    4d55:	c7 05 64 c8 00 00 00 	movl   $0x0,0xc864
+    4d5c:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    4d5f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    4d62:	8b 00                	mov    (%eax),%eax
+    4d64:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+    4d67:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4d6a:	8b 40 04             	mov    0x4(%eax),%eax
+    4d6d:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+    4d70:	72 4d                	jb     4dbf <malloc+0xa6>
+      if(p->s.size == nunits)
+    4d72:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4d75:	8b 40 04             	mov    0x4(%eax),%eax
+    4d78:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+    4d7b:	75 0c                	jne    4d89 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+    4d7d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4d80:	8b 10                	mov    (%eax),%edx
+    4d82:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    4d85:	89 10                	mov    %edx,(%eax)
+    4d87:	eb 26                	jmp    4daf <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+    4d89:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4d8c:	8b 40 04             	mov    0x4(%eax),%eax
+    4d8f:	2b 45 ec             	sub    -0x14(%ebp),%eax
+    4d92:	89 c2                	mov    %eax,%edx
+    4d94:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4d97:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+    4d9a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4d9d:	8b 40 04             	mov    0x4(%eax),%eax
+    4da0:	c1 e0 03             	shl    $0x3,%eax
+    4da3:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+    4da6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4da9:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    4dac:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+    4daf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    4db2:	a3 68 c8 00 00       	mov    %eax,0xc868
+      return (void*)(p + 1);
+    4db7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4dba:	83 c0 08             	add    $0x8,%eax
+    4dbd:	eb 3b                	jmp    4dfa <malloc+0xe1>
+    }
+    if(p == freep)
+    4dbf:	a1 68 c8 00 00       	mov    0xc868,%eax
+    4dc4:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    4dc7:	75 1e                	jne    4de7 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+    4dc9:	83 ec 0c             	sub    $0xc,%esp
+    4dcc:	ff 75 ec             	push   -0x14(%ebp)
+    4dcf:	e8 e5 fe ff ff       	call   4cb9 <morecore>
+    4dd4:	83 c4 10             	add    $0x10,%esp
+    4dd7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    4dda:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    4dde:	75 07                	jne    4de7 <malloc+0xce>
+        return 0;
+    4de0:	b8 00 00 00 00       	mov    $0x0,%eax
+    4de5:	eb 13                	jmp    4dfa <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    4de7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4dea:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    4ded:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4df0:	8b 00                	mov    (%eax),%eax
+    4df2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+    4df5:	e9 6d ff ff ff       	jmp    4d67 <malloc+0x4e>
+  }
+}
+    4dfa:	c9                   	leave
+    4dfb:	c3                   	ret
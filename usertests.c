@@ -6,6 +6,7 @@
 #include "syscall.h"
 #include "traps.h"
 #include "memlayout.h"
+#include "mman.h"
 
 char buf[8192];
 char name[3];
@@ -1412,6 +1413,200 @@ forktest(void)
   printf(1, "fork test OK\n");
 }
 
+char cowdata[100] = "data";
+
+// after fork, parent and child each see only their own writes
+// to pages they shared copy-on-write
+void
+cowtest(void)
+{
+  int fds[2], pid, ppid;
+  char *heap, stack[100], c;
+
+  printf(stdout, "cow test\n");
+  ppid = getpid();
+  heap = sbrk(4096);
+  heap[0] = 'h';
+  cowdata[0] = 'd';
+  stack[0] = 's';
+  if(pipe(fds) != 0){
+    printf(stdout, "pipe() failed\n");
+    exit();
+  }
+
+  // the parent writes after fork, the child must not see it
+  pid = fork();
+  if(pid < 0){
+    printf(stdout, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    if(read(fds[0], &c, 1) != 1){
+      printf(stdout, "cow test read pipe failed\n");
+      kill(ppid);
+      exit();
+    }
+    if(heap[0] != 'h' || cowdata[0] != 'd' || stack[0] != 's'){
+      printf(stdout, "cow test: child sees parent's writes\n");
+      kill(ppid);
+      exit();
+    }
+    // and the parent must not see the child's
+    heap[0] = 'c';
+    cowdata[0] = 'c';
+    stack[0] = 'c';
+    exit();
+  }
+  heap[0] = 'H';
+  cowdata[0] = 'D';
+  stack[0] = 'S';
+  write(fds[1], "x", 1);
+  wait();
+  if(heap[0] != 'H' || cowdata[0] != 'D' || stack[0] != 'S'){
+    printf(stdout, "cow test: parent sees child's writes\n");
+    exit();
+  }
+
+  // the kernel writing into copy-on-write pages (read into
+  // a dirty heap page and a dirty stack buffer)
+  pid = fork();
+  if(pid < 0){
+    printf(stdout, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    if(read(fds[0], heap, 5) != 5 || read(fds[0], stack, 5) != 5){
+      printf(stdout, "cow test: read into cow page failed\n");
+      kill(ppid);
+      exit();
+    }
+    if(heap[0] != '0' || heap[4] != '4' || stack[0] != '5' || stack[4] != '9'){
+      printf(stdout, "cow test: read into cow page wrong\n");
+      kill(ppid);
+      exit();
+    }
+    exit();
+  }
+  write(fds[1], "0123456789", 10);
+  wait();
+  if(heap[0] != 'H' || stack[0] != 'S'){
+    printf(stdout, "cow test: child's read reached the parent\n");
+    exit();
+  }
+
+  close(fds[0]);
+  close(fds[1]);
+  sbrk(-4096);
+  printf(stdout, "cow test ok\n");
+}
+
+// mmap(): shared and private file mappings, munmap(),
+// fork, and system calls on mapped memory
+void
+mmaptest(void)
+{
+  int fd, i, pid, ppid;
+  char *p, *q, c;
+
+  printf(stdout, "mmap test\n");
+  ppid = getpid();
+
+  for(i = 0; i < sizeof(buf); i++)
+    buf[i] = 'a' + i % 23;
+  fd = open("mmapfile", O_CREATE|O_RDWR);
+  if(fd < 0 || write(fd, buf, sizeof(buf)) != sizeof(buf)){
+    printf(stdout, "mmap test: cannot write mmapfile\n");
+    exit();
+  }
+  close(fd);
+
+  // a shared read-only mapping has the file's bytes
+  fd = open("mmapfile", O_RDONLY);
+  p = mmap(0, sizeof(buf), PROT_READ, MAP_SHARED, fd, 0);
+  if(p == MAP_FAILED){
+    printf(stdout, "mmap shared failed\n");
+    exit();
+  }
+  for(i = 0; i < sizeof(buf); i++){
+    if(p[i] != buf[i]){
+      printf(stdout, "mmap shared: wrong byte at %d\n", i);
+      exit();
+    }
+  }
+
+  // writes to a private mapping do not reach the file
+  q = mmap(0, sizeof(buf), PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, 0);
+  if(q == MAP_FAILED){
+    printf(stdout, "mmap private failed\n");
+    exit();
+  }
+  q[0] = 'X';
+  q[4097] = 'Y';
+  close(fd);
+  fd = open("mmapfile", O_RDONLY);
+  if(read(fd, &c, 1) != 1 || c != buf[0] || p[0] != buf[0] || p[4097] != buf[4097]){
+    printf(stdout, "mmap private: write reached the file\n");
+    exit();
+  }
+
+  // read() into a mapped buffer, and not into a read-only one
+  if(read(fd, q + 100, 200) != 200){
+    printf(stdout, "mmap: read into mapping failed\n");
+    exit();
+  }
+  for(i = 0; i < 200; i++){
+    if(q[100 + i] != buf[1 + i]){
+      printf(stdout, "mmap: read into mapping wrong\n");
+      exit();
+    }
+  }
+  if(read(fd, p, 10) >= 0){
+    printf(stdout, "mmap: read into read-only mapping succeeded\n");
+    exit();
+  }
+  close(fd);
+
+  // a forked child sees the parent's private pages
+  pid = fork();
+  if(pid < 0){
+    printf(stdout, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    if(q[0] != 'X' || q[4097] != 'Y' || q[100] != buf[1]){
+      printf(stdout, "mmap: child does not see private pages\n");
+      kill(ppid);
+    }
+    q[0] = 'Z';
+    exit();
+  }
+  wait();
+  if(q[0] != 'X'){
+    printf(stdout, "mmap: child's write reached the parent\n");
+    exit();
+  }
+
+  // touching a page after munmap() kills the process
+  if(munmap(p, sizeof(buf)) != 0 || munmap(q, sizeof(buf)) != 0){
+    printf(stdout, "munmap failed\n");
+    exit();
+  }
+  pid = fork();
+  if(pid < 0){
+    printf(stdout, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    c = p[0];
+    printf(stdout, "mmap: could read %x = %x after munmap\n", p, c);
+    kill(ppid);
+    exit();
+  }
+  wait();
+
+  printf(stdout, "mmap test ok\n");
+}
+
 void
 sbrktest(void)
 {
@@ -1769,6 +1964,7 @@ main(int argc, char *argv[])
   bigargtest();
   bsstest();
   sbrktest();
+  mmaptest();
   validatetest();
 
   opentest();
@@ -1794,6 +1990,7 @@ main(int argc, char *argv[])
   dirfile();
   iref();
   forktest();
+  cowtest();
   bigdir(); // slow
 
   uio();
@@ -1,6 +1,10 @@
 #include "vfs.h"
 #include "map.h"
 #include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "bcache.h"
 
 #define VFS_NORMAL 0
 #define VFS_SPECIAL 1
@@ -8,20 +12,22 @@
 #define VFS_DEV_BLOCK 0
 #define VFS_DEV_CHAR  1
 
-static map_t b_map, c_map, fs_map, root_map, s_map;
+#define VFS_NMNODE 32
+#define VFS_MNT_NAMELEN 32
 
-static int hash(const void* key)
-{
-    const char* equiv = key;
-    int h = 0;
+#define VFS_NDENTRY 128
+#define VFS_DNAMELEN 32
+#define VFS_DHASH 64
+#define VFS_NEGATIVE -1
 
-    // not a good hash, but it's ok
-    while(*equiv != '\0') {
-        h += *equiv;
-        equiv++;
-    }
+#define VFS_NPAGE 256
+#define VFS_PHASH 64
+
+static map_t b_map, c_map, fs_map, s_map;
 
-    return h;
+static int hash(const void* key)
+{
+    return map_strhash(key);
 }
 
 static int equal(const void* first, const void* second)
@@ -42,40 +48,338 @@ static int equal(const void* first, const void* second)
     return *ef == *es;
 }
 
-void vfs_init()
+struct fs_binding {
+    struct superblock* sb;
+    struct fs_ops* ops;
+    struct block_driver* drv;
+    int root; // inode number of the filesystem root
+
+    // the in-memory superblock has changes that are not on disk yet
+    int dirty;
+};
+
+// Mount table
+//
+// Mount points are kept in a trie of path components rooted at "/". A node
+// with a non-NULL bind has a filesystem mounted on it; the other nodes are
+// intermediate components of deeper mount points. Resolving a path walks the
+// trie one component at a time, so it only matches on component boundaries,
+// costs O(components) and never allocates.
+struct mnode {
+    char name[VFS_MNT_NAMELEN];
+    int len;
+
+    struct fs_binding* bind;
+
+    struct mnode* child;   // first child
+    struct mnode* sibling; // next child of the same parent
+};
+
+static struct {
+    struct spinlock lock;
+    struct mnode root;
+    struct mnode node[VFS_NMNODE];
+    int n_node;
+} mtable;
+
+// Length of the first component of path
+static int clen(const char* path)
 {
-    b_map = map_create();
-    c_map = map_create();
-    fs_map = map_create();
-    root_map = map_create();
-    s_map = map_create();
+    int len = 0;
+
+    while(path[len] != '/' && path[len] != '\0') {
+        len++;
+    }
+
+    return len;
 }
 
-void vfs_register_block(const char* name, struct block_driver* drv)
+static struct mnode* mchild(struct mnode* parent, const char* name, int len)
 {
-    map_put(b_map, name, drv, hash, equal);
+    struct mnode* n;
+
+    for(n = parent->child; n != 0; n = n->sibling) {
+        if(n->len == len && strncmp(n->name, name, len) == 0) {
+            return n;
+        }
+    }
+
+    return 0;
 }
 
-void vfs_register_char(const char* name, struct char_driver* drv)
+// Attach bind to the mount point path, creating trie nodes as needed
+static void mtable_insert(const char* path, struct fs_binding* bind)
 {
-    map_put(c_map, name, drv, hash, equal);
+    struct mnode* n = &mtable.root;
+
+    acquire(&mtable.lock);
+
+    while(1) {
+        while(*path == '/') {
+            path++;
+        }
+
+        if(*path == '\0') {
+            break;
+        }
+
+        int len = clen(path);
+        struct mnode* c = mchild(n, path, len);
+
+        if(c == 0) {
+            if(len >= VFS_MNT_NAMELEN) {
+                panic("mount path component too long\n");
+            }
+
+            if(mtable.n_node >= VFS_NMNODE) {
+                panic("too many mount points\n");
+            }
+
+            c = &mtable.node[mtable.n_node];
+            mtable.n_node++;
+
+            memmove(c->name, path, len);
+            c->name[len] = '\0';
+            c->len = len;
+
+            c->bind = 0;
+            c->child = 0;
+            c->sibling = n->child;
+            n->child = c;
+        }
+
+        n = c;
+        path += len;
+    }
+
+    n->bind = bind;
+    release(&mtable.lock);
 }
 
-void vfs_register_fs(const char* name, struct fs_ops* ops)
+// Find the filesystem with the longest mount point that is a prefix of path
+// (on component boundaries). *rel is set to the remainder of path, relative
+// to that mount point, which always refers into path itself.
+static struct fs_binding* mtable_lookup(const char* path, const char** rel)
 {
-    if(!ops) {
-        panic("NULL fs_ops!");
+    struct mnode* n = &mtable.root;
+    const char* p = path;
+
+    acquire(&mtable.lock);
+
+    struct fs_binding* best = n->bind;
+    const char* rest = path;
+
+    while(1) {
+        while(*p == '/') {
+            p++;
+        }
+
+        if(*p == '\0') {
+            break;
+        }
+
+        int len = clen(p);
+
+        if((n = mchild(n, p, len)) == 0) {
+            break;
+        }
+
+        p += len;
+
+        if(n->bind != 0) {
+            best = n->bind;
+            rest = p;
+        }
     }
 
-    map_put(fs_map, name, ops, hash, equal);
+    release(&mtable.lock);
+
+    // path is the mount point itself
+    if(*rest == '\0') {
+        rest = "/";
+    }
+
+    *rel = rest;
+    return best;
 }
 
-struct fs_binding {
-    struct superblock* sb;
-    struct fs_ops* ops;
-    struct block_driver* drv;
+// Directory entry cache
+//
+// Caches the result of looking up one path component in a directory,
+// keyed by (superblock, directory inode number, name). A negative entry
+// (ino == VFS_NEGATIVE) records that the name does not exist. Inode numbers
+// are used rather than inode pointers, so entries pin nothing in memory.
+struct dentry {
+    struct superblock* sb; // 0 if the slot is unused
+    int parent;
+    int ino;
+
+    char name[VFS_DNAMELEN];
+    int len;
+
+    uint lru;
+    struct dentry* hnext;
 };
 
+static struct {
+    struct spinlock lock;
+    struct dentry entry[VFS_NDENTRY];
+    struct dentry* hash[VFS_DHASH];
+    uint clock;
+} dcache;
+
+static int dhash(struct superblock* sb, int parent, const char* name, int len)
+{
+    uint h = (uint)sb ^ (parent * 31);
+
+    for(int i = 0; i < len; i++) {
+        h = h * 31 + name[i];
+    }
+
+    return h % VFS_DHASH;
+}
+
+// Caller must hold dcache.lock
+static struct dentry* dfind(struct superblock* sb, int parent, const char* name, int len)
+{
+    struct dentry* de;
+
+    for(de = dcache.hash[dhash(sb, parent, name, len)]; de != 0; de = de->hnext) {
+        if(de->sb == sb && de->parent == parent && de->len == len && strncmp(de->name, name, len) == 0) {
+            return de;
+        }
+    }
+
+    return 0;
+}
+
+// Look up name in the directory parent. Returns 1 on a hit (and sets *ino,
+// possibly to VFS_NEGATIVE), or 0 if the cache knows nothing about it.
+static int dcache_lookup(struct superblock* sb, int parent, const char* name, int len, int* ino)
+{
+    acquire(&dcache.lock);
+
+    struct dentry* de = dfind(sb, parent, name, len);
+
+    if(de != 0) {
+        dcache.clock++;
+        de->lru = dcache.clock;
+        *ino = de->ino;
+    }
+
+    release(&dcache.lock);
+    return de != 0;
+}
+
+// Remember that name in the directory parent is inode ino (or VFS_NEGATIVE).
+static void dcache_insert(struct superblock* sb, int parent, const char* name, int len, int ino)
+{
+    struct dentry* de;
+
+    // too long to cache -- always ask the filesystem
+    if(len >= VFS_DNAMELEN) {
+        return;
+    }
+
+    acquire(&dcache.lock);
+
+    if((de = dfind(sb, parent, name, len)) == 0) {
+        // recycle an unused or the least recently used entry
+        struct dentry* victim = dcache.entry;
+
+        for(de = dcache.entry; de < dcache.entry + VFS_NDENTRY; de++) {
+            if(de->sb == 0) {
+                victim = de;
+                break;
+            }
+
+            if(de->lru < victim->lru) {
+                victim = de;
+            }
+        }
+
+        de = victim;
+
+        if(de->sb != 0) {
+            struct dentry** pp = &dcache.hash[dhash(de->sb, de->parent, de->name, de->len)];
+
+            while(*pp != de) {
+                pp = &(*pp)->hnext;
+            }
+
+            *pp = de->hnext;
+        }
+
+        de->sb = sb;
+        de->parent = parent;
+        de->len = len;
+
+        memmove(de->name, name, len);
+        de->name[len] = '\0';
+
+        int h = dhash(sb, parent, name, len);
+        de->hnext = dcache.hash[h];
+        dcache.hash[h] = de;
+    }
+
+    dcache.clock++;
+    de->lru = dcache.clock;
+    de->ino = ino;
+
+    release(&dcache.lock);
+}
+
+static int vfs_ino(struct fs_ops* ops, struct inode* ip)
+{
+    struct stat st;
+    ops->stati(ip, &st);
+
+    return st.ino;
+}
+
+// Resolve rel, relative to the root of the filesystem in bind, one component
+// at a time. Each component is looked up in the dentry cache first, so only
+// misses go to the filesystem.
+static struct inode* vfs_walk(struct fs_binding* bind, const char* rel)
+{
+    struct fs_ops* ops = bind->ops;
+
+    int ino = bind->root;
+    struct inode* ip = ops->iget(ino, bind->sb, bind->drv);
+
+    while(ip != 0) {
+        while(*rel == '/') {
+            rel++;
+        }
+
+        if(*rel == '\0') {
+            break;
+        }
+
+        int len = clen(rel);
+        int cino;
+        struct inode* next;
+
+        if(dcache_lookup(bind->sb, ino, rel, len, &cino)) {
+            next = (cino == VFS_NEGATIVE) ? 0 : ops->iget(cino, bind->sb, bind->drv);
+        }
+        else {
+            next = ops->lookup(ip, rel, len);
+            cino = (next == 0) ? VFS_NEGATIVE : vfs_ino(ops, next);
+
+            dcache_insert(bind->sb, ino, rel, len, cino);
+        }
+
+        ops->iput(ip);
+
+        ip = next;
+        ino = cino;
+        rel += len;
+    }
+
+    return ip;
+}
+
 struct dev_binding {
     struct block_driver* bdrv;
     struct char_driver* cdrv;
@@ -84,128 +388,466 @@ struct dev_binding {
 
 struct vfs_inode {
     struct inode* ip;
+    int ino; // inode number of ip, the page cache key
+    struct fs_binding* bind;
     struct fs_ops* ops;
     struct block_driver* drv;
     struct superblock* sb;
     struct dev_binding* dev;
     int type;
+    int ref;
 };
 
-void vfs_mount_fs(const char* path, const char* dev, const char* fs)
+// In-memory cache of (normal) vfs inodes, so that every lookup of the same
+// file shares a single vfs_inode. A slot is free when its ref is 0.
+static struct {
+    struct spinlock lock;
+    struct vfs_inode inode[NINODE];
+} vcache;
+
+// Find the cached vfs inode for the fs inode ip, or claim a free slot for it.
+// Consumes the reference on ip that the caller got from the filesystem.
+static struct vfs_inode* vget(struct fs_binding* bind, struct inode* ip)
 {
-    struct fs_binding* bind = (void*)kalloc();
+    struct fs_ops* ops = bind->ops;
+    struct vfs_inode* vi;
+    struct vfs_inode* empty = 0;
 
-    bind->drv = map_get(b_map, dev, hash, equal);
+    if(ip == 0) {
+        return 0;
+    }
 
-    if(!bind->drv) {
-        // check if this is a special device path
-        struct vfs_inode* vi = map_get(s_map, dev, hash, equal);
+    acquire(&vcache.lock);
 
-        if(vi == 0) {
-             panic("cannot find device\n");
+    for(vi = vcache.inode; vi < vcache.inode + NINODE; vi++) {
+        if(vi->ref > 0 && vi->sb == bind->sb && vi->ip == ip) {
+            vi->ref++;
+            release(&vcache.lock);
+
+            // already holding a reference through the cached copy
+            ops->iput(ip);
+            return vi;
         }
 
-        bind->drv = vi->dev->bdrv;
+        if(empty == 0 && vi->ref == 0) {
+            empty = vi;
+        }
     }
 
-    bind->ops = map_get(fs_map, fs, hash, equal);
+    if(empty == 0) {
+        panic("vget: no inodes");
+    }
 
-    if(!bind->ops) {
-        panic("cannot find filesystem\n");
+    vi = empty;
+
+    vi->ip = ip;
+    vi->ino = vfs_ino(ops, ip);
+    vi->bind = bind;
+    vi->ops = ops;
+    vi->drv = bind->drv;
+    vi->sb = bind->sb;
+    vi->dev = 0;
+    vi->type = VFS_NORMAL;
+    vi->ref = 1;
+
+    release(&vcache.lock);
+    return vi;
+}
+
+struct vfs_inode* vfs_idup(struct vfs_inode* vi)
+{
+    if(vi == 0 || vi->type == VFS_SPECIAL) {
+        return vi;
     }
 
-    bind->sb = bind->ops->readsb(bind->drv);
+    acquire(&vcache.lock);
+    vi->ref++;
+    release(&vcache.lock);
 
-    if(!bind->sb) {
-        panic("cannot mount filesystem -- wrong type or corrupted\n");
+    return vi;
+}
+
+void vfs_iput(struct vfs_inode* vi)
+{
+    if(vi == 0 || vi->type == VFS_SPECIAL) {
+        return;
     }
 
-    map_put(root_map, path, bind, hash, equal);
+    acquire(&vcache.lock);
+
+    if(vi->ref < 1) {
+        panic("vfs_iput");
+    }
+
+    vi->ref--;
+
+    if(vi->ref > 0) {
+        release(&vcache.lock);
+        return;
+    }
+
+    // last reference -- give back the underlying fs inode
+    struct inode* ip = vi->ip;
+    struct fs_ops* ops = vi->ops;
+
+    vi->ip = 0;
+    release(&vcache.lock);
+
+    ops->iput(ip);
 }
 
-static const char* vfs_rpath(const char* path)
+// Page cache
+//
+// Caches file data a page at a time, keyed by (superblock, inode number,
+// page index), so it outlives the vfs inodes. Reads of normal files are
+// served from here, and only pages that are missing go to the filesystem
+// -- as one whole-page readi. Writes go through to the filesystem first
+// and then patch the cached pages they touch, so the cache never holds
+// data that is not in the filesystem as well.
+//
+// A page is busy while it is read in or patched; the cache lock is not
+// held across filesystem I/O. Pages are recycled least recently used first,
+// except for pages that are mapped into some process (see vfs_getpage).
+struct page {
+    struct superblock* sb; // 0 if the slot is unused
+    int ino;
+    uint index;
+    int busy;
+    int mapped; // number of user mappings of the page
+    int len;    // bytes of file data; the rest of the page is zero
+    char* data; // allocated on first use
+    uint lru;
+    struct page* hnext;
+};
+
+static struct {
+    struct spinlock lock;
+    struct page page[VFS_NPAGE];
+    struct page* hash[VFS_PHASH];
+    uint clock;
+} pcache;
+
+static int phash(struct superblock* sb, int ino, uint index)
 {
-    const char** keys = (void*)kalloc();
-    map_keys(root_map, (const void**)keys);
+    return ((uint)sb ^ (ino * 31) ^ (index * 17)) % VFS_PHASH;
+}
 
-    int* best = (void*)kalloc();
-    memset(best, 0, 4096);
+// Caller must hold pcache.lock
+static struct page* pfind(struct superblock* sb, int ino, uint index)
+{
+    struct page* pg;
 
-    int plen = strlen(path);
-    int klen = map_size(root_map);
+    for(pg = pcache.hash[phash(sb, ino, index)]; pg != 0; pg = pg->hnext) {
+        if(pg->sb == sb && pg->ino == ino && pg->index == index) {
+            return pg;
+        }
+    }
 
-    for(int i = 0; i < plen; i++) {
-        for(int j = 0; j < klen; j++) {
-            // how good does each key match the path?
-            if(best[j] == i && path[i] == keys[j][i]) {
-                best[j]++;
-            }
+    return 0;
+}
+
+// Caller must hold pcache.lock
+static void punhash(struct page* pg)
+{
+    struct page** pp = &pcache.hash[phash(pg->sb, pg->ino, pg->index)];
+
+    while(*pp != pg) {
+        pp = &(*pp)->hnext;
+    }
+
+    *pp = pg->hnext;
+    pg->sb = 0;
+}
+
+// Wait for the cached page index of vi and mark it busy. If create is set,
+// a missing page is read in; otherwise (or if the page cannot be cached)
+// returns 0.
+static struct page* pget(struct vfs_inode* vi, uint index, int create)
+{
+    struct page* pg;
+
+    acquire(&pcache.lock);
+
+loop:
+    if((pg = pfind(vi->sb, vi->ino, index)) != 0) {
+        if(pg->busy) {
+            sleep(pg, &pcache.lock);
+            goto loop;
         }
+
+        pg->busy = 1;
+        pcache.clock++;
+        pg->lru = pcache.clock;
+
+        release(&pcache.lock);
+        return pg;
     }
 
-    int max = best[0];
-    int pos = 0;
+    if(!create) {
+        release(&pcache.lock);
+        return 0;
+    }
 
-    for(int i = 1; i < klen; i++) {
-        if(best[i] > max) {
-            max = best[i];
-            pos = i;
+    // recycle an unused or the least recently used page
+    struct page* victim = 0;
+
+    for(pg = pcache.page; pg < pcache.page + VFS_NPAGE; pg++) {
+        if(pg->sb == 0) {
+            victim = pg;
+            break;
+        }
+
+        if(!pg->busy && pg->mapped == 0 && (victim == 0 || pg->lru < victim->lru)) {
+            victim = pg;
         }
     }
 
-    const char* rpath = keys[pos];
+    if(victim == 0 || (victim->data == 0 && (victim->data = kalloc()) == 0)) {
+        release(&pcache.lock);
+        return 0;
+    }
+
+    pg = victim;
+
+    if(pg->sb != 0) {
+        punhash(pg);
+    }
+
+    pg->sb = vi->sb;
+    pg->ino = vi->ino;
+    pg->index = index;
+    pg->busy = 1;
+    pg->len = 0;
+
+    int h = phash(pg->sb, pg->ino, index);
+    pg->hnext = pcache.hash[h];
+    pcache.hash[h] = pg;
+
+    pcache.clock++;
+    pg->lru = pcache.clock;
+
+    release(&pcache.lock);
+
+    // read it in -- everyone else waits for it to stop being busy
+    int n = vi->ops->readi(vi->ip, pg->data, index * PGSIZE, PGSIZE);
+
+    if(n < 0) {
+        acquire(&pcache.lock);
+
+        punhash(pg);
+        pg->busy = 0;
+        wakeup(pg);
+
+        release(&pcache.lock);
+        return 0;
+    }
+
+    memset(pg->data + n, 0, PGSIZE - n);
+    pg->len = n;
+
+    return pg;
+}
+
+static void pput(struct page* pg)
+{
+    acquire(&pcache.lock);
+
+    pg->busy = 0;
+    wakeup(pg);
+
+    release(&pcache.lock);
+}
+
+char* vfs_getpage(struct vfs_inode* vi, uint index)
+{
+    if(vi == 0 || vi->type == VFS_SPECIAL) {
+        return 0;
+    }
+
+    struct page* pg = pget(vi, index, 1);
+
+    if(pg == 0) {
+        return 0;
+    }
+
+    acquire(&pcache.lock);
+
+    pg->mapped++;
+    pg->busy = 0;
+    wakeup(pg);
+
+    release(&pcache.lock);
+    return pg->data;
+}
+
+void vfs_putpage(char* data)
+{
+    struct page* pg;
+
+    acquire(&pcache.lock);
+
+    for(pg = pcache.page; pg < pcache.page + VFS_NPAGE; pg++) {
+        if(pg->data == data) {
+            if(pg->mapped < 1) {
+                panic("vfs_putpage");
+            }
+
+            pg->mapped--;
+            release(&pcache.lock);
 
-    // cleanup the allocations
-    kfree((void*)best);
-    kfree((void*)keys);
+            return;
+        }
+    }
 
-    return rpath;
+    panic("vfs_putpage: not a cached page");
 }
 
-static char* vfs_rel(const char* path, const char* rpath)
+// Read from a normal file through the page cache
+static int pcache_read(struct vfs_inode* vi, char* dst, uint off, int size)
 {
     int pos = 0;
 
-    while(*rpath != '\0') {
-        if(*path != *rpath) {
+    while(pos < size) {
+        uint index = (off + pos) / PGSIZE;
+        int pgoff = (off + pos) % PGSIZE;
+        struct page* pg = pget(vi, index, 1);
+
+        // not cacheable -- let the filesystem handle the rest
+        if(pg == 0) {
+            int r = vi->ops->readi(vi->ip, dst + pos, off + pos, size - pos);
+
+            if(r < 0) {
+                return pos > 0 ? pos : -1;
+            }
+
+            return pos + r;
+        }
+
+        int n = pg->len - pgoff;
+        int full = pg->len == PGSIZE;
+
+        n = n < size - pos ? n : size - pos;
+
+        if(n > 0) {
+            memmove(dst + pos, pg->data + pgoff, n);
+            pos += n;
+        }
+
+        pput(pg);
+
+        // end of the file
+        if(n <= 0 || !full) {
             break;
         }
+    }
+
+    return pos;
+}
+
+// Bring the cached pages in line with a write of size bytes at off, which
+// the filesystem has already carried out. The file was oldsize bytes long
+// before; any gap up to off was filled with zeros, which the cached pages
+// hold already past their len.
+static void pcache_write(struct vfs_inode* vi, const char* src, uint off, int size, uint oldsize)
+{
+    uint end = off + size;
+    uint first = (off < oldsize ? off : oldsize) / PGSIZE;
+
+    for(uint index = first; index <= (end - 1) / PGSIZE; index++) {
+        struct page* pg = pget(vi, index, 0);
+
+        if(pg == 0) {
+            continue;
+        }
+
+        uint start = index * PGSIZE;
+        uint from = off > start ? off : start;
+        uint to = end < start + PGSIZE ? end : start + PGSIZE;
+
+        if(from < to) {
+            memmove(pg->data + (from - start), src + (from - off), to - from);
+        }
+
+        if((int)(to - start) > pg->len) {
+            pg->len = to - start;
+        }
 
-        pos++;
-        path++;
-        rpath++;
+        pput(pg);
     }
+}
 
-    // path and rpath are the same
-    if(*path == '\0') {
-        char* buffer = (void*)kalloc();
+void vfs_init()
+{
+    initlock(&vcache.lock, "vcache");
+    initlock(&mtable.lock, "mtable");
+    initlock(&dcache.lock, "dcache");
+    initlock(&pcache.lock, "pcache");
+
+    b_map = map_create();
+    c_map = map_create();
+    fs_map = map_create();
+    s_map = map_create();
+}
+
+void vfs_register_block(const char* name, struct block_driver* drv)
+{
+    map_put(b_map, name, drv, hash, equal);
+}
 
-        buffer[0] = '/';
-        buffer[1] = '\0';
+void vfs_register_char(const char* name, struct char_driver* drv)
+{
+    map_put(c_map, name, drv, hash, equal);
+}
 
-        return buffer;
+void vfs_register_fs(const char* name, struct fs_ops* ops)
+{
+    if(!ops) {
+        panic("NULL fs_ops!");
     }
 
-    int len = strlen(path);
-    char* buffer = (void*)kalloc();
+    map_put(fs_map, name, ops, hash, equal);
+}
 
-    if(path[0] != '/') {
-        buffer[0] = '/';
+void vfs_mount_fs(const char* path, const char* dev, const char* fs)
+{
+    struct fs_binding* bind = kmalloc(sizeof(struct fs_binding));
+
+    bind->dirty = 0;
+    bind->drv = map_get(b_map, dev, hash, equal);
+
+    if(!bind->drv) {
+        // check if this is a special device path
+        struct vfs_inode* vi = map_get(s_map, dev, hash, equal);
 
-        for(int i = 0; i < len; i++) {
-            buffer[i + 1] = path[i];
+        if(vi == 0) {
+             panic("cannot find device\n");
         }
+
+        bind->drv = vi->dev->bdrv;
     }
-    else {
-        for(int i = 0; i < len; i++) {
-            buffer[i] = path[i];
-        }
 
-        buffer[len] = '\0';
+    bind->ops = map_get(fs_map, fs, hash, equal);
+
+    if(!bind->ops) {
+        panic("cannot find filesystem\n");
     }
 
-    buffer[len + 1] = '\0';
-    return buffer;
+    bind->sb = bind->ops->readsb(bind->drv);
+
+    if(!bind->sb) {
+        panic("cannot mount filesystem -- wrong type or corrupted\n");
+    }
+
+    struct inode* root = bind->ops->namei("/", bind->sb, bind->drv);
+
+    if(!root) {
+        panic("cannot find filesystem root\n");
+    }
+
+    bind->root = vfs_ino(bind->ops, root);
+    bind->ops->iput(root);
+
+    mtable_insert(path, bind);
 }
 
 struct vfs_inode* vfs_namei(const char* path)
@@ -217,9 +859,9 @@ struct vfs_inode* vfs_namei(const char* path)
         return dev;
     }
 
-    // Longest prefix matching path
-    const char* rpath = vfs_rpath(path);
-    struct fs_binding* bind = map_get(root_map, rpath, hash, equal);
+    // Longest mount point matching path
+    const char* rel;
+    struct fs_binding* bind = mtable_lookup(path, &rel);
 
     // bad path -- couldn't find a match in the VFS table
     // return a NULL inode, which should raise a trap/fault somewhere
@@ -227,27 +869,10 @@ struct vfs_inode* vfs_namei(const char* path)
         return 0;
     }
 
-    // compute the relative path for the filesystem
-    char* rel = vfs_rel(path, rpath);
-    struct vfs_inode* vi = (void*)kalloc();
-
-    vi->drv = bind->drv;
-    vi->ops = bind->ops;
-    vi->sb = bind->sb;
-    vi->type = VFS_NORMAL;
-
     // get underlying inode
-    vi->ip = bind->ops->namei(rel, vi->sb, vi->drv);
-
-    if(vi->ip == 0) {
-        kfree((void*)vi);
-        kfree(rel);
+    struct inode* ip = vfs_walk(bind, rel);
 
-        return 0;
-    }
-
-    kfree(rel);
-    return vi;
+    return vget(bind, ip);
 }
 
 struct vfs_inode* vfs_createi(const char* path, int type)
@@ -259,9 +884,9 @@ struct vfs_inode* vfs_createi(const char* path, int type)
         return dev;
     }
 
-    // Longest prefix matching path
-    const char* rpath = vfs_rpath(path);
-    struct fs_binding* bind = map_get(root_map, rpath, hash, equal);
+    // Longest mount point matching path
+    const char* rel;
+    struct fs_binding* bind = mtable_lookup(path, &rel);
 
     // bad path -- couldn't find a match in the VFS table
     // return a NULL inode, which should raise a trap/fault somewhere
@@ -269,30 +894,28 @@ struct vfs_inode* vfs_createi(const char* path, int type)
         return 0;
     }
 
-    // compute the relative path for the filesystem
-    char* rel = vfs_rel(path, rpath);
-    struct vfs_inode* vi = (void*)kalloc();
-
-    vi->drv = bind->drv;
-    vi->ops = bind->ops;
-    vi->sb = bind->sb;
-    vi->type = VFS_NORMAL;
-
     // get underlying inode
-    vi->ip = bind->ops->createi(rel, type, vi->sb, vi->drv);
-
-    if(vi->ip == 0) {
-        kfree((void*)vi);
-        kfree(rel);
+    struct inode* ip = bind->ops->createi(rel, type, bind->sb, bind->drv);
 
+    if(ip == 0) {
         return 0;
     }
 
-    kfree(rel);
+    // replace any (negative) dentry for the new name
+    struct inode* pip = bind->ops->parenti(ip);
+    int len = strlen(rel);
+    int pos = len;
 
-    // update superblock
-    bind->ops->writesb(vi->sb, bind->drv);
-    return vi;
+    while(pos > 0 && rel[pos - 1] != '/') {
+        pos--;
+    }
+
+    dcache_insert(bind->sb, vfs_ino(bind->ops, pip), rel + pos, len - pos, vfs_ino(bind->ops, ip));
+    bind->ops->iput(pip);
+
+    // the superblock is written back lazily (see vfs_sync)
+    bind->dirty = 1;
+    return vget(bind, ip);
 }
 
 int vfs_readi(struct vfs_inode* vi, char* dst, int off, int size)
@@ -305,33 +928,28 @@ int vfs_readi(struct vfs_inode* vi, char* dst, int off, int size)
             return dev->cdrv->read(dst, size);
         }
         else if(dev->type == VFS_DEV_BLOCK) {
-            // convert (off,size) -> block number translation
-            int start = off / VFS_BLOCK_SIZE;
-            int diff = off - start * VFS_BLOCK_SIZE;
-
-            // handle partial first block
+            struct block_driver* drv = dev->bdrv;
+            int nblocks = drv->info.b_end - drv->info.b_start;
             int pos = 0;
 
-            if(diff != 0) {
+            // convert (off,size) -> block number translation, one block at a time
+            while(pos < size) {
                 char block[VFS_BLOCK_SIZE];
-                vi->drv->bread(vi->drv, block, start);
-
-                memmove(dst, block + diff, VFS_BLOCK_SIZE - diff);
+                int b_num = (off + pos) / VFS_BLOCK_SIZE;
+                int diff = (off + pos) % VFS_BLOCK_SIZE;
+                int n = VFS_BLOCK_SIZE - diff < size - pos ? VFS_BLOCK_SIZE - diff : size - pos;
 
-                size -= VFS_BLOCK_SIZE - diff;
-                pos += VFS_BLOCK_SIZE - diff;
-                start++;
-            }
-
-            while(size > 0) {
-                char block[VFS_BLOCK_SIZE];
-                diff = size > VFS_BLOCK_SIZE ? VFS_BLOCK_SIZE : size;
+                // end of the partition
+                if(b_num >= nblocks) {
+                    break;
+                }
 
-                memmove(dst + pos, block, diff);
+                if(drv->bread(drv, block, b_num) < 0) {
+                    return pos > 0 ? pos : -1;
+                }
 
-                size -= diff;
-                pos += diff;
-                start++;
+                memmove(dst + pos, block + diff, n);
+                pos += n;
             }
 
             return pos;
@@ -342,8 +960,38 @@ int vfs_readi(struct vfs_inode* vi, char* dst, int off, int size)
         }
     }
 
-    // call the underlying fs readi() routine
-    return vi->ops->readi(vi->ip, dst, off, size);
+    if(off < 0 || size <= 0) {
+        return vi->ops->readi(vi->ip, dst, off, size);
+    }
+
+    // served from the page cache, which calls the fs readi() routine on misses
+    return pcache_read(vi, dst, off, size);
+}
+
+void vfs_readahead(struct vfs_inode* vi, int off, int size)
+{
+    if(vi == 0 || off < 0 || size <= 0) {
+        return;
+    }
+
+    if(vi->type == VFS_SPECIAL) {
+        struct dev_binding* dev = vi->dev;
+
+        // only block devices have anything to read ahead
+        if(dev->type != VFS_DEV_BLOCK || dev->bdrv->breadahead == 0) {
+            return;
+        }
+
+        int start = off / VFS_BLOCK_SIZE;
+        int end = (off + size + VFS_BLOCK_SIZE - 1) / VFS_BLOCK_SIZE;
+
+        dev->bdrv->breadahead(dev->bdrv, start, end - start);
+        return;
+    }
+
+    if(vi->ops->readahead != 0) {
+        vi->ops->readahead(vi->ip, off, size);
+    }
 }
 
 int vfs_writei(struct vfs_inode* vi, char* src, int off, int size)
@@ -365,14 +1013,74 @@ int vfs_writei(struct vfs_inode* vi, char* src, int off, int size)
         }
     }
 
+    struct stat st;
+    vi->ops->stati(vi->ip, &st);
+
     // call the underlying fs writei() routine
-    // writei() may have modified the in-memory superblock -- so writesb() back to disk
+    // writei() may have modified the in-memory superblock -- it goes back to disk on the next sync
     int res = vi->ops->writei(vi->ip, vi->sb, src, off, size);
-    vi->ops->writesb(vi->sb, vi->drv);
+    vi->bind->dirty = 1;
+
+    if(res > 0) {
+        pcache_write(vi, src, off, res, st.size);
+    }
 
     return res;
 }
 
+// Write back the superblock (if it changed) and all dirty cached blocks of
+// a mounted filesystem
+static void vfs_flush(struct fs_binding* bind)
+{
+    // clear first: changes made while writesb() runs mark it dirty again
+    if(bind->dirty) {
+        bind->dirty = 0;
+        bind->ops->writesb(bind->sb, bind->drv);
+    }
+
+    bcache_flush(bind->drv);
+}
+
+void vfs_sync()
+{
+    struct fs_binding* binds[VFS_NMNODE + 1];
+    int n = 0;
+
+    // collect the mounted filesystems -- flushing sleeps, so not under the lock
+    acquire(&mtable.lock);
+
+    if(mtable.root.bind != 0) {
+        binds[n++] = mtable.root.bind;
+    }
+
+    for(int i = 0; i < mtable.n_node; i++) {
+        if(mtable.node[i].bind != 0) {
+            binds[n++] = mtable.node[i].bind;
+        }
+    }
+
+    release(&mtable.lock);
+
+    for(int i = 0; i < n; i++) {
+        vfs_flush(binds[i]);
+    }
+}
+
+int vfs_fsync(struct vfs_inode* vi)
+{
+    if(vi == 0) {
+        return -1;
+    }
+
+    // nothing is cached for special devices
+    if(vi->type == VFS_SPECIAL) {
+        return 0;
+    }
+
+    vfs_flush(vi->bind);
+    return 0;
+}
+
 void vfs_stati(struct vfs_inode* vi, struct stat* st)
 {
     if(vi->type == VFS_SPECIAL) {
@@ -400,13 +1108,8 @@ struct vfs_inode* vfs_childi(struct vfs_inode* vi, int child)
         return 0;
     }
 
-    // build new vfs inode for the child
-    struct vfs_inode* vci = (void*)kalloc();
-
-    memmove(vci, vi, sizeof(*vi));
-    vci->ip = ip;
-
-    return vci;
+    // find (or build) the vfs inode for the child
+    return vget(vi->bind, ip);
 }
 
 const char* vfs_iname(struct vfs_inode* vi, int full)
@@ -431,12 +1134,8 @@ struct vfs_inode* vfs_parenti(struct vfs_inode* vi)
         return vfs_namei("/");
     }
 
-    // create vfs inode for parent
-    struct vfs_inode* vpi = (void*)kalloc();
-    memmove(vpi, vi, sizeof(*vpi));
-
-    vpi->ip = vpi->ops->parenti(vi->ip);
-    return vpi;
+    // find (or build) the vfs inode for the parent
+    return vget(vi->bind, vi->ops->parenti(vi->ip));
 }
 
 void vfs_mount_char(const char* path, const char* dev)
@@ -447,7 +1146,8 @@ void vfs_mount_char(const char* path, const char* dev)
         panic("unknown character device\n");
     }
 
-    struct vfs_inode* vi = (void*)kalloc();
+    // the device binding lives right behind the inode
+    struct vfs_inode* vi = kmalloc(sizeof(struct vfs_inode) + sizeof(struct dev_binding));
     memset(vi, 0, sizeof(*vi));
 
     vi->type = VFS_SPECIAL;
@@ -468,7 +1168,8 @@ void vfs_mount_block(const char* path, const char* dev)
         panic("unknown block device\n");
     }
 
-    struct vfs_inode* vi = (void*)kalloc();
+    // the device binding lives right behind the inode
+    struct vfs_inode* vi = kmalloc(sizeof(struct vfs_inode) + sizeof(struct dev_binding));
     memset(vi, 0, sizeof(*vi));
 
     vi->type = VFS_SPECIAL;
@@ -35,7 +35,9 @@ struct partition {
  * need to conform to, so that they can be used by higher levels of the filesystem stack
  * 
  * Specifically, two operations need to be supported: bread and bwrite, which allow for a
- * block to be read from and written to the underlying device, respectively.
+ * block to be read from and written to the underlying device, respectively. breadv and bwritev
+ * do the same for a run of consecutive blocks, which drivers can turn into fewer, larger
+ * transfers.
  */
 struct block_driver {
 
@@ -81,6 +83,63 @@ struct block_driver {
      * @return number of bytes written (-1 on failure)
      */ 
     int (*bwrite)(struct block_driver* self, void* buffer, int b_num);
+
+    /**
+     * Read a run of consecutive blocks from the block device
+     *
+     * Each block gets its own buffer, so the destination does not have to be contiguous.
+     *
+     * @param self - pointer to the containing structure
+     * @param buffers - destination buffers, buffers[i] receives block b_num + i
+     * @param b_num - first block to read
+     * @param count - number of blocks to read
+     *
+     * @return number of bytes read (-1 on failure)
+     */
+    int (*breadv)(struct block_driver* self, void** buffers, int b_num, int count);
+
+    /**
+     * Write a run of consecutive blocks to the block device
+     *
+     * @param self - pointer to the containing structure
+     * @param buffers - source buffers, buffers[i] is written to block b_num + i
+     * @param b_num - first block to write
+     * @param count - number of blocks to write
+     *
+     * @return number of bytes written (-1 on failure)
+     */
+    int (*bwritev)(struct block_driver* self, void** buffers, int b_num, int count);
+
+    /**
+     * Start reading a run of consecutive blocks, without waiting for the data (optional)
+     *
+     * done is called once the blocks have been read -- possibly from an interrupt handler,
+     * so it must not sleep. The buffers (and the buffers array itself) must stay valid
+     * until then.
+     *
+     * @param self - pointer to the containing structure
+     * @param buffers - destination buffers, buffers[i] receives block b_num + i
+     * @param b_num - first block to read
+     * @param count - number of blocks to read
+     * @param done - completion callback, error is non-zero if the read failed
+     * @param arg - passed to done
+     *
+     * @return 0 if the read was started (-1 on failure, in which case done is never called)
+     */
+    int (*breadv_async)(struct block_driver* self, void** buffers, int b_num, int count,
+                        void (*done)(void* arg, int error), void* arg);
+
+    /**
+     * Hint that a run of blocks is about to be read (optional)
+     *
+     * Caching drivers can start reading the blocks in the background, so that a later bread
+     * finds them in memory. This never waits for I/O, and may ignore the hint entirely.
+     *
+     * @param self - pointer to the containing structure
+     * @param b_num - first block of the run
+     * @param count - number of blocks in the run
+     */
+    void (*breadahead)(struct block_driver* self, int b_num, int count);
 };
 
 /**
@@ -187,6 +246,9 @@ struct vfs_inode;
  * However, it is up to the underlying filesystem to make it functional or a no-op, if it is not
  * used or supported.
  *
+ * Paths passed to namei and createi are relative to the mount point: "/" refers to the root of
+ * the filesystem, and the leading '/' is optional.
+ *
  */
 struct fs_ops {
     struct superblock* (*readsb)(struct block_driver*);
@@ -198,10 +260,46 @@ struct fs_ops {
     int (*writei)(struct inode*, struct superblock* sb, const char* src, int off, int size);
     int (*readi)(struct inode*, char* dst, int off, int size);
 
+    /**
+     * Hint that a byte range of a file is about to be read (optional)
+     *
+     * Starts bringing the blocks of the range into the block cache, without waiting for
+     * them. Parts of the range past the end of the file are ignored.
+     */
+    void (*readahead)(struct inode*, int off, int size);
+
     void (*stati)(struct inode*, struct stat*);
     struct inode* (*childi)(struct inode*, int);
     const char* (*iname)(struct inode*, int full);
     struct inode* (*parenti)(struct inode*);
+
+    /**
+     * Drop a reference to an inode
+     *
+     * Every inode returned by namei, createi, childi and parenti carries a reference,
+     * which the VFS gives back with iput once it no longer needs the inode.
+     */
+    void (*iput)(struct inode*);
+
+    /**
+     * Look up a single name in a directory
+     *
+     * @param dp - directory to search
+     * @param name - name to look for (not necessarily NUL-terminated)
+     * @param len - length of name
+     *
+     * @return the (referenced) inode of the entry, or 0 if there is no such entry
+     */
+    struct inode* (*lookup)(struct inode* dp, const char* name, int len);
+
+    /**
+     * Get an inode by its inode number
+     *
+     * The inode number is the one reported by stati in st->ino.
+     *
+     * @return the (referenced) inode
+     */
+    struct inode* (*iget)(int inum, struct superblock*, struct block_driver*);
 };
 
 void vfs_register_fs(const char* name, struct fs_ops* ops);
@@ -216,8 +314,82 @@ struct vfs_inode* vfs_createi(const char* path, int type);
 int vfs_writei(struct vfs_inode* vi, char* src, int off, int size);
 int vfs_readi(struct vfs_inode* vi, char* dst, int off, int size);
 
+/**
+ * Pin a page of file data in the page cache
+ *
+ * Reads the page in if needed. The page stays cached (and at the same address) until it
+ * is released with vfs_putpage, so it can be mapped into user space. Writes to the file
+ * keep updating it; bytes past the end of the file read as zero.
+ *
+ * @param vi - file to get the page of
+ * @param index - page number within the file (file offset / PGSIZE)
+ * @return the (kernel) address of the page, or 0 if it cannot be cached
+ */
+char* vfs_getpage(struct vfs_inode* vi, uint index);
+
+/**
+ * Release a page pinned by vfs_getpage
+ *
+ * @param data - address returned by vfs_getpage
+ */
+void vfs_putpage(char* data);
+
+/**
+ * Start reading a byte range of a file (or block device) in the background
+ *
+ * Only a hint: nothing waits for the I/O, and filesystems or drivers without read-ahead
+ * support ignore it.
+ *
+ * @param vi - inode to read from
+ * @param off - start of the range
+ * @param size - length of the range
+ */
+void vfs_readahead(struct vfs_inode* vi, int off, int size);
+
+/**
+ * Write all pending filesystem changes back to disk
+ *
+ * Filesystem writes only update in-memory state: the superblocks of the mounted
+ * filesystems and the block cache. vfs_sync writes back every superblock that
+ * changed since the last sync, followed by the dirty cached blocks.
+ */
+void vfs_sync();
+
+/**
+ * Write the pending changes of the filesystem that holds vi back to disk
+ *
+ * Same as vfs_sync, but limited to a single filesystem.
+ *
+ * @param vi - any inode of the filesystem
+ * @return 0 on success, -1 on failure
+ */
+int vfs_fsync(struct vfs_inode* vi);
+
 void vfs_stati(struct vfs_inode* vi, struct stat* st);
 struct vfs_inode* vfs_childi(struct vfs_inode* vi, int child);
 const char* vfs_iname(struct vfs_inode* vi, int full);
 
 struct vfs_inode* vfs_parenti(struct vfs_inode* vi);
+
+/**
+ * Increment the reference count of a vfs inode
+ *
+ * vfs inodes are cached and shared: looking up the same file twice returns the
+ * same vfs_inode, with one reference per lookup. Every reference has to be dropped
+ * with vfs_iput once it is no longer needed.
+ *
+ * @param vi - inode to duplicate
+ * @return vi, for convenience
+ */
+struct vfs_inode* vfs_idup(struct vfs_inode* vi);
+
+/**
+ * Drop a reference to a vfs inode
+ *
+ * When the last reference is dropped, the cache slot (and the underlying filesystem
+ * inode reference) is released. Special device inodes live forever and are not
+ * affected.
+ *
+ * @param vi - inode to release
+ */
+void vfs_iput(struct vfs_inode* vi);
@@ -6,6 +6,7 @@
 #include "mmu.h"
 #include "proc.h"
 #include "elf.h"
+#include "mman.h"
 
 extern char data[];  // defined by kernel.ld
 pde_t *kpgdir;  // for use in scheduler()
@@ -192,31 +193,6 @@ inituvm(pde_t *pgdir, char *init, uint sz)
   memmove(mem, init, sz);
 }
 
-// Load a program segment into pgdir.  addr must be page-aligned
-// and the pages from addr to addr+sz must already be mapped.
-int
-loaduvm(pde_t *pgdir, char *addr, struct vfs_inode *ip, uint offset, uint sz)
-{
-  uint i, pa, n;
-  pte_t *pte;
-
-  if((uint) addr % PGSIZE != 0)
-    panic("loaduvm: addr must be page aligned");
-  for(i = 0; i < sz; i += PGSIZE){
-    if((pte = walkpgdir(pgdir, addr+i, 0)) == 0)
-      panic("loaduvm: address should exist");
-    pa = PTE_ADDR(*pte);
-    if(sz - i < PGSIZE)
-      n = sz - i;
-    else
-      n = PGSIZE;
-
-    if(vfs_readi(ip, P2V(pa), offset+i, n) != n)
-      return -1;
-  }
-  return 0;
-}
-
 // Allocate page tables and physical memory to grow process from oldsz to
 // newsz, which need not be page aligned.  Returns new size or 0 on error.
 int
@@ -272,7 +248,10 @@ deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
       if(pa == 0)
         panic("kfree");
       char *v = P2V(pa);
-      kfree(v);
+      if(*pte & PTE_PCACHE)
+        vfs_putpage(v);
+      else
+        kfree(v);
       *pte = 0;
     }
   }
@@ -312,37 +291,116 @@ clearpteu(pde_t *pgdir, char *uva)
 }
 
 // Given a parent process's page table, create a copy
-// of it for a child.
+// of it for a child. The pages themselves are shared;
+// writable ones become copy-on-write in both tables.
+// Pages of the program that are not faulted in yet, or
+// come from the page cache, are left for the child to
+// fault in (see exec). pgdir must be the current page table.
 pde_t*
 copyuvm(pde_t *pgdir, uint sz)
 {
   pde_t *d;
   pte_t *pte;
   uint pa, i, flags;
-  char *mem;
 
   if((d = setupkvm()) == 0)
     return 0;
   for(i = 0; i < sz; i += PGSIZE){
     if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0)
-      panic("copyuvm: pte should exist");
-    if(!(*pte & PTE_P))
-      panic("copyuvm: page not present");
+      continue;
+    if(!(*pte & PTE_P) || (*pte & PTE_PCACHE))
+      continue;
+    if(*pte & PTE_W)
+      *pte = (*pte & ~PTE_W) | PTE_COW;
     pa = PTE_ADDR(*pte);
     flags = PTE_FLAGS(*pte);
-    if((mem = kalloc()) == 0)
-      goto bad;
-    memmove(mem, (char*)P2V(pa), PGSIZE);
-    if(mappages(d, (void*)i, PGSIZE, V2P(mem), flags) < 0)
+    if(mappages(d, (void*)i, PGSIZE, pa, flags) < 0)
       goto bad;
+    kdup(P2V(pa));
   }
+  lcr3(V2P(pgdir));
   return d;
 
 bad:
+  lcr3(V2P(pgdir));
   freevm(d);
   return 0;
 }
 
+// Make the copy-on-write page at *pte writable again, copying
+// it first if another page table still shares it.
+// Returns 0, or -1 if out of memory.
+static int
+cowpage(pte_t *pte)
+{
+  char *mem, *old;
+
+  old = P2V(PTE_ADDR(*pte));
+  if(krefs(old) == 1){
+    *pte = (*pte & ~PTE_COW) | PTE_W;
+    return 0;
+  }
+  if((mem = kalloc()) == 0)
+    return -1;
+  memmove(mem, old, PGSIZE);
+  *pte = V2P(mem) | (PTE_FLAGS(*pte) & ~PTE_COW) | PTE_W;
+  kfree(old);
+  return 0;
+}
+
+// Handle a page fault at user address va of p, which must be
+// the current process: an access to the program image or a
+// memory-mapped file, the first access to a heap page that
+// sbrk() reserved, or a write to a copy-on-write page.
+// Returns 0 if the access can be retried, -1 if it is not allowed.
+int
+uvmfault(struct proc *p, uint va, int write)
+{
+  pte_t *pte;
+  char *mem;
+
+  if(vmalookup(p, va) != 0)
+    return vmafault(p, va, write);
+  if(va >= p->sz || (pte = walkpgdir(p->pgdir, (char*)va, 1)) == 0)
+    return -1;
+  if(!(*pte & PTE_P)){
+    if((mem = kalloc()) == 0)
+      return -1;
+    memset(mem, 0, PGSIZE);
+    *pte = V2P(mem) | PTE_P | PTE_W | PTE_U;
+    // the page growproc() reserved for it is in use now
+    if(p->nlazy > 0){
+      p->nlazy--;
+      kunreserve(1);
+    }
+    return 0;
+  }
+  if(!write || (*pte & (PTE_U|PTE_COW)) != (PTE_U|PTE_COW))
+    return -1;
+  if(cowpage(pte) < 0)
+    return -1;
+  lcr3(V2P(p->pgdir));
+  return 0;
+}
+
+// Count the pages in [PGROUNDUP(start), end) that are not
+// present in pgdir.
+int
+uvmabsent(pde_t *pgdir, uint start, uint end)
+{
+  pte_t *pte;
+  uint a;
+  int n;
+
+  n = 0;
+  for(a = PGROUNDUP(start); a < end; a += PGSIZE){
+    pte = walkpgdir(pgdir, (char*)a, 0);
+    if(pte == 0 || !(*pte & PTE_P))
+      n++;
+  }
+  return n;
+}
+
 //PAGEBREAK!
 // Map user virtual address to kernel address.
 char*
@@ -351,7 +409,7 @@ uva2ka(pde_t *pgdir, char *uva)
   pte_t *pte;
 
   pte = walkpgdir(pgdir, uva, 0);
-  if((*pte & PTE_P) == 0)
+  if(pte == 0 || (*pte & PTE_P) == 0)
     return 0;
   if((*pte & PTE_U) == 0)
     return 0;
@@ -384,6 +442,311 @@ copyout(pde_t *pgdir, uint va, void *p, uint len)
   return 0;
 }
 
+//PAGEBREAK!
+// Memory-mapped files.
+//
+// mmap() regions live above MMAPBASE, out of the way of [0, sz), and are
+// described by the process's vma array. Their pages are faulted in on
+// first touch. Shared mappings, and pages of private mappings that have
+// not been written to, map the page cache's copy of the file data
+// read-only (marked PTE_PCACHE, and pinned in the cache until unmapped).
+// The first write to a page of a private mapping gives it its own copy.
+//
+// exec() maps the loadable segments of a program as private mappings
+// too, inside [0, sz), so it is only read in as it is used. Pages of its
+// read-only segments stay page cache pages, shared by all processes that
+// run the program, and are reclaimed with the cache once none maps them.
+
+// Find the mapping of p that contains va.
+struct vma*
+vmalookup(struct proc *p, uint va)
+{
+  struct vma *v;
+
+  for(v = p->vma; v < p->vma + NVMA; v++)
+    if(v->ip && va >= v->start && va < v->end)
+      return v;
+  return 0;
+}
+
+// Map length bytes of ip, starting at file offset off (page aligned),
+// into the first gap above MMAPBASE that is large enough.
+// Returns the address of the mapping, or -1.
+int
+vmamap(struct proc *p, struct vfs_inode *ip, uint off, uint length, int prot, int flags)
+{
+  struct vma *v, *slot;
+  uint start;
+
+  length = PGROUNDUP(length);
+  start = MMAPBASE;
+  slot = 0;
+
+again:
+  for(v = p->vma; v < p->vma + NVMA; v++){
+    if(v->ip == 0){
+      if(slot == 0)
+        slot = v;
+      continue;
+    }
+    if(start < v->end && v->start < start + length){
+      start = v->end;
+      goto again;
+    }
+  }
+
+  if(slot == 0 || length == 0 || start + length > KERNBASE || start + length < start)
+    return -1;
+
+  slot->start = start;
+  slot->end = start + length;
+  slot->off = off;
+  slot->filesz = length;
+  slot->prot = prot;
+  slot->flags = flags;
+  slot->ip = vfs_idup(ip);
+  return start;
+}
+
+// Remove the pages of [start, end) from pgdir. Private copies are freed,
+// page cache pages are unpinned.
+static void
+unmappages(pde_t *pgdir, uint start, uint end)
+{
+  pte_t *pte;
+  uint a, pa;
+
+  for(a = start; a < end; a += PGSIZE){
+    pte = walkpgdir(pgdir, (char*)a, 0);
+    if(!pte)
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+    else if((*pte & PTE_P) != 0){
+      pa = PTE_ADDR(*pte);
+      if(*pte & PTE_PCACHE)
+        vfs_putpage(P2V(pa));
+      else
+        kfree(P2V(pa));
+      *pte = 0;
+    }
+  }
+}
+
+// Unmap [addr, addr+length) from p. Mappings that only partly overlap the
+// range are trimmed (or split in two). Returns 0, or -1 on bad arguments.
+int
+vmaunmap(struct proc *p, uint addr, uint length)
+{
+  struct vma *v, *slot;
+  uint end, lo, hi;
+
+  end = addr + PGROUNDUP(length);
+  if(addr % PGSIZE != 0 || end <= addr || end > KERNBASE)
+    return -1;
+
+  // a mapping with the range in its middle needs a second slot
+  slot = 0;
+  for(v = p->vma; v < p->vma + NVMA; v++)
+    if(v->ip == 0 && slot == 0)
+      slot = v;
+  for(v = p->vma; v < p->vma + NVMA; v++)
+    if(v->ip && v->start < addr && v->end > end && slot == 0)
+      return -1;
+
+  for(v = p->vma; v < p->vma + NVMA; v++){
+    if(v->ip == 0 || v->end <= addr || v->start >= end)
+      continue;
+    lo = v->start > addr ? v->start : addr;
+    hi = v->end < end ? v->end : end;
+    unmappages(p->pgdir, lo, hi);
+
+    if(lo == v->start && hi == v->end){
+      vfs_iput(v->ip);
+      v->ip = 0;
+    } else if(lo == v->start){
+      v->off += hi - v->start;
+      v->filesz -= v->filesz < hi - v->start ? v->filesz : hi - v->start;
+      v->start = hi;
+    } else if(hi == v->end){
+      v->end = lo;
+    } else {
+      *slot = *v;
+      slot->ip = vfs_idup(v->ip);
+      slot->off = v->off + (hi - v->start);
+      slot->filesz -= v->filesz < hi - v->start ? v->filesz : hi - v->start;
+      slot->start = hi;
+      v->end = lo;
+    }
+  }
+
+  lcr3(V2P(p->pgdir));
+  return 0;
+}
+
+// Read page va of mapping v into a new page.
+static char*
+vmaload(struct vma *v, uint va)
+{
+  char *mem;
+  uint pos;
+  int n;
+
+  if((mem = kalloc()) == 0)
+    return 0;
+  pos = va - v->start;
+  n = 0;
+  if(pos < v->filesz){
+    n = v->filesz - pos < PGSIZE ? v->filesz - pos : PGSIZE;
+    if((n = vfs_readi(v->ip, mem, v->off + pos, n)) < 0)
+      n = 0;
+  }
+  memset(mem + n, 0, PGSIZE - n);
+  return mem;
+}
+
+// Handle a page fault at va, which may lie in a mapping of p.
+// Returns 0 if the access can be retried, -1 if it is not allowed.
+int
+vmafault(struct proc *p, uint va, int write)
+{
+  struct vma *v;
+  pte_t *pte;
+  char *mem;
+  int perm;
+
+  if((v = vmalookup(p, va)) == 0)
+    return -1;
+  if(!(v->prot & PROT_READ) || (write && !(v->prot & PROT_WRITE)))
+    return -1;
+  va = PGROUNDDOWN(va);
+  if((pte = walkpgdir(p->pgdir, (char*)va, 1)) == 0)
+    return -1;
+
+  if(*pte & PTE_P){
+    if(!write || (*pte & PTE_W))
+      return -1;
+    if(*pte & PTE_COW){
+      // private page still shared with a fork
+      if(cowpage(pte) < 0)
+        return -1;
+    } else if(*pte & PTE_PCACHE){
+      // first write to a page of a private mapping: copy it
+      if((mem = kalloc()) == 0)
+        return -1;
+      memmove(mem, P2V(PTE_ADDR(*pte)), PGSIZE);
+      vfs_putpage(P2V(PTE_ADDR(*pte)));
+      *pte = V2P(mem) | PTE_P | PTE_W | PTE_U;
+    } else
+      return -1;
+    lcr3(V2P(p->pgdir));
+    return 0;
+  }
+
+  perm = PTE_P | PTE_U;
+  if((v->flags & MAP_PRIVATE) && write){
+    mem = vmaload(v, va);
+    perm |= PTE_W;
+  } else if(v->off % PGSIZE == 0 && va - v->start + PGSIZE <= v->filesz &&
+            (mem = vfs_getpage(v->ip, (v->off + (va - v->start)) / PGSIZE)) != 0){
+    perm |= PTE_PCACHE;
+  } else {
+    // the page is not laid out page by page in the file, or the page
+    // cache is full of mapped pages -- make a copy instead
+    mem = vmaload(v, va);
+    if(v->flags & MAP_PRIVATE && (v->prot & PROT_WRITE))
+      perm |= PTE_W;
+  }
+  if(mem == 0)
+    return -1;
+  *pte = V2P(mem) | perm;
+  return 0;
+}
+
+// Give np (a fork of p, the current process) the same mappings. Pages
+// that still come from the page cache are faulted in again by the child;
+// private copies are shared copy-on-write.
+int
+vmacopy(struct proc *p, struct proc *np)
+{
+  struct vma *v;
+  pte_t *pte;
+  uint a, pa;
+  int i;
+
+  for(i = 0; i < NVMA; i++){
+    v = &p->vma[i];
+    if(v->ip == 0)
+      continue;
+    np->vma[i] = *v;
+    np->vma[i].ip = vfs_idup(v->ip);
+    // pages of the program image have been shared by copyuvm
+    if(v->end <= p->sz)
+      continue;
+
+    for(a = v->start; a < v->end; a += PGSIZE){
+      pte = walkpgdir(p->pgdir, (char*)a, 0);
+      if(!pte){
+        a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+        continue;
+      }
+      if(!(*pte & PTE_P) || (*pte & PTE_PCACHE))
+        continue;
+      if(*pte & PTE_W)
+        *pte = (*pte & ~PTE_W) | PTE_COW;
+      pa = PTE_ADDR(*pte);
+      if(mappages(np->pgdir, (char*)a, PGSIZE, pa, PTE_FLAGS(*pte)) < 0){
+        lcr3(V2P(p->pgdir));
+        return -1;
+      }
+      kdup(P2V(pa));
+    }
+  }
+  lcr3(V2P(p->pgdir));
+  return 0;
+}
+
+// Drop all mappings of p.
+void
+vmafree(struct proc *p)
+{
+  struct vma *v;
+
+  for(v = p->vma; v < p->vma + NVMA; v++){
+    if(v->ip == 0)
+      continue;
+    unmappages(p->pgdir, v->start, v->end);
+    vfs_iput(v->ip);
+    v->ip = 0;
+  }
+}
+
+// Check that the kernel may access [va, va+size) on behalf of p: it must
+// lie below sz, or within a single mapping that allows the access. Pages
+// that are not mapped, or for writes not mapped writable (copy-on-write,
+// or not yet privately mapped), are faulted in now, so the kernel can use
+// the memory directly.
+int
+uvmcheck(struct proc *p, uint va, uint size, int write)
+{
+  struct vma *v;
+  pte_t *pte;
+  uint a;
+
+  if(va + size < va)
+    return -1;
+  if(va >= p->sz || va + size > p->sz)
+    if((v = vmalookup(p, va)) == 0 || va + size > v->end)
+      return -1;
+
+  for(a = PGROUNDDOWN(va); a < va + size; a += PGSIZE){
+    pte = walkpgdir(p->pgdir, (char*)a, 0);
+    if(pte && (*pte & PTE_P) && (!write || (*pte & PTE_W)))
+      continue;
+    if(uvmfault(p, a, write) < 0)
+      return -1;
+  }
+  return 0;
+}
+
 //PAGEBREAK!
 // Blank page.
 //PAGEBREAK!
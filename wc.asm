@@ -0,0 +1,1390 @@
+
+_wc:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <wc>:
+
+char buf[512];
+
+void
+wc(int fd, char *name)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 28             	sub    $0x28,%esp
+  int i, n;
+  int l, w, c, inword;
+
+  l = w = c = 0;
+   6:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+   d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  10:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  13:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  16:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  inword = 0;
+  19:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+  20:	eb 69                	jmp    8b <wc+0x8b>
+    for(i=0; i<n; i++){
+  22:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  29:	eb 58                	jmp    83 <wc+0x83>
+      c++;
+  2b:	83 45 e8 01          	addl   $0x1,-0x18(%ebp)
+      if(buf[i] == '\n')
+  2f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  32:	05 20 20 00 00       	add    $0x2020,%eax
+  37:	0f b6 00             	movzbl (%eax),%eax
+  3a:	3c 0a                	cmp    $0xa,%al
+  3c:	75 04                	jne    42 <wc+0x42>
+        l++;
+  3e:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+      if(strchr(" \r\t\n\v", buf[i]))
+  42:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  45:	05 20 20 00 00       	add    $0x2020,%eax
+  4a:	0f b6 00             	movzbl (%eax),%eax
+  4d:	0f be c0             	movsbl %al,%eax
+  50:	83 ec 08             	sub    $0x8,%esp
+  53:	50                   	push   %eax
+  54:	68 00 10 00 00       	push   $0x1000
+  59:	e8 35 02 00 00       	call   293 <strchr>
+  5e:	83 c4 10             	add    $0x10,%esp
+  61:	85 c0                	test   %eax,%eax
+  63:	74 09                	je     6e <wc+0x6e>
+        inword = 0;
+  65:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  6c:	eb 11                	jmp    7f <wc+0x7f>
+      else if(!inword){
+  6e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  72:	75 0b                	jne    7f <wc+0x7f>
+        w++;
+  74:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+        inword = 1;
+  78:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+    for(i=0; i<n; i++){
+  7f:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  83:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  86:	3b 45 e0             	cmp    -0x20(%ebp),%eax
+  89:	7c a0                	jl     2b <wc+0x2b>
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+  8b:	83 ec 04             	sub    $0x4,%esp
+  8e:	68 00 02 00 00       	push   $0x200
+  93:	68 20 20 00 00       	push   $0x2020
+  98:	ff 75 08             	push   0x8(%ebp)
+  9b:	e8 69 04 00 00       	call   509 <read>
+  a0:	83 c4 10             	add    $0x10,%esp
+  a3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  a6:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  aa:	0f 8f 72 ff ff ff    	jg     22 <wc+0x22>
+      }
+    }
+  }
+  if(n < 0){
+  b0:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  b4:	79 17                	jns    cd <wc+0xcd>
+    printf(1, "wc: read error\n");
+  b6:	83 ec 08             	sub    $0x8,%esp
+  b9:	68 06 10 00 00       	push   $0x1006
+  be:	6a 01                	push   $0x1
+  c0:	e8 d0 05 00 00       	call   695 <printf>
+  c5:	83 c4 10             	add    $0x10,%esp
+    exit();
+  c8:	e8 24 04 00 00       	call   4f1 <exit>
+  }
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+  cd:	83 ec 08             	sub    $0x8,%esp
+  d0:	ff 75 0c             	push   0xc(%ebp)
+  d3:	ff 75 e8             	push   -0x18(%ebp)
+  d6:	ff 75 ec             	push   -0x14(%ebp)
+  d9:	ff 75 f0             	push   -0x10(%ebp)
+  dc:	68 16 10 00 00       	push   $0x1016
+  e1:	6a 01                	push   $0x1
+  e3:	e8 ad 05 00 00       	call   695 <printf>
+  e8:	83 c4 20             	add    $0x20,%esp
+}
+  eb:	90                   	nop
+  ec:	c9                   	leave
+  ed:	c3                   	ret
+
+000000ee <main>:
+
+int
+main(int argc, char *argv[])
+{
+  ee:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  f2:	83 e4 f0             	and    $0xfffffff0,%esp
+  f5:	ff 71 fc             	push   -0x4(%ecx)
+  f8:	55                   	push   %ebp
+  f9:	89 e5                	mov    %esp,%ebp
+  fb:	53                   	push   %ebx
+  fc:	51                   	push   %ecx
+  fd:	83 ec 10             	sub    $0x10,%esp
+ 100:	89 cb                	mov    %ecx,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+ 102:	83 3b 01             	cmpl   $0x1,(%ebx)
+ 105:	7f 17                	jg     11e <main+0x30>
+    wc(0, "");
+ 107:	83 ec 08             	sub    $0x8,%esp
+ 10a:	68 23 10 00 00       	push   $0x1023
+ 10f:	6a 00                	push   $0x0
+ 111:	e8 ea fe ff ff       	call   0 <wc>
+ 116:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 119:	e8 d3 03 00 00       	call   4f1 <exit>
+  }
+
+  for(i = 1; i < argc; i++){
+ 11e:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+ 125:	e9 83 00 00 00       	jmp    1ad <main+0xbf>
+    if((fd = open(argv[i], 0)) < 0){
+ 12a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 12d:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 134:	8b 43 04             	mov    0x4(%ebx),%eax
+ 137:	01 d0                	add    %edx,%eax
+ 139:	8b 00                	mov    (%eax),%eax
+ 13b:	83 ec 08             	sub    $0x8,%esp
+ 13e:	6a 00                	push   $0x0
+ 140:	50                   	push   %eax
+ 141:	e8 eb 03 00 00       	call   531 <open>
+ 146:	83 c4 10             	add    $0x10,%esp
+ 149:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 14c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 150:	79 29                	jns    17b <main+0x8d>
+      printf(1, "wc: cannot open %s\n", argv[i]);
+ 152:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 155:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 15c:	8b 43 04             	mov    0x4(%ebx),%eax
+ 15f:	01 d0                	add    %edx,%eax
+ 161:	8b 00                	mov    (%eax),%eax
+ 163:	83 ec 04             	sub    $0x4,%esp
+ 166:	50                   	push   %eax
+ 167:	68 24 10 00 00       	push   $0x1024
+ 16c:	6a 01                	push   $0x1
+ 16e:	e8 22 05 00 00       	call   695 <printf>
+ 173:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 176:	e8 76 03 00 00       	call   4f1 <exit>
+    }
+    wc(fd, argv[i]);
+ 17b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 17e:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 185:	8b 43 04             	mov    0x4(%ebx),%eax
+ 188:	01 d0                	add    %edx,%eax
+ 18a:	8b 00                	mov    (%eax),%eax
+ 18c:	83 ec 08             	sub    $0x8,%esp
+ 18f:	50                   	push   %eax
+ 190:	ff 75 f0             	push   -0x10(%ebp)
+ 193:	e8 68 fe ff ff       	call   0 <wc>
+ 198:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+ 19b:	83 ec 0c             	sub    $0xc,%esp
+ 19e:	ff 75 f0             	push   -0x10(%ebp)
+ 1a1:	e8 73 03 00 00       	call   519 <close>
+ 1a6:	83 c4 10             	add    $0x10,%esp
+  for(i = 1; i < argc; i++){
+ 1a9:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 1ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1b0:	3b 03                	cmp    (%ebx),%eax
+ 1b2:	0f 8c 72 ff ff ff    	jl     12a <main+0x3c>
+  }
+  exit();
+ 1b8:	e8 34 03 00 00       	call   4f1 <exit>
+
+000001bd <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 1bd:	55                   	push   %ebp
+ 1be:	89 e5                	mov    %esp,%ebp
+ 1c0:	57                   	push   %edi
+ 1c1:	53                   	push   %ebx
+    if(cc < 1)
+ 1c2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1c5:	8b 55 10             	mov    0x10(%ebp),%edx
+ 1c8:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1cb:	89 cb                	mov    %ecx,%ebx
+ 1cd:	89 df                	mov    %ebx,%edi
+ 1cf:	89 d1                	mov    %edx,%ecx
+ 1d1:	fc                   	cld
+ 1d2:	f3 aa                	rep stos %al,%es:(%edi)
+ 1d4:	89 ca                	mov    %ecx,%edx
+ 1d6:	89 fb                	mov    %edi,%ebx
+ 1d8:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 1db:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+ 1de:	90                   	nop
+ 1df:	5b                   	pop    %ebx
+ 1e0:	5f                   	pop    %edi
+ 1e1:	5d                   	pop    %ebp
+ 1e2:	c3                   	ret
+
+000001e3 <strcpy>:
+{
+ 1e3:	55                   	push   %ebp
+ 1e4:	89 e5                	mov    %esp,%ebp
+ 1e6:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 1e9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1ec:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 1ef:	90                   	nop
+ 1f0:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 1f3:	8d 42 01             	lea    0x1(%edx),%eax
+ 1f6:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 1f9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1fc:	8d 48 01             	lea    0x1(%eax),%ecx
+ 1ff:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 202:	0f b6 12             	movzbl (%edx),%edx
+ 205:	88 10                	mov    %dl,(%eax)
+ 207:	0f b6 00             	movzbl (%eax),%eax
+ 20a:	84 c0                	test   %al,%al
+ 20c:	75 e2                	jne    1f0 <strcpy+0xd>
+  return os;
+ 20e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 211:	c9                   	leave
+ 212:	c3                   	ret
+
+00000213 <strcmp>:
+{
+ 213:	55                   	push   %ebp
+ 214:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 216:	eb 08                	jmp    220 <strcmp+0xd>
+    p++, q++;
+ 218:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 21c:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 220:	8b 45 08             	mov    0x8(%ebp),%eax
+ 223:	0f b6 00             	movzbl (%eax),%eax
+ 226:	84 c0                	test   %al,%al
+ 228:	74 10                	je     23a <strcmp+0x27>
+ 22a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 22d:	0f b6 10             	movzbl (%eax),%edx
+ 230:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 233:	0f b6 00             	movzbl (%eax),%eax
+ 236:	38 c2                	cmp    %al,%dl
+ 238:	74 de                	je     218 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 23a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 23d:	0f b6 00             	movzbl (%eax),%eax
+ 240:	0f b6 d0             	movzbl %al,%edx
+ 243:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 246:	0f b6 00             	movzbl (%eax),%eax
+ 249:	0f b6 c0             	movzbl %al,%eax
+ 24c:	29 c2                	sub    %eax,%edx
+ 24e:	89 d0                	mov    %edx,%eax
+}
+ 250:	5d                   	pop    %ebp
+ 251:	c3                   	ret
+
+00000252 <strlen>:
+{
+ 252:	55                   	push   %ebp
+ 253:	89 e5                	mov    %esp,%ebp
+ 255:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 258:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 25f:	eb 04                	jmp    265 <strlen+0x13>
+ 261:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 265:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 268:	8b 45 08             	mov    0x8(%ebp),%eax
+ 26b:	01 d0                	add    %edx,%eax
+ 26d:	0f b6 00             	movzbl (%eax),%eax
+ 270:	84 c0                	test   %al,%al
+ 272:	75 ed                	jne    261 <strlen+0xf>
+  return n;
+ 274:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 277:	c9                   	leave
+ 278:	c3                   	ret
+
+00000279 <memset>:
+{
+ 279:	55                   	push   %ebp
+ 27a:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 27c:	8b 45 10             	mov    0x10(%ebp),%eax
+ 27f:	50                   	push   %eax
+ 280:	ff 75 0c             	push   0xc(%ebp)
+ 283:	ff 75 08             	push   0x8(%ebp)
+ 286:	e8 32 ff ff ff       	call   1bd <stosb>
+ 28b:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 28e:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 291:	c9                   	leave
+ 292:	c3                   	ret
+
+00000293 <strchr>:
+{
+ 293:	55                   	push   %ebp
+ 294:	89 e5                	mov    %esp,%ebp
+ 296:	83 ec 04             	sub    $0x4,%esp
+ 299:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 29c:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 29f:	eb 14                	jmp    2b5 <strchr+0x22>
+    if(*s == c)
+ 2a1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2a4:	0f b6 00             	movzbl (%eax),%eax
+ 2a7:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 2aa:	75 05                	jne    2b1 <strchr+0x1e>
+      return (char*)s;
+ 2ac:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2af:	eb 13                	jmp    2c4 <strchr+0x31>
+  for(; *s; s++)
+ 2b1:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 2b5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2b8:	0f b6 00             	movzbl (%eax),%eax
+ 2bb:	84 c0                	test   %al,%al
+ 2bd:	75 e2                	jne    2a1 <strchr+0xe>
+  return 0;
+ 2bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 2c4:	c9                   	leave
+ 2c5:	c3                   	ret
+
+000002c6 <gets>:
+{
+ 2c6:	55                   	push   %ebp
+ 2c7:	89 e5                	mov    %esp,%ebp
+ 2c9:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 2cc:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 2d3:	eb 42                	jmp    317 <gets+0x51>
+    cc = read(0, &c, 1);
+ 2d5:	83 ec 04             	sub    $0x4,%esp
+ 2d8:	6a 01                	push   $0x1
+ 2da:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 2dd:	50                   	push   %eax
+ 2de:	6a 00                	push   $0x0
+ 2e0:	e8 24 02 00 00       	call   509 <read>
+ 2e5:	83 c4 10             	add    $0x10,%esp
+ 2e8:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 2eb:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 2ef:	7e 33                	jle    324 <gets+0x5e>
+    buf[i++] = c;
+ 2f1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2f4:	8d 50 01             	lea    0x1(%eax),%edx
+ 2f7:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 2fa:	89 c2                	mov    %eax,%edx
+ 2fc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2ff:	01 c2                	add    %eax,%edx
+ 301:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 305:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 307:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 30b:	3c 0a                	cmp    $0xa,%al
+ 30d:	74 16                	je     325 <gets+0x5f>
+ 30f:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 313:	3c 0d                	cmp    $0xd,%al
+ 315:	74 0e                	je     325 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 317:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 31a:	83 c0 01             	add    $0x1,%eax
+ 31d:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 320:	7f b3                	jg     2d5 <gets+0xf>
+ 322:	eb 01                	jmp    325 <gets+0x5f>
+      break;
+ 324:	90                   	nop
+  }
+  buf[i] = '\0';
+ 325:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 328:	8b 45 08             	mov    0x8(%ebp),%eax
+ 32b:	01 d0                	add    %edx,%eax
+ 32d:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 330:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 333:	c9                   	leave
+ 334:	c3                   	ret
+
+00000335 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 335:	55                   	push   %ebp
+ 336:	89 e5                	mov    %esp,%ebp
+ 338:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 33b:	83 ec 08             	sub    $0x8,%esp
+ 33e:	6a 00                	push   $0x0
+ 340:	ff 75 08             	push   0x8(%ebp)
+ 343:	e8 e9 01 00 00       	call   531 <open>
+ 348:	83 c4 10             	add    $0x10,%esp
+ 34b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 34e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 352:	79 07                	jns    35b <stat+0x26>
+    return -1;
+ 354:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 359:	eb 25                	jmp    380 <stat+0x4b>
+  r = fstat(fd, st);
+ 35b:	83 ec 08             	sub    $0x8,%esp
+ 35e:	ff 75 0c             	push   0xc(%ebp)
+ 361:	ff 75 f4             	push   -0xc(%ebp)
+ 364:	e8 e0 01 00 00       	call   549 <fstat>
+ 369:	83 c4 10             	add    $0x10,%esp
+ 36c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 36f:	83 ec 0c             	sub    $0xc,%esp
+ 372:	ff 75 f4             	push   -0xc(%ebp)
+ 375:	e8 9f 01 00 00       	call   519 <close>
+ 37a:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 37d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 380:	c9                   	leave
+ 381:	c3                   	ret
+
+00000382 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 382:	55                   	push   %ebp
+ 383:	89 e5                	mov    %esp,%ebp
+ 385:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 388:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 38f:	eb 25                	jmp    3b6 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 391:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 394:	89 d0                	mov    %edx,%eax
+ 396:	c1 e0 02             	shl    $0x2,%eax
+ 399:	01 d0                	add    %edx,%eax
+ 39b:	01 c0                	add    %eax,%eax
+ 39d:	89 c1                	mov    %eax,%ecx
+ 39f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3a2:	8d 50 01             	lea    0x1(%eax),%edx
+ 3a5:	89 55 08             	mov    %edx,0x8(%ebp)
+ 3a8:	0f b6 00             	movzbl (%eax),%eax
+ 3ab:	0f be c0             	movsbl %al,%eax
+ 3ae:	01 c8                	add    %ecx,%eax
+ 3b0:	83 e8 30             	sub    $0x30,%eax
+ 3b3:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 3b6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3b9:	0f b6 00             	movzbl (%eax),%eax
+ 3bc:	3c 2f                	cmp    $0x2f,%al
+ 3be:	7e 0a                	jle    3ca <atoi+0x48>
+ 3c0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c3:	0f b6 00             	movzbl (%eax),%eax
+ 3c6:	3c 39                	cmp    $0x39,%al
+ 3c8:	7e c7                	jle    391 <atoi+0xf>
+  return n;
+ 3ca:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 3cd:	c9                   	leave
+ 3ce:	c3                   	ret
+
+000003cf <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 3cf:	55                   	push   %ebp
+ 3d0:	89 e5                	mov    %esp,%ebp
+ 3d2:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+
+  dst = vdst;
+ 3d5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3d8:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 3db:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3de:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 3e1:	eb 17                	jmp    3fa <memmove+0x2b>
+    *dst++ = *src++;
+ 3e3:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 3e6:	8d 42 01             	lea    0x1(%edx),%eax
+ 3e9:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 3ec:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 3ef:	8d 48 01             	lea    0x1(%eax),%ecx
+ 3f2:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 3f5:	0f b6 12             	movzbl (%edx),%edx
+ 3f8:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 3fa:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3fd:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 400:	89 55 10             	mov    %edx,0x10(%ebp)
+ 403:	85 c0                	test   %eax,%eax
+ 405:	7f dc                	jg     3e3 <memmove+0x14>
+  return vdst;
+ 407:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 40a:	c9                   	leave
+ 40b:	c3                   	ret
+
+0000040c <opendir>:
+    int fd;
+    int child;
+} DIR;
+
+DIR* opendir(const char* name)
+{
+ 40c:	55                   	push   %ebp
+ 40d:	89 e5                	mov    %esp,%ebp
+ 40f:	83 ec 18             	sub    $0x18,%esp
+    DIR* dp = malloc(sizeof(*dp));
+ 412:	83 ec 0c             	sub    $0xc,%esp
+ 415:	6a 08                	push   $0x8
+ 417:	e8 4d 05 00 00       	call   969 <malloc>
+ 41c:	83 c4 10             	add    $0x10,%esp
+ 41f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+    dp->fd = open((char*)name, 0);
+ 422:	83 ec 08             	sub    $0x8,%esp
+ 425:	6a 00                	push   $0x0
+ 427:	ff 75 08             	push   0x8(%ebp)
+ 42a:	e8 02 01 00 00       	call   531 <open>
+ 42f:	83 c4 10             	add    $0x10,%esp
+ 432:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 435:	89 02                	mov    %eax,(%edx)
+    dp->child = 0;
+ 437:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 43a:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+
+    return dp;
+ 441:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 444:	c9                   	leave
+ 445:	c3                   	ret
+
+00000446 <closedir>:
+
+void closedir(DIR* dp)
+{
+ 446:	55                   	push   %ebp
+ 447:	89 e5                	mov    %esp,%ebp
+ 449:	83 ec 08             	sub    $0x8,%esp
+    if(dp == 0) {
+ 44c:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 450:	74 21                	je     473 <closedir+0x2d>
+        return;
+    }
+
+    close(dp->fd);
+ 452:	8b 45 08             	mov    0x8(%ebp),%eax
+ 455:	8b 00                	mov    (%eax),%eax
+ 457:	83 ec 0c             	sub    $0xc,%esp
+ 45a:	50                   	push   %eax
+ 45b:	e8 b9 00 00 00       	call   519 <close>
+ 460:	83 c4 10             	add    $0x10,%esp
+    free(dp);
+ 463:	83 ec 0c             	sub    $0xc,%esp
+ 466:	ff 75 08             	push   0x8(%ebp)
+ 469:	e8 b9 03 00 00       	call   827 <free>
+ 46e:	83 c4 10             	add    $0x10,%esp
+ 471:	eb 01                	jmp    474 <closedir+0x2e>
+        return;
+ 473:	90                   	nop
+}
+ 474:	c9                   	leave
+ 475:	c3                   	ret
+
+00000476 <readdir>:
+
+struct dirent* readdir(DIR* dp)
+{
+ 476:	55                   	push   %ebp
+ 477:	89 e5                	mov    %esp,%ebp
+ 479:	83 ec 18             	sub    $0x18,%esp
+    if(dp == 0) {
+ 47c:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 480:	75 07                	jne    489 <readdir+0x13>
+      return 0;
+ 482:	b8 00 00 00 00       	mov    $0x0,%eax
+ 487:	eb 5e                	jmp    4e7 <readdir+0x71>
+    }
+
+    struct dirent* de = malloc(sizeof(*de));
+ 489:	83 ec 0c             	sub    $0xc,%esp
+ 48c:	68 0c 01 00 00       	push   $0x10c
+ 491:	e8 d3 04 00 00       	call   969 <malloc>
+ 496:	83 c4 10             	add    $0x10,%esp
+ 499:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    int res = direntry(dp->fd, dp->child, de);
+ 49c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 49f:	8b 50 04             	mov    0x4(%eax),%edx
+ 4a2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4a5:	8b 00                	mov    (%eax),%eax
+ 4a7:	83 ec 04             	sub    $0x4,%esp
+ 4aa:	ff 75 f4             	push   -0xc(%ebp)
+ 4ad:	52                   	push   %edx
+ 4ae:	50                   	push   %eax
+ 4af:	e8 e5 00 00 00       	call   599 <direntry>
+ 4b4:	83 c4 10             	add    $0x10,%esp
+ 4b7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+
+    // out of children or other error
+    if(res == -1) {
+ 4ba:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+ 4be:	75 15                	jne    4d5 <readdir+0x5f>
+        free(de);
+ 4c0:	83 ec 0c             	sub    $0xc,%esp
+ 4c3:	ff 75 f4             	push   -0xc(%ebp)
+ 4c6:	e8 5c 03 00 00       	call   827 <free>
+ 4cb:	83 c4 10             	add    $0x10,%esp
+        return 0;
+ 4ce:	b8 00 00 00 00       	mov    $0x0,%eax
+ 4d3:	eb 12                	jmp    4e7 <readdir+0x71>
+    }
+
+    dp->child++;
+ 4d5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4d8:	8b 40 04             	mov    0x4(%eax),%eax
+ 4db:	8d 50 01             	lea    0x1(%eax),%edx
+ 4de:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4e1:	89 50 04             	mov    %edx,0x4(%eax)
+    return de;
+ 4e4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 4e7:	c9                   	leave
+ 4e8:	c3                   	ret
+
+000004e9 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 4e9:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4ee:	cd 40                	int    $0x40
+ 4f0:	c3                   	ret
+
+000004f1 <exit>:
+SYSCALL(exit)
+ 4f1:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4f6:	cd 40                	int    $0x40
+ 4f8:	c3                   	ret
+
+000004f9 <wait>:
+SYSCALL(wait)
+ 4f9:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4fe:	cd 40                	int    $0x40
+ 500:	c3                   	ret
+
+00000501 <pipe>:
+SYSCALL(pipe)
+ 501:	b8 04 00 00 00       	mov    $0x4,%eax
+ 506:	cd 40                	int    $0x40
+ 508:	c3                   	ret
+
+00000509 <read>:
+SYSCALL(read)
+ 509:	b8 05 00 00 00       	mov    $0x5,%eax
+ 50e:	cd 40                	int    $0x40
+ 510:	c3                   	ret
+
+00000511 <write>:
+SYSCALL(write)
+ 511:	b8 10 00 00 00       	mov    $0x10,%eax
+ 516:	cd 40                	int    $0x40
+ 518:	c3                   	ret
+
+00000519 <close>:
+SYSCALL(close)
+ 519:	b8 15 00 00 00       	mov    $0x15,%eax
+ 51e:	cd 40                	int    $0x40
+ 520:	c3                   	ret
+
+00000521 <kill>:
+SYSCALL(kill)
+ 521:	b8 06 00 00 00       	mov    $0x6,%eax
+ 526:	cd 40                	int    $0x40
+ 528:	c3                   	ret
+
+00000529 <exec>:
+SYSCALL(exec)
+ 529:	b8 07 00 00 00       	mov    $0x7,%eax
+ 52e:	cd 40                	int    $0x40
+ 530:	c3                   	ret
+
+00000531 <open>:
+SYSCALL(open)
+ 531:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 536:	cd 40                	int    $0x40
+ 538:	c3                   	ret
+
+00000539 <mknod>:
+SYSCALL(mknod)
+ 539:	b8 11 00 00 00       	mov    $0x11,%eax
+ 53e:	cd 40                	int    $0x40
+ 540:	c3                   	ret
+
+00000541 <unlink>:
+SYSCALL(unlink)
+ 541:	b8 12 00 00 00       	mov    $0x12,%eax
+ 546:	cd 40                	int    $0x40
+ 548:	c3                   	ret
+
+00000549 <fstat>:
+SYSCALL(fstat)
+ 549:	b8 08 00 00 00       	mov    $0x8,%eax
+ 54e:	cd 40                	int    $0x40
+ 550:	c3                   	ret
+
+00000551 <link>:
+SYSCALL(link)
+ 551:	b8 13 00 00 00       	mov    $0x13,%eax
+ 556:	cd 40                	int    $0x40
+ 558:	c3                   	ret
+
+00000559 <mkdir>:
+SYSCALL(mkdir)
+ 559:	b8 14 00 00 00       	mov    $0x14,%eax
+ 55e:	cd 40                	int    $0x40
+ 560:	c3                   	ret
+
+00000561 <chdir>:
+SYSCALL(chdir)
+ 561:	b8 09 00 00 00       	mov    $0x9,%eax
+ 566:	cd 40                	int    $0x40
+ 568:	c3                   	ret
+
+00000569 <dup>:
+SYSCALL(dup)
+ 569:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 56e:	cd 40                	int    $0x40
+ 570:	c3                   	ret
+
+00000571 <getpid>:
+SYSCALL(getpid)
+ 571:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 576:	cd 40                	int    $0x40
+ 578:	c3                   	ret
+
+00000579 <sbrk>:
+SYSCALL(sbrk)
+ 579:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 57e:	cd 40                	int    $0x40
+ 580:	c3                   	ret
+
+00000581 <sleep>:
+SYSCALL(sleep)
+ 581:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 586:	cd 40                	int    $0x40
+ 588:	c3                   	ret
+
+00000589 <uptime>:
+SYSCALL(uptime)
+ 589:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 58e:	cd 40                	int    $0x40
+ 590:	c3                   	ret
+
+00000591 <mount>:
+SYSCALL(mount)
+ 591:	b8 16 00 00 00       	mov    $0x16,%eax
+ 596:	cd 40                	int    $0x40
+ 598:	c3                   	ret
+
+00000599 <direntry>:
+SYSCALL(direntry)
+ 599:	b8 17 00 00 00       	mov    $0x17,%eax
+ 59e:	cd 40                	int    $0x40
+ 5a0:	c3                   	ret
+
+000005a1 <sync>:
+SYSCALL(sync)
+ 5a1:	b8 18 00 00 00       	mov    $0x18,%eax
+ 5a6:	cd 40                	int    $0x40
+ 5a8:	c3                   	ret
+
+000005a9 <fsync>:
+SYSCALL(fsync)
+ 5a9:	b8 19 00 00 00       	mov    $0x19,%eax
+ 5ae:	cd 40                	int    $0x40
+ 5b0:	c3                   	ret
+
+000005b1 <mmap>:
+SYSCALL(mmap)
+ 5b1:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 5b6:	cd 40                	int    $0x40
+ 5b8:	c3                   	ret
+
+000005b9 <munmap>:
+SYSCALL(munmap)
+ 5b9:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 5be:	cd 40                	int    $0x40
+ 5c0:	c3                   	ret
+
+000005c1 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 5c1:	55                   	push   %ebp
+ 5c2:	89 e5                	mov    %esp,%ebp
+ 5c4:	83 ec 18             	sub    $0x18,%esp
+ 5c7:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5ca:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 5cd:	83 ec 04             	sub    $0x4,%esp
+ 5d0:	6a 01                	push   $0x1
+ 5d2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 5d5:	50                   	push   %eax
+ 5d6:	ff 75 08             	push   0x8(%ebp)
+ 5d9:	e8 33 ff ff ff       	call   511 <write>
+ 5de:	83 c4 10             	add    $0x10,%esp
+}
+ 5e1:	90                   	nop
+ 5e2:	c9                   	leave
+ 5e3:	c3                   	ret
+
+000005e4 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 5e4:	55                   	push   %ebp
+ 5e5:	89 e5                	mov    %esp,%ebp
+ 5e7:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 5ea:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 5f1:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 5f5:	74 17                	je     60e <printint+0x2a>
+ 5f7:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 5fb:	79 11                	jns    60e <printint+0x2a>
+    neg = 1;
+ 5fd:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 604:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 607:	f7 d8                	neg    %eax
+ 609:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 60c:	eb 06                	jmp    614 <printint+0x30>
+  } else {
+    x = xx;
+ 60e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 611:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 614:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 61b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 61e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 621:	ba 00 00 00 00       	mov    $0x0,%edx
+ 626:	f7 f1                	div    %ecx
+ 628:	89 d1                	mov    %edx,%ecx
+ 62a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 62d:	8d 50 01             	lea    0x1(%eax),%edx
+ 630:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 633:	0f b6 91 00 20 00 00 	movzbl 0x2000(%ecx),%edx
+ 63a:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 63e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 641:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 644:	ba 00 00 00 00       	mov    $0x0,%edx
+ 649:	f7 f1                	div    %ecx
+ 64b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 64e:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 652:	75 c7                	jne    61b <printint+0x37>
+  if(neg)
+ 654:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 658:	74 2d                	je     687 <printint+0xa3>
+    buf[i++] = '-';
+ 65a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 65d:	8d 50 01             	lea    0x1(%eax),%edx
+ 660:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 663:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 668:	eb 1d                	jmp    687 <printint+0xa3>
+    putc(fd, buf[i]);
+ 66a:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 66d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 670:	01 d0                	add    %edx,%eax
+ 672:	0f b6 00             	movzbl (%eax),%eax
+ 675:	0f be c0             	movsbl %al,%eax
+ 678:	83 ec 08             	sub    $0x8,%esp
+ 67b:	50                   	push   %eax
+ 67c:	ff 75 08             	push   0x8(%ebp)
+ 67f:	e8 3d ff ff ff       	call   5c1 <putc>
+ 684:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 687:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 68b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 68f:	79 d9                	jns    66a <printint+0x86>
+}
+ 691:	90                   	nop
+ 692:	90                   	nop
+ 693:	c9                   	leave
+ 694:	c3                   	ret
+
+00000695 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 695:	55                   	push   %ebp
+ 696:	89 e5                	mov    %esp,%ebp
+ 698:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 69b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 6a2:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 6a5:	83 c0 04             	add    $0x4,%eax
+ 6a8:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 6ab:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 6b2:	e9 59 01 00 00       	jmp    810 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 6b7:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 6ba:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 6bd:	01 d0                	add    %edx,%eax
+ 6bf:	0f b6 00             	movzbl (%eax),%eax
+ 6c2:	0f be c0             	movsbl %al,%eax
+ 6c5:	25 ff 00 00 00       	and    $0xff,%eax
+ 6ca:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 6cd:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 6d1:	75 2c                	jne    6ff <printf+0x6a>
+      if(c == '%'){
+ 6d3:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 6d7:	75 0c                	jne    6e5 <printf+0x50>
+        state = '%';
+ 6d9:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 6e0:	e9 27 01 00 00       	jmp    80c <printf+0x177>
+      } else {
+        putc(fd, c);
+ 6e5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 6e8:	0f be c0             	movsbl %al,%eax
+ 6eb:	83 ec 08             	sub    $0x8,%esp
+ 6ee:	50                   	push   %eax
+ 6ef:	ff 75 08             	push   0x8(%ebp)
+ 6f2:	e8 ca fe ff ff       	call   5c1 <putc>
+ 6f7:	83 c4 10             	add    $0x10,%esp
+ 6fa:	e9 0d 01 00 00       	jmp    80c <printf+0x177>
+      }
+    } else if(state == '%'){
+ 6ff:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 703:	0f 85 03 01 00 00    	jne    80c <printf+0x177>
+      if(c == 'd'){
+ 709:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 70d:	75 1e                	jne    72d <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 70f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 712:	8b 00                	mov    (%eax),%eax
+ 714:	6a 01                	push   $0x1
+ 716:	6a 0a                	push   $0xa
+ 718:	50                   	push   %eax
+ 719:	ff 75 08             	push   0x8(%ebp)
+ 71c:	e8 c3 fe ff ff       	call   5e4 <printint>
+ 721:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 724:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 728:	e9 d8 00 00 00       	jmp    805 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 72d:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 731:	74 06                	je     739 <printf+0xa4>
+ 733:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 737:	75 1e                	jne    757 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 739:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 73c:	8b 00                	mov    (%eax),%eax
+ 73e:	6a 00                	push   $0x0
+ 740:	6a 10                	push   $0x10
+ 742:	50                   	push   %eax
+ 743:	ff 75 08             	push   0x8(%ebp)
+ 746:	e8 99 fe ff ff       	call   5e4 <printint>
+ 74b:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 74e:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 752:	e9 ae 00 00 00       	jmp    805 <printf+0x170>
+      } else if(c == 's'){
+ 757:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 75b:	75 43                	jne    7a0 <printf+0x10b>
+        s = (char*)*ap;
+ 75d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 760:	8b 00                	mov    (%eax),%eax
+ 762:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 765:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 769:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 76d:	75 25                	jne    794 <printf+0xff>
+          s = "(null)";
+ 76f:	c7 45 f4 38 10 00 00 	movl   $0x1038,-0xc(%ebp)
+        while(*s != 0){
+ 776:	eb 1c                	jmp    794 <printf+0xff>
+          putc(fd, *s);
+ 778:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 77b:	0f b6 00             	movzbl (%eax),%eax
+ 77e:	0f be c0             	movsbl %al,%eax
+ 781:	83 ec 08             	sub    $0x8,%esp
+ 784:	50                   	push   %eax
+ 785:	ff 75 08             	push   0x8(%ebp)
+ 788:	e8 34 fe ff ff       	call   5c1 <putc>
+ 78d:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 790:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 794:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 797:	0f b6 00             	movzbl (%eax),%eax
+ 79a:	84 c0                	test   %al,%al
+ 79c:	75 da                	jne    778 <printf+0xe3>
+ 79e:	eb 65                	jmp    805 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 7a0:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 7a4:	75 1d                	jne    7c3 <printf+0x12e>
+        putc(fd, *ap);
+ 7a6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7a9:	8b 00                	mov    (%eax),%eax
+ 7ab:	0f be c0             	movsbl %al,%eax
+ 7ae:	83 ec 08             	sub    $0x8,%esp
+ 7b1:	50                   	push   %eax
+ 7b2:	ff 75 08             	push   0x8(%ebp)
+ 7b5:	e8 07 fe ff ff       	call   5c1 <putc>
+ 7ba:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 7bd:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 7c1:	eb 42                	jmp    805 <printf+0x170>
+      } else if(c == '%'){
+ 7c3:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 7c7:	75 17                	jne    7e0 <printf+0x14b>
+        putc(fd, c);
+ 7c9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 7cc:	0f be c0             	movsbl %al,%eax
+ 7cf:	83 ec 08             	sub    $0x8,%esp
+ 7d2:	50                   	push   %eax
+ 7d3:	ff 75 08             	push   0x8(%ebp)
+ 7d6:	e8 e6 fd ff ff       	call   5c1 <putc>
+ 7db:	83 c4 10             	add    $0x10,%esp
+ 7de:	eb 25                	jmp    805 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 7e0:	83 ec 08             	sub    $0x8,%esp
+ 7e3:	6a 25                	push   $0x25
+ 7e5:	ff 75 08             	push   0x8(%ebp)
+ 7e8:	e8 d4 fd ff ff       	call   5c1 <putc>
+ 7ed:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 7f0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 7f3:	0f be c0             	movsbl %al,%eax
+ 7f6:	83 ec 08             	sub    $0x8,%esp
+ 7f9:	50                   	push   %eax
+ 7fa:	ff 75 08             	push   0x8(%ebp)
+ 7fd:	e8 bf fd ff ff       	call   5c1 <putc>
+ 802:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 805:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 80c:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 810:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 813:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 816:	01 d0                	add    %edx,%eax
+ 818:	0f b6 00             	movzbl (%eax),%eax
+ 81b:	84 c0                	test   %al,%al
+ 81d:	0f 85 94 fe ff ff    	jne    6b7 <printf+0x22>
+    }
+  }
+}
+ 823:	90                   	nop
+ 824:	90                   	nop
+ 825:	c9                   	leave
+ 826:	c3                   	ret
+
+00000827 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 827:	55                   	push   %ebp
+ 828:	89 e5                	mov    %esp,%ebp
+ 82a:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 82d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 830:	83 e8 08             	sub    $0x8,%eax
+ 833:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 836:	a1 28 22 00 00       	mov    0x2228,%eax
+ 83b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 83e:	eb 24                	jmp    864 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 840:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 843:	8b 00                	mov    (%eax),%eax
+ 845:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 848:	72 12                	jb     85c <free+0x35>
+ 84a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 84d:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 850:	72 24                	jb     876 <free+0x4f>
+ 852:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 855:	8b 00                	mov    (%eax),%eax
+ 857:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 85a:	72 1a                	jb     876 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 85c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 85f:	8b 00                	mov    (%eax),%eax
+ 861:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 864:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 867:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 86a:	73 d4                	jae    840 <free+0x19>
+ 86c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 86f:	8b 00                	mov    (%eax),%eax
+ 871:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 874:	73 ca                	jae    840 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 876:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 879:	8b 40 04             	mov    0x4(%eax),%eax
+ 87c:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 883:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 886:	01 c2                	add    %eax,%edx
+ 888:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 88b:	8b 00                	mov    (%eax),%eax
+ 88d:	39 c2                	cmp    %eax,%edx
+ 88f:	75 24                	jne    8b5 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 891:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 894:	8b 50 04             	mov    0x4(%eax),%edx
+ 897:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 89a:	8b 00                	mov    (%eax),%eax
+ 89c:	8b 40 04             	mov    0x4(%eax),%eax
+ 89f:	01 c2                	add    %eax,%edx
+ 8a1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8a4:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8a7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8aa:	8b 00                	mov    (%eax),%eax
+ 8ac:	8b 10                	mov    (%eax),%edx
+ 8ae:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8b1:	89 10                	mov    %edx,(%eax)
+ 8b3:	eb 0a                	jmp    8bf <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 8b5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8b8:	8b 10                	mov    (%eax),%edx
+ 8ba:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8bd:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 8bf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8c2:	8b 40 04             	mov    0x4(%eax),%eax
+ 8c5:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 8cc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8cf:	01 d0                	add    %edx,%eax
+ 8d1:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 8d4:	75 20                	jne    8f6 <free+0xcf>
+    p->s.size += bp->s.size;
+ 8d6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8d9:	8b 50 04             	mov    0x4(%eax),%edx
+ 8dc:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8df:	8b 40 04             	mov    0x4(%eax),%eax
+ 8e2:	01 c2                	add    %eax,%edx
+ 8e4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8e7:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 8ea:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8ed:	8b 10                	mov    (%eax),%edx
+ 8ef:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8f2:	89 10                	mov    %edx,(%eax)
+ 8f4:	eb 08                	jmp    8fe <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 8f6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8f9:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 8fc:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 8fe:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 901:	a3 28 22 00 00       	mov    %eax,0x2228
+}
+ 906:	90                   	nop
+ 907:	c9                   	leave
+ 908:	c3                   	ret
+
+00000909 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 909:	55                   	push   %ebp
+ 90a:	89 e5                	mov    %esp,%ebp
+ 90c:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 90f:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 916:	77 07                	ja     91f <morecore+0x16>
+    nu = 4096;
+ 918:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 91f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 922:	c1 e0 03             	shl    $0x3,%eax
+ 925:	83 ec 0c             	sub    $0xc,%esp
+ 928:	50                   	push   %eax
+ 929:	e8 4b fc ff ff       	call   579 <sbrk>
+ 92e:	83 c4 10             	add    $0x10,%esp
+ 931:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 934:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 938:	75 07                	jne    941 <morecore+0x38>
+    return 0;
+ 93a:	b8 00 00 00 00       	mov    $0x0,%eax
+ 93f:	eb 26                	jmp    967 <morecore+0x5e>
+  hp = (Header*)p;
+ 941:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 944:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 947:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 94a:	8b 55 08             	mov    0x8(%ebp),%edx
+ 94d:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 950:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 953:	83 c0 08             	add    $0x8,%eax
+ 956:	83 ec 0c             	sub    $0xc,%esp
+ 959:	50                   	push   %eax
+ 95a:	e8 c8 fe ff ff       	call   827 <free>
+ 95f:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 962:	a1 28 22 00 00       	mov    0x2228,%eax
+}
+ 967:	c9                   	leave
+ 968:	c3                   	ret
+
+00000969 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 969:	55                   	push   %ebp
+ 96a:	89 e5                	mov    %esp,%ebp
+ 96c:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 96f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 972:	83 c0 07             	add    $0x7,%eax
+ 975:	c1 e8 03             	shr    $0x3,%eax
+ 978:	83 c0 01             	add    $0x1,%eax
+ 97b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 97e:	a1 28 22 00 00       	mov    0x2228,%eax
+ 983:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 986:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 98a:	75 23                	jne    9af <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 98c:	c7 45 f0 20 22 00 00 	movl   $0x2220,-0x10(%ebp)
+ 993:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 996:	a3 28 22 00 00       	mov    %eax,0x2228
+ 99b:	a1 28 22 00 00       	mov    0x2228,%eax
+ 9a0:	a3 20 22 00 00       	mov    %eax,0x2220
+    base.s.size = 0;
+ 9a5:	c7 05 24 22 00 00 00 	movl   $0x0,0x2224
+ 9ac:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9af:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9b2:	8b 00                	mov    (%eax),%eax
+ 9b4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 9b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9ba:	8b 40 04             	mov    0x4(%eax),%eax
+ 9bd:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 9c0:	72 4d                	jb     a0f <malloc+0xa6>
+      if(p->s.size == nunits)
+ 9c2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9c5:	8b 40 04             	mov    0x4(%eax),%eax
+ 9c8:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 9cb:	75 0c                	jne    9d9 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 9cd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9d0:	8b 10                	mov    (%eax),%edx
+ 9d2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9d5:	89 10                	mov    %edx,(%eax)
+ 9d7:	eb 26                	jmp    9ff <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 9d9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9dc:	8b 40 04             	mov    0x4(%eax),%eax
+ 9df:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 9e2:	89 c2                	mov    %eax,%edx
+ 9e4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9e7:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 9ea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9ed:	8b 40 04             	mov    0x4(%eax),%eax
+ 9f0:	c1 e0 03             	shl    $0x3,%eax
+ 9f3:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 9f6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9f9:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 9fc:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 9ff:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a02:	a3 28 22 00 00       	mov    %eax,0x2228
+      return (void*)(p + 1);
+ a07:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a0a:	83 c0 08             	add    $0x8,%eax
+ a0d:	eb 3b                	jmp    a4a <malloc+0xe1>
+    }
+    if(p == freep)
+ a0f:	a1 28 22 00 00       	mov    0x2228,%eax
+ a14:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ a17:	75 1e                	jne    a37 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ a19:	83 ec 0c             	sub    $0xc,%esp
+ a1c:	ff 75 ec             	push   -0x14(%ebp)
+ a1f:	e8 e5 fe ff ff       	call   909 <morecore>
+ a24:	83 c4 10             	add    $0x10,%esp
+ a27:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ a2a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a2e:	75 07                	jne    a37 <malloc+0xce>
+        return 0;
+ a30:	b8 00 00 00 00       	mov    $0x0,%eax
+ a35:	eb 13                	jmp    a4a <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a37:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a3a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ a3d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a40:	8b 00                	mov    (%eax),%eax
+ a42:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ a45:	e9 6d ff ff ff       	jmp    9b7 <malloc+0x4e>
+  }
+}
+ a4a:	c9                   	leave
+ a4b:	c3                   	ret
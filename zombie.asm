@@ -0,0 +1,1227 @@
+
+_zombie:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 04             	sub    $0x4,%esp
+  if(fork() > 0)
+  11:	e8 42 03 00 00       	call   358 <fork>
+  16:	85 c0                	test   %eax,%eax
+  18:	7e 0d                	jle    27 <main+0x27>
+    sleep(5);  // Let child exit before parent.
+  1a:	83 ec 0c             	sub    $0xc,%esp
+  1d:	6a 05                	push   $0x5
+  1f:	e8 cc 03 00 00       	call   3f0 <sleep>
+  24:	83 c4 10             	add    $0x10,%esp
+  exit();
+  27:	e8 34 03 00 00       	call   360 <exit>
+
+0000002c <stosb>:
+{
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+  2c:	55                   	push   %ebp
+  2d:	89 e5                	mov    %esp,%ebp
+  2f:	57                   	push   %edi
+  30:	53                   	push   %ebx
+    if(cc < 1)
+  31:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  34:	8b 55 10             	mov    0x10(%ebp),%edx
+  37:	8b 45 0c             	mov    0xc(%ebp),%eax
+  3a:	89 cb                	mov    %ecx,%ebx
+  3c:	89 df                	mov    %ebx,%edi
+  3e:	89 d1                	mov    %edx,%ecx
+  40:	fc                   	cld
+  41:	f3 aa                	rep stos %al,%es:(%edi)
+  43:	89 ca                	mov    %ecx,%edx
+  45:	89 fb                	mov    %edi,%ebx
+  47:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  4a:	89 55 10             	mov    %edx,0x10(%ebp)
+      break;
+    buf[i++] = c;
+    if(c == '\n' || c == '\r')
+      break;
+  4d:	90                   	nop
+  4e:	5b                   	pop    %ebx
+  4f:	5f                   	pop    %edi
+  50:	5d                   	pop    %ebp
+  51:	c3                   	ret
+
+00000052 <strcpy>:
+{
+  52:	55                   	push   %ebp
+  53:	89 e5                	mov    %esp,%ebp
+  55:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+  58:	8b 45 08             	mov    0x8(%ebp),%eax
+  5b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+  5e:	90                   	nop
+  5f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  62:	8d 42 01             	lea    0x1(%edx),%eax
+  65:	89 45 0c             	mov    %eax,0xc(%ebp)
+  68:	8b 45 08             	mov    0x8(%ebp),%eax
+  6b:	8d 48 01             	lea    0x1(%eax),%ecx
+  6e:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  71:	0f b6 12             	movzbl (%edx),%edx
+  74:	88 10                	mov    %dl,(%eax)
+  76:	0f b6 00             	movzbl (%eax),%eax
+  79:	84 c0                	test   %al,%al
+  7b:	75 e2                	jne    5f <strcpy+0xd>
+  return os;
+  7d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  80:	c9                   	leave
+  81:	c3                   	ret
+
+00000082 <strcmp>:
+{
+  82:	55                   	push   %ebp
+  83:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+  85:	eb 08                	jmp    8f <strcmp+0xd>
+    p++, q++;
+  87:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  8b:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+  8f:	8b 45 08             	mov    0x8(%ebp),%eax
+  92:	0f b6 00             	movzbl (%eax),%eax
+  95:	84 c0                	test   %al,%al
+  97:	74 10                	je     a9 <strcmp+0x27>
+  99:	8b 45 08             	mov    0x8(%ebp),%eax
+  9c:	0f b6 10             	movzbl (%eax),%edx
+  9f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  a2:	0f b6 00             	movzbl (%eax),%eax
+  a5:	38 c2                	cmp    %al,%dl
+  a7:	74 de                	je     87 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+  a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  ac:	0f b6 00             	movzbl (%eax),%eax
+  af:	0f b6 d0             	movzbl %al,%edx
+  b2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b5:	0f b6 00             	movzbl (%eax),%eax
+  b8:	0f b6 c0             	movzbl %al,%eax
+  bb:	29 c2                	sub    %eax,%edx
+  bd:	89 d0                	mov    %edx,%eax
+}
+  bf:	5d                   	pop    %ebp
+  c0:	c3                   	ret
+
+000000c1 <strlen>:
+{
+  c1:	55                   	push   %ebp
+  c2:	89 e5                	mov    %esp,%ebp
+  c4:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+  c7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  ce:	eb 04                	jmp    d4 <strlen+0x13>
+  d0:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+  d4:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  da:	01 d0                	add    %edx,%eax
+  dc:	0f b6 00             	movzbl (%eax),%eax
+  df:	84 c0                	test   %al,%al
+  e1:	75 ed                	jne    d0 <strlen+0xf>
+  return n;
+  e3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  e6:	c9                   	leave
+  e7:	c3                   	ret
+
+000000e8 <memset>:
+{
+  e8:	55                   	push   %ebp
+  e9:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+  eb:	8b 45 10             	mov    0x10(%ebp),%eax
+  ee:	50                   	push   %eax
+  ef:	ff 75 0c             	push   0xc(%ebp)
+  f2:	ff 75 08             	push   0x8(%ebp)
+  f5:	e8 32 ff ff ff       	call   2c <stosb>
+  fa:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+  fd:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 100:	c9                   	leave
+ 101:	c3                   	ret
+
+00000102 <strchr>:
+{
+ 102:	55                   	push   %ebp
+ 103:	89 e5                	mov    %esp,%ebp
+ 105:	83 ec 04             	sub    $0x4,%esp
+ 108:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 10b:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 10e:	eb 14                	jmp    124 <strchr+0x22>
+    if(*s == c)
+ 110:	8b 45 08             	mov    0x8(%ebp),%eax
+ 113:	0f b6 00             	movzbl (%eax),%eax
+ 116:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 119:	75 05                	jne    120 <strchr+0x1e>
+      return (char*)s;
+ 11b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 11e:	eb 13                	jmp    133 <strchr+0x31>
+  for(; *s; s++)
+ 120:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 124:	8b 45 08             	mov    0x8(%ebp),%eax
+ 127:	0f b6 00             	movzbl (%eax),%eax
+ 12a:	84 c0                	test   %al,%al
+ 12c:	75 e2                	jne    110 <strchr+0xe>
+  return 0;
+ 12e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 133:	c9                   	leave
+ 134:	c3                   	ret
+
+00000135 <gets>:
+{
+ 135:	55                   	push   %ebp
+ 136:	89 e5                	mov    %esp,%ebp
+ 138:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 13b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 142:	eb 42                	jmp    186 <gets+0x51>
+    cc = read(0, &c, 1);
+ 144:	83 ec 04             	sub    $0x4,%esp
+ 147:	6a 01                	push   $0x1
+ 149:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 14c:	50                   	push   %eax
+ 14d:	6a 00                	push   $0x0
+ 14f:	e8 24 02 00 00       	call   378 <read>
+ 154:	83 c4 10             	add    $0x10,%esp
+ 157:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 15a:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 15e:	7e 33                	jle    193 <gets+0x5e>
+    buf[i++] = c;
+ 160:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 163:	8d 50 01             	lea    0x1(%eax),%edx
+ 166:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 169:	89 c2                	mov    %eax,%edx
+ 16b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 16e:	01 c2                	add    %eax,%edx
+ 170:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 174:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 176:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 17a:	3c 0a                	cmp    $0xa,%al
+ 17c:	74 16                	je     194 <gets+0x5f>
+ 17e:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 182:	3c 0d                	cmp    $0xd,%al
+ 184:	74 0e                	je     194 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 186:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 189:	83 c0 01             	add    $0x1,%eax
+ 18c:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 18f:	7f b3                	jg     144 <gets+0xf>
+ 191:	eb 01                	jmp    194 <gets+0x5f>
+      break;
+ 193:	90                   	nop
+  }
+  buf[i] = '\0';
+ 194:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 197:	8b 45 08             	mov    0x8(%ebp),%eax
+ 19a:	01 d0                	add    %edx,%eax
+ 19c:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 19f:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1a2:	c9                   	leave
+ 1a3:	c3                   	ret
+
+000001a4 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 1a4:	55                   	push   %ebp
+ 1a5:	89 e5                	mov    %esp,%ebp
+ 1a7:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1aa:	83 ec 08             	sub    $0x8,%esp
+ 1ad:	6a 00                	push   $0x0
+ 1af:	ff 75 08             	push   0x8(%ebp)
+ 1b2:	e8 e9 01 00 00       	call   3a0 <open>
+ 1b7:	83 c4 10             	add    $0x10,%esp
+ 1ba:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 1bd:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 1c1:	79 07                	jns    1ca <stat+0x26>
+    return -1;
+ 1c3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 1c8:	eb 25                	jmp    1ef <stat+0x4b>
+  r = fstat(fd, st);
+ 1ca:	83 ec 08             	sub    $0x8,%esp
+ 1cd:	ff 75 0c             	push   0xc(%ebp)
+ 1d0:	ff 75 f4             	push   -0xc(%ebp)
+ 1d3:	e8 e0 01 00 00       	call   3b8 <fstat>
+ 1d8:	83 c4 10             	add    $0x10,%esp
+ 1db:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 1de:	83 ec 0c             	sub    $0xc,%esp
+ 1e1:	ff 75 f4             	push   -0xc(%ebp)
+ 1e4:	e8 9f 01 00 00       	call   388 <close>
+ 1e9:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 1ec:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 1ef:	c9                   	leave
+ 1f0:	c3                   	ret
+
+000001f1 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 1f1:	55                   	push   %ebp
+ 1f2:	89 e5                	mov    %esp,%ebp
+ 1f4:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 1f7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 1fe:	eb 25                	jmp    225 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 200:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 203:	89 d0                	mov    %edx,%eax
+ 205:	c1 e0 02             	shl    $0x2,%eax
+ 208:	01 d0                	add    %edx,%eax
+ 20a:	01 c0                	add    %eax,%eax
+ 20c:	89 c1                	mov    %eax,%ecx
+ 20e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 211:	8d 50 01             	lea    0x1(%eax),%edx
+ 214:	89 55 08             	mov    %edx,0x8(%ebp)
+ 217:	0f b6 00             	movzbl (%eax),%eax
+ 21a:	0f be c0             	movsbl %al,%eax
+ 21d:	01 c8                	add    %ecx,%eax
+ 21f:	83 e8 30             	sub    $0x30,%eax
+ 222:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 225:	8b 45 08             	mov    0x8(%ebp),%eax
+ 228:	0f b6 00             	movzbl (%eax),%eax
+ 22b:	3c 2f                	cmp    $0x2f,%al
+ 22d:	7e 0a                	jle    239 <atoi+0x48>
+ 22f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 232:	0f b6 00             	movzbl (%eax),%eax
+ 235:	3c 39                	cmp    $0x39,%al
+ 237:	7e c7                	jle    200 <atoi+0xf>
+  return n;
+ 239:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 23c:	c9                   	leave
+ 23d:	c3                   	ret
+
+0000023e <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 23e:	55                   	push   %ebp
+ 23f:	89 e5                	mov    %esp,%ebp
+ 241:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+
+  dst = vdst;
+ 244:	8b 45 08             	mov    0x8(%ebp),%eax
+ 247:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 24a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 24d:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 250:	eb 17                	jmp    269 <memmove+0x2b>
+    *dst++ = *src++;
+ 252:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 255:	8d 42 01             	lea    0x1(%edx),%eax
+ 258:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 25b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 25e:	8d 48 01             	lea    0x1(%eax),%ecx
+ 261:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 264:	0f b6 12             	movzbl (%edx),%edx
+ 267:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 269:	8b 45 10             	mov    0x10(%ebp),%eax
+ 26c:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 26f:	89 55 10             	mov    %edx,0x10(%ebp)
+ 272:	85 c0                	test   %eax,%eax
+ 274:	7f dc                	jg     252 <memmove+0x14>
+  return vdst;
+ 276:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 279:	c9                   	leave
+ 27a:	c3                   	ret
+
+0000027b <opendir>:
+    int fd;
+    int child;
+} DIR;
+
+DIR* opendir(const char* name)
+{
+ 27b:	55                   	push   %ebp
+ 27c:	89 e5                	mov    %esp,%ebp
+ 27e:	83 ec 18             	sub    $0x18,%esp
+    DIR* dp = malloc(sizeof(*dp));
+ 281:	83 ec 0c             	sub    $0xc,%esp
+ 284:	6a 08                	push   $0x8
+ 286:	e8 4d 05 00 00       	call   7d8 <malloc>
+ 28b:	83 c4 10             	add    $0x10,%esp
+ 28e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+    dp->fd = open((char*)name, 0);
+ 291:	83 ec 08             	sub    $0x8,%esp
+ 294:	6a 00                	push   $0x0
+ 296:	ff 75 08             	push   0x8(%ebp)
+ 299:	e8 02 01 00 00       	call   3a0 <open>
+ 29e:	83 c4 10             	add    $0x10,%esp
+ 2a1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 2a4:	89 02                	mov    %eax,(%edx)
+    dp->child = 0;
+ 2a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2a9:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+
+    return dp;
+ 2b0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 2b3:	c9                   	leave
+ 2b4:	c3                   	ret
+
+000002b5 <closedir>:
+
+void closedir(DIR* dp)
+{
+ 2b5:	55                   	push   %ebp
+ 2b6:	89 e5                	mov    %esp,%ebp
+ 2b8:	83 ec 08             	sub    $0x8,%esp
+    if(dp == 0) {
+ 2bb:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 2bf:	74 21                	je     2e2 <closedir+0x2d>
+        return;
+    }
+
+    close(dp->fd);
+ 2c1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c4:	8b 00                	mov    (%eax),%eax
+ 2c6:	83 ec 0c             	sub    $0xc,%esp
+ 2c9:	50                   	push   %eax
+ 2ca:	e8 b9 00 00 00       	call   388 <close>
+ 2cf:	83 c4 10             	add    $0x10,%esp
+    free(dp);
+ 2d2:	83 ec 0c             	sub    $0xc,%esp
+ 2d5:	ff 75 08             	push   0x8(%ebp)
+ 2d8:	e8 b9 03 00 00       	call   696 <free>
+ 2dd:	83 c4 10             	add    $0x10,%esp
+ 2e0:	eb 01                	jmp    2e3 <closedir+0x2e>
+        return;
+ 2e2:	90                   	nop
+}
+ 2e3:	c9                   	leave
+ 2e4:	c3                   	ret
+
+000002e5 <readdir>:
+
+struct dirent* readdir(DIR* dp)
+{
+ 2e5:	55                   	push   %ebp
+ 2e6:	89 e5                	mov    %esp,%ebp
+ 2e8:	83 ec 18             	sub    $0x18,%esp
+    if(dp == 0) {
+ 2eb:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 2ef:	75 07                	jne    2f8 <readdir+0x13>
+      return 0;
+ 2f1:	b8 00 00 00 00       	mov    $0x0,%eax
+ 2f6:	eb 5e                	jmp    356 <readdir+0x71>
+    }
+
+    struct dirent* de = malloc(sizeof(*de));
+ 2f8:	83 ec 0c             	sub    $0xc,%esp
+ 2fb:	68 0c 01 00 00       	push   $0x10c
+ 300:	e8 d3 04 00 00       	call   7d8 <malloc>
+ 305:	83 c4 10             	add    $0x10,%esp
+ 308:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    int res = direntry(dp->fd, dp->child, de);
+ 30b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 30e:	8b 50 04             	mov    0x4(%eax),%edx
+ 311:	8b 45 08             	mov    0x8(%ebp),%eax
+ 314:	8b 00                	mov    (%eax),%eax
+ 316:	83 ec 04             	sub    $0x4,%esp
+ 319:	ff 75 f4             	push   -0xc(%ebp)
+ 31c:	52                   	push   %edx
+ 31d:	50                   	push   %eax
+ 31e:	e8 e5 00 00 00       	call   408 <direntry>
+ 323:	83 c4 10             	add    $0x10,%esp
+ 326:	89 45 f0             	mov    %eax,-0x10(%ebp)
+
+    // out of children or other error
+    if(res == -1) {
+ 329:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+ 32d:	75 15                	jne    344 <readdir+0x5f>
+        free(de);
+ 32f:	83 ec 0c             	sub    $0xc,%esp
+ 332:	ff 75 f4             	push   -0xc(%ebp)
+ 335:	e8 5c 03 00 00       	call   696 <free>
+ 33a:	83 c4 10             	add    $0x10,%esp
+        return 0;
+ 33d:	b8 00 00 00 00       	mov    $0x0,%eax
+ 342:	eb 12                	jmp    356 <readdir+0x71>
+    }
+
+    dp->child++;
+ 344:	8b 45 08             	mov    0x8(%ebp),%eax
+ 347:	8b 40 04             	mov    0x4(%eax),%eax
+ 34a:	8d 50 01             	lea    0x1(%eax),%edx
+ 34d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 350:	89 50 04             	mov    %edx,0x4(%eax)
+    return de;
+ 353:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 356:	c9                   	leave
+ 357:	c3                   	ret
+
+00000358 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 358:	b8 01 00 00 00       	mov    $0x1,%eax
+ 35d:	cd 40                	int    $0x40
+ 35f:	c3                   	ret
+
+00000360 <exit>:
+SYSCALL(exit)
+ 360:	b8 02 00 00 00       	mov    $0x2,%eax
+ 365:	cd 40                	int    $0x40
+ 367:	c3                   	ret
+
+00000368 <wait>:
+SYSCALL(wait)
+ 368:	b8 03 00 00 00       	mov    $0x3,%eax
+ 36d:	cd 40                	int    $0x40
+ 36f:	c3                   	ret
+
+00000370 <pipe>:
+SYSCALL(pipe)
+ 370:	b8 04 00 00 00       	mov    $0x4,%eax
+ 375:	cd 40                	int    $0x40
+ 377:	c3                   	ret
+
+00000378 <read>:
+SYSCALL(read)
+ 378:	b8 05 00 00 00       	mov    $0x5,%eax
+ 37d:	cd 40                	int    $0x40
+ 37f:	c3                   	ret
+
+00000380 <write>:
+SYSCALL(write)
+ 380:	b8 10 00 00 00       	mov    $0x10,%eax
+ 385:	cd 40                	int    $0x40
+ 387:	c3                   	ret
+
+00000388 <close>:
+SYSCALL(close)
+ 388:	b8 15 00 00 00       	mov    $0x15,%eax
+ 38d:	cd 40                	int    $0x40
+ 38f:	c3                   	ret
+
+00000390 <kill>:
+SYSCALL(kill)
+ 390:	b8 06 00 00 00       	mov    $0x6,%eax
+ 395:	cd 40                	int    $0x40
+ 397:	c3                   	ret
+
+00000398 <exec>:
+SYSCALL(exec)
+ 398:	b8 07 00 00 00       	mov    $0x7,%eax
+ 39d:	cd 40                	int    $0x40
+ 39f:	c3                   	ret
+
+000003a0 <open>:
+SYSCALL(open)
+ 3a0:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3a5:	cd 40                	int    $0x40
+ 3a7:	c3                   	ret
+
+000003a8 <mknod>:
+SYSCALL(mknod)
+ 3a8:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3ad:	cd 40                	int    $0x40
+ 3af:	c3                   	ret
+
+000003b0 <unlink>:
+SYSCALL(unlink)
+ 3b0:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3b5:	cd 40                	int    $0x40
+ 3b7:	c3                   	ret
+
+000003b8 <fstat>:
+SYSCALL(fstat)
+ 3b8:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3bd:	cd 40                	int    $0x40
+ 3bf:	c3                   	ret
+
+000003c0 <link>:
+SYSCALL(link)
+ 3c0:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3c5:	cd 40                	int    $0x40
+ 3c7:	c3                   	ret
+
+000003c8 <mkdir>:
+SYSCALL(mkdir)
+ 3c8:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3cd:	cd 40                	int    $0x40
+ 3cf:	c3                   	ret
+
+000003d0 <chdir>:
+SYSCALL(chdir)
+ 3d0:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3d5:	cd 40                	int    $0x40
+ 3d7:	c3                   	ret
+
+000003d8 <dup>:
+SYSCALL(dup)
+ 3d8:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3dd:	cd 40                	int    $0x40
+ 3df:	c3                   	ret
+
+000003e0 <getpid>:
+SYSCALL(getpid)
+ 3e0:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3e5:	cd 40                	int    $0x40
+ 3e7:	c3                   	ret
+
+000003e8 <sbrk>:
+SYSCALL(sbrk)
+ 3e8:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3ed:	cd 40                	int    $0x40
+ 3ef:	c3                   	ret
+
+000003f0 <sleep>:
+SYSCALL(sleep)
+ 3f0:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3f5:	cd 40                	int    $0x40
+ 3f7:	c3                   	ret
+
+000003f8 <uptime>:
+SYSCALL(uptime)
+ 3f8:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3fd:	cd 40                	int    $0x40
+ 3ff:	c3                   	ret
+
+00000400 <mount>:
+SYSCALL(mount)
+ 400:	b8 16 00 00 00       	mov    $0x16,%eax
+ 405:	cd 40                	int    $0x40
+ 407:	c3                   	ret
+
+00000408 <direntry>:
+SYSCALL(direntry)
+ 408:	b8 17 00 00 00       	mov    $0x17,%eax
+ 40d:	cd 40                	int    $0x40
+ 40f:	c3                   	ret
+
+00000410 <sync>:
+SYSCALL(sync)
+ 410:	b8 18 00 00 00       	mov    $0x18,%eax
+ 415:	cd 40                	int    $0x40
+ 417:	c3                   	ret
+
+00000418 <fsync>:
+SYSCALL(fsync)
+ 418:	b8 19 00 00 00       	mov    $0x19,%eax
+ 41d:	cd 40                	int    $0x40
+ 41f:	c3                   	ret
+
+00000420 <mmap>:
+SYSCALL(mmap)
+ 420:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 425:	cd 40                	int    $0x40
+ 427:	c3                   	ret
+
+00000428 <munmap>:
+SYSCALL(munmap)
+ 428:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 42d:	cd 40                	int    $0x40
+ 42f:	c3                   	ret
+
+00000430 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	83 ec 18             	sub    $0x18,%esp
+ 436:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 439:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 43c:	83 ec 04             	sub    $0x4,%esp
+ 43f:	6a 01                	push   $0x1
+ 441:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 444:	50                   	push   %eax
+ 445:	ff 75 08             	push   0x8(%ebp)
+ 448:	e8 33 ff ff ff       	call   380 <write>
+ 44d:	83 c4 10             	add    $0x10,%esp
+}
+ 450:	90                   	nop
+ 451:	c9                   	leave
+ 452:	c3                   	ret
+
+00000453 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 453:	55                   	push   %ebp
+ 454:	89 e5                	mov    %esp,%ebp
+ 456:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 459:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 460:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 464:	74 17                	je     47d <printint+0x2a>
+ 466:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 46a:	79 11                	jns    47d <printint+0x2a>
+    neg = 1;
+ 46c:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 473:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 476:	f7 d8                	neg    %eax
+ 478:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 47b:	eb 06                	jmp    483 <printint+0x30>
+  } else {
+    x = xx;
+ 47d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 480:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 483:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 48a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 48d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 490:	ba 00 00 00 00       	mov    $0x0,%edx
+ 495:	f7 f1                	div    %ecx
+ 497:	89 d1                	mov    %edx,%ecx
+ 499:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 49c:	8d 50 01             	lea    0x1(%eax),%edx
+ 49f:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 4a2:	0f b6 91 00 20 00 00 	movzbl 0x2000(%ecx),%edx
+ 4a9:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 4ad:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 4b0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 4b3:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4b8:	f7 f1                	div    %ecx
+ 4ba:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 4bd:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 4c1:	75 c7                	jne    48a <printint+0x37>
+  if(neg)
+ 4c3:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 4c7:	74 2d                	je     4f6 <printint+0xa3>
+    buf[i++] = '-';
+ 4c9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4cc:	8d 50 01             	lea    0x1(%eax),%edx
+ 4cf:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 4d2:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 4d7:	eb 1d                	jmp    4f6 <printint+0xa3>
+    putc(fd, buf[i]);
+ 4d9:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 4dc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4df:	01 d0                	add    %edx,%eax
+ 4e1:	0f b6 00             	movzbl (%eax),%eax
+ 4e4:	0f be c0             	movsbl %al,%eax
+ 4e7:	83 ec 08             	sub    $0x8,%esp
+ 4ea:	50                   	push   %eax
+ 4eb:	ff 75 08             	push   0x8(%ebp)
+ 4ee:	e8 3d ff ff ff       	call   430 <putc>
+ 4f3:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 4f6:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 4fa:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 4fe:	79 d9                	jns    4d9 <printint+0x86>
+}
+ 500:	90                   	nop
+ 501:	90                   	nop
+ 502:	c9                   	leave
+ 503:	c3                   	ret
+
+00000504 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 504:	55                   	push   %ebp
+ 505:	89 e5                	mov    %esp,%ebp
+ 507:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 50a:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 511:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 514:	83 c0 04             	add    $0x4,%eax
+ 517:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 51a:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 521:	e9 59 01 00 00       	jmp    67f <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 526:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 529:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 52c:	01 d0                	add    %edx,%eax
+ 52e:	0f b6 00             	movzbl (%eax),%eax
+ 531:	0f be c0             	movsbl %al,%eax
+ 534:	25 ff 00 00 00       	and    $0xff,%eax
+ 539:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 53c:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 540:	75 2c                	jne    56e <printf+0x6a>
+      if(c == '%'){
+ 542:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 546:	75 0c                	jne    554 <printf+0x50>
+        state = '%';
+ 548:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 54f:	e9 27 01 00 00       	jmp    67b <printf+0x177>
+      } else {
+        putc(fd, c);
+ 554:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 557:	0f be c0             	movsbl %al,%eax
+ 55a:	83 ec 08             	sub    $0x8,%esp
+ 55d:	50                   	push   %eax
+ 55e:	ff 75 08             	push   0x8(%ebp)
+ 561:	e8 ca fe ff ff       	call   430 <putc>
+ 566:	83 c4 10             	add    $0x10,%esp
+ 569:	e9 0d 01 00 00       	jmp    67b <printf+0x177>
+      }
+    } else if(state == '%'){
+ 56e:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 572:	0f 85 03 01 00 00    	jne    67b <printf+0x177>
+      if(c == 'd'){
+ 578:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 57c:	75 1e                	jne    59c <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 57e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 581:	8b 00                	mov    (%eax),%eax
+ 583:	6a 01                	push   $0x1
+ 585:	6a 0a                	push   $0xa
+ 587:	50                   	push   %eax
+ 588:	ff 75 08             	push   0x8(%ebp)
+ 58b:	e8 c3 fe ff ff       	call   453 <printint>
+ 590:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 593:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 597:	e9 d8 00 00 00       	jmp    674 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 59c:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 5a0:	74 06                	je     5a8 <printf+0xa4>
+ 5a2:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 5a6:	75 1e                	jne    5c6 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 5a8:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5ab:	8b 00                	mov    (%eax),%eax
+ 5ad:	6a 00                	push   $0x0
+ 5af:	6a 10                	push   $0x10
+ 5b1:	50                   	push   %eax
+ 5b2:	ff 75 08             	push   0x8(%ebp)
+ 5b5:	e8 99 fe ff ff       	call   453 <printint>
+ 5ba:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 5bd:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 5c1:	e9 ae 00 00 00       	jmp    674 <printf+0x170>
+      } else if(c == 's'){
+ 5c6:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 5ca:	75 43                	jne    60f <printf+0x10b>
+        s = (char*)*ap;
+ 5cc:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5cf:	8b 00                	mov    (%eax),%eax
+ 5d1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 5d4:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 5d8:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 5dc:	75 25                	jne    603 <printf+0xff>
+          s = "(null)";
+ 5de:	c7 45 f4 00 10 00 00 	movl   $0x1000,-0xc(%ebp)
+        while(*s != 0){
+ 5e5:	eb 1c                	jmp    603 <printf+0xff>
+          putc(fd, *s);
+ 5e7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5ea:	0f b6 00             	movzbl (%eax),%eax
+ 5ed:	0f be c0             	movsbl %al,%eax
+ 5f0:	83 ec 08             	sub    $0x8,%esp
+ 5f3:	50                   	push   %eax
+ 5f4:	ff 75 08             	push   0x8(%ebp)
+ 5f7:	e8 34 fe ff ff       	call   430 <putc>
+ 5fc:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 5ff:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 603:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 606:	0f b6 00             	movzbl (%eax),%eax
+ 609:	84 c0                	test   %al,%al
+ 60b:	75 da                	jne    5e7 <printf+0xe3>
+ 60d:	eb 65                	jmp    674 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 60f:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 613:	75 1d                	jne    632 <printf+0x12e>
+        putc(fd, *ap);
+ 615:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 618:	8b 00                	mov    (%eax),%eax
+ 61a:	0f be c0             	movsbl %al,%eax
+ 61d:	83 ec 08             	sub    $0x8,%esp
+ 620:	50                   	push   %eax
+ 621:	ff 75 08             	push   0x8(%ebp)
+ 624:	e8 07 fe ff ff       	call   430 <putc>
+ 629:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 62c:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 630:	eb 42                	jmp    674 <printf+0x170>
+      } else if(c == '%'){
+ 632:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 636:	75 17                	jne    64f <printf+0x14b>
+        putc(fd, c);
+ 638:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 63b:	0f be c0             	movsbl %al,%eax
+ 63e:	83 ec 08             	sub    $0x8,%esp
+ 641:	50                   	push   %eax
+ 642:	ff 75 08             	push   0x8(%ebp)
+ 645:	e8 e6 fd ff ff       	call   430 <putc>
+ 64a:	83 c4 10             	add    $0x10,%esp
+ 64d:	eb 25                	jmp    674 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 64f:	83 ec 08             	sub    $0x8,%esp
+ 652:	6a 25                	push   $0x25
+ 654:	ff 75 08             	push   0x8(%ebp)
+ 657:	e8 d4 fd ff ff       	call   430 <putc>
+ 65c:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 65f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 662:	0f be c0             	movsbl %al,%eax
+ 665:	83 ec 08             	sub    $0x8,%esp
+ 668:	50                   	push   %eax
+ 669:	ff 75 08             	push   0x8(%ebp)
+ 66c:	e8 bf fd ff ff       	call   430 <putc>
+ 671:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 674:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 67b:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 67f:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 682:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 685:	01 d0                	add    %edx,%eax
+ 687:	0f b6 00             	movzbl (%eax),%eax
+ 68a:	84 c0                	test   %al,%al
+ 68c:	0f 85 94 fe ff ff    	jne    526 <printf+0x22>
+    }
+  }
+}
+ 692:	90                   	nop
+ 693:	90                   	nop
+ 694:	c9                   	leave
+ 695:	c3                   	ret
+
+00000696 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 696:	55                   	push   %ebp
+ 697:	89 e5                	mov    %esp,%ebp
+ 699:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 69c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 69f:	83 e8 08             	sub    $0x8,%eax
+ 6a2:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6a5:	a1 1c 20 00 00       	mov    0x201c,%eax
+ 6aa:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 6ad:	eb 24                	jmp    6d3 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6af:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6b2:	8b 00                	mov    (%eax),%eax
+ 6b4:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 6b7:	72 12                	jb     6cb <free+0x35>
+ 6b9:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6bc:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 6bf:	72 24                	jb     6e5 <free+0x4f>
+ 6c1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6c4:	8b 00                	mov    (%eax),%eax
+ 6c6:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 6c9:	72 1a                	jb     6e5 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6cb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6ce:	8b 00                	mov    (%eax),%eax
+ 6d0:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 6d3:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6d6:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 6d9:	73 d4                	jae    6af <free+0x19>
+ 6db:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6de:	8b 00                	mov    (%eax),%eax
+ 6e0:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 6e3:	73 ca                	jae    6af <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 6e5:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6e8:	8b 40 04             	mov    0x4(%eax),%eax
+ 6eb:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 6f2:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6f5:	01 c2                	add    %eax,%edx
+ 6f7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6fa:	8b 00                	mov    (%eax),%eax
+ 6fc:	39 c2                	cmp    %eax,%edx
+ 6fe:	75 24                	jne    724 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 700:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 703:	8b 50 04             	mov    0x4(%eax),%edx
+ 706:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 709:	8b 00                	mov    (%eax),%eax
+ 70b:	8b 40 04             	mov    0x4(%eax),%eax
+ 70e:	01 c2                	add    %eax,%edx
+ 710:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 713:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 716:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 719:	8b 00                	mov    (%eax),%eax
+ 71b:	8b 10                	mov    (%eax),%edx
+ 71d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 720:	89 10                	mov    %edx,(%eax)
+ 722:	eb 0a                	jmp    72e <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 724:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 727:	8b 10                	mov    (%eax),%edx
+ 729:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 72c:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 72e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 731:	8b 40 04             	mov    0x4(%eax),%eax
+ 734:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 73b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 73e:	01 d0                	add    %edx,%eax
+ 740:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 743:	75 20                	jne    765 <free+0xcf>
+    p->s.size += bp->s.size;
+ 745:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 748:	8b 50 04             	mov    0x4(%eax),%edx
+ 74b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 74e:	8b 40 04             	mov    0x4(%eax),%eax
+ 751:	01 c2                	add    %eax,%edx
+ 753:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 756:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 759:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 75c:	8b 10                	mov    (%eax),%edx
+ 75e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 761:	89 10                	mov    %edx,(%eax)
+ 763:	eb 08                	jmp    76d <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 765:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 768:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 76b:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 76d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 770:	a3 1c 20 00 00       	mov    %eax,0x201c
+}
+ 775:	90                   	nop
+ 776:	c9                   	leave
+ 777:	c3                   	ret
+
+00000778 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 778:	55                   	push   %ebp
+ 779:	89 e5                	mov    %esp,%ebp
+ 77b:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 77e:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 785:	77 07                	ja     78e <morecore+0x16>
+    nu = 4096;
+ 787:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 78e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 791:	c1 e0 03             	shl    $0x3,%eax
+ 794:	83 ec 0c             	sub    $0xc,%esp
+ 797:	50                   	push   %eax
+ 798:	e8 4b fc ff ff       	call   3e8 <sbrk>
+ 79d:	83 c4 10             	add    $0x10,%esp
+ 7a0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 7a3:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 7a7:	75 07                	jne    7b0 <morecore+0x38>
+    return 0;
+ 7a9:	b8 00 00 00 00       	mov    $0x0,%eax
+ 7ae:	eb 26                	jmp    7d6 <morecore+0x5e>
+  hp = (Header*)p;
+ 7b0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7b3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 7b6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7b9:	8b 55 08             	mov    0x8(%ebp),%edx
+ 7bc:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 7bf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7c2:	83 c0 08             	add    $0x8,%eax
+ 7c5:	83 ec 0c             	sub    $0xc,%esp
+ 7c8:	50                   	push   %eax
+ 7c9:	e8 c8 fe ff ff       	call   696 <free>
+ 7ce:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 7d1:	a1 1c 20 00 00       	mov    0x201c,%eax
+}
+ 7d6:	c9                   	leave
+ 7d7:	c3                   	ret
+
+000007d8 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 7d8:	55                   	push   %ebp
+ 7d9:	89 e5                	mov    %esp,%ebp
+ 7db:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 7de:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7e1:	83 c0 07             	add    $0x7,%eax
+ 7e4:	c1 e8 03             	shr    $0x3,%eax
+ 7e7:	83 c0 01             	add    $0x1,%eax
+ 7ea:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 7ed:	a1 1c 20 00 00       	mov    0x201c,%eax
+ 7f2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 7f5:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 7f9:	75 23                	jne    81e <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 7fb:	c7 45 f0 14 20 00 00 	movl   $0x2014,-0x10(%ebp)
+ 802:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 805:	a3 1c 20 00 00       	mov    %eax,0x201c
+ 80a:	a1 1c 20 00 00       	mov    0x201c,%eax
+ 80f:	a3 14 20 00 00       	mov    %eax,0x2014
+    base.s.size = 0;
+ 814:	c7 05 18 20 00 00 00 	movl   $0x0,0x2018
+ 81b:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 81e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 821:	8b 00                	mov    (%eax),%eax
+ 823:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 826:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 829:	8b 40 04             	mov    0x4(%eax),%eax
+ 82c:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 82f:	72 4d                	jb     87e <malloc+0xa6>
+      if(p->s.size == nunits)
+ 831:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 834:	8b 40 04             	mov    0x4(%eax),%eax
+ 837:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 83a:	75 0c                	jne    848 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 83c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 83f:	8b 10                	mov    (%eax),%edx
+ 841:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 844:	89 10                	mov    %edx,(%eax)
+ 846:	eb 26                	jmp    86e <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 848:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 84b:	8b 40 04             	mov    0x4(%eax),%eax
+ 84e:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 851:	89 c2                	mov    %eax,%edx
+ 853:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 856:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 859:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 85c:	8b 40 04             	mov    0x4(%eax),%eax
+ 85f:	c1 e0 03             	shl    $0x3,%eax
+ 862:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 865:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 868:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 86b:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 86e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 871:	a3 1c 20 00 00       	mov    %eax,0x201c
+      return (void*)(p + 1);
+ 876:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 879:	83 c0 08             	add    $0x8,%eax
+ 87c:	eb 3b                	jmp    8b9 <malloc+0xe1>
+    }
+    if(p == freep)
+ 87e:	a1 1c 20 00 00       	mov    0x201c,%eax
+ 883:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 886:	75 1e                	jne    8a6 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 888:	83 ec 0c             	sub    $0xc,%esp
+ 88b:	ff 75 ec             	push   -0x14(%ebp)
+ 88e:	e8 e5 fe ff ff       	call   778 <morecore>
+ 893:	83 c4 10             	add    $0x10,%esp
+ 896:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 899:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 89d:	75 07                	jne    8a6 <malloc+0xce>
+        return 0;
+ 89f:	b8 00 00 00 00       	mov    $0x0,%eax
+ 8a4:	eb 13                	jmp    8b9 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8a9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 8ac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8af:	8b 00                	mov    (%eax),%eax
+ 8b1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 8b4:	e9 6d ff ff ff       	jmp    826 <malloc+0x4e>
+  }
+}
+ 8b9:	c9                   	leave
+ 8ba:	c3                   	ret